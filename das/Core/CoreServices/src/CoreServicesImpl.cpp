@@ -19,7 +19,10 @@ CoreServicesImpl::CoreServicesImpl(
     std::filesystem::path                                  settings_dir,
     std::filesystem::path                                  plugin_dir)
     : ipc_context_{std::move(ipc_context)},
-      settings_manager_{std::move(settings_dir)},
+      settings_manager_{
+          std::move(settings_dir),
+          Das::Core::SettingsManager::SettingsWriteBehindOptions{
+              .enabled = true}},
       plugin_manager_{
           settings_manager_,
           DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext>(
@@ -69,6 +72,14 @@ DasResult CoreServicesImpl::ShutdownCoreRuntime() noexcept
     try
     {
         Das::Core::Debug::DebugRuntime::Shutdown();
+        if (const auto flush_result = settings_manager_.FlushPendingWrites();
+            DAS::IsFailed(flush_result))
+        {
+            DAS_CORE_LOG_ERROR(
+                "Failed to persist pending settings. Error code = {}",
+                flush_result);
+            return flush_result;
+        }
         return DAS_S_OK;
     }
     catch (const std::bad_alloc&)
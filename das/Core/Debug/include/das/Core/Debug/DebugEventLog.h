@@ -0,0 +1,44 @@
+#ifndef DAS_CORE_DEBUG_DEBUGEVENTLOG_H
+#define DAS_CORE_DEBUG_DEBUGEVENTLOG_H
+
+#include <das/Core/Debug/Config.h>
+#include <das/DasTypes.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+
+DAS_CORE_DEBUG_NS_BEGIN
+
+enum class DebugEventFormat
+{
+    // debug.jsonl, one JSON object per line
+    Jsonl,
+    // debug.bin, length-prefixed records; see ConvertDebugEventLogToJsonl
+    Binary
+};
+
+struct DebugWriterOptions
+{
+    // 事件写入后最多在内存中停留多久才落盘
+    std::chrono::milliseconds flush_interval{200};
+    // 活动文件超过该大小时轮转，0 表示不轮转
+    uint64_t max_file_bytes{64ULL * 1024 * 1024};
+    // 保留的历史文件数，debug.1.jsonl 最新
+    uint32_t         max_rotated_files{4};
+    DebugEventFormat format{DebugEventFormat::Jsonl};
+};
+
+/**
+ * @brief Convert a binary event log into the JSONL the writer would have
+ * produced for the same events.
+ * @return DAS_S_FALSE if the log ends with a truncated record; every complete
+ * record before it is still converted.
+ */
+DasResult ConvertDebugEventLogToJsonl(
+    const std::filesystem::path& binary_path,
+    const std::filesystem::path& jsonl_path);
+
+DAS_CORE_DEBUG_NS_END
+
+#endif // DAS_CORE_DEBUG_DEBUGEVENTLOG_H
@@ -2,6 +2,7 @@
 #define DAS_CORE_DEBUG_DEBUGRUNTIME_H
 
 #include <das/Core/Debug/Config.h>
+#include <das/Core/Debug/DebugEventLog.h>
 #include <das/DasTypes.hpp>
 
 #include <filesystem>
@@ -12,6 +13,7 @@ DAS_CORE_DEBUG_NS_BEGIN
 struct DebugRuntimeOptions
 {
     std::filesystem::path debug_dir;
+    DebugWriterOptions    writer;
 };
 
 struct DebugEvent;
@@ -25,6 +27,7 @@ public:
     static DasResult Initialize(const DebugRuntimeOptions& options);
     static bool      IsEnabled();
     static const std::filesystem::path& DebugDir();
+    static DebugWriterOptions           WriterOptions();
     static DasResult                    SubmitEvent(const DebugEvent& event);
     static void RegisterSink(std::shared_ptr<IDebugSink> sink);
     static void RegisterDrain(std::shared_ptr<IDebugDrain> drain);
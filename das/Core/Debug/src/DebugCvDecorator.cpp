@@ -130,6 +130,32 @@ namespace
         return info;
     }
 
+    void ReadTemplateMatches(
+        Das::ExportInterface::IDasTemplateMatchResults* p_results,
+        uint32_t&                                       out_raw_match_count,
+        std::vector<TemplateMatchInfo>&                 out_matches)
+    {
+        uint32_t count = 0;
+        static_cast<void>(p_results->GetRawMatchCount(&out_raw_match_count));
+        if (p_results->GetCount(&count) != DAS_S_OK)
+        {
+            return;
+        }
+        out_matches.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            Das::DasPtr<Das::ExportInterface::IDasTemplateMatchResult> match;
+            if (p_results->GetAt(i, match.Put()) == DAS_S_OK)
+            {
+                auto info = ReadTemplateMatch(match.Get());
+                if (info.valid)
+                {
+                    out_matches.push_back(info);
+                }
+            }
+        }
+    }
+
     auto ScoreLabel(double score) -> std::string
     {
         std::ostringstream stream;
@@ -344,26 +370,7 @@ public:
         std::vector<TemplateMatchInfo> matches;
         if (!DAS::IsFailed(result) && pp_out_results && *pp_out_results)
         {
-            uint32_t count = 0;
-            static_cast<void>(
-                (*pp_out_results)->GetRawMatchCount(&raw_match_count));
-            if ((*pp_out_results)->GetCount(&count) == DAS_S_OK)
-            {
-                matches.reserve(count);
-                for (uint32_t i = 0; i < count; ++i)
-                {
-                    Das::DasPtr<Das::ExportInterface::IDasTemplateMatchResult>
-                        match;
-                    if ((*pp_out_results)->GetAt(i, match.Put()) == DAS_S_OK)
-                    {
-                        auto info = ReadTemplateMatch(match.Get());
-                        if (info.valid)
-                        {
-                            matches.push_back(info);
-                        }
-                    }
-                }
-            }
+            ReadTemplateMatches(*pp_out_results, raw_match_count, matches);
         }
 
         auto image_result = SaveOriginalAndAnnotated(
@@ -395,6 +402,173 @@ public:
         return result;
     }
 
+    DAS_IMPL CreateTemplateSearchConfig(
+        Das::ExportInterface::DasTemplateSearchMode      mode,
+        int32_t                                          pyramid_levels,
+        Das::ExportInterface::IDasTemplateSearchConfig** pp_out_config)
+        override
+    {
+        if (!inner_)
+        {
+            return DAS_E_INVALID_POINTER;
+        }
+        return inner_->CreateTemplateSearchConfig(
+            mode,
+            pyramid_levels,
+            pp_out_config);
+    }
+
+    DAS_IMPL TemplateMatchAllWithConfig(
+        Das::ExportInterface::IDasImage*                 p_image,
+        Das::ExportInterface::IDasImage*                 p_template,
+        Das::ExportInterface::DasTemplateMatchType       type,
+        double                                           threshold,
+        int32_t                                          max_count,
+        Das::ExportInterface::IDasTemplateSearchConfig*  p_config,
+        Das::ExportInterface::IDasTemplateMatchResults** pp_out_results)
+        override
+    {
+        if (!inner_)
+        {
+            return DAS_E_INVALID_POINTER;
+        }
+
+        const auto start = Clock::now();
+        const auto result = inner_->TemplateMatchAllWithConfig(
+            p_image,
+            p_template,
+            type,
+            threshold,
+            max_count,
+            p_config,
+            pp_out_results);
+        const auto elapsed = ElapsedMs(start);
+
+        uint32_t                       raw_match_count = 0;
+        std::vector<TemplateMatchInfo> matches;
+        if (!DAS::IsFailed(result) && pp_out_results && *pp_out_results)
+        {
+            ReadTemplateMatches(*pp_out_results, raw_match_count, matches);
+        }
+
+        auto image_result = SaveOriginalAndAnnotated(
+            "template_match_all",
+            CaptureImageSnapshot(p_image),
+            MatchAnnotations(matches));
+
+        auto params =
+            CommonCvParamsJson(service_name_, "TemplateMatchAllWithConfig");
+        (*params.as_object())[std::string_view("match_type")] =
+            static_cast<int64_t>(type);
+        (*params.as_object())[std::string_view("threshold")] = threshold;
+        (*params.as_object())[std::string_view("max_count")] =
+            static_cast<int64_t>(max_count);
+        if (p_config)
+        {
+            auto     mode = Das::ExportInterface::DAS_TEMPLATE_SEARCH_MODE_FULL;
+            int32_t  pyramid_levels = 0;
+            uint32_t region_count = 0;
+            static_cast<void>(p_config->GetMode(&mode));
+            static_cast<void>(p_config->GetPyramidLevels(&pyramid_levels));
+            static_cast<void>(p_config->GetSearchRegionCount(&region_count));
+            (*params.as_object())[std::string_view("search_mode")] =
+                static_cast<int64_t>(mode);
+            (*params.as_object())[std::string_view("pyramid_levels")] =
+                static_cast<int64_t>(pyramid_levels);
+            (*params.as_object())[std::string_view("search_region_count")] =
+                static_cast<uint64_t>(region_count);
+        }
+
+        auto result_json = CommonResultJson(result, image_result);
+        (*result_json.as_object())[std::string_view("match_count")] =
+            static_cast<uint64_t>(matches.size());
+        (*result_json.as_object())[std::string_view("raw_match_count")] =
+            static_cast<uint64_t>(raw_match_count);
+        (*result_json.as_object())[std::string_view("matches")] =
+            MatchesJsonArray(matches);
+
+        SubmitCvEvent(
+            "template_match_all",
+            SerializeJson(std::move(params)),
+            SerializeJson(std::move(result_json)),
+            image_result,
+            elapsed);
+        return result;
+    }
+
+    DAS_IMPL PrepareTemplate(
+        Das::ExportInterface::IDasImage*             p_template,
+        Das::ExportInterface::IDasPreparedTemplate** pp_out_template) override
+    {
+        if (!inner_)
+        {
+            return DAS_E_INVALID_POINTER;
+        }
+        return inner_->PrepareTemplate(p_template, pp_out_template);
+    }
+
+    DAS_IMPL CreatePreparedTemplateSet(
+        Das::ExportInterface::IDasPreparedTemplateSet** pp_out_set) override
+    {
+        if (!inner_)
+        {
+            return DAS_E_INVALID_POINTER;
+        }
+        return inner_->CreatePreparedTemplateSet(pp_out_set);
+    }
+
+    DAS_IMPL TemplateMatchBestMulti(
+        Das::ExportInterface::IDasImage*                 p_image,
+        Das::ExportInterface::IDasPreparedTemplateSet*   p_templates,
+        Das::ExportInterface::DasTemplateMatchType       type,
+        Das::ExportInterface::IDasTemplateMatchResults** pp_out_results)
+        override
+    {
+        if (!inner_)
+        {
+            return DAS_E_INVALID_POINTER;
+        }
+
+        const auto start = Clock::now();
+        const auto result = inner_->TemplateMatchBestMulti(
+            p_image,
+            p_templates,
+            type,
+            pp_out_results);
+        const auto elapsed = ElapsedMs(start);
+
+        uint32_t                       template_count = 0;
+        std::vector<TemplateMatchInfo> matches;
+        if (!DAS::IsFailed(result) && pp_out_results && *pp_out_results)
+        {
+            ReadTemplateMatches(*pp_out_results, template_count, matches);
+        }
+
+        auto image_result = SaveOriginalAndAnnotated(
+            "template_match_best_multi",
+            CaptureImageSnapshot(p_image),
+            MatchAnnotations(matches));
+
+        auto params =
+            CommonCvParamsJson(service_name_, "TemplateMatchBestMulti");
+        (*params.as_object())[std::string_view("match_type")] =
+            static_cast<int64_t>(type);
+
+        auto result_json = CommonResultJson(result, image_result);
+        (*result_json.as_object())[std::string_view("template_count")] =
+            static_cast<uint64_t>(template_count);
+        (*result_json.as_object())[std::string_view("matches")] =
+            MatchesJsonArray(matches);
+
+        SubmitCvEvent(
+            "template_match_best_multi",
+            SerializeJson(std::move(params)),
+            SerializeJson(std::move(result_json)),
+            image_result,
+            elapsed);
+        return result;
+    }
+
     DAS_IMPL ConvertColor(
         Das::ExportInterface::IDasImage*          p_src,
         Das::ExportInterface::DasImagePixelFormat target_format,
@@ -0,0 +1,215 @@
+#include "DebugEventRecord.h"
+
+#include <das/Core/Debug/DebugEventLog.h>
+#include <das/DasApi.h>
+#include <das/Utils/DasJsonCore.h>
+
+#include <array>
+#include <bit>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+DAS_CORE_DEBUG_NS_BEGIN
+namespace
+{
+    template <class T>
+    void AppendLittleEndian(std::string& output, T value)
+    {
+        std::array<char, sizeof(T)> bytes{};
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+        {
+            bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        }
+        output.append(bytes.data(), bytes.size());
+    }
+
+    template <class T>
+    bool ReadLittleEndian(std::string_view& input, T& out_value)
+    {
+        if (input.size() < sizeof(T))
+        {
+            return false;
+        }
+        T value = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+        {
+            value |= static_cast<T>(static_cast<unsigned char>(input[i]))
+                     << (8 * i);
+        }
+        input.remove_prefix(sizeof(T));
+        out_value = value;
+        return true;
+    }
+
+    void AppendString(std::string& output, std::string_view value)
+    {
+        AppendLittleEndian(output, static_cast<uint32_t>(value.size()));
+        output.append(value);
+    }
+
+    bool ReadString(std::string_view& input, std::string& out_value)
+    {
+        uint32_t size = 0;
+        if (!ReadLittleEndian(input, size) || input.size() < size)
+        {
+            return false;
+        }
+        out_value.assign(input.data(), size);
+        input.remove_prefix(size);
+        return true;
+    }
+
+    auto JsonOrEmptyObject(const std::string& json) -> yyjson::value
+    {
+        auto parsed = DAS::Utils::ParseYyjsonFromString(json);
+        return parsed ? std::move(*parsed) : DAS::Utils::MakeYyjsonObject();
+    }
+
+} // namespace
+
+void AppendDebugEventLogHeader(std::string& output)
+{
+    output.append(kDebugEventLogMagic);
+    AppendLittleEndian(output, kDebugEventLogVersion);
+}
+
+void AppendDebugEventRecord(
+    const DebugEventRecord& record,
+    std::string&            output)
+{
+    const auto size_offset = output.size();
+    AppendLittleEndian(output, uint32_t{0});
+
+    AppendLittleEndian(output, record.step);
+    AppendLittleEndian(output, record.process_pid);
+    AppendLittleEndian(output, std::bit_cast<uint64_t>(record.elapsed_ms));
+    AppendString(output, record.type);
+    AppendString(output, record.timestamp);
+    AppendString(output, record.thread_id);
+    AppendString(output, record.params_json);
+    AppendString(output, record.result_json);
+    AppendString(output, record.image_filename);
+
+    // Patch the size prefix now that the payload length is known.
+    std::string size_bytes;
+    AppendLittleEndian(
+        size_bytes,
+        static_cast<uint32_t>(
+            output.size() - size_offset - sizeof(uint32_t)));
+    output.replace(size_offset, size_bytes.size(), size_bytes);
+}
+
+DasResult ReadDebugEventRecord(
+    std::string_view& input,
+    DebugEventRecord& out_record)
+{
+    auto     remaining = input;
+    uint32_t size = 0;
+    if (!ReadLittleEndian(remaining, size) || remaining.size() < size)
+    {
+        return DAS_S_FALSE;
+    }
+
+    auto             payload = remaining.substr(0, size);
+    DebugEventRecord record{};
+    uint64_t         elapsed_bits = 0;
+    if (!ReadLittleEndian(payload, record.step)
+        || !ReadLittleEndian(payload, record.process_pid)
+        || !ReadLittleEndian(payload, elapsed_bits)
+        || !ReadString(payload, record.type)
+        || !ReadString(payload, record.timestamp)
+        || !ReadString(payload, record.thread_id)
+        || !ReadString(payload, record.params_json)
+        || !ReadString(payload, record.result_json)
+        || !ReadString(payload, record.image_filename) || !payload.empty())
+    {
+        return DAS_E_INVALID_FILE;
+    }
+    record.elapsed_ms = std::bit_cast<double>(elapsed_bits);
+
+    input = remaining.substr(size);
+    out_record = std::move(record);
+    return DAS_S_OK;
+}
+
+auto SerializeDebugEventRecordToJson(const DebugEventRecord& record)
+    -> std::optional<std::string>
+{
+    auto obj = DAS::Utils::MakeYyjsonObject();
+    (*obj.as_object())[std::string_view("step")] = record.step;
+    (*obj.as_object())[std::string_view("type")] =
+        std::make_pair(std::string_view(record.type), yyjson::copy_string);
+    (*obj.as_object())[std::string_view("timestamp")] = std::make_pair(
+        std::string_view(record.timestamp),
+        yyjson::copy_string);
+    (*obj.as_object())[std::string_view("params")] =
+        JsonOrEmptyObject(record.params_json);
+    (*obj.as_object())[std::string_view("result")] =
+        JsonOrEmptyObject(record.result_json);
+    (*obj.as_object())[std::string_view("elapsed_ms")] = record.elapsed_ms;
+    (*obj.as_object())[std::string_view("thread_id")] = std::make_pair(
+        std::string_view(record.thread_id),
+        yyjson::copy_string);
+    (*obj.as_object())[std::string_view("process_pid")] = record.process_pid;
+    (*obj.as_object())[std::string_view("image_filename")] = std::make_pair(
+        std::string_view(record.image_filename),
+        yyjson::copy_string);
+
+    return DAS::Utils::SerializeYyjsonValue(obj);
+}
+
+DasResult ConvertDebugEventLogToJsonl(
+    const std::filesystem::path& binary_path,
+    const std::filesystem::path& jsonl_path)
+{
+    std::ifstream input_file{binary_path, std::ios::binary};
+    if (!input_file)
+    {
+        return DAS_E_FILE_NOT_FOUND;
+    }
+    const std::string content{
+        std::istreambuf_iterator<char>{input_file},
+        std::istreambuf_iterator<char>{}};
+
+    std::string_view input{content};
+    uint32_t         version = 0;
+    if (!input.starts_with(kDebugEventLogMagic))
+    {
+        return DAS_E_INVALID_FILE;
+    }
+    input.remove_prefix(kDebugEventLogMagic.size());
+    if (!ReadLittleEndian(input, version) || version != kDebugEventLogVersion)
+    {
+        return DAS_E_INVALID_FILE;
+    }
+
+    std::ofstream output{jsonl_path, std::ios::trunc | std::ios::binary};
+    if (!output)
+    {
+        return DAS_E_INVALID_FILE;
+    }
+
+    DebugEventRecord record{};
+    while (!input.empty())
+    {
+        const auto read_result = ReadDebugEventRecord(input, record);
+        if (read_result != DAS_S_OK)
+        {
+            output.flush();
+            return output ? read_result : DAS_E_INVALID_FILE;
+        }
+
+        auto line = SerializeDebugEventRecordToJson(record);
+        if (!line)
+        {
+            return DAS_E_INVALID_JSON;
+        }
+        output << *line << '\n';
+    }
+
+    output.flush();
+    return output ? DAS_S_OK : DAS_E_INVALID_FILE;
+}
+
+DAS_CORE_DEBUG_NS_END
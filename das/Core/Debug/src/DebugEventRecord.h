@@ -0,0 +1,63 @@
+#ifndef DAS_CORE_DEBUG_DEBUGEVENTRECORD_H
+#define DAS_CORE_DEBUG_DEBUGEVENTRECORD_H
+
+#include <das/Core/Debug/Config.h>
+#include <das/DasTypes.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+DAS_CORE_DEBUG_NS_BEGIN
+
+/**
+ * @brief One event as written to the debug log, with the fields the writer
+ * adds. params_json and result_json are kept as received; they are only
+ * parsed when the record is rendered as JSONL.
+ */
+struct DebugEventRecord
+{
+    uint64_t    step{0};
+    uint64_t    process_pid{0};
+    double      elapsed_ms{0.0};
+    std::string type;
+    std::string timestamp;
+    std::string thread_id;
+    std::string params_json{"{}"};
+    std::string result_json{"{}"};
+    std::string image_filename;
+};
+
+// Binary log layout (all integers little endian):
+//   file   := magic[8] version:u32 record*
+//   record := size:u32 step:u64 process_pid:u64 elapsed_ms:f64
+//             (length:u32 bytes)*6
+// The six strings are type, timestamp, thread_id, params_json, result_json
+// and image_filename, in that order.
+inline constexpr std::string_view kDebugEventLogMagic{"DASDBGEV", 8};
+inline constexpr uint32_t         kDebugEventLogVersion = 1;
+inline constexpr std::size_t      kDebugEventLogHeaderSize =
+    kDebugEventLogMagic.size() + sizeof(uint32_t);
+
+void AppendDebugEventLogHeader(std::string& output);
+
+void AppendDebugEventRecord(
+    const DebugEventRecord& record,
+    std::string&            output);
+
+/**
+ * @brief Decode the record at the front of input and advance input past it.
+ * @return DAS_S_FALSE if input ends in the middle of a record
+ */
+DasResult ReadDebugEventRecord(
+    std::string_view& input,
+    DebugEventRecord& out_record);
+
+/// @brief Render the record as one JSON object, without the trailing newline
+auto SerializeDebugEventRecordToJson(const DebugEventRecord& record)
+    -> std::optional<std::string>;
+
+DAS_CORE_DEBUG_NS_END
+
+#endif // DAS_CORE_DEBUG_DEBUGEVENTRECORD_H
@@ -28,6 +28,7 @@ namespace
         bool                                      initialized{false};
         bool                                      enabled{false};
         std::filesystem::path                     debug_dir{"logs/debug"};
+        DebugWriterOptions                        writer_options;
         std::vector<std::shared_ptr<IDebugSink>>  sinks;
         std::vector<std::shared_ptr<IDebugDrain>> drains;
         std::shared_ptr<DebugImageSnapshot>       latest_image;
@@ -179,6 +180,7 @@ DasResult DebugRuntime::Initialize(const DebugRuntimeOptions& options)
     }
 
     state.debug_dir = ResolveDebugDir(options.debug_dir);
+    state.writer_options = options.writer;
     state.enabled = ReadEnabledSnapshot();
 
     if (state.enabled)
@@ -212,6 +214,13 @@ const std::filesystem::path& DebugRuntime::DebugDir()
     return State().debug_dir;
 }
 
+DebugWriterOptions DebugRuntime::WriterOptions()
+{
+    auto&           state = State();
+    std::lock_guard lock{state.mutex};
+    return state.writer_options;
+}
+
 DasResult DebugRuntime::SubmitEvent(const DebugEvent& event)
 {
     std::vector<std::shared_ptr<IDebugSink>> sinks;
@@ -374,6 +383,7 @@ void DebugRuntime::ResetForTest()
     state.initialized = false;
     state.enabled = false;
     state.debug_dir = std::filesystem::path{"logs/debug"};
+    state.writer_options = DebugWriterOptions{};
     state.sinks.clear();
     state.drains.clear();
     state.latest_image.reset();
@@ -29,6 +29,9 @@ namespace
 {
     constexpr auto kDebugWriterServiceName = "debug.writer";
     constexpr auto kMaxQueuedEvents = 4096U;
+    // Write the coalesced buffer once it grows past this size, even in the
+    // middle of a batch.
+    constexpr std::size_t kWriteBufferBytes = 256 * 1024;
 
     auto NowIsoString() -> std::string
     {
@@ -61,12 +64,6 @@ namespace
 #endif
     }
 
-    auto JsonOrEmptyObject(const std::string& json) -> yyjson::value
-    {
-        auto parsed = DAS::Utils::ParseYyjsonFromString(json);
-        return parsed ? std::move(*parsed) : DAS::Utils::MakeYyjsonObject();
-    }
-
     auto RawParamsJson(const std::string& raw_json) -> std::string
     {
         auto obj = DAS::Utils::MakeYyjsonObject();
@@ -153,32 +150,6 @@ namespace
         return event;
     }
 
-    auto SerializeForJsonl(const DebugEvent& event, uint64_t step)
-        -> std::optional<std::string>
-    {
-        auto obj = DAS::Utils::MakeYyjsonObject();
-        (*obj.as_object())[std::string_view("step")] =
-            static_cast<uint64_t>(step);
-        (*obj.as_object())[std::string_view("type")] =
-            std::make_pair(std::string_view(event.type), yyjson::copy_string);
-        (*obj.as_object())[std::string_view("timestamp")] =
-            event.timestamp.empty() ? NowIsoString() : event.timestamp;
-        (*obj.as_object())[std::string_view("params")] =
-            JsonOrEmptyObject(event.params_json);
-        (*obj.as_object())[std::string_view("result")] =
-            JsonOrEmptyObject(event.result_json);
-        (*obj.as_object())[std::string_view("elapsed_ms")] = event.elapsed_ms;
-        (*obj.as_object())[std::string_view("thread_id")] =
-            CurrentThreadIdString();
-        (*obj.as_object())[std::string_view("process_pid")] =
-            CurrentProcessId();
-        (*obj.as_object())[std::string_view("image_filename")] = std::make_pair(
-            std::string_view(event.image_filename),
-            yyjson::copy_string);
-
-        return DAS::Utils::SerializeYyjsonValue(obj);
-    }
-
     std::shared_ptr<IDebugSink> MakeSinkRef(DebugWriterImpl* writer)
     {
         writer->AddRef();
@@ -197,8 +168,14 @@ namespace
 
 } // namespace
 
-DebugWriterImpl::DebugWriterImpl(std::filesystem::path debug_dir)
-    : debug_dir_(std::move(debug_dir)), jsonl_path_(debug_dir_ / "debug.jsonl")
+DebugWriterImpl::DebugWriterImpl(
+    std::filesystem::path debug_dir,
+    DebugWriterOptions    options)
+    : debug_dir_(std::move(debug_dir)), options_(options),
+      active_path_(
+          debug_dir_
+          / (options_.format == DebugEventFormat::Binary ? "debug.bin"
+                                                         : "debug.jsonl"))
 {
     std::filesystem::create_directories(debug_dir_);
     worker_ = std::thread([this]() { WorkerLoop(); });
@@ -256,28 +233,60 @@ DasResult DebugWriterImpl::Enqueue(QueueItem item)
 
 void DebugWriterImpl::WorkerLoop()
 {
+    std::deque<QueueItem> batch;
+    auto                  last_flush = std::chrono::steady_clock::now();
+    bool                  dirty = false;
+
     for (;;)
     {
-        QueueItem item{};
-        uint64_t  step = 0;
+        uint64_t flush_ticket = 0;
+        bool     stopping = false;
         {
             std::unique_lock lock{mutex_};
-            cv_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
-            if (stopping_ && queue_.empty())
+            const auto       has_work = [this]()
+            {
+                return stopping_ || !queue_.empty()
+                       || flush_requested_ != flush_completed_;
+            };
+            if (dirty)
+            {
+                cv_.wait_until(
+                    lock,
+                    last_flush + options_.flush_interval,
+                    has_work);
+            }
+            else
             {
-                return;
+                cv_.wait(lock, has_work);
             }
 
-            item = std::move(queue_.front());
-            queue_.pop_front();
-            writer_active_ = true;
-            step = next_step_++;
+            batch.swap(queue_);
+            flush_ticket = flush_requested_;
+            stopping = stopping_;
         }
+        // Producers may be blocked on a full queue.
+        cv_.notify_all();
 
         DasResult result = DAS_S_OK;
         try
         {
-            result = WriteOne(item, step);
+            if (!batch.empty())
+            {
+                result = WriteBatch(batch);
+                dirty = true;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            const bool flush_due =
+                stopping || flush_ticket != flush_completed_
+                || now >= last_flush + options_.flush_interval;
+            if (dirty && flush_due)
+            {
+                const auto flush_result = FlushOutput();
+                result = result < 0 ? result : flush_result;
+                dirty = false;
+                last_flush = now;
+            }
         }
         catch (const std::bad_alloc& ex)
         {
@@ -294,6 +303,7 @@ void DebugWriterImpl::WorkerLoop()
             DAS_CORE_LOG_ERROR("Debug writer worker unknown exception");
             result = DAS_E_FAIL;
         }
+        batch.clear();
 
         {
             std::lock_guard lock{mutex_};
@@ -301,36 +311,223 @@ void DebugWriterImpl::WorkerLoop()
             {
                 worker_error_ = result;
             }
-            writer_active_ = false;
+            flush_completed_ = flush_ticket;
+            // Enqueue rejects new events once stopping, so the batch above
+            // was the last one.
+            worker_exited_ = stopping;
         }
         cv_.notify_all();
+
+        if (stopping)
+        {
+            output_.close();
+            return;
+        }
     }
 }
 
-DasResult DebugWriterImpl::WriteOne(const QueueItem& item, uint64_t step)
+DasResult DebugWriterImpl::WriteBatch(std::deque<QueueItem>& batch)
 {
-    const auto event =
+    DasResult result = DAS_S_OK;
+    buffer_.clear();
+    for (const auto& item : batch)
+    {
+        encoded_.clear();
+        const auto encode_result = EncodeOne(item, encoded_);
+        if (encode_result < 0)
+        {
+            result = result < 0 ? result : encode_result;
+            continue;
+        }
+
+        const auto pending_size = output_size_ + buffer_.size();
+        if (options_.max_file_bytes != 0 && output_size_ != 0
+            && pending_size + encoded_.size() > options_.max_file_bytes)
+        {
+            if (const auto write_result = WriteBuffer(); write_result < 0)
+            {
+                return write_result;
+            }
+            if (const auto rotate_result = Rotate(); rotate_result < 0)
+            {
+                return rotate_result;
+            }
+        }
+
+        buffer_ += encoded_;
+        if (buffer_.size() >= kWriteBufferBytes)
+        {
+            if (const auto write_result = WriteBuffer(); write_result < 0)
+            {
+                return write_result;
+            }
+        }
+    }
+
+    const auto write_result = WriteBuffer();
+    return result < 0 ? result : write_result;
+}
+
+DasResult DebugWriterImpl::EncodeOne(
+    const QueueItem& item,
+    std::string&     output)
+{
+    const auto& event =
         item.has_raw_json ? EventFromRawJson(item.raw_json) : item.event;
-    auto line = SerializeForJsonl(event, step);
+
+    record_.step = next_step_++;
+    record_.process_pid = CurrentProcessId();
+    record_.elapsed_ms = event.elapsed_ms;
+    record_.type = event.type;
+    record_.timestamp =
+        event.timestamp.empty() ? NowIsoString() : event.timestamp;
+    if (record_.thread_id.empty())
+    {
+        record_.thread_id = CurrentThreadIdString();
+    }
+    record_.params_json = event.params_json;
+    record_.result_json = event.result_json;
+    record_.image_filename = event.image_filename;
+
+    if (options_.format == DebugEventFormat::Binary)
+    {
+        AppendDebugEventRecord(record_, output);
+        return DAS_S_OK;
+    }
+
+    auto line = SerializeDebugEventRecordToJson(record_);
     if (!line)
     {
         return DAS_E_INVALID_JSON;
     }
+    output += *line;
+    output += '\n';
+    return DAS_S_OK;
+}
 
-    std::ofstream output{jsonl_path_, std::ios::app | std::ios::binary};
-    if (!output)
+DasResult DebugWriterImpl::WriteBuffer()
+{
+    if (buffer_.empty())
+    {
+        return DAS_S_OK;
+    }
+    if (!output_.is_open())
+    {
+        if (const auto open_result = OpenOutput(); open_result < 0)
+        {
+            buffer_.clear();
+            return open_result;
+        }
+    }
+
+    output_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    output_size_ += buffer_.size();
+    buffer_.clear();
+    if (!output_)
+    {
+        // Reopen on the next write instead of failing forever.
+        output_.close();
+        return DAS_E_INVALID_FILE;
+    }
+    return DAS_S_OK;
+}
+
+DasResult DebugWriterImpl::OpenOutput()
+{
+    output_.clear();
+    output_.open(active_path_, std::ios::app | std::ios::binary);
+    if (!output_)
+    {
+        return DAS_E_INVALID_FILE;
+    }
+
+    std::error_code ec;
+    const auto      size = std::filesystem::file_size(active_path_, ec);
+    output_size_ = ec ? 0 : size;
+    if (options_.format == DebugEventFormat::Binary && output_size_ == 0)
+    {
+        std::string header;
+        AppendDebugEventLogHeader(header);
+        output_.write(
+            header.data(),
+            static_cast<std::streamsize>(header.size()));
+        output_size_ = header.size();
+    }
+    return output_ ? DAS_S_OK : DAS_E_INVALID_FILE;
+}
+
+auto DebugWriterImpl::RotatedPath(uint32_t index) const -> std::filesystem::path
+{
+    auto path = active_path_;
+    path.replace_filename(DAS::fmt::format(
+        "{}.{}{}",
+        active_path_.stem().string(),
+        index,
+        active_path_.extension().string()));
+    return path;
+}
+
+DasResult DebugWriterImpl::Rotate()
+{
+    output_.close();
+
+    // debug.jsonl -> debug.1.jsonl -> ... -> debug.N.jsonl -> removed
+    std::error_code ec;
+    if (options_.max_rotated_files == 0)
     {
+        std::filesystem::remove(active_path_, ec);
+    }
+    else
+    {
+        std::filesystem::remove(RotatedPath(options_.max_rotated_files), ec);
+        for (auto index = options_.max_rotated_files; index > 1; --index)
+        {
+            const auto from = RotatedPath(index - 1);
+            if (std::filesystem::exists(from, ec))
+            {
+                std::filesystem::rename(from, RotatedPath(index), ec);
+            }
+        }
+        std::filesystem::rename(active_path_, RotatedPath(1), ec);
+    }
+    if (ec)
+    {
+        DAS_CORE_LOG_ERROR(
+            "Debug writer failed to rotate {}: {}",
+            active_path_.string(),
+            ec.message());
+    }
+
+    return OpenOutput();
+}
+
+DasResult DebugWriterImpl::FlushOutput()
+{
+    if (!output_.is_open())
+    {
+        return DAS_S_OK;
+    }
+    output_.flush();
+    if (!output_)
+    {
+        output_.close();
         return DAS_E_INVALID_FILE;
     }
-    output << *line << '\n';
-    output.flush();
-    return output ? DAS_S_OK : DAS_E_INVALID_FILE;
+    return DAS_S_OK;
 }
 
 DasResult DebugWriterImpl::Flush()
 {
     std::unique_lock lock{mutex_};
-    cv_.wait(lock, [this]() { return queue_.empty() && !writer_active_; });
+    if (!worker_exited_)
+    {
+        const auto ticket = ++flush_requested_;
+        cv_.notify_all();
+        cv_.wait(
+            lock,
+            [this, ticket]()
+            { return worker_exited_ || flush_completed_ >= ticket; });
+    }
     const auto result = worker_error_;
     worker_error_ = DAS_S_OK;
     return result;
@@ -362,8 +559,9 @@ DasResult RegisterDebugWriterService(
         return DAS_S_OK;
     }
 
-    auto writer = Das::DasPtr<DebugWriterImpl>::Attach(
-        DebugWriterImpl::MakeRaw(DebugRuntime::DebugDir()));
+    auto writer = Das::DasPtr<DebugWriterImpl>::Attach(DebugWriterImpl::MakeRaw(
+        DebugRuntime::DebugDir(),
+        DebugRuntime::WriterOptions()));
     auto result = ipc_context.RegisterServiceByName(
         writer.Get(),
         DasIidOf<Das::ExportInterface::IDasDebugWriter>(),
@@ -1,7 +1,10 @@
 #ifndef DAS_CORE_DEBUG_DEBUGWRITERIMPL_H
 #define DAS_CORE_DEBUG_DEBUGWRITERIMPL_H
 
+#include "DebugEventRecord.h"
+
 #include <das/Core/Debug/DebugEvent.h>
+#include <das/Core/Debug/DebugEventLog.h>
 #include <das/Core/Debug/DebugSink.h>
 #include <das/Core/IPC/MainProcess/IIpcContext.h>
 #include <das/_autogen/idl/wrapper/Das.ExportInterface.IDasDebugWriter.Implements.hpp>
@@ -10,19 +13,32 @@
 #include <cstdint>
 #include <deque>
 #include <filesystem>
+#include <fstream>
 #include <mutex>
 #include <string>
 #include <thread>
 
 DAS_CORE_DEBUG_NS_BEGIN
 
+/**
+ * @brief Writes debug events to debug.jsonl (or debug.bin) on a worker
+ * thread.
+ *
+ * The file stays open. Every wakeup the worker takes all queued events,
+ * encodes them into one buffer and writes it in one call. The stream is
+ * flushed when Flush() is called, on shutdown, or once
+ * DebugWriterOptions::flush_interval has passed since the last flush. The
+ * active file is rotated before it would exceed max_file_bytes.
+ */
 class DebugWriterImpl final
     : public Das::ExportInterface::DasDebugWriterImplBase<DebugWriterImpl>,
       public IDebugSink,
       public IDebugDrain
 {
 public:
-    explicit DebugWriterImpl(std::filesystem::path debug_dir);
+    explicit DebugWriterImpl(
+        std::filesystem::path debug_dir,
+        DebugWriterOptions    options = {});
     ~DebugWriterImpl() override;
 
     DasResult DAS_STD_CALL LogEntry(IDasReadOnlyString* p_event_json) override;
@@ -41,19 +57,37 @@ private:
 
     DasResult Enqueue(QueueItem item);
     void      WorkerLoop();
-    DasResult WriteOne(const QueueItem& item, uint64_t step);
+    DasResult WriteBatch(std::deque<QueueItem>& batch);
+    DasResult EncodeOne(const QueueItem& item, std::string& output);
+    DasResult WriteBuffer();
+    DasResult OpenOutput();
+    DasResult Rotate();
+    DasResult FlushOutput();
+    auto      RotatedPath(uint32_t index) const -> std::filesystem::path;
 
     std::filesystem::path   debug_dir_;
-    std::filesystem::path   jsonl_path_;
+    DebugWriterOptions      options_;
+    std::filesystem::path   active_path_;
     std::mutex              mutex_;
     std::condition_variable cv_;
     std::deque<QueueItem>   queue_;
     bool                    stopping_{false};
     bool                    worker_started_{false};
-    bool                    writer_active_{false};
+    bool                    worker_exited_{false};
     DasResult               worker_error_{DAS_S_OK};
-    uint64_t                next_step_{1};
+    // Flush() takes a ticket; the worker publishes the last ticket it
+    // flushed for.
+    uint64_t                flush_requested_{0};
+    uint64_t                flush_completed_{0};
     std::thread             worker_;
+
+    // Only touched by the worker thread.
+    std::ofstream    output_;
+    uint64_t         output_size_{0};
+    std::string      buffer_;
+    std::string      encoded_;
+    DebugEventRecord record_;
+    uint64_t         next_step_{1};
 };
 
 DasResult RegisterDebugWriterService(
@@ -0,0 +1,324 @@
+#include <das/Core/Debug/DebugEvent.h>
+#include <das/Core/Debug/DebugEventLog.h>
+#include <das/DasApi.h>
+#include <das/DasPtr.hpp>
+#include <gtest/gtest.h>
+
+#include "../src/DebugWriterImpl.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Das::Core::Debug::Test
+{
+    namespace
+    {
+        auto UniqueTempDir(const char* test_name) -> std::filesystem::path
+        {
+            const auto stamp =
+                std::chrono::steady_clock::now().time_since_epoch().count();
+            auto path =
+                std::filesystem::current_path() / "debug-test-output"
+                / (std::string{test_name} + "-" + std::to_string(stamp));
+            std::filesystem::remove_all(path);
+            return path;
+        }
+
+        auto ReadLines(const std::filesystem::path& path)
+            -> std::vector<std::string>
+        {
+            std::ifstream            input{path};
+            std::vector<std::string> lines;
+            std::string              line;
+            while (std::getline(input, line))
+            {
+                lines.emplace_back(std::move(line));
+            }
+            return lines;
+        }
+
+        auto MakeWriter(
+            const std::filesystem::path& dir,
+            const DebugWriterOptions&    options) -> DasPtr<DebugWriterImpl>
+        {
+            return DasPtr<DebugWriterImpl>::Attach(
+                DebugWriterImpl::MakeRaw(dir, options));
+        }
+
+        auto MakeNumberedEvent(std::size_t index) -> DebugEvent
+        {
+            DebugEvent event{};
+            event.type = "node";
+            event.timestamp = "2026-05-07T01:02:03Z";
+            event.params_json =
+                "{\"index\":" + std::to_string(index) + ",\"name\":\"n\"}";
+            event.result_json = "{\"ok\":true}";
+            event.elapsed_ms = 0.25;
+            event.image_filename = "img/" + std::to_string(index) + ".png";
+            return event;
+        }
+
+        auto StepOf(const std::string& line) -> uint64_t
+        {
+            static const std::regex step_pattern{"\"step\":([0-9]+)"};
+            std::smatch             match;
+            if (!std::regex_search(line, match, step_pattern))
+            {
+                ADD_FAILURE() << "line has no step: " << line;
+                return 0;
+            }
+            return std::stoull(match[1].str());
+        }
+
+        auto WithoutThreadId(const std::string& line) -> std::string
+        {
+            static const std::regex thread_pattern{"\"thread_id\":\"[^\"]*\""};
+            return std::regex_replace(line, thread_pattern, "");
+        }
+
+        /// Submit count events from thread_count threads and flush; events/s
+        auto MeasureThroughput(
+            DebugWriterImpl&  writer,
+            const std::size_t thread_count,
+            const std::size_t count) -> double
+        {
+            const auto event = MakeNumberedEvent(0);
+            const auto start = std::chrono::steady_clock::now();
+
+            std::vector<std::thread> producers;
+            for (std::size_t t = 0; t < thread_count; ++t)
+            {
+                producers.emplace_back(
+                    [&writer, &event, thread_count, count]()
+                    {
+                        for (std::size_t i = 0; i < count / thread_count; ++i)
+                        {
+                            EXPECT_EQ(writer.Submit(event), DAS_S_OK);
+                        }
+                    });
+            }
+            for (auto& producer : producers)
+            {
+                producer.join();
+            }
+            EXPECT_EQ(writer.Flush(), DAS_S_OK);
+
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+            return static_cast<double>(count) / elapsed.count();
+        }
+    } // namespace
+
+    TEST(DebugWriterTest, CoalescedWritesKeepSubmissionOrder)
+    {
+        const auto dir = UniqueTempDir("WriterCoalescedOrder");
+        const auto writer = MakeWriter(dir, {});
+
+        constexpr std::size_t kEvents = 1000;
+        for (std::size_t i = 0; i < kEvents; ++i)
+        {
+            ASSERT_EQ(writer->Submit(MakeNumberedEvent(i)), DAS_S_OK);
+        }
+        ASSERT_EQ(writer->Flush(), DAS_S_OK);
+
+        const auto lines = ReadLines(dir / "debug.jsonl");
+        ASSERT_EQ(lines.size(), kEvents);
+        for (std::size_t i = 0; i < kEvents; ++i)
+        {
+            EXPECT_EQ(StepOf(lines[i]), i + 1);
+            EXPECT_NE(
+                lines[i].find("\"index\":" + std::to_string(i) + ","),
+                std::string::npos);
+        }
+        writer->Shutdown();
+    }
+
+    TEST(DebugWriterTest, FlushIntervalPersistsWithoutExplicitFlush)
+    {
+        const auto         dir = UniqueTempDir("WriterFlushInterval");
+        DebugWriterOptions options{};
+        options.flush_interval = std::chrono::milliseconds{20};
+        const auto writer = MakeWriter(dir, options);
+
+        ASSERT_EQ(writer->Submit(MakeNumberedEvent(7)), DAS_S_OK);
+
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (ReadLines(dir / "debug.jsonl").empty()
+               && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        }
+        EXPECT_EQ(ReadLines(dir / "debug.jsonl").size(), 1U);
+        writer->Shutdown();
+    }
+
+    TEST(DebugWriterTest, RotatesActiveFileBySize)
+    {
+        const auto         dir = UniqueTempDir("WriterRotation");
+        DebugWriterOptions options{};
+        options.max_file_bytes = 4096;
+        options.max_rotated_files = 2;
+        const auto writer = MakeWriter(dir, options);
+
+        constexpr std::size_t kEvents = 200;
+        for (std::size_t i = 0; i < kEvents; ++i)
+        {
+            ASSERT_EQ(writer->Submit(MakeNumberedEvent(i)), DAS_S_OK);
+        }
+        ASSERT_EQ(writer->Flush(), DAS_S_OK);
+        writer->Shutdown();
+
+        const std::vector<std::filesystem::path> files{
+            dir / "debug.2.jsonl",
+            dir / "debug.1.jsonl",
+            dir / "debug.jsonl"};
+        EXPECT_FALSE(std::filesystem::exists(dir / "debug.3.jsonl"));
+
+        // Oldest to newest, the kept files hold one contiguous run of steps
+        // ending at the last event.
+        uint64_t previous_step = 0;
+        for (const auto& file : files)
+        {
+            ASSERT_TRUE(std::filesystem::exists(file)) << file;
+            EXPECT_LE(
+                std::filesystem::file_size(file),
+                options.max_file_bytes);
+            for (const auto& line : ReadLines(file))
+            {
+                const auto step = StepOf(line);
+                if (previous_step != 0)
+                {
+                    EXPECT_EQ(step, previous_step + 1);
+                }
+                previous_step = step;
+            }
+        }
+        EXPECT_EQ(previous_step, kEvents);
+    }
+
+    TEST(DebugWriterTest, BinaryLogConvertsToSameJsonl)
+    {
+        const auto jsonl_dir = UniqueTempDir("WriterJsonlReference");
+        const auto binary_dir = UniqueTempDir("WriterBinary");
+
+        DebugWriterOptions binary_options{};
+        binary_options.format = DebugEventFormat::Binary;
+        const auto jsonl_writer = MakeWriter(jsonl_dir, {});
+        const auto binary_writer = MakeWriter(binary_dir, binary_options);
+
+        DasU8StringOnStack raw{
+            "{\"type\":\"raw\",\"params\":{\"a\":[1,2]},\"result\":{}}"};
+        for (std::size_t i = 0; i < 50; ++i)
+        {
+            ASSERT_EQ(jsonl_writer->Submit(MakeNumberedEvent(i)), DAS_S_OK);
+            ASSERT_EQ(binary_writer->Submit(MakeNumberedEvent(i)), DAS_S_OK);
+        }
+        ASSERT_EQ(jsonl_writer->LogEntry(&raw), DAS_S_OK);
+        ASSERT_EQ(binary_writer->LogEntry(&raw), DAS_S_OK);
+        jsonl_writer->Shutdown();
+        binary_writer->Shutdown();
+
+        EXPECT_FALSE(std::filesystem::exists(binary_dir / "debug.jsonl"));
+        ASSERT_EQ(
+            ConvertDebugEventLogToJsonl(
+                binary_dir / "debug.bin",
+                binary_dir / "converted.jsonl"),
+            DAS_S_OK);
+
+        const auto expected = ReadLines(jsonl_dir / "debug.jsonl");
+        const auto converted = ReadLines(binary_dir / "converted.jsonl");
+        ASSERT_EQ(converted.size(), expected.size());
+        ASSERT_EQ(converted.size(), 51U);
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            // The thread id is the one of each writer's worker.
+            EXPECT_EQ(
+                WithoutThreadId(converted[i]),
+                WithoutThreadId(expected[i]));
+        }
+        EXPECT_LT(
+            std::filesystem::file_size(binary_dir / "debug.bin"),
+            std::filesystem::file_size(jsonl_dir / "debug.jsonl"));
+    }
+
+    TEST(DebugWriterTest, ConverterKeepsRecordsBeforeTruncatedTail)
+    {
+        const auto         dir = UniqueTempDir("WriterBinaryTruncated");
+        DebugWriterOptions options{};
+        options.format = DebugEventFormat::Binary;
+        const auto writer = MakeWriter(dir, options);
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            ASSERT_EQ(writer->Submit(MakeNumberedEvent(i)), DAS_S_OK);
+        }
+        writer->Shutdown();
+
+        const auto binary_path = dir / "debug.bin";
+        std::filesystem::resize_file(
+            binary_path,
+            std::filesystem::file_size(binary_path) - 3);
+
+        EXPECT_EQ(
+            ConvertDebugEventLogToJsonl(binary_path, dir / "converted.jsonl"),
+            DAS_S_FALSE);
+        EXPECT_EQ(ReadLines(dir / "converted.jsonl").size(), 2U);
+
+        std::ofstream{dir / "not-a-log.bin"} << "{}";
+        EXPECT_EQ(
+            ConvertDebugEventLogToJsonl(
+                dir / "not-a-log.bin",
+                dir / "converted.jsonl"),
+            DAS_E_INVALID_FILE);
+    }
+
+    TEST(DebugWriterThroughputTest, ReportsEventsPerSecond)
+    {
+        constexpr std::size_t kThreads = 4;
+        constexpr std::size_t kEvents = 20000;
+
+        for (const auto format :
+             {DebugEventFormat::Jsonl, DebugEventFormat::Binary})
+        {
+            const bool is_binary = format == DebugEventFormat::Binary;
+            const auto dir = UniqueTempDir(
+                is_binary ? "WriterThroughputBinary" : "WriterThroughputJsonl");
+            DebugWriterOptions options{};
+            options.format = format;
+            const auto writer = MakeWriter(dir, options);
+
+            const auto events_per_second =
+                MeasureThroughput(*writer.Get(), kThreads, kEvents);
+            writer->Shutdown();
+
+            const auto name = is_binary ? "binary" : "jsonl";
+            std::cout << "[ DebugWriter ] " << name << ": "
+                      << static_cast<uint64_t>(events_per_second)
+                      << " events/s (" << kEvents << " events, " << kThreads
+                      << " producer threads)\n";
+            RecordProperty(
+                std::string{name} + "_events_per_second",
+                std::to_string(static_cast<uint64_t>(events_per_second)));
+
+            if (!is_binary)
+            {
+                EXPECT_EQ(ReadLines(dir / "debug.jsonl").size(), kEvents);
+            }
+            else
+            {
+                ASSERT_EQ(
+                    ConvertDebugEventLogToJsonl(
+                        dir / "debug.bin",
+                        dir / "converted.jsonl"),
+                    DAS_S_OK);
+                EXPECT_EQ(ReadLines(dir / "converted.jsonl").size(), kEvents);
+            }
+        }
+    }
+} // namespace Das::Core::Debug::Test
@@ -0,0 +1,169 @@
+#ifndef DAS_CORE_FOREIGNINTERFACEHOST_DASSTRINGATOM_H
+#define DAS_CORE_FOREIGNINTERFACEHOST_DASSTRINGATOM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <das/Core/ForeignInterfaceHost/Config.h>
+#include <das/Core/ForeignInterfaceHost/DasUtf8StringImpl.h>
+#include <das/DasString.hpp>
+#include <das/Utils/Expected.h>
+#include <das/Utils/fmt.h>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+DAS_CORE_FOREIGNINTERFACEHOST_NS_BEGIN
+
+/**
+ * @brief 驻留（intern）字符串的句柄
+ *
+ * 相同 UTF-8 内容在进程内总是得到同一个原子，比较与哈希只看原子本身，
+ * 均为 O(1)。原子指向的 DasUtf8StringImpl 由全局驻留表持有，常驻到进程
+ * 退出，因此只应用于端口名等有限集合。默认构造的原子表示空字符串，ID 为 0。
+ *
+ * 由字符串构造会加锁查询驻留表、必要时插入，因此构造函数均为 explicit：
+ * 应在构建期（如图降级）一次性驻留，运行期查询改用 FindStringAtom。
+ */
+class DasStringAtom
+{
+    const DasUtf8StringImpl* p_string_{nullptr};
+
+    explicit DasStringAtom(const DasUtf8StringImpl* p_string) noexcept
+        : p_string_{p_string}
+    {
+    }
+
+    friend auto FindStringAtom(std::string_view utf8) noexcept
+        -> std::optional<DasStringAtom>;
+    friend auto ToStringAtom(IDasReadOnlyString* p_string)
+        -> DAS::Utils::Expected<DasStringAtom>;
+    friend auto FindStringAtom(IDasReadOnlyString* p_string)
+        -> DAS::Utils::Expected<std::optional<DasStringAtom>>;
+
+public:
+    DasStringAtom() noexcept = default;
+    explicit DasStringAtom(std::string_view utf8);
+    explicit DasStringAtom(const std::string& utf8)
+        : DasStringAtom{std::string_view{utf8}}
+    {
+    }
+    explicit DasStringAtom(const char* p_utf8)
+        : DasStringAtom{
+              p_utf8 == nullptr ? std::string_view{} : std::string_view{p_utf8}}
+    {
+    }
+
+    /// 驻留表分配的 ID，从 1 开始连续递增，空字符串为 0
+    [[nodiscard]]
+    uint32_t GetId() const noexcept
+    {
+        return p_string_ == nullptr ? 0 : p_string_->GetAtomId();
+    }
+
+    [[nodiscard]]
+    std::string_view View() const noexcept
+    {
+        return p_string_ == nullptr ? std::string_view{} : p_string_->View();
+    }
+
+    /// 以 '\0' 结尾的 UTF-8 内容
+    [[nodiscard]]
+    const char* CStr() const noexcept
+    {
+        return p_string_ == nullptr ? "" : View().data();
+    }
+
+    [[nodiscard]]
+    bool Empty() const noexcept
+    {
+        return p_string_ == nullptr;
+    }
+
+    /**
+     * @brief 借用对应的驻留 IDasReadOnlyString，不增加引用计数
+     * @return 始终非空，空字符串返回 CreateNullDasString 的对象
+     */
+    [[nodiscard]]
+    IDasReadOnlyString* GetString() const noexcept;
+
+    [[nodiscard]]
+    DasReadOnlyString ToDasString() const { return {GetString()}; }
+
+    bool operator==(const DasStringAtom& other) const noexcept = default;
+
+    friend bool operator==(
+        const DasStringAtom& lhs,
+        std::string_view     rhs) noexcept
+    {
+        return lhs.View() == rhs;
+    }
+
+    friend bool operator==(const DasStringAtom& lhs, const char* rhs) noexcept
+    {
+        return lhs.View() == (rhs == nullptr ? std::string_view{} : rhs);
+    }
+
+    friend bool operator==(
+        const DasStringAtom& lhs,
+        const std::string&   rhs) noexcept
+    {
+        return lhs.View() == rhs;
+    }
+};
+
+/**
+ * @brief 只查询不插入：utf8 尚未驻留时返回 std::nullopt
+ *
+ * 用于查找类操作，避免任意查询键进入驻留表。
+ */
+auto FindStringAtom(std::string_view utf8) noexcept
+    -> std::optional<DasStringAtom>;
+
+/**
+ * @brief 取 p_string 内容对应的原子
+ *
+ * p_string 本身是驻留字符串时直接取其原子，不做查表；否则按 GetUtf8 的
+ * 内容驻留。
+ */
+auto ToStringAtom(IDasReadOnlyString* p_string)
+    -> DAS::Utils::Expected<DasStringAtom>;
+
+/**
+ * @brief 与 ToStringAtom 相同，但 p_string 尚未驻留时返回 std::nullopt
+ */
+auto FindStringAtom(IDasReadOnlyString* p_string)
+    -> DAS::Utils::Expected<std::optional<DasStringAtom>>;
+
+/**
+ * @brief 已驻留的字符串数量（不含空字符串）
+ */
+[[nodiscard]]
+std::size_t GetStringAtomCount() noexcept;
+
+DAS_CORE_FOREIGNINTERFACEHOST_NS_END
+
+template <>
+struct std::hash<DAS::Core::ForeignInterfaceHost::DasStringAtom>
+{
+    std::size_t operator()(
+        const DAS::Core::ForeignInterfaceHost::DasStringAtom& atom)
+        const noexcept
+    {
+        return std::hash<uint32_t>{}(atom.GetId());
+    }
+};
+
+template <>
+struct DAS_FMT_NS::formatter<DAS::Core::ForeignInterfaceHost::DasStringAtom,
+                             char> : public formatter<std::string_view, char>
+{
+    auto format(
+        const DAS::Core::ForeignInterfaceHost::DasStringAtom& atom,
+        format_context& ctx) const -> decltype(ctx.out())
+    {
+        return formatter<std::string_view, char>::format(atom.View(), ctx);
+    }
+};
+
+#endif // DAS_CORE_FOREIGNINTERFACEHOST_DASSTRINGATOM_H
@@ -0,0 +1,104 @@
+#ifndef DAS_CORE_FOREIGNINTERFACEHOST_DASUTF8STRINGIMPL_H
+#define DAS_CORE_FOREIGNINTERFACEHOST_DASUTF8STRINGIMPL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <das/Core/ForeignInterfaceHost/Config.h>
+#include <das/DasString.hpp>
+#include <das/Utils/CommonUtils.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// {80CE07E0-B098-47E0-80D6-3E234CE39758}
+DAS_DEFINE_CLASS_IN_NAMESPACE(
+    Das::Core::ForeignInterfaceHost,
+    DasUtf8StringImpl,
+    0x80ce07e0,
+    0xb098,
+    0x47e0,
+    0x80,
+    0xd6,
+    0x3e,
+    0x23,
+    0x4c,
+    0xe3,
+    0x97,
+    0x58);
+
+DAS_CORE_FOREIGNINTERFACEHOST_NS_BEGIN
+
+/**
+ * @brief 以 UTF-8 原样存储的不可变字符串
+ *
+ * GetUtf8 直接返回内部缓冲区，不经过 ICU 转码；不超过 INLINE_CAPACITY
+ * 字节的字符串存放在对象内部，不另行分配。UTF-16/UTF-32 表示在首次请求时
+ * 生成并缓存，生成过程是线程安全的，因此同一对象可以被多个线程同时读取。
+ * 驻留字符串（DasStringAtom）均为此类型。
+ */
+class DasUtf8StringImpl final : public IDasReadOnlyString
+{
+public:
+    /// 对象内缓冲区可容纳的最大字节数（不含结尾的 '\0'）
+    static constexpr std::size_t INLINE_CAPACITY = 31;
+
+private:
+    DAS::Utils::RefCounter<DasUtf8StringImpl> ref_counter_{};
+
+    std::size_t             size_;
+    /// 驻留表分配的原子 ID，0 表示未驻留
+    uint32_t                atom_id_;
+    const char*             p_data_;
+    std::unique_ptr<char[]> heap_buffer_;
+    char                    inline_buffer_[INLINE_CAPACITY + 1];
+
+    std::once_flag       utf16_once_;
+    std::u16string       utf16_cache_;
+    std::once_flag       utf32_once_;
+    std::vector<int32_t> utf32_cache_;
+
+    void UpdateUtf16Cache();
+    void UpdateUtf32Cache();
+
+public:
+    /**
+     * @param utf8 UTF-8 内容，不要求以 '\0' 结尾
+     * @param atom_id 驻留表分配的原子 ID，普通字符串为 0
+     */
+    explicit DasUtf8StringImpl(std::string_view utf8, uint32_t atom_id = 0);
+    ~DasUtf8StringImpl();
+
+    DasUtf8StringImpl(const DasUtf8StringImpl&) = delete;
+    DasUtf8StringImpl& operator=(const DasUtf8StringImpl&) = delete;
+
+    // * IDasBase
+    uint32_t  AddRef() override;
+    uint32_t  Release() override;
+    DasResult QueryInterface(const DasGuid& iid, void** pp_object) override;
+    // * IDasReadOnlyString
+    DasResult GetUtf8(const char** out_string) override;
+    DasResult GetUtf16(
+        const char16_t** out_string,
+        size_t*          out_string_size) noexcept override;
+    DasBool        Equals(IDasReadOnlyString* other) noexcept override;
+    const int32_t* CBegin() override;
+    const int32_t* CEnd() override;
+    // * DasUtf8StringImpl
+    [[nodiscard]]
+    std::string_view View() const noexcept
+    {
+        return {p_data_, size_};
+    }
+
+    [[nodiscard]]
+    uint32_t GetAtomId() const noexcept
+    {
+        return atom_id_;
+    }
+};
+
+DAS_CORE_FOREIGNINTERFACEHOST_NS_END
+
+#endif // DAS_CORE_FOREIGNINTERFACEHOST_DASUTF8STRINGIMPL_H
@@ -170,6 +170,8 @@ struct PluginPackageDesc
     std::optional<std::string>     opt_resource_path;
     DasGuid                        guid;
     std::vector<PluginSettingDesc> settings_desc;
+    /// 需要先于本插件加载的插件 GUID（manifest 中的 dependencies）。
+    std::vector<DasGuid> dependencies;
 
     /// Plugin-GUID-keyed settings descriptor groups from manifest.
     std::unordered_map<DasGuid, PluginSettingsGroup> settings_groups;
@@ -0,0 +1,139 @@
+#ifndef DAS_CORE_FOREIGNINTERFACEHOST_HOSTLAUNCHERPOOL_H
+#define DAS_CORE_FOREIGNINTERFACEHOST_HOSTLAUNCHERPOOL_H
+
+#include <das/Core/ForeignInterfaceHost/Config.h>
+#include <das/Core/IPC/MainProcess/IHostLauncher.h>
+#include <das/Core/IPC/MainProcess/IIpcContext.h>
+#include <das/DasPtr.hpp>
+#include <das/DasSharedRef.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+DAS_CORE_FOREIGNINTERFACEHOST_NS_BEGIN
+
+struct HostLauncherPoolOptions
+{
+    /// 每种启动参数保留的空闲 Host 数，0 表示关闭预热
+    size_t idle_per_kind = 1;
+    /// 后台启动 Host（含握手）的超时
+    std::chrono::milliseconds start_timeout{std::chrono::seconds{30}};
+
+    /**
+     * @brief 读取环境变量 DAS_HOST_POOL_SIZE 覆盖 idle_per_kind
+     */
+    static HostLauncherPoolOptions FromEnvironment();
+};
+
+/**
+ * @brief 预先启动并完成握手的 Host 进程池
+ *
+ * 以 HostLaunchDesc（可执行文件、参数、工作目录、环境配置）区分 Host
+ * 种类。首次以某种参数冷启动 Host 时登记该种类，之后后台线程保持
+ * idle_per_kind 个已握手的空闲 Host；LoadPlugin 通过 TryClaim 直接取用，
+ * 取走后在后台补充。Host 崩溃后重新加载插件同样直接取用空闲 Host。
+ *
+ * Host 没有卸载插件的协议，加载过插件的 Host 不会放回池中。
+ *
+ * @thread_safety 所有公开方法均为线程安全。
+ */
+class HostLauncherPool
+{
+public:
+    HostLauncherPool(
+        DAS::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext>
+                                ipc_context,
+        HostLauncherPoolOptions options = {});
+    ~HostLauncherPool();
+
+    HostLauncherPool(const HostLauncherPool&) = delete;
+    HostLauncherPool& operator=(const HostLauncherPool&) = delete;
+
+    /**
+     * @brief 取出一个与 desc 参数相同、仍在运行的空闲 Host
+     *
+     * 无论是否命中，都会登记该种类并在后台补充空闲 Host。
+     *
+     * @return 命中时返回 true，并输出 launcher 与 session_id
+     */
+    bool TryClaim(
+        const DAS::Core::IPC::HostLaunchDesc&        desc,
+        DAS::DasPtr<DAS::Core::IPC::IHostLauncher>& out_launcher,
+        uint16_t&                                    out_session_id);
+
+    /**
+     * @brief 登记一种 Host 并在后台启动空闲 Host
+     */
+    void Prewarm(const DAS::Core::IPC::HostLaunchDesc& desc);
+
+    /**
+     * @brief 返回 desc 对应种类当前的空闲 Host 数
+     */
+    size_t GetIdleCount(const DAS::Core::IPC::HostLaunchDesc& desc) const;
+
+    /**
+     * @brief 停止后台线程并关闭所有空闲 Host。可重复调用。
+     */
+    void Shutdown();
+
+    [[nodiscard]]
+    bool IsEnabled() const
+    {
+        return options_.idle_per_kind != 0;
+    }
+
+private:
+    struct IdleHost
+    {
+        DAS::DasPtr<DAS::Core::IPC::IHostLauncher> launcher;
+        uint16_t                                   session_id = 0;
+    };
+
+    /// 一种 Host 的启动参数（持有字符串引用）与空闲 Host
+    struct Kind
+    {
+        DAS::DasPtr<IDasReadOnlyString>              executable;
+        std::vector<DAS::DasPtr<IDasReadOnlyString>> args;
+        std::vector<IDasReadOnlyString*>             arg_ptrs;
+        DAS::DasPtr<IDasReadOnlyString>              working_directory;
+        DAS::DasPtr<IDasReadOnlyString>              environment_config;
+        DAS::Core::IPC::HostLaunchDesc               desc{};
+        std::deque<IdleHost>                         idle;
+        size_t                                       starting = 0;
+        /// 上次后台启动失败，直到下一次 TryClaim/Prewarm 前不再重试
+        bool                                         start_failed = false;
+    };
+
+    static std::string MakeKey(const DAS::Core::IPC::HostLaunchDesc& desc);
+
+    Kind& RegisterKindLocked(
+        const std::string&                    key,
+        const DAS::Core::IPC::HostLaunchDesc& desc);
+    void RequestReplenishLocked(const std::string& key);
+    void WorkerLoop();
+    void ReplenishKind(const std::string& key);
+    void DiscardHost(IdleHost& host);
+
+    DAS::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext> ipc_context_;
+    HostLauncherPoolOptions                                     options_;
+
+    mutable std::mutex                                     mutex_;
+    std::condition_variable                                cv_;
+    std::unordered_map<std::string, std::unique_ptr<Kind>> kinds_;
+    std::deque<std::string>                                replenish_queue_;
+    bool                                                   stopping_ = false;
+    std::thread                                            worker_;
+};
+
+DAS_CORE_FOREIGNINTERFACEHOST_NS_END
+
+#endif // DAS_CORE_FOREIGNINTERFACEHOST_HOSTLAUNCHERPOOL_H
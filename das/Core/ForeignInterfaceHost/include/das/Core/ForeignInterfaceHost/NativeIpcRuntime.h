@@ -1,6 +1,7 @@
 #ifndef DAS_CORE_FOREIGNINTERFACEHOST_NATIVEIPCRUNTIME_H
 #define DAS_CORE_FOREIGNINTERFACEHOST_NATIVEIPCRUNTIME_H
 
+#include <das/Core/ForeignInterfaceHost/HostLauncherPool.h>
 #include <das/Core/ForeignInterfaceHost/RemotePluginHost.h>
 
 #include <chrono>
@@ -22,6 +23,13 @@ public:
         const RuntimeLoadRequest& request,
         RuntimeLoadResult*        out_result) override;
 
+    /**
+     * @brief 以 LoadPlugin 相同的启动参数在 pool 中预热 DasHost
+     */
+    static DasResult PrewarmHost(
+        const std::filesystem::path& host_exe_path,
+        HostLauncherPool&            pool);
+
 private:
     std::filesystem::path              host_exe_path_;
     std::unique_ptr<IRemotePluginHost> remote_plugin_host_;
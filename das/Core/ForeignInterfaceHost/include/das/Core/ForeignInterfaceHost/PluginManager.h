@@ -6,6 +6,7 @@
 #include <das/Core/ForeignInterfaceHost/DasGuid.h>
 #include <das/Core/ForeignInterfaceHost/ErrorLensManager.h>
 #include <das/Core/ForeignInterfaceHost/ForeignInterfaceHost.h>
+#include <das/Core/ForeignInterfaceHost/HostLauncherPool.h>
 #include <das/Core/ForeignInterfaceHost/RuntimeProvider.h>
 #include <das/Core/ForeignInterfaceHost/TaskComponentFactoryManager.h>
 #include <das/Core/IPC/HostLauncher.h>
@@ -138,6 +139,7 @@ public:
     /**
      * @brief 设置 Host 可执行文件路径
      * @param path DasHost 可执行文件路径
+     * @note 路径存在时在后台预热 DasHost（见 HostLauncherPool）
      */
     void SetHostExePath(const std::string& path);
 
@@ -372,6 +374,9 @@ protected:
     // IPC 相关成员
     Das::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext> ipc_context_;
     std::string                                                 host_exe_path_;
+    // 预热 Host 池，由 remote_plugin_host_factory_ 创建的 IpcRemotePluginHost
+    // 共享；Shutdown 时关闭空闲 Host
+    std::shared_ptr<HostLauncherPool> host_pool_;
 
     // 外部注册的 runtime provider（进程内注入扩展点）。LoadPlugin 选 provider
     // 时先查此表（language/load_mode 匹配），命中优先于内置
@@ -2,6 +2,7 @@
 #define DAS_CORE_FOREIGNINTERFACEHOST_REMOTEPLUGINHOST_H
 
 #include <das/Core/ForeignInterfaceHost/Config.h>
+#include <das/Core/ForeignInterfaceHost/HostLauncherPool.h>
 #include <das/Core/ForeignInterfaceHost/RuntimeProvider.h>
 #include <das/Core/IPC/MainProcess/IHostLauncher.h>
 #include <das/Core/IPC/MainProcess/IIpcContext.h>
@@ -10,6 +11,7 @@
 #include <chrono>
 #include <filesystem>
 #include <functional>
+#include <memory>
 #include <optional>
 
 DAS_CORE_FOREIGNINTERFACEHOST_NS_BEGIN
@@ -39,15 +41,20 @@ public:
 class IpcRemotePluginHost final : public IRemotePluginHost
 {
 public:
+    /**
+     * @param host_pool 可选的预热 Host 池，命中时跳过启动与握手
+     */
     explicit IpcRemotePluginHost(
         DAS::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext>
-            ipc_context);
+                                          ipc_context,
+        std::shared_ptr<HostLauncherPool> host_pool = nullptr);
 
     auto LoadPlugin(const RemotePluginLoadRequest& request)
         -> DAS::Utils::Expected<RuntimeLoadResult> override;
 
 private:
     DAS::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext> ipc_context_;
+    std::shared_ptr<HostLauncherPool>                           host_pool_;
 };
 
 DAS_CORE_FOREIGNINTERFACEHOST_NS_END
@@ -0,0 +1,221 @@
+#include <das/Core/ForeignInterfaceHost/DasStringAtom.h>
+#include <limits>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+DAS_CORE_FOREIGNINTERFACEHOST_NS_BEGIN
+
+namespace
+{
+    struct StringViewHash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view value) const noexcept
+        {
+            return std::hash<std::string_view>{}(value);
+        }
+    };
+
+    /**
+     * @brief 进程级驻留表
+     *
+     * 键指向字符串对象自身的缓冲区；表对每个字符串持有一个引用且从不释放，
+     * 因此键和 DasStringAtom 中的指针在进程生命周期内始终有效。
+     */
+    class StringAtomTable
+    {
+        mutable std::shared_mutex mutex_;
+        std::unordered_map<
+            std::string_view,
+            DasUtf8StringImpl*,
+            StringViewHash,
+            std::equal_to<>>
+                 atoms_;
+        uint32_t next_id_{1};
+
+    public:
+        static StringAtomTable& GetInstance()
+        {
+            // 故意泄漏，避免静态析构顺序导致其他静态对象持有悬空原子
+            static auto* const p_instance = new StringAtomTable{};
+            return *p_instance;
+        }
+
+        const DasUtf8StringImpl* Find(std::string_view utf8) const noexcept
+        {
+            std::shared_lock lock{mutex_};
+            const auto       it = atoms_.find(utf8);
+            return it == atoms_.end() ? nullptr : it->second;
+        }
+
+        const DasUtf8StringImpl* Intern(std::string_view utf8)
+        {
+            if (const auto* const p_existing = Find(utf8))
+            {
+                return p_existing;
+            }
+
+            std::unique_lock lock{mutex_};
+            // 等待写锁期间可能已被其他线程插入
+            if (const auto it = atoms_.find(utf8); it != atoms_.end())
+            {
+                return it->second;
+            }
+
+            auto p_string =
+                std::make_unique<DasUtf8StringImpl>(utf8, next_id_);
+            atoms_.emplace(p_string->View(), p_string.get());
+            ++next_id_;
+            // 驻留表持有的引用，从不释放
+            p_string->AddRef();
+            return p_string.release();
+        }
+
+        std::size_t Size() const noexcept
+        {
+            std::shared_lock lock{mutex_};
+            return atoms_.size();
+        }
+    };
+
+    /// p_string 是驻留字符串时返回其本身，否则返回 nullptr
+    auto GetInternedString(IDasReadOnlyString* p_string) noexcept
+        -> const DasUtf8StringImpl*
+    {
+        DasUtf8StringImpl* p_utf8_string = nullptr;
+        if (DAS::IsFailed(p_string->QueryInterface(
+                DasIidOf<DasUtf8StringImpl>(),
+                reinterpret_cast<void**>(&p_utf8_string))))
+        {
+            return nullptr;
+        }
+        const bool interned = p_utf8_string->GetAtomId() != 0;
+        // 驻留字符串常驻到进程退出，释放查询得到的引用后指针仍然有效
+        p_utf8_string->Release();
+        return interned ? p_utf8_string : nullptr;
+    }
+} // namespace
+
+DasStringAtom::DasStringAtom(std::string_view utf8)
+{
+    if (!utf8.empty())
+    {
+        p_string_ = StringAtomTable::GetInstance().Intern(utf8);
+    }
+}
+
+IDasReadOnlyString* DasStringAtom::GetString() const noexcept
+{
+    if (p_string_ == nullptr)
+    {
+        IDasReadOnlyString* p_null_string = nullptr;
+        CreateNullDasString(&p_null_string);
+        return p_null_string;
+    }
+    // 驻留字符串不可变，去掉 const 只是为了满足 COM 风格的接口签名
+    return const_cast<DasUtf8StringImpl*>(p_string_);
+}
+
+auto FindStringAtom(std::string_view utf8) noexcept
+    -> std::optional<DasStringAtom>
+{
+    if (utf8.empty())
+    {
+        return DasStringAtom{};
+    }
+    if (const auto* const p_string = StringAtomTable::GetInstance().Find(utf8))
+    {
+        return DasStringAtom{p_string};
+    }
+    return std::nullopt;
+}
+
+auto ToStringAtom(IDasReadOnlyString* p_string)
+    -> DAS::Utils::Expected<DasStringAtom>
+{
+    if (p_string == nullptr)
+    {
+        return tl::make_unexpected(DAS_E_INVALID_POINTER);
+    }
+
+    if (const auto* const p_interned = GetInternedString(p_string))
+    {
+        return DasStringAtom{p_interned};
+    }
+
+    const char* p_utf8 = nullptr;
+    if (const auto get_result = p_string->GetUtf8(&p_utf8);
+        DAS::IsFailed(get_result))
+    {
+        return tl::make_unexpected(get_result);
+    }
+
+    try
+    {
+        return DasStringAtom{std::string_view{p_utf8}};
+    }
+    catch (const std::bad_alloc&)
+    {
+        return tl::make_unexpected(DAS_E_OUT_OF_MEMORY);
+    }
+}
+
+auto FindStringAtom(IDasReadOnlyString* p_string)
+    -> DAS::Utils::Expected<std::optional<DasStringAtom>>
+{
+    if (p_string == nullptr)
+    {
+        return tl::make_unexpected(DAS_E_INVALID_POINTER);
+    }
+
+    if (const auto* const p_interned = GetInternedString(p_string))
+    {
+        return DasStringAtom{p_interned};
+    }
+
+    const char* p_utf8 = nullptr;
+    if (const auto get_result = p_string->GetUtf8(&p_utf8);
+        DAS::IsFailed(get_result))
+    {
+        return tl::make_unexpected(get_result);
+    }
+    return FindStringAtom(std::string_view{p_utf8});
+}
+
+std::size_t GetStringAtomCount() noexcept
+{
+    return StringAtomTable::GetInstance().Size();
+}
+
+DAS_CORE_FOREIGNINTERFACEHOST_NS_END
+
+DasResult CreateInternedIDasReadOnlyString(
+    const char*          p_utf8_string,
+    size_t               length,
+    IDasReadOnlyString** pp_out_readonly_string)
+{
+    if (p_utf8_string == nullptr || pp_out_readonly_string == nullptr)
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+    if (length > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+    {
+        return DAS_E_OUT_OF_RANGE;
+    }
+
+    try
+    {
+        const DAS::Core::ForeignInterfaceHost::DasStringAtom atom{
+            std::string_view{p_utf8_string, length}};
+        auto* const p_string = atom.GetString();
+        p_string->AddRef();
+        *pp_out_readonly_string = p_string;
+        return DAS_S_OK;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return DAS_E_OUT_OF_MEMORY;
+    }
+}
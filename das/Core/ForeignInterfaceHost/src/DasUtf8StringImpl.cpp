@@ -0,0 +1,233 @@
+#include <cstring>
+#include <das/Core/ForeignInterfaceHost/DasUtf8StringImpl.h>
+#include <das/Core/Logger/Logger.h>
+#include <system_error>
+#include <unicode/ustring.h>
+#include <unicode/utf8.h>
+
+DAS_CORE_FOREIGNINTERFACEHOST_NS_BEGIN
+
+DasUtf8StringImpl::DasUtf8StringImpl(std::string_view utf8, uint32_t atom_id)
+    : size_{utf8.size()}, atom_id_{atom_id}, p_data_{inline_buffer_}
+{
+    char* p_buffer = inline_buffer_;
+    if (size_ > INLINE_CAPACITY)
+    {
+        heap_buffer_ = std::make_unique<char[]>(size_ + 1);
+        p_buffer = heap_buffer_.get();
+        p_data_ = p_buffer;
+    }
+    if (size_ != 0)
+    {
+        std::memcpy(p_buffer, utf8.data(), size_);
+    }
+    p_buffer[size_] = '\0';
+}
+
+DasUtf8StringImpl::~DasUtf8StringImpl() = default;
+
+void DasUtf8StringImpl::UpdateUtf16Cache()
+{
+    std::call_once(
+        utf16_once_,
+        [this]
+        {
+            // 非法序列替换为 U+FFFD，与 UnicodeString::fromUTF8 一致
+            const auto length = static_cast<int32_t>(size_);
+            int32_t    utf16_length = 0;
+            UErrorCode error_code = U_ZERO_ERROR;
+            u_strFromUTF8WithSub(
+                nullptr,
+                0,
+                &utf16_length,
+                p_data_,
+                length,
+                0xFFFD,
+                nullptr,
+                &error_code);
+            if (error_code != U_BUFFER_OVERFLOW_ERROR && U_FAILURE(error_code))
+            {
+                DAS_CORE_LOG_ERROR(
+                    "u_strFromUTF8WithSub failed. Error code: {}",
+                    static_cast<int>(error_code));
+                return;
+            }
+
+            utf16_cache_.resize(static_cast<std::size_t>(utf16_length));
+            error_code = U_ZERO_ERROR;
+            u_strFromUTF8WithSub(
+                reinterpret_cast<UChar*>(utf16_cache_.data()),
+                utf16_length + 1,
+                nullptr,
+                p_data_,
+                length,
+                0xFFFD,
+                nullptr,
+                &error_code);
+            if (U_FAILURE(error_code))
+            {
+                DAS_CORE_LOG_ERROR(
+                    "u_strFromUTF8WithSub failed. Error code: {}",
+                    static_cast<int>(error_code));
+                utf16_cache_.clear();
+            }
+        });
+}
+
+void DasUtf8StringImpl::UpdateUtf32Cache()
+{
+    std::call_once(
+        utf32_once_,
+        [this]
+        {
+            const auto* p_bytes = reinterpret_cast<const uint8_t*>(p_data_);
+            const auto  length = static_cast<int32_t>(size_);
+            utf32_cache_.reserve(size_ + 1);
+            int32_t offset = 0;
+            while (offset < length)
+            {
+                UChar32 code_point = 0;
+                U8_NEXT(p_bytes, offset, length, code_point);
+                utf32_cache_.push_back(code_point < 0 ? 0xFFFD : code_point);
+            }
+            utf32_cache_.push_back(0);
+        });
+}
+
+uint32_t DasUtf8StringImpl::AddRef() { return ref_counter_.AddRef(); }
+
+uint32_t DasUtf8StringImpl::Release() { return ref_counter_.Release(this); }
+
+DasResult DasUtf8StringImpl::QueryInterface(
+    const DasGuid& iid,
+    void**         pp_object)
+{
+    if (pp_object == nullptr)
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+
+    if (iid == DAS_IID_READ_ONLY_STRING)
+    {
+        *pp_object = static_cast<IDasReadOnlyString*>(this);
+        this->AddRef();
+        return DAS_S_OK;
+    }
+
+    if (iid == DAS_IID_BASE)
+    {
+        *pp_object = static_cast<IDasBase*>(this);
+        this->AddRef();
+        return DAS_S_OK;
+    }
+
+    // 供 Equals 与 ToStringAtom 直接取得 UTF-8 内容和原子 ID
+    if (iid == DasIidOf<DasUtf8StringImpl>())
+    {
+        *pp_object = this;
+        this->AddRef();
+        return DAS_S_OK;
+    }
+
+    *pp_object = nullptr;
+    return DAS_E_NO_INTERFACE;
+}
+
+DasResult DasUtf8StringImpl::GetUtf8(const char** out_string)
+{
+    if (out_string == nullptr)
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+    *out_string = p_data_;
+    return DAS_S_OK;
+}
+
+DasResult DasUtf8StringImpl::GetUtf16(
+    const char16_t** out_string,
+    size_t*          out_string_size) noexcept
+{
+    if (out_string == nullptr || out_string_size == nullptr)
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+
+    try
+    {
+        UpdateUtf16Cache();
+    }
+    catch (const std::bad_alloc&)
+    {
+        return DAS_E_OUT_OF_MEMORY;
+    }
+    catch (const std::system_error&)
+    {
+        return DAS_E_INTERNAL_FATAL_ERROR;
+    }
+
+    *out_string = utf16_cache_.c_str();
+    *out_string_size = utf16_cache_.size();
+    return DAS_S_OK;
+}
+
+DasBool DasUtf8StringImpl::Equals(IDasReadOnlyString* other) noexcept
+{
+    if (other == nullptr)
+    {
+        return false;
+    }
+    if (other == this)
+    {
+        return true;
+    }
+
+    // 同类实现直接比较 UTF-8 字节；双方都已驻留时原子不同即内容不同
+    DasUtf8StringImpl* utf8_other = nullptr;
+    if (other->QueryInterface(
+            DasIidOf<DasUtf8StringImpl>(),
+            reinterpret_cast<void**>(&utf8_other))
+        == DAS_S_OK)
+    {
+        const bool equals = (atom_id_ != 0 && utf8_other->atom_id_ != 0)
+                                ? atom_id_ == utf8_other->atom_id_
+                                : View() == utf8_other->View();
+        utf8_other->Release();
+        return equals;
+    }
+
+    const char16_t* lhs_utf16 = nullptr;
+    const char16_t* rhs_utf16 = nullptr;
+    size_t          lhs_size = 0;
+    size_t          rhs_size = 0;
+    if (GetUtf16(&lhs_utf16, &lhs_size) != DAS_S_OK
+        || other->GetUtf16(&rhs_utf16, &rhs_size) != DAS_S_OK)
+    {
+        return false;
+    }
+    if (lhs_size != rhs_size)
+    {
+        return false;
+    }
+    return u_strCompare(
+               lhs_utf16,
+               static_cast<int32_t>(lhs_size),
+               rhs_utf16,
+               static_cast<int32_t>(rhs_size),
+               false)
+           == 0;
+}
+
+const int32_t* DasUtf8StringImpl::CBegin()
+{
+    UpdateUtf32Cache();
+    return utf32_cache_.data();
+}
+
+const int32_t* DasUtf8StringImpl::CEnd()
+{
+    UpdateUtf32Cache();
+    // 不含结尾的 0
+    return utf32_cache_.data() + utf32_cache_.size() - 1;
+}
+
+DAS_CORE_FOREIGNINTERFACEHOST_NS_END
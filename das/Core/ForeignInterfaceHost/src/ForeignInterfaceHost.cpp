@@ -1102,6 +1102,30 @@ void ParsePluginPackageDescFromJson(
         obj[std::string_view("guid")]);
     output.guid = MakeDasGuid(guid_str);
 
+    if (obj.contains(std::string_view("dependencies")))
+    {
+        auto dependencies_val = obj[std::string_view("dependencies")];
+        if (!dependencies_val.is_null())
+        {
+            auto dependencies_arr = dependencies_val.as_array();
+            if (!dependencies_arr)
+            {
+                throw std::runtime_error("dependencies: expected array");
+            }
+            for (const auto& dependency : *dependencies_arr)
+            {
+                auto dependency_str = dependency.as_string();
+                if (!dependency_str)
+                {
+                    throw std::runtime_error(
+                        "dependencies: expected plugin GUID string");
+                }
+                output.dependencies.push_back(
+                    MakeDasGuid(std::string(*dependency_str)));
+            }
+        }
+    }
+
     // Parse "settings" field: support both legacy array and new
     // plugin-GUID-keyed object format.
     if (obj.contains(std::string_view("settings")))
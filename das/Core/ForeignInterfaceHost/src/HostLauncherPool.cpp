@@ -0,0 +1,352 @@
+#include <das/Core/ForeignInterfaceHost/HostLauncherPool.h>
+
+#include <das/Core/Logger/Logger.h>
+
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+DAS_CORE_FOREIGNINTERFACEHOST_NS_BEGIN
+
+namespace
+{
+    void AppendKeyPart(std::string& key, IDasReadOnlyString* p_string)
+    {
+        const char* u8_string = nullptr;
+        if (p_string != nullptr && DAS::IsOk(p_string->GetUtf8(&u8_string))
+            && u8_string != nullptr)
+        {
+            key += u8_string;
+        }
+        key.push_back('\0');
+    }
+
+    uint32_t ToTimeoutMs(std::chrono::milliseconds timeout)
+    {
+        if (timeout.count() <= 0)
+        {
+            return 0;
+        }
+        if (timeout.count() > std::numeric_limits<uint32_t>::max())
+        {
+            return std::numeric_limits<uint32_t>::max();
+        }
+        return static_cast<uint32_t>(timeout.count());
+    }
+} // namespace
+
+HostLauncherPoolOptions HostLauncherPoolOptions::FromEnvironment()
+{
+    HostLauncherPoolOptions result{};
+    if (const char* env = std::getenv("DAS_HOST_POOL_SIZE"); env != nullptr)
+    {
+        char*      end = nullptr;
+        const auto value = std::strtoul(env, &end, 10);
+        if (end != env)
+        {
+            result.idle_per_kind = value;
+        }
+    }
+    return result;
+}
+
+HostLauncherPool::HostLauncherPool(
+    DAS::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext> ipc_context,
+    HostLauncherPoolOptions                                     options)
+    : ipc_context_{std::move(ipc_context)}, options_{options}
+{
+}
+
+HostLauncherPool::~HostLauncherPool() { Shutdown(); }
+
+std::string HostLauncherPool::MakeKey(
+    const DAS::Core::IPC::HostLaunchDesc& desc)
+{
+    std::string key;
+    AppendKeyPart(key, desc.p_executable_path);
+    for (size_t i = 0; i < desc.arg_count; ++i)
+    {
+        AppendKeyPart(key, desc.pp_args[i]);
+    }
+    // 参数个数参与区分，避免参数拼接后恰好相同
+    key += std::to_string(desc.arg_count);
+    key.push_back('\0');
+    AppendKeyPart(key, desc.p_working_directory);
+    AppendKeyPart(key, desc.p_environment_config);
+    return key;
+}
+
+auto HostLauncherPool::RegisterKindLocked(
+    const std::string&                    key,
+    const DAS::Core::IPC::HostLaunchDesc& desc) -> Kind&
+{
+    auto& kind = kinds_[key];
+    if (kind)
+    {
+        return *kind;
+    }
+
+    // IDasReadOnlyString 不可变，持有引用即可在请求返回后继续使用
+    kind = std::make_unique<Kind>();
+    kind->executable = DAS::DasPtr<IDasReadOnlyString>(desc.p_executable_path);
+    kind->args.reserve(desc.arg_count);
+    kind->arg_ptrs.reserve(desc.arg_count);
+    for (size_t i = 0; i < desc.arg_count; ++i)
+    {
+        kind->args.emplace_back(desc.pp_args[i]);
+        kind->arg_ptrs.push_back(desc.pp_args[i]);
+    }
+    kind->working_directory =
+        DAS::DasPtr<IDasReadOnlyString>(desc.p_working_directory);
+    kind->environment_config =
+        DAS::DasPtr<IDasReadOnlyString>(desc.p_environment_config);
+
+    kind->desc.p_executable_path = kind->executable.Get();
+    kind->desc.pp_args =
+        kind->arg_ptrs.empty() ? nullptr : kind->arg_ptrs.data();
+    kind->desc.arg_count = kind->arg_ptrs.size();
+    kind->desc.p_working_directory = kind->working_directory.Get();
+    kind->desc.p_environment_config = kind->environment_config.Get();
+    return *kind;
+}
+
+void HostLauncherPool::RequestReplenishLocked(const std::string& key)
+{
+    if (stopping_)
+    {
+        return;
+    }
+    replenish_queue_.push_back(key);
+    if (!worker_.joinable())
+    {
+        worker_ = std::thread(&HostLauncherPool::WorkerLoop, this);
+    }
+    cv_.notify_one();
+}
+
+bool HostLauncherPool::TryClaim(
+    const DAS::Core::IPC::HostLaunchDesc&        desc,
+    DAS::DasPtr<DAS::Core::IPC::IHostLauncher>& out_launcher,
+    uint16_t&                                    out_session_id)
+{
+    if (!IsEnabled() || desc.p_executable_path == nullptr)
+    {
+        return false;
+    }
+
+    const auto           key = MakeKey(desc);
+    std::vector<IdleHost> dead_hosts;
+    bool                  claimed = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_)
+        {
+            return false;
+        }
+
+        auto& kind = RegisterKindLocked(key, desc);
+        kind.start_failed = false;
+        while (!kind.idle.empty())
+        {
+            auto host = std::move(kind.idle.front());
+            kind.idle.pop_front();
+            if (host.launcher && host.launcher->IsRunning())
+            {
+                out_launcher = std::move(host.launcher);
+                out_session_id = host.session_id;
+                claimed = true;
+                break;
+            }
+            dead_hosts.push_back(std::move(host));
+        }
+        RequestReplenishLocked(key);
+    }
+
+    for (auto& host : dead_hosts)
+    {
+        DAS_CORE_LOG_WARN(
+            "HostLauncherPool: dropping idle host session_id={} that exited",
+            host.session_id);
+        DiscardHost(host);
+    }
+    return claimed;
+}
+
+void HostLauncherPool::Prewarm(const DAS::Core::IPC::HostLaunchDesc& desc)
+{
+    if (!IsEnabled() || desc.p_executable_path == nullptr)
+    {
+        return;
+    }
+
+    const auto                  key = MakeKey(desc);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto&                       kind = RegisterKindLocked(key, desc);
+    kind.start_failed = false;
+    RequestReplenishLocked(key);
+}
+
+size_t HostLauncherPool::GetIdleCount(
+    const DAS::Core::IPC::HostLaunchDesc& desc) const
+{
+    const auto                  key = MakeKey(desc);
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto                  it = kinds_.find(key);
+    return it == kinds_.end() ? 0 : it->second->idle.size();
+}
+
+void HostLauncherPool::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        cv_.wait(
+            lock,
+            [this] { return stopping_ || !replenish_queue_.empty(); });
+        if (stopping_)
+        {
+            return;
+        }
+        auto key = std::move(replenish_queue_.front());
+        replenish_queue_.pop_front();
+
+        lock.unlock();
+        ReplenishKind(key);
+        lock.lock();
+    }
+}
+
+void HostLauncherPool::ReplenishKind(const std::string& key)
+{
+    while (true)
+    {
+        DAS::Core::IPC::HostLaunchDesc desc{};
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const auto                  it = kinds_.find(key);
+            if (stopping_ || it == kinds_.end())
+            {
+                return;
+            }
+            auto& kind = *it->second;
+            if (kind.start_failed
+                || kind.idle.size() + kind.starting >= options_.idle_per_kind)
+            {
+                return;
+            }
+            ++kind.starting;
+            // Kind 由 unique_ptr 持有且只在 Shutdown 后释放，desc 中的指针
+            // 在锁外保持有效
+            desc = kind.desc;
+        }
+
+        IdleHost                       host;
+        DAS::Core::IPC::IHostLauncher* raw_launcher = nullptr;
+        auto result = ipc_context_.get().CreateHostLauncher(&raw_launcher);
+        if (DAS::IsOk(result) && raw_launcher != nullptr)
+        {
+            host.launcher =
+                DAS::DasPtr<DAS::Core::IPC::IHostLauncher>(raw_launcher);
+            result = host.launcher->StartWithDesc(
+                &desc,
+                ToTimeoutMs(options_.start_timeout),
+                &host.session_id);
+        }
+        else if (DAS::IsOk(result))
+        {
+            result = DAS_E_INVALID_POINTER;
+        }
+
+        if (DAS::IsFailed(result))
+        {
+            DAS_CORE_LOG_WARN(
+                "HostLauncherPool: failed to start idle host, result={}",
+                result);
+        }
+
+        bool discard = DAS::IsFailed(result);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto&                       kind = *kinds_.at(key);
+            --kind.starting;
+            if (DAS::IsFailed(result))
+            {
+                kind.start_failed = true;
+            }
+            else if (stopping_)
+            {
+                discard = true;
+            }
+            else
+            {
+                DAS_CORE_LOG_INFO(
+                    "HostLauncherPool: idle host ready, session_id={}",
+                    host.session_id);
+                kind.idle.push_back(std::move(host));
+            }
+        }
+
+        if (discard)
+        {
+            if (host.launcher)
+            {
+                DiscardHost(host);
+            }
+            return;
+        }
+    }
+}
+
+void HostLauncherPool::DiscardHost(IdleHost& host)
+{
+    if (!host.launcher)
+    {
+        return;
+    }
+    if (host.session_id == 0)
+    {
+        host.launcher->Stop();
+    }
+    else
+    {
+        const auto result =
+            ipc_context_.get().UnregisterHostLauncherBySession(host.session_id);
+        if (result == DAS_E_NO_IMPLEMENTATION)
+        {
+            host.launcher->Stop();
+        }
+    }
+    host.launcher = nullptr;
+}
+
+void HostLauncherPool::Shutdown()
+{
+    std::vector<IdleHost> idle_hosts;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        replenish_queue_.clear();
+        for (auto& [key, kind] : kinds_)
+        {
+            for (auto& host : kind->idle)
+            {
+                idle_hosts.push_back(std::move(host));
+            }
+            kind->idle.clear();
+        }
+    }
+    cv_.notify_all();
+
+    // 后台线程可能正在启动 Host，join 后它会自行丢弃启动结果
+    if (worker_.joinable() && worker_.get_id() != std::this_thread::get_id())
+    {
+        worker_.join();
+    }
+
+    for (auto& host : idle_hosts)
+    {
+        DiscardHost(host);
+    }
+}
+
+DAS_CORE_FOREIGNINTERFACEHOST_NS_END
@@ -39,8 +39,9 @@ namespace
 } // namespace
 
 IpcRemotePluginHost::IpcRemotePluginHost(
-    DAS::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext> ipc_context)
-    : ipc_context_{std::move(ipc_context)}
+    DAS::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext> ipc_context,
+    std::shared_ptr<HostLauncherPool>                           host_pool)
+    : ipc_context_{std::move(ipc_context)}, host_pool_{std::move(host_pool)}
 {
 }
 
@@ -113,35 +114,50 @@ auto IpcRemotePluginHost::LoadPlugin(const RemotePluginLoadRequest& request)
         return load_result;
     }
 
-    // Original path: create child process via HostLauncher
-    DAS::Core::IPC::IHostLauncher* raw_launcher = nullptr;
-    auto result = ipc_context_.get().CreateHostLauncher(&raw_launcher);
-    if (DAS::IsFailed(result) || !raw_launcher)
+    // Original path: create child process via HostLauncher, or claim an
+    // already started and handshaken one from the pool
+    DAS::DasPtr<DAS::Core::IPC::IHostLauncher> launcher;
+    uint16_t                                   owner_session_id = 0;
+    if (host_pool_
+        && host_pool_->TryClaim(
+            request.launch_desc,
+            launcher,
+            owner_session_id))
     {
-        if (DAS::IsOk(result))
+        DAS_CORE_LOG_INFO(
+            "IpcRemotePluginHost: using pre-started host, session_id={}",
+            owner_session_id);
+    }
+    else
+    {
+        DAS::Core::IPC::IHostLauncher* raw_launcher = nullptr;
+        auto result = ipc_context_.get().CreateHostLauncher(&raw_launcher);
+        if (DAS::IsFailed(result) || !raw_launcher)
         {
-            result = DAS_E_INVALID_POINTER;
+            if (DAS::IsOk(result))
+            {
+                result = DAS_E_INVALID_POINTER;
+            }
+            DAS_CORE_LOG_ERROR(
+                "IpcRemotePluginHost: CreateHostLauncher failed, result={}",
+                result);
+            return tl::make_unexpected(result);
         }
-        DAS_CORE_LOG_ERROR(
-            "IpcRemotePluginHost: CreateHostLauncher failed, result={}",
-            result);
-        return tl::make_unexpected(result);
-    }
 
-    DAS::DasPtr<DAS::Core::IPC::IHostLauncher> launcher(raw_launcher);
+        launcher = DAS::DasPtr<DAS::Core::IPC::IHostLauncher>(raw_launcher);
 
-    uint16_t owner_session_id = 0;
-    result = launcher->StartWithDesc(
-        &request.launch_desc,
-        *timeout_ms,
-        &owner_session_id);
-    if (DAS::IsFailed(result))
-    {
-        DAS_CORE_LOG_ERROR(
-            "IpcRemotePluginHost: StartWithDesc failed, result={}",
-            result);
-        launcher->Stop();
-        return tl::make_unexpected(result);
+        result = launcher->StartWithDesc(
+            &request.launch_desc,
+            *timeout_ms,
+            &owner_session_id);
+        if (DAS::IsFailed(result))
+        {
+            DAS_CORE_LOG_ERROR(
+                "IpcRemotePluginHost: StartWithDesc failed, result={}",
+                result);
+            launcher->Stop();
+            return tl::make_unexpected(result);
+        }
     }
 
     if (auto* concrete_launcher =
@@ -162,7 +178,7 @@ auto IpcRemotePluginHost::LoadPlugin(const RemotePluginLoadRequest& request)
     DAS::DasPtr<IDasAsyncLoadPluginOperation> op;
     auto        u8manifest = request.manifest_path.u8string();
     std::string manifest_path{DAS::Utils::U8AsString(u8manifest)};
-    result = ipc_context_.get().LoadPluginAsync(
+    auto        result = ipc_context_.get().LoadPluginAsync(
         launcher.Get(),
         manifest_path.c_str(),
         op.Put(),
@@ -5,6 +5,7 @@
 #include <das/Utils/StringUtils.h>
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <tl/expected.hpp>
 #include <utility>
@@ -37,6 +38,51 @@ namespace
         }
         return result;
     }
+
+    /// DasHost 启动参数及其字符串存储
+    struct NativeHostLaunch
+    {
+        std::vector<DAS::DasPtr<IDasReadOnlyString>> storage;
+        std::vector<IDasReadOnlyString*>             args;
+        DAS::Core::IPC::HostLaunchDesc               desc{};
+    };
+
+    auto BuildNativeHostLaunch(const std::filesystem::path& host_exe_path)
+        -> DAS::Utils::Expected<std::unique_ptr<NativeHostLaunch>>
+    {
+        auto executable = MakeReadOnlyString(
+            std::string{DAS::Utils::U8AsString(host_exe_path.u8string())});
+        if (!executable)
+        {
+            return tl::make_unexpected(executable.error());
+        }
+
+        const auto main_pid = static_cast<uint32_t>(DAS_CURRENT_PROCESS_ID());
+        auto       arg_name = MakeReadOnlyString("--main-pid");
+        if (!arg_name)
+        {
+            return tl::make_unexpected(arg_name.error());
+        }
+        auto arg_value = MakeReadOnlyString(std::to_string(main_pid));
+        if (!arg_value)
+        {
+            return tl::make_unexpected(arg_value.error());
+        }
+
+        auto result = std::make_unique<NativeHostLaunch>();
+        result->storage.push_back(std::move(executable.value()));
+        result->storage.push_back(std::move(arg_name.value()));
+        result->storage.push_back(std::move(arg_value.value()));
+        for (size_t i = 1; i < result->storage.size(); ++i)
+        {
+            result->args.push_back(result->storage[i].Get());
+        }
+
+        result->desc.p_executable_path = result->storage[0].Get();
+        result->desc.pp_args = result->args.data();
+        result->desc.arg_count = result->args.size();
+        return result;
+    }
 } // namespace
 
 NativeIpcRuntime::NativeIpcRuntime(
@@ -50,6 +96,24 @@ NativeIpcRuntime::NativeIpcRuntime(
 {
 }
 
+DasResult NativeIpcRuntime::PrewarmHost(
+    const std::filesystem::path& host_exe_path,
+    HostLauncherPool&            pool)
+{
+    if (host_exe_path.empty())
+    {
+        return DAS_E_INVALID_ARGUMENT;
+    }
+
+    auto launch = BuildNativeHostLaunch(host_exe_path);
+    if (!launch)
+    {
+        return launch.error();
+    }
+    pool.Prewarm(launch.value()->desc);
+    return DAS_S_OK;
+}
+
 DasResult NativeIpcRuntime::LoadPlugin(
     const RuntimeLoadRequest& request,
     RuntimeLoadResult*        out_result)
@@ -67,40 +131,14 @@ DasResult NativeIpcRuntime::LoadPlugin(
         return DAS_E_OBJECT_NOT_INIT;
     }
 
-    auto executable = MakeReadOnlyString(
-        std::string{DAS::Utils::U8AsString(host_exe_path_.u8string())});
-    if (!executable)
-    {
-        return executable.error();
-    }
-
-    const auto main_pid = static_cast<uint32_t>(DAS_CURRENT_PROCESS_ID());
-    auto       arg_name = MakeReadOnlyString("--main-pid");
-    if (!arg_name)
-    {
-        return arg_name.error();
-    }
-    auto arg_value = MakeReadOnlyString(std::to_string(main_pid));
-    if (!arg_value)
-    {
-        return arg_value.error();
-    }
-
-    std::vector<DAS::DasPtr<IDasReadOnlyString>> arg_storage;
-    arg_storage.push_back(std::move(arg_name.value()));
-    arg_storage.push_back(std::move(arg_value.value()));
-
-    std::vector<IDasReadOnlyString*> args;
-    args.reserve(arg_storage.size());
-    for (const auto& arg : arg_storage)
+    auto launch = BuildNativeHostLaunch(host_exe_path_);
+    if (!launch)
     {
-        args.push_back(arg.Get());
+        return launch.error();
     }
 
     RemotePluginLoadRequest remote_request{};
-    remote_request.launch_desc.p_executable_path = executable->Get();
-    remote_request.launch_desc.pp_args = args.data();
-    remote_request.launch_desc.arg_count = args.size();
+    remote_request.launch_desc = launch.value()->desc;
     remote_request.manifest_path = std::filesystem::path(
         reinterpret_cast<const char8_t*>(request.manifest_path));
     remote_request.plugin_guid = request.plugin_guid;
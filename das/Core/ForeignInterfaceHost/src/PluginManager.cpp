@@ -2,6 +2,7 @@
 
 #include <cpp_yyjson.hpp>
 #include <das/Core/Debug/DebugDecorators.h>
+#include <das/Core/ForeignInterfaceHost/NativeIpcRuntime.h>
 #include <das/Core/ForeignInterfaceHost/PluginScanner.h>
 #include <das/Core/ForeignInterfaceHost/RemotePluginHost.h>
 #include <das/Core/IPC/HostLauncher.h>
@@ -115,10 +116,15 @@ namespace
 PluginManager::PluginManager(
     Das::Core::SettingsManager::SettingsManager& settings_manager,
     Das::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext> ipc_context)
-    : settings_manager_(settings_manager), ipc_context_{std::move(ipc_context)}
+    : settings_manager_(settings_manager), ipc_context_{std::move(ipc_context)},
+      host_pool_{std::make_shared<HostLauncherPool>(
+          ipc_context_,
+          HostLauncherPoolOptions::FromEnvironment())}
 {
     remote_plugin_host_factory_ = [this]()
-    { return std::make_unique<IpcRemotePluginHost>(ipc_context_); };
+    {
+        return std::make_unique<IpcRemotePluginHost>(ipc_context_, host_pool_);
+    };
 }
 
 PluginManager::~PluginManager()
@@ -198,6 +204,8 @@ DasResult PluginManager::Shutdown()
     // 死字段。ResetHostLifecycleCallbacks 内部调 GuardedCallback::Clear 持
     // callback_mutex_ drain 在途回调（CR-02 drain 屏障），让心跳线程后续 Invoke
     // 空转碰不到悬空 [this]。
+    // 空闲 Host 未关联插件，先于回调清理关闭，之后的加载不再使用池。
+    host_pool_->Shutdown();
     ipc_context_.get().ResetHostLifecycleCallbacks();
 
     DAS_CORE_LOG_INFO("PluginManager shutdown complete");
@@ -212,6 +220,14 @@ void PluginManager::SetRegistry(Core::IPC::RemoteObjectRegistry& registry)
 void PluginManager::SetHostExePath(const std::string& path)
 {
     host_exe_path_ = path;
+
+    std::error_code             ec;
+    const std::filesystem::path host_exe_path{path};
+    if (host_pool_->IsEnabled()
+        && std::filesystem::is_regular_file(host_exe_path, ec))
+    {
+        NativeIpcRuntime::PrewarmHost(host_exe_path, *host_pool_);
+    }
 }
 
 void PluginManager::RegisterRuntimeProvider(
@@ -0,0 +1,139 @@
+#include <das/Core/ForeignInterfaceHost/DasStringAtom.h>
+#include <das/Core/ForeignInterfaceHost/DasStringImpl.h>
+#include <das/DasPtr.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+using Das::Core::ForeignInterfaceHost::DasStringAtom;
+using Das::Core::ForeignInterfaceHost::DasUtf8StringImpl;
+using Das::Core::ForeignInterfaceHost::FindStringAtom;
+using Das::Core::ForeignInterfaceHost::GetStringAtomCount;
+using Das::Core::ForeignInterfaceHost::ToStringAtom;
+
+// ============================================================================
+// DasUtf8StringImpl
+// ============================================================================
+
+TEST(DasStringAtomTest, Utf8StringStoresShortAndLongContent)
+{
+    const std::string short_text(DasUtf8StringImpl::INLINE_CAPACITY, 's');
+    const std::string long_text(DasUtf8StringImpl::INLINE_CAPACITY + 1, 'l');
+
+    DAS::DasPtr<DasUtf8StringImpl> p_short{new DasUtf8StringImpl{short_text}};
+    DAS::DasPtr<DasUtf8StringImpl> p_long{new DasUtf8StringImpl{long_text}};
+
+    const char* utf8 = nullptr;
+    ASSERT_EQ(p_short->GetUtf8(&utf8), DAS_S_OK);
+    EXPECT_EQ(std::string{utf8}, short_text);
+    ASSERT_EQ(p_long->GetUtf8(&utf8), DAS_S_OK);
+    EXPECT_EQ(std::string{utf8}, long_text);
+    EXPECT_EQ(p_long->View().size(), long_text.size());
+}
+
+TEST(DasStringAtomTest, Utf8StringConvertsToUtf16AndUtf32)
+{
+    DAS::DasPtr<DasUtf8StringImpl> p_string{new DasUtf8StringImpl{
+        reinterpret_cast<const char*>(u8"端口a")}};
+
+    const char16_t* utf16 = nullptr;
+    size_t          utf16_size = 0;
+    ASSERT_EQ(p_string->GetUtf16(&utf16, &utf16_size), DAS_S_OK);
+    EXPECT_EQ(std::u16string(utf16, utf16_size), u"端口a");
+    EXPECT_EQ(utf16[utf16_size], u'\0');
+
+    const auto* begin = p_string->CBegin();
+    const auto* end = p_string->CEnd();
+    ASSERT_EQ(end - begin, 3);
+    EXPECT_EQ(begin[0], 0x7AEF);
+    EXPECT_EQ(begin[2], 'a');
+}
+
+TEST(DasStringAtomTest, Utf8StringEqualsOtherImplementation)
+{
+    DAS::DasPtr<DasUtf8StringImpl> p_utf8{new DasUtf8StringImpl{"out"}};
+    DasReadOnlyString              icu_same{"out"};
+    DasReadOnlyString              icu_other{"in"};
+
+    EXPECT_TRUE(p_utf8->Equals(icu_same.Get()));
+    EXPECT_FALSE(p_utf8->Equals(icu_other.Get()));
+
+    DAS::DasPtr<DasUtf8StringImpl> p_copy{new DasUtf8StringImpl{"out"}};
+    EXPECT_TRUE(p_utf8->Equals(p_copy.Get()));
+}
+
+// ============================================================================
+// DasStringAtom
+// ============================================================================
+
+TEST(DasStringAtomTest, SameContentYieldsSameAtom)
+{
+    const DasStringAtom a{"atom_test_same"};
+    const DasStringAtom b{std::string{"atom_test_"} + "same"};
+    const DasStringAtom c{"atom_test_other"};
+
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.GetId(), b.GetId());
+    EXPECT_EQ(a.GetString(), b.GetString());
+    EXPECT_NE(a, c);
+    EXPECT_EQ(a, "atom_test_same");
+    EXPECT_STREQ(a.CStr(), "atom_test_same");
+}
+
+TEST(DasStringAtomTest, EmptyAtomHasIdZero)
+{
+    const DasStringAtom empty{};
+    const DasStringAtom from_literal{""};
+
+    EXPECT_EQ(empty, from_literal);
+    EXPECT_EQ(empty.GetId(), 0u);
+    EXPECT_TRUE(empty.Empty());
+    ASSERT_NE(empty.GetString(), nullptr);
+
+    const char* utf8 = nullptr;
+    ASSERT_EQ(empty.GetString()->GetUtf8(&utf8), DAS_S_OK);
+    EXPECT_STREQ(utf8, "");
+}
+
+TEST(DasStringAtomTest, FindDoesNotIntern)
+{
+    const auto before = GetStringAtomCount();
+    EXPECT_FALSE(FindStringAtom("atom_test_never_interned").has_value());
+    EXPECT_EQ(GetStringAtomCount(), before);
+
+    const DasStringAtom atom{"atom_test_find"};
+    const auto          found = FindStringAtom("atom_test_find");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(*found, atom);
+}
+
+TEST(DasStringAtomTest, ToStringAtomAcceptsAnyImplementation)
+{
+    const DasStringAtom atom{"atom_test_convert"};
+
+    // 驻留字符串直接取原子
+    const auto from_interned = ToStringAtom(atom.GetString());
+    ASSERT_TRUE(from_interned.has_value());
+    EXPECT_EQ(*from_interned, atom);
+
+    DasReadOnlyString icu_string{"atom_test_convert"};
+    const auto        from_icu = ToStringAtom(icu_string.Get());
+    ASSERT_TRUE(from_icu.has_value());
+    EXPECT_EQ(*from_icu, atom);
+
+    EXPECT_FALSE(ToStringAtom(nullptr).has_value());
+}
+
+TEST(DasStringAtomTest, CreateInternedStringReturnsSharedObject)
+{
+    DasResult  result = DAS_E_FAIL;
+    const auto a =
+        DasReadOnlyString::FromUtf8Interned("atom_test_c_api", &result);
+    ASSERT_EQ(result, DAS_S_OK);
+    const auto b = DasReadOnlyString::FromUtf8Interned(
+        std::string{"atom_test_c_api"},
+        &result);
+    ASSERT_EQ(result, DAS_S_OK);
+
+    EXPECT_EQ(a.Get(), b.Get());
+    EXPECT_EQ(a.Get(), DasStringAtom{"atom_test_c_api"}.GetString());
+}
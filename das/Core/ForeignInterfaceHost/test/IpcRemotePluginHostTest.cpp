@@ -1,3 +1,4 @@
+#include <das/Core/ForeignInterfaceHost/HostLauncherPool.h>
 #include <das/Core/ForeignInterfaceHost/NativeIpcRuntime.h>
 #include <das/Core/ForeignInterfaceHost/RemotePluginHost.h>
 
@@ -14,6 +15,7 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -413,6 +415,24 @@ namespace
         return request;
     }
 
+    bool WaitForIdleHosts(
+        const HostLauncherPool&               pool,
+        const DAS::Core::IPC::HostLaunchDesc& desc,
+        size_t                                count)
+    {
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (pool.GetIdleCount(desc) != count)
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        return true;
+    }
+
     class CapturingRemotePluginHost final : public IRemotePluginHost
     {
     public:
@@ -663,3 +683,110 @@ TEST(NativeIpcRuntime, LoadForwardsIpcLifecycleCallbacks)
     EXPECT_TRUE(raw_remote->has_on_process_exit);
     EXPECT_TRUE(raw_remote->has_on_heartbeat_timeout);
 }
+
+TEST(HostLauncherPool, LoadClaimsPrestartedHost)
+{
+    auto launcher = DAS::DasPtr<FakeHostLauncher>(new FakeHostLauncher());
+    auto context = std::make_shared<FakeIpcContext>(launcher);
+    DAS::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext> context_ref(
+        context);
+    auto pool = std::make_shared<HostLauncherPool>(context_ref);
+    IpcRemotePluginHost host{context_ref, pool};
+
+    DAS::DasPtr<IDasReadOnlyString> executable;
+    auto                            request = MakeRequest(executable);
+
+    pool->Prewarm(request.launch_desc);
+    ASSERT_TRUE(WaitForIdleHosts(*pool, request.launch_desc, 1));
+    EXPECT_EQ(launcher->start_with_desc_count, 1);
+
+    // A cold start would fail from here on, so success means the idle host
+    // was claimed.
+    context->create_launcher_result = DAS_E_FAIL;
+    auto result = host.LoadPlugin(request);
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->owner_session_id, launcher->session_to_return);
+    EXPECT_EQ(context->observed_launcher, launcher.Get());
+    EXPECT_EQ(context->load_async_count, 1);
+    if (result->object != nullptr)
+    {
+        result->object->Release();
+    }
+    pool->Shutdown();
+}
+
+TEST(HostLauncherPool, DisabledPoolNeverStartsHosts)
+{
+    auto launcher = DAS::DasPtr<FakeHostLauncher>(new FakeHostLauncher());
+    auto context = std::make_shared<FakeIpcContext>(launcher);
+    DAS::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext> context_ref(
+        context);
+    auto pool = std::make_shared<HostLauncherPool>(
+        context_ref,
+        HostLauncherPoolOptions{.idle_per_kind = 0});
+    IpcRemotePluginHost host{context_ref, pool};
+
+    DAS::DasPtr<IDasReadOnlyString> executable;
+    auto                            request = MakeRequest(executable);
+
+    pool->Prewarm(request.launch_desc);
+    auto result = host.LoadPlugin(request);
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(context->create_launcher_count, 1);
+    EXPECT_EQ(launcher->start_with_desc_count, 1);
+    EXPECT_EQ(pool->GetIdleCount(request.launch_desc), 0u);
+    if (result->object != nullptr)
+    {
+        result->object->Release();
+    }
+}
+
+TEST(HostLauncherPool, ExitedIdleHostIsDropped)
+{
+    auto launcher = DAS::DasPtr<FakeHostLauncher>(new FakeHostLauncher());
+    auto context = std::make_shared<FakeIpcContext>(launcher);
+    HostLauncherPool pool{
+        DAS::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext>(context)};
+
+    DAS::DasPtr<IDasReadOnlyString> executable;
+    auto                            request = MakeRequest(executable);
+
+    pool.Prewarm(request.launch_desc);
+    ASSERT_TRUE(WaitForIdleHosts(pool, request.launch_desc, 1));
+
+    launcher->running = false;
+    context->create_launcher_result = DAS_E_FAIL;
+    DAS::DasPtr<DAS::Core::IPC::IHostLauncher> claimed;
+    uint16_t                                   session_id = 0;
+
+    EXPECT_FALSE(pool.TryClaim(request.launch_desc, claimed, session_id));
+    EXPECT_FALSE(claimed);
+    EXPECT_EQ(launcher->stop_count, 1);
+    pool.Shutdown();
+}
+
+TEST(HostLauncherPool, ShutdownStopsIdleHosts)
+{
+    auto launcher = DAS::DasPtr<FakeHostLauncher>(new FakeHostLauncher());
+    auto context = std::make_shared<FakeIpcContext>(launcher);
+    HostLauncherPool pool{
+        DAS::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext>(context)};
+
+    DAS::DasPtr<IDasReadOnlyString> executable;
+    auto                            request = MakeRequest(executable);
+
+    pool.Prewarm(request.launch_desc);
+    ASSERT_TRUE(WaitForIdleHosts(pool, request.launch_desc, 1));
+
+    pool.Shutdown();
+
+    EXPECT_EQ(launcher->stop_count, 1);
+    EXPECT_EQ(pool.GetIdleCount(request.launch_desc), 0u);
+
+    // Claims after shutdown fall back to a cold start.
+    DAS::DasPtr<DAS::Core::IPC::IHostLauncher> claimed;
+    uint16_t                                   session_id = 0;
+    EXPECT_FALSE(pool.TryClaim(request.launch_desc, claimed, session_id));
+}
@@ -46,6 +46,9 @@ namespace Dto
         yyjson::value                       compiled_payload_json;
         yyjson::value                       compiled_settings;
         std::vector<GraphPortDefinitionDto> resolved_ports;
+        // Copied from the component manifest's definition.threadSafe. Only
+        // such nodes may run concurrently under the parallel scheduler.
+        bool thread_safe = false;
     };
 
     // ---- signal activation route (DAS-60 signal-gated execution) ----
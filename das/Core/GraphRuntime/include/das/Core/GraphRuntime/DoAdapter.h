@@ -1,11 +1,13 @@
 #ifndef DAS_CORE_GRAPHRUNTIME_DOADAPTER_H
 #define DAS_CORE_GRAPHRUNTIME_DOADAPTER_H
 
+#include <span>
 #include <string>
 #include <vector>
 
 #include <das/Core/GraphRuntime/CompiledArtifact.h>
 #include <das/Core/GraphRuntime/Config.h>
+#include <das/Core/GraphRuntime/LoweredGraphPlan.h>
 #include <das/Core/GraphRuntime/PortFrame.h>
 #include <das/_autogen/idl/abi/IDasPortMap.h>
 
@@ -33,6 +35,14 @@ DAS_CORE_GRAPHRUNTIME_NS_BEGIN
 /// @param bindings  Data-flow edges filtered to the target node's inputs.
 /// @param out_map   Receives a newly allocated IDasPortMap (caller owns).
 /// @return DAS_S_OK on success.
+DasResult BuildInputPortMap(
+    const PortFrame&                                frame,
+    std::span<const LoweredGraphPlan::InputBinding> bindings,
+    Das::ExportInterface::IDasPortMap**             out_map);
+
+/// Convenience overload for unlowered bindings: resolves each binding's
+/// source GUID and port atoms on every call. The runtime uses the lowered
+/// overload above.
 DasResult BuildInputPortMap(
     const PortFrame&                        frame,
     const std::vector<Dto::PortBindingDto>& bindings,
@@ -83,10 +83,12 @@ public:
         std::vector<PortEntry> inputs;
         std::vector<PortEntry> outputs;
         bool                   was_resolved = false;
+        bool                   thread_safe = false;
     };
 
     /// Read manifest definition.inputs/outputs for a given component_guid.
     /// Returns {inputs, outputs} port lists. Empty vectors if not found.
+    /// thread_safe mirrors the optional definition.threadSafe flag.
     ManifestPorts ReadManifest(const std::string& component_guid) const;
 
     /// Validate all edges in a GraphDocumentDto against node manifests.
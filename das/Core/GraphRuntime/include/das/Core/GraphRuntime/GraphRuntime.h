@@ -3,6 +3,7 @@
 
 #include <das/Core/GraphRuntime/CompiledArtifact.h>
 #include <das/Core/GraphRuntime/Config.h>
+#include <das/Core/GraphRuntime/LoweredGraphPlan.h>
 #include <das/DasPtr.hpp>
 #include <das/DasTypes.hpp>
 #include <das/_autogen/idl/abi/IDasErrorLens.h>
@@ -10,8 +11,11 @@
 #include <das/_autogen/idl/abi/IDasTask.h>
 #include <das/_autogen/idl/abi/IDasTaskComponent.h>
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 DAS_CORE_GRAPHRUNTIME_NS_BEGIN
 
@@ -30,6 +34,25 @@ struct NodeComponentEntry
     std::string                                          component_guid;
     DAS::DasPtr<Das::PluginInterface::IDasTaskComponent> component;
     bool settings_applied = false;
+    // From CompiledNodeSnapshotDto::thread_safe (manifest threadSafe).
+    bool thread_safe = false;
+};
+
+// ---------------------------------------------------------------------------
+// ParallelExecutionOptions — opt-in concurrent dispatch of ready nodes
+//
+// When enabled, the scheduler collects every node that is ready at the same
+// time (predecessors resolved, gate decided) into a wave and dispatches the
+// whole wave at once. Nodes whose component manifest declares threadSafe run
+// on a shared work-stealing pool; all other nodes run one at a time on the
+// calling thread. Each node writes to its own staging frame, merged into the
+// PortFrame in execution_order after the wave completes.
+// ---------------------------------------------------------------------------
+struct ParallelExecutionOptions
+{
+    bool enabled = false;
+    // Worker threads in the pool; 0 = std::thread::hardware_concurrency().
+    std::size_t max_workers = 0;
 };
 
 // ---------------------------------------------------------------------------
@@ -47,12 +70,14 @@ struct NodeComponentEntry
 //   - Prepare() validates all configured components are ready.
 //   - RunWithHost() is the full Configure → Prepare → Execute pipeline.
 //   - IDasErrorLens integration provides structured error messages.
+//   - SetParallelExecution() opts in to wave-parallel dispatch of independent
+//     nodes; sequential execution stays the default.
 // ---------------------------------------------------------------------------
 class GraphRuntime
 {
 public:
-    GraphRuntime() = default;
-    ~GraphRuntime() = default;
+    GraphRuntime();
+    ~GraphRuntime();
 
     // Get error message from last failed execution.
     const std::string& GetLastErrorMessage() const { return last_error_; }
@@ -79,7 +104,10 @@ public:
     // IDasTaskComponentHost for real component resolution.
     //
     // Internally calls Configure(), Prepare(), then executes nodes
-    // using the pre-configured IDasTaskComponent instances.
+    // using the pre-configured IDasTaskComponent instances. After a
+    // successful run the components stay configured: the next call skips
+    // Configure() when the host and the plan's configuration key
+    // (compiled_fingerprint + per-node component/settings/payload) match.
     DasResult RunWithHost(
         const Dto::CompiledGraphPlanDto&             plan,
         const std::string&                           current_fingerprint,
@@ -97,6 +125,21 @@ public:
     // Clear all per-node component state (e.g., between runs).
     void ResetNodeComponents();
 
+    // Opt in to (or out of) parallel dispatch of independent nodes. Disabled
+    // by default; the worker pool is created on the first parallel run.
+    void SetParallelExecution(const ParallelExecutionOptions& options);
+
+    const ParallelExecutionOptions& GetParallelExecution() const
+    {
+        return parallel_options_;
+    }
+
+    // Return the lowered (integer-indexed) form of @p plan. Reused while
+    // compiled_fingerprint is unchanged; plans without a compiled_fingerprint
+    // are lowered on every call.
+    const LoweredGraphPlan& GetLoweredPlan(
+        const Dto::CompiledGraphPlanDto& plan);
+
 private:
     std::string last_error_;
 
@@ -106,22 +149,50 @@ private:
     // True after Configure() has been called at least once.
     bool configured_ = false;
 
+    // Configuration key and host of the last successful RunWithHost; empty
+    // when node_components_ must not be reused (see MakeConfigurationKey).
+    std::string                                              configured_key_;
+    DAS::DasPtr<Das::PluginInterface::IDasTaskComponentHost> configured_host_;
+
+    // Lowered plan cached by compiled_fingerprint (see GetLoweredPlan).
+    std::unique_ptr<LoweredGraphPlan> lowered_plan_;
+
+    // node_components_ entries indexed by LoweredGraphPlan::NodeIndex,
+    // resolved once per run (nullptr when a node has no component).
+    std::vector<const NodeComponentEntry*> node_component_slots_;
+
     // Optional error lens for structured error propagation.
     Das::PluginInterface::IDasErrorLens* p_error_lens_ = nullptr;
 
+    // Parallel scheduler configuration and its lazily created pool.
+    struct WorkerPool;
+    ParallelExecutionOptions    parallel_options_;
+    std::unique_ptr<WorkerPool> worker_pool_;
+
     // Validate compiled plan fingerprint against current graph fingerprint.
     // Returns DAS_S_OK on match, DAS_E_FAIL on mismatch.
     static DasResult ValidateFingerprint(
         const std::string& compiled_source_fingerprint,
         const std::string& current_fingerprint);
 
+    // compiled_fingerprint plus each node's id, component_guid, settings and
+    // payload. Empty for plans without a compiled_fingerprint (never reused).
+    static std::string MakeConfigurationKey(
+        const Dto::CompiledGraphPlanDto& plan);
+
+    // Resolve node_component_slots_ for @p lowered from node_components_.
+    void BindNodeComponentSlots(const LoweredGraphPlan& lowered);
+
     // Execute a node using its pre-configured IDasTaskComponent.
-    // Converts PortMap ↔ JSON for the IDasTaskComponent::Do() ABI.
+    // Inputs are read from @p input_frame, outputs written to @p output_frame
+    // (the same frame on the sequential paths). Does not touch runtime state,
+    // so distinct nodes may execute concurrently against a shared input frame.
     DasResult ExecuteNodeWithComponent(
-        const std::string&                   node_id,
+        LoweredGraphPlan::NodeIndex          node,
         Das::PluginInterface::IDasStopToken* p_stop_token,
-        PortFrame&                           frame,
-        const Dto::CompiledGraphPlanDto&     plan);
+        const PortFrame&                     input_frame,
+        PortFrame&                           output_frame,
+        const LoweredGraphPlan&              lowered) const;
 
     // Signal-driven ready-queue scheduler (DAS-60 Stage 3). Activates a node
     // when its data predecessors are resolved AND its signal gate is open,
@@ -129,10 +200,26 @@ private:
     // back-edge firing. Used only when the plan carries signal routes or
     // back edges; pure-data graphs keep the linear execution_order path.
     DasResult RunSignalGated(
-        const Dto::CompiledGraphPlanDto&     plan,
+        const LoweredGraphPlan&              lowered,
         Das::PluginInterface::IDasStopToken* p_stop_token,
         PortFrame&                           frame);
 
+    // Wave scheduler used when parallel execution is enabled. Same gate, skip
+    // and loop semantics as RunSignalGated, but every node that is ready in a
+    // pass is dispatched together (see ParallelExecutionOptions).
+    DasResult RunParallel(
+        const LoweredGraphPlan&              lowered,
+        Das::PluginInterface::IDasStopToken* p_stop_token,
+        PortFrame&                           frame);
+
+    // Run one wave of mutually independent nodes and publish their outputs
+    // into @p frame in wave order. Fails with the first node error in order.
+    DasResult RunWave(
+        const std::vector<LoweredGraphPlan::NodeIndex>& wave,
+        const LoweredGraphPlan&                         lowered,
+        Das::PluginInterface::IDasStopToken*            p_stop_token,
+        PortFrame&                                      frame);
+
     // Check stop token; returns DAS_E_FAIL if cancelled.
     static DasResult CheckStopToken(
         Das::PluginInterface::IDasStopToken* p_stop_token);
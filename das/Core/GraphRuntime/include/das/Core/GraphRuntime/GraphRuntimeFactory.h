@@ -15,16 +15,28 @@ DAS_CORE_GRAPHRUNTIME_NS_BEGIN
 // Internal C++ implementation of IDasGraphRuntime COM interface.
 // Wraps the engine-level GraphRuntime class behind a COM-compatible facade.
 // Inherits from autogen ImplBase for automatic AddRef/Release/QueryInterface.
+//
+// Keep one instance alive across runs of the same graph: the last parsed
+// artifact is reused when the identical artifact text (same
+// compiled_fingerprint and settings) is executed again, and the engine keeps
+// its configured components and lowered plan (see GraphRuntime::RunWithHost).
+// Parallel execution is fixed at construction; see
+// CreateGraphRuntimeWithOptions.
 class GraphRuntimeImpl final
     : public Das::ExportInterface::DasGraphRuntimeImplBase<GraphRuntimeImpl>
 {
     GraphRuntime                                        engine_;
     std::string                                         last_error_;
     DasPtr<Das::PluginInterface::IDasTaskComponentHost> host_;
+    std::string                                         cached_artifact_json_;
+    Dto::CompiledGraphPlanDto                           cached_plan_;
 
 public:
     explicit GraphRuntimeImpl(
-        Das::PluginInterface::IDasTaskComponentHost* p_host);
+        Das::PluginInterface::IDasTaskComponentHost* p_host,
+        const ParallelExecutionOptions&              parallel = {});
+
+    const GraphRuntime& GetEngine() const { return engine_; }
 
     // --- IDasGraphRuntime interface ---
     DAS_IMPL GetErrorMessage(IDasReadOnlyString** pp_out_error_message);
@@ -47,6 +59,15 @@ DAS_C_API DasResult CreateGraphRuntimeWithHost(
     Das::PluginInterface::IDasTaskComponentHost* p_host,
     Das::ExportInterface::IDasGraphRuntime**     pp_out_runtime);
 
+/// Same as CreateGraphRuntimeWithHost, with wave-parallel dispatch enabled
+/// when @p parallel_execution is true (see ParallelExecutionOptions).
+/// @p max_workers = 0 sizes the pool to std::thread::hardware_concurrency().
+DAS_C_API DasResult CreateGraphRuntimeWithOptions(
+    Das::PluginInterface::IDasTaskComponentHost* p_host,
+    DasBool                                      parallel_execution,
+    size_t                                       max_workers,
+    Das::ExportInterface::IDasGraphRuntime**     pp_out_runtime);
+
 // ---------------------------------------------------------------------------
 // Stateful authoring session C ABI (DAS-77)
 // ---------------------------------------------------------------------------
@@ -0,0 +1,169 @@
+#ifndef DAS_CORE_GRAPHRUNTIME_LOWEREDGRAPHPLAN_H
+#define DAS_CORE_GRAPHRUNTIME_LOWEREDGRAPHPLAN_H
+
+#include <das/Core/GraphRuntime/CompiledArtifact.h>
+#include <das/Core/GraphRuntime/Config.h>
+#include <das/Core/GraphRuntime/PortFrame.h>
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+DAS_CORE_GRAPHRUNTIME_NS_BEGIN
+
+// ---------------------------------------------------------------------------
+// LoweredGraphPlan — dense, integer-indexed form of CompiledGraphPlanDto
+//
+// Produced once per compiled_fingerprint by GraphRuntime and reused across
+// runs. Every node id referenced by the plan is mapped to a dense index
+// (execution_order nodes first); adjacency is stored as CSR (offsets + flat
+// arrays); per-node input bindings, signal gates, back edges and loop SCCs are
+// resolved up front. Scheduling therefore indexes vectors instead of hashing
+// node id strings, and every PortKey the runtime reads is built here with a
+// parsed node GUID and an interned port id.
+// ---------------------------------------------------------------------------
+class LoweredGraphPlan
+{
+public:
+    using NodeIndex = uint32_t;
+
+    static constexpr NodeIndex kInvalidNode =
+        std::numeric_limits<NodeIndex>::max();
+
+    // Incoming signal route that gates a node (back edges excluded).
+    struct GateRoute
+    {
+        NodeIndex source = kInvalidNode;
+        PortKey   source_port;
+    };
+
+    // Back edge leaving a loop body terminal.
+    struct BackEdge
+    {
+        PortKey   source_port;
+        NodeIndex loop_head = kInvalidNode;
+    };
+
+    // Data binding into a node. Broadcast (graph-input) bindings have no
+    // source port and carry the graph input's default instead.
+    struct InputBinding
+    {
+        PortKey                                        source_port;
+        Das::Core::ForeignInterfaceHost::DasStringAtom target_port;
+        bool                                           broadcast = false;
+        yyjson::value                                  default_value;
+    };
+
+    LoweredGraphPlan() = default;
+
+    static LoweredGraphPlan Lower(const Dto::CompiledGraphPlanDto& plan);
+
+    const std::string& GetCompiledFingerprint() const
+    {
+        return compiled_fingerprint_;
+    }
+
+    // Nodes referenced anywhere in the plan (scheduled or not).
+    std::size_t NodeCount() const { return node_ids_.size(); }
+
+    // execution_order mapped to indices; duplicates are preserved.
+    const std::vector<NodeIndex>& GetExecutionOrder() const
+    {
+        return execution_order_;
+    }
+
+    bool HasControlFlow() const { return has_control_flow_; }
+
+    NodeIndex FindNode(const std::string& node_id) const;
+
+    const std::string& GetNodeId(NodeIndex node) const
+    {
+        return node_ids_[node];
+    }
+
+    // Node GUID parsed at lowering time. When the id is not a valid GUID this
+    // falls back to MakeDasGuid(), which throws exactly as the unlowered
+    // runtime did.
+    DasGuid GetNodeGuid(NodeIndex node) const;
+
+    bool IsNodeGuidValid(NodeIndex node) const
+    {
+        return node_guid_valid_[node] != 0;
+    }
+
+    // Point-to-point data predecessors (broadcast and signal edges excluded).
+    std::span<const NodeIndex> GetDataPredecessors(NodeIndex node) const
+    {
+        return Slice(data_pred_offsets_, data_preds_, node);
+    }
+
+    std::span<const GateRoute> GetGateRoutes(NodeIndex node) const
+    {
+        return Slice(gate_offsets_, gate_routes_, node);
+    }
+
+    std::span<const BackEdge> GetBackEdgesFrom(NodeIndex node) const
+    {
+        return Slice(back_edge_offsets_, back_edges_, node);
+    }
+
+    // SCC containing @p head (empty for non-heads); Signal markers of these
+    // nodes are cleared at every iteration boundary.
+    std::span<const NodeIndex> GetLoopScc(NodeIndex head) const
+    {
+        return Slice(loop_scc_offsets_, loop_scc_nodes_, head);
+    }
+
+    // Bindings whose target is @p node, in binding_plan order.
+    std::span<const InputBinding> GetInputBindings(NodeIndex node) const
+    {
+        return Slice(input_binding_offsets_, input_bindings_, node);
+    }
+
+private:
+    template <typename T>
+    static std::span<const T> Slice(
+        const std::vector<uint32_t>& offsets,
+        const std::vector<T>&        values,
+        NodeIndex                    node)
+    {
+        if (node + 1 >= offsets.size())
+        {
+            return {};
+        }
+        return std::span<const T>(
+            values.data() + offsets[node],
+            offsets[node + 1] - offsets[node]);
+    }
+
+    std::string compiled_fingerprint_;
+    bool        has_control_flow_ = false;
+
+    std::vector<std::string>                   node_ids_;
+    std::unordered_map<std::string, NodeIndex> node_index_;
+    std::vector<DasGuid>                       node_guids_;
+    std::vector<uint8_t>                       node_guid_valid_;
+    std::vector<NodeIndex>                     execution_order_;
+
+    std::vector<uint32_t>  data_pred_offsets_;
+    std::vector<NodeIndex> data_preds_;
+
+    std::vector<uint32_t>  gate_offsets_;
+    std::vector<GateRoute> gate_routes_;
+
+    std::vector<uint32_t> back_edge_offsets_;
+    std::vector<BackEdge> back_edges_;
+
+    std::vector<uint32_t>  loop_scc_offsets_;
+    std::vector<NodeIndex> loop_scc_nodes_;
+
+    std::vector<uint32_t>     input_binding_offsets_;
+    std::vector<InputBinding> input_bindings_;
+};
+
+DAS_CORE_GRAPHRUNTIME_NS_END
+
+#endif // DAS_CORE_GRAPHRUNTIME_LOWEREDGRAPHPLAN_H
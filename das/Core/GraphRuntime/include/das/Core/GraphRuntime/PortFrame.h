@@ -12,8 +12,10 @@
 
 #include <cpp_yyjson.hpp>
 #include <das/Core/ForeignInterfaceHost/DasGuid.h>
+#include <das/Core/ForeignInterfaceHost/DasStringAtom.h>
 #include <das/Core/GraphRuntime/Config.h>
 #include <das/DasPtr.hpp>
+#include <das/_autogen/idl/abi/IDasImage.h>
 
 DAS_CORE_GRAPHRUNTIME_NS_BEGIN
 
@@ -47,9 +49,14 @@ struct ComponentHandle
     DAS::DasPtr<IDasBase> ptr;
 };
 
+// Ref-counted image handle. Copying a PortValue/PortFrame only AddRefs the
+// IDasImage, so one frame can fan out to any number of consumers without
+// touching its pixels. Images are treated as immutable once published: a node
+// that wants to modify pixels produces a new IDasImage (copy-on-write) rather
+// than writing through GetBinaryBuffer.
 struct ImageData
 {
-    std::vector<uint8_t> bytes;
+    DAS::DasPtr<Das::ExportInterface::IDasImage> image;
 };
 
 struct JsonData
@@ -154,11 +161,15 @@ private:
 
 // ---------------------------------------------------------------------------
 // PortKey — composite key (node_id, port_id) for the frame map
+//
+// port_id is an interned atom, so equality and hashing never touch the port
+// name's bytes. Atoms are built explicitly, once, when the plan is lowered;
+// runtime lookups reuse those keys instead of interning strings again.
 // ---------------------------------------------------------------------------
 struct PortKey
 {
-    DasGuid     node_id{};
-    std::string port_id;
+    DasGuid                                        node_id{};
+    Das::Core::ForeignInterfaceHost::DasStringAtom port_id;
 
     bool operator==(const PortKey& other) const noexcept;
     bool operator!=(const PortKey& other) const noexcept;
@@ -182,7 +193,10 @@ public:
 
     // -- Mutators ------------------------------------------------------------
     void Set(const PortKey& key, PortValue value);
-    void Set(DasGuid node_id, std::string port_id, PortValue value);
+    void Set(
+        DasGuid                                        node_id,
+        Das::Core::ForeignInterfaceHost::DasStringAtom port_id,
+        PortValue                                      value);
 
     [[nodiscard]]
     bool Remove(const PortKey& key);
@@ -194,6 +208,11 @@ public:
     // re-evaluate cleanly. Data entries are preserved. (DAS-60 Stage 3.)
     std::size_t ClearSignalsByNode(DasGuid node_id);
 
+    // Move every entry of @p staged into this frame, overwriting existing keys,
+    // and leave @p staged empty. The parallel scheduler stages each node's
+    // outputs separately and publishes them here once its wave has finished.
+    void MergeFrom(PortFrame&& staged);
+
     // -- Observers -----------------------------------------------------------
     [[nodiscard]]
     const PortValue* Find(const PortKey& key) const noexcept;
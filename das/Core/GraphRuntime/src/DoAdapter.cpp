@@ -1,6 +1,7 @@
 #include <das/Core/GraphRuntime/DoAdapter.h>
 
 #include <das/Core/ForeignInterfaceHost/DasGuid.h>
+#include <das/Core/ForeignInterfaceHost/DasStringAtom.h>
 #include <das/Core/Logger/Logger.h>
 #include <das/Core/Utils/DasJsonImpl.h>
 #include <das/DasPtr.hpp>
@@ -29,13 +30,16 @@ namespace
 
     using IDasPortMap = Das::ExportInterface::IDasPortMap;
 
+    using Das::Core::ForeignInterfaceHost::DasStringAtom;
+    using Das::Core::ForeignInterfaceHost::ToStringAtom;
+
     DasResult PortValueToPortMap(
-        const PortValue&   pv,
-        const std::string& port_id,
-        IDasPortMap*       map)
+        const PortValue&     pv,
+        const DasStringAtom& port_id,
+        IDasPortMap*         map)
     {
-        // Create a DasReadOnlyString for the port_id key.
-        DasReadOnlyString key_str{port_id.c_str()};
+        // Interned key: no allocation, and the port map resolves it by atom.
+        auto* const p_key = port_id.GetString();
 
         if (pv.IsNull())
         {
@@ -43,28 +47,28 @@ namespace
         }
         if (pv.IsInt())
         {
-            return map->SetInt(key_str.Get(), *pv.AsInt());
+            return map->SetInt(p_key, *pv.AsInt());
         }
         if (pv.IsFloat())
         {
-            return map->SetFloat(key_str.Get(), *pv.AsFloat());
+            return map->SetFloat(p_key, *pv.AsFloat());
         }
         if (pv.IsString())
         {
             const auto&       s = *pv.AsString();
             DasReadOnlyString val_str{s.c_str()};
-            return map->SetString(key_str.Get(), val_str.Get());
+            return map->SetString(p_key, val_str.Get());
         }
         if (pv.IsBool())
         {
-            return map->SetBool(key_str.Get(), *pv.AsBool());
+            return map->SetBool(p_key, *pv.AsBool());
         }
         if (pv.IsBase())
         {
             auto* raw = pv.AsBase()->ptr.Get();
             if (raw != nullptr)
             {
-                return map->SetBase(key_str.Get(), DAS_IID_BASE, raw);
+                return map->SetBase(p_key, DAS_IID_BASE, raw);
             }
             return DAS_S_OK;
         }
@@ -73,16 +77,19 @@ namespace
             auto* raw = pv.AsComponent()->ptr.Get();
             if (raw != nullptr)
             {
-                return map->SetComponent(key_str.Get(), DAS_IID_BASE, raw);
+                return map->SetComponent(p_key, DAS_IID_BASE, raw);
             }
             return DAS_S_OK;
         }
         if (pv.IsImage())
         {
-            DAS_CORE_LOG_WARN(
-                "Image type not yet supported in DoAdapter for port_id = {}.",
-                port_id);
-            return DAS_E_NO_IMPLEMENTATION;
+            // Hand the same IDasImage to the consumer — no pixel copy.
+            auto* raw = pv.AsImage()->image.Get();
+            if (raw != nullptr)
+            {
+                return map->SetImage(p_key, raw);
+            }
+            return DAS_S_OK;
         }
         if (pv.IsJson())
         {
@@ -108,15 +115,15 @@ namespace
     }
 
     DasResult PortMapEntryToPortValue(
-        IDasPortMap*       map,
-        const std::string& port_id,
-        DasGuid            node_id,
-        PortFrame&         frame)
+        IDasPortMap*         map,
+        const DasStringAtom& port_id,
+        DasGuid              node_id,
+        PortFrame&           frame)
     {
-        DasReadOnlyString key_str{port_id.c_str()};
+        auto* const p_key = port_id.GetString();
 
         DasVariantType kind = DAS_VARIANT_TYPE_NULL;
-        DasResult      result = map->GetType(key_str.Get(), &kind);
+        DasResult      result = map->GetType(p_key, &kind);
         if (DAS::IsFailed(result))
         {
             return result;
@@ -127,7 +134,7 @@ namespace
         case DAS_VARIANT_TYPE_INT:
         {
             int64_t val{};
-            result = map->GetInt(key_str.Get(), &val);
+            result = map->GetInt(p_key, &val);
             if (DAS::IsOk(result))
             {
                 frame.Set(node_id, port_id, PortValue(val));
@@ -137,7 +144,7 @@ namespace
         case DAS_VARIANT_TYPE_FLOAT:
         {
             double val{};
-            result = map->GetFloat(key_str.Get(), &val);
+            result = map->GetFloat(p_key, &val);
             if (DAS::IsOk(result))
             {
                 frame.Set(node_id, port_id, PortValue(val));
@@ -147,7 +154,7 @@ namespace
         case DAS_VARIANT_TYPE_STRING:
         {
             IDasReadOnlyString* p_str = nullptr;
-            result = map->GetString(key_str.Get(), &p_str);
+            result = map->GetString(p_key, &p_str);
             if (DAS::IsOk(result) && p_str != nullptr)
             {
                 const char* utf8 = nullptr;
@@ -163,7 +170,7 @@ namespace
         case DAS_VARIANT_TYPE_BOOL:
         {
             bool val{};
-            result = map->GetBool(key_str.Get(), &val);
+            result = map->GetBool(p_key, &val);
             if (DAS::IsOk(result))
             {
                 frame.Set(node_id, port_id, PortValue(val));
@@ -173,7 +180,7 @@ namespace
         case DAS_VARIANT_TYPE_BASE:
         {
             IDasBase* p_obj = nullptr;
-            result = map->GetBase(key_str.Get(), DAS_IID_BASE, &p_obj);
+            result = map->GetBase(p_key, DAS_IID_BASE, &p_obj);
             if (DAS::IsOk(result))
             {
                 // Attach adopts the +1 ref from QueryInterface inside
@@ -191,7 +198,7 @@ namespace
         case DAS_VARIANT_TYPE_COMPONENT:
         {
             IDasBase* p_comp = nullptr;
-            result = map->GetComponent(key_str.Get(), DAS_IID_BASE, &p_comp);
+            result = map->GetComponent(p_key, DAS_IID_BASE, &p_comp);
             if (DAS::IsOk(result))
             {
                 // Same pattern: GetComponent returns +1 ref, Attach
@@ -206,10 +213,21 @@ namespace
         }
         case DAS_VARIANT_TYPE_IMAGE:
         {
-            DAS_CORE_LOG_WARN(
-                "Image extraction not yet supported for port_id = {}.",
-                port_id);
-            return DAS_S_OK;
+            Das::ExportInterface::IDasImage* p_image = nullptr;
+            result = map->GetImage(p_key, &p_image);
+            if (DAS::IsOk(result))
+            {
+                // GetImage returns +1 ref; Attach adopts it. The frame keeps
+                // a reference to the producer's image, not a copy.
+                auto image_ptr =
+                    DAS::DasPtr<Das::ExportInterface::IDasImage>::Attach(
+                        p_image);
+                frame.Set(
+                    node_id,
+                    port_id,
+                    PortValue(ImageData{std::move(image_ptr)}));
+            }
+            return result;
         }
         case DAS_VARIANT_TYPE_NULL:
         {
@@ -253,9 +271,10 @@ namespace
         DasGuid                            node_id,
         PortFrame&                         frame)
     {
-        DasReadOnlyString  key{std::string{kEmittedSignalsKey}.c_str()};
+        static const DasStringAtom key{kEmittedSignalsKey};
+
         IDasReadOnlyString* p_str = nullptr;
-        DasResult           result = map->GetString(key.Get(), &p_str);
+        DasResult           result = map->GetString(key.GetString(), &p_str);
         if (DAS::IsFailed(result) || p_str == nullptr)
         {
             return DAS_S_OK;
@@ -293,7 +312,7 @@ namespace
             {
                 continue;
             }
-            frame.Set(node_id, std::string(*name), PortValue::Signal());
+            frame.Set(node_id, DasStringAtom{*name}, PortValue::Signal());
         }
         return DAS_S_OK;
     }
@@ -313,10 +332,10 @@ namespace
     /// inputs are scalar options, mirroring MAA global_option.
     DasResult SetDefaultFromYyjson(
         IDasPortMap*         map,
-        const std::string&   port_id,
+        const DasStringAtom& port_id,
         const yyjson::value& default_value)
     {
-        DasReadOnlyString key{port_id.c_str()};
+        auto* const p_key = port_id.GetString();
 
         if (default_value.is_null())
         {
@@ -324,21 +343,21 @@ namespace
         }
         if (auto v = default_value.as_bool())
         {
-            return map->SetBool(key.Get(), *v);
+            return map->SetBool(p_key, *v);
         }
         if (auto v = default_value.as_int())
         {
-            return map->SetInt(key.Get(), *v);
+            return map->SetInt(p_key, *v);
         }
         if (auto v = default_value.as_real())
         {
-            return map->SetFloat(key.Get(), *v);
+            return map->SetFloat(p_key, *v);
         }
         if (auto v = default_value.as_string())
         {
             std::string      s(*v);
             DasReadOnlyString val{s.c_str()};
-            return map->SetString(key.Get(), val.Get());
+            return map->SetString(p_key, val.Get());
         }
 
         DAS_CORE_LOG_WARN(
@@ -355,9 +374,9 @@ namespace
 // ===========================================================================
 
 DasResult BuildInputPortMap(
-    const PortFrame&                        frame,
-    const std::vector<Dto::PortBindingDto>& bindings,
-    Das::ExportInterface::IDasPortMap**     out_map)
+    const PortFrame&                                frame,
+    std::span<const LoweredGraphPlan::InputBinding> bindings,
+    Das::ExportInterface::IDasPortMap**             out_map)
 {
     if (out_map == nullptr)
     {
@@ -376,45 +395,42 @@ DasResult BuildInputPortMap(
     for (const auto& binding : bindings)
     {
         // Broadcast (graph-input) binding: materialise from its declared
-        // default_value — there is no upstream node to read from the frame, and
-        // MakeDasGuid would reject the sentinel string. (DAS-75 graph_inputs
-        // broadcast injection.)
-        if (binding.source_node_id == std::string{kBroadcastSource})
+        // default_value — there is no upstream node to read from the frame.
+        // (DAS-75 graph_inputs broadcast injection.)
+        if (binding.broadcast)
         {
             DasResult r = SetDefaultFromYyjson(
-                map.Get(), binding.target_port_id, binding.default_value);
+                map.Get(),
+                binding.target_port,
+                binding.default_value);
             if (DAS::IsFailed(r))
             {
                 DAS_CORE_LOG_ERROR(
                     "Failed to materialise graph-input default for "
                     "target_port_id = {}.",
-                    binding.target_port_id);
+                    binding.target_port);
                 return r;
             }
             continue;
         }
 
-        // Convert string node_id → DasGuid and look up the source value.
-        const auto source_node = DAS::Core::ForeignInterfaceHost::MakeDasGuid(
-            binding.source_node_id);
-
-        const PortKey source_key{source_node, binding.source_port_id};
-        const auto*   pv = frame.Find(source_key);
+        // Source key was resolved at lowering time: GUID parsed, port interned.
+        const auto* pv = frame.Find(binding.source_port);
         if (pv == nullptr)
         {
             DAS_CORE_LOG_WARN(
                 "Source port not found: node = {}, port = {}.",
-                binding.source_node_id,
-                binding.source_port_id);
+                binding.source_port.node_id,
+                binding.source_port.port_id);
             continue;
         }
 
-        result = PortValueToPortMap(*pv, binding.target_port_id, map.Get());
+        result = PortValueToPortMap(*pv, binding.target_port, map.Get());
         if (DAS::IsFailed(result))
         {
             DAS_CORE_LOG_ERROR(
                 "Failed to set port value for target_port_id = {}.",
-                binding.target_port_id);
+                binding.target_port);
             return result;
         }
     }
@@ -423,6 +439,35 @@ DasResult BuildInputPortMap(
     return DAS_S_OK;
 }
 
+DasResult BuildInputPortMap(
+    const PortFrame&                        frame,
+    const std::vector<Dto::PortBindingDto>& bindings,
+    Das::ExportInterface::IDasPortMap**     out_map)
+{
+    std::vector<LoweredGraphPlan::InputBinding> resolved;
+    resolved.reserve(bindings.size());
+    for (const auto& binding : bindings)
+    {
+        LoweredGraphPlan::InputBinding input{
+            .target_port = DasStringAtom{binding.target_port_id}};
+        if (binding.source_node_id == kBroadcastSource)
+        {
+            input.broadcast = true;
+            input.default_value = binding.default_value;
+        }
+        else
+        {
+            // MakeDasGuid throws on a malformed node id, as before lowering.
+            input.source_port = PortKey{
+                DAS::Core::ForeignInterfaceHost::MakeDasGuid(
+                    binding.source_node_id),
+                DasStringAtom{binding.source_port_id}};
+        }
+        resolved.push_back(std::move(input));
+    }
+    return BuildInputPortMap(frame, resolved, out_map);
+}
+
 // ===========================================================================
 // ExtractOutputPortMap
 // ===========================================================================
@@ -464,13 +509,20 @@ DasResult ExtractOutputPortMap(
             continue;
         }
 
-        const char* utf8 = nullptr;
-        p_key->GetUtf8(&utf8);
-        std::string port_id(utf8 ? utf8 : "");
+        // Keys handed out by DasPortMapImpl are already interned, so this
+        // resolves without a table lookup.
+        const auto atom = ToStringAtom(p_key);
+        if (!atom)
+        {
+            DAS_CORE_LOG_WARN("Failed to read key at index = {}.", i);
+            p_key->Release();
+            continue;
+        }
+        const auto& port_id = atom.value();
 
         // The reserved "signals" key is control-flow metadata, not a data
         // port — materialise it as Signal markers and skip normal extraction.
-        if (port_id == std::string{kEmittedSignalsKey})
+        if (port_id == kEmittedSignalsKey)
         {
             ExtractEmittedSignals(output_map, node_id, frame);
             p_key->Release();
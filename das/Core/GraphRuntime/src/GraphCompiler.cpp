@@ -95,6 +95,16 @@ GraphCompiler::ManifestPorts GraphCompiler::ReadManifest(
             result.inputs = PortsFromDefinitionList(def.definition, "inputs");
             result.outputs = PortsFromDefinitionList(def.definition, "outputs");
             result.was_resolved = true;
+
+            auto def_obj = def.definition.as_object();
+            if (def_obj.has_value()
+                && def_obj->contains(std::string_view("threadSafe")))
+            {
+                result.thread_safe =
+                    (*def_obj)[std::string_view("threadSafe")]
+                        .as_bool()
+                        .value_or(false);
+            }
             return result;
         }
     }
@@ -983,6 +993,7 @@ Dto::CompiledGraphPlanDto GraphCompiler::Compile(
         plan.execution_order);
 
     // Phase 7: Build node snapshots from graph document nodes
+    std::unordered_map<std::string, bool> thread_safe_cache;
     for (const auto& node : document.nodes)
     {
         Dto::CompiledNodeSnapshotDto snapshot;
@@ -993,6 +1004,22 @@ Dto::CompiledGraphPlanDto GraphCompiler::Compile(
             && node.target.component_ref.has_value())
         {
             snapshot.component_guid = node.target.component_ref->component_guid;
+
+            // Manifest-declared thread safety gates parallel dispatch.
+            if (factory_manager_)
+            {
+                auto it = thread_safe_cache.find(snapshot.component_guid);
+                if (it == thread_safe_cache.end())
+                {
+                    it = thread_safe_cache
+                             .emplace(
+                                 snapshot.component_guid,
+                                 ReadManifest(snapshot.component_guid)
+                                     .thread_safe)
+                             .first;
+                }
+                snapshot.thread_safe = it->second;
+            }
         }
 
         // Copy settings if present
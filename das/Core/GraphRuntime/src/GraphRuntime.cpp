@@ -16,12 +16,17 @@
 #include <das/_autogen/idl/abi/IDasTaskComponent.h>
 #include <das/_autogen/idl/header/IDasPortMap.generated.h>
 
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
 #include <algorithm>
-#include <deque>
+#include <cstdint>
+#include <exception>
+#include <latch>
 #include <string>
-#include <tuple>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 DAS_CORE_GRAPHRUNTIME_NS_BEGIN
@@ -140,8 +145,83 @@ DasResult GraphRuntime::GetStructuredError(
 
 void GraphRuntime::ResetNodeComponents()
 {
+    node_component_slots_.clear();
     node_components_.clear();
     configured_ = false;
+    configured_key_.clear();
+    configured_host_ = nullptr;
+}
+
+std::string GraphRuntime::MakeConfigurationKey(
+    const Dto::CompiledGraphPlanDto& plan)
+{
+    if (plan.compiled_fingerprint.empty())
+    {
+        return {};
+    }
+
+    // Fields are NUL-separated; node ids and GUIDs never contain NUL and the
+    // serialized JSON escapes it.
+    std::string key = plan.compiled_fingerprint;
+    auto        append = [&key](std::string_view field)
+    {
+        key.push_back('\0');
+        key.append(field);
+    };
+    auto append_json = [&append](const yyjson::value& value)
+    {
+        if (value.is_null())
+        {
+            append({});
+            return;
+        }
+        auto serialized = Das::Utils::SerializeYyjsonValue(value);
+        append(serialized.has_value() ? std::string_view{*serialized} : "?");
+    };
+
+    for (const auto& snapshot : plan.node_snapshots)
+    {
+        append(snapshot.node_id);
+        append(snapshot.component_guid);
+        append_json(snapshot.compiled_settings);
+        append_json(snapshot.compiled_payload_json);
+    }
+    return key;
+}
+
+// ===========================================================================
+// GetLoweredPlan / BindNodeComponentSlots
+// ===========================================================================
+
+const LoweredGraphPlan& GraphRuntime::GetLoweredPlan(
+    const Dto::CompiledGraphPlanDto& plan)
+{
+    if (lowered_plan_ && !plan.compiled_fingerprint.empty()
+        && lowered_plan_->GetCompiledFingerprint() == plan.compiled_fingerprint)
+    {
+        return *lowered_plan_;
+    }
+
+    lowered_plan_ =
+        std::make_unique<LoweredGraphPlan>(LoweredGraphPlan::Lower(plan));
+    DAS_CORE_LOG_TRACE(
+        "Lowered plan rebuilt: compiled_fingerprint = {}, nodes = {}",
+        plan.compiled_fingerprint,
+        lowered_plan_->NodeCount());
+    return *lowered_plan_;
+}
+
+void GraphRuntime::BindNodeComponentSlots(const LoweredGraphPlan& lowered)
+{
+    node_component_slots_.assign(lowered.NodeCount(), nullptr);
+    for (LoweredGraphPlan::NodeIndex i = 0; i < lowered.NodeCount(); ++i)
+    {
+        auto it = node_components_.find(lowered.GetNodeId(i));
+        if (it != node_components_.end())
+        {
+            node_component_slots_[i] = &it->second;
+        }
+    }
 }
 
 // ===========================================================================
@@ -296,6 +376,7 @@ DasResult GraphRuntime::Configure(
         entry.component_guid = snapshot.component_guid;
         entry.component = std::move(component);
         entry.settings_applied = true;
+        entry.thread_safe = snapshot.thread_safe;
         node_components_[snapshot.node_id] = std::move(entry);
 
         DAS_CORE_LOG_TRACE(
@@ -363,33 +444,33 @@ DasResult GraphRuntime::Prepare() const
 // ===========================================================================
 
 DasResult GraphRuntime::ExecuteNodeWithComponent(
-    const std::string&                   node_id,
+    LoweredGraphPlan::NodeIndex          node,
     Das::PluginInterface::IDasStopToken* p_stop_token,
-    PortFrame&                           frame,
-    const Dto::CompiledGraphPlanDto&     plan)
+    const PortFrame&                     input_frame,
+    PortFrame&                           output_frame,
+    const LoweredGraphPlan&              lowered) const
 {
+    const std::string& node_id = lowered.GetNodeId(node);
+
     // 1. Look up pre-configured component
-    auto it = node_components_.find(node_id);
-    if (it == node_components_.end())
+    const NodeComponentEntry* p_entry = node < node_component_slots_.size()
+                                            ? node_component_slots_[node]
+                                            : nullptr;
+    if (!p_entry)
     {
         DAS_CORE_LOG_ERROR("No configured component for node = {}", node_id);
         return DAS_E_NOT_FOUND;
     }
 
-    auto* p_component = it->second.component.Get();
+    auto* p_component = p_entry->component.Get();
     if (!p_component)
     {
         DAS_CORE_LOG_ERROR("Null component for node = {}", node_id);
         return DAS_E_FAIL;
     }
 
-    // 2. Collect input bindings for this target node
-    std::vector<Dto::PortBindingDto> input_bindings;
-    for (const auto& b : plan.binding_plan.bindings)
-    {
-        if (b.target_node_id == node_id)
-            input_bindings.push_back(b);
-    }
+    // 2. Input bindings for this target node were resolved at lowering time
+    const auto& input_bindings = lowered.GetInputBindings(node);
 
     // 3. Build input PortMap from upstream PortFrame data
     DAS::DasPtr<IDasPortMap> input_portmap;
@@ -397,7 +478,7 @@ DasResult GraphRuntime::ExecuteNodeWithComponent(
     if (!input_bindings.empty())
     {
         DasResult hr =
-            BuildInputPortMap(frame, input_bindings, input_portmap.Put());
+            BuildInputPortMap(input_frame, input_bindings, input_portmap.Put());
         if (DAS_S_OK != hr)
         {
             DAS_CORE_LOG_ERROR(
@@ -433,8 +514,10 @@ DasResult GraphRuntime::ExecuteNodeWithComponent(
     // 5. Extract output PortMap → PortFrame
     if (output_portmap)
     {
-        auto guid = Das::Core::ForeignInterfaceHost::MakeDasGuid(node_id);
-        hr = ExtractOutputPortMap(output_portmap.Get(), guid, frame);
+        hr = ExtractOutputPortMap(
+            output_portmap.Get(),
+            lowered.GetNodeGuid(node),
+            output_frame);
         if (DAS_S_OK != hr)
         {
             DAS_CORE_LOG_ERROR(
@@ -469,267 +552,144 @@ DasResult GraphRuntime::ExecuteNodeWithComponent(
 //              boundary), so gates re-decide without cross-iteration residue.
 //
 // ExecuteNodeWithComponent (input assembly / Do / output writeback) is reused
-// unchanged. No loop-limit guard: a component that never breaks loops forever
-// by design (user responsibility).
+// unchanged. All bookkeeping runs on the LoweredGraphPlan (dense node indices,
+// CSR adjacency, pre-computed loop SCCs), cached per compiled_fingerprint, so
+// steady-state scheduling does no node-id string hashing.
+//
+// No loop-limit guard: a component that never breaks loops forever by design
+// (user responsibility).
 
 namespace
 {
-    // Sentinel source marking a broadcast (graph-input) binding — not a real
-    // node, so it creates no data dependency. Must match GraphCompiler.
-    constexpr std::string_view kBroadcastSource = "$graph_input";
-
-    using EdgeKey =
-        std::tuple<std::string, std::string, std::string, std::string>;
+    using NodeIndex = LoweredGraphPlan::NodeIndex;
 
-    struct EdgeKeyHash
+    // Per-run scheduling state shared by RunSignalGated and RunParallel.
+    // Nodes outside execution_order stay Pending forever, exactly like the
+    // string-keyed scheduler (their dependants never become decidable).
+    class SignalGateState
     {
-        std::size_t operator()(const EdgeKey& k) const noexcept
+    public:
+        enum class NState : uint8_t
         {
-            std::size_t seed = 0xcbf29ce484222325ULL;
-            auto mix = [&](const std::string& s)
-            {
-                seed ^=
-                    std::hash<std::string>{}(s) + 0x9e3779b9 + (seed << 6)
-                    + (seed >> 2);
-            };
-            mix(std::get<0>(k));
-            mix(std::get<1>(k));
-            mix(std::get<2>(k));
-            mix(std::get<3>(k));
-            return seed;
-        }
-    };
+            Pending,
+            Done,
+            Skipped
+        };
 
-    inline EdgeKey MakeEdgeKey(
-        const std::string& sn,
-        const std::string& sp,
-        const std::string& tn,
-        const std::string& tp)
-    {
-        return std::make_tuple(sn, sp, tn, tp);
-    }
-} // namespace
-
-DasResult GraphRuntime::RunSignalGated(
-    const Dto::CompiledGraphPlanDto&     plan,
-    Das::PluginInterface::IDasStopToken* p_stop_token,
-    PortFrame&                           frame)
-{
-    // -- edge classification: signal edges vs back edges (4-tuples) ----------
-    std::unordered_set<EdgeKey, EdgeKeyHash> signal_edge_keys;
-    std::unordered_set<EdgeKey, EdgeKeyHash> back_edge_keys;
-    for (const auto& r : plan.signal_routes)
-    {
-        signal_edge_keys.insert(MakeEdgeKey(
-            r.source_node_id, r.source_port_id, r.target_node_id, r.target_port_id));
-    }
-    for (const auto& be : plan.back_edges)
-    {
-        back_edge_keys.insert(MakeEdgeKey(
-            be.source_node_id,
-            be.source_port_id,
-            be.target_node_id,
-            be.target_port_id));
-    }
-
-    // -- data dependencies (point-to-point data edges only) -----------------
-    // Broadcast bindings and signal edges carry no node-level data dependency.
-    std::unordered_map<std::string, std::vector<std::string>> data_preds;
-    std::unordered_map<std::string, std::vector<std::string>> data_succ;
-    for (const auto& b : plan.binding_plan.bindings)
-    {
-        if (b.source_node_id == std::string(kBroadcastSource))
-        {
-            continue;
-        }
-        const auto key = MakeEdgeKey(
-            b.source_node_id, b.source_port_id, b.target_node_id, b.target_port_id);
-        if (signal_edge_keys.count(key) > 0)
+        explicit SignalGateState(const LoweredGraphPlan& lowered)
+            : lowered_(lowered), state_(lowered.NodeCount(), NState::Pending)
         {
-            continue;
         }
-        data_preds[b.target_node_id].push_back(b.source_node_id);
-        data_succ[b.source_node_id].push_back(b.target_node_id);
-    }
 
-    // -- gate routes (non-back-edge signal routes) + signal fan-out ---------
-    std::unordered_map<std::string, std::vector<Dto::SignalRouteDto>> gate_routes;
-    std::unordered_map<std::string, std::vector<Dto::SignalRouteDto>> signal_out;
-    for (const auto& r : plan.signal_routes)
-    {
-        signal_out[r.source_node_id].push_back(r);
-        const auto key = MakeEdgeKey(
-            r.source_node_id, r.source_port_id, r.target_node_id, r.target_port_id);
-        // Back-edges re-activate the loop head via the pass restart below; they
-        // are NOT gates the head must wait on (the head runs first each pass).
-        if (back_edge_keys.count(key) > 0)
-        {
-            continue;
-        }
-        gate_routes[r.target_node_id].push_back(r);
-    }
+        NState Get(NodeIndex n) const { return state_[n]; }
 
-    // -- loop structure: back-edge sources + loop heads ---------------------
-    std::unordered_map<std::string, std::vector<Dto::BackEdgeDto>>
-                                        back_edges_by_source;
-    std::unordered_set<std::string>     loop_heads;
-    for (const auto& be : plan.back_edges)
-    {
-        loop_heads.insert(be.loop_head_node_id);
-        back_edges_by_source[be.source_node_id].push_back(be);
-    }
+        void Set(NodeIndex n, NState s) { state_[n] = s; }
 
-    // -- unified adjacency (data + every signal route incl. back-edges) -----
-    std::unordered_map<std::string, std::vector<std::string>> fwd_adj;
-    std::unordered_map<std::string, std::vector<std::string>> bwd_adj;
-    auto link = [&](const std::string& from, const std::string& to)
-    {
-        fwd_adj[from].push_back(to);
-        bwd_adj[to].push_back(from);
-    };
-    for (const auto& [tgt, preds] : data_preds)
-    {
-        for (const auto& p : preds)
+        bool CanDecide(NodeIndex n) const
         {
-            link(p, tgt);
-        }
-    }
-    for (const auto& r : plan.signal_routes)
-    {
-        link(r.source_node_id, r.target_node_id);
-    }
-
-    // Nodes that participate in this graph (for reachability scoping).
-    std::unordered_set<std::string> graph_nodes;
-    for (const auto& n : plan.execution_order)
-    {
-        graph_nodes.insert(n);
-    }
-
-    auto reach =
-        [&](const std::string& start,
-            const std::unordered_map<std::string, std::vector<std::string>>& adj)
-        -> std::unordered_set<std::string>
-    {
-        std::unordered_set<std::string> seen{start};
-        std::deque<std::string>        q{start};
-        while (!q.empty())
-        {
-            const std::string u = q.front();
-            q.pop_front();
-            auto it = adj.find(u);
-            if (it == adj.end())
-            {
-                continue;
-            }
-            for (const auto& v : it->second)
+            for (const NodeIndex p : lowered_.GetDataPredecessors(n))
             {
-                if (graph_nodes.count(v) == 0)
+                if (state_[p] == NState::Pending)
                 {
-                    continue;
+                    return false;
                 }
-                if (seen.insert(v).second)
+            }
+            for (const auto& r : lowered_.GetGateRoutes(n))
+            {
+                if (state_[r.source] == NState::Pending)
                 {
-                    q.push_back(v);
+                    return false;
                 }
             }
+            return true;
         }
-        return seen;
-    };
 
-    // Per-loop-head reset set = the SCC containing the head
-    // (forward-reachable ∩ backward-reachable), whose Signal markers must be
-    // cleared at each iteration boundary.
-    std::unordered_map<std::string, std::vector<std::string>> loop_scc;
-    for (const auto& head : loop_heads)
-    {
-        const auto fr = reach(head, fwd_adj);
-        const auto br = reach(head, bwd_adj);
-        std::vector<std::string> scc;
-        for (const auto& n : fr)
+        bool ShouldSkip(NodeIndex n, const PortFrame& frame) const
         {
-            if (br.count(n) > 0)
+            // Gate first. A node with incoming signal routes runs only when at
+            // least one fired: if none fired it is skipped (the untaken branch
+            // of an if); if one fired it is on a taken branch and must run even
+            // when a non-taken-branch data predecessor was skipped — that is a
+            // φ-join such as das.flow.merge, whose value_* inputs come from
+            // both branches but only the taken one produced a value (DAS-74).
+            const auto gr = lowered_.GetGateRoutes(n);
+            if (!gr.empty())
             {
-                scc.push_back(n);
+                for (const auto& r : gr)
+                {
+                    if (!lowered_.IsNodeGuidValid(r.source))
+                    {
+                        // throws like MakeDasGuid
+                        (void)lowered_.GetNodeGuid(r.source);
+                    }
+                    const auto* pv = frame.Find(r.source_port);
+                    if (pv != nullptr && pv->IsSignal())
+                    {
+                        return false;
+                    }
+                }
+                return true;
             }
-        }
-        loop_scc[head] = std::move(scc);
-    }
-
-    // -- scheduling state ---------------------------------------------------
-    enum class NState
-    {
-        Pending,
-        Done,
-        Skipped
-    };
-    std::unordered_map<std::string, NState> state;
-    for (const auto& n : plan.execution_order)
-    {
-        state[n] = NState::Pending;
-    }
-
-    auto guid_of = [](const std::string& id)
-    {
-        return Das::Core::ForeignInterfaceHost::MakeDasGuid(id);
-    };
-    auto port_signaled = [&](const Dto::SignalRouteDto& r) -> bool
-    {
-        const auto* pv = frame.Find(PortKey{guid_of(r.source_node_id), r.source_port_id});
-        return pv != nullptr && pv->IsSignal();
-    };
-    auto can_decide = [&](const std::string& n) -> bool
-    {
-        for (const auto& p : data_preds[n])
-        {
-            if (state[p] == NState::Pending)
+            // No signal gate: skip-propagation — a data predecessor that was
+            // skipped starves this node.
+            for (const NodeIndex p : lowered_.GetDataPredecessors(n))
             {
-                return false;
+                if (state_[p] == NState::Skipped)
+                {
+                    return true;
+                }
             }
+            return false;
         }
-        for (const auto& r : gate_routes[n])
+
+        // Loop head whose back edge @p n has just fired, or kInvalidNode.
+        NodeIndex FiredLoopHead(NodeIndex n, const PortFrame& frame) const
         {
-            if (state[r.source_node_id] == NState::Pending)
+            for (const auto& be : lowered_.GetBackEdgesFrom(n))
             {
-                return false;
-            }
-        }
-        return true;
-    };
-    auto should_skip = [&](const std::string& n) -> bool
-    {
-        // Gate first. A node with incoming signal routes runs only when at least
-        // one fired: if none fired it is skipped (the untaken branch of an if);
-        // if one fired it is on a taken branch and must run even when a
-        // non-taken-branch data predecessor was skipped — that is a φ-join such
-        // as das.flow.merge, whose value_* inputs come from both branches but
-        // only the taken one produced a value (DAS-74).
-        const auto& gr = gate_routes[n];
-        if (!gr.empty())
-        {
-            bool any_open = false;
-            for (const auto& r : gr)
-            {
-                if (port_signaled(r))
+                if (!lowered_.IsNodeGuidValid(n))
+                {
+                    (void)lowered_.GetNodeGuid(n); // throws like MakeDasGuid
+                }
+                const auto* pv = frame.Find(be.source_port);
+                if (pv != nullptr && pv->IsSignal())
                 {
-                    any_open = true;
-                    break;
+                    return be.loop_head;
                 }
             }
-            return !any_open;
+            return LoweredGraphPlan::kInvalidNode;
         }
-        // No signal gate: skip-propagation — a data predecessor that was skipped
-        // starves this node.
-        for (const auto& p : data_preds[n])
+
+        // Iteration boundary: clear stale signals, then re-pend head + body.
+        void RestartLoop(NodeIndex head, PortFrame& frame)
         {
-            if (state[p] == NState::Skipped)
+            const auto scc = lowered_.GetLoopScc(head);
+            for (const NodeIndex m : scc)
             {
-                return true;
+                frame.ClearSignalsByNode(lowered_.GetNodeGuid(m));
+            }
+            state_[head] = NState::Pending;
+            for (const NodeIndex m : scc)
+            {
+                state_[m] = NState::Pending;
             }
         }
-        return false;
+
+    private:
+        const LoweredGraphPlan& lowered_;
+        std::vector<NState>     state_;
     };
 
+    using NState = SignalGateState::NState;
+} // namespace
+
+DasResult GraphRuntime::RunSignalGated(
+    const LoweredGraphPlan&              lowered,
+    Das::PluginInterface::IDasStopToken* p_stop_token,
+    PortFrame&                           frame)
+{
+    SignalGateState gates(lowered);
+
     // -- multi-pass scheduling loop -----------------------------------------
     // A single pass walks execution_order once, deciding every node that is
     // ready. When a back-edge fires we restart the pass so the loop head
@@ -740,68 +700,57 @@ DasResult GraphRuntime::RunSignalGated(
     while (progress)
     {
         progress = false;
-        for (const auto& n : plan.execution_order)
+        for (const NodeIndex n : lowered.GetExecutionOrder())
         {
-            if (state[n] != NState::Pending || !can_decide(n))
+            if (gates.Get(n) != NState::Pending || !gates.CanDecide(n))
             {
                 continue;
             }
             progress = true;
 
-            if (should_skip(n))
+            if (gates.ShouldSkip(n, frame))
             {
-                state[n] = NState::Skipped;
+                gates.Set(n, NState::Skipped);
                 continue;
             }
 
-            DAS_CORE_LOG_INFO("Running node = {}", n);
+            const std::string& node_id = lowered.GetNodeId(n);
+            DAS_CORE_LOG_INFO("Running node = {}", node_id);
 
             DasResult hr = CheckStopToken(p_stop_token);
             if (DAS_S_OK != hr)
             {
                 SetError(
                     hr,
-                    DAS_FMT_NS::format("Execution cancelled before node = {}", n));
+                    DAS_FMT_NS::format(
+                        "Execution cancelled before node = {}",
+                        node_id));
                 return hr;
             }
 
-            hr = ExecuteNodeWithComponent(n, p_stop_token, frame, plan);
+            hr = ExecuteNodeWithComponent(
+                n,
+                p_stop_token,
+                frame,
+                frame,
+                lowered);
             if (DAS_S_OK != hr)
             {
                 SetError(
                     hr,
                     DAS_FMT_NS::format(
                         "Node '{}' execution failed: hr = {}",
-                        n,
+                        node_id,
                         static_cast<int>(hr)));
                 return hr;
             }
-            state[n] = NState::Done;
+            gates.Set(n, NState::Done);
 
             // back-edge firing? → loop iteration complete
-            std::string fired_head;
-            for (const auto& be : back_edges_by_source[n])
-            {
-                const auto* pv =
-                    frame.Find(PortKey{guid_of(n), be.source_port_id});
-                if (pv != nullptr && pv->IsSignal())
-                {
-                    fired_head = be.loop_head_node_id;
-                    break;
-                }
-            }
-            if (!fired_head.empty())
+            const NodeIndex fired_head = gates.FiredLoopHead(n, frame);
+            if (fired_head != LoweredGraphPlan::kInvalidNode)
             {
-                // iteration boundary: clear stale signals, then re-pend head + body
-                for (const auto& m : loop_scc[fired_head])
-                {
-                    frame.ClearSignalsByNode(guid_of(m));
-                }
-                state[fired_head] = NState::Pending;
-                for (const auto& m : loop_scc[fired_head])
-                {
-                    state[m] = NState::Pending;
-                }
+                gates.RestartLoop(fired_head, frame);
                 break; // restart pass so the head re-runs in execution order
             }
         }
@@ -811,6 +760,251 @@ DasResult GraphRuntime::RunSignalGated(
     return DAS_S_OK;
 }
 
+// ===========================================================================
+// RunParallel / RunWave — wave-parallel dispatch (opt-in)
+// ===========================================================================
+//
+// Each pass walks execution_order like RunSignalGated, but instead of running
+// a ready node immediately it is queued into the current wave; skip decisions
+// are still applied in-pass. Nodes in one wave are mutually independent: each
+// was decidable while every other wave member was still Pending. A back-edge
+// source closes its wave, so a loop iteration boundary is observed before
+// anything after it in execution_order is dispatched. Pure-data plans take the
+// same path (no gates, no back edges → plain topological waves).
+
+struct GraphRuntime::WorkerPool
+{
+    explicit WorkerPool(std::size_t workers)
+        : workers(workers), pool(static_cast<std::uint32_t>(workers))
+    {
+    }
+
+    std::size_t              workers;
+    exec::static_thread_pool pool;
+};
+
+GraphRuntime::GraphRuntime() = default;
+
+GraphRuntime::~GraphRuntime() = default;
+
+void GraphRuntime::SetParallelExecution(const ParallelExecutionOptions& options)
+{
+    parallel_options_ = options;
+    if (!parallel_options_.enabled)
+    {
+        worker_pool_.reset();
+    }
+}
+
+DasResult GraphRuntime::RunParallel(
+    const LoweredGraphPlan&              lowered,
+    Das::PluginInterface::IDasStopToken* p_stop_token,
+    PortFrame&                           frame)
+{
+    const std::size_t workers =
+        parallel_options_.max_workers != 0
+            ? parallel_options_.max_workers
+            : std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    if (!worker_pool_ || worker_pool_->workers != workers)
+    {
+        worker_pool_ = std::make_unique<WorkerPool>(workers);
+        DAS_CORE_LOG_INFO("Graph worker pool started: workers = {}", workers);
+    }
+
+    SignalGateState        gates(lowered);
+    std::vector<uint8_t>   queued(lowered.NodeCount(), 0);
+    std::vector<NodeIndex> wave;
+
+    bool progress = true;
+    while (progress)
+    {
+        progress = false;
+        wave.clear();
+        for (const NodeIndex n : lowered.GetExecutionOrder())
+        {
+            if (gates.Get(n) != NState::Pending || queued[n] != 0
+                || !gates.CanDecide(n))
+            {
+                continue;
+            }
+            progress = true;
+
+            if (gates.ShouldSkip(n, frame))
+            {
+                gates.Set(n, NState::Skipped);
+                continue;
+            }
+
+            queued[n] = 1;
+            wave.push_back(n);
+            if (!lowered.GetBackEdgesFrom(n).empty())
+            {
+                break; // loop terminal: decide the iteration boundary first
+            }
+        }
+        if (wave.empty())
+        {
+            continue;
+        }
+
+        DasResult hr = RunWave(wave, lowered, p_stop_token, frame);
+        if (DAS_S_OK != hr)
+        {
+            return hr;
+        }
+        for (const NodeIndex n : wave)
+        {
+            queued[n] = 0;
+            gates.Set(n, NState::Done);
+        }
+
+        // Only the last wave member can carry a back edge.
+        const NodeIndex fired_head = gates.FiredLoopHead(wave.back(), frame);
+        if (fired_head != LoweredGraphPlan::kInvalidNode)
+        {
+            gates.RestartLoop(fired_head, frame);
+        }
+    }
+
+    DAS_CORE_LOG_INFO("RunParallel complete");
+    return DAS_S_OK;
+}
+
+DasResult GraphRuntime::RunWave(
+    const std::vector<LoweredGraphPlan::NodeIndex>& wave,
+    const LoweredGraphPlan&                         lowered,
+    Das::PluginInterface::IDasStopToken*            p_stop_token,
+    PortFrame&                                      frame)
+{
+    DasResult hr = CheckStopToken(p_stop_token);
+    if (DAS_S_OK != hr)
+    {
+        SetError(
+            hr,
+            DAS_FMT_NS::format(
+                "Execution cancelled before node = {}",
+                lowered.GetNodeId(wave.front())));
+        return hr;
+    }
+
+    struct NodeRun
+    {
+        PortFrame          outputs;
+        DasResult          result = DAS_S_OK;
+        bool               cancelled = false;
+        std::exception_ptr error;
+    };
+    std::vector<NodeRun> runs(wave.size());
+
+    // Never throws: results and exceptions are reported back to this thread.
+    // Reads `frame` only — nothing writes it until the wave has drained.
+    auto run_one = [&](std::size_t i) noexcept
+    {
+        auto& run = runs[i];
+        try
+        {
+            DAS_CORE_LOG_INFO("Running node = {}", lowered.GetNodeId(wave[i]));
+            run.result = CheckStopToken(p_stop_token);
+            if (DAS_S_OK != run.result)
+            {
+                run.cancelled = true;
+                return;
+            }
+            run.result = ExecuteNodeWithComponent(
+                wave[i],
+                p_stop_token,
+                frame,
+                run.outputs,
+                lowered);
+        }
+        catch (...)
+        {
+            run.error = std::current_exception();
+        }
+    };
+
+    auto is_thread_safe = [&](NodeIndex n)
+    {
+        const NodeComponentEntry* p_entry = n < node_component_slots_.size()
+                                                ? node_component_slots_[n]
+                                                : nullptr;
+        return p_entry != nullptr && p_entry->thread_safe;
+    };
+
+    std::vector<std::size_t> pooled;
+    if (wave.size() > 1)
+    {
+        for (std::size_t i = 0; i < wave.size(); ++i)
+        {
+            if (is_thread_safe(wave[i]))
+            {
+                pooled.push_back(i);
+            }
+        }
+    }
+
+    std::latch pooled_done(static_cast<std::ptrdiff_t>(pooled.size()));
+    auto       scheduler = worker_pool_->pool.get_scheduler();
+    for (const std::size_t i : pooled)
+    {
+        stdexec::start_detached(
+            stdexec::schedule(scheduler)
+            | stdexec::then(
+                [&run_one, &pooled_done, i]() noexcept
+                {
+                    run_one(i);
+                    pooled_done.count_down();
+                }));
+    }
+
+    // Components not declared thread-safe stay serialized on this thread.
+    std::size_t next_pooled = 0;
+    for (std::size_t i = 0; i < wave.size(); ++i)
+    {
+        if (next_pooled < pooled.size() && pooled[next_pooled] == i)
+        {
+            ++next_pooled;
+            continue;
+        }
+        run_one(i);
+    }
+    pooled_done.wait();
+
+    // Publish in wave (execution) order; the first failure wins.
+    for (std::size_t i = 0; i < wave.size(); ++i)
+    {
+        auto&              run = runs[i];
+        const std::string& node_id = lowered.GetNodeId(wave[i]);
+        if (run.error)
+        {
+            std::rethrow_exception(run.error);
+        }
+        if (run.cancelled)
+        {
+            SetError(
+                run.result,
+                DAS_FMT_NS::format(
+                    "Execution cancelled before node = {}",
+                    node_id));
+            return run.result;
+        }
+        if (DAS_S_OK != run.result)
+        {
+            SetError(
+                run.result,
+                DAS_FMT_NS::format(
+                    "Node '{}' execution failed: hr = {}",
+                    node_id,
+                    static_cast<int>(run.result)));
+            return run.result;
+        }
+        frame.MergeFrom(std::move(run.outputs));
+        DAS_CORE_LOG_TRACE("Node = {} completed successfully", node_id);
+    }
+
+    return DAS_S_OK;
+}
+
 // ===========================================================================
 // RunWithHost
 // ===========================================================================
@@ -837,11 +1031,30 @@ DasResult GraphRuntime::RunWithHost(
         return hr;
     }
 
-    // Phase 2: Configure — create components, apply settings (v17 data-sep)
-    hr = Configure(plan, p_host);
-    if (DAS_S_OK != hr)
+    // Phase 2: Configure — create components, apply settings (v17 data-sep).
+    // Components from the previous successful run are kept while the host and
+    // the configuration key are unchanged. The key is only re-armed once this
+    // run succeeds, so a failed or cancelled run (which may leave a component
+    // mid-loop) always forces a fresh Configure next time.
+    std::string configuration_key = MakeConfigurationKey(plan);
+    const bool  reuse_components = configured_ && !configuration_key.empty()
+                                  && configuration_key == configured_key_
+                                  && configured_host_.Get() == p_host;
+    configured_key_.clear();
+    if (reuse_components)
     {
-        return hr;
+        DAS_CORE_LOG_TRACE(
+            "Reusing {} configured nodes: compiled_fingerprint = {}",
+            node_components_.size(),
+            plan.compiled_fingerprint);
+    }
+    else
+    {
+        hr = Configure(plan, p_host);
+        if (DAS_S_OK != hr)
+        {
+            return hr;
+        }
     }
 
     // Phase 3: Prepare — validate all components ready
@@ -855,16 +1068,30 @@ DasResult GraphRuntime::RunWithHost(
     // execution.  TODO: Wire cache into ExecuteNodeWithComponent when
     // slot-based data transfer is implemented.
 
-    // Phase 5: Create fresh PortFrame
-    PortFrame frame;
-
-    // Phase 6: Execute. Pure-data graphs (no signal routes, no back edges) use
-    // the original linear execution_order walk — unchanged behaviour. Graphs
-    // with control flow use the signal-driven ready queue (DAS-60 Stage 3).
-    if (plan.signal_routes.empty() && plan.back_edges.empty())
+    // Phase 5: Create fresh PortFrame; reuse the lowered plan while the
+    // compiled_fingerprint is unchanged and bind this run's components to it.
+    PortFrame   frame;
+    const auto& lowered = GetLoweredPlan(plan);
+    BindNodeComponentSlots(lowered);
+
+    // Phase 6: Execute. With parallel execution enabled every plan goes
+    // through the wave scheduler. Otherwise pure-data graphs (no signal
+    // routes, no back edges) use the original linear execution_order walk —
+    // unchanged behaviour — and graphs with control flow use the
+    // signal-driven ready queue (DAS-60 Stage 3).
+    if (parallel_options_.enabled)
+    {
+        hr = RunParallel(lowered, p_stop_token, frame);
+        if (DAS_S_OK != hr)
+        {
+            return hr;
+        }
+    }
+    else if (!lowered.HasControlFlow())
     {
-        for (const auto& node_id : plan.execution_order)
+        for (const auto node : lowered.GetExecutionOrder())
         {
+            const std::string& node_id = lowered.GetNodeId(node);
             DAS_CORE_LOG_INFO("Running node = {}", node_id);
 
             hr = CheckStopToken(p_stop_token);
@@ -878,7 +1105,12 @@ DasResult GraphRuntime::RunWithHost(
                 return hr;
             }
 
-            hr = ExecuteNodeWithComponent(node_id, p_stop_token, frame, plan);
+            hr = ExecuteNodeWithComponent(
+                node,
+                p_stop_token,
+                frame,
+                frame,
+                lowered);
             if (DAS_S_OK != hr)
             {
                 SetError(
@@ -895,7 +1127,7 @@ DasResult GraphRuntime::RunWithHost(
     }
     else
     {
-        hr = RunSignalGated(plan, p_stop_token, frame);
+        hr = RunSignalGated(lowered, p_stop_token, frame);
         if (DAS_S_OK != hr)
         {
             return hr;
@@ -914,6 +1146,8 @@ DasResult GraphRuntime::RunWithHost(
         "RunWithHost complete: {} nodes processed",
         plan.execution_order.size());
 
+    configured_key_ = std::move(configuration_key);
+    configured_host_ = p_host;
     return DAS_S_OK;
 }
 
@@ -10,15 +10,21 @@
 #include <das/Utils/DasJsonCore.h>
 #include <cpp_yyjson.hpp>
 #include <new>
+#include <string_view>
 
 DAS_CORE_GRAPHRUNTIME_NS_BEGIN
 
 // --- GraphRuntimeImpl implementation ---
 
 GraphRuntimeImpl::GraphRuntimeImpl(
-    Das::PluginInterface::IDasTaskComponentHost* p_host)
+    Das::PluginInterface::IDasTaskComponentHost* p_host,
+    const ParallelExecutionOptions&              parallel)
     : host_(p_host)
 {
+    if (parallel.enabled)
+    {
+        engine_.SetParallelExecution(parallel);
+    }
 }
 
 DasResult GraphRuntimeImpl::GetErrorMessage(
@@ -45,8 +51,10 @@ DasResult GraphRuntimeImpl::Execute(
     }
     *pp_out_result_json = nullptr;
 
-    // Parse compiled graph plan from JSON string.
-    Dto::CompiledGraphPlanDto plan;
+    // Parse compiled graph plan from JSON string. The previous artifact's
+    // parse is reused when the text is unchanged.
+    const Dto::CompiledGraphPlanDto  empty_plan;
+    const Dto::CompiledGraphPlanDto* p_plan = &empty_plan;
     if (p_compiled_artifact_json)
     {
         const char* utf8 = nullptr;
@@ -58,18 +66,31 @@ DasResult GraphRuntimeImpl::Execute(
             return DAS_E_INVALID_POINTER;
         }
 
-        std::string json_str(utf8);
+        const std::string_view json_str(utf8);
         if (!json_str.empty())
         {
-            auto doc = yyjson::read(json_str);
-            plan = yyjson::cast<Dto::CompiledGraphPlanDto>(doc);
+            if (json_str != cached_artifact_json_)
+            {
+                std::string json_copy(json_str);
+                auto        doc = yyjson::read(json_copy);
+                cached_plan_ = yyjson::cast<Dto::CompiledGraphPlanDto>(doc);
+                cached_artifact_json_ = std::move(json_copy);
+            }
+            else
+            {
+                DAS_CORE_LOG_TRACE(
+                    "Execute: reusing parsed plan, compiled_fingerprint = {}",
+                    cached_plan_.compiled_fingerprint);
+            }
+            p_plan = &cached_plan_;
         }
     }
 
     // Execute via engine.
+    last_error_.clear();
     DasResult result = engine_.RunWithHost(
-        plan,
-        plan.compiled_fingerprint,
+        *p_plan,
+        p_plan->compiled_fingerprint,
         p_stop_token,
         host_.Get());
 
@@ -143,6 +164,38 @@ DAS_C_API DasResult CreateGraphRuntimeWithHost(
     }
 }
 
+DAS_C_API DasResult CreateGraphRuntimeWithOptions(
+    Das::PluginInterface::IDasTaskComponentHost* p_host,
+    DasBool                                      parallel_execution,
+    size_t                                       max_workers,
+    Das::ExportInterface::IDasGraphRuntime**     pp_out_runtime)
+{
+    if (!pp_out_runtime)
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+    if (!p_host)
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+
+    try
+    {
+        const Das::Core::GraphRuntime::ParallelExecutionOptions parallel{
+            static_cast<bool>(parallel_execution),
+            max_workers};
+        auto* impl =
+            new Das::Core::GraphRuntime::GraphRuntimeImpl{p_host, parallel};
+        impl->AddRef();
+        *pp_out_runtime = impl;
+        return DAS_S_OK;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return DAS_E_OUT_OF_MEMORY;
+    }
+}
+
 
 // ============================================================================
 // Stateful authoring session C ABI (DAS-77)
@@ -0,0 +1,357 @@
+#include <das/Core/GraphRuntime/LoweredGraphPlan.h>
+
+#include <das/Core/Exceptions/InvalidGuidStringException.h>
+#include <das/Core/ForeignInterfaceHost/DasGuid.h>
+#include <das/Core/Logger/Logger.h>
+
+#include <deque>
+#include <string_view>
+#include <tuple>
+#include <unordered_set>
+
+DAS_CORE_GRAPHRUNTIME_NS_BEGIN
+
+namespace
+{
+    // Sentinel source marking a broadcast (graph-input) binding — not a real
+    // node, so it creates no data dependency. Must match GraphCompiler.
+    constexpr std::string_view kBroadcastSource = "$graph_input";
+
+    using Das::Core::ForeignInterfaceHost::DasStringAtom;
+
+    using EdgeKey =
+        std::tuple<std::string, std::string, std::string, std::string>;
+
+    struct EdgeKeyHash
+    {
+        std::size_t operator()(const EdgeKey& k) const noexcept
+        {
+            std::size_t seed = 0xcbf29ce484222325ULL;
+            auto        mix = [&](const std::string& s)
+            {
+                seed ^= std::hash<std::string>{}(s) + 0x9e3779b9 + (seed << 6)
+                        + (seed >> 2);
+            };
+            mix(std::get<0>(k));
+            mix(std::get<1>(k));
+            mix(std::get<2>(k));
+            mix(std::get<3>(k));
+            return seed;
+        }
+    };
+
+    inline EdgeKey MakeEdgeKey(
+        const std::string& sn,
+        const std::string& sp,
+        const std::string& tn,
+        const std::string& tp)
+    {
+        return std::make_tuple(sn, sp, tn, tp);
+    }
+
+    // Flatten per-node buckets into CSR offsets + values.
+    template <typename T>
+    void FlattenBuckets(
+        std::vector<std::vector<T>>& buckets,
+        std::vector<uint32_t>&       offsets,
+        std::vector<T>&              values)
+    {
+        offsets.assign(buckets.size() + 1, 0);
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < buckets.size(); ++i)
+        {
+            offsets[i] = static_cast<uint32_t>(total);
+            total += buckets[i].size();
+        }
+        offsets[buckets.size()] = static_cast<uint32_t>(total);
+
+        values.clear();
+        values.reserve(total);
+        for (auto& bucket : buckets)
+        {
+            for (auto& v : bucket)
+            {
+                values.push_back(std::move(v));
+            }
+        }
+    }
+} // namespace
+
+LoweredGraphPlan::NodeIndex LoweredGraphPlan::FindNode(
+    const std::string& node_id) const
+{
+    auto it = node_index_.find(node_id);
+    return it == node_index_.end() ? kInvalidNode : it->second;
+}
+
+DasGuid LoweredGraphPlan::GetNodeGuid(NodeIndex node) const
+{
+    if (node_guid_valid_[node] != 0)
+    {
+        return node_guids_[node];
+    }
+    return Das::Core::ForeignInterfaceHost::MakeDasGuid(node_ids_[node]);
+}
+
+LoweredGraphPlan LoweredGraphPlan::Lower(const Dto::CompiledGraphPlanDto& plan)
+{
+    LoweredGraphPlan lowered;
+    lowered.compiled_fingerprint_ = plan.compiled_fingerprint;
+    lowered.has_control_flow_ =
+        !plan.signal_routes.empty() || !plan.back_edges.empty();
+
+    // -- node index: execution_order first, then every other referenced id --
+    auto intern = [&lowered](const std::string& id) -> NodeIndex
+    {
+        auto [it, inserted] = lowered.node_index_.try_emplace(
+            id,
+            static_cast<NodeIndex>(lowered.node_ids_.size()));
+        if (inserted)
+        {
+            lowered.node_ids_.push_back(id);
+        }
+        return it->second;
+    };
+
+    lowered.execution_order_.reserve(plan.execution_order.size());
+    for (const auto& n : plan.execution_order)
+    {
+        lowered.execution_order_.push_back(intern(n));
+    }
+    const std::size_t scheduled_count = lowered.node_ids_.size();
+
+    for (const auto& b : plan.binding_plan.bindings)
+    {
+        if (b.source_node_id != kBroadcastSource)
+        {
+            intern(b.source_node_id);
+        }
+        intern(b.target_node_id);
+    }
+    for (const auto& r : plan.signal_routes)
+    {
+        intern(r.source_node_id);
+        intern(r.target_node_id);
+    }
+    for (const auto& be : plan.back_edges)
+    {
+        intern(be.source_node_id);
+        intern(be.loop_head_node_id);
+    }
+
+    const std::size_t node_count = lowered.node_ids_.size();
+
+    lowered.node_guids_.resize(node_count);
+    lowered.node_guid_valid_.assign(node_count, 0);
+    for (std::size_t i = 0; i < node_count; ++i)
+    {
+        try
+        {
+            lowered.node_guids_[i] =
+                Das::Core::ForeignInterfaceHost::MakeDasGuid(
+                    lowered.node_ids_[i]);
+            lowered.node_guid_valid_[i] = 1;
+        }
+        catch (const Das::Core::Exceptions::InvalidGuidStringSizeException&)
+        {
+        }
+        catch (const Das::Core::Exceptions::InvalidGuidStringException&)
+        {
+        }
+    }
+
+    // -- edge classification: signal edges vs back edges (4-tuples) ---------
+    std::unordered_set<EdgeKey, EdgeKeyHash> signal_edge_keys;
+    std::unordered_set<EdgeKey, EdgeKeyHash> back_edge_keys;
+    for (const auto& r : plan.signal_routes)
+    {
+        signal_edge_keys.insert(MakeEdgeKey(
+            r.source_node_id,
+            r.source_port_id,
+            r.target_node_id,
+            r.target_port_id));
+    }
+    for (const auto& be : plan.back_edges)
+    {
+        back_edge_keys.insert(MakeEdgeKey(
+            be.source_node_id,
+            be.source_port_id,
+            be.target_node_id,
+            be.target_port_id));
+    }
+
+    // -- input bindings + data dependencies ---------------------------------
+    std::vector<std::vector<InputBinding>> input_bindings(node_count);
+    std::vector<std::vector<NodeIndex>>    data_preds(node_count);
+    for (const auto& b : plan.binding_plan.bindings)
+    {
+        const NodeIndex tgt = lowered.node_index_.at(b.target_node_id);
+        InputBinding    input{.target_port = DasStringAtom{b.target_port_id}};
+
+        // Broadcast bindings and signal edges carry no node-level data
+        // dependency.
+        if (b.source_node_id == kBroadcastSource)
+        {
+            input.broadcast = true;
+            input.default_value = b.default_value;
+            input_bindings[tgt].push_back(std::move(input));
+            continue;
+        }
+
+        // An unparsable source id keeps the all-zero GUID, like gate routes:
+        // such a node never writes the frame, so the lookup simply misses.
+        const NodeIndex src = lowered.node_index_.at(b.source_node_id);
+        input.source_port =
+            PortKey{lowered.node_guids_[src], DasStringAtom{b.source_port_id}};
+        input_bindings[tgt].push_back(std::move(input));
+
+        if (signal_edge_keys.count(MakeEdgeKey(
+                b.source_node_id,
+                b.source_port_id,
+                b.target_node_id,
+                b.target_port_id))
+            > 0)
+        {
+            continue;
+        }
+        data_preds[tgt].push_back(src);
+    }
+    FlattenBuckets(
+        input_bindings,
+        lowered.input_binding_offsets_,
+        lowered.input_bindings_);
+
+    // -- gate routes (non-back-edge signal routes) --------------------------
+    std::vector<std::vector<GateRoute>> gates(node_count);
+    for (const auto& r : plan.signal_routes)
+    {
+        // Back-edges re-activate the loop head via the pass restart; they are
+        // NOT gates the head must wait on (the head runs first each pass).
+        if (back_edge_keys.count(MakeEdgeKey(
+                r.source_node_id,
+                r.source_port_id,
+                r.target_node_id,
+                r.target_port_id))
+            > 0)
+        {
+            continue;
+        }
+        const NodeIndex src = lowered.node_index_.at(r.source_node_id);
+        gates[lowered.node_index_.at(r.target_node_id)].push_back(
+            GateRoute{
+                src,
+                PortKey{
+                    lowered.node_guids_[src],
+                    DasStringAtom{r.source_port_id}}});
+    }
+
+    // -- back edges by source + loop heads ----------------------------------
+    std::vector<std::vector<BackEdge>> back_edges(node_count);
+    std::vector<NodeIndex>             loop_heads;
+    std::vector<uint8_t>               is_loop_head(node_count, 0);
+    for (const auto& be : plan.back_edges)
+    {
+        const NodeIndex src = lowered.node_index_.at(be.source_node_id);
+        const NodeIndex head = lowered.node_index_.at(be.loop_head_node_id);
+        back_edges[src].push_back(
+            BackEdge{
+                PortKey{
+                    lowered.node_guids_[src],
+                    DasStringAtom{be.source_port_id}},
+                head});
+        if (is_loop_head[head] == 0)
+        {
+            is_loop_head[head] = 1;
+            loop_heads.push_back(head);
+        }
+    }
+
+    // -- unified adjacency (data + every signal route incl. back-edges) -----
+    std::vector<std::vector<NodeIndex>> fwd_buckets(node_count);
+    std::vector<std::vector<NodeIndex>> bwd_buckets(node_count);
+    for (std::size_t tgt = 0; tgt < node_count; ++tgt)
+    {
+        for (const NodeIndex p : data_preds[tgt])
+        {
+            fwd_buckets[p].push_back(static_cast<NodeIndex>(tgt));
+            bwd_buckets[tgt].push_back(p);
+        }
+    }
+    for (const auto& r : plan.signal_routes)
+    {
+        const NodeIndex src = lowered.node_index_.at(r.source_node_id);
+        const NodeIndex tgt = lowered.node_index_.at(r.target_node_id);
+        fwd_buckets[src].push_back(tgt);
+        bwd_buckets[tgt].push_back(src);
+    }
+    std::vector<uint32_t>  fwd_offsets, bwd_offsets;
+    std::vector<NodeIndex> fwd_adj, bwd_adj;
+    FlattenBuckets(fwd_buckets, fwd_offsets, fwd_adj);
+    FlattenBuckets(bwd_buckets, bwd_offsets, bwd_adj);
+
+    // Reachability scoped to scheduled nodes (indices < scheduled_count).
+    auto reach = [&](NodeIndex                     start,
+                     const std::vector<uint32_t>&  offsets,
+                     const std::vector<NodeIndex>& adj)
+    {
+        std::vector<uint8_t>  seen(node_count, 0);
+        std::deque<NodeIndex> q{start};
+        seen[start] = 1;
+        while (!q.empty())
+        {
+            const NodeIndex u = q.front();
+            q.pop_front();
+            for (uint32_t i = offsets[u]; i < offsets[u + 1]; ++i)
+            {
+                const NodeIndex v = adj[i];
+                if (v >= scheduled_count || seen[v] != 0)
+                {
+                    continue;
+                }
+                seen[v] = 1;
+                q.push_back(v);
+            }
+        }
+        return seen;
+    };
+
+    // Per-loop-head reset set = the SCC containing the head
+    // (forward-reachable ∩ backward-reachable).
+    std::vector<std::vector<NodeIndex>> scc_buckets(node_count);
+    for (const NodeIndex head : loop_heads)
+    {
+        const auto fr = reach(head, fwd_offsets, fwd_adj);
+        const auto br = reach(head, bwd_offsets, bwd_adj);
+        for (std::size_t n = 0; n < node_count; ++n)
+        {
+            if (fr[n] != 0 && br[n] != 0)
+            {
+                scc_buckets[head].push_back(static_cast<NodeIndex>(n));
+            }
+        }
+    }
+
+    FlattenBuckets(data_preds, lowered.data_pred_offsets_, lowered.data_preds_);
+    FlattenBuckets(gates, lowered.gate_offsets_, lowered.gate_routes_);
+    FlattenBuckets(
+        back_edges,
+        lowered.back_edge_offsets_,
+        lowered.back_edges_);
+    FlattenBuckets(
+        scc_buckets,
+        lowered.loop_scc_offsets_,
+        lowered.loop_scc_nodes_);
+
+    DAS_CORE_LOG_TRACE(
+        "Lowered graph plan: compiled_fingerprint = {}, nodes = {}, "
+        "data edges = {}, gates = {}, loop heads = {}",
+        lowered.compiled_fingerprint_,
+        node_count,
+        lowered.data_preds_.size(),
+        lowered.gate_routes_.size(),
+        loop_heads.size());
+
+    return lowered;
+}
+
+DAS_CORE_GRAPHRUNTIME_NS_END
@@ -155,7 +155,8 @@ bool PortKey::operator!=(const PortKey& other) const noexcept
 std::size_t PortKeyHash::operator()(const PortKey& key) const noexcept
 {
     auto h1 = std::hash<DasGuid>{}(key.node_id);
-    auto h2 = std::hash<std::string>{}(key.port_id);
+    auto h2 = std::hash<Das::Core::ForeignInterfaceHost::DasStringAtom>{}(
+        key.port_id);
     h1 ^= h2 + 0x9e3779b9 + (h1 << 6) + (h1 >> 2);
     return h1;
 }
@@ -169,9 +170,12 @@ void PortFrame::Set(const PortKey& key, PortValue value)
     entries_.insert_or_assign(key, std::move(value));
 }
 
-void PortFrame::Set(DasGuid node_id, std::string port_id, PortValue value)
+void PortFrame::Set(
+    DasGuid                                        node_id,
+    Das::Core::ForeignInterfaceHost::DasStringAtom port_id,
+    PortValue                                      value)
 {
-    Set(PortKey{node_id, std::move(port_id)}, std::move(value));
+    Set(PortKey{node_id, port_id}, std::move(value));
 }
 
 bool PortFrame::Remove(const PortKey& key) { return entries_.erase(key) > 0; }
@@ -196,6 +200,15 @@ std::size_t PortFrame::ClearSignalsByNode(DasGuid node_id)
     return removed;
 }
 
+void PortFrame::MergeFrom(PortFrame&& staged)
+{
+    for (auto& [key, value] : staged.entries_)
+    {
+        entries_.insert_or_assign(key, std::move(value));
+    }
+    staged.entries_.clear();
+}
+
 const PortValue* PortFrame::Find(const PortKey& key) const noexcept
 {
     auto it = entries_.find(key);
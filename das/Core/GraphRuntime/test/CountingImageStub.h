@@ -0,0 +1,96 @@
+#ifndef DAS_CORE_GRAPHRUNTIME_TEST_COUNTINGIMAGESTUB_H
+#define DAS_CORE_GRAPHRUNTIME_TEST_COUNTINGIMAGESTUB_H
+
+#include <das/DasApi.h>
+#include <das/_autogen/idl/abi/IDasImage.h>
+#include <das/_autogen/idl/wrapper/Das.ExportInterface.IDasImage.Implements.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+// IDasImage test double that owns no pixels: it reports a fixed geometry and
+// counts how many bytes callers materialised through GetBinaryBuffer. Used to
+// assert that images travel through PortFrame/DoAdapter by reference.
+class CountingImageStub final
+    : public Das::ExportInterface::DasImageImplBase<CountingImageStub>
+{
+public:
+    CountingImageStub(int32_t width, int32_t height, int32_t channels)
+        : width_(width), height_(height), channels_(channels)
+    {
+    }
+
+    [[nodiscard]]
+    uint64_t DataSize() const noexcept
+    {
+        return static_cast<uint64_t>(width_) * height_ * channels_;
+    }
+
+    // Bytes handed out through GetBinaryBuffer (i.e. pixel reads/copies).
+    std::atomic<uint64_t> materialized_bytes{0};
+
+    DAS_IMPL GetSize(Das::ExportInterface::DasSize* p_out_size) override
+    {
+        if (p_out_size == nullptr)
+        {
+            return DAS_E_INVALID_POINTER;
+        }
+        *p_out_size = {width_, height_};
+        return DAS_S_OK;
+    }
+
+    DAS_IMPL GetChannelCount(int32_t* p_out_channel_count) override
+    {
+        if (p_out_channel_count == nullptr)
+        {
+            return DAS_E_INVALID_POINTER;
+        }
+        *p_out_channel_count = channels_;
+        return DAS_S_OK;
+    }
+
+    DAS_IMPL Clip(
+        const Das::ExportInterface::DasRect* p_rect,
+        Das::ExportInterface::IDasImage**    p_out_image) override
+    {
+        (void)p_rect;
+        (void)p_out_image;
+        return DAS_E_NO_IMPLEMENTATION;
+    }
+
+    DAS_IMPL GetDataSize(uint64_t* p_out_size) override
+    {
+        if (p_out_size == nullptr)
+        {
+            return DAS_E_INVALID_POINTER;
+        }
+        *p_out_size = DataSize();
+        return DAS_S_OK;
+    }
+
+    DAS_IMPL GetBinaryBuffer(
+        Das::ExportInterface::IDasBinaryBuffer** pp_out_buffer) override
+    {
+        (void)pp_out_buffer;
+        materialized_bytes += DataSize();
+        return DAS_E_NO_IMPLEMENTATION;
+    }
+
+    DAS_IMPL GetPixelFormat(
+        Das::ExportInterface::DasImagePixelFormat* p_out_format) override
+    {
+        if (p_out_format == nullptr)
+        {
+            return DAS_E_INVALID_POINTER;
+        }
+        *p_out_format = Das::ExportInterface::DAS_PIXEL_FORMAT_BGR;
+        return DAS_S_OK;
+    }
+
+private:
+    int32_t width_;
+    int32_t height_;
+    int32_t channels_;
+};
+
+#endif // DAS_CORE_GRAPHRUNTIME_TEST_COUNTINGIMAGESTUB_H
@@ -1,6 +1,10 @@
 #include <das/Core/GraphRuntime/DoAdapter.h>
 
+#include "CountingImageStub.h"
+
 #include <das/Core/ForeignInterfaceHost/DasGuid.h>
+#include <das/Core/ForeignInterfaceHost/DasStringAtom.h>
+#include <das/Core/GraphRuntime/LoweredGraphPlan.h>
 #include <das/DasPtr.hpp>
 #include <das/DasString.hpp>
 #include <das/Utils/DasJsonCore.h>
@@ -43,6 +47,13 @@ namespace
         return b;
     }
 
+    PortKey Key(const DasGuid& node, const std::string& port)
+    {
+        return PortKey{
+            node,
+            Das::Core::ForeignInterfaceHost::DasStringAtom{port}};
+    }
+
     std::string GuidToString(DasGuid guid)
     {
         return Das::Core::ForeignInterfaceHost::DasGuidToStdString(guid);
@@ -81,7 +92,7 @@ namespace
 TEST(DoAdapterTest, BuildInputPortMap_IntValue)
 {
     PortFrame frame;
-    frame.Set(kSourceNode, "out", PortValue(int64_t{42}));
+    frame.Set(Key(kSourceNode, "out"), PortValue(int64_t{42}));
 
     auto bindings = {MakeBinding(GuidToString(kSourceNode), "out", "in")};
 
@@ -98,7 +109,7 @@ TEST(DoAdapterTest, BuildInputPortMap_IntValue)
 TEST(DoAdapterTest, BuildInputPortMap_FloatValue)
 {
     PortFrame frame;
-    frame.Set(kSourceNode, "out", PortValue(3.14));
+    frame.Set(Key(kSourceNode, "out"), PortValue(3.14));
 
     auto bindings = {MakeBinding(GuidToString(kSourceNode), "out", "in")};
 
@@ -114,7 +125,7 @@ TEST(DoAdapterTest, BuildInputPortMap_FloatValue)
 TEST(DoAdapterTest, BuildInputPortMap_StringValue)
 {
     PortFrame frame;
-    frame.Set(kSourceNode, "out", PortValue(std::string("hello")));
+    frame.Set(Key(kSourceNode, "out"), PortValue(std::string("hello")));
 
     auto bindings = {MakeBinding(GuidToString(kSourceNode), "out", "in")};
 
@@ -135,7 +146,7 @@ TEST(DoAdapterTest, BuildInputPortMap_StringValue)
 TEST(DoAdapterTest, BuildInputPortMap_BoolValue)
 {
     PortFrame frame;
-    frame.Set(kSourceNode, "out", PortValue(true));
+    frame.Set(Key(kSourceNode, "out"), PortValue(true));
 
     auto bindings = {MakeBinding(GuidToString(kSourceNode), "out", "in")};
 
@@ -151,7 +162,7 @@ TEST(DoAdapterTest, BuildInputPortMap_BoolValue)
 TEST(DoAdapterTest, BuildInputPortMap_SignalValue)
 {
     PortFrame frame;
-    frame.Set(kSourceNode, "out", PortValue::Signal());
+    frame.Set(Key(kSourceNode, "out"), PortValue::Signal());
 
     auto bindings = {MakeBinding(GuidToString(kSourceNode), "out", "in")};
 
@@ -173,9 +184,9 @@ TEST(DoAdapterTest, BuildInputPortMap_SignalValue)
 TEST(DoAdapterTest, BuildInputPortMap_MultipleBindings)
 {
     PortFrame frame;
-    frame.Set(kSourceNode, "out_a", PortValue(int64_t{10}));
-    frame.Set(kSourceNode, "out_b", PortValue(std::string("world")));
-    frame.Set(kOtherNode, "result", PortValue(2.5));
+    frame.Set(Key(kSourceNode, "out_a"), PortValue(int64_t{10}));
+    frame.Set(Key(kSourceNode, "out_b"), PortValue(std::string("world")));
+    frame.Set(Key(kOtherNode, "result"), PortValue(2.5));
 
     auto bindings = {
         MakeBinding(GuidToString(kSourceNode), "out_a", "in_x"),
@@ -251,7 +262,7 @@ TEST(DoAdapterTest, BuildInputPortMap_MissingSourcePort)
 TEST(DoAdapterTest, BuildInputPortMap_NullValueSkipped)
 {
     PortFrame frame;
-    frame.Set(kSourceNode, "out", PortValue());
+    frame.Set(Key(kSourceNode, "out"), PortValue());
 
     auto bindings = {MakeBinding(GuidToString(kSourceNode), "out", "in")};
 
@@ -374,7 +385,7 @@ TEST(DoAdapterTest, BuildInputPortMap_BroadcastAndPointToPointCoexist)
     // A node may receive both a normal data edge and a graph-input broadcast;
     // both must land in the input map.
     PortFrame frame;
-    frame.Set(kSourceNode, "out", PortValue(int64_t{7}));
+    frame.Set(Key(kSourceNode, "out"), PortValue(int64_t{7}));
 
     std::vector<Dto::PortBindingDto> bindings = {
         MakeBinding(GuidToString(kSourceNode), "out", "in_data"),
@@ -410,7 +421,7 @@ TEST(DoAdapterTest, ExtractOutputPortMap_IntValue)
     PortFrame frame;
     ASSERT_EQ(ExtractOutputPortMap(map.Get(), kTargetNode, frame), DAS_S_OK);
 
-    const auto* pv = frame.Find({kTargetNode, "out"});
+    const auto* pv = frame.Find(Key(kTargetNode, "out"));
     ASSERT_NE(pv, nullptr);
     ASSERT_TRUE(pv->IsInt());
     EXPECT_EQ(*pv->AsInt(), 99);
@@ -427,7 +438,7 @@ TEST(DoAdapterTest, ExtractOutputPortMap_FloatValue)
     PortFrame frame;
     ASSERT_EQ(ExtractOutputPortMap(map.Get(), kTargetNode, frame), DAS_S_OK);
 
-    const auto* pv = frame.Find({kTargetNode, "out"});
+    const auto* pv = frame.Find(Key(kTargetNode, "out"));
     ASSERT_NE(pv, nullptr);
     ASSERT_TRUE(pv->IsFloat());
     EXPECT_DOUBLE_EQ(*pv->AsFloat(), 1.23);
@@ -445,7 +456,7 @@ TEST(DoAdapterTest, ExtractOutputPortMap_StringValue)
     PortFrame frame;
     ASSERT_EQ(ExtractOutputPortMap(map.Get(), kTargetNode, frame), DAS_S_OK);
 
-    const auto* pv = frame.Find({kTargetNode, "out"});
+    const auto* pv = frame.Find(Key(kTargetNode, "out"));
     ASSERT_NE(pv, nullptr);
     ASSERT_TRUE(pv->IsString());
     EXPECT_EQ(*pv->AsString(), "test_str");
@@ -462,7 +473,7 @@ TEST(DoAdapterTest, ExtractOutputPortMap_BoolValue)
     PortFrame frame;
     ASSERT_EQ(ExtractOutputPortMap(map.Get(), kTargetNode, frame), DAS_S_OK);
 
-    const auto* pv = frame.Find({kTargetNode, "out"});
+    const auto* pv = frame.Find(Key(kTargetNode, "out"));
     ASSERT_NE(pv, nullptr);
     ASSERT_TRUE(pv->IsBool());
     EXPECT_TRUE(*pv->AsBool());
@@ -481,12 +492,12 @@ TEST(DoAdapterTest, ExtractOutputPortMap_MultipleEntries)
     PortFrame frame;
     ASSERT_EQ(ExtractOutputPortMap(map.Get(), kTargetNode, frame), DAS_S_OK);
 
-    const auto* pv_a = frame.Find({kTargetNode, "a"});
+    const auto* pv_a = frame.Find(Key(kTargetNode, "a"));
     ASSERT_NE(pv_a, nullptr);
     ASSERT_TRUE(pv_a->IsInt());
     EXPECT_EQ(*pv_a->AsInt(), 10);
 
-    const auto* pv_b = frame.Find({kTargetNode, "b"});
+    const auto* pv_b = frame.Find(Key(kTargetNode, "b"));
     ASSERT_NE(pv_b, nullptr);
     ASSERT_TRUE(pv_b->IsBool());
     EXPECT_FALSE(*pv_b->AsBool());
@@ -512,8 +523,8 @@ TEST(DoAdapterTest, RoundTrip_IntAndString)
 {
     // Setup: source node has int and string outputs in PortFrame.
     PortFrame frame;
-    frame.Set(kSourceNode, "count", PortValue(int64_t{7}));
-    frame.Set(kSourceNode, "name", PortValue(std::string("alice")));
+    frame.Set(Key(kSourceNode, "count"), PortValue(int64_t{7}));
+    frame.Set(Key(kSourceNode, "name"), PortValue(std::string("alice")));
 
     // Build input map for the target node.
     auto bindings = {
@@ -542,12 +553,89 @@ TEST(DoAdapterTest, RoundTrip_IntAndString)
         ExtractOutputPortMap(output_map.Get(), kTargetNode, out_frame),
         DAS_S_OK);
 
-    const auto* pv = out_frame.Find({kTargetNode, "result"});
+    const auto* pv = out_frame.Find(Key(kTargetNode, "result"));
     ASSERT_NE(pv, nullptr);
     ASSERT_TRUE(pv->IsInt());
     EXPECT_EQ(*pv->AsInt(), 42);
 }
 
+// Images cross the adapter by reference in both directions.
+TEST(DoAdapterTest, RoundTrip_ImageSharesHandle)
+{
+    auto  image = CountingImageStub::Make(1920, 1080, 3);
+    auto* stub = static_cast<CountingImageStub*>(image.Get());
+
+    PortFrame frame;
+    frame.Set(Key(kSourceNode, "frame"), PortValue(ImageData{image}));
+
+    auto bindings = {
+        MakeBinding(GuidToString(kSourceNode), "frame", "image"),
+    };
+
+    DAS::DasPtr<IDasPortMap> input_map;
+    ASSERT_EQ(BuildInputPortMap(frame, bindings, input_map.Put()), DAS_S_OK);
+
+    DAS::DasPtr<Das::ExportInterface::IDasImage> received;
+    DasReadOnlyString                            image_key{"image"};
+    ASSERT_EQ(input_map->GetImage(image_key.Get(), received.Put()), DAS_S_OK);
+    EXPECT_EQ(received.Get(), image.Get());
+
+    DAS::DasPtr<IDasPortMap> output_map;
+    ASSERT_EQ(CreateIDasPortMap(output_map.Put()), DAS_S_OK);
+    DasReadOnlyString out_key{"annotated"};
+    ASSERT_EQ(output_map->SetImage(out_key.Get(), received.Get()), DAS_S_OK);
+
+    PortFrame out_frame;
+    ASSERT_EQ(
+        ExtractOutputPortMap(output_map.Get(), kTargetNode, out_frame),
+        DAS_S_OK);
+
+    const auto* pv = out_frame.Find(Key(kTargetNode, "annotated"));
+    ASSERT_NE(pv, nullptr);
+    ASSERT_TRUE(pv->IsImage());
+    EXPECT_EQ(pv->AsImage()->image.Get(), image.Get());
+    EXPECT_EQ(stub->materialized_bytes.load(), 0u);
+}
+
+// ===========================================================================
+// BuildInputPortMap — lowered bindings reuse atoms interned at lowering time
+// ===========================================================================
+
+TEST(DoAdapterTest, BuildInputPortMap_LoweredBindingsDoNotIntern)
+{
+    Dto::CompiledGraphPlanDto plan;
+    plan.execution_order = {
+        GuidToString(kSourceNode),
+        GuidToString(kTargetNode)};
+    plan.binding_plan.bindings = {
+        MakeBinding(GuidToString(kSourceNode), "lowered_out", "lowered_in")};
+    const auto lowered = LoweredGraphPlan::Lower(plan);
+    const auto bindings =
+        lowered.GetInputBindings(lowered.FindNode(GuidToString(kTargetNode)));
+    ASSERT_EQ(bindings.size(), 1u);
+    EXPECT_EQ(bindings[0].source_port, Key(kSourceNode, "lowered_out"));
+
+    PortFrame frame;
+    frame.Set(bindings[0].source_port, PortValue(int64_t{5}));
+
+    const auto atoms_before =
+        Das::Core::ForeignInterfaceHost::GetStringAtomCount();
+    for (int i = 0; i < 3; ++i)
+    {
+        DAS::DasPtr<IDasPortMap> map;
+        ASSERT_EQ(BuildInputPortMap(frame, bindings, map.Put()), DAS_S_OK);
+
+        int64_t val{};
+        ASSERT_EQ(
+            map->GetInt(bindings[0].target_port.GetString(), &val),
+            DAS_S_OK);
+        EXPECT_EQ(val, 5);
+    }
+    EXPECT_EQ(
+        Das::Core::ForeignInterfaceHost::GetStringAtomCount(),
+        atoms_before);
+}
+
 // ===========================================================================
 // Empty bindings → empty map
 // ===========================================================================
@@ -555,7 +643,7 @@ TEST(DoAdapterTest, RoundTrip_IntAndString)
 TEST(DoAdapterTest, BuildInputPortMap_EmptyBindings)
 {
     PortFrame frame;
-    frame.Set(kSourceNode, "out", PortValue(int64_t{1}));
+    frame.Set(Key(kSourceNode, "out"), PortValue(int64_t{1}));
 
     std::vector<Dto::PortBindingDto> empty_bindings;
 
@@ -256,6 +256,35 @@ TEST(ManifestReadingTest, ReadsMissingFields)
     EXPECT_EQ(ports.outputs.size(), 0u);
 }
 
+TEST(ManifestReadingTest, ThreadSafeFlagReachesNodeSnapshots)
+{
+    const std::string safe_guid = "45454545-4545-4545-4545-454545454545";
+    const std::string plain_guid = "46464646-4646-4646-4646-464646464646";
+
+    StubFactoryManager mgr;
+    auto safe_def = Das::Utils::ParseYyjsonFromString(
+        R"({"inputs":[],"outputs":[],"threadSafe":true})");
+    ASSERT_TRUE(safe_def.has_value());
+    mgr.AddDefinition(safe_guid, *safe_def);
+    mgr.AddDefinition(plain_guid, MakeEmptyDefinition());
+
+    GraphCompiler compiler;
+    compiler.SetFactoryManager(&mgr);
+
+    EXPECT_TRUE(compiler.ReadManifest(safe_guid).thread_safe);
+    EXPECT_FALSE(compiler.ReadManifest(plain_guid).thread_safe);
+
+    GraphDocumentDto doc;
+    doc.nodes = {
+        MakeComponentNode("safe", safe_guid),
+        MakeComponentNode("plain", plain_guid)};
+
+    auto plan = compiler.Compile(doc);
+    ASSERT_EQ(plan.node_snapshots.size(), 2u);
+    EXPECT_TRUE(plan.node_snapshots[0].thread_safe);
+    EXPECT_FALSE(plan.node_snapshots[1].thread_safe);
+}
+
 // ===================================================================
 // Test Suite 2: EdgePortExistenceTest
 // ===================================================================
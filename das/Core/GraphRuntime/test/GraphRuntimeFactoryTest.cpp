@@ -2,12 +2,42 @@
 #include <das/Core/GraphRuntime/GraphRuntimeFactory.h>
 #include <das/DasPtr.hpp>
 #include <das/_autogen/idl/wrapper/Das.PluginInterface.IDasStopToken.Implements.hpp>
+#include <das/_autogen/idl/wrapper/Das.PluginInterface.IDasTaskComponentHost.Implements.hpp>
 #include <gtest/gtest.h>
 
 #include <cstring>
 
 using IDasGraphRuntime = Das::ExportInterface::IDasGraphRuntime;
 
+namespace
+{
+    class NullTaskComponentHost final
+        : public Das::PluginInterface::DasTaskComponentHostImplBase<
+              NullTaskComponentHost>
+    {
+    public:
+        DasResult CreateTaskComponent(
+            const DasGuid&                            component_guid,
+            Das::PluginInterface::IDasTaskComponent** pp_out_component) override
+        {
+            std::ignore = component_guid;
+            if (!pp_out_component)
+                return DAS_E_INVALID_POINTER;
+            *pp_out_component = nullptr;
+            return DAS_E_NOT_FOUND;
+        }
+    };
+
+    const Das::Core::GraphRuntime::ParallelExecutionOptions& ParallelOf(
+        IDasGraphRuntime* p_runtime)
+    {
+        return static_cast<Das::Core::GraphRuntime::GraphRuntimeImpl*>(
+                   p_runtime)
+            ->GetEngine()
+            .GetParallelExecution();
+    }
+} // namespace
+
 // ---- Tests ----
 
 TEST(GraphRuntimeFactoryTest, CreateGraphRuntimeReturnsValidPointer)
@@ -69,3 +99,45 @@ TEST(GraphRuntimeFactoryTest, CCompliance_CreateGraphRuntime)
     ASSERT_EQ(hr, DAS_S_OK);
     ASSERT_NE(runtime.Get(), nullptr);
 }
+
+TEST(GraphRuntimeFactoryTest, CreateGraphRuntimeWithHostIsSequential)
+{
+    auto host = NullTaskComponentHost::Make();
+
+    Das::DasPtr<IDasGraphRuntime> runtime;
+    ASSERT_EQ(
+        CreateGraphRuntimeWithHost(host.Get(), runtime.Put()),
+        DAS_S_OK);
+    EXPECT_FALSE(ParallelOf(runtime.Get()).enabled);
+}
+
+TEST(GraphRuntimeFactoryTest, CreateGraphRuntimeWithOptionsEnablesParallel)
+{
+    auto host = NullTaskComponentHost::Make();
+
+    Das::DasPtr<IDasGraphRuntime> runtime;
+    ASSERT_EQ(
+        CreateGraphRuntimeWithOptions(host.Get(), true, 3, runtime.Put()),
+        DAS_S_OK);
+    const auto& parallel = ParallelOf(runtime.Get());
+    EXPECT_TRUE(parallel.enabled);
+    EXPECT_EQ(parallel.max_workers, 3u);
+
+    // The options survive a run through the COM facade.
+    Das::DasPtr<Das::ExportInterface::IDasJson> result;
+    EXPECT_EQ(runtime->Execute(nullptr, nullptr, result.Put()), DAS_S_OK);
+    EXPECT_TRUE(ParallelOf(runtime.Get()).enabled);
+}
+
+TEST(GraphRuntimeFactoryTest, CreateGraphRuntimeWithOptionsNullArgs)
+{
+    auto host = NullTaskComponentHost::Make();
+
+    Das::DasPtr<IDasGraphRuntime> runtime;
+    EXPECT_EQ(
+        CreateGraphRuntimeWithOptions(nullptr, true, 0, runtime.Put()),
+        DAS_E_INVALID_POINTER);
+    EXPECT_EQ(
+        CreateGraphRuntimeWithOptions(host.Get(), true, 0, nullptr),
+        DAS_E_INVALID_POINTER);
+}
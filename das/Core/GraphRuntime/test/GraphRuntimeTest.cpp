@@ -18,13 +18,18 @@
 #include <das/_autogen/idl/wrapper/Das.PluginInterface.IDasTaskComponentHost.Implements.hpp>
 #include <gtest/gtest.h>
 
+#include "CountingImageStub.h"
+
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <functional>
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 
 // Forward declaration — GraphRuntime.h will be created in Task 2
@@ -1212,3 +1217,614 @@ TEST(SignalGatedRuntimeTest, MergeJoinRunsOnTakenBranch)
     // merge picked A's value (A.out = do_count = 1 on its single run).
     EXPECT_EQ(h->components[3]->picked_value, h->components[1]->do_count.load());
 }
+
+// =====================================================================
+// Parallel execution (opt-in wave scheduler)
+// =====================================================================
+//
+// A ProbeComponent records how many Do() calls overlap. Fan-out graphs:
+//   source --> w0, w1, w2 --> join
+// Thread-safe workers must overlap; non-thread-safe ones must not.
+
+namespace ParallelTestMock
+{
+    using IDasJson = Das::ExportInterface::IDasJson;
+    using IDasPortMap = Das::ExportInterface::IDasPortMap;
+    using IDasStopToken = Das::PluginInterface::IDasStopToken;
+    using IDasTaskComponent = Das::PluginInterface::IDasTaskComponent;
+
+    struct Probe
+    {
+        std::atomic<int>     do_calls{0};
+        std::atomic<int>     in_flight{0};
+        std::atomic<int>     max_in_flight{0};
+        std::atomic<int>     arrived{0};
+        int                  rendezvous = 0; // overlap to wait for; 0 = sleep
+        std::atomic<int64_t> join_sum{-1};
+    };
+
+    class ProbeComponent final : public IDasTaskComponent
+    {
+    public:
+        ProbeComponent(Probe* probe, int64_t value, bool join)
+            : probe_(probe), value_(value), join_(join)
+        {
+        }
+
+        std::atomic<uint32_t> ref_count_{0};
+
+        uint32_t DAS_STD_CALL AddRef() override { return ++ref_count_; }
+
+        uint32_t DAS_STD_CALL Release() override
+        {
+            auto c = --ref_count_;
+            if (c == 0)
+            {
+                ref_count_ = 1;
+                delete this;
+            }
+            return c;
+        }
+
+        DasResult DAS_STD_CALL
+        QueryInterface(const DasGuid& iid, void** pp_out) override
+        {
+            (void)iid;
+            if (!pp_out)
+                return DAS_E_INVALID_POINTER;
+            *pp_out = nullptr;
+            return DAS_E_NO_INTERFACE;
+        }
+
+        DasResult DAS_STD_CALL GetGuid(DasGuid* p_out_guid) override
+        {
+            if (!p_out_guid)
+                return DAS_E_INVALID_POINTER;
+            *p_out_guid = Das::Core::ForeignInterfaceHost::MakeDasGuid(
+                "30000000-0000-0000-0000-000000000002");
+            return DAS_S_OK;
+        }
+
+        DasResult DAS_STD_CALL
+        GetRuntimeClassName(IDasReadOnlyString** pp_out_name) override
+        {
+            if (!pp_out_name)
+                return DAS_E_INVALID_POINTER;
+            return CreateIDasReadOnlyStringFromUtf8(
+                "ProbeComponent",
+                pp_out_name);
+        }
+
+        DasResult ApplySettingsChange(
+            IDasJson*  p_request_json,
+            IDasJson** pp_out_result_json) override
+        {
+            (void)p_request_json;
+            if (pp_out_result_json)
+            {
+                *pp_out_result_json = new Das::Core::Utils::IDasJsonImpl("{}");
+                (*pp_out_result_json)->AddRef();
+            }
+            return DAS_S_OK;
+        }
+
+        DasResult Do(
+            IDasStopToken*                             p_stop_token,
+            Das::ExportInterface::IDasReadOnlyPortMap* p_input_port_map,
+            Das::ExportInterface::IDasPortMap**        pp_out_port_map) override
+        {
+            (void)p_stop_token;
+            ++probe_->do_calls;
+            const int now = ++probe_->in_flight;
+            int       seen = probe_->max_in_flight.load();
+            while (now > seen
+                   && !probe_->max_in_flight.compare_exchange_weak(seen, now))
+            {
+            }
+
+            if (join_)
+            {
+                int64_t sum = 0;
+                for (const char* port : {"in_0", "in_1", "in_2"})
+                {
+                    int64_t           v = 0;
+                    DasReadOnlyString key{port};
+                    if (p_input_port_map != nullptr
+                        && DAS::IsOk(p_input_port_map->GetInt(key.Get(), &v)))
+                    {
+                        sum += v;
+                    }
+                }
+                probe_->join_sum = sum;
+            }
+            else if (probe_->rendezvous > 0)
+            {
+                ++probe_->arrived;
+                const auto deadline =
+                    std::chrono::steady_clock::now() + std::chrono::seconds(2);
+                while (probe_->arrived.load() < probe_->rendezvous
+                       && std::chrono::steady_clock::now() < deadline)
+                {
+                    std::this_thread::yield();
+                }
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            --probe_->in_flight;
+
+            DAS::DasPtr<IDasPortMap> output;
+            DasResult                hr = CreateIDasPortMap(output.Put());
+            if (DAS::IsFailed(hr))
+            {
+                return hr;
+            }
+            DasReadOnlyString out_key{"out"};
+            output->SetInt(out_key.Get(), value_);
+            *pp_out_port_map = output.Get();
+            output.Get()->AddRef();
+            return DAS_S_OK;
+        }
+
+    private:
+        Probe*  probe_;
+        int64_t value_;
+        bool    join_;
+    };
+
+    // Component #i (in node-snapshot order) outputs i + 1; the last one is
+    // the join.
+    class ProbeHost final
+        : public Das::PluginInterface::DasTaskComponentHostImplBase<ProbeHost>
+    {
+    public:
+        Probe       probe;
+        std::size_t node_count = 0;
+        std::size_t created = 0;
+
+        DasResult CreateTaskComponent(
+            const DasGuid&                            component_guid,
+            Das::PluginInterface::IDasTaskComponent** pp_out_component) override
+        {
+            (void)component_guid;
+            if (!pp_out_component)
+            {
+                return DAS_E_INVALID_POINTER;
+            }
+            ++created;
+            auto* c = new ProbeComponent(
+                &probe,
+                static_cast<int64_t>(created),
+                created == node_count);
+            c->AddRef();
+            *pp_out_component = c;
+            return DAS_S_OK;
+        }
+    };
+
+    // source → w0, w1, w2 → join; workers optionally declared thread-safe.
+    CompiledGraphPlanDto MakeFanOutPlan(bool workers_thread_safe)
+    {
+        const std::string source{"10000000-0000-0000-0000-000000000061"};
+        const std::string join{"10000000-0000-0000-0000-000000000065"};
+        const std::vector<std::string> workers{
+            "10000000-0000-0000-0000-000000000062",
+            "10000000-0000-0000-0000-000000000063",
+            "10000000-0000-0000-0000-000000000064"};
+
+        CompiledGraphPlanDto plan;
+        plan.source_fingerprint = "fp_v1";
+        plan.compiled_fingerprint = "compiled_fp_fanout";
+
+        plan.node_snapshots.push_back(MakeSnapshot(source, kCompTest));
+        plan.execution_order.push_back(source);
+        for (std::size_t i = 0; i < workers.size(); ++i)
+        {
+            auto snap = MakeSnapshot(workers[i], kCompTest);
+            snap.thread_safe = workers_thread_safe;
+            plan.node_snapshots.push_back(std::move(snap));
+            plan.execution_order.push_back(workers[i]);
+            plan.binding_plan.bindings.push_back(
+                MakeBinding(source, "out", workers[i], "in"));
+            plan.binding_plan.bindings.push_back(MakeBinding(
+                workers[i],
+                "out",
+                join,
+                "in_" + std::to_string(i)));
+        }
+        plan.node_snapshots.push_back(MakeSnapshot(join, kCompTest));
+        plan.execution_order.push_back(join);
+        return plan;
+    }
+} // namespace ParallelTestMock
+
+TEST(ParallelGraphRuntimeTest, ThreadSafeNodesRunConcurrently)
+{
+    using namespace ParallelTestMock;
+    auto plan = MakeFanOutPlan(true);
+
+    auto  host = ProbeHost::Make();
+    auto* h = static_cast<ProbeHost*>(host.Get());
+    h->node_count = plan.node_snapshots.size();
+    h->probe.rendezvous = 3;
+
+    GraphRuntime rt;
+    rt.SetParallelExecution(ParallelExecutionOptions{true, 4});
+    Das::DasPtr<IDasStopToken> token =
+        Das::PluginInterface::DasStopTokenImplBase<MockStopToken>::Make();
+
+    auto hr = rt.RunWithHost(plan, "fp_v1", token.Get(), host.Get());
+    ASSERT_EQ(hr, DAS_S_OK);
+
+    EXPECT_EQ(h->probe.do_calls.load(), 5);
+    EXPECT_GE(h->probe.max_in_flight.load(), 3);
+    // Workers output 2, 3, 4; every staged output reached the join.
+    EXPECT_EQ(h->probe.join_sum.load(), 9);
+}
+
+TEST(ParallelGraphRuntimeTest, NonThreadSafeNodesStaySerialized)
+{
+    using namespace ParallelTestMock;
+    auto plan = MakeFanOutPlan(false);
+
+    auto  host = ProbeHost::Make();
+    auto* h = static_cast<ProbeHost*>(host.Get());
+    h->node_count = plan.node_snapshots.size();
+
+    GraphRuntime rt;
+    rt.SetParallelExecution(ParallelExecutionOptions{true, 4});
+    Das::DasPtr<IDasStopToken> token =
+        Das::PluginInterface::DasStopTokenImplBase<MockStopToken>::Make();
+
+    auto hr = rt.RunWithHost(plan, "fp_v1", token.Get(), host.Get());
+    ASSERT_EQ(hr, DAS_S_OK);
+
+    EXPECT_EQ(h->probe.do_calls.load(), 5);
+    EXPECT_EQ(h->probe.max_in_flight.load(), 1);
+    EXPECT_EQ(h->probe.join_sum.load(), 9);
+}
+
+TEST(ParallelGraphRuntimeTest, StopTokenCancelsBeforeDispatch)
+{
+    using namespace ParallelTestMock;
+    auto plan = MakeFanOutPlan(true);
+
+    auto  host = ProbeHost::Make();
+    auto* h = static_cast<ProbeHost*>(host.Get());
+    h->node_count = plan.node_snapshots.size();
+
+    GraphRuntime rt;
+    rt.SetParallelExecution(ParallelExecutionOptions{true, 4});
+    auto token =
+        Das::PluginInterface::DasStopTokenImplBase<MockStopToken>::Make();
+    static_cast<MockStopToken*>(token.Get())->cancelled = true;
+
+    auto hr = rt.RunWithHost(plan, "fp_v1", token.Get(), host.Get());
+    EXPECT_NE(hr, DAS_S_OK);
+    EXPECT_EQ(h->probe.do_calls.load(), 0);
+    EXPECT_FALSE(rt.GetLastErrorMessage().empty());
+}
+
+TEST(ParallelGraphRuntimeTest, LoopAndGateSemanticsPreserved)
+{
+    using namespace SignalGatedTestMock;
+    const std::string forNode{"10000000-0000-0000-0000-000000000071"};
+    const std::string body{"10000000-0000-0000-0000-000000000072"};
+    const std::string skipped{"10000000-0000-0000-0000-000000000073"};
+
+    auto plan = MakeBasePlan();
+    plan.node_snapshots = {
+        MakeBehaviorSnapshot(forNode, R"({"mode":"loop","end":"3"})"),
+        MakeBehaviorSnapshot(body, R"({"mode":"emit","signal":"done"})"),
+        MakeBehaviorSnapshot(skipped, R"({"mode":"record"})"),
+    };
+    for (auto& snap : plan.node_snapshots)
+    {
+        snap.thread_safe = true;
+    }
+    plan.execution_order = {forNode, body, skipped};
+    plan.signal_routes = {
+        MakeSignalRoute(forNode, "continue", body, "in"),
+        MakeSignalRoute(body, "done", forNode, "loop_in"),
+        MakeSignalRoute(forNode, "never", skipped, "in"),
+    };
+    plan.back_edges = {
+        MakeBackEdge("be1", body, "done", forNode, "loop_in", forNode),
+    };
+    plan.binding_plan.bindings = {
+        MakeBinding(forNode, "continue", body, "in", "signal"),
+        MakeBinding(body, "done", forNode, "loop_in", "signal"),
+        MakeBinding(forNode, "never", skipped, "in", "signal"),
+    };
+
+    auto         host = BehaviorHost::Make();
+    GraphRuntime rt;
+    rt.SetParallelExecution(ParallelExecutionOptions{true, 2});
+    Das::DasPtr<IDasStopToken> token =
+        Das::PluginInterface::DasStopTokenImplBase<MockStopToken>::Make();
+
+    auto hr = rt.RunWithHost(plan, "fp_v1", token.Get(), host.Get());
+    ASSERT_EQ(hr, DAS_S_OK);
+
+    auto* h = static_cast<BehaviorHost*>(host.Get());
+    ASSERT_EQ(h->components.size(), 3u);
+    EXPECT_EQ(h->components[0]->do_count.load(), 4); // 3 × continue + break
+    EXPECT_EQ(h->components[1]->do_count.load(), 3); // once per iteration
+    EXPECT_EQ(h->components[2]->do_count.load(), 0); // gate never opened
+}
+
+// =====================================================================
+// Warm re-runs: configured components are reused between RunWithHost calls
+// =====================================================================
+
+TEST(GraphRuntimeTest, RunWithHostReusesConfiguredComponents)
+{
+    using namespace GraphRuntimeTestMock;
+    auto plan = MakePlanWithSettings(kNodeA, kCompA, R"({"x":1})", "");
+
+    auto  host = MockTaskComponentHost::Make();
+    auto* mock_host = static_cast<MockTaskComponentHost*>(host.Get());
+
+    GraphRuntime               rt;
+    Das::DasPtr<IDasStopToken> token =
+        Das::PluginInterface::DasStopTokenImplBase<MockStopToken>::Make();
+
+    ASSERT_EQ(rt.RunWithHost(plan, "fp_v1", token.Get(), host.Get()), DAS_S_OK);
+    ASSERT_EQ(rt.RunWithHost(plan, "fp_v1", token.Get(), host.Get()), DAS_S_OK);
+    EXPECT_EQ(mock_host->created_guids.size(), 1u);
+
+    // Same compiled_fingerprint, different settings → reconfigured.
+    auto changed = MakePlanWithSettings(kNodeA, kCompA, R"({"x":2})", "");
+    ASSERT_EQ(
+        rt.RunWithHost(changed, "fp_v1", token.Get(), host.Get()),
+        DAS_S_OK);
+    EXPECT_EQ(mock_host->created_guids.size(), 2u);
+
+    // New compiled_fingerprint → reconfigured.
+    changed.compiled_fingerprint = "compiled_fp_v2";
+    ASSERT_EQ(
+        rt.RunWithHost(changed, "fp_v1", token.Get(), host.Get()),
+        DAS_S_OK);
+    EXPECT_EQ(mock_host->created_guids.size(), 3u);
+}
+
+TEST(GraphRuntimeTest, RunWithHostReconfiguresAfterCancelledRun)
+{
+    using namespace GraphRuntimeTestMock;
+    auto plan = MakePlanWithSettings(kNodeA, kCompA, R"({"x":1})", "");
+
+    auto  host = MockTaskComponentHost::Make();
+    auto* mock_host = static_cast<MockTaskComponentHost*>(host.Get());
+
+    GraphRuntime rt;
+    auto         token =
+        Das::PluginInterface::DasStopTokenImplBase<MockStopToken>::Make();
+    auto* p_token = static_cast<MockStopToken*>(token.Get());
+
+    ASSERT_EQ(rt.RunWithHost(plan, "fp_v1", token.Get(), host.Get()), DAS_S_OK);
+
+    p_token->cancelled = true;
+    EXPECT_NE(rt.RunWithHost(plan, "fp_v1", token.Get(), host.Get()), DAS_S_OK);
+    EXPECT_EQ(mock_host->created_guids.size(), 1u);
+
+    // The cancelled run may have left components mid-iteration.
+    p_token->cancelled = false;
+    ASSERT_EQ(rt.RunWithHost(plan, "fp_v1", token.Get(), host.Get()), DAS_S_OK);
+    EXPECT_EQ(mock_host->created_guids.size(), 2u);
+}
+
+TEST(GraphRuntimeTest, RunWithHostWithoutCompiledFingerprintAlwaysConfigures)
+{
+    using namespace GraphRuntimeTestMock;
+    auto plan = MakePlanWithSettings(kNodeA, kCompA, "", "");
+    plan.compiled_fingerprint.clear();
+
+    auto  host = MockTaskComponentHost::Make();
+    auto* mock_host = static_cast<MockTaskComponentHost*>(host.Get());
+
+    GraphRuntime               rt;
+    Das::DasPtr<IDasStopToken> token =
+        Das::PluginInterface::DasStopTokenImplBase<MockStopToken>::Make();
+
+    ASSERT_EQ(rt.RunWithHost(plan, "fp_v1", token.Get(), host.Get()), DAS_S_OK);
+    ASSERT_EQ(rt.RunWithHost(plan, "fp_v1", token.Get(), host.Get()), DAS_S_OK);
+    EXPECT_EQ(mock_host->created_guids.size(), 2u);
+}
+
+// =====================================================================
+// Image fan-out benchmark: one 1080p frame → 10 consumers, zero copies
+// =====================================================================
+
+namespace ImageFanOutMock
+{
+    using IDasJson = Das::ExportInterface::IDasJson;
+    using IDasImage = Das::ExportInterface::IDasImage;
+    using IDasReadOnlyPortMap = Das::ExportInterface::IDasReadOnlyPortMap;
+
+    struct Tally
+    {
+        DAS::DasPtr<IDasImage> frame;       // what the capture node emits
+        uint64_t               frame_bytes = 0;
+        int                    received = 0;
+        uint64_t               copied_bytes = 0; // consumer saw another image
+    };
+
+    // Capture (first created) publishes Tally::frame under "image";
+    // every other instance is a consumer reading "image".
+    class ImageComponent final
+        : public Das::PluginInterface::DasTaskComponentImplBase<ImageComponent>
+    {
+    public:
+        ImageComponent(Tally* tally, bool capture)
+            : tally_(tally), capture_(capture)
+        {
+        }
+
+        DAS_IMPL GetGuid(DasGuid* p_out_guid) override
+        {
+            if (!p_out_guid)
+                return DAS_E_INVALID_POINTER;
+            *p_out_guid = MakeNodeGuid(kCompTest);
+            return DAS_S_OK;
+        }
+
+        DAS_IMPL GetRuntimeClassName(IDasReadOnlyString** pp_out_name) override
+        {
+            if (!pp_out_name)
+                return DAS_E_INVALID_POINTER;
+            return CreateIDasReadOnlyStringFromUtf8(
+                "ImageComponent",
+                pp_out_name);
+        }
+
+        DAS_IMPL ApplySettingsChange(
+            IDasJson*  p_request_json,
+            IDasJson** pp_out_result_json) override
+        {
+            (void)p_request_json;
+            if (pp_out_result_json)
+            {
+                *pp_out_result_json = new Das::Core::Utils::IDasJsonImpl("{}");
+                (*pp_out_result_json)->AddRef();
+            }
+            return DAS_S_OK;
+        }
+
+        DAS_IMPL Do(
+            IDasStopToken*                      p_stop_token,
+            IDasReadOnlyPortMap*                p_input_port_map,
+            Das::ExportInterface::IDasPortMap** pp_out_port_map) override
+        {
+            (void)p_stop_token;
+            DAS::DasPtr<IDasPortMap> output;
+            DasResult                hr = CreateIDasPortMap(output.Put());
+            if (DAS::IsFailed(hr))
+            {
+                return hr;
+            }
+
+            DasReadOnlyString image_key{"image"};
+            if (capture_)
+            {
+                output->SetImage(image_key.Get(), tally_->frame.Get());
+            }
+            else if (p_input_port_map != nullptr)
+            {
+                DAS::DasPtr<IDasImage> image;
+                if (DAS::IsOk(
+                        p_input_port_map->GetImage(image_key.Get(), image.Put())))
+                {
+                    ++tally_->received;
+                    if (image.Get() != tally_->frame.Get())
+                    {
+                        tally_->copied_bytes += tally_->frame_bytes;
+                    }
+                }
+            }
+
+            *pp_out_port_map = output.Get();
+            output.Get()->AddRef();
+            return DAS_S_OK;
+        }
+
+    private:
+        Tally* tally_;
+        bool   capture_;
+    };
+
+    class ImageHost final
+        : public Das::PluginInterface::DasTaskComponentHostImplBase<ImageHost>
+    {
+    public:
+        Tally       tally;
+        std::size_t created = 0;
+
+        DasResult CreateTaskComponent(
+            const DasGuid&                            component_guid,
+            Das::PluginInterface::IDasTaskComponent** pp_out_component) override
+        {
+            (void)component_guid;
+            if (!pp_out_component)
+            {
+                return DAS_E_INVALID_POINTER;
+            }
+            auto* c = new ImageComponent(&tally, created++ == 0);
+            c->AddRef();
+            *pp_out_component = c;
+            return DAS_S_OK;
+        }
+    };
+
+    // capture → consumer_0 … consumer_{n-1}, all reading capture.image.
+    CompiledGraphPlanDto MakeImageFanOutPlan(std::size_t consumers)
+    {
+        const std::string capture{"10000000-0000-0000-0000-000000000070"};
+
+        CompiledGraphPlanDto plan;
+        plan.source_fingerprint = "fp_v1";
+        plan.compiled_fingerprint = "compiled_fp_image_fanout";
+        plan.node_snapshots.push_back(MakeSnapshot(capture, kCompTest));
+        plan.execution_order.push_back(capture);
+
+        for (std::size_t i = 0; i < consumers; ++i)
+        {
+            const std::string node =
+                "10000000-0000-0000-0000-0000000001" + std::to_string(10 + i);
+            plan.node_snapshots.push_back(MakeSnapshot(node, kCompTest));
+            plan.execution_order.push_back(node);
+            plan.binding_plan.bindings.push_back(
+                MakeBinding(capture, "image", node, "image", "image"));
+        }
+        return plan;
+    }
+} // namespace ImageFanOutMock
+
+TEST(GraphRuntimeBenchmark, ImageFanOutToTenConsumersCopiesNoPixels)
+{
+    using namespace ImageFanOutMock;
+    constexpr std::size_t kConsumers = 10;
+    constexpr int         kRuns = 100;
+
+    auto  host = ImageHost::Make();
+    auto* h = static_cast<ImageHost*>(host.Get());
+    auto  image = CountingImageStub::Make(1920, 1080, 3);
+    auto* stub = static_cast<CountingImageStub*>(image.Get());
+    h->tally.frame = image;
+    h->tally.frame_bytes = stub->DataSize();
+
+    const auto                 plan = MakeImageFanOutPlan(kConsumers);
+    GraphRuntime               rt;
+    Das::DasPtr<IDasStopToken> token =
+        Das::PluginInterface::DasStopTokenImplBase<MockStopToken>::Make();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int run = 0; run < kRuns; ++run)
+    {
+        ASSERT_EQ(
+            rt.RunWithHost(plan, "fp_v1", token.Get(), host.Get()),
+            DAS_S_OK);
+    }
+    const auto elapsed_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count();
+
+    const uint64_t bytes_copied =
+        h->tally.copied_bytes + stub->materialized_bytes.load();
+    RecordProperty("consumers", static_cast<int>(kConsumers));
+    RecordProperty("frame_bytes", std::to_string(h->tally.frame_bytes));
+    RecordProperty("bytes_copied", std::to_string(bytes_copied));
+    RecordProperty("us_per_run", std::to_string(elapsed_us / kRuns));
+    std::printf(
+        "[ image fan-out ] %zu consumers x %d runs: %llu bytes copied "
+        "(frame = %llu bytes), %lld us/run\n",
+        kConsumers,
+        kRuns,
+        static_cast<unsigned long long>(bytes_copied),
+        static_cast<unsigned long long>(h->tally.frame_bytes),
+        static_cast<long long>(elapsed_us / kRuns));
+
+    EXPECT_EQ(h->tally.received, static_cast<int>(kConsumers) * kRuns);
+    EXPECT_EQ(bytes_copied, 0u);
+}
@@ -0,0 +1,217 @@
+#include <das/Core/ForeignInterfaceHost/DasGuid.h>
+#include <das/Core/GraphRuntime/CompiledArtifact.h>
+#include <das/Core/GraphRuntime/GraphRuntime.h>
+#include <das/Core/GraphRuntime/LoweredGraphPlan.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace Das::Core::GraphRuntime;
+    using NodeIndex = LoweredGraphPlan::NodeIndex;
+
+    Dto::PortBindingDto MakeBinding(
+        const std::string& src_node,
+        const std::string& src_port,
+        const std::string& tgt_node,
+        const std::string& tgt_port)
+    {
+        Dto::PortBindingDto binding;
+        binding.source_node_id = src_node;
+        binding.source_port_id = src_port;
+        binding.target_node_id = tgt_node;
+        binding.target_port_id = tgt_port;
+        binding.expected_type = "int";
+        return binding;
+    }
+
+    Dto::SignalRouteDto MakeRoute(
+        const std::string& src_node,
+        const std::string& src_port,
+        const std::string& tgt_node,
+        const std::string& tgt_port)
+    {
+        Dto::SignalRouteDto route;
+        route.source_node_id = src_node;
+        route.source_port_id = src_port;
+        route.target_node_id = tgt_node;
+        route.target_port_id = tgt_port;
+        return route;
+    }
+
+    std::vector<std::string> Ids(
+        const LoweredGraphPlan&    lowered,
+        std::span<const NodeIndex> nodes)
+    {
+        std::vector<std::string> ids;
+        for (const auto n : nodes)
+        {
+            ids.push_back(lowered.GetNodeId(n));
+        }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+
+    // Loop: head → body → tail, tail.done --back edge--> head; exit reads tail.
+    Dto::CompiledGraphPlanDto MakeLoopPlan()
+    {
+        Dto::CompiledGraphPlanDto plan;
+        plan.compiled_fingerprint = "loop-v1";
+        plan.execution_order = {"head", "body", "tail", "exit"};
+        plan.binding_plan.bindings = {
+            MakeBinding("head", "out", "body", "in"),
+            MakeBinding("body", "out", "tail", "in"),
+            MakeBinding("tail", "done", "head", "again"),
+            MakeBinding("tail", "out", "exit", "in")};
+        plan.signal_routes = {MakeRoute("tail", "done", "head", "again")};
+
+        Dto::BackEdgeDto back_edge;
+        back_edge.source_node_id = "tail";
+        back_edge.source_port_id = "done";
+        back_edge.target_node_id = "head";
+        back_edge.target_port_id = "again";
+        back_edge.loop_head_node_id = "head";
+        plan.back_edges = {back_edge};
+        return plan;
+    }
+} // namespace
+
+TEST(LoweredGraphPlanTest, NodesIndexedInExecutionOrder)
+{
+    Dto::CompiledGraphPlanDto plan;
+    plan.execution_order = {"A", "B", "C"};
+    // "X" is referenced by a binding but never scheduled.
+    plan.binding_plan.bindings = {MakeBinding("X", "out", "C", "in")};
+
+    const auto lowered = LoweredGraphPlan::Lower(plan);
+
+    ASSERT_EQ(lowered.NodeCount(), 4u);
+    EXPECT_EQ(lowered.FindNode("A"), 0u);
+    EXPECT_EQ(lowered.FindNode("B"), 1u);
+    EXPECT_EQ(lowered.FindNode("C"), 2u);
+    EXPECT_EQ(lowered.FindNode("X"), 3u);
+    EXPECT_EQ(lowered.FindNode("missing"), LoweredGraphPlan::kInvalidNode);
+    EXPECT_EQ(
+        lowered.GetExecutionOrder(),
+        (std::vector<NodeIndex>{0u, 1u, 2u}));
+    EXPECT_FALSE(lowered.HasControlFlow());
+}
+
+TEST(LoweredGraphPlanTest, DataPredecessorsSkipBroadcastAndSignalEdges)
+{
+    Dto::CompiledGraphPlanDto plan;
+    plan.execution_order = {"A", "B", "C"};
+    plan.binding_plan.bindings = {
+        MakeBinding("$graph_input", "value", "B", "seed"),
+        MakeBinding("A", "out", "B", "in"),
+        MakeBinding("A", "true", "C", "exec"),
+        MakeBinding("B", "out", "C", "in")};
+    plan.signal_routes = {MakeRoute("A", "true", "C", "exec")};
+
+    const auto lowered = LoweredGraphPlan::Lower(plan);
+    const auto b = lowered.FindNode("B");
+    const auto c = lowered.FindNode("C");
+
+    EXPECT_EQ(lowered.FindNode("$graph_input"), LoweredGraphPlan::kInvalidNode);
+    EXPECT_EQ(
+        Ids(lowered, lowered.GetDataPredecessors(b)),
+        (std::vector<std::string>{"A"}));
+    EXPECT_EQ(
+        Ids(lowered, lowered.GetDataPredecessors(c)),
+        (std::vector<std::string>{"B"}));
+    EXPECT_TRUE(lowered.GetDataPredecessors(lowered.FindNode("A")).empty());
+
+    const auto gates = lowered.GetGateRoutes(c);
+    ASSERT_EQ(gates.size(), 1u);
+    EXPECT_EQ(gates[0].source, lowered.FindNode("A"));
+    EXPECT_EQ(gates[0].source_port.port_id, "true");
+    EXPECT_TRUE(lowered.HasControlFlow());
+}
+
+TEST(LoweredGraphPlanTest, InputBindingsGroupedByTargetInPlanOrder)
+{
+    Dto::CompiledGraphPlanDto plan;
+    plan.execution_order = {"A", "B"};
+    plan.binding_plan.bindings = {
+        MakeBinding("A", "x", "B", "in_x"),
+        MakeBinding("$graph_input", "seed", "A", "seed"),
+        MakeBinding("A", "y", "B", "in_y")};
+
+    const auto lowered = LoweredGraphPlan::Lower(plan);
+
+    const auto& b_inputs = lowered.GetInputBindings(lowered.FindNode("B"));
+    ASSERT_EQ(b_inputs.size(), 2u);
+    EXPECT_EQ(b_inputs[0].target_port, "in_x");
+    EXPECT_EQ(b_inputs[1].target_port, "in_y");
+    EXPECT_FALSE(b_inputs[0].broadcast);
+    EXPECT_EQ(b_inputs[1].source_port.port_id, "y");
+
+    // Broadcast bindings still feed their target's input PortMap.
+    const auto& a_inputs = lowered.GetInputBindings(lowered.FindNode("A"));
+    ASSERT_EQ(a_inputs.size(), 1u);
+    EXPECT_TRUE(a_inputs[0].broadcast);
+}
+
+TEST(LoweredGraphPlanTest, LoopSccAndBackEdgesResolved)
+{
+    const auto lowered = LoweredGraphPlan::Lower(MakeLoopPlan());
+    const auto head = lowered.FindNode("head");
+    const auto tail = lowered.FindNode("tail");
+
+    // The back edge is not a gate the head waits on.
+    EXPECT_TRUE(lowered.GetGateRoutes(head).empty());
+
+    const auto back_edges = lowered.GetBackEdgesFrom(tail);
+    ASSERT_EQ(back_edges.size(), 1u);
+    EXPECT_EQ(back_edges[0].loop_head, head);
+    EXPECT_EQ(back_edges[0].source_port.port_id, "done");
+
+    EXPECT_EQ(
+        Ids(lowered, lowered.GetLoopScc(head)),
+        (std::vector<std::string>{"body", "head", "tail"}));
+    EXPECT_TRUE(lowered.GetLoopScc(tail).empty());
+}
+
+TEST(LoweredGraphPlanTest, NodeGuidsParsedOnce)
+{
+    const std::string guid_id = "6b3b9c4e-2f1a-4d8b-9c7e-0a1b2c3d4e5f";
+
+    Dto::CompiledGraphPlanDto plan;
+    plan.execution_order = {guid_id, "not-a-guid"};
+
+    const auto lowered = LoweredGraphPlan::Lower(plan);
+    const auto guid_node = lowered.FindNode(guid_id);
+
+    ASSERT_TRUE(lowered.IsNodeGuidValid(guid_node));
+    EXPECT_EQ(
+        lowered.GetNodeGuid(guid_node),
+        Das::Core::ForeignInterfaceHost::MakeDasGuid(guid_id));
+    EXPECT_FALSE(lowered.IsNodeGuidValid(lowered.FindNode("not-a-guid")));
+}
+
+TEST(LoweredGraphPlanTest, RuntimeCachesLoweredPlanByCompiledFingerprint)
+{
+    GraphRuntime runtime;
+    auto         plan = MakeLoopPlan();
+
+    const auto* first = &runtime.GetLoweredPlan(plan);
+    EXPECT_EQ(first->NodeCount(), 4u);
+
+    // Same compiled_fingerprint → cached lowering is reused as-is.
+    plan.execution_order.push_back("extra");
+    const auto* second = &runtime.GetLoweredPlan(plan);
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(second->NodeCount(), 4u);
+
+    // New compiled_fingerprint → re-lowered.
+    plan.compiled_fingerprint = "loop-v2";
+    EXPECT_EQ(runtime.GetLoweredPlan(plan).NodeCount(), 5u);
+
+    // No compiled_fingerprint → never served from cache.
+    plan.compiled_fingerprint.clear();
+    plan.execution_order.push_back("extra2");
+    EXPECT_EQ(runtime.GetLoweredPlan(plan).NodeCount(), 6u);
+}
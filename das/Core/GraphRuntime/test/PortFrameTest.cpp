@@ -1,5 +1,7 @@
 #include <das/Core/GraphRuntime/PortFrame.h>
 
+#include "CountingImageStub.h"
+
 #include <das/Core/ForeignInterfaceHost/DasGuid.h>
 #include <gtest/gtest.h>
 
@@ -24,7 +26,9 @@ namespace
 
     PortKey Key(const DasGuid& node, const std::string& port)
     {
-        return PortKey{node, port};
+        return PortKey{
+            node,
+            Das::Core::ForeignInterfaceHost::DasStringAtom{port}};
     }
 } // namespace
 
@@ -109,14 +113,36 @@ TEST(PortFrameTest, ComponentValueNullptr)
 
 TEST(PortFrameTest, ImageValue)
 {
-    std::vector<uint8_t> pixels = {0xFF, 0x00, 0x80, 0x40};
-    PortValue            v(ImageData{std::move(pixels)});
+    auto      image = CountingImageStub::Make(2, 2, 1);
+    PortValue v(ImageData{image});
     EXPECT_TRUE(v.IsImage());
     EXPECT_EQ(v.GetType(), PortValueType::Image);
     ASSERT_NE(v.AsImage(), nullptr);
-    EXPECT_EQ(v.AsImage()->bytes.size(), 4u);
-    EXPECT_EQ(v.AsImage()->bytes[0], 0xFF);
-    EXPECT_EQ(v.AsImage()->bytes[3], 0x40);
+    EXPECT_EQ(v.AsImage()->image.Get(), image.Get());
+
+    uint64_t size = 0;
+    ASSERT_EQ(v.AsImage()->image->GetDataSize(&size), DAS_S_OK);
+    EXPECT_EQ(size, 4u);
+}
+
+TEST(PortFrameTest, ImageValueCopiesShareTheImage)
+{
+    auto image = CountingImageStub::Make(1920, 1080, 3);
+    auto* stub = static_cast<CountingImageStub*>(image.Get());
+
+    PortFrame frame;
+    frame.Set(Key(kNode1, "frame"), PortValue(ImageData{image}));
+
+    // Copying values and whole frames only shares the handle.
+    const PortValue copy = *frame.Find(Key(kNode1, "frame"));
+    PortFrame       frame_copy = frame;
+    frame_copy.Set(Key(kNode2, "in"), copy);
+
+    EXPECT_EQ(copy.AsImage()->image.Get(), image.Get());
+    EXPECT_EQ(
+        frame_copy.Find(Key(kNode2, "in"))->AsImage()->image.Get(),
+        image.Get());
+    EXPECT_EQ(stub->materialized_bytes.load(), 0u);
 }
 
 TEST(PortFrameTest, JsonValue)
@@ -196,6 +222,17 @@ TEST(PortFrameTest, PortKeyHashDiffKey)
     EXPECT_NE(hasher(a), hasher(b));
 }
 
+TEST(PortFrameTest, PortKeyInternsPortId)
+{
+    // Separately built strings must land on the same atom.
+    const std::string port = std::string{"interned_"} + "port";
+    auto              a = Key(kNode1, port);
+    auto              b = Key(kNode1, "interned_port");
+    EXPECT_EQ(a.port_id.GetId(), b.port_id.GetId());
+    EXPECT_NE(a.port_id.GetId(), 0u);
+    EXPECT_EQ(a.port_id, "interned_port");
+}
+
 // ===========================================================================
 // PortFrame — basic CRUD
 // ===========================================================================
@@ -227,7 +264,10 @@ TEST(PortFrameTest, SetAndFind)
 TEST(PortFrameTest, SetWithSeparateArgs)
 {
     PortFrame frame;
-    frame.Set(kNode1, std::string("result"), PortValue(2.5));
+    frame.Set(
+        kNode1,
+        Das::Core::ForeignInterfaceHost::DasStringAtom{"result"},
+        PortValue(2.5));
 
     auto* pv = frame.Find(Key(kNode1, "result"));
     ASSERT_NE(pv, nullptr);
@@ -324,6 +364,29 @@ TEST(PortFrameTest, IterateNonEmpty)
     EXPECT_EQ(count, 2u);
 }
 
+// ===========================================================================
+// PortFrame — MergeFrom
+// ===========================================================================
+
+TEST(PortFrameTest, MergeFromOverwritesAndDrainsStaged)
+{
+    PortFrame frame;
+    frame.Set(Key(kNode1, "a"), PortValue(int64_t{1}));
+    frame.Set(Key(kNode2, "b"), PortValue(int64_t{2}));
+
+    PortFrame staged;
+    staged.Set(Key(kNode2, "b"), PortValue(int64_t{20}));
+    staged.Set(Key(kNode3, "c"), PortValue::Signal());
+
+    frame.MergeFrom(std::move(staged));
+
+    EXPECT_EQ(frame.Size(), 3u);
+    EXPECT_EQ(*frame.Find(Key(kNode1, "a"))->AsInt(), 1);
+    EXPECT_EQ(*frame.Find(Key(kNode2, "b"))->AsInt(), 20);
+    EXPECT_TRUE(frame.Find(Key(kNode3, "c"))->IsSignal());
+    EXPECT_TRUE(staged.Empty());
+}
+
 // ===========================================================================
 // PortFrame — all 10 value types round-trip
 // ===========================================================================
@@ -343,7 +406,9 @@ TEST(PortFrameTest, AllValueTypes)
     frame.Set(
         Key(kNode1, "v_comp"),
         PortValue(ComponentHandle{DAS::DasPtr<IDasBase>{}}));
-    frame.Set(Key(kNode1, "v_image"), PortValue(ImageData{{0xAA, 0xBB}}));
+    frame.Set(
+        Key(kNode1, "v_image"),
+        PortValue(ImageData{CountingImageStub::Make(2, 1, 1)}));
     frame.Set(Key(kNode1, "v_json"), PortValue(JsonData{yyjson::read("[]")}));
     frame.Set(Key(kNode1, "v_signal"), PortValue::Signal());
 
@@ -357,7 +422,9 @@ TEST(PortFrameTest, AllValueTypes)
     EXPECT_TRUE(frame.Find(Key(kNode1, "v_base"))->IsBase());
     EXPECT_TRUE(frame.Find(Key(kNode1, "v_comp"))->IsComponent());
     ASSERT_NE(frame.Find(Key(kNode1, "v_image"))->AsImage(), nullptr);
-    EXPECT_EQ(frame.Find(Key(kNode1, "v_image"))->AsImage()->bytes.size(), 2u);
+    EXPECT_NE(
+        frame.Find(Key(kNode1, "v_image"))->AsImage()->image.Get(),
+        nullptr);
     EXPECT_TRUE(frame.Find(Key(kNode1, "v_json"))->IsJson());
     EXPECT_TRUE(frame.Find(Key(kNode1, "v_signal"))->IsSignal());
 }
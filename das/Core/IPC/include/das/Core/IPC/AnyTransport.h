@@ -3,6 +3,7 @@
 
 #include <das/Core/IPC/AsyncIpcTransport.h>
 #include <das/Core/IPC/HttpIpcTransport.h>
+#include <das/Core/IPC/ShmRingIpcTransport.h>
 #include <das/Core/IPC/UnixAsyncIpcTransport.h>
 #ifdef DAS_WINDOWS
 #include <das/Core/IPC/Win32AsyncIpcTransport.h>
@@ -24,9 +25,12 @@ class SharedMemoryPool;
 /**
  * @brief 通用 IPC 传输器 — variant 直接存值，零指针跳转
  *
- * Windows: variant<Named Pipe, Unix Socket, HTTP>
+ * Windows: variant<Named Pipe, Unix Socket, HTTP, SHM Ring>
  *   AF_UNIX 通过 Meyers singleton 运行时检测可用性
- * Linux:   variant<Unix Socket, HTTP>
+ * Linux:   variant<Unix Socket, HTTP, SHM Ring>
+ *
+ * SHM Ring 不由 CreateAsync 直接选择：握手在 socket/pipe 上协商后，
+ * 由连接双方把已握手的传输替换为 ShmRingIpcTransport。
  */
 class AnyTransport final
 {
@@ -35,9 +39,13 @@ public:
     using VariantType = std::variant<
         Win32AsyncIpcTransport,
         UnixAsyncIpcTransport,
-        HttpIpcTransport>;
+        HttpIpcTransport,
+        ShmRingIpcTransport>;
 #else
-    using VariantType = std::variant<UnixAsyncIpcTransport, HttpIpcTransport>;
+    using VariantType = std::variant<
+        UnixAsyncIpcTransport,
+        HttpIpcTransport,
+        ShmRingIpcTransport>;
 #endif
 
 #ifdef DAS_WINDOWS
@@ -45,6 +53,7 @@ public:
 #endif
     explicit AnyTransport(UnixAsyncIpcTransport&& t);
     explicit AnyTransport(HttpIpcTransport&& t);
+    explicit AnyTransport(ShmRingIpcTransport&& t);
 
     using CreateAsyncResult =
         std::tuple<DasResult, std::optional<AnyTransport>>;
@@ -92,9 +101,18 @@ public:
      * @param pipe_fn  Named Pipe 回调
      * @param unix_fn  Unix Socket 回调
      * @param http_fn  HTTP/WebSocket 回调
+     * @param shm_fn   共享内存环回调
      */
-    template <typename PipeFn, typename UnixFn, typename HttpFn>
-    auto Visit(PipeFn&& pipe_fn, UnixFn&& unix_fn, HttpFn&& http_fn) const
+    template <
+        typename PipeFn,
+        typename UnixFn,
+        typename HttpFn,
+        typename ShmFn>
+    auto Visit(
+        PipeFn&& pipe_fn,
+        UnixFn&& unix_fn,
+        HttpFn&& http_fn,
+        ShmFn&&  shm_fn) const
     {
         return std::visit(
             [&](auto& t)
@@ -111,16 +129,28 @@ public:
                 {
                     return unix_fn(t);
                 }
-                else
+                else if constexpr (std::is_same_v<T, HttpIpcTransport>)
                 {
                     return http_fn(t);
                 }
+                else
+                {
+                    return shm_fn(t);
+                }
             },
             transport_);
     }
 
-    template <typename PipeFn, typename UnixFn, typename HttpFn>
-    auto Visit(PipeFn&& pipe_fn, UnixFn&& unix_fn, HttpFn&& http_fn)
+    template <
+        typename PipeFn,
+        typename UnixFn,
+        typename HttpFn,
+        typename ShmFn>
+    auto Visit(
+        PipeFn&& pipe_fn,
+        UnixFn&& unix_fn,
+        HttpFn&& http_fn,
+        ShmFn&&  shm_fn)
     {
         return std::visit(
             [&](auto& t)
@@ -137,10 +167,14 @@ public:
                 {
                     return unix_fn(t);
                 }
-                else
+                else if constexpr (std::is_same_v<T, HttpIpcTransport>)
                 {
                     return http_fn(t);
                 }
+                else
+                {
+                    return shm_fn(t);
+                }
             },
             transport_);
     }
@@ -2,6 +2,7 @@
 #define DAS_CORE_IPC_ASYNC_IPC_TRANSPORT_H
 
 #include <cstdint>
+#include <das/Core/IPC/IpcMessageBody.h>
 #include <das/Core/IPC/ValidatedIPCMessageHeader.h>
 #include <memory>
 #include <string>
@@ -16,10 +17,10 @@ class SharedMemoryPool;
 
 /**
  * @brief 异步 IPC 传输结果
- * @details 包含消息头和消息体的配对
+ * @details 包含消息头和消息体的配对。
+ *          大消息的消息体借用共享内存段（见 IpcMessageBody），不做拷贝。
  */
-using AsyncIpcMessage =
-    std::pair<ValidatedIPCMessageHeader, std::vector<uint8_t>>;
+using AsyncIpcMessage = std::pair<ValidatedIPCMessageHeader, IpcMessageBody>;
 
 /**
  * @brief 大消息阈值（64KB）
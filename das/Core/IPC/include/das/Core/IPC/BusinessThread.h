@@ -124,6 +124,29 @@ private:
      */
     void ProcessInboundMessage(InboundMessage& msg);
 
+    /**
+     * @brief 分发单条 REQUEST/EVENT 到 handler，响应经 sender 发出
+     * @param header 消息头
+     * @param body 消息体
+     * @param sender 响应发送器
+     */
+    void DispatchRequest(
+        const ValidatedIPCMessageHeader& header,
+        const IpcMessageBody&            body,
+        IpcResponseSender&               sender);
+
+    /**
+     * @brief 处理批量 REQUEST 信封
+     *
+     * 按顺序逐条分发内层请求，响应收集到同一个 writer 中，
+     * 全部处理完毕后以一个批量 RESPONSE 帧返回。handler 未发送响应的
+     * 内层请求以错误响应补位，保证调用方的每个 pending call 都能完成。
+     * 信封损坏时，已解出的内层请求以 DAS_E_IPC_SERIALIZATION_FAILED 回复。
+     *
+     * @param msg 批量信封消息
+     */
+    void ProcessBatchRequest(InboundMessage& msg);
+
     /// 入站消息队列（非持有，IpcContext 的值成员引用）
     IpcMessageQueue<InboundMessage>& inbound_;
 
@@ -190,6 +190,17 @@ public:
 
     DasResult RegisterHostLocalTransport(uint16_t session_id, AnyTransport&& t);
 
+    /**
+     * @brief 替换已注册的 Host 侧本地传输（握手协商的传输升级）
+     *
+     * 被替换的传输不会关闭，移入退役表，随连接资源一起清理。
+     *
+     * @param session_id 目标会话ID
+     * @param t 新传输（必须已连接）
+     * @return DAS_S_OK 成功；DAS_E_IPC_OBJECT_NOT_FOUND 未注册过传输
+     */
+    DasResult ReplaceHostLocalTransport(uint16_t session_id, AnyTransport&& t);
+
     /**
      * @brief 更新连接的活跃状态
      *
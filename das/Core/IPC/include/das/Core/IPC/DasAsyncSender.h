@@ -493,6 +493,33 @@ namespace Core::IPC
             ctx};
     }
 
+    /**
+     * @brief 将录制好的 IpcCallBatch 包装为 when_all 语义的 sender
+     *
+     * 批次内的 N 个调用以一个 MessageFlags::BATCH 帧发送，对端以一个帧
+     * 返回全部响应；sender 在全部响应到齐后完成，携带
+     * vector<IpcCallResult>（顺序与录制顺序一致）。
+     *
+     * @code
+     * IpcCallBatch batch;
+     * {
+     *     IpcCallBatch::RecordScope scope{batch};
+     *     component->Dispatch(name.Get(), params.Get(), result.Put());
+     *     component->Dispatch(name.Get(), params.Get(), result.Put());
+     * }
+     * auto results = wait(*ctx, when_all_calls(std::move(batch)));
+     * @endcode
+     *
+     * @tparam Batch IpcCallBatch（模板化以避免本头文件依赖 IpcRunLoop.h）
+     */
+    template <typename Batch>
+    auto when_all_calls(
+        Batch&&                   batch,
+        std::chrono::milliseconds timeout = std::chrono::seconds(30))
+    {
+        return std::forward<Batch>(batch).Submit(timeout);
+    }
+
     //=============================================================================
     // SyncWaitReceiver — wait() 使用的内部 receiver
     //=============================================================================
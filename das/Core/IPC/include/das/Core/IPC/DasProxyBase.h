@@ -8,10 +8,14 @@
 #include <das/Core/IPC/IpcCommandHandler.h>
 #include <das/Core/IPC/MemorySerializer.h>
 #include <das/Core/IPC/ProxyFactory.h>
+#include <das/Core/IPC/QueryInterfaceSet.h>
+#include <das/Core/IPC/SpanSerializer.h>
 #include <das/DasConfig.h>
 #include <das/DasTypes.hpp>
 #include <das/IDasBase.h>
 
+#include <vector>
+
 #include <das/Core/IPC/Config.h>
 
 DAS_CORE_IPC_NS_BEGIN
@@ -41,7 +45,8 @@ public:
      * execution.
      *
      * The REMOTE_RELEASE message is always sent fire-and-forget
-     * regardless of the calling thread.
+     * regardless of the calling thread. Releases queued before the IO
+     * thread flushes them go out as a single REMOTE_RELEASE_BATCH.
      */
     ~DasProxyBase() override
     {
@@ -56,26 +61,8 @@ public:
             auto& dom = GetObjectManager();
             dom.UnregisterObject(oid);
 
-            // REMOTE_RELEASE fire-and-forget message (unchanged)
-            std::vector<uint8_t> release_body;
-            release_body.insert(
-                release_body.end(),
-                reinterpret_cast<const uint8_t*>(&oid),
-                reinterpret_cast<const uint8_t*>(&oid) + sizeof(oid));
-
-            auto release_header =
-                IPCMessageHeaderBuilder()
-                    .SetMessageType(MessageType::EVENT)
-                    .SetHeaderFlags(HeaderFlags::BUSINESS_CONTROL)
-                    .SetInterfaceId(
-                        static_cast<uint32_t>(IpcCommandType::REMOTE_RELEASE))
-                    .SetSourceSessionId(GetSourceSessionId())
-                    .SetTargetSessionId(oid.session_id)
-                    .SetBodySize(static_cast<uint32_t>(release_body.size()))
-                    .Build();
-
-            // PostSend is fire-and-forget, does not check result
-            GetRunLoop().PostSend(release_header, std::move(release_body));
+            // REMOTE_RELEASE fire-and-forget, coalesced by the run loop
+            static_cast<void>(GetRunLoop().PostRemoteRelease(oid));
         }
     }
 
@@ -123,9 +110,31 @@ public:
             return DAS_S_OK;
         }
 
-        // 构造请求 Body：ObjectId + DasGuid
+        // 先查本地缓存：之前的远程结果、负缓存和对端发布的接口集合
+        const ObjectId& obj_id = GetObjectId();
+        const auto      cached =
+            proxy_factory_.LookupQueryInterface(obj_id, iid);
+        using CacheKind = ProxyFactory::QueryInterfaceCacheResult::Kind;
+        if (cached.kind == CacheKind::Unsupported)
+        {
+            proxy_factory_.RecordQueryInterface(true);
+            return cached.unsupported_result;
+        }
+        if (cached.kind == CacheKind::Supported)
+        {
+            DasResult local_result = QueryInterfaceFromCache(
+                cached.object_id,
+                cached.interface_id,
+                pp_object);
+            if (DAS::IsOk(local_result))
+            {
+                proxy_factory_.RecordQueryInterface(true);
+                return local_result;
+            }
+        }
+
+        // 构造请求 Body：ObjectId + DasGuid [+ flags]
         // Host 端通过 ObjectId 查找真实对象，通过 iid 调用 QueryInterface
-        const ObjectId&      obj_id = GetObjectId();
         std::vector<uint8_t> body;
         body.insert(
             body.end(),
@@ -135,7 +144,12 @@ public:
             body.end(),
             reinterpret_cast<const uint8_t*>(&iid),
             reinterpret_cast<const uint8_t*>(&iid) + sizeof(DasGuid));
+        if (!cached.has_interface_set)
+        {
+            body.push_back(QUERY_INTERFACE_FLAG_WANT_INTERFACE_SET);
+        }
 
+        proxy_factory_.RecordQueryInterface(false);
         std::vector<uint8_t> response;
         DasResult            result = SendBusinessControlRequest(
             IpcCommandType::QUERY_INTERFACE,
@@ -145,27 +159,50 @@ public:
 
         if (DAS::IsFailed(result))
         {
+            proxy_factory_.StoreQueryInterfaceResult(
+                obj_id,
+                iid,
+                result,
+                ObjectId{},
+                0);
             return result;
         }
 
-        // 解析响应（只读取 result, interface_id, new_object_id）
-        MemorySerializerReader reader(response);
-        int32_t                query_result_val = 0;
-        uint32_t               interface_id = 0;
-        uint64_t               new_object_id = 0;
+        // 解析响应：result, interface_id, new_object_id [+ 接口集合]
+        SpanSerializerReader reader(response);
+        int32_t              query_result_val = 0;
+        uint32_t             interface_id = 0;
+        uint64_t             new_object_id = 0;
         reader.ReadInt32(&query_result_val);
         reader.ReadUInt32(&interface_id);
         reader.ReadUInt64(&new_object_id);
         DasResult query_result = static_cast<DasResult>(query_result_val);
 
+        std::vector<QueryInterfaceSetEntry> interface_set;
+        if (ReadQueryInterfaceSet(
+                response.data() + reader.GetPosition(),
+                reader.GetRemaining(),
+                interface_set))
+        {
+            proxy_factory_.StoreQueryInterfaceSet(
+                obj_id,
+                std::move(interface_set));
+        }
+
+        ObjectId new_obj_id = DecodeObjectId(new_object_id);
+        proxy_factory_.StoreQueryInterfaceResult(
+            obj_id,
+            iid,
+            query_result,
+            new_obj_id,
+            interface_id);
+
         if (DAS::IsFailed(query_result))
         {
             return query_result;
         }
 
         // 根据 interface_id 创建对应的 Proxy（走 ProxyFactory 缓存）
-        ObjectId new_obj_id = DecodeObjectId(new_object_id);
-
         result = CheckRuntimeAvailable("DasProxyBase::QueryInterfaceRemote");
         if (DAS::IsFailed(result))
         {
@@ -190,6 +227,56 @@ public:
         // proxy (DasPtr) 析构时 Release，与 AddRef 配对
     }
 
+private:
+    /// @brief 用缓存的 QueryInterface 结果在本地取得 Proxy
+    ///
+    /// 结果对象已有存活 Proxy 时直接复用。结果对象就是本对象（接口集合中
+    /// same_object 的接口）时可在本地新建 Proxy：新 Proxy 析构时会发送
+    /// REMOTE_RELEASE，因此先以 REMOTE_ADD_REF 为对端补一次注册引用。
+    /// 本对象存活保证对端对象在 REMOTE_ADD_REF 到达前不会被注销。
+    /// @return 不能在本地完成时返回失败，调用方改走远程
+    DasResult QueryInterfaceFromCache(
+        const ObjectId& object_id,
+        uint32_t        interface_id,
+        void**          pp_object)
+    {
+        if (auto proxy = proxy_factory_.TryGetProxy(object_id, interface_id))
+        {
+            *pp_object = proxy.Get();
+            static_cast<IDasBase*>(*pp_object)->AddRef();
+            return DAS_S_OK;
+        }
+
+        if (object_id != GetObjectId()
+            || DAS::IsFailed(
+                CheckRuntimeAvailable("DasProxyBase::QueryInterfaceFromCache")))
+        {
+            return DAS_E_NOT_FOUND;
+        }
+
+        bool created = false;
+        auto [create_result, proxy] = proxy_factory_.GetOrCreateProxy(
+            GetRunLoop(),
+            GetBusinessThread(),
+            object_id,
+            interface_id,
+            &created);
+        if (!proxy)
+        {
+            return create_result;
+        }
+
+        if (created)
+        {
+            // 与待合并的 REMOTE_RELEASE 走同一有序路径
+            static_cast<void>(GetRunLoop().PostRemoteAddRef(object_id));
+        }
+
+        *pp_object = proxy.Get();
+        static_cast<IDasBase*>(*pp_object)->AddRef();
+        return DAS_S_OK;
+    }
+
 protected:
     DasProxyBase(
         uint32_t                      interface_id,
@@ -37,6 +37,20 @@ enum class GoodbyeReason : uint32_t
     RequestedByPeer = 4    ///< 对端请求
 };
 
+/**
+ * @brief 传输升级能力位
+ *
+ * 主进程在 HelloRequestV1::transport_caps 中声明可提供的传输，
+ * Host 在 WelcomeResponseV1::transport_caps 中回填接受的子集。
+ * READY_ACK 之后双方切换到协商出的传输；为 0 时沿用握手所用的传输。
+ */
+enum HandshakeTransportCaps : uint16_t
+{
+    HANDSHAKE_TRANSPORT_CAP_NONE = 0,
+    /// 同机共享内存 SPSC 环（ShmRingIpcTransport）
+    HANDSHAKE_TRANSPORT_CAP_SHM_RING = 0x0001,
+};
+
 /**
  * @brief HelloRequestV1: 主进程 → Host（请求连接）
  *
@@ -52,7 +66,7 @@ struct alignas(8) HelloRequestV1
     uint32_t pid;                 ///< 主进程 ID
     char     plugin_name[64];     ///< 插件名称（UTF-8，null-terminated）
     uint16_t assigned_session_id; ///< 主进程分配给 Host 的 session_id
-    uint16_t reserved;            ///< 保留字段
+    uint16_t transport_caps;      ///< 可提供的传输升级（HandshakeTransportCaps）
 
     static constexpr uint32_t CURRENT_PROTOCOL_VERSION = 3;
     static constexpr size_t   PLUGIN_NAME_SIZE = 64;
@@ -67,9 +81,9 @@ struct alignas(8) HelloRequestV1
  */
 struct alignas(8) WelcomeResponseV1
 {
-    uint16_t session_id; ///< 分配的 session_id（0 表示失败）
-    uint16_t reserved;   ///< 保留字段
-    uint32_t status;     ///< 状态码（0 = 成功）
+    uint16_t session_id;     ///< 分配的 session_id（0 表示失败）
+    uint16_t transport_caps; ///< 接受的传输升级（HandshakeTransportCaps）
+    uint32_t status;         ///< 状态码（0 = 成功）
 
     static constexpr uint32_t STATUS_SUCCESS = 0;
     static constexpr uint32_t STATUS_VERSION_MISMATCH = 1;
@@ -146,6 +160,7 @@ inline void InitHelloRequest(
 {
     req.protocol_version = HelloRequestV1::CURRENT_PROTOCOL_VERSION;
     req.pid = pid;
+    req.transport_caps = HANDSHAKE_TRANSPORT_CAP_NONE;
 
     // 安全复制插件名称
     size_t name_len = 0;
@@ -170,7 +185,7 @@ inline void InitWelcomeResponse(
     uint32_t           status = WelcomeResponseV1::STATUS_SUCCESS)
 {
     resp.session_id = session_id;
-    resp.reserved = 0;
+    resp.transport_caps = HANDSHAKE_TRANSPORT_CAP_NONE;
     resp.status = status;
 }
 
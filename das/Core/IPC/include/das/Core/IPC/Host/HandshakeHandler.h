@@ -43,6 +43,8 @@ namespace Core
                 uint32_t    pid;         ///< 客户端进程 ID
                 std::string plugin_name; ///< 插件名称
                 bool        is_ready;    ///< 是否已完成 Ready 握手
+                uint16_t    transport_caps =
+                    HANDSHAKE_TRANSPORT_CAP_NONE; ///< 协商接受的传输升级
 
                 /**
                  * @brief 最后心跳时间戳
@@ -131,6 +133,10 @@ namespace Core
                 using ClientDisconnectedCallback =
                     std::function<void(uint16_t session_id)>;
                 using ShutdownRequestedCallback = std::function<void()>;
+                using TransportUpgradeOfferedCallback =
+                    std::function<uint16_t(const HelloRequestV1&)>;
+                using TransportUpgradeCommittedCallback =
+                    std::function<void(uint16_t transport_caps)>;
 
                 /**
                  * @brief 析构函数
@@ -158,7 +164,7 @@ namespace Core
                  */
                 boost::asio::awaitable<DasResult> HandleMessage(
                     const ValidatedIPCMessageHeader& header,
-                    const std::vector<uint8_t>&      body,
+                    const IpcMessageBody&            body,
                     IpcResponseSender&               sender,
                     ControlPlaneContext&             ctx) override;
 
@@ -190,6 +196,29 @@ namespace Core
                  */
                 void SetOnShutdownRequested(ShutdownRequestedCallback callback);
 
+                /**
+                 * @brief 设置传输升级提议回调
+                 *
+                 * Hello 携带非零 transport_caps 时触发，返回本端接受的能力
+                 * （会与请求取交集），写入 WelcomeResponseV1::transport_caps。
+                 * 未设置时不接受任何升级。
+                 *
+                 * @param callback 回调函数
+                 */
+                void SetOnTransportUpgradeOffered(
+                    TransportUpgradeOfferedCallback callback);
+
+                /**
+                 * @brief 设置传输升级提交回调
+                 *
+                 * READY_ACK 成功发出后触发（仅当 Hello 阶段接受了升级），
+                 * 此后主进程只会在新传输上发送消息。
+                 *
+                 * @param callback 回调函数
+                 */
+                void SetOnTransportUpgradeCommitted(
+                    TransportUpgradeCommittedCallback callback);
+
                 /**
                  * @brief 检查是否存在指定客户端
                  *
@@ -246,11 +275,13 @@ namespace Core
                  *
                  * @param request 请求
                  * @param response_body 输出响应体
+                 * @param out_transport_caps 首次 ready 时输出待提交的传输升级
                  * @return DasResult
                  */
                 DasResult HandleReadyRequest(
                     const ReadyRequestV1& request,
-                    std::vector<uint8_t>& response_body);
+                    std::vector<uint8_t>& response_body,
+                    uint16_t&             out_transport_caps);
 
                 /**
                  * @brief 处理 HeartbeatV1
@@ -299,6 +330,10 @@ namespace Core
                 ShutdownRequestedCallback
                     on_shutdown_requested_; ///< 关闭请求回调（收到 GOODBYE
                                             ///< 时触发）
+                TransportUpgradeOfferedCallback
+                    on_transport_upgrade_offered_; ///< 传输升级提议回调
+                TransportUpgradeCommittedCallback
+                    on_transport_upgrade_committed_; ///< 传输升级提交回调
             };
 
         } // namespace Host
@@ -66,6 +66,19 @@ namespace Core
                 return std::string("das_ipc_") + std::to_string(main_pid) + "_"
                        + std::to_string(host_pid) + "_shm";
             }
+
+            /**
+             * @brief 生成共享内存环传输的段名称
+             * @param main_pid 主进程 PID
+             * @param host_pid Host 进程 PID
+             */
+            inline std::string MakeShmRingName(
+                uint32_t main_pid,
+                uint32_t host_pid)
+            {
+                return std::string("das_ipc_") + std::to_string(main_pid) + "_"
+                       + std::to_string(host_pid) + "_ring";
+            }
         } // namespace Host
     } // namespace IPC
 } // namespace Core
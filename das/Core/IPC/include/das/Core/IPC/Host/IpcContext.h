@@ -172,6 +172,10 @@ namespace Core
                 /// IPC 运行循环（值成员，构造即初始化）
                 IpcRunLoop run_loop_;
 
+                /// HELLO 阶段打开、等待 READY_ACK 后提交的共享内存环
+                /// （在 run_loop_ 之后声明，确保先于 io_context 析构）
+                std::optional<AnyTransport> pending_ring_transport_;
+
                 /// 业务线程
                 std::shared_ptr<BusinessThread> business_thread_;
 
@@ -304,6 +304,17 @@ private:
     boost::asio::awaitable<DasResult> ReceiveHandshakeReadyAckAsync(
         uint32_t timeout_ms);
 
+    /**
+     * @brief 预创建共享内存环，返回写入 Hello 的 transport_caps
+     * @details 创建失败时返回 HANDSHAKE_TRANSPORT_CAP_NONE，握手照常进行
+     */
+    uint16_t OfferShmRingTransport(uint32_t main_pid);
+
+    /**
+     * @brief READY_ACK 后按协商结果切换到共享内存环或释放预创建的环
+     */
+    void CommitShmRingTransport();
+
     // === 异步启动相关方法 ===
 
     /**
@@ -2,6 +2,7 @@
 
 #include <boost/asio/awaitable.hpp>
 #include <cstdint>
+#include <das/Core/IPC/IpcMessageBody.h>
 #include <das/DasApi.h>
 #include <memory>
 #include <vector>
@@ -121,14 +122,14 @@ public:
     /**
      * @brief 处理 IPC 消息（同步版本）
      * @param header 已验证的消息头
-     * @param body 消息体
+     * @param body 消息体（大消息时借用共享内存段，仅在调用期间有效）
      * @param sender 响应发送器（用于发送响应）
      * @param ctx Stub 上下文（包含 object_manager、run_loop、business_thread）
      * @return DasResult 处理结果
      */
     virtual DasResult HandleMessage(
         const ValidatedIPCMessageHeader& header,
-        const std::vector<uint8_t>&      body,
+        const IpcMessageBody&            body,
         IpcResponseSender&               sender,
         StubContext&                     ctx) = 0;
 };
@@ -191,7 +192,7 @@ public:
      */
     virtual boost::asio::awaitable<DasResult> HandleMessage(
         const ValidatedIPCMessageHeader& header,
-        const std::vector<uint8_t>&      body,
+        const IpcMessageBody&            body,
         IpcResponseSender&               sender,
         ControlPlaneContext&             ctx) = 0;
 };
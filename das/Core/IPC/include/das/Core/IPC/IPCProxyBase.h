@@ -98,7 +98,8 @@ public:
     /// @param out_response [out] 响应体
     /// @param out_flags [out] 可选：响应头 flags 字段（用于检测 SHM_RESPONSE
     /// 等）
-    /// @return DasResult 处理结果
+    /// @return DasResult 处理结果；当前线程处于 IpcCallBatch 录制作用域时
+    /// 只录制请求并返回 DAS_E_IPC_CALL_BATCHED
     /// @note body 参数是完整的 V3 消息体（已包含 Body Header）
     DasResult SendRequest(
         uint16_t              method_id,
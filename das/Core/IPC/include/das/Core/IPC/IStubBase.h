@@ -49,7 +49,7 @@ public:
     /// 解析 V3 Body Header，查找 impl，调用 DispatchMethod
     DasResult HandleMessage(
         const ValidatedIPCMessageHeader& header,
-        const std::vector<uint8_t>&      body,
+        const IpcMessageBody&            body,
         IpcResponseSender&               sender,
         StubContext&                     ctx) override;
 
@@ -75,7 +75,7 @@ private:
     /// 解析 V3 Body Header
     /// @return true 成功，false 失败（body 太短）
     static bool ParseV3BodyHeader(
-        const std::vector<uint8_t>& body,
+        const IpcMessageBody&       body,
         uint32_t&                   out_interface_id,
         uint16_t&                   out_method_id,
         ObjectId&                   out_object_id);
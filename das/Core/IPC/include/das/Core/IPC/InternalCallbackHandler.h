@@ -40,7 +40,7 @@ public:
 
     DasResult HandleMessage(
         const ValidatedIPCMessageHeader& header,
-        const std::vector<uint8_t>&      body,
+        const IpcMessageBody&            body,
         IpcResponseSender&               sender,
         StubContext&                     ctx) override;
 };
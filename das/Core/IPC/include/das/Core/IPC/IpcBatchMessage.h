@@ -0,0 +1,88 @@
+#ifndef DAS_CORE_IPC_IPC_BATCH_MESSAGE_H
+#define DAS_CORE_IPC_IPC_BATCH_MESSAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <das/Core/IPC/IpcErrors.h>
+#include <das/Core/IPC/IpcMessageBody.h>
+#include <das/Core/IPC/IpcMessageHeader.h>
+#include <das/Core/IPC/IpcMessageQueue.h>
+#include <das/Core/IPC/ValidatedIPCMessageHeader.h>
+#include <vector>
+
+#include <das/Core/IPC/Config.h>
+
+DAS_CORE_IPC_NS_BEGIN
+
+/**
+ * @brief 批量信封写入器
+ *
+ * 批量信封是 flags 带 MessageFlags::BATCH 的普通 REQUEST/RESPONSE 帧，
+ * body 布局为：
+ *
+ *   uint32_t count
+ *   count × (IPCMessageHeader(32B) + body[header.body_size])
+ *
+ * 每条内层消息保留完整的 V3 header（call_id、session、interface_id、
+ * error_code、flags），因此接收端拆包后可以沿用单条消息的处理路径。
+ */
+class IpcBatchWriter
+{
+public:
+    IpcBatchWriter();
+
+    /**
+     * @brief 追加一条内层消息
+     * @param header 内层消息头（body_size 按 body_size 参数改写）
+     * @param body 内层消息体
+     * @param body_size 内层消息体大小
+     */
+    void Append(
+        const ValidatedIPCMessageHeader& header,
+        const uint8_t*                   body,
+        size_t                           body_size);
+
+    /// 已追加的消息条数
+    [[nodiscard]]
+    uint32_t Count() const noexcept
+    {
+        return count_;
+    }
+
+    /// 取出编码结果，写入器随后恢复为空信封
+    [[nodiscard]]
+    std::vector<uint8_t> TakeBuffer();
+
+private:
+    std::vector<uint8_t> buffer_;
+    uint32_t             count_ = 0;
+};
+
+/// @brief 判断消息头是否为批量信封
+[[nodiscard]]
+inline bool IsBatchMessage(const ValidatedIPCMessageHeader& header) noexcept
+{
+    return (header.GetFlags() & MessageFlags::BATCH) != 0;
+}
+
+/**
+ * @brief 拆解批量信封
+ *
+ * 内层消息体不做拷贝：全部借用外层 body，由共享的 lease 保持有效；
+ * 外层 body 本身借用 SHM 时，最后一条内层消息释放后才归还共享内存块。
+ *
+ * 信封损坏时 out_messages 仍返回出错位置之前（含出错条目）已解出的
+ * 内层消息头，body 为空，供调用方按 call_id 逐条回复失败而不必等待超时。
+ *
+ * @param body 外层消息体（被接管）
+ * @param out_messages [out] 拆出的内层消息，顺序与写入顺序一致
+ * @return DAS_S_OK 成功；DAS_E_IPC_INVALID_MESSAGE_BODY 信封格式错误；
+ *         DAS_E_IPC_INVALID_MESSAGE_HEADER 内层消息头校验失败
+ */
+DasResult DecodeIpcBatch(
+    IpcMessageBody               body,
+    std::vector<InboundMessage>& out_messages);
+
+DAS_CORE_IPC_NS_END
+
+#endif // DAS_CORE_IPC_IPC_BATCH_MESSAGE_H
@@ -0,0 +1,128 @@
+#ifndef DAS_CORE_IPC_IPC_CALL_BATCH_H
+#define DAS_CORE_IPC_IPC_CALL_BATCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <das/Core/IPC/IpcErrors.h>
+#include <das/Core/IPC/IpcRunLoop.h>
+#include <das/Core/IPC/ValidatedIPCMessageHeader.h>
+#include <vector>
+
+#include <das/Core/IPC/Config.h>
+
+DAS_CORE_IPC_NS_BEGIN
+
+/**
+ * @brief 批量 IPC 调用
+ *
+ * 把多个发往同一 session 的代理调用合并为一个 MessageFlags::BATCH 帧，
+ * 以一次往返代替 N 次往返。适用于一帧内连续调用大量小方法
+ * （如 IDasPortMap getter、IDasOcrResult accessor）的场景。
+ *
+ * 用法：
+ * @code
+ * IpcCallBatch batch;
+ * {
+ *     IpcCallBatch::RecordScope scope{batch};
+ *     // 作用域内代理调用只序列化请求，返回 DAS_E_IPC_CALL_BATCHED
+ *     proxy_a->GetX(&x);
+ *     proxy_b->GetY(&y);
+ * }
+ * auto results = wait(when_all_calls(std::move(batch)));
+ * // results: vector<IpcCallResult>，顺序与录制顺序一致
+ * @endcode
+ *
+ * 录制期间代理的输出参数不会被填充；响应体通过批量 sender 原样返回，
+ * 布局与单条调用的响应体相同（首 4 字节为远端返回码）。
+ * 目标为本地对象的调用在代理内部短路，不经过 SendRequest，仍然立即执行。
+ *
+ * @note 录制成功视为已发送：[in] 接口参数的导出在录制时提交，
+ *       因此录制后的批次必须提交（Submit），丢弃未提交的批次会泄漏导出。
+ * @note 不要在 BusinessThread 上同步等待批量 sender：响应由 IO 线程完成，
+ *       业务线程阻塞会导致对端回调无法被处理。
+ */
+class IpcCallBatch
+{
+public:
+    IpcCallBatch() = default;
+    ~IpcCallBatch();
+
+    IpcCallBatch(IpcCallBatch&& other) noexcept;
+    IpcCallBatch& operator=(IpcCallBatch&& other) noexcept;
+
+    IpcCallBatch(const IpcCallBatch&) = delete;
+    IpcCallBatch& operator=(const IpcCallBatch&) = delete;
+
+    /**
+     * @brief 录制作用域
+     *
+     * 作用域内当前线程发起的代理调用（IPCProxyBase::SendRequest）
+     * 不再发送，而是追加到 batch。作用域可嵌套，内层优先。
+     */
+    class RecordScope
+    {
+    public:
+        explicit RecordScope(IpcCallBatch& batch DAS_LIFETIMEBOUND) noexcept;
+        ~RecordScope();
+
+        RecordScope(const RecordScope&) = delete;
+        RecordScope& operator=(const RecordScope&) = delete;
+
+    private:
+        IpcCallBatch* previous_ = nullptr;
+    };
+
+    /// @brief 获取当前线程正在录制的批次，没有时返回 nullptr
+    [[nodiscard]]
+    static IpcCallBatch* Current() noexcept;
+
+    /**
+     * @brief 追加一条已构建的请求
+     *
+     * @param run_loop 发送所用的 IpcRunLoop（同一批次必须一致）
+     * @param header 已分配 call_id 的 REQUEST 头
+     * @param body 请求体
+     * @param body_size 请求体大小
+     * @return DAS_E_IPC_CALL_BATCHED 已录制；
+     *         DAS_E_IPC_SEND_FAILED run_loop 或目标 session 与批次不一致
+     */
+    DasResult Record(
+        IpcRunLoop&                      run_loop,
+        const ValidatedIPCMessageHeader& header,
+        const uint8_t*                   body,
+        size_t                           body_size);
+
+    /// 已录制的调用数
+    [[nodiscard]]
+    size_t Size() const noexcept
+    {
+        return requests_.size();
+    }
+
+    [[nodiscard]]
+    bool Empty() const noexcept
+    {
+        return requests_.empty();
+    }
+
+    /**
+     * @brief 提交批次，返回 when_all 语义的 sender
+     *
+     * sender 在全部响应到齐后完成，携带与录制顺序一致的
+     * vector<IpcCallResult>。提交后批次恢复为空。
+     *
+     * @param timeout 每条调用的超时时间
+     */
+    [[nodiscard]]
+    AwaitBatchResponseSender Submit(
+        std::chrono::milliseconds timeout = std::chrono::seconds(30)) &&;
+
+private:
+    IpcRunLoop*                  run_loop_ = nullptr;
+    std::vector<IpcBatchRequest> requests_;
+};
+
+DAS_CORE_IPC_NS_END
+
+#endif // DAS_CORE_IPC_IPC_CALL_BATCH_H
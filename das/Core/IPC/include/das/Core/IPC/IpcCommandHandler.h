@@ -51,6 +51,7 @@ enum class IpcCommandType : uint8_t
     // 远程引用计数 (130-139)
     REMOTE_ADD_REF = 130, // 远程端增加引用
     REMOTE_RELEASE = 132, // 远程端释放引用
+    REMOTE_RELEASE_BATCH = 133, // 合并的远程释放：uint32 count + ObjectId[]
 
     // 共享内存管理 (140-149)
     RELEASE_SHM_BLOCK = 140, // 释放共享内存块（fire-and-forget EVENT）
@@ -148,7 +149,7 @@ public:
 
     DasResult HandleMessage(
         const ValidatedIPCMessageHeader& header,
-        const std::vector<uint8_t>&      body,
+        const IpcMessageBody&            body,
         IpcResponseSender&               sender,
         StubContext&                     ctx) override;
 
@@ -7,7 +7,7 @@
 // 直接使用具体数值，便于调试和阅读
 #define DAS_E_IPC_BASE -1080000000
 
-// === 基础错误码 (-1080000001 ~ -1080000031) ===
+// === 基础错误码 (-1080000001 ~ -1080000032) ===
 #define DAS_E_IPC_INVALID_MESSAGE_HEADER (-1080000001)
 #define DAS_E_IPC_INVALID_MESSAGE_TYPE (-1080000002)
 #define DAS_E_IPC_INVALID_MESSAGE_BODY (-1080000003)
@@ -39,6 +39,7 @@
 #define DAS_E_IPC_RECEIVE_FAILED (-1080000029)
 #define DAS_E_IPC_QUEUE_FULL (-1080000030)
 #define DAS_E_IPC_DISCONNECTED (-1080000031)
+#define DAS_E_IPC_CALL_BATCHED (-1080000032)
 
 // === 插件相关错误码 (-1080000100 ~ -1080000106) ===
 #define DAS_E_IPC_PLUGIN_NOT_FOUND (-1080000100)
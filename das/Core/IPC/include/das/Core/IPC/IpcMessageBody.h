@@ -0,0 +1,166 @@
+#ifndef DAS_CORE_IPC_IPC_MESSAGE_BODY_H
+#define DAS_CORE_IPC_IPC_MESSAGE_BODY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <das/Core/IPC/Config.h>
+
+DAS_CORE_IPC_NS_BEGIN
+
+class SharedMemoryPool;
+struct SharedMemoryBlock;
+
+/**
+ * @brief IPC 入站消息体
+ *
+ * 两种存储形态：
+ * - 持有：内部 std::vector<uint8_t>（管道/socket 上直接读取的小消息）
+ * - 借用：指向共享内存段中的只读区域，由引用计数的 lease 保持有效
+ *
+ * 借用形态用于大消息零拷贝接收：transport 不再把 SHM 块复制到堆上，
+ * stub 直接在映射段上反序列化。最后一个引用释放时 lease 负责归还 SHM 块。
+ *
+ * 提供与 std::vector<uint8_t> 相同的只读访问接口（data/size/empty/begin/end/
+ * operator[]），现有只读消费者无需修改。需要可写 vector 的消费者调用
+ * TakeVector()；持有形态为 move，借用形态才会发生一次拷贝。
+ *
+ * @note 借用形态要求对应的 SharedMemoryPool 比消息体活得更久。
+ */
+class IpcMessageBody
+{
+public:
+    IpcMessageBody() = default;
+
+    /// 持有形态：接管 vector（隐式转换，兼容原有 vector 传参）
+    IpcMessageBody(std::vector<uint8_t> owned) noexcept
+        : owned_(std::move(owned))
+    {
+    }
+
+    IpcMessageBody(IpcMessageBody&&) noexcept = default;
+    IpcMessageBody& operator=(IpcMessageBody&&) noexcept = default;
+
+    IpcMessageBody(const IpcMessageBody&) = default;
+    IpcMessageBody& operator=(const IpcMessageBody&) = default;
+
+    /**
+     * @brief 借用形态：引用外部只读内存
+     * @param data 数据起始地址
+     * @param size 数据大小
+     * @param lease 保持 data 有效的引用计数句柄，最后一个引用释放时回收内存
+     */
+    [[nodiscard]]
+    static IpcMessageBody Borrow(
+        const uint8_t*              data,
+        size_t                      size,
+        std::shared_ptr<const void> lease) noexcept
+    {
+        IpcMessageBody body;
+        body.borrowed_data_ = data;
+        body.borrowed_size_ = size;
+        body.lease_ = std::move(lease);
+        return body;
+    }
+
+    /**
+     * @brief 借用一个已分配的共享内存块
+     *
+     * 返回的消息体持有块的 lease，借用期间块不会被 CleanupStaleBlocks
+     * 回收；最后一个引用释放时调用 pool.ReleaseLease(block.handle)。
+     *
+     * @param pool 共享内存池（必须比返回值活得更久）
+     * @param block 由 pool 分配的块
+     * @return 块已被释放时返回空的消息体（IsBorrowed() 为 false）
+     */
+    [[nodiscard]]
+    static IpcMessageBody BorrowSharedMemory(
+        SharedMemoryPool&        pool,
+        const SharedMemoryBlock& block);
+
+    [[nodiscard]]
+    const uint8_t* data() const noexcept
+    {
+        return lease_ ? borrowed_data_ : owned_.data();
+    }
+
+    [[nodiscard]]
+    size_t size() const noexcept
+    {
+        return lease_ ? borrowed_size_ : owned_.size();
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    [[nodiscard]]
+    const uint8_t* begin() const noexcept
+    {
+        return data();
+    }
+
+    [[nodiscard]]
+    const uint8_t* end() const noexcept
+    {
+        return data() + size();
+    }
+
+    [[nodiscard]]
+    const uint8_t& operator[](size_t index) const noexcept
+    {
+        return data()[index];
+    }
+
+    /// 是否为借用形态（数据位于共享内存段）
+    [[nodiscard]]
+    bool IsBorrowed() const noexcept
+    {
+        return static_cast<bool>(lease_);
+    }
+
+    /// 拷贝为独立的 vector
+    [[nodiscard]]
+    std::vector<uint8_t> ToVector() const
+    {
+        return {begin(), end()};
+    }
+
+    /// 取出为 vector：持有形态直接 move，借用形态拷贝后释放 lease
+    [[nodiscard]]
+    std::vector<uint8_t> TakeVector() &&
+    {
+        if (!lease_)
+        {
+            return std::move(owned_);
+        }
+
+        std::vector<uint8_t> result{begin(), end()};
+        Reset();
+        return result;
+    }
+
+    /// 释放持有的数据或 lease
+    void Reset() noexcept
+    {
+        owned_.clear();
+        lease_.reset();
+        borrowed_data_ = nullptr;
+        borrowed_size_ = 0;
+    }
+
+private:
+    std::vector<uint8_t>        owned_;
+    std::shared_ptr<const void> lease_;
+    const uint8_t*              borrowed_data_ = nullptr;
+    size_t                      borrowed_size_ = 0;
+};
+
+DAS_CORE_IPC_NS_END
+
+#endif // DAS_CORE_IPC_IPC_MESSAGE_BODY_H
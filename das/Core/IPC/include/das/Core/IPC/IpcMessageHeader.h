@@ -31,6 +31,8 @@ namespace MessageFlags
     /// bit0: 响应体数据在共享内存中（body 包含 SHM handle + size 而非 raw
     /// data）
     constexpr uint16_t SHM_RESPONSE = 0x0001;
+    /// bit1: 批量信封，body 为 count + N × (header + body)，见 IpcBatchMessage.h
+    constexpr uint16_t BATCH = 0x0002;
 } // namespace MessageFlags
 
 /// @brief IPC 消息类型
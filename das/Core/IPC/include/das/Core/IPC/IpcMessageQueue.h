@@ -2,15 +2,23 @@
 #define DAS_CORE_IPC_IPC_MESSAGE_QUEUE_H
 
 #include <das/Core/IPC/IpcErrors.h>
+#include <das/Core/IPC/IpcMessageBody.h>
 #include <das/Core/IPC/ValidatedIPCMessageHeader.h>
 
-#include <boost/circular_buffer.hpp>
-
-#include <condition_variable>
-#include <mutex>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
 #include <optional>
 #include <type_traits>
-#include <vector>
+#include <utility>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
 DAS_CORE_IPC_NS_BEGIN
 
@@ -33,24 +41,66 @@ struct InboundMessage
     InboundMessage& operator=(const InboundMessage&) = delete;
 
     ValidatedIPCMessageHeader header;
-    std::vector<uint8_t>      body;
+    IpcMessageBody            body; ///< 大消息时借用共享内存段，处理完毕后释放
+};
+
+/// @brief 队列生产者模型
+enum class IpcQueueProducer
+{
+    /// 任意线程均可 Push（IO 线程、PostToBusinessThread 等）
+    Multi,
+    /// 只有一个线程 Push，入队省去 CAS
+    Single,
 };
 
-/// @brief 线程安全的固定容量环形缓冲区队列
-/// @tparam T 队列中存储的元素类型
-template <typename T>
+namespace Details
+{
+    /// 自旋等待期间提示 CPU 让出流水线
+    inline void IpcQueueCpuRelax() noexcept
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    /// 避免生产者/消费者游标伪共享
+    inline constexpr size_t kIpcQueueCacheLine = 64;
+} // namespace Details
+
+/**
+ * @brief 线程安全的固定容量无锁环形队列
+ *
+ * 基于逐槽位序号的有界环（Vyukov 算法）：
+ * - 生产者通过 enqueue 游标占位（Multi 模式用 CAS，Single 模式直接递增），
+ *   写入元素后发布槽位序号，Push 不加锁；
+ * - 消费者（BusinessThread）通过 dequeue 游标 CAS 取槽位，
+ *   因此测试或关闭路径上的并发 TryPop 依旧安全；
+ * - 阻塞出队先短暂自旋，仍为空时在 wake_epoch_ 上 std::atomic::wait 挂起。
+ *   生产者只在有等待者时才 notify，消费者忙碌时 Push 不产生系统调用。
+ *
+ * @tparam T 队列中存储的元素类型
+ * @tparam Producer 生产者模型，默认多生产者
+ */
+template <typename T, IpcQueueProducer Producer = IpcQueueProducer::Multi>
 class IpcMessageQueue
 {
 public:
     /// @brief 构造函数
     /// @param max_elements 队列最大容量
-    explicit IpcMessageQueue(size_t max_elements) : ring_(max_elements) {}
+    explicit IpcMessageQueue(size_t max_elements)
+        : state_(std::make_unique<State>(max_elements))
+    {
+    }
 
     // 禁用拷贝
     IpcMessageQueue(const IpcMessageQueue&) = delete;
     IpcMessageQueue& operator=(const IpcMessageQueue&) = delete;
 
-    // 允许移动
+    // 允许移动（移动时不得有并发访问）
     IpcMessageQueue(IpcMessageQueue&&) = default;
     IpcMessageQueue& operator=(IpcMessageQueue&&) = default;
 
@@ -60,21 +110,24 @@ public:
     /// DAS_E_IPC_CANCELED
     DasResult Push(T msg)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
+        State& s = *state_;
 
-        if (uninitialized_)
+        if (s.uninitialized.load(std::memory_order_acquire))
         {
             return DAS_E_IPC_CANCELED;
         }
 
-        if (ring_.full())
+        size_t pos = 0;
+        Slot*  slot = s.ClaimForPush(pos);
+        if (slot == nullptr)
         {
             return DAS_E_IPC_QUEUE_FULL;
         }
 
-        ring_.push_back(std::move(msg));
-        cv_.notify_one();
+        ::new (static_cast<void*>(slot->storage)) T(std::move(msg));
+        slot->sequence.store(pos + 1, std::memory_order_release);
 
+        s.WakeIfParked();
         return DAS_S_OK;
     }
 
@@ -82,19 +135,8 @@ public:
     /// @return 有元素返回元素，否则返回 nullopt（队列已关闭时）
     std::optional<T> Pop()
     {
-        std::unique_lock<std::mutex> lock(mutex_);
-
-        cv_.wait(lock, [this]() { return !ring_.empty() || uninitialized_; });
-
-        if (uninitialized_ && ring_.empty())
-        {
-            return std::nullopt;
-        }
-
-        T item = std::move(ring_.front());
-        ring_.pop_front();
-
-        return item;
+        auto never_done = [] { return false; };
+        return WaitPop(never_done);
     }
 
     /// @brief 出队（阻塞），也可被外部轻量 predicate 唤醒
@@ -107,66 +149,211 @@ public:
             std::is_invocable_r_v<bool, Predicate&>,
             "IpcMessageQueue::PopUntil predicate must return bool");
 
-        std::unique_lock<std::mutex> lock(mutex_);
-
-        cv_.wait(
-            lock,
-            [this, &is_done]()
-            { return !ring_.empty() || uninitialized_ || is_done(); });
-
-        if (ring_.empty())
-        {
-            return std::nullopt;
-        }
-
-        T item = std::move(ring_.front());
-        ring_.pop_front();
-
-        return item;
+        return WaitPop(is_done);
     }
 
     /// @brief 尝试出队（非阻塞）
     /// @return 有元素返回元素，否则返回 nullopt
-    std::optional<T> TryPop()
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
-
-        if (ring_.empty())
-        {
-            return std::nullopt;
-        }
-
-        T item = std::move(ring_.front());
-        ring_.pop_front();
-
-        return item;
-    }
+    std::optional<T> TryPop() { return state_->TryDequeue(); }
 
     /// @brief 反初始化队列
-    /// @note 反初始化后，Push 返回 DAS_E_IPC_CANCELED，Pop 返回 nullopt
+    /// @note 反初始化后，Push 返回 DAS_E_IPC_CANCELED，Pop 取完剩余元素后返回
+    ///       nullopt
     void Uninitialize()
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        uninitialized_ = true;
-        cv_.notify_all();
+        state_->uninitialized.store(true, std::memory_order_release);
+        state_->WakeAll();
     }
 
     /// @brief 唤醒等待者重新检查队列状态和外部 predicate
-    void NotifyWaiters() { cv_.notify_all(); }
+    void NotifyWaiters() { state_->WakeAll(); }
 
     /// @brief 检查队列是否已反初始化
     /// @return 已反初始化返回 true
     bool IsUninitialized() const
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return uninitialized_;
+        return state_->uninitialized.load(std::memory_order_acquire);
     }
 
+    /// @brief 队列容量
+    size_t Capacity() const noexcept { return state_->capacity; }
+
 private:
-    boost::circular_buffer<T> ring_;
-    mutable std::mutex        mutex_;
-    std::condition_variable   cv_;
-    bool                      uninitialized_ = false;
+    /// 阻塞出队前的自旋次数，覆盖 IO 线程连续投递的典型间隔
+    static constexpr int kSpinCount = 128;
+
+    struct Slot
+    {
+        /// 槽位序号：== pos 可写，== pos + 1 可读
+        std::atomic<size_t> sequence{0};
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* Get() noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    struct State
+    {
+        explicit State(size_t max_elements)
+            : capacity(max_elements == 0 ? 1 : max_elements),
+              slots(std::make_unique<Slot[]>(capacity))
+        {
+            for (size_t i = 0; i < capacity; ++i)
+            {
+                slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        ~State()
+        {
+            while (TryDequeue())
+            {
+            }
+        }
+
+        State(const State&) = delete;
+        State& operator=(const State&) = delete;
+
+        /// 占用一个可写槽位，队列满返回 nullptr
+        Slot* ClaimForPush(size_t& pos) noexcept
+        {
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Slot&        slot = slots[pos % capacity];
+                const size_t seq = slot.sequence.load(std::memory_order_acquire);
+                const auto   diff = static_cast<std::ptrdiff_t>(seq)
+                                  - static_cast<std::ptrdiff_t>(pos);
+                if (diff == 0)
+                {
+                    if constexpr (Producer == IpcQueueProducer::Single)
+                    {
+                        enqueue_pos.store(pos + 1, std::memory_order_relaxed);
+                        return &slot;
+                    }
+                    else if (enqueue_pos.compare_exchange_weak(
+                                 pos,
+                                 pos + 1,
+                                 std::memory_order_relaxed))
+                    {
+                        return &slot;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // 槽位还未被消费：队列已满
+                    return nullptr;
+                }
+                else
+                {
+                    pos = enqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::optional<T> TryDequeue()
+        {
+            size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Slot&        slot = slots[pos % capacity];
+                const size_t seq = slot.sequence.load(std::memory_order_acquire);
+                const auto   diff = static_cast<std::ptrdiff_t>(seq)
+                                  - static_cast<std::ptrdiff_t>(pos + 1);
+                if (diff == 0)
+                {
+                    if (dequeue_pos.compare_exchange_weak(
+                            pos,
+                            pos + 1,
+                            std::memory_order_relaxed))
+                    {
+                        T* item = slot.Get();
+                        std::optional<T> result{std::move(*item)};
+                        item->~T();
+                        slot.sequence.store(
+                            pos + capacity,
+                            std::memory_order_release);
+                        return result;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return std::nullopt;
+                }
+                else
+                {
+                    pos = dequeue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void WakeIfParked() noexcept
+        {
+            // 与 WaitPop 中 parked 递增后的重新检查配对（Dekker 式栅栏）
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (parked.load(std::memory_order_relaxed) != 0)
+            {
+                WakeAll();
+            }
+        }
+
+        void WakeAll() noexcept
+        {
+            wake_epoch.fetch_add(1, std::memory_order_release);
+            wake_epoch.notify_all();
+        }
+
+        const size_t            capacity;
+        std::unique_ptr<Slot[]> slots;
+
+        alignas(Details::kIpcQueueCacheLine) std::atomic<size_t> enqueue_pos{0};
+        alignas(Details::kIpcQueueCacheLine) std::atomic<size_t> dequeue_pos{0};
+        alignas(Details::kIpcQueueCacheLine) std::atomic<uint32_t> wake_epoch{0};
+        std::atomic<uint32_t> parked{0};
+        std::atomic<bool>     uninitialized{false};
+    };
+
+    template <typename Predicate>
+    std::optional<T> WaitPop(Predicate& is_done)
+    {
+        State& s = *state_;
+
+        for (int spin = 0; spin < kSpinCount; ++spin)
+        {
+            if (auto item = s.TryDequeue())
+            {
+                return item;
+            }
+            if (s.uninitialized.load(std::memory_order_acquire) || is_done())
+            {
+                return s.TryDequeue();
+            }
+            Details::IpcQueueCpuRelax();
+        }
+
+        for (;;)
+        {
+            const uint32_t epoch = s.wake_epoch.load(std::memory_order_acquire);
+            s.parked.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            // 登记等待后重新检查，避免错过 Push/Uninitialize/NotifyWaiters
+            auto item = s.TryDequeue();
+            if (item || s.uninitialized.load(std::memory_order_acquire)
+                || is_done())
+            {
+                s.parked.fetch_sub(1, std::memory_order_relaxed);
+                return item ? std::move(item) : s.TryDequeue();
+            }
+
+            s.wake_epoch.wait(epoch, std::memory_order_acquire);
+            s.parked.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<State> state_;
 };
 
 DAS_CORE_IPC_NS_END
@@ -16,6 +16,7 @@ DAS_CORE_IPC_NS_BEGIN
 
 // 前向声明
 class IpcRunLoop;
+class IpcBatchWriter;
 
 /**
  * @brief IPC 响应发送器
@@ -39,6 +40,17 @@ public:
         DasPtr<IHostConnection> connection;
     };
 
+    /**
+     * @brief 批量信封收集路由
+     *
+     * 业务线程处理批量 REQUEST 时使用：响应不立即发送，而是追加到
+     * writer 中，整批处理完毕后作为一个 RESPONSE 帧发出。
+     */
+    struct BatchRoute
+    {
+        IpcBatchWriter* writer = nullptr;
+    };
+
     /**
      * @brief 业务线程 / Host-local session 路由构造函数。
      */
@@ -48,6 +60,8 @@ public:
 
     explicit IpcResponseSender(HostConnectionRoute route);
 
+    explicit IpcResponseSender(BatchRoute route);
+
     /**
      * @brief 同步发送响应（业务线程版本）
      *
@@ -106,7 +120,8 @@ private:
     {
         None,
         Session,
-        HostConnection
+        HostConnection,
+        Batch
     };
 
     DasResult SendViaRoute(
@@ -116,6 +131,7 @@ private:
     RouteKind               route_kind_ = RouteKind::None;
     IpcRunLoop*             run_loop_ = nullptr;
     DasPtr<IHostConnection> connection_;
+    IpcBatchWriter*         batch_writer_ = nullptr;
 };
 
 DAS_CORE_IPC_NS_END
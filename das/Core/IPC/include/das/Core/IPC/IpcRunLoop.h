@@ -17,6 +17,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -151,6 +152,96 @@ struct AwaitResponseSender
     }
 };
 
+//=============================================================================
+// AwaitBatchResponseSender — 批量 IPC 调用（单帧发送，when_all 语义）
+//=============================================================================
+
+/// 单条 IPC 调用的完成结果：<IPC 结果, 响应体, 响应头 flags>
+using IpcCallResult = std::tuple<DasResult, std::vector<uint8_t>, uint16_t>;
+
+/// 批量发送中的单条请求
+struct IpcBatchRequest
+{
+    ValidatedIPCMessageHeader header; ///< 已分配 call_id 的 REQUEST 头
+    std::vector<uint8_t>      body;   ///< 请求体
+    PendingCallCompletion on_complete; ///< 可选的完成回调（非空时注册 pending
+                                       ///< call）
+};
+
+/**
+ * @brief AwaitBatchResponseSender 的共享完成状态
+ *
+ * 每条请求的回调写入各自的槽位，最后一个到达的回调完成 receiver。
+ */
+template <class Receiver>
+struct AwaitBatchResponseState
+{
+    AwaitBatchResponseState(size_t count, Receiver&& rcvr)
+        : results(count), remaining(count), rcvr_(std::move(rcvr))
+    {
+    }
+
+    void Complete(size_t index, IpcCallResult result) noexcept
+    {
+        results[index] = std::move(result);
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            stdexec::set_value(std::move(rcvr_), std::move(results));
+        }
+    }
+
+    std::vector<IpcCallResult> results;
+    std::atomic<size_t>        remaining;
+    Receiver                   rcvr_;
+};
+
+/**
+ * @brief AwaitBatchResponseSender 的 OperationState
+ *
+ * start() 时调用 PostSendBatch：N 个 pending call 在 IO 线程上注册，
+ * 随后 N 个请求合并为一个 MessageFlags::BATCH 帧发送。
+ */
+template <class Receiver>
+struct AwaitBatchResponseOperation
+{
+    IpcRunLoop*                  loop_;
+    std::vector<IpcBatchRequest> requests_;
+    std::chrono::milliseconds    timeout_;
+    Receiver                     rcvr_;
+};
+
+/**
+ * @brief 批量等待 IPC 响应的 sender
+ *
+ * 所有请求必须发往同一 session。对端逐条分发后把 N 个响应合并为
+ * 一个帧返回；全部响应到齐（或各自超时/失败）后一次性完成，
+ * 携带与请求顺序一致的 vector<IpcCallResult>。
+ */
+struct AwaitBatchResponseSender
+{
+    using sender_concept = stdexec::sender_t;
+    using completion_signatures = stdexec::completion_signatures<
+        stdexec::set_value_t(std::vector<IpcCallResult>)>;
+
+    IpcRunLoop*                  loop_;
+    std::vector<IpcBatchRequest> requests_;
+    std::chrono::milliseconds    timeout_;
+
+    template <class Receiver>
+    friend auto tag_invoke(
+        stdexec::connect_t,
+        AwaitBatchResponseSender self,
+        Receiver                 rcvr) noexcept
+        -> AwaitBatchResponseOperation<Receiver>
+    {
+        return {
+            self.loop_,
+            std::move(self.requests_),
+            self.timeout_,
+            std::move(rcvr)};
+    }
+};
+
 //=============================================================================
 // IpcRunLoop — 异步 IPC 运行时
 //=============================================================================
@@ -326,6 +417,68 @@ public:
         std::chrono::steady_clock::time_point deadline =
             std::chrono::steady_clock::time_point::max());
 
+    /**
+     * @brief 投递批量发送任务到 IO 线程
+     *
+     * 线程安全，任何线程可调用。IO 线程先为每条带 on_complete 的请求
+     * 注册 pending call，再把全部请求编码为一个 MessageFlags::BATCH
+     * REQUEST 帧发送。对端以一个批量 RESPONSE 帧返回，接收端拆包后
+     * 按单条 RESPONSE 的规则完成各自的 pending call（或推入业务线程）。
+     *
+     * 发送失败时逐条通知：带回调的请求以错误码完成，其余请求走
+     * NotifySendFailure。
+     *
+     * @param target_session_id 目标 session（所有请求必须一致）
+     * @param requests 业务 REQUEST 列表（不得为空，不得包含控制平面消息）
+     * @param deadline 超时截止时间
+     * @return DasResult 投递结果
+     */
+    DasResult PostSendBatch(
+        uint16_t                              target_session_id,
+        std::vector<IpcBatchRequest>&&        requests,
+        std::chrono::steady_clock::time_point deadline =
+            std::chrono::steady_clock::time_point::max());
+
+    /**
+     * @brief 登记一次 REMOTE_RELEASE，合并后由 IO 线程发送
+     *
+     * 线程安全，任何线程可调用（Proxy 析构时调用）。登记时若队列为空，
+     * 向 IO 线程投递一次 FlushRemoteReleases；在它运行前登记的释放会被
+     * 合并：同一目标 session 的多条释放编码为一个 REMOTE_RELEASE_BATCH
+     * EVENT，只有一条时仍发送 REMOTE_RELEASE。
+     *
+     * @param object_id 要释放的远程对象
+     * @return DasResult 投递结果
+     */
+    DasResult PostRemoteRelease(const ObjectId& object_id);
+
+    /**
+     * @brief 发送一次 REMOTE_ADD_REF，与已登记的 REMOTE_RELEASE 保持顺序
+     *
+     * 线程安全，任何线程可调用。先把 pending_releases_ 中已登记的释放
+     * 发出，再投递 REMOTE_ADD_REF，对端按调用顺序看到两者，不会因释放
+     * 延迟合并而把后发的 ADD_REF 排到先登记的 RELEASE 之前。
+     *
+     * @param object_id 要增加注册引用的远程对象
+     * @return DasResult 投递结果
+     */
+    DasResult PostRemoteAddRef(const ObjectId& object_id);
+
+    /**
+     * @brief 创建批量调用 sender
+     *
+     * @param requests 已分配 call_id 的请求（on_complete 由 sender 接管）
+     * @param timeout 每条调用的超时时间
+     * @return AwaitBatchResponseSender
+     */
+    [[nodiscard]]
+    AwaitBatchResponseSender SendBatchAsync(
+        std::vector<IpcBatchRequest> requests,
+        std::chrono::milliseconds    timeout = std::chrono::seconds(30))
+    {
+        return {this, std::move(requests), timeout};
+    }
+
     /**
      * @brief 投递发送任务到 IO 线程（指定 connected-host owner）
      *
@@ -403,12 +556,12 @@ public:
      */
     boost::asio::awaitable<void> DispatchToHandlerCoroutine(
         const ValidatedIPCMessageHeader& header,
-        const std::vector<uint8_t>&      body,
+        const IpcMessageBody&            body,
         AnyTransport&                    transport);
 
     boost::asio::awaitable<void> DispatchToHandlerCoroutine(
         const ValidatedIPCMessageHeader& header,
-        const std::vector<uint8_t>&      body,
+        const IpcMessageBody&            body,
         DasPtr<IHostConnection>          connection);
 
     /**
@@ -423,7 +576,7 @@ public:
      */
     boost::asio::awaitable<void> RouteIncomingMessage(
         const ValidatedIPCMessageHeader& header,
-        std::vector<uint8_t>             body);
+        IpcMessageBody                   body);
 
     /**
      * @brief Route a received message with a managed-host owner guard.
@@ -438,7 +591,7 @@ public:
      */
     boost::asio::awaitable<void> RouteIncomingMessage(
         const ValidatedIPCMessageHeader& header,
-        std::vector<uint8_t>             body,
+        IpcMessageBody                   body,
         DasPtr<IHostConnection>          connection);
 
     //=========================================================================
@@ -513,16 +666,16 @@ public:
      * @param response 响应体
      */
     void CompletePendingCall(
-        CallKey              call_key,
-        DasResult            result,
-        std::vector<uint8_t> response,
-        uint16_t             response_flags);
+        CallKey        call_key,
+        DasResult      result,
+        IpcMessageBody response,
+        uint16_t       response_flags);
 
     bool TryCompletePendingCallbackOnly(
-        CallKey               call_key,
-        DasResult             result,
-        std::vector<uint8_t>& response,
-        uint16_t              response_flags);
+        CallKey         call_key,
+        DasResult       result,
+        IpcMessageBody& response,
+        uint16_t        response_flags);
 
     /**
      * @brief 扫描并完成所有超时的 pending call
@@ -617,6 +770,10 @@ public:
     /// pending_calls_ 的互斥锁
     mutable std::mutex pending_mutex_;
 
+    /// 等待合并发送的 REMOTE_RELEASE
+    std::mutex            pending_release_mutex_;
+    std::vector<ObjectId> pending_releases_;
+
     /// ConnectionManager for MainProcess mode (nullptr in Host mode)
     std::unique_ptr<ConnectionManager> connection_manager_;
 
@@ -637,6 +794,9 @@ public:
     RemoteObjectRegistry& registry_;
 
 private:
+    /// @brief 发送 pending_releases_ 中积累的全部 REMOTE_RELEASE（线程安全）
+    void FlushRemoteReleases();
+
     /// @brief 发送失败时构造失败 RESPONSE 并推入 inbound_queue_
     /// @param header 原始请求的 header（用于获取 call_id, session_id）
     /// @param error_code 失败原因的错误码
@@ -670,9 +830,22 @@ private:
         PendingCallCompletion                 on_complete,
         std::chrono::steady_clock::time_point deadline);
 
+    /// @brief 按 session_id 查找 transport 并发送一帧
+    /// @return 发送结果；找不到 transport 时返回 DAS_E_IPC_NO_CONNECTIONS
+    boost::asio::awaitable<DasResult> SendToSessionTransportCoroutine(
+        const ValidatedIPCMessageHeader& header,
+        const std::vector<uint8_t>&      body);
+
+    /// @brief 注册批量请求的 pending call 并以单帧发送（由 PostSendBatch
+    /// 委托）
+    boost::asio::awaitable<void> SendBatchToSessionCoroutine(
+        uint16_t                              target_session_id,
+        std::vector<IpcBatchRequest>          requests,
+        std::chrono::steady_clock::time_point deadline);
+
     boost::asio::awaitable<void> DispatchToHandlerWithSender(
         const ValidatedIPCMessageHeader& header,
-        const std::vector<uint8_t>&      body,
+        const IpcMessageBody&            body,
         IpcResponseSender&               sender);
 };
 
@@ -714,6 +887,64 @@ void tag_invoke(
         deadline));
 }
 
+template <class Receiver>
+void tag_invoke(
+    stdexec::start_t,
+    AwaitBatchResponseOperation<Receiver>& self) noexcept
+{
+    const size_t count = self.requests_.size();
+    if (!self.loop_ || count == 0)
+    {
+        std::vector<IpcCallResult> results;
+        results.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            results.emplace_back(
+                DAS_E_IPC_NOT_INITIALIZED,
+                std::vector<uint8_t>{},
+                uint16_t{0});
+        }
+        stdexec::set_value(std::move(self.rcvr_), std::move(results));
+        return;
+    }
+
+    auto state = std::make_shared<AwaitBatchResponseState<Receiver>>(
+        count,
+        std::move(self.rcvr_));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        self.requests_[i].on_complete = [state, i](
+                                            DasResult            result,
+                                            std::vector<uint8_t> response,
+                                            uint16_t response_flags) mutable
+        {
+            state->Complete(
+                i,
+                std::make_tuple(result, std::move(response), response_flags));
+        };
+    }
+
+    const uint16_t target_session_id =
+        self.requests_.front().header.GetTargetSessionId();
+    auto deadline = std::chrono::steady_clock::now() + self.timeout_;
+
+    const DasResult post_result = self.loop_->PostSendBatch(
+        target_session_id,
+        std::move(self.requests_),
+        deadline);
+    if (DAS::IsFailed(post_result))
+    {
+        // 投递失败时回调不会被调用，直接以错误码完成全部槽位
+        for (size_t i = 0; i < count; ++i)
+        {
+            state->Complete(
+                i,
+                std::make_tuple(post_result, std::vector<uint8_t>{}, uint16_t{0}));
+        }
+    }
+}
+
 //=============================================================================
 // SendMessageAsync 实现（必须在头文件中，因为返回 auto 类型）
 //=============================================================================
@@ -20,6 +20,7 @@
 #include <das/DasPtr.hpp>
 #include <das/IDasAsyncLoadPluginOperation.h>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
@@ -156,9 +157,11 @@ namespace Core
                 /// 业务线程
                 std::shared_ptr<BusinessThread> business_thread_;
 
-                /// Created launchers indexed by session_id
+                /// Created launchers indexed by session_id. Launchers are
+                /// created from loader threads and the host pool concurrently.
                 std::unordered_map<uint16_t, DAS::DasPtr<HostLauncher>>
-                    launchers_;
+                                   launchers_;
+                mutable std::mutex launchers_mutex_;
 
                 /// HTTP/WebSocket IPC server (optional, for HTTP transport
                 /// mode)
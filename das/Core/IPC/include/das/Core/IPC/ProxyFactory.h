@@ -5,6 +5,7 @@
 #include <das/Core/IPC/DistributedObjectManager.h>
 #include <das/Core/IPC/IpcErrors.h>
 #include <das/Core/IPC/ObjectId.h>
+#include <das/Core/IPC/QueryInterfaceSet.h>
 #include <das/Core/Logger/Logger.h>
 #include <das/DasPtr.hpp>
 #include <das/IDasBase.h>
@@ -13,6 +14,7 @@
 #include <mutex>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <das/Core/IPC/Config.h>
 #include <das/DasConfig.h>
@@ -71,6 +73,69 @@ public:
         }
     };
 
+    /// 远程 QueryInterface 缓存查询结果
+    struct QueryInterfaceCacheResult
+    {
+        enum class Kind : uint8_t
+        {
+            Miss,        ///< 需要远程查询
+            Unsupported, ///< 已知不支持，返回 unsupported_result
+            Supported,   ///< 已知结果对象 object_id + interface_id
+        };
+
+        Kind      kind = Kind::Miss;
+        DasResult unsupported_result = DAS_E_NO_INTERFACE;
+        ObjectId  object_id{};
+        uint32_t  interface_id = 0;
+        /// 是否已取得该对象的接口集合（Miss 时决定是否请求接口集合）
+        bool has_interface_set = false;
+    };
+
+    struct QueryInterfaceStats
+    {
+        uint64_t remote_calls = 0; ///< 发往对端的 QUERY_INTERFACE 次数
+        uint64_t local_hits = 0;   ///< 由缓存在本地完成的次数
+    };
+
+    /**
+     * @brief 查询 object_id 上 iid 的 QueryInterface 缓存
+     *
+     * 先查之前的远程结果（含不支持的负缓存），再查对端发布的接口集合：
+     * 集合中不存在的 iid 视为不支持；与对象本身指针相同的接口直接以
+     * object_id 访问。缓存随该 ObjectId 的全部 Proxy 释放而失效。
+     */
+    [[nodiscard]]
+    QueryInterfaceCacheResult LookupQueryInterface(
+        const ObjectId& object_id,
+        const DasGuid&  iid) const;
+
+    /// @brief 记录对端发布的接口集合（ObjectId 没有存活 Proxy 时忽略）
+    void StoreQueryInterfaceSet(
+        const ObjectId&                     object_id,
+        std::vector<QueryInterfaceSetEntry> interface_set);
+
+    /// @brief 记录一次远程 QueryInterface 的结果。只缓存成功和
+    /// DAS_E_NO_INTERFACE，其他错误可能是暂时的
+    void StoreQueryInterfaceResult(
+        const ObjectId& object_id,
+        const DasGuid&  iid,
+        DasResult       result,
+        const ObjectId& result_object_id,
+        uint32_t        interface_id);
+
+    void RecordQueryInterface(bool answered_locally) noexcept;
+
+    [[nodiscard]]
+    QueryInterfaceStats GetQueryInterfaceStats() const noexcept;
+
+    /**
+     * @brief 仅在缓存中存在存活 Proxy 时返回它（AddRef），不创建
+     */
+    [[nodiscard]]
+    DasPtr<IDasBase> TryGetProxy(
+        const ObjectId& object_id,
+        uint32_t        interface_id);
+
     void InvalidateCacheEntry(const ObjectId& object_id);
 
     void OnProxyFinalRelease(
@@ -88,13 +153,15 @@ public:
      * @param business_thread BusinessThread weak_ptr（传递给 proxy 构造函数）
      * @param object_id 对象 ID
      * @param interface_id 接口 ID
+     * @param out_created [out, optional] 是否新建了 Proxy
      * @return pair<DasResult, DasPtr<IDasBase>> 错误码 + Proxy 实例
      */
     std::pair<DasResult, DasPtr<IDasBase>> GetOrCreateProxy(
         IpcRunLoop&                   run_loop,
         std::weak_ptr<BusinessThread> business_thread,
         const ObjectId&               object_id,
-        uint32_t                      interface_id);
+        uint32_t                      interface_id,
+        bool*                         out_created = nullptr);
 
     /**
      * @brief 检查 Proxy 实例是否存在
@@ -124,9 +191,34 @@ private:
         std::unordered_map<uint32_t, ProxyCacheEntry> interfaces;
     };
 
+    struct QueryInterfaceResultEntry
+    {
+        DasGuid   iid;
+        DasResult result;
+        ObjectId  object_id;
+        uint32_t  interface_id;
+    };
+
+    struct QueryInterfaceCacheEntry
+    {
+        bool                                   has_interface_set = false;
+        std::vector<QueryInterfaceSetEntry>    interface_set;
+        std::vector<QueryInterfaceResultEntry> results;
+    };
+
+    /// 移除一个 ObjectId 的 Proxy 缓存及其 QueryInterface 缓存
+    void EraseIdentityLocked(
+        std::unordered_map<uint64_t, ProxyIdentityEntry>::iterator it);
+
     // 缓存已创建的 Proxy（非拥有引用，外部 DasPtr 持有唯一强引用）
     std::unordered_map<uint64_t, ProxyIdentityEntry> proxy_cache_;
 
+    // 远程 QueryInterface 缓存，与 proxy_cache_ 同键、同锁、同生命周期
+    std::unordered_map<uint64_t, QueryInterfaceCacheEntry> qi_cache_;
+
+    std::atomic<uint64_t> qi_remote_calls_{0};
+    std::atomic<uint64_t> qi_local_hits_{0};
+
     // 互斥锁保护代理缓存
     mutable std::mutex proxy_cache_mutex_;
 
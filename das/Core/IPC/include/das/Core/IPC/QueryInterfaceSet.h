@@ -0,0 +1,73 @@
+#ifndef DAS_CORE_IPC_QUERY_INTERFACE_SET_H
+#define DAS_CORE_IPC_QUERY_INTERFACE_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <das/IDasBase.h>
+#include <vector>
+
+#include <das/Core/IPC/Config.h>
+
+DAS_CORE_IPC_NS_BEGIN
+
+/**
+ * @brief QUERY_INTERFACE 接口集合协商
+ *
+ * 请求 Body 在 ObjectId + DasGuid 之后可追加 1 字节 flags。带
+ * QUERY_INTERFACE_FLAG_WANT_INTERFACE_SET 时，导出端在响应的
+ * result + interface_id + object_id 之后追加该对象支持的全部接口：
+ *   - uint32_t count
+ *   - count 个 QueryInterfaceSetEntry
+ *
+ * 候选 IID 为本进程能够提供 Stub 的接口（RegisterExportedInterfaceIid）。
+ * 带该 flag 时 QueryInterface 失败也以 error_code = 0 的响应返回，失败码
+ * 写在 Body 的 result 中，确保接口集合能送达。旧版本的两端忽略多余字节。
+ */
+inline constexpr uint8_t QUERY_INTERFACE_FLAG_WANT_INTERFACE_SET = 0x01;
+
+#pragma pack(push, 1)
+struct QueryInterfaceSetEntry
+{
+    DasGuid iid;
+    /// QueryInterface(iid) 返回的指针与导出对象本身相同，
+    /// 调用方可直接以原 ObjectId 访问该接口
+    uint8_t same_object;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(QueryInterfaceSetEntry) == sizeof(DasGuid) + 1);
+
+/**
+ * @brief 登记本进程可导出（有 Stub）的接口 IID。重复登记会被忽略。
+ */
+void RegisterExportedInterfaceIid(const DasGuid& iid);
+
+/**
+ * @brief 获取已登记的可导出接口 IID
+ */
+[[nodiscard]]
+std::vector<DasGuid> GetExportedInterfaceIids();
+
+/**
+ * @brief 探测 object 支持的可导出接口，并按上述格式追加到 out_body
+ *
+ * object 本身是 Proxy 时不探测（否则每个候选 IID 都是一次远程调用），
+ * 此时不追加任何内容。
+ */
+void AppendQueryInterfaceSet(IDasBase* object, std::vector<uint8_t>& out_body);
+
+/**
+ * @brief 解析响应尾部的接口集合
+ * @param data 指向 count 字段
+ * @param size data 的剩余长度
+ * @return 没有接口集合或格式错误时返回 false
+ */
+[[nodiscard]]
+bool ReadQueryInterfaceSet(
+    const uint8_t*                       data,
+    size_t                               size,
+    std::vector<QueryInterfaceSetEntry>& out_entries);
+
+DAS_CORE_IPC_NS_END
+
+#endif // DAS_CORE_IPC_QUERY_INTERFACE_SET_H
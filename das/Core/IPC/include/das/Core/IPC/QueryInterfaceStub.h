@@ -16,11 +16,13 @@ DAS_CORE_IPC_NS_BEGIN
  * Body 格式：
  *   - ObjectId (8B: session_id 2B + generation 2B + local_id 4B)
  *   - DasGuid  (16B)
+ *   - uint8_t flags（可选，见 QueryInterfaceSet.h）
  *
  * 成功响应格式：
  *   - int32_t result
  *   - uint32_t interface_id (FNV-1a hash of DasGuid)
  *   - uint64_t encoded_object_id
+ *   - 接口集合（仅当请求带 QUERY_INTERFACE_FLAG_WANT_INTERFACE_SET）
  *
  * 状态无 → 全局单例，永不销毁。
  */
@@ -47,7 +49,7 @@ public:
 
     DasResult HandleMessage(
         const ValidatedIPCMessageHeader& header,
-        const std::vector<uint8_t>&      body,
+        const IpcMessageBody&            body,
         IpcResponseSender&               sender,
         StubContext&                     ctx) override;
 };
@@ -3,6 +3,7 @@
 
 #include <boost/interprocess/mapped_region.hpp>
 #include <boost/interprocess/shared_memory_object.hpp>
+#include <chrono>
 #include <cstdint>
 #include <das/Core/IPC/IpcErrors.h>
 #include <das/DasExport.h>
@@ -61,7 +62,16 @@ enum class PoolMode
  * - 析构函数自动调用 Uninitialize()（RAII）
  * - Uninitialize() 是幂等的：多次调用安全，仅首次生效
  *
- * 线程安全：所有公共方法都是线程安全的
+ * 分配策略：
+ * - 段内分级（size class）分配：64B 起每个 2 的幂区间分 4 档，最大 64MB
+ * - 每档一个基于块索引的无锁 free list（带 ABA 标签），位于共享段内，
+ *   跨进程共享；热点尺寸（如截图帧缓冲）释放后直接复用，无需加锁
+ * - 块元数据（大小、分配时间）存放在紧邻数据的段内块头中，
+ *   任何打开该池的进程都能通过 handle 解析块
+ * - 超过最大档位的块直接向 segment 申请，释放时立即归还
+ * - segment 空间不足时先把各档空闲块归还 segment 再重试一次
+ *
+ * 线程安全：所有公共方法都是线程安全的，Allocate/Deallocate 在热路径上无锁
  *
  * RAII 模式：使用 Create() 工厂函数创建，析构自动清理
  */
@@ -94,7 +104,22 @@ public:
     DasResult Deallocate(uint64_t handle);
     DasResult GetBlockByHandle(uint64_t handle, SharedMemoryBlock& block);
 
-    DasResult CleanupStaleBlocks();
+    /**
+     * @brief 登记一次对块的借用
+     *
+     * 有未归还借用的块不会被 CleanupStaleBlocks 回收。
+     * @return 块不存在或已释放时返回 DAS_E_IPC_OBJECT_NOT_FOUND
+     */
+    DasResult AcquireLease(uint64_t handle);
+    /// 归还 AcquireLease 登记的借用并释放块
+    DasResult ReleaseLease(uint64_t handle);
+
+    /**
+     * @brief 回收分配时间超过 max_age 且没有借用的块
+     * @param max_age 存活阈值，默认 60 秒
+     */
+    DasResult CleanupStaleBlocks(
+        std::chrono::nanoseconds max_age = std::chrono::seconds{60});
 
     size_t GetTotalSize() const;
     size_t GetUsedSize() const;
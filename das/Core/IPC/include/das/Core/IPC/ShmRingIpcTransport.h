@@ -0,0 +1,148 @@
+#ifndef DAS_CORE_IPC_SHM_RING_IPC_TRANSPORT_H
+#define DAS_CORE_IPC_SHM_RING_IPC_TRANSPORT_H
+
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/io_context.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <das/Core/IPC/AsyncIpcTransport.h>
+#include <das/Core/IPC/SharedMemoryPool.h>
+#include <das/Core/IPC/ValidatedIPCMessageHeader.h>
+#include <das/DasConfig.h>
+#include <das/Utils/Expected.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <variant>
+
+#include <das/Core/IPC/Config.h>
+#include <das/Core/IPC/IpcErrors.h>
+
+DAS_CORE_IPC_NS_BEGIN
+
+/**
+ * @brief 同机共享内存环形缓冲区传输层
+ * @details
+ * 两个 SPSC 字节环（m2h / h2m）位于同一个共享内存段中，
+ * 消息头和消息体直接写入环内，收发路径上没有 socket 系统调用。
+ *
+ * 架构：
+ * - 服务端（主进程）创建段并初始化两个环；客户端（Host）打开同名段
+ * - 每个环带一个门铃：消费者空闲时登记等待，生产者仅在有等待者时敲门铃
+ *   （Linux: futex；Windows: 命名事件；其他平台退化为短睡眠轮询）
+ * - 门铃等待在专用线程上进行，唤醒后投递回 io_context 完成接收协程，
+ *   因此所有收发仍在 io_context 上执行
+ * - 超过 LARGE_MESSAGE_THRESHOLD 的消息仍走 SHM 旁路（kFlagLargeMessage），
+ *   环内只传递句柄
+ *
+ * 该传输不单独建立连接：由握手在已有的 socket/pipe 连接上协商
+ * （HelloRequestV1::transport_caps），READY_ACK 之后双方切换到环上。
+ *
+ * @code
+ * // 主进程（服务端）
+ * auto ring = ShmRingIpcTransport::CreateUninitialized(io);
+ * ring->Initialize(MakeShmRingName(main_pid, host_pid), true);
+ *
+ * // Host（客户端）
+ * auto ring = ShmRingIpcTransport::CreateUninitialized(io);
+ * ring->Initialize(MakeShmRingName(main_pid, host_pid), false);
+ * @endcode
+ */
+class ShmRingIpcTransport
+{
+public:
+    /// 每个方向环的默认容量（字节，必须是 2 的幂）
+    static constexpr size_t DEFAULT_RING_CAPACITY = 1024 * 1024;
+
+    /// 工厂函数：异步创建并初始化 ShmRingIpcTransport 实例
+    /// @param io_context boost::asio io_context 引用（生命周期绑定到返回值）
+    /// @param read_endpoint 共享内存段名称
+    /// @param write_endpoint 忽略（两个方向共用一个段）
+    /// @param is_server true 创建段，false 打开已有段
+    /// @param max_message_size 最大消息体大小（默认64KB）
+    static boost::asio::awaitable<
+        DAS::Utils::Expected<std::unique_ptr<ShmRingIpcTransport>>>
+    CreateAsync(
+        boost::asio::io_context& io_context DAS_LIFETIMEBOUND,
+        const std::string&                  read_endpoint,
+        const std::string&                  write_endpoint,
+        bool                                is_server,
+        size_t                              max_message_size = 65536);
+
+    /// 工厂函数：创建未初始化的 ShmRingIpcTransport 实例
+    static std::unique_ptr<ShmRingIpcTransport> CreateUninitialized(
+        boost::asio::io_context& io_context DAS_LIFETIMEBOUND);
+
+    ~ShmRingIpcTransport();
+
+    ShmRingIpcTransport(const ShmRingIpcTransport&) = delete;
+    ShmRingIpcTransport& operator=(const ShmRingIpcTransport&) = delete;
+    ShmRingIpcTransport(ShmRingIpcTransport&&) noexcept;
+    ShmRingIpcTransport& operator=(ShmRingIpcTransport&&) noexcept;
+
+    /// 异步初始化（协程版本，内部直接调用 Initialize）
+    boost::asio::awaitable<DasResult> InitializeAsync(
+        const std::string& read_endpoint,
+        const std::string& write_endpoint,
+        bool               is_server,
+        size_t             max_message_size = 65536);
+
+    /**
+     * @brief 同步初始化：创建或打开共享内存段
+     *
+     * 段的创建/映射不涉及等待对端，因此可以在握手处理器内同步调用。
+     *
+     * @param segment_name 共享内存段名称
+     * @param is_server true 创建段，false 打开已有段
+     * @param max_message_size 最大消息体大小
+     * @param ring_capacity 每个方向环的容量（2 的幂，至少容纳两条最大消息）
+     * @return DAS_S_OK 成功；DAS_E_IPC_INVALID_ARGUMENT 参数非法；
+     *         DAS_E_IPC_SHM_FAILED 段创建/打开/校验失败
+     */
+    DasResult Initialize(
+        const std::string& segment_name,
+        bool               is_server,
+        size_t             max_message_size = 65536,
+        size_t             ring_capacity = DEFAULT_RING_CAPACITY);
+
+    [[nodiscard]]
+    bool IsConnected() const;
+
+    [[nodiscard]]
+    std::string GetEndpointName() const;
+
+    void SetSharedMemoryPool(SharedMemoryPool* pool);
+
+    /// 获取 io_context 引用
+    boost::asio::io_context& GetIoContext() DAS_LIFETIMEBOUND
+    {
+        return io_context_.get();
+    }
+
+    /// 关闭本端：通知对端、停止门铃线程、唤醒挂起的接收协程
+    void Cleanup();
+
+    /// 异步接收协程
+    [[nodiscard]]
+    boost::asio::awaitable<std::variant<DasResult, AsyncIpcMessage>>
+    ReceiveCoroutine();
+
+    /// 异步发送协程（环满时退避等待对端消费）
+    [[nodiscard]]
+    boost::asio::awaitable<DasResult> SendCoroutine(
+        const ValidatedIPCMessageHeader& header,
+        const uint8_t*                   body,
+        size_t                           body_size);
+
+private:
+    explicit ShmRingIpcTransport(boost::asio::io_context& io_context);
+
+    struct Impl;
+
+    std::reference_wrapper<boost::asio::io_context> io_context_;
+    std::shared_ptr<Impl>                           impl_;
+};
+
+DAS_CORE_IPC_NS_END
+
+#endif // DAS_CORE_IPC_SHM_RING_IPC_TRANSPORT_H
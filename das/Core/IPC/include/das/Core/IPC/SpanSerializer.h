@@ -0,0 +1,280 @@
+#ifndef DAS_CORE_IPC_SPAN_SERIALIZER_H
+#define DAS_CORE_IPC_SPAN_SERIALIZER_H
+
+#include <cstdint>
+#include <cstring>
+#include <das/Core/IPC/IpcErrors.h>
+#include <das/IDasBase.h>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <das/Core/IPC/Config.h>
+
+DAS_CORE_IPC_NS_BEGIN
+/**
+ * 定长缓冲区序列化写入器 - 供生成的 Proxy/Stub 使用
+ *
+ * 与 SerializerWriter 的线格式完全相同，但没有虚函数：调用方先算出
+ * 消息总大小并一次性分配缓冲区，之后每次写入只做一次边界检查和
+ * memcpy，编译器可以将整段编码内联展开。
+ * 定长参数块（#pragma pack(1) 结构体）通过 WritePod 一次写入。
+ */
+class SpanSerializerWriter final
+{
+private:
+    uint8_t* buffer_;
+    size_t   size_;
+    size_t   position_;
+
+public:
+    explicit SpanSerializerWriter(std::span<uint8_t> buffer)
+        : buffer_(buffer.data()), size_(buffer.size()), position_(0)
+    {
+    }
+
+    DasResult Write(const void* data, size_t size)
+    {
+        if (size > size_ - position_)
+        {
+            // 预计算的大小与实际写入不符
+            return DAS_E_IPC_SERIALIZATION_FAILED;
+        }
+        if (size != 0)
+        {
+            std::memcpy(buffer_ + position_, data, size);
+        }
+        position_ += size;
+        return DAS_S_OK;
+    }
+
+    /**
+     * 以一次 memcpy 写入定长的平凡类型（通常是 packed 参数块）
+     */
+    template <class T>
+    DasResult WritePod(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return Write(&value, sizeof(T));
+    }
+
+    size_t GetPosition() const { return position_; }
+
+    size_t GetRemaining() const { return size_ - position_; }
+
+    DasResult WriteInt8(int8_t value) { return WritePod(value); }
+
+    DasResult WriteUInt8(uint8_t value) { return WritePod(value); }
+
+    DasResult WriteInt16(int16_t value) { return WritePod(value); }
+
+    DasResult WriteUInt16(uint16_t value) { return WritePod(value); }
+
+    DasResult WriteInt32(int32_t value) { return WritePod(value); }
+
+    DasResult WriteUInt32(uint32_t value) { return WritePod(value); }
+
+    DasResult WriteInt64(int64_t value) { return WritePod(value); }
+
+    DasResult WriteUInt64(uint64_t value) { return WritePod(value); }
+
+    DasResult WriteFloat(float value) { return WritePod(value); }
+
+    DasResult WriteDouble(double value) { return WritePod(value); }
+
+    DasResult WriteBool(bool value)
+    {
+        return WriteUInt8(static_cast<uint8_t>(value ? 1 : 0));
+    }
+
+    DasResult WriteBytes(const uint8_t* data, size_t size)
+    {
+        auto result = WriteUInt64(static_cast<uint64_t>(size));
+        if (result != DAS_S_OK)
+        {
+            return result;
+        }
+        return Write(data, size);
+    }
+
+    DasResult WriteString(const char* str, size_t length)
+    {
+        return WriteBytes(reinterpret_cast<const uint8_t*>(str), length);
+    }
+
+    DasResult WriteString(const std::string& value)
+    {
+        return WriteString(value.c_str(), value.size());
+    }
+
+    DasResult WriteGuid(const DasGuid& value) { return WritePod(value); }
+
+    DasResult WriteArray(const void* data, size_t size)
+    {
+        auto result = WriteUInt64(static_cast<uint64_t>(size));
+        if (result != DAS_S_OK)
+        {
+            return result;
+        }
+        return Write(data, size);
+    }
+};
+
+/**
+ * 非虚序列化读取器 - 与 SerializerReader 的线格式和接口相同
+ *
+ * 字符串支持零拷贝读取（ReadStringView），返回的指针指向原缓冲区。
+ */
+class SpanSerializerReader final
+{
+private:
+    const uint8_t* buffer_;
+    size_t         size_;
+    size_t         position_;
+
+public:
+    explicit SpanSerializerReader(const uint8_t* buffer, size_t size)
+        : buffer_(buffer), size_(size), position_(0)
+    {
+    }
+
+    explicit SpanSerializerReader(const std::vector<uint8_t>& buffer)
+        : buffer_(buffer.data()), size_(buffer.size()), position_(0)
+    {
+    }
+
+    DasResult Read(void* data, size_t size)
+    {
+        if (size > size_ - position_)
+        {
+            return DAS_E_IPC_DESERIALIZATION_FAILED;
+        }
+        if (size != 0)
+        {
+            std::memcpy(data, buffer_ + position_, size);
+        }
+        position_ += size;
+        return DAS_S_OK;
+    }
+
+    /**
+     * 以一次 memcpy 读取定长的平凡类型（通常是 packed 参数块）
+     */
+    template <class T>
+    DasResult ReadPod(T* value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return Read(value, sizeof(T));
+    }
+
+    size_t GetPosition() const { return position_; }
+
+    size_t GetRemaining() const { return size_ - position_; }
+
+    DasResult ReadRawPointer(const uint8_t** out_ptr, size_t size)
+    {
+        if (size > size_ - position_)
+        {
+            return DAS_E_IPC_DESERIALIZATION_FAILED;
+        }
+        *out_ptr = buffer_ + position_;
+        position_ += size;
+        return DAS_S_OK;
+    }
+
+    DasResult ReadInt8(int8_t* value) { return ReadPod(value); }
+
+    DasResult ReadUInt8(uint8_t* value) { return ReadPod(value); }
+
+    DasResult ReadInt16(int16_t* value) { return ReadPod(value); }
+
+    DasResult ReadUInt16(uint16_t* value) { return ReadPod(value); }
+
+    DasResult ReadInt32(int32_t* value) { return ReadPod(value); }
+
+    DasResult ReadUInt32(uint32_t* value) { return ReadPod(value); }
+
+    DasResult ReadInt64(int64_t* value) { return ReadPod(value); }
+
+    DasResult ReadUInt64(uint64_t* value) { return ReadPod(value); }
+
+    DasResult ReadFloat(float* value) { return ReadPod(value); }
+
+    DasResult ReadDouble(double* value) { return ReadPod(value); }
+
+    DasResult ReadBool(bool* value)
+    {
+        uint8_t bool_value;
+        auto    result = ReadUInt8(&bool_value);
+        if (result == DAS_S_OK)
+        {
+            *value = bool_value != 0;
+        }
+        return result;
+    }
+
+    DasResult ReadGuid(DasGuid* value) { return ReadPod(value); }
+
+    DasResult ReadStringView(const char** out_ptr, size_t* out_len)
+    {
+        uint64_t size;
+        auto     result = ReadUInt64(&size);
+        if (result != DAS_S_OK)
+        {
+            return result;
+        }
+        if (size > GetRemaining())
+        {
+            return DAS_E_IPC_DESERIALIZATION_FAILED;
+        }
+        *out_ptr = reinterpret_cast<const char*>(buffer_ + position_);
+        *out_len = static_cast<size_t>(size);
+        position_ += static_cast<size_t>(size);
+        return DAS_S_OK;
+    }
+
+    DasResult ReadBytes(std::vector<uint8_t>& buffer)
+    {
+        const char* data = nullptr;
+        size_t      size = 0;
+        auto        result = ReadStringView(&data, &size);
+        if (result == DAS_S_OK)
+        {
+            buffer.assign(
+                reinterpret_cast<const uint8_t*>(data),
+                reinterpret_cast<const uint8_t*>(data) + size);
+        }
+        return result;
+    }
+
+    DasResult ReadString(std::string& str)
+    {
+        const char* data = nullptr;
+        size_t      size = 0;
+        auto        result = ReadStringView(&data, &size);
+        if (result == DAS_S_OK)
+        {
+            str.assign(data, size);
+        }
+        return result;
+    }
+
+    DasResult ReadArray(void* data, size_t size)
+    {
+        uint64_t stored_size;
+        auto     result = ReadUInt64(&stored_size);
+        if (result != DAS_S_OK)
+        {
+            return result;
+        }
+        if (stored_size != size)
+        {
+            return DAS_E_IPC_DESERIALIZATION_FAILED;
+        }
+        return Read(data, size);
+    }
+};
+DAS_CORE_IPC_NS_END
+
+#endif // DAS_CORE_IPC_SPAN_SERIALIZER_H
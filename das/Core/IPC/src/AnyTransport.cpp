@@ -135,6 +135,9 @@ AnyTransport::AnyTransport(UnixAsyncIpcTransport&& t) : transport_(std::move(t))
 {
 }
 AnyTransport::AnyTransport(HttpIpcTransport&& t) : transport_(std::move(t)) {}
+AnyTransport::AnyTransport(ShmRingIpcTransport&& t) : transport_(std::move(t))
+{
+}
 
 AnyTransport::~AnyTransport() = default;
 AnyTransport::AnyTransport(AnyTransport&&) noexcept = default;
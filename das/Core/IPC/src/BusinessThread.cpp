@@ -1,6 +1,7 @@
 #include <das/Core/IPC/BusinessThread.h>
 #include <das/Core/IPC/DistributedObjectManager.h>
 #include <das/Core/IPC/IMessageHandler.h>
+#include <das/Core/IPC/IpcBatchMessage.h>
 #include <das/Core/IPC/IpcErrors.h>
 #include <das/Core/IPC/IpcMessageHeader.h>
 #include <das/Core/IPC/IpcMessageHeaderBuilder.h>
@@ -140,93 +141,199 @@ void BusinessThread::ProcessInboundMessage(InboundMessage& msg)
             std::move(msg.body),
             header.GetFlags());
     }
+    else if (
+        header.GetMessageType() == MessageType::REQUEST
+        && IsBatchMessage(header))
+    {
+        ProcessBatchRequest(msg);
+    }
     else
     {
         // REQUEST/EVENT: 分发到 handler
-        IMessageHandler* handler = run_loop_.GetHandler(
-            header.GetHeaderFlags(),
-            header.GetInterfaceId());
+        IpcResponseSender sender(run_loop_);
+        DispatchRequest(header, msg.body, sender);
+    }
+}
 
-        if (handler)
-        {
-            // 创建 IpcResponseSender（业务线程模式）
-            IpcResponseSender sender(run_loop_);
+void BusinessThread::DispatchRequest(
+    const ValidatedIPCMessageHeader& header,
+    const IpcMessageBody&            body,
+    IpcResponseSender&               sender)
+{
+    IMessageHandler* handler =
+        run_loop_.GetHandler(header.GetHeaderFlags(), header.GetInterfaceId());
 
-            // 构造 StubContext 并传递给 handler
-            try
+    if (handler)
+    {
+        // 构造 StubContext 并传递给 handler
+        try
+        {
+            StubContext ctx{
+                proxy_factory_.GetObjectManager(),
+                registry_,
+                run_loop_,
+                weak_from_this(),
+                proxy_factory_,
+                header};
+            auto result = handler->HandleMessage(header, body, sender, ctx);
+
+            if (DAS::IsFailed(result))
             {
-                StubContext ctx{
-                    proxy_factory_.GetObjectManager(),
-                    registry_,
-                    run_loop_,
-                    weak_from_this(),
-                    proxy_factory_,
-                    header};
-                auto result =
-                    handler->HandleMessage(header, msg.body, sender, ctx);
-
-                if (DAS::IsFailed(result))
-                {
-                    DAS_CORE_LOG_WARN(
-                        "BusinessThread: handler returned error: {}",
-                        result);
-                }
+                DAS_CORE_LOG_WARN(
+                    "BusinessThread: handler returned error: {}",
+                    result);
             }
-            catch (const std::exception& e)
+        }
+        catch (const std::exception& e)
+        {
+            DAS_CORE_LOG_ERROR(
+                "BusinessThread: handler threw exception: {}",
+                e.what());
+        }
+        catch (...)
+        {
+            DAS_CORE_LOG_ERROR(
+                "BusinessThread: handler threw unknown exception");
+        }
+    }
+    else
+    {
+        if (header.GetMessageType() == MessageType::REQUEST)
+        {
+            DAS_CORE_LOG_ERROR(
+                "BusinessThread: no handler for REQUEST "
+                "interface_id={}, call_id={}, source={}",
+                header.GetInterfaceId(),
+                header.GetCallId(),
+                header.GetSourceSessionId());
+
+            // 构造 NACK RESPONSE 通知调用方
+            auto nack_header =
+                IPCMessageHeaderBuilder()
+                    .SetCallId(header.GetCallId())
+                    .SetSourceSessionId(header.GetTargetSessionId())
+                    .SetTargetSessionId(header.GetSourceSessionId())
+                    .SetInterfaceId(header.GetInterfaceId())
+                    .SetErrorCode(
+                        static_cast<int32_t>(DAS_E_IPC_COMMAND_NOT_REGISTERED))
+                    .Build();
+
+            std::vector<uint8_t> empty_body;
+            auto send_result = sender.SendResponse(nack_header, empty_body);
+            if (DAS::IsFailed(send_result))
             {
                 DAS_CORE_LOG_ERROR(
-                    "BusinessThread: handler threw exception: {}",
-                    e.what());
+                    "BusinessThread: failed to send NACK, "
+                    "result={}",
+                    send_result);
             }
-            catch (...)
+        }
+        else
+        {
+            DAS_CORE_LOG_WARN(
+                "BusinessThread: no handler for EVENT "
+                "interface_id={}",
+                header.GetInterfaceId());
+        }
+    }
+}
+
+void BusinessThread::ProcessBatchRequest(InboundMessage& msg)
+{
+    const auto batch_header = msg.header;
+
+    IpcBatchWriter writer;
+    const auto     append_error =
+        [&writer](const ValidatedIPCMessageHeader& header, DasResult error)
+    {
+        auto error_header = IPCMessageHeaderBuilder()
+                                .SetCallId(header.GetCallId())
+                                .SetSourceSessionId(header.GetTargetSessionId())
+                                .SetTargetSessionId(header.GetSourceSessionId())
+                                .SetInterfaceId(header.GetInterfaceId())
+                                .SetErrorCode(static_cast<int32_t>(error))
+                                .Build();
+        writer.Append(error_header, nullptr, 0);
+    };
+
+    std::vector<InboundMessage> requests;
+    DasResult decode_result = DecodeIpcBatch(std::move(msg.body), requests);
+    if (DAS::IsFailed(decode_result))
+    {
+        // 出错位置之后的 call_id 无从得知，只能等待超时；
+        // 已解出的调用立即以失败响应返回
+        DAS_CORE_LOG_ERROR(
+            "BusinessThread: malformed batch request: source={}, "
+            "result={}, decodable_calls={}",
+            batch_header.GetSourceSessionId(),
+            decode_result,
+            requests.size());
+        for (const auto& request : requests)
+        {
+            if (request.header.GetMessageType() == MessageType::REQUEST)
             {
-                DAS_CORE_LOG_ERROR(
-                    "BusinessThread: handler threw unknown exception");
+                append_error(request.header, DAS_E_IPC_SERIALIZATION_FAILED);
             }
         }
-        else
+        if (writer.Count() == 0)
         {
-            if (header.GetMessageType() == MessageType::REQUEST)
+            return;
+        }
+    }
+    else
+    {
+        IpcResponseSender batch_sender(IpcResponseSender::BatchRoute{&writer});
+
+        for (auto& request : requests)
+        {
+            const auto& header = request.header;
+            const auto  responses_before = writer.Count();
+
+            if (header.GetMessageType() == MessageType::REQUEST
+                && (header.GetHeaderFlags() & HeaderFlags::CONTROL_PLANE) == 0
+                && !IsBatchMessage(header))
             {
-                DAS_CORE_LOG_ERROR(
-                    "BusinessThread: no handler for REQUEST "
-                    "interface_id={}, call_id={}, source={}",
-                    header.GetInterfaceId(),
-                    header.GetCallId(),
-                    header.GetSourceSessionId());
-
-                // 构造 NACK RESPONSE 通知调用方
-                auto nack_header =
-                    IPCMessageHeaderBuilder()
-                        .SetCallId(header.GetCallId())
-                        .SetSourceSessionId(header.GetTargetSessionId())
-                        .SetTargetSessionId(header.GetSourceSessionId())
-                        .SetInterfaceId(header.GetInterfaceId())
-                        .SetErrorCode(
-                            static_cast<int32_t>(
-                                DAS_E_IPC_COMMAND_NOT_REGISTERED))
-                        .Build();
-
-                IpcResponseSender    sender(run_loop_);
-                std::vector<uint8_t> empty_body;
-                auto send_result = sender.SendResponse(nack_header, empty_body);
-                if (DAS::IsFailed(send_result))
-                {
-                    DAS_CORE_LOG_ERROR(
-                        "BusinessThread: failed to send NACK, "
-                        "result={}",
-                        send_result);
-                }
+                DispatchRequest(header, request.body, batch_sender);
             }
             else
             {
-                DAS_CORE_LOG_WARN(
-                    "BusinessThread: no handler for EVENT "
-                    "interface_id={}",
-                    header.GetInterfaceId());
+                DAS_CORE_LOG_ERROR(
+                    "BusinessThread: unsupported message in batch request: "
+                    "msg_type={}, header_flags={}, call_id={}",
+                    static_cast<int>(header.GetMessageType()),
+                    header.GetHeaderFlags(),
+                    header.GetCallId());
+            }
+
+            if (writer.Count() == responses_before
+                && header.GetMessageType() == MessageType::REQUEST)
+            {
+                append_error(header, DAS_E_IPC_REMOTE_ERROR);
             }
         }
     }
+
+    std::vector<uint8_t> envelope = writer.TakeBuffer();
+    auto response_header =
+        IPCMessageHeaderBuilder()
+            .SetMessageType(MessageType::RESPONSE)
+            .SetCallId(batch_header.GetCallId())
+            .SetSourceSessionId(batch_header.GetTargetSessionId())
+            .SetTargetSessionId(batch_header.GetSourceSessionId())
+            .SetFlags(MessageFlags::BATCH)
+            .SetBodySize(static_cast<uint32_t>(envelope.size()))
+            .Build();
+
+    IpcResponseSender sender(run_loop_);
+    auto send_result = sender.SendResponse(response_header, std::move(envelope));
+    if (DAS::IsFailed(send_result))
+    {
+        DAS_CORE_LOG_ERROR(
+            "BusinessThread: failed to send batch response, count={}, "
+            "result={}",
+            requests.size(),
+            send_result);
+    }
 }
 
 DasResult BusinessThread::PumpUntilResponse(
@@ -263,7 +370,7 @@ DasResult BusinessThread::PumpUntilResponse(
             if (call_key == my_call_key)
             {
                 // 匹配我的响应
-                out_response = std::move(msg.body);
+                out_response = std::move(msg.body).TakeVector();
                 if (out_flags)
                 {
                     *out_flags = msg.header.GetFlags();
@@ -42,6 +42,8 @@ struct ConnectionManager::Impl
     std::unordered_map<uint16_t, DasPtr<IHostConnection>> hosts_;
     // Host-local transports owned by Host-side IpcContext.
     std::unordered_map<uint16_t, AnyTransport> host_local_transports_;
+    // 传输升级后被替换下来的旧传输，随连接资源一起清理
+    std::unordered_map<uint16_t, AnyTransport> retired_host_local_transports_;
     // 共享内存池（每个连接一个，按 remote_id 索引）
     std::unordered_map<uint16_t, std::unique_ptr<SharedMemoryPool>> shm_pools_;
     mutable std::shared_mutex connections_mutex_;
@@ -68,6 +70,7 @@ ConnectionManager::~ConnectionManager()
     impl_->connections_.clear();
     impl_->hosts_.clear();
     impl_->host_local_transports_.clear();
+    impl_->retired_host_local_transports_.clear();
 }
 
 DasResult ConnectionManager::RegisterConnection(
@@ -398,6 +401,34 @@ DasResult ConnectionManager::RegisterHostLocalTransport(
     return DAS_S_OK;
 }
 
+DasResult ConnectionManager::ReplaceHostLocalTransport(
+    uint16_t       session_id,
+    AnyTransport&& t)
+{
+    if (!t.IsConnected())
+    {
+        return DAS_E_INVALID_ARGUMENT;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(impl_->connections_mutex_);
+    auto it = impl_->host_local_transports_.find(session_id);
+    if (it == impl_->host_local_transports_.end())
+    {
+        return DAS_E_IPC_OBJECT_NOT_FOUND;
+    }
+
+    // 旧传输保持打开：对端切换前不会因为 EOF 误判断线
+    impl_->retired_host_local_transports_.insert_or_assign(
+        session_id,
+        std::move(it->second));
+    it->second = std::move(t);
+    DAS_CORE_LOG_INFO(
+        "Host-local transport replaced: session_id = {}, endpoint = {}",
+        session_id,
+        it->second.GetEndpointName());
+    return DAS_S_OK;
+}
+
 DasPtr<IHostConnection> ConnectionManager::GetInternalHost(
     uint16_t session_id) const
 {
@@ -809,6 +840,7 @@ DasResult ConnectionManager::CleanupConnectionResources(uint16_t remote_id)
 
     // 清理 AnyTransport before SHM because transports may borrow SHM state.
     impl_->host_local_transports_.erase(remote_id);
+    impl_->retired_host_local_transports_.erase(remote_id);
 
     // 清理 SHM pool（unique_ptr 自动析构）
     impl_->shm_pools_.erase(remote_id);
@@ -71,7 +71,7 @@ namespace Core
 
             boost::asio::awaitable<DasResult> HandshakeHandler::HandleMessage(
                 const ValidatedIPCMessageHeader& header,
-                const std::vector<uint8_t>&      body,
+                const IpcMessageBody&            body,
                 IpcResponseSender&               sender,
                 ControlPlaneContext&             ctx)
             {
@@ -82,6 +82,8 @@ namespace Core
 
                 std::vector<uint8_t> response_body;
                 DasResult            result = DAS_S_OK;
+                uint16_t             committed_transport_caps =
+                    HANDSHAKE_TRANSPORT_CAP_NONE;
 
                 // 根据接口 ID 调用对应的处理函数
                 switch (interface_id)
@@ -116,7 +118,10 @@ namespace Core
                     }
                     const ReadyRequestV1* request =
                         reinterpret_cast<const ReadyRequestV1*>(body.data());
-                    result = HandleReadyRequest(*request, response_body);
+                    result = HandleReadyRequest(
+                        *request,
+                        response_body,
+                        committed_transport_caps);
                     break;
                 }
 
@@ -226,6 +231,14 @@ namespace Core
                         response_body);
                 }
 
+                // READY_ACK 已经在旧传输上发出，之后主进程只使用新传输
+                if (DAS::IsOk(result)
+                    && committed_transport_caps != HANDSHAKE_TRANSPORT_CAP_NONE
+                    && on_transport_upgrade_committed_)
+                {
+                    on_transport_upgrade_committed_(committed_transport_caps);
+                }
+
                 co_return result;
             }
 
@@ -247,6 +260,18 @@ namespace Core
                 on_shutdown_requested_ = std::move(callback);
             }
 
+            void HandshakeHandler::SetOnTransportUpgradeOffered(
+                TransportUpgradeOfferedCallback callback)
+            {
+                on_transport_upgrade_offered_ = std::move(callback);
+            }
+
+            void HandshakeHandler::SetOnTransportUpgradeCommitted(
+                TransportUpgradeCommittedCallback callback)
+            {
+                on_transport_upgrade_committed_ = std::move(callback);
+            }
+
             bool HandshakeHandler::HasClient(uint16_t session_id) const
             {
                 std::lock_guard<std::mutex> lock(clients_mutex_);
@@ -363,6 +388,14 @@ namespace Core
                 client.is_ready = false;
                 client.last_heartbeat = std::chrono::steady_clock::now();
 
+                if (request.transport_caps != HANDSHAKE_TRANSPORT_CAP_NONE
+                    && on_transport_upgrade_offered_)
+                {
+                    client.transport_caps = static_cast<uint16_t>(
+                        on_transport_upgrade_offered_(request)
+                        & request.transport_caps);
+                }
+
                 {
                     std::lock_guard<std::mutex> lock(clients_mutex_);
                     clients_[session_id] = client;
@@ -380,6 +413,7 @@ namespace Core
                     response,
                     session_id,
                     WelcomeResponseV1::STATUS_SUCCESS);
+                response.transport_caps = client.transport_caps;
 
                 response_body.resize(sizeof(response));
                 std::memcpy(response_body.data(), &response, sizeof(response));
@@ -409,7 +443,8 @@ namespace Core
 
             DasResult HandshakeHandler::HandleReadyRequest(
                 const ReadyRequestV1& request,
-                std::vector<uint8_t>& response_body)
+                std::vector<uint8_t>& response_body,
+                uint16_t&             out_transport_caps)
             {
                 std::lock_guard<std::mutex> lock(clients_mutex_);
 
@@ -445,6 +480,7 @@ namespace Core
                 }
 
                 it->second.is_ready = true;
+                out_transport_caps = it->second.transport_caps;
 
                 std::string msg = DAS_FMT_NS::format(
                     "HandshakeHandler: Client ready: session_id={}, plugin={}",
@@ -6,6 +6,7 @@
 #include <das/Core/IPC/IpcCommandHandler.h>
 #include <das/Core/IPC/MethodMetadata.h>
 #include <das/Core/IPC/ObjectId.h>
+#include <das/Core/IPC/QueryInterfaceSet.h>
 #include <das/Core/Logger/Logger.h>
 #include <das/Utils/StringUtils.h>
 #include <das/Utils/fmt.h>
@@ -145,6 +146,12 @@ namespace Das::Core::IPC::Host
 
             DasGuid iid;
             std::memcpy(&iid, payload.data() + offset, sizeof(iid));
+            offset += sizeof(iid);
+
+            const bool want_interface_set =
+                payload.size() > offset
+                && (payload[offset] & QUERY_INTERFACE_FLAG_WANT_INTERFACE_SET)
+                       != 0;
 
             DAS::DasPtr<IDasBase> raw_obj;
             DasResult             lookup_result =
@@ -185,6 +192,14 @@ namespace Das::Core::IPC::Host
                     sizeof(fail_result));
                 AppendBytes(response.response_data, &zero32, sizeof(zero32));
                 AppendBytes(response.response_data, &zero64, sizeof(zero64));
+                if (want_interface_set)
+                {
+                    // Keep the body: the failure is reported in it only
+                    AppendQueryInterfaceSet(
+                        raw_obj.Get(),
+                        response.response_data);
+                    response.error_code = DAS_S_OK;
+                }
                 return qi_result;
             }
 
@@ -213,6 +228,10 @@ namespace Das::Core::IPC::Host
                 response.response_data,
                 &encoded_id,
                 sizeof(encoded_id));
+            if (want_interface_set)
+            {
+                AppendQueryInterfaceSet(raw_obj.Get(), response.response_data);
+            }
 
             DAS_LOG_INFO(
                 DAS_FMT_NS::format(
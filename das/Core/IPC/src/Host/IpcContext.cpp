@@ -18,6 +18,7 @@
 #include <das/Core/IPC/IpcTransport.h>
 #include <das/Core/IPC/ManualProxyRegistry.h>
 #include <das/Core/IPC/RemoteObjectRegistry.h>
+#include <das/Core/IPC/ShmRingIpcTransport.h>
 #include <das/Core/IPC/SharedMemoryPool.h>
 #include <das/Core/Logger/Logger.h>
 #include <das/DasApi.h>
@@ -228,6 +229,70 @@ namespace Core
                         RequestShutdown(HOST_SHUTDOWN_REASON_GOODBYE);
                     });
 
+                // 主进程提议共享内存环：在 HELLO 阶段打开段，
+                // 发送 READY_ACK 后再替换 ConnectionManager 中的传输
+                handshake_handler_->SetOnTransportUpgradeOffered(
+                    [this](const HelloRequestV1& request) -> uint16_t
+                    {
+                        pending_ring_transport_.reset();
+                        if (use_http_transport_ || main_pid_ == 0
+                            || (request.transport_caps
+                                & HANDSHAKE_TRANSPORT_CAP_SHM_RING)
+                                   == 0)
+                        {
+                            return HANDSHAKE_TRANSPORT_CAP_NONE;
+                        }
+
+                        auto ring = ShmRingIpcTransport::CreateUninitialized(
+                            run_loop_.GetIoContext());
+                        if (shared_memory_)
+                        {
+                            ring->SetSharedMemoryPool(&*shared_memory_);
+                        }
+                        const auto result = ring->Initialize(
+                            MakeShmRingName(main_pid_, host_pid_),
+                            false);
+                        if (DAS::IsFailed(result))
+                        {
+                            DAS_CORE_LOG_WARN(
+                                "Host: shared-memory ring unavailable, "
+                                "staying on pipe transport: {}",
+                                result);
+                            return HANDSHAKE_TRANSPORT_CAP_NONE;
+                        }
+
+                        pending_ring_transport_.emplace(std::move(*ring));
+                        return HANDSHAKE_TRANSPORT_CAP_SHM_RING;
+                    });
+
+                handshake_handler_->SetOnTransportUpgradeCommitted(
+                    [this](uint16_t transport_caps)
+                    {
+                        if ((transport_caps & HANDSHAKE_TRANSPORT_CAP_SHM_RING)
+                                == 0
+                            || !pending_ring_transport_)
+                        {
+                            return;
+                        }
+
+                        constexpr uint16_t main_process_session_id = 1;
+                        const auto         result =
+                            run_loop_.GetConnectionManager()
+                                .ReplaceHostLocalTransport(
+                                    main_process_session_id,
+                                    std::move(*pending_ring_transport_));
+                        pending_ring_transport_.reset();
+                        if (DAS::IsFailed(result))
+                        {
+                            DAS_CORE_LOG_ERROR(
+                                "Host: failed to switch to shared-memory ring: "
+                                "{}",
+                                result);
+                            RequestShutdown(
+                                HOST_SHUTDOWN_REASON_TRANSPORT_DISCONNECTED);
+                        }
+                    });
+
                 // 注册消息处理器
                 // HandshakeHandler 处理所有控制平面消息（协程版本）
                 // 注册为 CONTROL_PLANE 标志，按 interface_id 路由
@@ -262,6 +327,18 @@ namespace Core
                     static_cast<uint32_t>(IpcCommandType::REMOTE_RELEASE),
                     command_handler_.Get());
 
+                // REMOTE_RELEASE_BATCH / REMOTE_ADD_REF (fire-and-forget EVENT)
+                run_loop_.RegisterHandler(
+                    HeaderFlags::BUSINESS_CONTROL,
+                    static_cast<uint32_t>(
+                        IpcCommandType::REMOTE_RELEASE_BATCH),
+                    command_handler_.Get());
+
+                run_loop_.RegisterHandler(
+                    HeaderFlags::BUSINESS_CONTROL,
+                    static_cast<uint32_t>(IpcCommandType::REMOTE_ADD_REF),
+                    command_handler_.Get());
+
                 // RELEASE_SHM_BLOCK (fire-and-forget EVENT)
                 run_loop_.RegisterHandler(
                     HeaderFlags::BUSINESS_CONTROL,
@@ -338,6 +415,7 @@ namespace Core
 
                 // 4. 关闭 HTTP 客户端（如果存在）
                 http_client_.reset();
+                pending_ring_transport_.reset();
 
                 // 5. IpcRunLoop 是值成员，析构时自动清理
                 //    必须在关闭 HandshakeHandler 之前，因为 handlers_by_flags_
@@ -16,6 +16,7 @@
 #include <das/Core/IPC/IpcMessageHeader.h>
 #include <das/Core/IPC/IpcMessageHeaderBuilder.h>
 #include <das/Core/IPC/MainProcess/IHostLauncher.h>
+#include <das/Core/IPC/ShmRingIpcTransport.h>
 #include <das/Core/Logger/Logger.h>
 #include <das/DasPtr.hpp>
 #include <das/IDasAsyncHandshakeOperation.h>
@@ -64,6 +65,12 @@ struct HostLauncher::Impl
     boost::asio::io_context& io_ctx; // 引用，由外部管理生命周期
     std::unique_ptr<boost::process::v2::process> process;
     std::optional<AnyTransport>                  async_transport;
+    // 握手期间预先创建的共享内存环，READY_ACK 后替换 async_transport
+    std::optional<AnyTransport> pending_ring_transport;
+    // 切换到共享内存环后保留原 socket/pipe 传输，避免对端读到 EOF
+    std::optional<AnyTransport> retired_transport;
+    uint16_t                    offered_transport_caps = 0;
+    uint16_t                    accepted_transport_caps = 0;
     // 用于取消 StartLaunchSequence 中 co_spawn 的 process-exit watcher 协程。
     // Stop()/TerminateIfRunning() 在 process.reset() 前 emit 信号并 drain
     // io_context，避免 io_context 线程在 freed handle 上执行 async_wait。
@@ -751,6 +758,8 @@ void HostLauncher::Stop()
     }
 
     CleanupTransport(impl_->async_transport);
+    CleanupTransport(impl_->pending_ring_transport);
+    CleanupTransport(impl_->retired_transport);
 
     if (impl_->process)
     {
@@ -933,6 +942,8 @@ void HostLauncher::TerminateIfRunning()
     }
 
     CleanupTransport(impl_->async_transport);
+    CleanupTransport(impl_->pending_ring_transport);
+    CleanupTransport(impl_->retired_transport);
 
     impl_->is_running = false;
     impl_->session_id = 0;
@@ -1209,6 +1220,7 @@ boost::asio::awaitable<DasResult> HostLauncher::SendHandshakeHelloAsync(
     HelloRequestV1 hello;
     InitHelloRequest(hello, my_pid, client_name.c_str());
     hello.assigned_session_id = assigned_session_id;
+    hello.transport_caps = OfferShmRingTransport(my_pid);
 
     constexpr uint16_t MAIN_PROCESS_SESSION_ID = 1;
 
@@ -1305,11 +1317,15 @@ boost::asio::awaitable<DasResult> HostLauncher::ReceiveHandshakeWelcomeAsync(
     }
 
     out_session_id = welcome.session_id;
+    // 只承认本端提出过的能力
+    impl_->accepted_transport_caps = static_cast<uint16_t>(
+        welcome.transport_caps & impl_->offered_transport_caps);
 
     std::string info_msg = DAS_FMT_NS::format(
-        "Received Welcome: session_id={}, status={}",
+        "Received Welcome: session_id={}, status={}, transport_caps={}",
         welcome.session_id,
-        welcome.status);
+        welcome.status,
+        impl_->accepted_transport_caps);
     DAS_LOG_INFO(info_msg.c_str());
 
     co_return DAS_S_OK;
@@ -1422,9 +1438,69 @@ boost::asio::awaitable<DasResult> HostLauncher::ReceiveHandshakeReadyAckAsync(
         DAS_FMT_NS::format("Received ReadyAck: status={}", ack.status);
     DAS_LOG_INFO(info_msg.c_str());
 
+    CommitShmRingTransport();
+
     co_return DAS_S_OK;
 }
 
+uint16_t HostLauncher::OfferShmRingTransport(uint32_t main_pid)
+{
+    CleanupTransport(impl_->pending_ring_transport);
+    impl_->pending_ring_transport.reset();
+    impl_->offered_transport_caps = HANDSHAKE_TRANSPORT_CAP_NONE;
+    impl_->accepted_transport_caps = HANDSHAKE_TRANSPORT_CAP_NONE;
+
+    if (impl_->pid == 0)
+    {
+        return HANDSHAKE_TRANSPORT_CAP_NONE;
+    }
+
+    auto ring = ShmRingIpcTransport::CreateUninitialized(impl_->io_ctx);
+    const auto result =
+        ring->Initialize(Host::MakeShmRingName(main_pid, impl_->pid), true);
+    if (DAS::IsFailed(result))
+    {
+        // 共享内存环只是优化，失败时继续使用当前传输
+        std::string msg = DAS_FMT_NS::format(
+            "Shared-memory ring unavailable, staying on socket transport: "
+            "error={}",
+            result);
+        DAS_CORE_LOG_WARN(msg.c_str());
+        return HANDSHAKE_TRANSPORT_CAP_NONE;
+    }
+
+    impl_->pending_ring_transport.emplace(std::move(*ring));
+    impl_->offered_transport_caps = HANDSHAKE_TRANSPORT_CAP_SHM_RING;
+    return impl_->offered_transport_caps;
+}
+
+void HostLauncher::CommitShmRingTransport()
+{
+    if (!impl_->pending_ring_transport)
+    {
+        return;
+    }
+
+    if ((impl_->accepted_transport_caps & HANDSHAKE_TRANSPORT_CAP_SHM_RING)
+        == 0)
+    {
+        // Host 未接受升级，释放预创建的段
+        CleanupTransport(impl_->pending_ring_transport);
+        impl_->pending_ring_transport.reset();
+        return;
+    }
+
+    // Host 在发送 READY_ACK 后切换，之后的消息只会出现在环上
+    impl_->retired_transport = std::move(impl_->async_transport);
+    impl_->async_transport = std::move(impl_->pending_ring_transport);
+    impl_->pending_ring_transport.reset();
+
+    std::string msg = DAS_FMT_NS::format(
+        "Switched to shared-memory ring transport: host_pid={}",
+        impl_->pid);
+    DAS_LOG_INFO(msg.c_str());
+}
+
 boost::asio::awaitable<DasResult> HostLauncher::PerformFullHandshakeAsync(
     uint16_t& out_session_id,
     uint32_t  timeout_ms)
@@ -1,6 +1,7 @@
 #include <das/Core/IPC/BusinessThread.h>
 #include <das/Core/IPC/Config.h>
 #include <das/Core/IPC/IPCProxyBase.h>
+#include <das/Core/IPC/IpcCallBatch.h>
 #include <das/Core/IPC/IpcRunLoop.h>
 #include <das/Core/IPC/IpcRuntimeState.h>
 #include <das/Core/IPC/ProxyFactory.h>
@@ -124,6 +125,12 @@ DasResult IPCProxyBase::SendRequest(
     ValidatedIPCMessageHeader header =
         BuildRequestHeader(call_id, MessageType::REQUEST, body_size);
 
+    // IpcCallBatch 录制中：只记录请求，由批量 sender 统一发送
+    if (auto* batch = IpcCallBatch::Current())
+    {
+        return batch->Record(run_loop_, header, body, body_size);
+    }
+
     // 3. Construct call_key and wait for response using
     //    thread-appropriate strategy
     CallKey call_key{object_id_.session_id, call_id};
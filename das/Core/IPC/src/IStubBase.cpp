@@ -11,7 +11,7 @@ DAS_CORE_IPC_NS_BEGIN
 constexpr size_t V3_BODY_HEADER_SIZE = 16;
 
 bool IStubBase::ParseV3BodyHeader(
-    const std::vector<uint8_t>& body,
+    const IpcMessageBody&       body,
     uint32_t&                   out_interface_id,
     uint16_t&                   out_method_id,
     ObjectId&                   out_object_id)
@@ -46,7 +46,7 @@ bool IStubBase::ParseV3BodyHeader(
 
 DasResult IStubBase::HandleMessage(
     const ValidatedIPCMessageHeader& header,
-    const std::vector<uint8_t>&      body,
+    const IpcMessageBody&            body,
     IpcResponseSender&               sender,
     StubContext&                     ctx)
 {
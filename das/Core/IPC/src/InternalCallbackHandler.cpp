@@ -7,7 +7,7 @@ DAS_CORE_IPC_NS_BEGIN
 
 DasResult InternalCallbackHandler::HandleMessage(
     const ValidatedIPCMessageHeader& /*header*/,
-    const std::vector<uint8_t>& body,
+    const IpcMessageBody&       body,
     IpcResponseSender& /*sender*/,
     StubContext& /*ctx*/)
 {
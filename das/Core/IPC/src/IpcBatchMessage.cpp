@@ -0,0 +1,151 @@
+#include <cstring>
+#include <das/Core/IPC/IpcBatchMessage.h>
+#include <das/Core/Logger/Logger.h>
+#include <das/Utils/fmt.h>
+#include <memory>
+#include <utility>
+
+DAS_CORE_IPC_NS_BEGIN
+
+namespace
+{
+    constexpr size_t kBatchCountSize = sizeof(uint32_t);
+} // namespace
+
+IpcBatchWriter::IpcBatchWriter() : buffer_(kBatchCountSize, 0) {}
+
+void IpcBatchWriter::Append(
+    const ValidatedIPCMessageHeader& header,
+    const uint8_t*                   body,
+    size_t                           body_size)
+{
+    IPCMessageHeader raw = header.Raw();
+    raw.body_size = static_cast<uint32_t>(body_size);
+
+    const size_t offset = buffer_.size();
+    buffer_.resize(offset + sizeof(IPCMessageHeader) + body_size);
+    std::memcpy(buffer_.data() + offset, &raw, sizeof(IPCMessageHeader));
+    if (body_size > 0)
+    {
+        std::memcpy(
+            buffer_.data() + offset + sizeof(IPCMessageHeader),
+            body,
+            body_size);
+    }
+
+    ++count_;
+    std::memcpy(buffer_.data(), &count_, kBatchCountSize);
+}
+
+std::vector<uint8_t> IpcBatchWriter::TakeBuffer()
+{
+    std::vector<uint8_t> result = std::move(buffer_);
+    buffer_.assign(kBatchCountSize, 0);
+    count_ = 0;
+    return result;
+}
+
+DasResult DecodeIpcBatch(
+    IpcMessageBody               body,
+    std::vector<InboundMessage>& out_messages)
+{
+    out_messages.clear();
+
+    if (body.size() < kBatchCountSize)
+    {
+        DAS_CORE_LOG_ERROR(
+            "Batch envelope too small: body_size = {}",
+            body.size());
+        return DAS_E_IPC_INVALID_MESSAGE_BODY;
+    }
+
+    // 外层 body 转移到共享持有者上，内层消息通过别名 lease 借用
+    auto holder = std::make_shared<IpcMessageBody>(std::move(body));
+    const uint8_t* data = holder->data();
+    const size_t   size = holder->size();
+
+    uint32_t count = 0;
+    std::memcpy(&count, data, kBatchCountSize);
+
+    // 每条内层消息至少占一个 header，提前拒绝伪造的超大 count
+    if (count > (size - kBatchCountSize) / sizeof(IPCMessageHeader))
+    {
+        DAS_CORE_LOG_ERROR(
+            "Batch envelope count exceeds body: count = {}, body_size = {}",
+            count,
+            size);
+        return DAS_E_IPC_INVALID_MESSAGE_BODY;
+    }
+
+    std::vector<InboundMessage> messages;
+    messages.reserve(count);
+
+    // 失败时只交出已解出的消息头，body 一律丢弃，防止调用方误分发
+    const auto fail = [&out_messages, &messages](DasResult error)
+    {
+        for (auto& message : messages)
+        {
+            message.body.Reset();
+        }
+        out_messages = std::move(messages);
+        return error;
+    };
+
+    size_t offset = kBatchCountSize;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        auto header = ValidatedIPCMessageHeader::Deserialize(
+            data + offset,
+            size - offset);
+        if (!header)
+        {
+            DAS_CORE_LOG_ERROR(
+                "Invalid inner header in batch envelope: index = {}",
+                i);
+            return fail(DAS_E_IPC_INVALID_MESSAGE_HEADER);
+        }
+        offset += sizeof(IPCMessageHeader);
+
+        const size_t inner_size = header->GetBodySize();
+        if (inner_size > size - offset)
+        {
+            DAS_CORE_LOG_ERROR(
+                "Inner body exceeds batch envelope: index = {}, "
+                "body_size = {}, remaining = {}",
+                i,
+                inner_size,
+                size - offset);
+            // 该条的消息头完整，同样交给调用方逐条回复失败
+            InboundMessage truncated;
+            truncated.header = *header;
+            messages.push_back(std::move(truncated));
+            return fail(DAS_E_IPC_INVALID_MESSAGE_BODY);
+        }
+
+        InboundMessage msg;
+        msg.header = *header;
+        if (inner_size > 0)
+        {
+            msg.body = IpcMessageBody::Borrow(
+                data + offset,
+                inner_size,
+                std::shared_ptr<const void>(holder, data + offset));
+        }
+        messages.push_back(std::move(msg));
+        offset += inner_size;
+    }
+
+    if (offset != size)
+    {
+        DAS_CORE_LOG_ERROR(
+            "Trailing bytes in batch envelope: consumed = {}, body_size = {}",
+            offset,
+            size);
+        return fail(DAS_E_IPC_INVALID_MESSAGE_BODY);
+    }
+
+    out_messages = std::move(messages);
+    return DAS_S_OK;
+}
+
+DAS_CORE_IPC_NS_END
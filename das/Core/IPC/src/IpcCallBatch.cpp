@@ -0,0 +1,95 @@
+#include <das/Core/IPC/IpcCallBatch.h>
+#include <das/Core/Logger/Logger.h>
+#include <das/Utils/fmt.h>
+#include <utility>
+
+DAS_CORE_IPC_NS_BEGIN
+
+namespace
+{
+    thread_local IpcCallBatch* g_current_call_batch = nullptr;
+} // namespace
+
+IpcCallBatch::~IpcCallBatch()
+{
+    if (!requests_.empty())
+    {
+        DAS_CORE_LOG_WARN(
+            "IpcCallBatch destroyed with {} unsubmitted call(s)",
+            requests_.size());
+    }
+}
+
+IpcCallBatch::IpcCallBatch(IpcCallBatch&& other) noexcept
+    : run_loop_(std::exchange(other.run_loop_, nullptr)),
+      requests_(std::move(other.requests_))
+{
+    other.requests_.clear();
+}
+
+IpcCallBatch& IpcCallBatch::operator=(IpcCallBatch&& other) noexcept
+{
+    if (this != &other)
+    {
+        run_loop_ = std::exchange(other.run_loop_, nullptr);
+        requests_ = std::move(other.requests_);
+        other.requests_.clear();
+    }
+    return *this;
+}
+
+IpcCallBatch::RecordScope::RecordScope(IpcCallBatch& batch) noexcept
+    : previous_(g_current_call_batch)
+{
+    g_current_call_batch = &batch;
+}
+
+IpcCallBatch::RecordScope::~RecordScope() { g_current_call_batch = previous_; }
+
+IpcCallBatch* IpcCallBatch::Current() noexcept { return g_current_call_batch; }
+
+DasResult IpcCallBatch::Record(
+    IpcRunLoop&                      run_loop,
+    const ValidatedIPCMessageHeader& header,
+    const uint8_t*                   body,
+    size_t                           body_size)
+{
+    if (run_loop_ && run_loop_ != &run_loop)
+    {
+        DAS_CORE_LOG_ERROR(
+            "IpcCallBatch: call_id = {} belongs to a different run loop",
+            header.GetCallId());
+        return DAS_E_IPC_SEND_FAILED;
+    }
+
+    if (!requests_.empty()
+        && requests_.front().header.GetTargetSessionId()
+               != header.GetTargetSessionId())
+    {
+        DAS_CORE_LOG_ERROR(
+            "IpcCallBatch: target session mismatch: batch = {}, call = {}",
+            requests_.front().header.GetTargetSessionId(),
+            header.GetTargetSessionId());
+        return DAS_E_IPC_SEND_FAILED;
+    }
+
+    run_loop_ = &run_loop;
+    requests_.push_back(IpcBatchRequest{
+        .header = header,
+        .body = std::vector<uint8_t>(body, body + body_size),
+        .on_complete = nullptr});
+    return DAS_E_IPC_CALL_BATCHED;
+}
+
+AwaitBatchResponseSender IpcCallBatch::Submit(
+    std::chrono::milliseconds timeout) &&
+{
+    AwaitBatchResponseSender sender{
+        std::exchange(run_loop_, nullptr),
+        std::move(requests_),
+        timeout};
+    requests_.clear();
+    return sender;
+}
+
+DAS_CORE_IPC_NS_END
@@ -35,14 +35,14 @@ uint16_t IpcCommandHandler::GetSessionId() const { return session_id_; }
 
 DasResult IpcCommandHandler::HandleMessage(
     const ValidatedIPCMessageHeader& header,
-    const std::vector<uint8_t>&      body,
+    const IpcMessageBody&            body,
     IpcResponseSender&               sender,
     StubContext&                     ctx)
 {
     auto& object_manager = ctx.object_manager;
     (void)object_manager; // 控制平面处理器不使用 object_manager
     IpcCommandResponse       response;
-    std::span<const uint8_t> payload(body);
+    std::span<const uint8_t> payload(body.data(), body.size());
 
     // 处理 REMOTE_RELEASE EVENT（fire-and-forget）
     // EVENT 类型不需要响应，直接在 HandleMessage 中处理
@@ -70,6 +70,60 @@ DasResult IpcCommandHandler::HandleMessage(
         return DAS_S_OK;
     }
 
+    // 处理 REMOTE_RELEASE_BATCH EVENT：一次释放多个 ObjectId
+    if (cmd_type == IpcCommandType::REMOTE_RELEASE_BATCH
+        && header.GetMessageType() == MessageType::EVENT)
+    {
+        size_t   offset = 0;
+        uint32_t count = 0;
+        if (!DeserializeValue(payload, offset, count)
+            || count > (payload.size() - offset) / sizeof(ObjectId))
+        {
+            DAS_CORE_LOG_WARN(
+                "[IpcCommandHandler] REMOTE_RELEASE_BATCH: malformed payload, "
+                "size = {}",
+                payload.size());
+            return DAS_S_OK;
+        }
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            ObjectId object_id;
+            static_cast<void>(DeserializeValue(payload, offset, object_id));
+            object_manager.UnregisterObject(object_id);
+        }
+        DAS_CORE_LOG_INFO(
+            "[IpcCommandHandler] REMOTE_RELEASE_BATCH: released {} objects",
+            count);
+        return DAS_S_OK;
+    }
+
+    // 处理 REMOTE_ADD_REF EVENT：对端在本地由已知接口集合直接创建了
+    // Proxy，为其补一次注册引用，与之后的 REMOTE_RELEASE 配对
+    if (cmd_type == IpcCommandType::REMOTE_ADD_REF
+        && header.GetMessageType() == MessageType::EVENT)
+    {
+        size_t   offset = 0;
+        ObjectId object_id;
+        if (DeserializeValue(payload, offset, object_id))
+        {
+            DAS::DasPtr<IDasBase> object;
+            ObjectId              registered_id;
+            if (DAS::IsFailed(
+                    object_manager.LookupObject(object_id, object.Put()))
+                || DAS::IsFailed(object_manager.RegisterLocalObject(
+                    object.Get(),
+                    registered_id)))
+            {
+                DAS_CORE_LOG_WARN(
+                    "[IpcCommandHandler] REMOTE_ADD_REF: object not found, "
+                    "session = {}, local = {}",
+                    object_id.session_id,
+                    object_id.local_id);
+            }
+        }
+        return DAS_S_OK;
+    }
+
     // 处理 RELEASE_SHM_BLOCK EVENT（fire-and-forget）
     if (cmd_type == IpcCommandType::RELEASE_SHM_BLOCK
         && header.GetMessageType() == MessageType::EVENT)
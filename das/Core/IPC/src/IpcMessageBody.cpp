@@ -0,0 +1,30 @@
+#include <das/Core/IPC/IpcMessageBody.h>
+#include <das/Core/IPC/SharedMemoryPool.h>
+
+DAS_CORE_IPC_NS_BEGIN
+
+IpcMessageBody IpcMessageBody::BorrowSharedMemory(
+    SharedMemoryPool&        pool,
+    const SharedMemoryBlock& block)
+{
+    const uint64_t handle = block.handle;
+
+    // 登记借用后 CleanupStaleBlocks 不会回收该块
+    if (DAS::IsFailed(pool.AcquireLease(handle)))
+    {
+        return {};
+    }
+
+    // lease 的删除器负责归还 SHM 块；指针本身不被 delete
+    std::shared_ptr<const void> lease{
+        block.data,
+        [&pool, handle](const void*)
+        { static_cast<void>(pool.ReleaseLease(handle)); }};
+
+    return Borrow(
+        static_cast<const uint8_t*>(block.data),
+        block.size,
+        std::move(lease));
+}
+
+DAS_CORE_IPC_NS_END
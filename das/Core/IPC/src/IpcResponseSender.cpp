@@ -1,5 +1,6 @@
 #include <das/Core/IPC/Config.h>
 #include <das/Core/IPC/IHostConnection.h>
+#include <das/Core/IPC/IpcBatchMessage.h>
 #include <das/Core/IPC/IpcResponseSender.h>
 #include <das/Core/IPC/IpcRunLoop.h>
 
@@ -25,10 +26,27 @@ IpcResponseSender::IpcResponseSender(HostConnectionRoute route)
 {
 }
 
+IpcResponseSender::IpcResponseSender(BatchRoute route)
+    : route_kind_(RouteKind::Batch), batch_writer_(route.writer)
+{
+}
+
 DasResult IpcResponseSender::SendViaRoute(
     const ValidatedIPCMessageHeader& validated_header,
     std::vector<uint8_t>&&           body)
 {
+    if (route_kind_ == RouteKind::Batch)
+    {
+        if (!batch_writer_)
+        {
+            DAS_CORE_LOG_ERROR("Batch response route is not initialized");
+            return DAS_E_IPC_NOT_INITIALIZED;
+        }
+
+        batch_writer_->Append(validated_header, body.data(), body.size());
+        return DAS_S_OK;
+    }
+
     if (!run_loop_)
     {
         DAS_CORE_LOG_ERROR("Response route is not initialized");
@@ -60,6 +78,7 @@ DasResult IpcResponseSender::SendViaRoute(
             validated_header,
             std::move(body));
     }
+    case RouteKind::Batch:
     case RouteKind::None:
         break;
     }
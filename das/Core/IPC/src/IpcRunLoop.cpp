@@ -2,6 +2,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <das/Core/IPC/Config.h>
 #include <das/Core/IPC/ConnectionManager.h>
 #include <das/Core/IPC/Handshake.h>
@@ -9,6 +10,7 @@
 #include <das/Core/IPC/IHostConnection.h>
 #include <das/Core/IPC/IMessageHandler.h>
 #include <das/Core/IPC/InternalCallbackHandler.h>
+#include <das/Core/IPC/IpcBatchMessage.h>
 #include <das/Core/IPC/IpcErrors.h>
 #include <das/Core/IPC/IpcMessageHeaderBuilder.h>
 #include <das/Core/IPC/IpcMessageQueue.h>
@@ -25,6 +27,7 @@
 
 #include <das/Core/IPC/DasReadOnlyStringStub.h>
 #include <das/Core/IPC/DasVariantVectorByValueStub.h>
+#include <das/Core/IPC/QueryInterfaceSet.h>
 #include <das/Core/IPC/QueryInterfaceStub.h>
 #include <das/Core/IPC/RemoteObjectRegistry.h>
 
@@ -102,6 +105,13 @@ IpcRunLoop::IpcRunLoop(
             static_cast<uint32_t>(IpcCommandType::QUERY_INTERFACE),
             &s_query_interface_stub);
     }
+
+    // 生成的 Stub 由 RegisterAll 登记 IID，这里补上手写 Stub 与 IDasBase，
+    // 供 QUERY_INTERFACE 发布接口集合
+    RegisterExportedInterfaceIid(DasIidOf<IDasBase>());
+    RegisterExportedInterfaceIid(DasIidOf<IDasReadOnlyString>());
+    RegisterExportedInterfaceIid(
+        DasIidOf<Das::ExportInterface::IDasVariantVector>());
 }
 
 IpcRunLoop::~IpcRunLoop()
@@ -218,7 +228,7 @@ IMessageHandler* IpcRunLoop::GetHandler(
 
 boost::asio::awaitable<void> IpcRunLoop::DispatchToHandlerCoroutine(
     const ValidatedIPCMessageHeader& header,
-    const std::vector<uint8_t>&      body,
+    const IpcMessageBody&            body,
     AnyTransport&                    transport)
 {
     (void)transport;
@@ -228,7 +238,7 @@ boost::asio::awaitable<void> IpcRunLoop::DispatchToHandlerCoroutine(
 
 boost::asio::awaitable<void> IpcRunLoop::DispatchToHandlerCoroutine(
     const ValidatedIPCMessageHeader& header,
-    const std::vector<uint8_t>&      body,
+    const IpcMessageBody&            body,
     DasPtr<IHostConnection>          connection)
 {
     IpcResponseSender sender(
@@ -238,7 +248,7 @@ boost::asio::awaitable<void> IpcRunLoop::DispatchToHandlerCoroutine(
 
 boost::asio::awaitable<void> IpcRunLoop::DispatchToHandlerWithSender(
     const ValidatedIPCMessageHeader& header,
-    const std::vector<uint8_t>&      body,
+    const IpcMessageBody&            body,
     IpcResponseSender&               sender)
 {
     DAS_CORE_LOG_INFO(
@@ -316,14 +326,14 @@ boost::asio::awaitable<void> IpcRunLoop::DispatchToHandlerWithSender(
 
 boost::asio::awaitable<void> IpcRunLoop::RouteIncomingMessage(
     const ValidatedIPCMessageHeader& header,
-    std::vector<uint8_t>             body)
+    IpcMessageBody                   body)
 {
     co_await RouteIncomingMessage(header, std::move(body), {});
 }
 
 boost::asio::awaitable<void> IpcRunLoop::RouteIncomingMessage(
     const ValidatedIPCMessageHeader& header,
-    std::vector<uint8_t>             body,
+    IpcMessageBody                   body,
     DasPtr<IHostConnection>          connection)
 {
     if (IsControlPlaneMessage(header))
@@ -378,11 +388,11 @@ boost::asio::awaitable<void> IpcRunLoop::RouteIncomingMessage(
             fwd_result = PostSendWithTransport(
                 std::move(target_connection),
                 header,
-                std::move(body));
+                std::move(body).TakeVector());
         }
         else
         {
-            fwd_result = PostSend(header, std::move(body));
+            fwd_result = PostSend(header, std::move(body).TakeVector());
         }
 
         if (fwd_result != DAS_S_OK)
@@ -396,6 +406,56 @@ boost::asio::awaitable<void> IpcRunLoop::RouteIncomingMessage(
         co_return;
     }
 
+    if (header.GetMessageType() == MessageType::RESPONSE
+        && IsBatchMessage(header))
+    {
+        // 批量响应：拆包后逐条按单条 RESPONSE 规则路由
+        std::vector<InboundMessage> responses;
+        DasResult decode_result = DecodeIpcBatch(std::move(body), responses);
+        if (DAS::IsFailed(decode_result))
+        {
+            // 已解出的调用立即失败，不再等待调用超时
+            DAS_CORE_LOG_ERROR(
+                "Malformed batch response: source = {}, result = {}, "
+                "decodable_calls = {}",
+                header.GetSourceSessionId(),
+                decode_result,
+                responses.size());
+            for (const auto& response : responses)
+            {
+                if (response.header.GetMessageType() == MessageType::RESPONSE)
+                {
+                    CompletePendingCall(
+                        CallKey{
+                            response.header.GetSourceSessionId(),
+                            response.header.GetCallId()},
+                        DAS_E_IPC_SERIALIZATION_FAILED,
+                        {},
+                        uint16_t{0});
+                }
+            }
+            co_return;
+        }
+
+        for (auto& response : responses)
+        {
+            if (response.header.GetMessageType() != MessageType::RESPONSE
+                || IsBatchMessage(response.header))
+            {
+                DAS_CORE_LOG_WARN(
+                    "Unexpected message in batch response: call_id = {}",
+                    response.header.GetCallId());
+                continue;
+            }
+
+            co_await RouteIncomingMessage(
+                response.header,
+                std::move(response.body),
+                connection);
+        }
+        co_return;
+    }
+
     if (header.GetMessageType() == MessageType::RESPONSE)
     {
         CallKey call_key{header.GetSourceSessionId(), header.GetCallId()};
@@ -536,10 +596,10 @@ std::pair<DasResult, CallKey> IpcRunLoop::PrepareSendRequestWithTransport(
 }
 
 void IpcRunLoop::CompletePendingCall(
-    CallKey              call_key,
-    DasResult            result,
-    std::vector<uint8_t> response,
-    uint16_t             response_flags)
+    CallKey        call_key,
+    DasResult      result,
+    IpcMessageBody response,
+    uint16_t       response_flags)
 {
     DAS_CORE_LOG_INFO(
         "Completing pending call: source_session_id = {}, call_id = {}, "
@@ -561,10 +621,10 @@ void IpcRunLoop::CompletePendingCall(
 }
 
 bool IpcRunLoop::TryCompletePendingCallbackOnly(
-    CallKey               call_key,
-    DasResult             result,
-    std::vector<uint8_t>& response,
-    uint16_t              response_flags)
+    CallKey         call_key,
+    DasResult       result,
+    IpcMessageBody& response,
+    uint16_t        response_flags)
 {
     PendingCallCompletion on_complete;
 
@@ -591,7 +651,8 @@ bool IpcRunLoop::TryCompletePendingCallbackOnly(
         DAS_CORE_LOG_INFO(
             "Invoking pending callback for call_id = {}",
             call_key.call_id);
-        on_complete(result, std::move(response), response_flags);
+        // 借用 SHM 的响应在此处物化为 vector 后立即归还共享内存块
+        on_complete(result, std::move(response).TakeVector(), response_flags);
     }
 
     return true;
@@ -779,44 +840,10 @@ boost::asio::awaitable<void> IpcRunLoop::DoSendCoroutine(
     }
 }
 
-boost::asio::awaitable<void> IpcRunLoop::SendToSessionCoroutine(
-    ValidatedIPCMessageHeader             header,
-    std::vector<uint8_t>                  body,
-    PendingCallCompletion                 on_complete,
-    std::chrono::steady_clock::time_point deadline)
+boost::asio::awaitable<DasResult> IpcRunLoop::SendToSessionTransportCoroutine(
+    const ValidatedIPCMessageHeader& header,
+    const std::vector<uint8_t>&      body)
 {
-    const bool has_completion = static_cast<bool>(on_complete);
-
-    auto complete_send_failure =
-        [this, &header, has_completion](DasResult error)
-    {
-        if (has_completion)
-        {
-            CompletePendingCall(
-                CallKey{header.GetTargetSessionId(), header.GetCallId()},
-                error,
-                {},
-                uint16_t{0});
-        }
-        else
-        {
-            NotifySendFailure(header, error);
-        }
-    };
-
-    // Register pending call on IO thread (before send) to avoid
-    // response arriving before registration.
-    if (on_complete)
-    {
-        CallKey call_key{header.GetTargetSessionId(), header.GetCallId()};
-        std::unique_lock<std::mutex> lock(pending_mutex_);
-        pending_calls_[call_key] = PendingCallState{
-            .call_key = call_key,
-            .deadline = deadline,
-            .on_complete = std::move(on_complete),
-            .response_flags = 0};
-    }
-
     const uint16_t          target_session_id = header.GetTargetSessionId();
     DasPtr<IHostConnection> host =
         connection_manager_->FindManagedHostConnection(target_session_id);
@@ -839,8 +866,7 @@ boost::asio::awaitable<void> IpcRunLoop::SendToSessionCoroutine(
             "PostSend: no transport for session = {}, result = {}",
             target_session_id,
             lookup_result);
-        complete_send_failure(DAS_E_IPC_NO_CONNECTIONS);
-        co_return;
+        co_return DAS_E_IPC_NO_CONNECTIONS;
     }
 
     try
@@ -848,23 +874,134 @@ boost::asio::awaitable<void> IpcRunLoop::SendToSessionCoroutine(
         AnyTransport& transport = maybe_transport->get();
         if (!transport.IsConnected())
         {
-            complete_send_failure(DAS_E_IPC_CONNECTION_LOST);
-            co_return;
+            co_return DAS_E_IPC_CONNECTION_LOST;
         }
 
-        auto result =
-            co_await transport.SendCoroutine(header, body.data(), body.size());
-        if (result != DAS_S_OK)
-        {
-            complete_send_failure(result);
-        }
+        co_return co_await transport
+            .SendCoroutine(header, body.data(), body.size());
     }
     catch (const std::exception& e)
     {
         DAS_CORE_LOG_ERROR(
             "SendToSessionCoroutine: exception: {}",
             ToString(e.what()));
-        complete_send_failure(DAS_E_IPC_SEND_FAILED);
+    }
+    co_return DAS_E_IPC_SEND_FAILED;
+}
+
+boost::asio::awaitable<void> IpcRunLoop::SendToSessionCoroutine(
+    ValidatedIPCMessageHeader             header,
+    std::vector<uint8_t>                  body,
+    PendingCallCompletion                 on_complete,
+    std::chrono::steady_clock::time_point deadline)
+{
+    const bool has_completion = static_cast<bool>(on_complete);
+
+    // Register pending call on IO thread (before send) to avoid
+    // response arriving before registration.
+    if (on_complete)
+    {
+        CallKey call_key{header.GetTargetSessionId(), header.GetCallId()};
+        std::unique_lock<std::mutex> lock(pending_mutex_);
+        pending_calls_[call_key] = PendingCallState{
+            .call_key = call_key,
+            .deadline = deadline,
+            .on_complete = std::move(on_complete),
+            .response_flags = 0};
+    }
+
+    const DasResult result =
+        co_await SendToSessionTransportCoroutine(header, body);
+    if (result == DAS_S_OK)
+    {
+        co_return;
+    }
+
+    if (has_completion)
+    {
+        CompletePendingCall(
+            CallKey{header.GetTargetSessionId(), header.GetCallId()},
+            result,
+            {},
+            uint16_t{0});
+    }
+    else
+    {
+        NotifySendFailure(header, result);
+    }
+}
+
+boost::asio::awaitable<void> IpcRunLoop::SendBatchToSessionCoroutine(
+    uint16_t                              target_session_id,
+    std::vector<IpcBatchRequest>          requests,
+    std::chrono::steady_clock::time_point deadline)
+{
+    // 与单条发送一致：全部 pending call 在发送前于 IO 线程注册
+    std::vector<bool> has_completion(requests.size(), false);
+    {
+        std::unique_lock<std::mutex> lock(pending_mutex_);
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            auto& request = requests[i];
+            if (!request.on_complete)
+            {
+                continue;
+            }
+
+            has_completion[i] = true;
+            CallKey call_key{target_session_id, request.header.GetCallId()};
+            pending_calls_[call_key] = PendingCallState{
+                .call_key = call_key,
+                .deadline = deadline,
+                .on_complete = std::move(request.on_complete),
+                .response_flags = 0};
+        }
+    }
+
+    IpcBatchWriter writer;
+    for (const auto& request : requests)
+    {
+        writer.Append(request.header, request.body.data(), request.body.size());
+    }
+    std::vector<uint8_t> envelope = writer.TakeBuffer();
+
+    auto batch_header = IPCMessageHeaderBuilder()
+                            .SetMessageType(MessageType::REQUEST)
+                            .SetCallId(AllocateCallId())
+                            .SetSourceSessionId(local_session_id_)
+                            .SetTargetSessionId(target_session_id)
+                            .SetFlags(MessageFlags::BATCH)
+                            .SetBodySize(static_cast<uint32_t>(envelope.size()))
+                            .Build();
+
+    const DasResult result =
+        co_await SendToSessionTransportCoroutine(batch_header, envelope);
+    if (result == DAS_S_OK)
+    {
+        co_return;
+    }
+
+    DAS_CORE_LOG_ERROR(
+        "Batch send failed: target = {}, count = {}, result = {}",
+        target_session_id,
+        requests.size(),
+        result);
+
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        const auto& request = requests[i];
+        if (has_completion[i])
+        {
+            CompletePendingCall(
+                CallKey{target_session_id, request.header.GetCallId()},
+                result,
+                {},
+                uint16_t{0});
+        }
+        else
+        {
+            NotifySendFailure(request.header, result);
+        }
     }
 }
 
@@ -892,6 +1029,157 @@ DasResult IpcRunLoop::PostSend(
     return DAS_S_OK;
 }
 
+DasResult IpcRunLoop::PostSendBatch(
+    uint16_t                              target_session_id,
+    std::vector<IpcBatchRequest>&&        requests,
+    std::chrono::steady_clock::time_point deadline)
+{
+    if (!io_context_)
+    {
+        DAS_CORE_LOG_ERROR("PostSendBatch: io_context_ is null");
+        return DAS_E_IPC_NOT_INITIALIZED;
+    }
+
+    if (requests.empty())
+    {
+        return DAS_E_INVALID_ARGUMENT;
+    }
+
+    for (const auto& request : requests)
+    {
+        const auto& header = request.header;
+        if (header.GetMessageType() != MessageType::REQUEST
+            || IsControlPlaneMessage(header) || IsBatchMessage(header)
+            || header.GetTargetSessionId() != target_session_id)
+        {
+            DAS_CORE_LOG_ERROR(
+                "PostSendBatch: only business requests to one session can "
+                "be batched: call_id = {}, target = {}, expected_target = {}",
+                header.GetCallId(),
+                header.GetTargetSessionId(),
+                target_session_id);
+            return DAS_E_INVALID_ARGUMENT;
+        }
+    }
+
+    boost::asio::co_spawn(
+        *io_context_,
+        SendBatchToSessionCoroutine(
+            target_session_id,
+            std::move(requests),
+            deadline),
+        boost::asio::detached);
+
+    return DAS_S_OK;
+}
+
+DasResult IpcRunLoop::PostRemoteRelease(const ObjectId& object_id)
+{
+    if (!io_context_)
+    {
+        DAS_CORE_LOG_ERROR("PostRemoteRelease: io_context_ is null");
+        return DAS_E_IPC_NOT_INITIALIZED;
+    }
+
+    bool schedule_flush = false;
+    {
+        std::lock_guard lock{pending_release_mutex_};
+        schedule_flush = pending_releases_.empty();
+        pending_releases_.push_back(object_id);
+    }
+    if (schedule_flush)
+    {
+        boost::asio::post(*io_context_, [this] { FlushRemoteReleases(); });
+    }
+    return DAS_S_OK;
+}
+
+DasResult IpcRunLoop::PostRemoteAddRef(const ObjectId& object_id)
+{
+    if (!io_context_)
+    {
+        DAS_CORE_LOG_ERROR("PostRemoteAddRef: io_context_ is null");
+        return DAS_E_IPC_NOT_INITIALIZED;
+    }
+
+    // 已登记的释放先于本次 ADD_REF 投递；之后排队的 flush 会看到空队列
+    FlushRemoteReleases();
+
+    auto header =
+        IPCMessageHeaderBuilder()
+            .SetMessageType(MessageType::EVENT)
+            .SetHeaderFlags(HeaderFlags::BUSINESS_CONTROL)
+            .SetInterfaceId(
+                static_cast<uint32_t>(IpcCommandType::REMOTE_ADD_REF))
+            .SetSourceSessionId(GetSessionId())
+            .SetTargetSessionId(object_id.session_id)
+            .SetBodySize(static_cast<uint32_t>(sizeof(ObjectId)))
+            .Build();
+    std::vector<uint8_t> body(sizeof(ObjectId));
+    std::memcpy(body.data(), &object_id, sizeof(ObjectId));
+    return PostSend(header, std::move(body));
+}
+
+void IpcRunLoop::FlushRemoteReleases()
+{
+    std::vector<ObjectId> releases;
+    {
+        std::lock_guard lock{pending_release_mutex_};
+        releases.swap(pending_releases_);
+    }
+
+    // 按目标 session 分组，组内保持登记顺序
+    std::stable_sort(
+        releases.begin(),
+        releases.end(),
+        [](const ObjectId& lhs, const ObjectId& rhs)
+        { return lhs.session_id < rhs.session_id; });
+
+    auto group_begin = releases.begin();
+    while (group_begin != releases.end())
+    {
+        const uint16_t target_session_id = group_begin->session_id;
+        const auto     group_end = std::find_if(
+            group_begin,
+            releases.end(),
+            [target_session_id](const ObjectId& id)
+            { return id.session_id != target_session_id; });
+        const auto count = static_cast<uint32_t>(group_end - group_begin);
+
+        // 单条释放沿用 REMOTE_RELEASE，兼容不认识批量命令的对端
+        std::vector<uint8_t> body;
+        IpcCommandType       command = IpcCommandType::REMOTE_RELEASE;
+        if (count == 1)
+        {
+            body.resize(sizeof(ObjectId));
+            std::memcpy(body.data(), &*group_begin, sizeof(ObjectId));
+        }
+        else
+        {
+            command = IpcCommandType::REMOTE_RELEASE_BATCH;
+            body.resize(sizeof(count) + count * sizeof(ObjectId));
+            std::memcpy(body.data(), &count, sizeof(count));
+            std::memcpy(
+                body.data() + sizeof(count),
+                &*group_begin,
+                count * sizeof(ObjectId));
+        }
+
+        auto header =
+            IPCMessageHeaderBuilder()
+                .SetMessageType(MessageType::EVENT)
+                .SetHeaderFlags(HeaderFlags::BUSINESS_CONTROL)
+                .SetInterfaceId(static_cast<uint32_t>(command))
+                .SetSourceSessionId(GetSessionId())
+                .SetTargetSessionId(target_session_id)
+                .SetBodySize(static_cast<uint32_t>(body.size()))
+                .Build();
+        static_cast<void>(PostSend(header, std::move(body)));
+
+        group_begin = group_end;
+    }
+}
+
 DasResult IpcRunLoop::PostSendWithTransport(
     DasPtr<IHostConnection>          connection,
     const ValidatedIPCMessageHeader& header,
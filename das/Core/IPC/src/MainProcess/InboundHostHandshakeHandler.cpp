@@ -15,7 +15,7 @@ namespace MainProcess
         constexpr uint16_t kMainProcessSessionId = 1;
 
         template <typename T>
-        void CopyBody(const std::vector<uint8_t>& body, T& out)
+        void CopyBody(const IpcMessageBody& body, T& out)
         {
             std::memcpy(&out, body.data(), sizeof(T));
         }
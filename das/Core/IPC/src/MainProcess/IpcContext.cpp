@@ -32,6 +32,7 @@
 #include <das/Utils/DasJsonCore.h>
 #include <das/Utils/StringUtils.h>
 #include <das/Utils/fmt.h>
+#include <vector>
 
 DAS_NS_BEGIN
 namespace Core
@@ -97,6 +98,17 @@ namespace Core
                     static_cast<uint32_t>(IpcCommandType::REMOTE_RELEASE),
                     command_handler_.Get());
 
+                runloop_.RegisterHandler(
+                    HeaderFlags::BUSINESS_CONTROL,
+                    static_cast<uint32_t>(
+                        IpcCommandType::REMOTE_RELEASE_BATCH),
+                    command_handler_.Get());
+
+                runloop_.RegisterHandler(
+                    HeaderFlags::BUSINESS_CONTROL,
+                    static_cast<uint32_t>(IpcCommandType::REMOTE_ADD_REF),
+                    command_handler_.Get());
+
                 runloop_.RegisterHandler(
                     HeaderFlags::BUSINESS_CONTROL,
                     static_cast<uint32_t>(IpcCommandType::RELEASE_SHM_BLOCK),
@@ -155,6 +167,17 @@ namespace Core
                     static_cast<uint32_t>(IpcCommandType::REMOTE_RELEASE),
                     command_handler_.Get());
 
+                runloop_.RegisterHandler(
+                    HeaderFlags::BUSINESS_CONTROL,
+                    static_cast<uint32_t>(
+                        IpcCommandType::REMOTE_RELEASE_BATCH),
+                    command_handler_.Get());
+
+                runloop_.RegisterHandler(
+                    HeaderFlags::BUSINESS_CONTROL,
+                    static_cast<uint32_t>(IpcCommandType::REMOTE_ADD_REF),
+                    command_handler_.Get());
+
                 runloop_.RegisterHandler(
                     HeaderFlags::BUSINESS_CONTROL,
                     static_cast<uint32_t>(IpcCommandType::RELEASE_SHM_BLOCK),
@@ -324,11 +347,14 @@ namespace Core
                 // 生命周期安全：重置所有 HostLauncher 的回调，防止
                 // ConnectionManager 持有的 DasPtr<HostLauncher>
                 // 在 IpcContext 析构后仍触发悬空回调
-                for (auto& [sid, launcher] : launchers_)
                 {
-                    if (launcher)
+                    std::lock_guard lock{launchers_mutex_};
+                    for (auto& [sid, launcher] : launchers_)
                     {
-                        launcher->ClearCallbacks();
+                        if (launcher)
+                        {
+                            launcher->ClearCallbacks();
+                        }
                     }
                 }
 
@@ -398,7 +424,10 @@ namespace Core
                         [this, session_id]()
                         { return InternalRegisterHostLauncher(session_id); }));
 
-                    launchers_[session_id] = launcher;
+                    {
+                        std::lock_guard lock{launchers_mutex_};
+                        launchers_[session_id] = launcher;
+                    }
                     *pp_out_launcher = launcher.Get();
                     return DAS_S_OK;
                 }
@@ -817,8 +846,16 @@ namespace Core
                     return DAS_E_IPC_NOT_INITIALIZED;
                 }
 
-                auto it = launchers_.find(session_id);
-                if (it == launchers_.end() || !it->second)
+                DAS::DasPtr<HostLauncher> launcher;
+                {
+                    std::lock_guard lock{launchers_mutex_};
+                    auto            it = launchers_.find(session_id);
+                    if (it != launchers_.end())
+                    {
+                        launcher = it->second;
+                    }
+                }
+                if (!launcher)
                 {
                     DAS_CORE_LOG_ERROR(
                         "InternalRegisterHostLauncher: no launcher for session_id={}",
@@ -826,7 +863,7 @@ namespace Core
                     return DAS_E_INVALID_ARGUMENT;
                 }
 
-                return runloop_.RegisterHostLauncher(it->second);
+                return runloop_.RegisterHostLauncher(launcher);
             }
 
             DasResult IpcContext::ResetHostLifecycleCallbacks()
@@ -844,7 +881,17 @@ namespace Core
                 //
                 // 用于 PluginManager::Shutdown 析构 RAII drain（经 ipc_context_
                 // 接口转发，PluginManager 不直接持有 HostLauncher）。
-                for (auto& [sid, launcher] : launchers_)
+                // 快照后锁外清理，不在 launchers_mutex_ 内持 callback_mutex_。
+                std::vector<DAS::DasPtr<HostLauncher>> launchers;
+                {
+                    std::lock_guard lock{launchers_mutex_};
+                    launchers.reserve(launchers_.size());
+                    for (const auto& [sid, launcher] : launchers_)
+                    {
+                        launchers.push_back(launcher);
+                    }
+                }
+                for (auto& launcher : launchers)
                 {
                     if (launcher)
                     {
@@ -887,13 +934,22 @@ namespace Core
                     return DAS_E_INVALID_ARGUMENT;
                 }
 
-                auto it = launchers_.find(session_id);
-                if (it != launchers_.end() && it->second)
+                DAS::DasPtr<HostLauncher> launcher;
+                {
+                    std::lock_guard lock{launchers_mutex_};
+                    auto            it = launchers_.find(session_id);
+                    if (it != launchers_.end())
+                    {
+                        launcher = it->second;
+                    }
+                }
+                if (launcher)
                 {
                     // 主动 Stop Host 进程（HostLauncher 具体类型，Stop 内含
                     // GOODBYE + 等待进程退出 + ClearCallbacks 全清三 slot），
                     // 保留运行时卸载"主动 Stop Host 进程"语义，不退化。
-                    it->second->Stop();
+                    // Stop 可能阻塞，在 launchers_mutex_ 外调用。
+                    launcher->Stop();
                 }
                 // WebSocket Host 经 RegisterInternalHost 路径（无 HostLauncher
                 // 实体 in launchers_），session 不在 launchers_，直接清索引不调
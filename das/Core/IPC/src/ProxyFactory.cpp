@@ -5,6 +5,7 @@
 #include <das/Core/IPC/IpcErrors.h>
 #include <das/Core/IPC/IpcRuntimeState.h>
 #include <das/Core/IPC/ManualProxyRegistry.h>
+#include <das/Core/IPC/MethodMetadata.h>
 #include <das/Core/IPC/ProxyFactory.h>
 #include <das/Core/Logger/Logger.h>
 #include <das/IDasBase.h>
@@ -42,8 +43,14 @@ std::pair<DasResult, DasPtr<IDasBase>> ProxyFactory::GetOrCreateProxy(
     IpcRunLoop&                   run_loop,
     std::weak_ptr<BusinessThread> business_thread,
     const ObjectId&               object_id,
-    uint32_t                      interface_id)
+    uint32_t                      interface_id,
+    bool*                         out_created)
 {
+    if (out_created != nullptr)
+    {
+        *out_created = false;
+    }
+
     if (IsShuttingDown())
     {
         return {DAS_E_IPC_DISCONNECTED, nullptr};
@@ -72,7 +79,7 @@ std::pair<DasResult, DasPtr<IDasBase>> ProxyFactory::GetOrCreateProxy(
             it->second.interfaces.erase(view_it);
             if (it->second.interfaces.empty())
             {
-                proxy_cache_.erase(it);
+                EraseIdentityLocked(it);
             }
         }
     }
@@ -130,6 +137,10 @@ std::pair<DasResult, DasPtr<IDasBase>> ProxyFactory::GetOrCreateProxy(
 
     proxy_cache_[key].interfaces[interface_id] =
         ProxyCacheEntry(runtime_ptr, proxy.Get());
+    if (out_created != nullptr)
+    {
+        *out_created = true;
+    }
     // move 出去，调用方拥有唯一强引用
     return {DAS_S_OK, std::move(proxy)};
 }
@@ -175,6 +186,7 @@ void ProxyFactory::ClearAllProxies()
 {
     std::lock_guard<std::mutex> lock(proxy_cache_mutex_);
     proxy_cache_.clear();
+    qi_cache_.clear();
 }
 
 void ProxyFactory::InvalidateCacheEntry(const ObjectId& object_id)
@@ -184,7 +196,7 @@ void ProxyFactory::InvalidateCacheEntry(const ObjectId& object_id)
     auto                        it = proxy_cache_.find(key);
     if (it != proxy_cache_.end())
     {
-        proxy_cache_.erase(it);
+        EraseIdentityLocked(it);
     }
 }
 
@@ -214,8 +226,167 @@ void ProxyFactory::OnProxyFinalRelease(
     identity_it->second.interfaces.erase(view_it);
     if (identity_it->second.interfaces.empty())
     {
-        proxy_cache_.erase(identity_it);
+        EraseIdentityLocked(identity_it);
+    }
+}
+
+void ProxyFactory::EraseIdentityLocked(
+    std::unordered_map<uint64_t, ProxyIdentityEntry>::iterator it)
+{
+    qi_cache_.erase(it->first);
+    proxy_cache_.erase(it);
+}
+
+DasPtr<IDasBase> ProxyFactory::TryGetProxy(
+    const ObjectId& object_id,
+    uint32_t        interface_id)
+{
+    if (IsShuttingDown())
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(proxy_cache_mutex_);
+    auto it = proxy_cache_.find(EncodeObjectId(object_id));
+    if (it == proxy_cache_.end())
+    {
+        return nullptr;
+    }
+    auto view_it = it->second.interfaces.find(interface_id);
+    if (view_it == it->second.interfaces.end())
+    {
+        return nullptr;
+    }
+    auto& entry = view_it->second;
+    if (entry.runtime_ptr != nullptr && entry.interface_ptr != nullptr
+        && entry.runtime_ptr->TryAddRefForCache())
+    {
+        return DasPtr<IDasBase>::Attach(entry.interface_ptr);
+    }
+    return nullptr;
+}
+
+auto ProxyFactory::LookupQueryInterface(
+    const ObjectId& object_id,
+    const DasGuid&  iid) const -> QueryInterfaceCacheResult
+{
+    using Kind = QueryInterfaceCacheResult::Kind;
+
+    QueryInterfaceCacheResult   cached{};
+    std::lock_guard<std::mutex> lock(proxy_cache_mutex_);
+    auto it = qi_cache_.find(EncodeObjectId(object_id));
+    if (it == qi_cache_.end())
+    {
+        return cached;
+    }
+
+    const auto& entry = it->second;
+    cached.has_interface_set = entry.has_interface_set;
+    for (const auto& result : entry.results)
+    {
+        if (result.iid == iid)
+        {
+            if (DAS::IsFailed(result.result))
+            {
+                cached.kind = Kind::Unsupported;
+                cached.unsupported_result = result.result;
+            }
+            else
+            {
+                cached.kind = Kind::Supported;
+                cached.object_id = result.object_id;
+                cached.interface_id = result.interface_id;
+            }
+            return cached;
+        }
+    }
+
+    if (!entry.has_interface_set)
+    {
+        return cached;
+    }
+    for (const auto& item : entry.interface_set)
+    {
+        if (item.iid == iid)
+        {
+            // 指针不同的接口需要对端为其分配 ObjectId，仍走远程
+            if (item.same_object != 0)
+            {
+                cached.kind = Kind::Supported;
+                cached.object_id = object_id;
+                cached.interface_id = ComputeInterfaceId(iid);
+            }
+            return cached;
+        }
+    }
+    cached.kind = Kind::Unsupported;
+    cached.unsupported_result = DAS_E_NO_INTERFACE;
+    return cached;
+}
+
+void ProxyFactory::StoreQueryInterfaceSet(
+    const ObjectId&                     object_id,
+    std::vector<QueryInterfaceSetEntry> interface_set)
+{
+    std::lock_guard<std::mutex> lock(proxy_cache_mutex_);
+    const uint64_t              key = EncodeObjectId(object_id);
+    if (!proxy_cache_.contains(key))
+    {
+        return;
+    }
+    auto& entry = qi_cache_[key];
+    entry.has_interface_set = true;
+    entry.interface_set = std::move(interface_set);
+}
+
+void ProxyFactory::StoreQueryInterfaceResult(
+    const ObjectId& object_id,
+    const DasGuid&  iid,
+    DasResult       result,
+    const ObjectId& result_object_id,
+    uint32_t        interface_id)
+{
+    if (DAS::IsFailed(result) && result != DAS_E_NO_INTERFACE)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(proxy_cache_mutex_);
+    const uint64_t              key = EncodeObjectId(object_id);
+    if (!proxy_cache_.contains(key))
+    {
+        return;
+    }
+    auto& results = qi_cache_[key].results;
+    for (auto& existing : results)
+    {
+        if (existing.iid == iid)
+        {
+            existing = {iid, result, result_object_id, interface_id};
+            return;
+        }
     }
+    results.push_back({iid, result, result_object_id, interface_id});
+}
+
+void ProxyFactory::RecordQueryInterface(bool answered_locally) noexcept
+{
+    if (answered_locally)
+    {
+        qi_local_hits_.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        qi_remote_calls_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+auto ProxyFactory::GetQueryInterfaceStats() const noexcept
+    -> QueryInterfaceStats
+{
+    return QueryInterfaceStats{
+        .remote_calls = qi_remote_calls_.load(std::memory_order_relaxed),
+        .local_hits = qi_local_hits_.load(std::memory_order_relaxed)};
 }
 
 DAS_CORE_IPC_NS_END
@@ -0,0 +1,117 @@
+#include <das/Core/IPC/QueryInterfaceSet.h>
+
+#include <das/Core/IPC/IPCProxyBase.h>
+#include <das/DasPtr.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+DAS_CORE_IPC_NS_BEGIN
+
+namespace
+{
+    std::vector<DasGuid>& GetExportedIidList()
+    {
+        static std::vector<DasGuid> iids;
+        return iids;
+    }
+
+    std::mutex& GetExportedIidMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+} // namespace
+
+void RegisterExportedInterfaceIid(const DasGuid& iid)
+{
+    std::lock_guard lock{GetExportedIidMutex()};
+    auto&           iids = GetExportedIidList();
+    if (std::find(iids.begin(), iids.end(), iid) == iids.end())
+    {
+        iids.push_back(iid);
+    }
+}
+
+std::vector<DasGuid> GetExportedInterfaceIids()
+{
+    std::lock_guard lock{GetExportedIidMutex()};
+    return GetExportedIidList();
+}
+
+void AppendQueryInterfaceSet(IDasBase* object, std::vector<uint8_t>& out_body)
+{
+    if (object == nullptr)
+    {
+        return;
+    }
+
+    IPCProxyBase* runtime_tag = nullptr;
+    if (DAS::IsOk(object->QueryInterface(
+            DasIidOf<IPCProxyBase>(),
+            reinterpret_cast<void**>(&runtime_tag)))
+        && runtime_tag != nullptr)
+    {
+        static_cast<void>(runtime_tag->ReleaseRuntimeTagRef());
+        return;
+    }
+
+    std::vector<QueryInterfaceSetEntry> entries;
+    for (const auto& iid : GetExportedInterfaceIids())
+    {
+        DAS::DasPtr<IDasBase> queried;
+        if (DAS::IsFailed(object->QueryInterface(iid, queried.PutVoid())))
+        {
+            continue;
+        }
+        entries.push_back(
+            QueryInterfaceSetEntry{
+                .iid = iid,
+                .same_object =
+                    static_cast<uint8_t>(queried.Get() == object ? 1 : 0)});
+    }
+
+    const auto count = static_cast<uint32_t>(entries.size());
+    const auto offset = out_body.size();
+    out_body.resize(
+        offset + sizeof(count)
+        + entries.size() * sizeof(QueryInterfaceSetEntry));
+    std::memcpy(out_body.data() + offset, &count, sizeof(count));
+    if (!entries.empty())
+    {
+        std::memcpy(
+            out_body.data() + offset + sizeof(count),
+            entries.data(),
+            entries.size() * sizeof(QueryInterfaceSetEntry));
+    }
+}
+
+bool ReadQueryInterfaceSet(
+    const uint8_t*                       data,
+    size_t                               size,
+    std::vector<QueryInterfaceSetEntry>& out_entries)
+{
+    uint32_t count = 0;
+    if (data == nullptr || size < sizeof(count))
+    {
+        return false;
+    }
+    std::memcpy(&count, data, sizeof(count));
+    if (count > (size - sizeof(count)) / sizeof(QueryInterfaceSetEntry))
+    {
+        return false;
+    }
+
+    out_entries.resize(count);
+    if (count != 0)
+    {
+        std::memcpy(
+            out_entries.data(),
+            data + sizeof(count),
+            count * sizeof(QueryInterfaceSetEntry));
+    }
+    return true;
+}
+
+DAS_CORE_IPC_NS_END
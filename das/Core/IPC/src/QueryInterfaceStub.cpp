@@ -5,6 +5,7 @@
 #include <das/Core/IPC/IpcResponseSender.h>
 #include <das/Core/IPC/MethodMetadata.h>
 #include <das/Core/IPC/ObjectId.h>
+#include <das/Core/IPC/QueryInterfaceSet.h>
 #include <das/Core/Logger/Logger.h>
 #include <das/DasPtr.hpp>
 #include <das/Utils/fmt.h>
@@ -15,7 +16,7 @@ DAS_CORE_IPC_NS_BEGIN
 
 DasResult QueryInterfaceStub::HandleMessage(
     const ValidatedIPCMessageHeader& header,
-    const std::vector<uint8_t>&      body,
+    const IpcMessageBody&            body,
     IpcResponseSender&               sender,
     StubContext&                     ctx)
 {
@@ -43,7 +44,13 @@ DasResult QueryInterfaceStub::HandleMessage(
     std::memcpy(&iid, body.data() + offset, sizeof(iid));
     offset += sizeof(iid);
 
-    // 3. Lookup the real object (LookupObject internally AddRef)
+    // 3. Optional flags byte: caller asks for the interface set
+    const bool want_interface_set =
+        body.size() > offset
+        && (body.data()[offset] & QUERY_INTERFACE_FLAG_WANT_INTERFACE_SET)
+               != 0;
+
+    // 4. Lookup the real object (LookupObject internally AddRef)
     DAS::DasPtr<IDasBase> raw_obj;
     DasResult             lookup_result =
         ctx.object_manager.LookupObject(object_id, raw_obj.Put());
@@ -70,7 +77,7 @@ DasResult QueryInterfaceStub::HandleMessage(
         return lookup_result;
     }
 
-    // 4. Call QueryInterface on the real object
+    // 5. Call QueryInterface on the real object
     DAS::DasPtr<IDasBase> new_obj;
     DasResult qi_result = raw_obj->QueryInterface(iid, new_obj.PutVoid());
     if (DAS::IsFailed(qi_result))
@@ -98,6 +105,15 @@ DasResult QueryInterfaceStub::HandleMessage(
             reinterpret_cast<const uint8_t*>(&zero64),
             reinterpret_cast<const uint8_t*>(&zero64) + sizeof(zero64));
 
+        // With the interface set requested, report the failure in the body
+        // only; a non-zero header error code would drop the body.
+        int32_t header_error = static_cast<int32_t>(qi_result);
+        if (want_interface_set)
+        {
+            AppendQueryInterfaceSet(raw_obj.Get(), response_body);
+            header_error = 0;
+        }
+
         auto response_header =
             IPCMessageHeaderBuilder()
                 .SetMessageType(MessageType::RESPONSE)
@@ -105,13 +121,13 @@ DasResult QueryInterfaceStub::HandleMessage(
                 .SetCallId(header.GetCallId())
                 .SetSourceSessionId(header.GetTargetSessionId())
                 .SetTargetSessionId(header.GetSourceSessionId())
-                .SetErrorCode(static_cast<int32_t>(qi_result))
+                .SetErrorCode(header_error)
                 .Build();
         sender.SendResponse(response_header, std::move(response_body));
         return qi_result;
     }
 
-    // 5. Register the new interface pointer as a local object
+    // 6. Register the new interface pointer as a local object
     ObjectId  new_obj_id;
     DasResult reg_result =
         ctx.object_manager.RegisterLocalObject(new_obj.Get(), new_obj_id);
@@ -130,7 +146,7 @@ DasResult QueryInterfaceStub::HandleMessage(
         return reg_result;
     }
 
-    // 6. Build success response: int32(result) + uint32(interface_id) +
+    // 7. Build success response: int32(result) + uint32(interface_id) +
     // uint64(encoded_object_id)
     uint32_t interface_id = ComputeInterfaceId(iid);
     uint64_t encoded_id = EncodeObjectId(new_obj_id);
@@ -149,6 +165,10 @@ DasResult QueryInterfaceStub::HandleMessage(
         response_body.end(),
         reinterpret_cast<const uint8_t*>(&encoded_id),
         reinterpret_cast<const uint8_t*>(&encoded_id) + sizeof(encoded_id));
+    if (want_interface_set)
+    {
+        AppendQueryInterfaceSet(raw_obj.Get(), response_body);
+    }
 
     auto response_header =
         IPCMessageHeaderBuilder()
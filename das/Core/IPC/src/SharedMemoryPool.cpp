@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <boost/interprocess/managed_shared_memory.hpp>
 #include <chrono>
 #include <cstdint>
@@ -6,34 +9,364 @@
 #include <das/Core/IPC/SharedMemoryPool.h>
 #include <das/Core/Logger/Logger.h>
 #include <mutex>
+#include <new>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <unordered_map>
-#include <vector>
 
 DAS_CORE_IPC_NS_BEGIN
-/**
- * @brief 共享内存块元数据
- *
- * 用于跟踪块的分配时间，支持 CleanupStaleBlocks 功能。
- * 超过 kStaleThreshold 的块会被自动清理，防止泄漏。
- */
-struct BlockMetadata
+namespace
 {
-    size_t size; ///< 块大小（字节）
-    std::chrono::steady_clock::time_point
-        allocation_time; ///< 分配时间（用于超时清理判断）
-};
+    /// 段内具名对象：池头与存活块槽表
+    constexpr const char* kPoolHeaderName = "das_shm_pool_header";
+    constexpr const char* kSlotTableName = "das_shm_pool_slots";
+
+    constexpr uint32_t kPoolHeaderVersion = 1;
+    constexpr uint32_t kBlockMagic = 0x4B4C4244; // "DBLK"
+
+    /// 块对齐；free list 以 offset / kBlockAlignment 作为 32 位索引，
+    /// 因此单个池最大支持 64GB
+    constexpr size_t kBlockAlignment = 16;
+
+    /**
+     * 尺寸分级：64B 起，每个 2 的幂区间再细分 4 档（最大浪费 25%），
+     * 最大一档 64MB。超过最大档的块直接向 segment 申请，释放时立即归还。
+     */
+    constexpr unsigned kMinClassShift = 6;
+    constexpr unsigned kMaxClassShift = 26;
+    constexpr unsigned kSubClassCount = 4;
+    constexpr uint32_t kClassCount =
+        (kMaxClassShift - kMinClassShift) * kSubClassCount + 1;
+    constexpr uint32_t kOversizeClass = kClassCount;
+
+    constexpr uint32_t kBlockFree = 0;
+    constexpr uint32_t kBlockAllocated = 1;
+    /// CleanupStaleBlocks 已认领、正在确认无 lease 的块
+    constexpr uint32_t kBlockReclaiming = 2;
+
+    constexpr uint32_t kNoSlot = UINT32_MAX;
+
+    constexpr size_t ClassSize(uint32_t size_class)
+    {
+        if (size_class == 0)
+        {
+            return size_t{1} << kMinClassShift;
+        }
+        const uint32_t group = (size_class - 1) / kSubClassCount;
+        const uint32_t sub = (size_class - 1) % kSubClassCount;
+        const unsigned shift = kMinClassShift + group;
+        return (size_t{1} << shift) + (sub + 1) * (size_t{1} << (shift - 2));
+    }
+
+    constexpr uint32_t SizeClassOf(size_t size)
+    {
+        if (size <= (size_t{1} << kMinClassShift))
+        {
+            return 0;
+        }
+        if (size > (size_t{1} << kMaxClassShift))
+        {
+            return kOversizeClass;
+        }
+        // size 落在 (2^shift, 2^(shift+1)] 区间
+        const unsigned shift =
+            static_cast<unsigned>(std::bit_width(size - 1)) - 1;
+        const size_t step = size_t{1} << (shift - 2);
+        const size_t sub = (size - 1 - (size_t{1} << shift)) / step;
+        return static_cast<uint32_t>(
+            (shift - kMinClassShift) * kSubClassCount + sub + 1);
+    }
+
+    static_assert(ClassSize(SizeClassOf(64)) == 64);
+    static_assert(ClassSize(SizeClassOf(65)) == 80);
+    static_assert(ClassSize(SizeClassOf(1024)) == 1024);
+    static_assert(ClassSize(SizeClassOf(1025)) == 1280);
+    static_assert(SizeClassOf(size_t{1} << kMaxClassShift) == kClassCount - 1);
+    static_assert(ClassSize(kClassCount - 1) == size_t{1} << kMaxClassShift);
+
+    /// free list 头：高 32 位为 ABA 标签，低 32 位为块索引（0 表示空）
+    constexpr uint64_t PackHead(uint32_t tag, uint32_t index)
+    {
+        return (uint64_t{tag} << 32) | index;
+    }
+
+    constexpr uint32_t HeadTag(uint64_t head)
+    {
+        return static_cast<uint32_t>(head >> 32);
+    }
+
+    constexpr uint32_t HeadIndex(uint64_t head)
+    {
+        return static_cast<uint32_t>(head);
+    }
+
+    int64_t NowNs() noexcept
+    {
+        // steady_clock 在 Linux(CLOCK_MONOTONIC) 与 Windows(QPC)
+        // 上均为系统级时钟，跨进程可比
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    /**
+     * @brief 段内块头，紧邻用户数据之前
+     *
+     * 取代原先进程内的 unordered_map 元数据：任何打开该池的进程都能
+     * 通过 handle 找到块大小与分配时间。
+     */
+    struct alignas(kBlockAlignment) BlockHeader
+    {
+        uint32_t              magic{kBlockMagic};
+        uint32_t              size_class{0};
+        std::atomic<uint32_t> state{kBlockFree};
+        std::atomic<uint32_t> next{0}; ///< free list 链接（块索引）
+        std::atomic<uint64_t> size{0}; ///< 请求大小（字节）
+        std::atomic<int64_t>  alloc_time{0}; ///< 分配时间（steady_clock ns）
+        std::atomic<uint32_t> slot{kNoSlot}; ///< 存活块槽表下标
+        std::atomic<uint32_t> leases{0}; ///< 未归还的借用数
+    };
+
+    /// 池头：各尺寸档位的无锁 free list 与统计，位于段内
+    struct PoolHeader
+    {
+        uint32_t              version{kPoolHeaderVersion};
+        std::atomic<uint64_t> used_size{0};
+        std::atomic<uint32_t> slot_hint{0};
+        std::atomic<uint64_t> free_heads[kClassCount]{};
+    };
+
+    // 段内原子量跨进程共享，必须是免锁实现
+    static_assert(std::atomic<uint32_t>::is_always_lock_free);
+    static_assert(std::atomic<uint64_t>::is_always_lock_free);
+    static_assert(std::atomic<int64_t>::is_always_lock_free);
+} // namespace
 
 struct SharedMemoryPool::Impl
 {
     std::unique_ptr<boost::interprocess::managed_shared_memory> segment_;
     std::string                                                 name_;
     size_t                                                      total_size_;
-    size_t                                                      used_size_{0};
-    std::unordered_map<uint64_t, BlockMetadata>                 block_metadata_;
-    mutable std::mutex                                          mutex_;
+    PoolHeader*                                                 header_{};
+    /// 存活块槽表：非 0 项为已分配块的 handle，供 CleanupStaleBlocks 遍历
+    std::atomic<uint64_t>* slots_{};
+    uint32_t               slot_count_{0};
+
+    void AttachCreated(size_t initial_size)
+    {
+        header_ = segment_->construct<PoolHeader>(kPoolHeaderName)();
+        // 每 1KB 池空间一个槽，限制在 [64, 65536]
+        slot_count_ = static_cast<uint32_t>(
+            std::clamp<size_t>(initial_size / 1024, 64, 65536));
+        slots_ = segment_->construct<std::atomic<uint64_t>>(kSlotTableName)
+            [slot_count_](uint64_t{0});
+    }
+
+    void AttachOpened()
+    {
+        header_ = segment_->find<PoolHeader>(kPoolHeaderName).first;
+        if (header_ == nullptr || header_->version != kPoolHeaderVersion)
+        {
+            throw std::runtime_error(
+                "Shared memory pool header missing or version mismatch");
+        }
+        auto [slots, count] =
+            segment_->find<std::atomic<uint64_t>>(kSlotTableName);
+        if (slots == nullptr)
+        {
+            throw std::runtime_error("Shared memory pool slot table missing");
+        }
+        slots_ = slots;
+        slot_count_ = static_cast<uint32_t>(count);
+    }
+
+    [[nodiscard]]
+    BlockHeader* HeaderFromIndex(uint32_t index) const
+    {
+        return static_cast<BlockHeader*>(segment_->get_address_from_handle(
+            static_cast<boost::interprocess::managed_shared_memory::handle_t>(
+                uint64_t{index} * kBlockAlignment)));
+    }
+
+    [[nodiscard]]
+    uint32_t IndexOf(const BlockHeader* header) const
+    {
+        return static_cast<uint32_t>(
+            static_cast<uint64_t>(segment_->get_handle_from_address(header))
+            / kBlockAlignment);
+    }
+
+    [[nodiscard]]
+    uint64_t HandleOf(const BlockHeader* header) const
+    {
+        return static_cast<uint64_t>(
+            segment_->get_handle_from_address(header + 1));
+    }
 
-    static constexpr std::chrono::seconds kStaleThreshold{60};
+    /**
+     * @brief 按 handle 定位块头
+     * @return 越界、未对齐或魔数不符时返回 nullptr；不检查分配状态
+     */
+    [[nodiscard]]
+    BlockHeader* FindBlock(uint64_t handle) const
+    {
+        if (handle < sizeof(BlockHeader) || handle >= total_size_
+            || (handle - sizeof(BlockHeader)) % kBlockAlignment != 0)
+        {
+            return nullptr;
+        }
+        auto* header = static_cast<BlockHeader*>(
+                           segment_->get_address_from_handle(
+                               static_cast<boost::interprocess::
+                                               managed_shared_memory::handle_t>(
+                                   handle)))
+                       - 1;
+        return header->magic == kBlockMagic ? header : nullptr;
+    }
+
+    BlockHeader* PopFree(uint32_t size_class)
+    {
+        auto&    list = header_->free_heads[size_class];
+        uint64_t head = list.load(std::memory_order_acquire);
+        while (HeadIndex(head) != 0)
+        {
+            // 档位内的块只在 ReclaimFreeLists 中归还 segment，且归还前已出栈；
+            // 这里读到过期 next 时 CAS 会因标签变化而失败
+            BlockHeader* node = HeaderFromIndex(HeadIndex(head));
+            const uint32_t next = node->next.load(std::memory_order_relaxed);
+            if (list.compare_exchange_weak(
+                    head,
+                    PackHead(HeadTag(head) + 1, next),
+                    std::memory_order_acq_rel,
+                    std::memory_order_acquire))
+            {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    void PushFree(BlockHeader* node)
+    {
+        auto&          list = header_->free_heads[node->size_class];
+        const uint32_t index = IndexOf(node);
+        uint64_t       head = list.load(std::memory_order_relaxed);
+        do
+        {
+            node->next.store(HeadIndex(head), std::memory_order_relaxed);
+        } while (!list.compare_exchange_weak(
+            head,
+            PackHead(HeadTag(head) + 1, index),
+            std::memory_order_release,
+            std::memory_order_relaxed));
+    }
+
+    /// 从 segment 切出新块；空间不足返回 nullptr
+    BlockHeader* Carve(uint32_t size_class, size_t size)
+    {
+        const size_t payload =
+            size_class == kOversizeClass ? size : ClassSize(size_class);
+        void* raw = segment_->allocate_aligned(
+            sizeof(BlockHeader) + payload,
+            kBlockAlignment,
+            std::nothrow);
+        if (raw == nullptr)
+        {
+            return nullptr;
+        }
+        auto* header = new (raw) BlockHeader{};
+        header->size_class = size_class;
+        return header;
+    }
+
+    /// 把所有档位的空闲块归还 segment，供跨档位复用
+    void ReclaimFreeLists()
+    {
+        for (uint32_t size_class = 0; size_class < kClassCount; ++size_class)
+        {
+            while (BlockHeader* node = PopFree(size_class))
+            {
+                node->magic = 0;
+                segment_->deallocate(node);
+            }
+        }
+    }
+
+    uint32_t ClaimSlot(uint64_t handle)
+    {
+        const uint32_t start =
+            header_->slot_hint.fetch_add(1, std::memory_order_relaxed);
+        for (uint32_t i = 0; i < slot_count_; ++i)
+        {
+            const uint32_t slot = (start + i) % slot_count_;
+            uint64_t       expected = 0;
+            if (slots_[slot].compare_exchange_strong(
+                    expected,
+                    handle,
+                    std::memory_order_acq_rel))
+            {
+                return slot;
+            }
+        }
+        // 槽表已满：块仍可正常使用，只是不参与过期清理
+        return kNoSlot;
+    }
+
+    /// 释放块；状态不是已分配（重复释放/竞争失败）时返回失败
+    DasResult Free(uint64_t handle)
+    {
+        BlockHeader* header = FindBlock(handle);
+        if (header == nullptr)
+        {
+            return DAS_E_IPC_SHM_FAILED;
+        }
+
+        uint32_t expected = kBlockAllocated;
+        while (!header->state.compare_exchange_weak(
+            expected,
+            kBlockFree,
+            std::memory_order_acq_rel))
+        {
+            if (expected != kBlockAllocated && expected != kBlockReclaiming)
+            {
+                return DAS_E_IPC_SHM_FAILED;
+            }
+            // CleanupStaleBlocks 认领是短暂的：要么回退为已分配，要么释放
+            if (expected == kBlockReclaiming)
+            {
+                std::this_thread::yield();
+            }
+            expected = kBlockAllocated;
+        }
+
+        Recycle(header);
+        return DAS_S_OK;
+    }
+
+    /// 归还已置为空闲（或已被 CleanupStaleBlocks 认领）的块
+    void Recycle(BlockHeader* header)
+    {
+        header->state.store(kBlockFree, std::memory_order_release);
+        const uint32_t slot = header->slot.load(std::memory_order_relaxed);
+        if (slot != kNoSlot)
+        {
+            slots_[slot].store(0, std::memory_order_release);
+        }
+        header_->used_size.fetch_sub(
+            header->size.load(std::memory_order_relaxed),
+            std::memory_order_relaxed);
+
+        if (header->size_class == kOversizeClass)
+        {
+            header->magic = 0;
+            segment_->deallocate(header);
+        }
+        else
+        {
+            PushFree(header);
+        }
+    }
 };
 
 SharedMemoryPool::SharedMemoryPool(
@@ -58,6 +391,7 @@ SharedMemoryPool::SharedMemoryPool(
                 initial_size,
                 nullptr, // addr
                 ipc_sec.GetPermissions());
+        impl_->AttachCreated(initial_size);
     }
     else
     {
@@ -66,6 +400,7 @@ SharedMemoryPool::SharedMemoryPool(
                 boost::interprocess::open_only,
                 pool_name.c_str());
         impl_->total_size_ = impl_->segment_->get_size();
+        impl_->AttachOpened();
     }
 }
 
@@ -88,8 +423,6 @@ SharedMemoryPool::~SharedMemoryPool() { Uninitialize(); }
 
 void SharedMemoryPool::Uninitialize()
 {
-    std::lock_guard<std::mutex> lock(impl_->mutex_);
-
     // 幂等性检查：如果已经关闭，直接返回
     // 这防止了 DestroyPool 中显式调用 Uninitialize() 后，
     // 析构函数再次调用 Uninitialize() 导致的重复操作
@@ -98,6 +431,9 @@ void SharedMemoryPool::Uninitialize()
         return;
     }
 
+    impl_->header_ = nullptr;
+    impl_->slots_ = nullptr;
+    impl_->slot_count_ = 0;
     impl_->segment_.reset();
 
     try
@@ -107,15 +443,10 @@ void SharedMemoryPool::Uninitialize()
     catch (...)
     {
     }
-
-    impl_->used_size_ = 0;
-    impl_->block_metadata_.clear();
 }
 
 DasResult SharedMemoryPool::Allocate(size_t size, SharedMemoryBlock& block)
 {
-    std::lock_guard<std::mutex> lock(impl_->mutex_);
-
     if (!impl_->segment_)
     {
         DAS_CORE_LOG_ERROR("Shared memory not initialized");
@@ -124,8 +455,22 @@ DasResult SharedMemoryPool::Allocate(size_t size, SharedMemoryBlock& block)
 
     try
     {
-        void* ptr = impl_->segment_->allocate(size);
-        if (!ptr)
+        const uint32_t size_class = SizeClassOf(size);
+
+        BlockHeader* header = size_class == kOversizeClass
+                                  ? nullptr
+                                  : impl_->PopFree(size_class);
+        if (header == nullptr)
+        {
+            header = impl_->Carve(size_class, size);
+        }
+        if (header == nullptr)
+        {
+            // 空闲块可能囤积在其他档位，归还 segment 后重试一次
+            impl_->ReclaimFreeLists();
+            header = impl_->Carve(size_class, size);
+        }
+        if (header == nullptr)
         {
             DAS_CORE_LOG_ERROR(
                 "Failed to allocate {} bytes (null pointer returned)",
@@ -133,15 +478,20 @@ DasResult SharedMemoryPool::Allocate(size_t size, SharedMemoryBlock& block)
             return DAS_E_OUT_OF_MEMORY;
         }
 
-        auto handle = impl_->segment_->get_handle_from_address(ptr);
+        header->size.store(size, std::memory_order_relaxed);
+        header->leases.store(0, std::memory_order_relaxed);
+        header->alloc_time.store(NowNs(), std::memory_order_relaxed);
+        header->state.store(kBlockAllocated, std::memory_order_release);
 
-        block.data = ptr;
-        block.size = size;
-        block.handle = static_cast<uint64_t>(handle);
+        const uint64_t handle = impl_->HandleOf(header);
+        header->slot.store(
+            impl_->ClaimSlot(handle),
+            std::memory_order_relaxed);
+        impl_->header_->used_size.fetch_add(size, std::memory_order_relaxed);
 
-        impl_->block_metadata_[block.handle] =
-            BlockMetadata{size, std::chrono::steady_clock::now()};
-        impl_->used_size_ += size;
+        block.data = header + 1;
+        block.size = size;
+        block.handle = handle;
         return DAS_S_OK;
     }
     catch (const std::exception& e)
@@ -153,34 +503,20 @@ DasResult SharedMemoryPool::Allocate(size_t size, SharedMemoryBlock& block)
 
 DasResult SharedMemoryPool::Deallocate(uint64_t handle)
 {
-    std::lock_guard<std::mutex> lock(impl_->mutex_);
-
     if (!impl_->segment_)
     {
         DAS_CORE_LOG_ERROR("Shared memory not initialized");
         return DAS_E_IPC_SHM_FAILED;
     }
 
-    auto it = impl_->block_metadata_.find(handle);
-    if (it == impl_->block_metadata_.end())
-    {
-        DAS_CORE_LOG_ERROR("Block not found for handle = {}", handle);
-        return DAS_E_IPC_SHM_FAILED;
-    }
-
     try
     {
-        auto managed_handle =
-            static_cast<boost::interprocess::managed_shared_memory::handle_t>(
-                handle);
-        void* ptr = impl_->segment_->get_address_from_handle(managed_handle);
-
-        impl_->segment_->deallocate(ptr);
-
-        impl_->used_size_ -= it->second.size;
-        impl_->block_metadata_.erase(it);
-
-        return DAS_S_OK;
+        const auto result = impl_->Free(handle);
+        if (result != DAS_S_OK)
+        {
+            DAS_CORE_LOG_ERROR("Block not found for handle = {}", handle);
+        }
+        return result;
     }
     catch (const std::exception& e)
     {
@@ -193,83 +529,137 @@ DasResult SharedMemoryPool::GetBlockByHandle(
     uint64_t           handle,
     SharedMemoryBlock& block)
 {
-    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    if (!impl_->segment_)
+    {
+        DAS_CORE_LOG_ERROR("Shared memory not initialized");
+        return DAS_E_IPC_SHM_FAILED;
+    }
+
+    BlockHeader* header = impl_->FindBlock(handle);
+    if (header == nullptr
+        || header->state.load(std::memory_order_acquire) != kBlockAllocated)
+    {
+        DAS_CORE_LOG_ERROR("Block not found for handle = {}", handle);
+        return DAS_E_IPC_OBJECT_NOT_FOUND;
+    }
 
+    block.data = header + 1;
+    block.size = header->size.load(std::memory_order_relaxed);
+    block.handle = handle;
+    return DAS_S_OK;
+}
+
+DasResult SharedMemoryPool::AcquireLease(uint64_t handle)
+{
     if (!impl_->segment_)
     {
         DAS_CORE_LOG_ERROR("Shared memory not initialized");
         return DAS_E_IPC_SHM_FAILED;
     }
 
-    auto it = impl_->block_metadata_.find(handle);
-    if (it == impl_->block_metadata_.end())
+    BlockHeader* header = impl_->FindBlock(handle);
+    if (header == nullptr)
     {
         DAS_CORE_LOG_ERROR("Block not found for handle = {}", handle);
         return DAS_E_IPC_OBJECT_NOT_FOUND;
     }
 
-    try
+    // 先登记 lease 再检查状态；与 CleanupStaleBlocks 的“先认领再检查 lease”
+    // 配对（均为 seq_cst），双方至少有一方能看到对方
+    header->leases.fetch_add(1, std::memory_order_seq_cst);
+    for (;;)
     {
-        auto managed_handle =
-            static_cast<boost::interprocess::managed_shared_memory::handle_t>(
-                handle);
-        void* ptr = impl_->segment_->get_address_from_handle(managed_handle);
+        const uint32_t state = header->state.load(std::memory_order_seq_cst);
+        if (state == kBlockAllocated)
+        {
+            return DAS_S_OK;
+        }
+        if (state != kBlockReclaiming)
+        {
+            break;
+        }
+        std::this_thread::yield();
+    }
 
-        block.data = ptr;
-        block.size = it->second.size;
-        block.handle = handle;
+    header->leases.fetch_sub(1, std::memory_order_relaxed);
+    DAS_CORE_LOG_ERROR("Block not found for handle = {}", handle);
+    return DAS_E_IPC_OBJECT_NOT_FOUND;
+}
 
-        return DAS_S_OK;
+DasResult SharedMemoryPool::ReleaseLease(uint64_t handle)
+{
+    if (!impl_->segment_)
+    {
+        DAS_CORE_LOG_ERROR("Shared memory not initialized");
+        return DAS_E_IPC_SHM_FAILED;
     }
-    catch (const std::exception& e)
+
+    BlockHeader* header = impl_->FindBlock(handle);
+    if (header == nullptr)
     {
-        DAS_CORE_LOG_EXCEPTION(e);
+        DAS_CORE_LOG_ERROR("Block not found for handle = {}", handle);
         return DAS_E_IPC_SHM_FAILED;
     }
+    header->leases.fetch_sub(1, std::memory_order_seq_cst);
+    return Deallocate(handle);
 }
 
-DasResult SharedMemoryPool::CleanupStaleBlocks()
+DasResult SharedMemoryPool::CleanupStaleBlocks(
+    std::chrono::nanoseconds max_age)
 {
-    std::lock_guard<std::mutex> lock(impl_->mutex_);
-
     if (!impl_->segment_)
     {
         DAS_CORE_LOG_ERROR("Shared memory not initialized");
         return DAS_E_IPC_SHM_FAILED;
     }
 
-    auto                  now = std::chrono::steady_clock::now();
-    std::vector<uint64_t> blocks_to_remove;
+    const int64_t now = NowNs();
+    const int64_t threshold = max_age.count();
 
-    for (const auto& [handle, metadata] : impl_->block_metadata_)
+    for (uint32_t i = 0; i < impl_->slot_count_; ++i)
     {
-        auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
-            now - metadata.allocation_time);
-        if (elapsed >= Impl::kStaleThreshold)
+        const uint64_t handle =
+            impl_->slots_[i].load(std::memory_order_acquire);
+        if (handle == 0)
         {
-            blocks_to_remove.push_back(handle);
+            continue;
         }
-    }
 
-    for (uint64_t handle : blocks_to_remove)
-    {
-        auto it = impl_->block_metadata_.find(handle);
-        if (it != impl_->block_metadata_.end())
+        BlockHeader* header = impl_->FindBlock(handle);
+        if (header == nullptr
+            || header->state.load(std::memory_order_acquire)
+                   != kBlockAllocated)
+        {
+            continue;
+        }
+
+        if (now - header->alloc_time.load(std::memory_order_relaxed)
+            < threshold)
+        {
+            continue;
+        }
+
+        // 与并发 Deallocate 的竞争由状态 CAS 裁决；认领后仍有 lease
+        // 说明块正被 IpcMessageBody 借用，归还前不能回收
+        uint32_t expected = kBlockAllocated;
+        if (!header->state.compare_exchange_strong(
+                expected,
+                kBlockReclaiming,
+                std::memory_order_seq_cst))
+        {
+            continue;
+        }
+        if (header->leases.load(std::memory_order_seq_cst) != 0)
+        {
+            header->state.store(kBlockAllocated, std::memory_order_release);
+            continue;
+        }
+        try
+        {
+            impl_->Recycle(header);
+        }
+        catch (...)
         {
-            try
-            {
-                auto managed_handle = static_cast<
-                    boost::interprocess::managed_shared_memory::handle_t>(
-                    handle);
-                void* ptr =
-                    impl_->segment_->get_address_from_handle(managed_handle);
-                impl_->segment_->deallocate(ptr);
-                impl_->used_size_ -= it->second.size;
-                impl_->block_metadata_.erase(it);
-            }
-            catch (...)
-            {
-            }
         }
     }
 
@@ -280,8 +670,12 @@ size_t SharedMemoryPool::GetTotalSize() const { return impl_->total_size_; }
 
 size_t SharedMemoryPool::GetUsedSize() const
 {
-    std::lock_guard<std::mutex> lock(impl_->mutex_);
-    return impl_->used_size_;
+    if (!impl_->segment_)
+    {
+        return 0;
+    }
+    return static_cast<size_t>(
+        impl_->header_->used_size.load(std::memory_order_relaxed));
 }
 
 struct SharedMemoryManager::Impl
@@ -0,0 +1,903 @@
+#include <das/Core/IPC/ShmRingIpcTransport.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <boost/asio/post.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <chrono>
+#include <cstring>
+#include <das/Core/IPC/IpcErrors.h>
+#include <das/Core/IPC/IpcPermissions.h>
+#include <das/Core/IPC/SharedMemoryPool.h>
+#include <das/Core/Logger/Logger.h>
+#include <das/DasApi.h>
+#include <das/Utils/StringUtils.h>
+#include <das/Utils/fmt.h>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(DAS_WINDOWS)
+#include <windows.h>
+#elif defined(__linux__)
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <das/Core/IPC/Config.h>
+
+DAS_CORE_IPC_NS_BEGIN
+
+namespace
+{
+    // 与 UnixAsyncIpcTransport 的大消息标志位一致
+    constexpr uint16_t kRingFlagLargeMessage = 0x01;
+
+    constexpr uint32_t kRingMagic = 0x474E5244; // "DRNG"
+    constexpr uint32_t kRingVersion = 1;
+    constexpr size_t   kFrameAlign = 8;
+    constexpr size_t   kCacheLine = 64;
+
+    /// 门铃单次等待上限：到期后重新检查关闭标志
+    constexpr auto kDoorbellWaitSlice = std::chrono::milliseconds(100);
+    /// 接收协程挂起前的轮询次数
+    constexpr int kReceiveSpinCount = 32;
+    /// 环满时的发送退避区间
+    constexpr auto kSendBackoffMin = std::chrono::microseconds(20);
+    constexpr auto kSendBackoffMax = std::chrono::milliseconds(1);
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free);
+    static_assert(std::atomic<uint32_t>::is_always_lock_free);
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+
+    /// 单方向环的控制块，位于共享内存中
+    struct RingControl
+    {
+        alignas(kCacheLine) std::atomic<uint64_t> head{0}; ///< 消费者已读位置
+        alignas(kCacheLine) std::atomic<uint64_t> tail{0}; ///< 生产者已发布位置
+        alignas(kCacheLine) std::atomic<uint32_t> doorbell{0}; ///< 门铃序号
+        std::atomic<uint32_t> consumer_waiting{0}; ///< 消费者已登记等待
+    };
+
+    /**
+     * 段布局：
+     *   ShmRingSegmentHeader（按缓存行对齐）
+     *   ring[0] 数据：服务端 → 客户端
+     *   ring[1] 数据：客户端 → 服务端
+     */
+    struct ShmRingSegmentHeader
+    {
+        uint32_t              magic;
+        uint32_t              version;
+        uint64_t              ring_capacity;
+        uint64_t              max_message_size;
+        std::atomic<uint32_t> server_closed{0};
+        std::atomic<uint32_t> client_closed{0};
+        RingControl           rings[2];
+    };
+
+    constexpr size_t AlignUp(size_t value, size_t alignment) noexcept
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    constexpr size_t kSegmentHeaderSize =
+        AlignUp(sizeof(ShmRingSegmentHeader), kCacheLine);
+
+    constexpr size_t SegmentSize(size_t ring_capacity) noexcept
+    {
+        return kSegmentHeaderSize + 2 * ring_capacity;
+    }
+
+    constexpr size_t FrameSize(size_t body_size) noexcept
+    {
+        return AlignUp(sizeof(IPCMessageHeader) + body_size, kFrameAlign);
+    }
+
+    void CopyIntoRing(
+        uint8_t*       ring,
+        size_t         capacity,
+        uint64_t       position,
+        const uint8_t* src,
+        size_t         size)
+    {
+        if (size == 0)
+        {
+            return;
+        }
+        const size_t offset = static_cast<size_t>(position & (capacity - 1));
+        const size_t first = (std::min)(size, capacity - offset);
+        std::memcpy(ring + offset, src, first);
+        if (first < size)
+        {
+            std::memcpy(ring, src + first, size - first);
+        }
+    }
+
+    void CopyFromRing(
+        const uint8_t* ring,
+        size_t         capacity,
+        uint64_t       position,
+        uint8_t*       dst,
+        size_t         size)
+    {
+        if (size == 0)
+        {
+            return;
+        }
+        const size_t offset = static_cast<size_t>(position & (capacity - 1));
+        const size_t first = (std::min)(size, capacity - offset);
+        std::memcpy(dst, ring + offset, first);
+        if (first < size)
+        {
+            std::memcpy(dst + first, ring, size - first);
+        }
+    }
+
+    /**
+     * @brief 跨进程门铃
+     *
+     * 等待/唤醒都以共享内存中的 doorbell 序号为准；
+     * Linux 直接对该地址做共享 futex，Windows 借助命名自动重置事件。
+     */
+    class Doorbell
+    {
+    public:
+        Doorbell() = default;
+        ~Doorbell() { Close(); }
+
+        Doorbell(const Doorbell&) = delete;
+        Doorbell& operator=(const Doorbell&) = delete;
+
+        DasResult Open(const std::string& name, bool create)
+        {
+#if defined(DAS_WINDOWS)
+            const std::string event_name = "Local\\" + name;
+            if (create)
+            {
+                IpcSecurityAttributes sec;
+                event_ = ::CreateEventA(
+                    static_cast<LPSECURITY_ATTRIBUTES>(
+                        sec.GetPermissions().get_permissions()),
+                    FALSE,
+                    FALSE,
+                    event_name.c_str());
+            }
+            else
+            {
+                event_ = ::OpenEventA(
+                    EVENT_MODIFY_STATE | SYNCHRONIZE,
+                    FALSE,
+                    event_name.c_str());
+            }
+            if (event_ == nullptr)
+            {
+                DAS_CORE_LOG_ERROR(
+                    "ShmRing doorbell open failed: name = {}, error = {}",
+                    event_name,
+                    ::GetLastError());
+                return DAS_E_IPC_SHM_FAILED;
+            }
+#else
+            (void)name;
+            (void)create;
+#endif
+            return DAS_S_OK;
+        }
+
+        void Close() noexcept
+        {
+#if defined(DAS_WINDOWS)
+            if (event_ != nullptr)
+            {
+                ::CloseHandle(event_);
+                event_ = nullptr;
+            }
+#endif
+        }
+
+        /// word 仍等于 expected 时阻塞，最长 timeout
+        void Wait(
+            std::atomic<uint32_t>&    word,
+            uint32_t                  expected,
+            std::chrono::milliseconds timeout) const
+        {
+            if (word.load(std::memory_order_acquire) != expected)
+            {
+                return;
+            }
+#if defined(DAS_WINDOWS)
+            ::WaitForSingleObject(event_, static_cast<DWORD>(timeout.count()));
+#elif defined(__linux__)
+            timespec ts{};
+            ts.tv_sec = static_cast<time_t>(timeout.count() / 1000);
+            ts.tv_nsec = static_cast<long>((timeout.count() % 1000) * 1000000);
+            ::syscall(
+                SYS_futex,
+                reinterpret_cast<uint32_t*>(&word),
+                FUTEX_WAIT,
+                expected,
+                &ts,
+                nullptr,
+                0);
+#else
+            (void)timeout;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+#endif
+        }
+
+        /// 递增序号并唤醒等待者
+        void Ring(std::atomic<uint32_t>& word) const
+        {
+            word.fetch_add(1, std::memory_order_release);
+#if defined(DAS_WINDOWS)
+            ::SetEvent(event_);
+#elif defined(__linux__)
+            ::syscall(
+                SYS_futex,
+                reinterpret_cast<uint32_t*>(&word),
+                FUTEX_WAKE,
+                INT_MAX,
+                nullptr,
+                nullptr,
+                0);
+#endif
+        }
+
+    private:
+#if defined(DAS_WINDOWS)
+        HANDLE event_ = nullptr;
+#endif
+    };
+} // namespace
+
+struct ShmRingIpcTransport::Impl
+{
+    explicit Impl(boost::asio::io_context& io_context) : rx_timer(io_context)
+    {
+    }
+
+    ~Impl() { Close(); }
+
+    Impl(const Impl&) = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    DasResult Map(
+        const std::string& name,
+        bool               server,
+        size_t             max_size,
+        size_t             ring_capacity)
+    {
+        namespace bip = boost::interprocess;
+
+        try
+        {
+            if (server)
+            {
+                bip::shared_memory_object::remove(name.c_str());
+
+                IpcSecurityAttributes    sec;
+                bip::shared_memory_object shm(
+                    bip::create_only,
+                    name.c_str(),
+                    bip::read_write,
+                    sec.GetPermissions());
+                shm.truncate(
+                    static_cast<bip::offset_t>(SegmentSize(ring_capacity)));
+                region = bip::mapped_region(shm, bip::read_write);
+
+                header = ::new (region.get_address()) ShmRingSegmentHeader{};
+                header->magic = kRingMagic;
+                header->version = kRingVersion;
+                header->ring_capacity = ring_capacity;
+                header->max_message_size = max_size;
+            }
+            else
+            {
+                bip::shared_memory_object shm(
+                    bip::open_only,
+                    name.c_str(),
+                    bip::read_write);
+                region = bip::mapped_region(shm, bip::read_write);
+
+                header =
+                    static_cast<ShmRingSegmentHeader*>(region.get_address());
+                if (region.get_size() < kSegmentHeaderSize
+                    || header->magic != kRingMagic
+                    || header->version != kRingVersion
+                    || !std::has_single_bit(header->ring_capacity)
+                    || region.get_size() < SegmentSize(header->ring_capacity))
+                {
+                    DAS_CORE_LOG_ERROR(
+                        "ShmRing segment layout mismatch: name = {}, "
+                        "size = {}",
+                        name,
+                        region.get_size());
+                    header = nullptr;
+                    return DAS_E_IPC_SHM_FAILED;
+                }
+            }
+        }
+        catch (const bip::interprocess_exception& e)
+        {
+            DAS_CORE_LOG_ERROR(
+                "ShmRing segment {} failed: name = {}, error = {}",
+                server ? "create" : "open",
+                name,
+                ToString(e.what()));
+            header = nullptr;
+            return DAS_E_IPC_SHM_FAILED;
+        }
+
+        capacity = static_cast<size_t>(header->ring_capacity);
+        max_message_size = static_cast<size_t>(header->max_message_size);
+
+        auto* base = static_cast<uint8_t*>(region.get_address());
+        uint8_t* data0 = base + kSegmentHeaderSize;
+        uint8_t* data1 = data0 + capacity;
+
+        const int tx_index = server ? 0 : 1;
+        tx = &header->rings[tx_index];
+        rx = &header->rings[1 - tx_index];
+        tx_data = server ? data0 : data1;
+        rx_data = server ? data1 : data0;
+        local_closed = server ? &header->server_closed : &header->client_closed;
+        peer_closed = server ? &header->client_closed : &header->server_closed;
+
+        // 门铃名按方向区分，两端对同一方向使用同一个事件
+        const std::string bell0 = name + "_d0";
+        const std::string bell1 = name + "_d1";
+        DasResult         result =
+            tx_bell.Open(server ? bell0 : bell1, server);
+        if (DAS::IsOk(result))
+        {
+            result = rx_bell.Open(server ? bell1 : bell0, server);
+        }
+        return result;
+    }
+
+    void StartDoorbellThread()
+    {
+        std::weak_ptr<Impl> weak = self;
+        doorbell_thread = std::thread([this, weak]() { DoorbellLoop(weak); });
+    }
+
+    /// 门铃线程：接收协程挂起后，阻塞等待 rx 环可读，再投递回 io_context
+    void DoorbellLoop(const std::weak_ptr<Impl>& weak)
+    {
+        for (;;)
+        {
+            while (!armed.load(std::memory_order_acquire))
+            {
+                if (stopping.load(std::memory_order_acquire))
+                {
+                    return;
+                }
+                armed.wait(false, std::memory_order_acquire);
+            }
+
+            WaitReadable();
+            if (stopping.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            armed.store(false, std::memory_order_release);
+            boost::asio::post(
+                rx_timer.get_executor(),
+                [weak]()
+                {
+                    if (auto impl = weak.lock())
+                    {
+                        impl->rx_timer.cancel();
+                    }
+                });
+        }
+    }
+
+    void WaitReadable()
+    {
+        while (!stopping.load(std::memory_order_acquire))
+        {
+            const uint32_t seq = rx->doorbell.load(std::memory_order_acquire);
+            rx->consumer_waiting.store(1, std::memory_order_relaxed);
+            // 与 TryWriteFrame 中发布 tail 后的栅栏配对
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            const bool readable = rx->tail.load(std::memory_order_acquire)
+                                  != rx->head.load(std::memory_order_relaxed);
+            if (readable || peer_closed->load(std::memory_order_acquire))
+            {
+                rx->consumer_waiting.store(0, std::memory_order_relaxed);
+                return;
+            }
+
+            rx_bell.Wait(rx->doorbell, seq, kDoorbellWaitSlice);
+            rx->consumer_waiting.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryWriteFrame(
+        const ValidatedIPCMessageHeader& header_in,
+        const uint8_t*                   body,
+        size_t                           body_size)
+    {
+        const size_t frame_size = FrameSize(body_size);
+
+        // 发送可能来自多个线程（HostLauncher::Stop 等），互斥保证单生产者
+        std::lock_guard<std::mutex> lock(send_mutex);
+
+        const uint64_t head = tx->head.load(std::memory_order_acquire);
+        const uint64_t tail = tx->tail.load(std::memory_order_relaxed);
+        if (capacity - static_cast<size_t>(tail - head) < frame_size)
+        {
+            return false;
+        }
+
+        IPCMessageHeader raw = header_in.Raw();
+        raw.body_size = static_cast<uint32_t>(body_size);
+        CopyIntoRing(
+            tx_data,
+            capacity,
+            tail,
+            reinterpret_cast<const uint8_t*>(&raw),
+            sizeof(raw));
+        CopyIntoRing(tx_data, capacity, tail + sizeof(raw), body, body_size);
+        tx->tail.store(tail + frame_size, std::memory_order_release);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (tx->consumer_waiting.load(std::memory_order_relaxed) != 0)
+        {
+            tx_bell.Ring(tx->doorbell);
+        }
+        return true;
+    }
+
+    /// 读取一帧：环空时返回 DAS_S_OK 且 out 为空
+    DasResult TryReadFrame(std::optional<AsyncIpcMessage>& out)
+    {
+        const uint64_t tail = rx->tail.load(std::memory_order_acquire);
+        const uint64_t head = rx->head.load(std::memory_order_relaxed);
+        if (tail == head)
+        {
+            return DAS_S_OK;
+        }
+
+        const size_t available = static_cast<size_t>(tail - head);
+        if (available < sizeof(IPCMessageHeader))
+        {
+            DAS_CORE_LOG_ERROR(
+                "ShmRing frame truncated: available = {}",
+                available);
+            return DAS_E_IPC_INVALID_MESSAGE;
+        }
+
+        uint8_t header_bytes[sizeof(IPCMessageHeader)];
+        CopyFromRing(rx_data, capacity, head, header_bytes, sizeof(header_bytes));
+
+        HeaderValidationResult validation_error;
+        auto validated_header = ValidatedIPCMessageHeader::Deserialize(
+            header_bytes,
+            sizeof(header_bytes),
+            &validation_error);
+        if (!validated_header.has_value())
+        {
+            DAS_CORE_LOG_ERROR(
+                "ShmRing header validation failed: {}",
+                validation_error.message);
+            return DAS_E_IPC_INVALID_MESSAGE;
+        }
+
+        const size_t body_size = validated_header->Raw().body_size;
+        const size_t frame_size = FrameSize(body_size);
+        if (body_size > max_message_size || frame_size > available)
+        {
+            DAS_CORE_LOG_ERROR(
+                "ShmRing frame invalid: body_size = {}, max = {}, "
+                "available = {}",
+                body_size,
+                max_message_size,
+                available);
+            return DAS_E_IPC_INVALID_MESSAGE;
+        }
+
+        std::vector<uint8_t> body(body_size);
+        CopyFromRing(
+            rx_data,
+            capacity,
+            head + sizeof(IPCMessageHeader),
+            body.data(),
+            body_size);
+        rx->head.store(head + frame_size, std::memory_order_release);
+
+        out.emplace(*validated_header, IpcMessageBody{});
+        return ResolveBody(out->first, std::move(body), out->second);
+    }
+
+    DasResult ResolveBody(
+        const ValidatedIPCMessageHeader& header_in,
+        std::vector<uint8_t>&&           body,
+        IpcMessageBody&                  out_body)
+    {
+        if ((header_in.Raw().flags & kRingFlagLargeMessage) == 0)
+        {
+            out_body = std::move(body);
+            return DAS_S_OK;
+        }
+
+        if (pool == nullptr)
+        {
+            DAS_CORE_LOG_ERROR(
+                "Large message received but shared memory pool not set");
+            return DAS_E_IPC_INVALID_MESSAGE;
+        }
+        if (body.size() < sizeof(uint64_t))
+        {
+            DAS_CORE_LOG_ERROR("Large message handle missing");
+            return DAS_E_IPC_INVALID_MESSAGE;
+        }
+
+        uint64_t handle;
+        std::memcpy(&handle, body.data(), sizeof(uint64_t));
+
+        SharedMemoryBlock shm_block;
+        if (pool->GetBlockByHandle(handle, shm_block) != DAS_S_OK)
+        {
+            DAS_CORE_LOG_ERROR(
+                "Failed to get shared memory block for handle = {}",
+                handle);
+            return DAS_E_IPC_INVALID_MESSAGE;
+        }
+
+        out_body = IpcMessageBody::BorrowSharedMemory(*pool, shm_block);
+        if (!out_body.IsBorrowed())
+        {
+            DAS_CORE_LOG_ERROR(
+                "Shared memory block released before borrow, handle = {}",
+                handle);
+            return DAS_E_IPC_INVALID_MESSAGE;
+        }
+        return DAS_S_OK;
+    }
+
+    [[nodiscard]]
+    bool PeerClosed() const noexcept
+    {
+        return peer_closed != nullptr
+               && peer_closed->load(std::memory_order_acquire) != 0;
+    }
+
+    void Close()
+    {
+        if (closed.exchange(true))
+        {
+            return;
+        }
+
+        const bool was_connected =
+            connected.exchange(false, std::memory_order_acq_rel);
+        if (was_connected)
+        {
+            // 通知对端：标记关闭并敲对端的接收门铃
+            local_closed->store(1, std::memory_order_release);
+            tx_bell.Ring(tx->doorbell);
+        }
+
+        stopping.store(true, std::memory_order_release);
+        armed.store(true, std::memory_order_release);
+        armed.notify_all();
+        if (was_connected)
+        {
+            rx_bell.Ring(rx->doorbell);
+        }
+
+        if (doorbell_thread.joinable())
+        {
+            doorbell_thread.join();
+        }
+
+        // 挂起的接收协程在 io_context 线程上取消
+        std::weak_ptr<Impl> weak = self;
+        boost::asio::post(
+            rx_timer.get_executor(),
+            [weak]()
+            {
+                if (auto impl = weak.lock())
+                {
+                    impl->rx_timer.cancel();
+                }
+            });
+
+        if (is_server && !segment_name.empty())
+        {
+            boost::interprocess::shared_memory_object::remove(
+                segment_name.c_str());
+        }
+    }
+
+    std::weak_ptr<Impl> self;
+
+    std::string segment_name;
+    bool        is_server = false;
+    size_t      max_message_size = 65536;
+    size_t      capacity = 0;
+
+    boost::interprocess::mapped_region region;
+    ShmRingSegmentHeader*              header = nullptr;
+    RingControl*                       tx = nullptr;
+    RingControl*                       rx = nullptr;
+    uint8_t*                           tx_data = nullptr;
+    uint8_t*                           rx_data = nullptr;
+    std::atomic<uint32_t>*             local_closed = nullptr;
+    std::atomic<uint32_t>*             peer_closed = nullptr;
+    Doorbell                           tx_bell;
+    Doorbell                           rx_bell;
+
+    SharedMemoryPool* pool = nullptr;
+    std::mutex        send_mutex;
+
+    boost::asio::steady_timer rx_timer;
+    std::thread               doorbell_thread;
+    std::atomic<bool>         armed{false};
+    std::atomic<bool>         stopping{false};
+    std::atomic<bool>         connected{false};
+    std::atomic<bool>         closed{false};
+};
+
+ShmRingIpcTransport::ShmRingIpcTransport(boost::asio::io_context& io_context)
+    : io_context_(io_context), impl_(std::make_shared<Impl>(io_context))
+{
+    impl_->self = impl_;
+}
+
+ShmRingIpcTransport::~ShmRingIpcTransport() { Cleanup(); }
+
+ShmRingIpcTransport::ShmRingIpcTransport(ShmRingIpcTransport&& other) noexcept
+    : io_context_(other.io_context_), impl_(std::move(other.impl_))
+{
+}
+
+ShmRingIpcTransport& ShmRingIpcTransport::operator=(
+    ShmRingIpcTransport&& other) noexcept
+{
+    if (this != &other)
+    {
+        Cleanup();
+        io_context_ = other.io_context_;
+        impl_ = std::move(other.impl_);
+    }
+    return *this;
+}
+
+std::unique_ptr<ShmRingIpcTransport> ShmRingIpcTransport::CreateUninitialized(
+    boost::asio::io_context& io_context)
+{
+    return std::unique_ptr<ShmRingIpcTransport>(
+        new ShmRingIpcTransport(io_context));
+}
+
+boost::asio::awaitable<
+    DAS::Utils::Expected<std::unique_ptr<ShmRingIpcTransport>>>
+ShmRingIpcTransport::CreateAsync(
+    boost::asio::io_context& io_context,
+    const std::string&       read_endpoint,
+    const std::string&       write_endpoint,
+    bool                     is_server,
+    size_t                   max_message_size)
+{
+    auto instance = std::unique_ptr<ShmRingIpcTransport>(
+        new ShmRingIpcTransport(io_context));
+
+    auto result = co_await instance->InitializeAsync(
+        read_endpoint,
+        write_endpoint,
+        is_server,
+        max_message_size);
+    if (result != DAS_S_OK)
+    {
+        co_return DAS::Utils::MakeUnexpected(result);
+    }
+
+    co_return instance;
+}
+
+boost::asio::awaitable<DasResult> ShmRingIpcTransport::InitializeAsync(
+    const std::string& read_endpoint,
+    const std::string& write_endpoint,
+    bool               is_server,
+    size_t             max_message_size)
+{
+    (void)write_endpoint;
+    co_return Initialize(read_endpoint, is_server, max_message_size);
+}
+
+DasResult ShmRingIpcTransport::Initialize(
+    const std::string& segment_name,
+    bool               is_server,
+    size_t             max_message_size,
+    size_t             ring_capacity)
+{
+    if (!impl_ || impl_->connected.load() || impl_->closed.load())
+    {
+        return DAS_E_IPC_INVALID_STATE;
+    }
+
+    if (segment_name.empty() || !std::has_single_bit(ring_capacity)
+        || ring_capacity < 2 * FrameSize(max_message_size))
+    {
+        DAS_CORE_LOG_ERROR(
+            "ShmRing invalid arguments: name = {}, ring_capacity = {}, "
+            "max_message_size = {}",
+            segment_name,
+            ring_capacity,
+            max_message_size);
+        return DAS_E_IPC_INVALID_ARGUMENT;
+    }
+
+    const auto result =
+        impl_->Map(segment_name, is_server, max_message_size, ring_capacity);
+    if (DAS::IsFailed(result))
+    {
+        if (is_server)
+        {
+            boost::interprocess::shared_memory_object::remove(
+                segment_name.c_str());
+        }
+        return result;
+    }
+
+    impl_->segment_name = segment_name;
+    impl_->is_server = is_server;
+    impl_->connected.store(true, std::memory_order_release);
+    impl_->StartDoorbellThread();
+
+    DAS_CORE_LOG_INFO(
+        "ShmRing transport ready: name = {}, is_server = {}, "
+        "ring_capacity = {}",
+        segment_name,
+        is_server,
+        impl_->capacity);
+    return DAS_S_OK;
+}
+
+bool ShmRingIpcTransport::IsConnected() const
+{
+    return impl_ && impl_->connected.load(std::memory_order_acquire)
+           && !impl_->PeerClosed();
+}
+
+std::string ShmRingIpcTransport::GetEndpointName() const
+{
+    return impl_ ? impl_->segment_name : std::string{};
+}
+
+void ShmRingIpcTransport::SetSharedMemoryPool(SharedMemoryPool* pool)
+{
+    if (impl_)
+    {
+        impl_->pool = pool;
+    }
+}
+
+void ShmRingIpcTransport::Cleanup()
+{
+    if (impl_)
+    {
+        impl_->Close();
+    }
+}
+
+boost::asio::awaitable<std::variant<DasResult, AsyncIpcMessage>>
+ShmRingIpcTransport::ReceiveCoroutine()
+{
+    // 协程期间持有 Impl，Cleanup/析构不会让挂起中的接收悬空
+    auto impl = impl_;
+    if (!impl || !impl->connected.load(std::memory_order_acquire))
+    {
+        co_return DAS_E_IPC_CONNECTION_LOST;
+    }
+
+    for (;;)
+    {
+        for (int spin = 0; spin < kReceiveSpinCount; ++spin)
+        {
+            std::optional<AsyncIpcMessage> message;
+            const auto                     result = impl->TryReadFrame(message);
+            if (DAS::IsFailed(result))
+            {
+                co_return result;
+            }
+            if (message)
+            {
+                co_return std::move(*message);
+            }
+        }
+
+        if (!impl->connected.load(std::memory_order_acquire))
+        {
+            co_return DAS_E_IPC_CONNECTION_LOST;
+        }
+        if (impl->PeerClosed()
+            && impl->rx->tail.load(std::memory_order_acquire)
+                   == impl->rx->head.load(std::memory_order_relaxed))
+        {
+            co_return DAS_E_IPC_CONNECTION_LOST;
+        }
+
+        // 交给门铃线程等待；超时兜底重新检查关闭状态
+        impl->rx_timer.expires_after(kDoorbellWaitSlice);
+        impl->armed.store(true, std::memory_order_release);
+        impl->armed.notify_one();
+
+        boost::system::error_code ec;
+        co_await impl->rx_timer.async_wait(
+            boost::asio::redirect_error(boost::asio::use_awaitable, ec));
+    }
+}
+
+boost::asio::awaitable<DasResult> ShmRingIpcTransport::SendCoroutine(
+    const ValidatedIPCMessageHeader& header,
+    const uint8_t*                   body,
+    size_t                           body_size)
+{
+    auto impl = impl_;
+    if (!impl || !impl->connected.load(std::memory_order_acquire))
+    {
+        co_return DAS_E_IPC_CONNECTION_LOST;
+    }
+
+    if (body_size > impl->max_message_size)
+    {
+        DAS_CORE_LOG_ERROR(
+            "ShmRing send body too large: body_size = {}, max = {}",
+            body_size,
+            impl->max_message_size);
+        co_return DAS_E_IPC_SEND_FAILED;
+    }
+
+    if (impl->TryWriteFrame(header, body, body_size))
+    {
+        co_return DAS_S_OK;
+    }
+
+    // 环满：退避等待对端消费
+    boost::asio::steady_timer timer(io_context_.get());
+    std::chrono::microseconds backoff = kSendBackoffMin;
+    for (;;)
+    {
+        if (!impl->connected.load(std::memory_order_acquire)
+            || impl->PeerClosed())
+        {
+            co_return DAS_E_IPC_CONNECTION_LOST;
+        }
+
+        timer.expires_after(backoff);
+        boost::system::error_code ec;
+        co_await timer.async_wait(
+            boost::asio::redirect_error(boost::asio::use_awaitable, ec));
+
+        if (impl->TryWriteFrame(header, body, body_size))
+        {
+            co_return DAS_S_OK;
+        }
+        backoff = (std::min)(
+            backoff * 2,
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                kSendBackoffMax));
+    }
+}
+
+DAS_CORE_IPC_NS_END
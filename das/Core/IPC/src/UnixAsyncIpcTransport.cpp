@@ -105,8 +105,7 @@ UnixAsyncIpcTransport::UnixAsyncIpcTransport(
       is_connected_(std::exchange(other.is_connected_, false)),
       max_message_size_(other.max_message_size_),
       shared_memory_pool_(other.shared_memory_pool_),
-      header_buffer_(std::move(other.header_buffer_)),
-      body_buffer_(std::move(other.body_buffer_))
+      header_buffer_(std::move(other.header_buffer_))
 {
 }
 
@@ -126,7 +125,6 @@ UnixAsyncIpcTransport& UnixAsyncIpcTransport::operator=(
         max_message_size_ = other.max_message_size_;
         shared_memory_pool_ = other.shared_memory_pool_;
         header_buffer_ = std::move(other.header_buffer_);
-        body_buffer_ = std::move(other.body_buffer_);
     }
     return *this;
 }
@@ -231,7 +229,6 @@ boost::asio::awaitable<DasResult> UnixAsyncIpcTransport::InitializeAsync(
     endpoint_name_ = NormalizeUnixEndpoint(read_endpoint);
     is_server_ = is_server;
     max_message_size_ = max_message_size;
-    body_buffer_.reserve(max_message_size);
 
     if (is_server)
     {
@@ -456,13 +453,14 @@ UnixAsyncIpcTransport::ReceiveCoroutine()
         co_return DAS_E_IPC_INVALID_MESSAGE;
     }
 
-    body_buffer_.resize(body_size);
+    // 每条消息使用独立的 body，直接 move 给调用方，避免拷贝
+    std::vector<uint8_t> body_buffer(body_size);
 
     if (body_size > 0)
     {
         co_await boost::asio::async_read(
             socket_,
-            boost::asio::buffer(body_buffer_),
+            boost::asio::buffer(body_buffer),
             boost::asio::use_awaitable);
     }
 
@@ -475,14 +473,14 @@ UnixAsyncIpcTransport::ReceiveCoroutine()
             co_return DAS_E_IPC_INVALID_MESSAGE;
         }
 
-        if (body_buffer_.size() < sizeof(uint64_t))
+        if (body_buffer.size() < sizeof(uint64_t))
         {
             DAS_LOG_ERROR("Large message handle missing");
             co_return DAS_E_IPC_INVALID_MESSAGE;
         }
 
         uint64_t handle;
-        std::memcpy(&handle, body_buffer_.data(), sizeof(uint64_t));
+        std::memcpy(&handle, body_buffer.data(), sizeof(uint64_t));
 
         SharedMemoryBlock shm_block;
         const auto        result =
@@ -497,15 +495,23 @@ UnixAsyncIpcTransport::ReceiveCoroutine()
             co_return DAS_E_IPC_INVALID_MESSAGE;
         }
 
-        std::vector<uint8_t> large_body(shm_block.size);
-        std::memcpy(large_body.data(), shm_block.data, shm_block.size);
-
-        shared_memory_pool_->Deallocate(handle);
-
-        co_return AsyncIpcMessage{header, std::move(large_body)};
+        // 零拷贝：消息体直接借用 SHM 块，最后一个引用释放时归还
+        auto body = IpcMessageBody::BorrowSharedMemory(
+            *shared_memory_pool_,
+            shm_block);
+        if (!body.IsBorrowed())
+        {
+            DAS_LOG_ERROR(
+                DAS_FMT_NS::format(
+                    "Shared memory block released before borrow, handle = {}",
+                    handle)
+                    .c_str());
+            co_return DAS_E_IPC_INVALID_MESSAGE;
+        }
+        co_return AsyncIpcMessage{header, std::move(body)};
     }
 
-    co_return AsyncIpcMessage{header, body_buffer_};
+    co_return AsyncIpcMessage{header, std::move(body_buffer)};
 }
 
 boost::asio::awaitable<DasResult> UnixAsyncIpcTransport::SendCoroutine(
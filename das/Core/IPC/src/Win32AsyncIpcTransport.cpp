@@ -728,12 +728,20 @@ Win32AsyncIpcTransport::ReceiveCoroutine()
             co_return DAS_E_IPC_INVALID_MESSAGE;
         }
 
-        std::vector<uint8_t> large_body(shm_block.size);
-        std::memcpy(large_body.data(), shm_block.data, shm_block.size);
-
-        state->shared_memory_pool->Deallocate(handle);
-
-        co_return AsyncIpcMessage{header, std::move(large_body)};
+        // 零拷贝：消息体直接借用 SHM 块，最后一个引用释放时归还
+        auto body = IpcMessageBody::BorrowSharedMemory(
+            *state->shared_memory_pool,
+            shm_block);
+        if (!body.IsBorrowed())
+        {
+            DAS_LOG_ERROR(
+                DAS_FMT_NS::format(
+                    "Shared memory block released before borrow, handle = {}",
+                    handle)
+                    .c_str());
+            co_return DAS_E_IPC_INVALID_MESSAGE;
+        }
+        co_return AsyncIpcMessage{header, std::move(body)};
     }
 
     co_return AsyncIpcMessage{header, std::move(body_buffer)};
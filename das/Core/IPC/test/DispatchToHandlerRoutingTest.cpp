@@ -156,7 +156,7 @@ namespace
 
         boost::asio::awaitable<DasResult> HandleMessage(
             const ValidatedIPCMessageHeader& /*header*/,
-            const std::vector<uint8_t>& /*body*/,
+            const IpcMessageBody& /*body*/,
             IpcResponseSender& /*sender*/,
             ControlPlaneContext& ctx) override
         {
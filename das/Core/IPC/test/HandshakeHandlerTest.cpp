@@ -282,8 +282,10 @@ TEST_F(
 
     HeartbeatV1 request{};
     InitHeartbeat(request, 1234);
-    std::vector<uint8_t> body(sizeof(request));
-    std::memcpy(body.data(), &request, sizeof(request));
+    std::vector<uint8_t> request_bytes(sizeof(request));
+    std::memcpy(request_bytes.data(), &request, sizeof(request));
+    // 协程按引用捕获 body，必须在 co_spawn 期间保持存活
+    const IpcMessageBody body{std::move(request_bytes)};
 
     auto heartbeat_handler = HandshakeHandler::Create(LOCAL_SESSION_ID);
     ASSERT_NE(heartbeat_handler, nullptr);
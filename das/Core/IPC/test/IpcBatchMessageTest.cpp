@@ -0,0 +1,234 @@
+#include <cstring>
+#include <das/Core/IPC/IpcBatchMessage.h>
+#include <das/Core/IPC/IpcCallBatch.h>
+#include <das/Core/IPC/IpcMessageHeaderBuilder.h>
+#include <das/Core/IPC/IpcResponseSender.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using DAS::Core::IPC::DecodeIpcBatch;
+using DAS::Core::IPC::InboundMessage;
+using DAS::Core::IPC::IPCMessageHeader;
+using DAS::Core::IPC::IPCMessageHeaderBuilder;
+using DAS::Core::IPC::IpcBatchWriter;
+using DAS::Core::IPC::IpcCallBatch;
+using DAS::Core::IPC::IpcMessageBody;
+using DAS::Core::IPC::IpcResponseSender;
+using DAS::Core::IPC::MessageType;
+using DAS::Core::IPC::ValidatedIPCMessageHeader;
+
+namespace
+{
+    ValidatedIPCMessageHeader MakeRequestHeader(uint16_t call_id)
+    {
+        return IPCMessageHeaderBuilder()
+            .SetMessageType(MessageType::REQUEST)
+            .SetInterfaceId(0x1234)
+            .SetCallId(call_id)
+            .SetSourceSessionId(1)
+            .SetTargetSessionId(2)
+            .Build();
+    }
+} // namespace
+
+TEST(IpcBatchMessageTest, EmptyWriterEncodesZeroCount)
+{
+    IpcBatchWriter writer;
+    EXPECT_EQ(writer.Count(), 0u);
+
+    std::vector<InboundMessage> messages;
+    EXPECT_EQ(DecodeIpcBatch(writer.TakeBuffer(), messages), DAS_S_OK);
+    EXPECT_TRUE(messages.empty());
+}
+
+TEST(IpcBatchMessageTest, RoundTripPreservesHeadersAndBodies)
+{
+    const std::vector<std::vector<uint8_t>> bodies{{1, 2, 3}, {}, {4}};
+
+    IpcBatchWriter writer;
+    for (size_t i = 0; i < bodies.size(); ++i)
+    {
+        writer.Append(
+            MakeRequestHeader(static_cast<uint16_t>(10 + i)),
+            bodies[i].data(),
+            bodies[i].size());
+    }
+    EXPECT_EQ(writer.Count(), bodies.size());
+
+    std::vector<InboundMessage> messages;
+    ASSERT_EQ(DecodeIpcBatch(writer.TakeBuffer(), messages), DAS_S_OK);
+    ASSERT_EQ(messages.size(), bodies.size());
+
+    for (size_t i = 0; i < bodies.size(); ++i)
+    {
+        EXPECT_EQ(messages[i].header.GetCallId(), 10 + i);
+        EXPECT_EQ(messages[i].header.GetInterfaceId(), 0x1234u);
+        EXPECT_EQ(messages[i].header.GetBodySize(), bodies[i].size());
+        EXPECT_EQ(messages[i].body.ToVector(), bodies[i]);
+    }
+
+    // 写入器取出后恢复为空信封
+    EXPECT_EQ(writer.Count(), 0u);
+}
+
+TEST(IpcBatchMessageTest, InnerBodiesBorrowOuterBodyUntilLastRelease)
+{
+    IpcBatchWriter             writer;
+    const std::vector<uint8_t> body{7, 8, 9};
+    writer.Append(MakeRequestHeader(1), body.data(), body.size());
+    writer.Append(MakeRequestHeader(2), body.data(), body.size());
+    auto envelope = writer.TakeBuffer();
+
+    auto  lease_alive = std::make_shared<bool>(true);
+    auto* storage = new std::vector<uint8_t>(std::move(envelope));
+    std::shared_ptr<const void> lease{
+        storage->data(),
+        [storage, lease_alive](const void*) mutable
+        {
+            *lease_alive = false;
+            delete storage;
+        }};
+    auto outer =
+        IpcMessageBody::Borrow(storage->data(), storage->size(), lease);
+    lease.reset();
+
+    std::vector<InboundMessage> messages;
+    ASSERT_EQ(DecodeIpcBatch(std::move(outer), messages), DAS_S_OK);
+    ASSERT_EQ(messages.size(), 2u);
+    EXPECT_TRUE(messages[0].body.IsBorrowed());
+
+    messages.erase(messages.begin());
+    EXPECT_TRUE(*lease_alive);
+    EXPECT_EQ(messages[0].body.ToVector(), body);
+
+    messages.clear();
+    EXPECT_FALSE(*lease_alive);
+}
+
+TEST(IpcBatchMessageTest, RejectsCountLargerThanBody)
+{
+    std::vector<uint8_t> envelope(sizeof(uint32_t), 0);
+    const uint32_t       count = 1000;
+    std::memcpy(envelope.data(), &count, sizeof(count));
+
+    std::vector<InboundMessage> messages;
+    EXPECT_EQ(
+        DecodeIpcBatch(std::move(envelope), messages),
+        DAS_E_IPC_INVALID_MESSAGE_BODY);
+    EXPECT_TRUE(messages.empty());
+}
+
+TEST(IpcBatchMessageTest, RejectsTruncatedInnerBody)
+{
+    IpcBatchWriter             writer;
+    const std::vector<uint8_t> body{1, 2, 3, 4};
+    writer.Append(MakeRequestHeader(1), body.data(), body.size());
+    auto envelope = writer.TakeBuffer();
+    envelope.pop_back();
+
+    std::vector<InboundMessage> messages;
+    EXPECT_EQ(
+        DecodeIpcBatch(std::move(envelope), messages),
+        DAS_E_IPC_INVALID_MESSAGE_BODY);
+}
+
+TEST(IpcBatchMessageTest, TruncatedBatchReturnsDecodableHeaders)
+{
+    IpcBatchWriter             writer;
+    const std::vector<uint8_t> body{1, 2, 3, 4};
+    writer.Append(MakeRequestHeader(1), body.data(), body.size());
+    writer.Append(MakeRequestHeader(2), body.data(), body.size());
+    auto envelope = writer.TakeBuffer();
+    envelope.resize(envelope.size() - 2);
+
+    std::vector<InboundMessage> messages;
+    EXPECT_EQ(
+        DecodeIpcBatch(std::move(envelope), messages),
+        DAS_E_IPC_INVALID_MESSAGE_BODY);
+
+    // 出错条目的消息头同样可解，body 一律丢弃
+    ASSERT_EQ(messages.size(), 2u);
+    EXPECT_EQ(messages[0].header.GetCallId(), 1u);
+    EXPECT_EQ(messages[1].header.GetCallId(), 2u);
+    EXPECT_TRUE(messages[0].body.empty());
+    EXPECT_TRUE(messages[1].body.empty());
+}
+
+TEST(IpcBatchMessageTest, RejectsTrailingBytes)
+{
+    IpcBatchWriter writer;
+    writer.Append(MakeRequestHeader(1), nullptr, 0);
+    auto envelope = writer.TakeBuffer();
+    envelope.push_back(0xFF);
+
+    std::vector<InboundMessage> messages;
+    EXPECT_EQ(
+        DecodeIpcBatch(std::move(envelope), messages),
+        DAS_E_IPC_INVALID_MESSAGE_BODY);
+}
+
+TEST(IpcBatchMessageTest, RejectsInvalidInnerHeader)
+{
+    IpcBatchWriter writer;
+    writer.Append(MakeRequestHeader(1), nullptr, 0);
+    auto envelope = writer.TakeBuffer();
+    // 破坏内层 header 的 magic
+    envelope[sizeof(uint32_t)] ^= 0xFF;
+
+    std::vector<InboundMessage> messages;
+    EXPECT_EQ(
+        DecodeIpcBatch(std::move(envelope), messages),
+        DAS_E_IPC_INVALID_MESSAGE_HEADER);
+}
+
+TEST(IpcBatchMessageTest, BatchRouteCollectsResponsesInsteadOfSending)
+{
+    IpcBatchWriter    writer;
+    IpcResponseSender sender(IpcResponseSender::BatchRoute{&writer});
+
+    auto response_header = IPCMessageHeaderBuilder()
+                               .SetMessageType(MessageType::RESPONSE)
+                               .SetCallId(42)
+                               .SetSourceSessionId(2)
+                               .SetTargetSessionId(1)
+                               .Build();
+    EXPECT_EQ(
+        sender.SendResponse(response_header, std::vector<uint8_t>{5, 6}),
+        DAS_S_OK);
+    EXPECT_EQ(writer.Count(), 1u);
+
+    std::vector<InboundMessage> messages;
+    ASSERT_EQ(DecodeIpcBatch(writer.TakeBuffer(), messages), DAS_S_OK);
+    ASSERT_EQ(messages.size(), 1u);
+    EXPECT_EQ(messages[0].header.GetMessageType(), MessageType::RESPONSE);
+    EXPECT_EQ(messages[0].header.GetCallId(), 42);
+    EXPECT_EQ(messages[0].body.ToVector(), (std::vector<uint8_t>{5, 6}));
+}
+
+TEST(IpcBatchMessageTest, RecordScopeNestsAndRestores)
+{
+    EXPECT_EQ(IpcCallBatch::Current(), nullptr);
+
+    IpcCallBatch outer;
+    {
+        IpcCallBatch::RecordScope outer_scope{outer};
+        EXPECT_EQ(IpcCallBatch::Current(), &outer);
+
+        IpcCallBatch inner;
+        {
+            IpcCallBatch::RecordScope inner_scope{inner};
+            EXPECT_EQ(IpcCallBatch::Current(), &inner);
+        }
+        EXPECT_EQ(IpcCallBatch::Current(), &outer);
+    }
+    EXPECT_EQ(IpcCallBatch::Current(), nullptr);
+}
+
+TEST(IpcBatchMessageTest, SubmittingEmptyBatchCompletesImmediately)
+{
+    IpcCallBatch batch;
+    auto         result = stdexec::sync_wait(std::move(batch).Submit());
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(std::get<0>(*result).empty());
+}
@@ -0,0 +1,355 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <das/Core/IPC/IpcMessageQueue.h>
+#include <deque>
+#include <gtest/gtest.h>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using DAS::Core::IPC::InboundMessage;
+using DAS::Core::IPC::IpcMessageQueue;
+using DAS::Core::IPC::IpcQueueProducer;
+
+namespace
+{
+    /// 改造前的 mutex + condvar 队列，作为微基准的对照组
+    template <typename T>
+    class MutexCondvarQueue
+    {
+    public:
+        explicit MutexCondvarQueue(size_t max_elements)
+            : max_elements_(max_elements)
+        {
+        }
+
+        DasResult Push(T msg)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (items_.size() >= max_elements_)
+            {
+                return DAS_E_IPC_QUEUE_FULL;
+            }
+            items_.push_back(std::move(msg));
+            cv_.notify_one();
+            return DAS_S_OK;
+        }
+
+        std::optional<T> Pop()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return !items_.empty(); });
+            T item = std::move(items_.front());
+            items_.pop_front();
+            return item;
+        }
+
+    private:
+        size_t                  max_elements_;
+        std::deque<T>           items_;
+        std::mutex              mutex_;
+        std::condition_variable cv_;
+    };
+
+    InboundMessage MakeEchoMessage()
+    {
+        // 与 Throughput_Sustained_10s 的 echo(32 bytes) 负载一致
+        InboundMessage msg;
+        msg.body = std::vector<uint8_t>(32, 'a');
+        return msg;
+    }
+
+    /// 多生产者持续投递，消费者逐条取出，返回 msgs/sec
+    template <typename Queue>
+    double MeasureStreaming(size_t producers, size_t per_producer)
+    {
+        Queue queue(1024);
+
+        const auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> threads;
+        for (size_t p = 0; p < producers; ++p)
+        {
+            threads.emplace_back(
+                [&queue, per_producer]()
+                {
+                    for (size_t i = 0; i < per_producer; ++i)
+                    {
+                        while (queue.Push(MakeEchoMessage()) != DAS_S_OK)
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+        }
+
+        const size_t total = producers * per_producer;
+        for (size_t i = 0; i < total; ++i)
+        {
+            EXPECT_TRUE(queue.Pop().has_value());
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return static_cast<double>(total)
+               / std::chrono::duration<double>(elapsed).count();
+    }
+
+    /// 一问一答的同步调用节奏：每条消息等消费者处理完才发下一条，
+    /// 返回单次交接的平均延迟（微秒）
+    template <typename Queue>
+    double MeasurePingPong(size_t rounds)
+    {
+        Queue               queue(1024);
+        std::atomic<size_t> handled{0};
+
+        std::thread consumer(
+            [&queue, &handled, rounds]()
+            {
+                for (size_t i = 0; i < rounds; ++i)
+                {
+                    if (queue.Pop())
+                    {
+                        handled.fetch_add(1, std::memory_order_release);
+                    }
+                }
+            });
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < rounds; ++i)
+        {
+            EXPECT_EQ(queue.Push(MakeEchoMessage()), DAS_S_OK);
+            while (handled.load(std::memory_order_acquire) <= i)
+            {
+                std::this_thread::yield();
+            }
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        consumer.join();
+
+        return std::chrono::duration<double, std::micro>(elapsed).count()
+               / static_cast<double>(rounds);
+    }
+} // namespace
+
+TEST(IpcMessageQueueTest, PushPopPreservesFifoOrder)
+{
+    IpcMessageQueue<int> queue(4);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(queue.Push(i), DAS_S_OK);
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+        auto item = queue.TryPop();
+        ASSERT_TRUE(item.has_value());
+        EXPECT_EQ(*item, i);
+    }
+    EXPECT_FALSE(queue.TryPop().has_value());
+}
+
+TEST(IpcMessageQueueTest, PushReturnsQueueFullAtCapacity)
+{
+    IpcMessageQueue<int> queue(3);
+    EXPECT_EQ(queue.Capacity(), 3u);
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(queue.Push(i), DAS_S_OK);
+    }
+    EXPECT_EQ(queue.Push(3), DAS_E_IPC_QUEUE_FULL);
+
+    // 环绕后槽位可复用
+    EXPECT_EQ(queue.TryPop(), 0);
+    EXPECT_EQ(queue.Push(3), DAS_S_OK);
+    EXPECT_EQ(queue.TryPop(), 1);
+    EXPECT_EQ(queue.TryPop(), 2);
+    EXPECT_EQ(queue.TryPop(), 3);
+}
+
+TEST(IpcMessageQueueTest, UninitializeRejectsPushAndDrainsRemaining)
+{
+    IpcMessageQueue<int> queue(4);
+    EXPECT_EQ(queue.Push(7), DAS_S_OK);
+
+    queue.Uninitialize();
+    EXPECT_TRUE(queue.IsUninitialized());
+    EXPECT_EQ(queue.Push(8), DAS_E_IPC_CANCELED);
+
+    EXPECT_EQ(queue.Pop(), 7);
+    EXPECT_FALSE(queue.Pop().has_value());
+}
+
+TEST(IpcMessageQueueTest, UninitializeWakesBlockedPop)
+{
+    IpcMessageQueue<int> queue(4);
+
+    std::thread consumer(
+        [&queue]() { EXPECT_FALSE(queue.Pop().has_value()); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.Uninitialize();
+    consumer.join();
+}
+
+TEST(IpcMessageQueueTest, NotifyWaitersWakesPopUntil)
+{
+    IpcMessageQueue<int> queue(4);
+    std::atomic_bool     done{false};
+
+    std::thread consumer(
+        [&queue, &done]()
+        {
+            EXPECT_FALSE(
+                queue
+                    .PopUntil([&done]()
+                              { return done.load(std::memory_order_acquire); })
+                    .has_value());
+        });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    done.store(true, std::memory_order_release);
+    queue.NotifyWaiters();
+    consumer.join();
+}
+
+TEST(IpcMessageQueueTest, PopUntilReturnsItemBeforePredicate)
+{
+    IpcMessageQueue<int> queue(4);
+    EXPECT_EQ(queue.Push(5), DAS_S_OK);
+    EXPECT_EQ(queue.PopUntil([]() { return true; }), 5);
+    EXPECT_FALSE(queue.PopUntil([]() { return true; }).has_value());
+}
+
+TEST(IpcMessageQueueTest, DestructorReleasesQueuedMessages)
+{
+    auto alive = std::make_shared<int>(0);
+    {
+        IpcMessageQueue<std::shared_ptr<int>> queue(4);
+        EXPECT_EQ(queue.Push(alive), DAS_S_OK);
+        EXPECT_EQ(queue.Push(alive), DAS_S_OK);
+        EXPECT_EQ(alive.use_count(), 3);
+    }
+    EXPECT_EQ(alive.use_count(), 1);
+}
+
+TEST(IpcMessageQueueTest, MultipleProducersDeliverEveryMessage)
+{
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 20000;
+
+    IpcMessageQueue<int> queue(64);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p)
+    {
+        producers.emplace_back(
+            [&queue, p]()
+            {
+                for (int i = 0; i < kPerProducer; ++i)
+                {
+                    while (queue.Push(p * kPerProducer + i) != DAS_S_OK)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+
+    // 每个生产者内部的顺序必须保持
+    std::vector<int>  last_seen(kProducers, -1);
+    std::vector<bool> seen(kProducers * kPerProducer, false);
+    for (int n = 0; n < kProducers * kPerProducer; ++n)
+    {
+        auto item = queue.Pop();
+        ASSERT_TRUE(item.has_value());
+        const int producer = *item / kPerProducer;
+        EXPECT_GT(*item, last_seen[producer]);
+        last_seen[producer] = *item;
+        EXPECT_FALSE(seen[*item]);
+        seen[*item] = true;
+    }
+
+    for (auto& t : producers)
+    {
+        t.join();
+    }
+    EXPECT_FALSE(queue.TryPop().has_value());
+}
+
+TEST(IpcMessageQueueTest, SingleProducerModeDeliversInOrder)
+{
+    constexpr int kCount = 50000;
+
+    IpcMessageQueue<int, IpcQueueProducer::Single> queue(16);
+
+    std::thread producer(
+        [&queue]()
+        {
+            for (int i = 0; i < kCount; ++i)
+            {
+                while (queue.Push(i) != DAS_S_OK)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+    for (int i = 0; i < kCount; ++i)
+    {
+        EXPECT_EQ(queue.Pop(), i);
+    }
+    producer.join();
+}
+
+// ====== 微基准：无锁环 vs mutex + condvar ======
+
+TEST(IpcMessageQueueTest, Benchmark_LockFreeVsMutexCondvar)
+{
+    constexpr size_t kStreamingPerProducer = 100000;
+    constexpr size_t kPingPongRounds = 20000;
+
+    const double mutex_stream_1 =
+        MeasureStreaming<MutexCondvarQueue<InboundMessage>>(
+            1,
+            kStreamingPerProducer);
+    const double ring_stream_1 =
+        MeasureStreaming<IpcMessageQueue<InboundMessage>>(
+            1,
+            kStreamingPerProducer);
+    const double mutex_stream_2 =
+        MeasureStreaming<MutexCondvarQueue<InboundMessage>>(
+            2,
+            kStreamingPerProducer);
+    const double ring_stream_2 =
+        MeasureStreaming<IpcMessageQueue<InboundMessage>>(
+            2,
+            kStreamingPerProducer);
+    const double mutex_ping =
+        MeasurePingPong<MutexCondvarQueue<InboundMessage>>(kPingPongRounds);
+    const double ring_ping =
+        MeasurePingPong<IpcMessageQueue<InboundMessage>>(kPingPongRounds);
+
+    std::cout << "\n";
+    std::cout << "  IpcMessageQueue: lock-free ring vs mutex+condvar\n";
+    std::cout << "  Payload:        InboundMessage echo(32 bytes)\n";
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "  Streaming 1P:   ring " << ring_stream_1 << " msg/s, mutex "
+              << mutex_stream_1 << " msg/s\n";
+    std::cout << "  Streaming 2P:   ring " << ring_stream_2 << " msg/s, mutex "
+              << mutex_stream_2 << " msg/s\n";
+    std::cout << std::setprecision(3);
+    std::cout << "  Ping-pong:      ring " << ring_ping << " us, mutex "
+              << mutex_ping << " us per handoff\n";
+    std::cout << "  (compare with Avg Throughput of Throughput_Sustained_10s;"
+                 " each sync call costs one inbound handoff)\n";
+
+    EXPECT_GT(ring_stream_1, 0.0);
+    EXPECT_GT(ring_ping, 0.0);
+}
@@ -2,16 +2,21 @@
 #include <boost/asio/awaitable.hpp>
 #include <boost/asio/use_future.hpp>
 #include <chrono>
+#include <cstring>
 #include <das/Core/IPC/AfUnixAvailable.h>
+#include <das/Core/IPC/DasVariantVectorByValueProxy.h>
 #include <das/Core/IPC/DistributedObjectManager.h>
 #include <das/Core/IPC/IHostConnection.h>
 #include <das/Core/IPC/IMessageHandler.h>
+#include <das/Core/IPC/IpcCommandHandler.h>
+#include <das/Core/IPC/IpcBatchMessage.h>
 #include <das/Core/IPC/IpcMessageHeader.h>
 #include <das/Core/IPC/IpcMessageHeaderBuilder.h>
 #include <das/Core/IPC/IpcResponseSender.h>
 #include <das/Core/IPC/IpcRunLoop.h>
 #include <das/Core/IPC/IpcTransport.h>
 #include <das/Core/IPC/ProxyFactory.h>
+#include <das/Core/IPC/QueryInterfaceSet.h>
 #include <das/Core/IPC/RemoteObjectRegistry.h>
 #include <das/IDasAsyncCallback.h>
 #include <das/Utils/fmt.h>
@@ -460,7 +465,7 @@ public:
 
     DasResult HandleMessage(
         const ValidatedIPCMessageHeader& header,
-        const std::vector<uint8_t>&      body,
+        const IpcMessageBody&            body,
         IpcResponseSender&               sender,
         DAS::Core::IPC::StubContext&     ctx) override
     {
@@ -605,10 +610,337 @@ TEST_F(IpcRunLoopTest, BusinessResponseWithoutPendingCallbackFallsBackToQueue)
         EXPECT_EQ(queued->header.GetSourceSessionId(), REMOTE_SESSION_ID);
         EXPECT_EQ(queued->header.GetTargetSessionId(), LOCAL_SESSION_ID);
         EXPECT_EQ(queued->header.GetCallId(), call_id);
-        EXPECT_EQ(queued->body, body);
+        EXPECT_EQ(queued->body.ToVector(), body);
     }
 }
 
+TEST_F(IpcRunLoopTest, SendBatchAsyncRoundTripsInSingleFrame)
+{
+    auto transport_pair = CreateConnectedTransportPair("batch_round_trip");
+    ASSERT_TRUE(transport_pair.has_value());
+
+    DAS::DasPtr<IHostConnection> host(new TestInternalHost(
+        runloop_->GetIoContext(),
+        REMOTE_SESSION_ID,
+        transport_pair->run_loop_side));
+    ASSERT_EQ(runloop_->RegisterInternalHost(host), DAS_S_OK);
+
+    std::thread run_thread;
+    StartRunLoop(run_thread);
+
+    const std::vector<std::vector<uint8_t>> request_bodies{{1}, {2, 3}, {}};
+    std::vector<DAS::Core::IPC::IpcBatchRequest> requests;
+    for (const auto& body : request_bodies)
+    {
+        requests.push_back(DAS::Core::IPC::IpcBatchRequest{
+            .header = IPCMessageHeaderBuilder()
+                          .SetMessageType(MessageType::REQUEST)
+                          .SetInterfaceId(0x1234)
+                          .SetCallId(runloop_->AllocateCallId())
+                          .SetSourceSessionId(LOCAL_SESSION_ID)
+                          .SetTargetSessionId(REMOTE_SESSION_ID)
+                          .SetBodySize(static_cast<uint32_t>(body.size()))
+                          .Build(),
+            .body = body,
+            .on_complete = nullptr});
+    }
+
+    std::optional<std::tuple<std::vector<DAS::Core::IPC::IpcCallResult>>>
+                result;
+    std::thread waiter(
+        [&result,
+         sender = runloop_->SendBatchAsync(
+             requests,
+             std::chrono::seconds(5))]() mutable
+        { result = stdexec::sync_wait(std::move(sender)); });
+
+    // 对端只收到一个批量帧
+    auto receive_future = boost::asio::co_spawn(
+        runloop_->GetIoContext(),
+        transport_pair->peer_side.ReceiveCoroutine(),
+        boost::asio::use_future);
+    auto received = receive_future.get();
+    ASSERT_TRUE(
+        std::holds_alternative<DAS::Core::IPC::AsyncIpcMessage>(received));
+    auto& [batch_header, batch_body] =
+        std::get<DAS::Core::IPC::AsyncIpcMessage>(received);
+    EXPECT_TRUE(DAS::Core::IPC::IsBatchMessage(batch_header));
+    EXPECT_EQ(batch_header.GetMessageType(), MessageType::REQUEST);
+
+    std::vector<InboundMessage> inner_requests;
+    ASSERT_EQ(
+        DAS::Core::IPC::DecodeIpcBatch(std::move(batch_body), inner_requests),
+        DAS_S_OK);
+    ASSERT_EQ(inner_requests.size(), requests.size());
+
+    // 以一个批量 RESPONSE 帧逐条回应，第二条返回错误
+    DAS::Core::IPC::IpcBatchWriter writer;
+    for (size_t i = 0; i < inner_requests.size(); ++i)
+    {
+        EXPECT_EQ(
+            inner_requests[i].header.GetCallId(),
+            requests[i].header.GetCallId());
+        EXPECT_EQ(inner_requests[i].body.ToVector(), request_bodies[i]);
+
+        auto builder = IPCMessageHeaderBuilder()
+                           .SetMessageType(MessageType::RESPONSE)
+                           .SetInterfaceId(0x1234)
+                           .SetCallId(inner_requests[i].header.GetCallId())
+                           .SetSourceSessionId(REMOTE_SESSION_ID)
+                           .SetTargetSessionId(LOCAL_SESSION_ID);
+        if (i == 1)
+        {
+            builder.SetErrorCode(DAS_E_IPC_OBJECT_NOT_FOUND);
+        }
+        const std::vector<uint8_t> response_body(i + 1, static_cast<uint8_t>(i));
+        writer.Append(
+            builder.Build(),
+            response_body.data(),
+            response_body.size());
+    }
+
+    const auto envelope = writer.TakeBuffer();
+    auto       response_header =
+        IPCMessageHeaderBuilder()
+            .SetMessageType(MessageType::RESPONSE)
+            .SetCallId(batch_header.GetCallId())
+            .SetSourceSessionId(REMOTE_SESSION_ID)
+            .SetTargetSessionId(LOCAL_SESSION_ID)
+            .SetFlags(DAS::Core::IPC::MessageFlags::BATCH)
+            .SetBodySize(static_cast<uint32_t>(envelope.size()))
+            .Build();
+    auto send_future = boost::asio::co_spawn(
+        runloop_->GetIoContext(),
+        transport_pair->peer_side
+            .SendCoroutine(response_header, envelope.data(), envelope.size()),
+        boost::asio::use_future);
+    EXPECT_EQ(send_future.get(), DAS_S_OK);
+
+    waiter.join();
+    StopRunLoop(run_thread);
+
+    ASSERT_TRUE(result.has_value());
+    const auto& results = std::get<0>(*result);
+    ASSERT_EQ(results.size(), requests.size());
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& [call_result, response, flags] = results[i];
+        EXPECT_EQ(call_result, i == 1 ? DAS_E_IPC_OBJECT_NOT_FOUND : DAS_S_OK);
+        EXPECT_EQ(response, std::vector<uint8_t>(i + 1, static_cast<uint8_t>(i)));
+        EXPECT_EQ(flags, 0);
+    }
+    EXPECT_FALSE(inbound_queue_->TryPop().has_value());
+}
+
+TEST_F(IpcRunLoopTest, MalformedBatchResponseFailsDecodableCallsImmediately)
+{
+    auto transport_pair = CreateConnectedTransportPair("batch_truncated");
+    ASSERT_TRUE(transport_pair.has_value());
+
+    DAS::DasPtr<IHostConnection> host(new TestInternalHost(
+        runloop_->GetIoContext(),
+        REMOTE_SESSION_ID,
+        transport_pair->run_loop_side));
+    ASSERT_EQ(runloop_->RegisterInternalHost(host), DAS_S_OK);
+
+    std::thread run_thread;
+    StartRunLoop(run_thread);
+
+    std::vector<DAS::Core::IPC::IpcBatchRequest> requests;
+    for (int i = 0; i < 3; ++i)
+    {
+        requests.push_back(DAS::Core::IPC::IpcBatchRequest{
+            .header = IPCMessageHeaderBuilder()
+                          .SetMessageType(MessageType::REQUEST)
+                          .SetInterfaceId(0x1234)
+                          .SetCallId(runloop_->AllocateCallId())
+                          .SetSourceSessionId(LOCAL_SESSION_ID)
+                          .SetTargetSessionId(REMOTE_SESSION_ID)
+                          .Build(),
+            .body = {},
+            .on_complete = nullptr});
+    }
+
+    // 超时远大于断言的完成时间，确认失败不是靠超时触发
+    const auto start = std::chrono::steady_clock::now();
+    std::optional<std::tuple<std::vector<DAS::Core::IPC::IpcCallResult>>>
+                result;
+    std::thread waiter(
+        [&result,
+         sender = runloop_->SendBatchAsync(
+             requests,
+             std::chrono::seconds(30))]() mutable
+        { result = stdexec::sync_wait(std::move(sender)); });
+
+    auto receive_future = boost::asio::co_spawn(
+        runloop_->GetIoContext(),
+        transport_pair->peer_side.ReceiveCoroutine(),
+        boost::asio::use_future);
+    auto received = receive_future.get();
+    ASSERT_TRUE(
+        std::holds_alternative<DAS::Core::IPC::AsyncIpcMessage>(received));
+    auto& [batch_header, batch_body] =
+        std::get<DAS::Core::IPC::AsyncIpcMessage>(received);
+
+    std::vector<InboundMessage> inner_requests;
+    ASSERT_EQ(
+        DAS::Core::IPC::DecodeIpcBatch(std::move(batch_body), inner_requests),
+        DAS_S_OK);
+
+    DAS::Core::IPC::IpcBatchWriter writer;
+    for (const auto& request : inner_requests)
+    {
+        const std::vector<uint8_t> response_body{7, 7, 7};
+        writer.Append(
+            IPCMessageHeaderBuilder()
+                .SetMessageType(MessageType::RESPONSE)
+                .SetInterfaceId(0x1234)
+                .SetCallId(request.header.GetCallId())
+                .SetSourceSessionId(REMOTE_SESSION_ID)
+                .SetTargetSessionId(LOCAL_SESSION_ID)
+                .Build(),
+            response_body.data(),
+            response_body.size());
+    }
+
+    // 截断最后一条的 body：三条消息头都完整，信封整体无效
+    auto envelope = writer.TakeBuffer();
+    envelope.pop_back();
+    auto response_header =
+        IPCMessageHeaderBuilder()
+            .SetMessageType(MessageType::RESPONSE)
+            .SetCallId(batch_header.GetCallId())
+            .SetSourceSessionId(REMOTE_SESSION_ID)
+            .SetTargetSessionId(LOCAL_SESSION_ID)
+            .SetFlags(DAS::Core::IPC::MessageFlags::BATCH)
+            .SetBodySize(static_cast<uint32_t>(envelope.size()))
+            .Build();
+    auto send_future = boost::asio::co_spawn(
+        runloop_->GetIoContext(),
+        transport_pair->peer_side
+            .SendCoroutine(response_header, envelope.data(), envelope.size()),
+        boost::asio::use_future);
+    EXPECT_EQ(send_future.get(), DAS_S_OK);
+
+    waiter.join();
+    StopRunLoop(run_thread);
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    ASSERT_TRUE(result.has_value());
+    const auto& results = std::get<0>(*result);
+    ASSERT_EQ(results.size(), requests.size());
+    for (const auto& [call_result, response, flags] : results)
+    {
+        EXPECT_EQ(call_result, DAS_E_IPC_SERIALIZATION_FAILED);
+        EXPECT_TRUE(response.empty());
+    }
+}
+
+TEST_F(IpcRunLoopTest, LocalQueryInterfaceAddRefFollowsPendingReleases)
+{
+    using DAS::Core::IPC::DasVariantVectorByValueProxy;
+    using DAS::Core::IPC::IpcCommandType;
+    using DAS::Core::IPC::ObjectId;
+
+    auto transport_pair = CreateConnectedTransportPair("add_ref_order");
+    ASSERT_TRUE(transport_pair.has_value());
+
+    DAS::DasPtr<IHostConnection> host(new TestInternalHost(
+        runloop_->GetIoContext(),
+        REMOTE_SESSION_ID,
+        transport_pair->run_loop_side));
+    ASSERT_EQ(runloop_->RegisterInternalHost(host), DAS_S_OK);
+
+    const std::weak_ptr<DAS::Core::IPC::BusinessThread> business_thread;
+    const auto make_proxy = [&](uint32_t local_id)
+    {
+        return proxy_factory_
+            .GetOrCreateProxy(
+                *runloop_,
+                business_thread,
+                ObjectId{
+                    .session_id = REMOTE_SESSION_ID,
+                    .generation = 1,
+                    .local_id = local_id},
+                DasVariantVectorByValueProxy::InterfaceId)
+            .second;
+    };
+
+    // IO 线程尚未运行：两次释放停留在合并队列中
+    const ObjectId released_ids[] = {
+        {.session_id = REMOTE_SESSION_ID, .generation = 1, .local_id = 1},
+        {.session_id = REMOTE_SESSION_ID, .generation = 1, .local_id = 2}};
+    for (const auto& id : released_ids)
+    {
+        auto released = make_proxy(id.local_id);
+        ASSERT_TRUE(released);
+    }
+
+    // 接口集合声明同一对象实现 IDasReadOnlyString，QI 在本地新建 Proxy
+    const ObjectId live_id{
+        .session_id = REMOTE_SESSION_ID,
+        .generation = 1,
+        .local_id = 3};
+    auto live = make_proxy(live_id.local_id);
+    ASSERT_TRUE(live);
+    proxy_factory_.StoreQueryInterfaceSet(
+        live_id,
+        {DAS::Core::IPC::QueryInterfaceSetEntry{
+            .iid = DAS_IID_READ_ONLY_STRING,
+            .same_object = 1}});
+    DAS::DasPtr<IDasReadOnlyString> string_proxy;
+    ASSERT_EQ(
+        live->QueryInterface(
+            DAS_IID_READ_ONLY_STRING,
+            reinterpret_cast<void**>(string_proxy.Put())),
+        DAS_S_OK);
+
+    std::thread run_thread;
+    StartRunLoop(run_thread);
+
+    const auto receive = [&]()
+    {
+        return boost::asio::co_spawn(
+                   runloop_->GetIoContext(),
+                   transport_pair->peer_side.ReceiveCoroutine(),
+                   boost::asio::use_future)
+            .get();
+    };
+
+    // 对端先看到合并的释放，再看到 ADD_REF
+    auto first = receive();
+    ASSERT_TRUE(
+        std::holds_alternative<DAS::Core::IPC::AsyncIpcMessage>(first));
+    const auto& [release_header, release_body] =
+        std::get<DAS::Core::IPC::AsyncIpcMessage>(first);
+    EXPECT_EQ(
+        release_header.GetInterfaceId(),
+        static_cast<uint32_t>(IpcCommandType::REMOTE_RELEASE_BATCH));
+    ASSERT_EQ(
+        release_body.size(),
+        sizeof(uint32_t) + 2 * sizeof(ObjectId));
+    uint32_t release_count = 0;
+    std::memcpy(&release_count, release_body.data(), sizeof(release_count));
+    EXPECT_EQ(release_count, 2u);
+
+    auto second = receive();
+    ASSERT_TRUE(
+        std::holds_alternative<DAS::Core::IPC::AsyncIpcMessage>(second));
+    const auto& [add_ref_header, add_ref_body] =
+        std::get<DAS::Core::IPC::AsyncIpcMessage>(second);
+    EXPECT_EQ(
+        add_ref_header.GetInterfaceId(),
+        static_cast<uint32_t>(IpcCommandType::REMOTE_ADD_REF));
+    ASSERT_EQ(add_ref_body.size(), sizeof(ObjectId));
+    ObjectId add_ref_id{};
+    std::memcpy(&add_ref_id, add_ref_body.data(), sizeof(ObjectId));
+    EXPECT_EQ(add_ref_id, live_id);
+
+    string_proxy = nullptr;
+    live = nullptr;
+    StopRunLoop(run_thread);
+}
+
 // ====== Concurrency Tests ======
 
 TEST_F(IpcRunLoopTest, Stop_FromDifferentThread)
@@ -1,9 +1,13 @@
+#include <atomic>
 #include <chrono>
+#include <cstring>
+#include <das/Core/IPC/IpcMessageBody.h>
 #include <das/Core/IPC/SharedMemoryPool.h>
 #include <das/Utils/fmt.h>
 #include <gtest/gtest.h>
 #include <thread>
 #include <vector>
+using DAS::Core::IPC::IpcMessageBody;
 using DAS::Core::IPC::PoolMode;
 using DAS::Core::IPC::SharedMemoryBlock;
 using DAS::Core::IPC::SharedMemoryManager;
@@ -150,6 +154,131 @@ TEST_F(IpcSharedMemoryPoolTest, Deallocate_ReducesUsedSize)
     EXPECT_LT(used_after_dealloc, used_after_alloc);
 }
 
+TEST_F(IpcSharedMemoryPoolTest, Deallocate_TwiceFails)
+{
+    SharedMemoryBlock block;
+    ASSERT_EQ(pool_->Allocate(1024, block), DAS_S_OK);
+    ASSERT_EQ(pool_->Deallocate(block.handle), DAS_S_OK);
+
+    EXPECT_NE(pool_->Deallocate(block.handle), DAS_S_OK);
+}
+
+// ====== Size-class Recycling Tests ======
+
+TEST_F(IpcSharedMemoryPoolTest, Allocate_RecyclesBlockOfSameSizeClass)
+{
+    SharedMemoryBlock first;
+    ASSERT_EQ(pool_->Allocate(1000, first), DAS_S_OK);
+    const uint64_t handle = first.handle;
+    ASSERT_EQ(pool_->Deallocate(handle), DAS_S_OK);
+
+    // 1000 与 1024 落在同一尺寸档，应直接复用空闲块
+    SharedMemoryBlock second;
+    ASSERT_EQ(pool_->Allocate(1024, second), DAS_S_OK);
+    EXPECT_EQ(second.handle, handle);
+    EXPECT_EQ(second.size, 1024);
+}
+
+TEST_F(IpcSharedMemoryPoolTest, Allocate_ReclaimsFreeBlocksAcrossSizeClasses)
+{
+    // 用一个档位占满池，全部释放后另一个档位仍应能分配
+    std::vector<SharedMemoryBlock> blocks;
+    SharedMemoryBlock              block;
+    while (pool_->Allocate(2000, block) == DAS_S_OK)
+    {
+        blocks.push_back(block);
+    }
+    ASSERT_FALSE(blocks.empty());
+    for (const auto& b : blocks)
+    {
+        ASSERT_EQ(pool_->Deallocate(b.handle), DAS_S_OK);
+    }
+
+    EXPECT_EQ(pool_->Allocate(8192, block), DAS_S_OK);
+}
+
+TEST_F(IpcSharedMemoryPoolTest, GetBlockByHandle_VisibleThroughOpenedPool)
+{
+    SharedMemoryBlock block;
+    ASSERT_EQ(pool_->Allocate(512, block), DAS_S_OK);
+    std::memset(block.data, 0x3C, block.size);
+
+    // 块元数据位于段内，另一个映射（模拟远端进程）同样可以解析 handle
+    SharedMemoryPool  opened{pool_name_, 0, PoolMode::Open};
+    SharedMemoryBlock remote;
+    ASSERT_EQ(opened.GetBlockByHandle(block.handle, remote), DAS_S_OK);
+    EXPECT_EQ(remote.size, 512u);
+    EXPECT_EQ(static_cast<const uint8_t*>(remote.data)[511], 0x3C);
+
+    ASSERT_EQ(opened.Deallocate(block.handle), DAS_S_OK);
+    EXPECT_EQ(pool_->GetUsedSize(), 0u);
+}
+
+// ====== IpcMessageBody Borrow Tests ======
+
+TEST_F(IpcSharedMemoryPoolTest, BorrowSharedMemory_ReadsInPlace)
+{
+    SharedMemoryBlock block;
+    ASSERT_EQ(pool_->Allocate(256, block), DAS_S_OK);
+    std::memset(block.data, 0x5A, block.size);
+
+    auto body = IpcMessageBody::BorrowSharedMemory(*pool_, block);
+
+    EXPECT_TRUE(body.IsBorrowed());
+    EXPECT_EQ(body.data(), static_cast<const uint8_t*>(block.data));
+    EXPECT_EQ(body.size(), 256u);
+    EXPECT_EQ(body[255], 0x5A);
+}
+
+TEST_F(IpcSharedMemoryPoolTest, BorrowSharedMemory_ReleasesOnLastReference)
+{
+    SharedMemoryBlock block;
+    ASSERT_EQ(pool_->Allocate(1024, block), DAS_S_OK);
+    const size_t used_after_alloc = pool_->GetUsedSize();
+
+    {
+        auto body = IpcMessageBody::BorrowSharedMemory(*pool_, block);
+        auto copy = body;
+        body.Reset();
+
+        // 仍有引用时块不能被回收
+        SharedMemoryBlock probe;
+        EXPECT_EQ(pool_->GetBlockByHandle(block.handle, probe), DAS_S_OK);
+        EXPECT_EQ(pool_->GetUsedSize(), used_after_alloc);
+    }
+
+    EXPECT_LT(pool_->GetUsedSize(), used_after_alloc);
+    SharedMemoryBlock probe;
+    EXPECT_NE(pool_->GetBlockByHandle(block.handle, probe), DAS_S_OK);
+}
+
+TEST_F(IpcSharedMemoryPoolTest, BorrowSharedMemory_TakeVectorCopiesAndReleases)
+{
+    SharedMemoryBlock block;
+    ASSERT_EQ(pool_->Allocate(64, block), DAS_S_OK);
+    std::memset(block.data, 0x11, block.size);
+
+    auto body = IpcMessageBody::BorrowSharedMemory(*pool_, block);
+    auto bytes = std::move(body).TakeVector();
+
+    EXPECT_EQ(bytes, std::vector<uint8_t>(64, 0x11));
+    SharedMemoryBlock probe;
+    EXPECT_NE(pool_->GetBlockByHandle(block.handle, probe), DAS_S_OK);
+}
+
+TEST(IpcMessageBodyTest, OwnedBodyTakeVectorMovesStorage)
+{
+    std::vector<uint8_t> bytes{1, 2, 3};
+    const auto*          original_data = bytes.data();
+
+    IpcMessageBody body{std::move(bytes)};
+    EXPECT_FALSE(body.IsBorrowed());
+    EXPECT_EQ(body.size(), 3u);
+
+    auto taken = std::move(body).TakeVector();
+    EXPECT_EQ(taken.data(), original_data);
+}
+
 // ====== GetTotalSize/GetUsedSize Tests ======
 
 TEST_F(IpcSharedMemoryPoolTest, GetTotalSize_ReturnsInitializedSize)
@@ -179,6 +308,57 @@ TEST_F(IpcSharedMemoryPoolTest, CleanupStaleBlocks_Succeeds)
     EXPECT_EQ(result, DAS_S_OK);
 }
 
+TEST_F(IpcSharedMemoryPoolTest, CleanupStaleBlocks_ReclaimsUnleasedBlock)
+{
+    SharedMemoryBlock block;
+    ASSERT_EQ(pool_->Allocate(256, block), DAS_S_OK);
+
+    ASSERT_EQ(pool_->CleanupStaleBlocks(std::chrono::nanoseconds{0}), DAS_S_OK);
+
+    SharedMemoryBlock probe;
+    EXPECT_NE(pool_->GetBlockByHandle(block.handle, probe), DAS_S_OK);
+}
+
+TEST_F(IpcSharedMemoryPoolTest, CleanupStaleBlocks_SkipsBorrowedBlock)
+{
+    SharedMemoryBlock block;
+    ASSERT_EQ(pool_->Allocate(256, block), DAS_S_OK);
+    std::memset(block.data, 0x3C, block.size);
+
+    {
+        auto body = IpcMessageBody::BorrowSharedMemory(*pool_, block);
+        ASSERT_TRUE(body.IsBorrowed());
+
+        ASSERT_EQ(
+            pool_->CleanupStaleBlocks(std::chrono::nanoseconds{0}),
+            DAS_S_OK);
+
+        // 借用期间块不能被回收，更不能被新的分配复用
+        SharedMemoryBlock probe;
+        EXPECT_EQ(pool_->GetBlockByHandle(block.handle, probe), DAS_S_OK);
+        SharedMemoryBlock other;
+        ASSERT_EQ(pool_->Allocate(256, other), DAS_S_OK);
+        EXPECT_NE(other.handle, block.handle);
+        EXPECT_EQ(body[0], 0x3C);
+        ASSERT_EQ(pool_->Deallocate(other.handle), DAS_S_OK);
+    }
+
+    // 最后一个引用释放时由 lease 归还
+    SharedMemoryBlock probe;
+    EXPECT_NE(pool_->GetBlockByHandle(block.handle, probe), DAS_S_OK);
+}
+
+TEST_F(IpcSharedMemoryPoolTest, BorrowSharedMemory_FailsAfterCleanup)
+{
+    SharedMemoryBlock block;
+    ASSERT_EQ(pool_->Allocate(256, block), DAS_S_OK);
+    ASSERT_EQ(pool_->CleanupStaleBlocks(std::chrono::nanoseconds{0}), DAS_S_OK);
+
+    // 已回收的块不能再被借用，否则 lease 释放时会归还别人的块
+    auto body = IpcMessageBody::BorrowSharedMemory(*pool_, block);
+    EXPECT_FALSE(body.IsBorrowed());
+}
+
 // ====== SharedMemoryManager Tests ======
 
 class IpcSharedMemoryManagerTest : public ::testing::Test
@@ -296,3 +476,42 @@ TEST_F(IpcSharedMemoryPoolTest, Allocate_MultiThreaded)
     // At least some allocations should succeed
     EXPECT_GT(total_allocs, 0);
 }
+
+TEST_F(IpcSharedMemoryPoolTest, AllocateDeallocate_ConcurrentChurn)
+{
+    const int                num_threads = 4;
+    const int                iterations = 2000;
+    std::atomic<int>         failures{0};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back(
+            [&, t]()
+            {
+                for (int i = 0; i < iterations; ++i)
+                {
+                    SharedMemoryBlock block;
+                    const size_t      size = 64 + ((t + i) % 8) * 256;
+                    if (pool_->Allocate(size, block) != DAS_S_OK)
+                    {
+                        continue;
+                    }
+                    static_cast<uint8_t*>(block.data)[size - 1] =
+                        static_cast<uint8_t>(i);
+                    if (pool_->Deallocate(block.handle) != DAS_S_OK)
+                    {
+                        ++failures;
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_EQ(pool_->GetUsedSize(), 0u);
+}
@@ -12,6 +12,7 @@
 #include <das/Core/IPC/DasVariantVectorByValueProxy.h>
 #include <das/Core/IPC/IpcRunLoop.h>
 #include <das/Core/IPC/IpcRuntimeState.h>
+#include <das/Core/IPC/MethodMetadata.h>
 #include <das/Core/IPC/ObjectId.h>
 #include <das/Core/IPC/ProxyFactory.h>
 #include <das/Core/IPC/RemoteObjectRegistry.h>
@@ -22,6 +23,7 @@
 
 using DAS::DasPtr;
 using DAS::Core::IPC::BusinessThread;
+using DAS::Core::IPC::ComputeInterfaceId;
 using DAS::Core::IPC::DasReadOnlyStringProxy;
 using DAS::Core::IPC::DasVariantVectorByValueProxy;
 using DAS::Core::IPC::DecodeObjectId;
@@ -32,6 +34,7 @@ using DAS::Core::IPC::IpcRunLoop;
 using DAS::Core::IPC::IpcRuntimeState;
 using DAS::Core::IPC::ObjectId;
 using DAS::Core::IPC::ProxyFactory;
+using DAS::Core::IPC::QueryInterfaceSetEntry;
 using DAS::Core::IPC::RemoteObjectRegistry;
 
 // Test ObjectId 编码解码后的状态一致性
@@ -279,3 +282,127 @@ TEST_F(ProxyRefcountTest, ProxyMethodAfterBeginShutdownReturnsDisconnected)
     EXPECT_EQ(string_proxy->Release(), 1u);
     base.Reset();
 }
+
+TEST_F(ProxyRefcountTest, QueryInterfaceCacheUsesPublishedInterfaceSet)
+{
+    using Kind = ProxyFactory::QueryInterfaceCacheResult::Kind;
+
+    auto [r5, proxy] = proxy_factory_.GetOrCreateProxy(
+        *run_loop_,
+        business_thread_,
+        object_id_,
+        DasReadOnlyStringProxy::InterfaceId);
+    ASSERT_EQ(r5, DAS_S_OK);
+    ASSERT_TRUE(proxy);
+
+    const DasGuid tear_off_iid{
+        0x6B1F0A12,
+        0x2C3D,
+        0x4E5F,
+        {0x81, 0x92, 0xA3, 0xB4, 0xC5, 0xD6, 0xE7, 0xF8}};
+    const DasGuid unknown_iid{
+        0x6B1F0A13,
+        0x2C3D,
+        0x4E5F,
+        {0x81, 0x92, 0xA3, 0xB4, 0xC5, 0xD6, 0xE7, 0xF8}};
+
+    auto before = proxy_factory_.LookupQueryInterface(object_id_, unknown_iid);
+    EXPECT_EQ(before.kind, Kind::Miss);
+    EXPECT_FALSE(before.has_interface_set);
+
+    proxy_factory_.StoreQueryInterfaceSet(
+        object_id_,
+        {QueryInterfaceSetEntry{.iid = DAS_IID_READ_ONLY_STRING,
+                                .same_object = 1},
+         QueryInterfaceSetEntry{.iid = tear_off_iid, .same_object = 0}});
+
+    auto same = proxy_factory_.LookupQueryInterface(
+        object_id_,
+        DAS_IID_READ_ONLY_STRING);
+    EXPECT_EQ(same.kind, Kind::Supported);
+    EXPECT_EQ(same.object_id, object_id_);
+    EXPECT_EQ(
+        same.interface_id,
+        ComputeInterfaceId(DAS_IID_READ_ONLY_STRING));
+
+    // 指针不同的接口需要对端分配 ObjectId，仍走远程
+    auto tear_off =
+        proxy_factory_.LookupQueryInterface(object_id_, tear_off_iid);
+    EXPECT_EQ(tear_off.kind, Kind::Miss);
+    EXPECT_TRUE(tear_off.has_interface_set);
+
+    auto unknown =
+        proxy_factory_.LookupQueryInterface(object_id_, unknown_iid);
+    EXPECT_EQ(unknown.kind, Kind::Unsupported);
+    EXPECT_EQ(unknown.unsupported_result, DAS_E_NO_INTERFACE);
+
+    // 释放最后一个 Proxy 后缓存失效
+    proxy.Reset();
+    EXPECT_EQ(
+        proxy_factory_.LookupQueryInterface(object_id_, unknown_iid).kind,
+        Kind::Miss);
+}
+
+TEST_F(ProxyRefcountTest, QueryInterfaceCacheStoresOnlyDefinitiveResults)
+{
+    using Kind = ProxyFactory::QueryInterfaceCacheResult::Kind;
+
+    const ObjectId result_id{.session_id = 7, .generation = 1, .local_id = 43};
+
+    // 没有存活 Proxy 的 ObjectId 不缓存
+    proxy_factory_.StoreQueryInterfaceResult(
+        object_id_,
+        DAS_IID_READ_ONLY_STRING,
+        DAS_S_OK,
+        result_id,
+        DasReadOnlyStringProxy::InterfaceId);
+    EXPECT_EQ(
+        proxy_factory_
+            .LookupQueryInterface(object_id_, DAS_IID_READ_ONLY_STRING)
+            .kind,
+        Kind::Miss);
+
+    auto [r6, proxy] = proxy_factory_.GetOrCreateProxy(
+        *run_loop_,
+        business_thread_,
+        object_id_,
+        DasReadOnlyStringProxy::InterfaceId);
+    ASSERT_EQ(r6, DAS_S_OK);
+    ASSERT_TRUE(proxy);
+
+    proxy_factory_.StoreQueryInterfaceResult(
+        object_id_,
+        DAS_IID_READ_ONLY_STRING,
+        DAS_S_OK,
+        result_id,
+        DasReadOnlyStringProxy::InterfaceId);
+    auto supported = proxy_factory_.LookupQueryInterface(
+        object_id_,
+        DAS_IID_READ_ONLY_STRING);
+    EXPECT_EQ(supported.kind, Kind::Supported);
+    EXPECT_EQ(supported.object_id, result_id);
+    EXPECT_EQ(supported.interface_id, DasReadOnlyStringProxy::InterfaceId);
+
+    // 暂时性错误不缓存，DAS_E_NO_INTERFACE 缓存为负结果
+    proxy_factory_.StoreQueryInterfaceResult(
+        object_id_,
+        DasIidOf<IDasBase>(),
+        DAS_E_IPC_TIMEOUT,
+        ObjectId{},
+        0);
+    EXPECT_EQ(
+        proxy_factory_.LookupQueryInterface(object_id_, DasIidOf<IDasBase>())
+            .kind,
+        Kind::Miss);
+
+    proxy_factory_.StoreQueryInterfaceResult(
+        object_id_,
+        DasIidOf<IDasBase>(),
+        DAS_E_NO_INTERFACE,
+        ObjectId{},
+        0);
+    EXPECT_EQ(
+        proxy_factory_.LookupQueryInterface(object_id_, DasIidOf<IDasBase>())
+            .kind,
+        Kind::Unsupported);
+}
@@ -0,0 +1,176 @@
+#include <cstdint>
+#include <cstring>
+#include <das/Core/IPC/QueryInterfaceSet.h>
+#include <das/DasPtr.hpp>
+#include <das/IDasBase.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+using DAS::Core::IPC::AppendQueryInterfaceSet;
+using DAS::Core::IPC::GetExportedInterfaceIids;
+using DAS::Core::IPC::QueryInterfaceSetEntry;
+using DAS::Core::IPC::ReadQueryInterfaceSet;
+using DAS::Core::IPC::RegisterExportedInterfaceIid;
+
+namespace
+{
+    const DasGuid kSameObjectIid{
+        0x6B1F0A11,
+        0x2C3D,
+        0x4E5F,
+        {0x81, 0x92, 0xA3, 0xB4, 0xC5, 0xD6, 0xE7, 0xF8}};
+    const DasGuid kTearOffIid{
+        0x6B1F0A12,
+        0x2C3D,
+        0x4E5F,
+        {0x81, 0x92, 0xA3, 0xB4, 0xC5, 0xD6, 0xE7, 0xF8}};
+    const DasGuid kUnsupportedIid{
+        0x6B1F0A13,
+        0x2C3D,
+        0x4E5F,
+        {0x81, 0x92, 0xA3, 0xB4, 0xC5, 0xD6, 0xE7, 0xF8}};
+
+    /// 独立引用计数的附属对象，QueryInterface 返回的指针与主对象不同
+    class TearOffObject : public IDasBase
+    {
+    public:
+        uint32_t DAS_STD_CALL AddRef() override { return ++ref_count_; }
+
+        uint32_t DAS_STD_CALL Release() override
+        {
+            auto c = --ref_count_;
+            if (c == 0)
+            {
+                delete this;
+            }
+            return c;
+        }
+
+        DasResult DAS_STD_CALL QueryInterface(const DasGuid&, void**) override
+        {
+            return DAS_E_NO_INTERFACE;
+        }
+
+    private:
+        uint32_t ref_count_{0};
+    };
+
+    class MultiInterfaceObject : public IDasBase
+    {
+    public:
+        uint32_t DAS_STD_CALL AddRef() override { return ++ref_count_; }
+
+        uint32_t DAS_STD_CALL Release() override { return --ref_count_; }
+
+        DasResult DAS_STD_CALL
+        QueryInterface(const DasGuid& iid, void** pp) override
+        {
+            if (iid == DasIidOf<IDasBase>() || iid == kSameObjectIid)
+            {
+                *pp = static_cast<IDasBase*>(this);
+                AddRef();
+                return DAS_S_OK;
+            }
+            if (iid == kTearOffIid)
+            {
+                auto* tear_off = new TearOffObject();
+                tear_off->AddRef();
+                *pp = static_cast<IDasBase*>(tear_off);
+                return DAS_S_OK;
+            }
+            return DAS_E_NO_INTERFACE;
+        }
+
+        [[nodiscard]]
+        uint32_t RefCount() const
+        {
+            return ref_count_;
+        }
+
+    private:
+        uint32_t ref_count_{1};
+    };
+
+    const QueryInterfaceSetEntry* FindEntry(
+        const std::vector<QueryInterfaceSetEntry>& entries,
+        const DasGuid&                             iid)
+    {
+        for (const auto& entry : entries)
+        {
+            if (entry.iid == iid)
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+} // namespace
+
+TEST(QueryInterfaceSetTest, RegisterExportedIidIgnoresDuplicates)
+{
+    RegisterExportedInterfaceIid(kSameObjectIid);
+    const auto before = GetExportedInterfaceIids().size();
+
+    RegisterExportedInterfaceIid(kSameObjectIid);
+    EXPECT_EQ(GetExportedInterfaceIids().size(), before);
+}
+
+TEST(QueryInterfaceSetTest, AppendedSetRoundTripsWithSameObjectFlag)
+{
+    RegisterExportedInterfaceIid(DasIidOf<IDasBase>());
+    RegisterExportedInterfaceIid(kSameObjectIid);
+    RegisterExportedInterfaceIid(kTearOffIid);
+    RegisterExportedInterfaceIid(kUnsupportedIid);
+
+    MultiInterfaceObject object;
+    // 模拟 QUERY_INTERFACE 响应已有的 result + interface_id + object_id
+    std::vector<uint8_t> body(16, 0xAB);
+    AppendQueryInterfaceSet(&object, body);
+
+    std::vector<QueryInterfaceSetEntry> entries;
+    ASSERT_TRUE(
+        ReadQueryInterfaceSet(body.data() + 16, body.size() - 16, entries));
+
+    const auto* base = FindEntry(entries, DasIidOf<IDasBase>());
+    ASSERT_NE(base, nullptr);
+    EXPECT_EQ(base->same_object, 1u);
+
+    const auto* same = FindEntry(entries, kSameObjectIid);
+    ASSERT_NE(same, nullptr);
+    EXPECT_EQ(same->same_object, 1u);
+
+    const auto* tear_off = FindEntry(entries, kTearOffIid);
+    ASSERT_NE(tear_off, nullptr);
+    EXPECT_EQ(tear_off->same_object, 0u);
+
+    EXPECT_EQ(FindEntry(entries, kUnsupportedIid), nullptr);
+
+    // 探测产生的引用全部释放
+    EXPECT_EQ(object.RefCount(), 1u);
+}
+
+TEST(QueryInterfaceSetTest, ReadRejectsMissingOrTruncatedSet)
+{
+    std::vector<QueryInterfaceSetEntry> entries;
+    EXPECT_FALSE(ReadQueryInterfaceSet(nullptr, 0, entries));
+
+    const uint8_t short_count[2] = {1, 0};
+    EXPECT_FALSE(
+        ReadQueryInterfaceSet(short_count, sizeof(short_count), entries));
+
+    std::vector<uint8_t> truncated(
+        sizeof(uint32_t) + sizeof(QueryInterfaceSetEntry));
+    const uint32_t count = 2;
+    std::memcpy(truncated.data(), &count, sizeof(count));
+    EXPECT_FALSE(
+        ReadQueryInterfaceSet(truncated.data(), truncated.size(), entries));
+}
+
+TEST(QueryInterfaceSetTest, ReadAcceptsEmptySet)
+{
+    const uint8_t empty[4] = {0, 0, 0, 0};
+
+    std::vector<QueryInterfaceSetEntry> entries(3);
+    ASSERT_TRUE(ReadQueryInterfaceSet(empty, sizeof(empty), entries));
+    EXPECT_TRUE(entries.empty());
+}
@@ -0,0 +1,273 @@
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/use_future.hpp>
+#include <das/Core/IPC/IpcMessageHeaderBuilder.h>
+#include <das/Core/IPC/ShmRingIpcTransport.h>
+#include <das/Utils/fmt.h>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+using DAS::Core::IPC::AsyncIpcMessage;
+using DAS::Core::IPC::IPCMessageHeaderBuilder;
+using DAS::Core::IPC::MessageType;
+using DAS::Core::IPC::ShmRingIpcTransport;
+using DAS::Core::IPC::ValidatedIPCMessageHeader;
+
+namespace
+{
+    std::string MakeSegmentName(const char* test_name)
+    {
+        auto now_ns = std::chrono::high_resolution_clock::now()
+                          .time_since_epoch()
+                          .count();
+        return DAS_FMT_NS::format(
+            "das_ring_test_{}_{}_{}",
+            GetCurrentProcessId(),
+            now_ns,
+            test_name);
+    }
+
+    ValidatedIPCMessageHeader MakeHeader(uint16_t call_id, size_t body_size)
+    {
+        return IPCMessageHeaderBuilder()
+            .SetMessageType(MessageType::REQUEST)
+            .SetInterfaceId(0x42)
+            .SetCallId(call_id)
+            .SetSourceSessionId(1)
+            .SetTargetSessionId(2)
+            .SetBodySize(static_cast<uint32_t>(body_size))
+            .Build();
+    }
+
+    /// 在独立线程上运行 io_context，测试线程通过 use_future 等待协程结果
+    class ShmRingIpcTransportTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            work_ = std::make_unique<WorkGuard>(io_.get_executor());
+            thread_ = std::thread([this]() { io_.run(); });
+        }
+
+        void TearDown() override
+        {
+            work_.reset();
+            io_.stop();
+            thread_.join();
+        }
+
+        void CreatePair(
+            const std::string& name,
+            size_t             max_message_size = 65536,
+            size_t ring_capacity = ShmRingIpcTransport::DEFAULT_RING_CAPACITY)
+        {
+            server_ = ShmRingIpcTransport::CreateUninitialized(io_);
+            client_ = ShmRingIpcTransport::CreateUninitialized(io_);
+            ASSERT_EQ(
+                server_->Initialize(
+                    name,
+                    true,
+                    max_message_size,
+                    ring_capacity),
+                DAS_S_OK);
+            ASSERT_EQ(
+                client_->Initialize(
+                    name,
+                    false,
+                    max_message_size,
+                    ring_capacity),
+                DAS_S_OK);
+        }
+
+        DasResult Send(
+            ShmRingIpcTransport&        transport,
+            uint16_t                    call_id,
+            const std::vector<uint8_t>& body)
+        {
+            return boost::asio::co_spawn(
+                       io_,
+                       transport.SendCoroutine(
+                           MakeHeader(call_id, body.size()),
+                           body.data(),
+                           body.size()),
+                       boost::asio::use_future)
+                .get();
+        }
+
+        std::variant<DasResult, AsyncIpcMessage> Receive(
+            ShmRingIpcTransport& transport)
+        {
+            return boost::asio::co_spawn(
+                       io_,
+                       transport.ReceiveCoroutine(),
+                       boost::asio::use_future)
+                .get();
+        }
+
+        using WorkGuard = boost::asio::executor_work_guard<
+            boost::asio::io_context::executor_type>;
+
+        boost::asio::io_context              io_;
+        std::unique_ptr<WorkGuard>           work_;
+        std::thread                          thread_;
+        std::unique_ptr<ShmRingIpcTransport> server_;
+        std::unique_ptr<ShmRingIpcTransport> client_;
+    };
+} // namespace
+
+TEST_F(ShmRingIpcTransportTest, RoundTripBothDirections)
+{
+    CreatePair(MakeSegmentName("RoundTrip"));
+    EXPECT_TRUE(server_->IsConnected());
+    EXPECT_TRUE(client_->IsConnected());
+
+    const std::vector<uint8_t> request{1, 2, 3, 4, 5};
+    ASSERT_EQ(Send(*server_, 7, request), DAS_S_OK);
+
+    auto received = Receive(*client_);
+    ASSERT_EQ(received.index(), 1u);
+    auto& [header, body] = std::get<1>(received);
+    EXPECT_EQ(header.GetCallId(), 7);
+    EXPECT_EQ(header.GetInterfaceId(), 0x42u);
+    EXPECT_EQ(body.ToVector(), request);
+
+    const std::vector<uint8_t> response{9};
+    ASSERT_EQ(Send(*client_, 8, response), DAS_S_OK);
+
+    auto reply = Receive(*server_);
+    ASSERT_EQ(reply.index(), 1u);
+    EXPECT_EQ(std::get<1>(reply).first.GetCallId(), 8);
+    EXPECT_EQ(std::get<1>(reply).second.ToVector(), response);
+}
+
+TEST_F(ShmRingIpcTransportTest, ReceiveWaitsForLaterSend)
+{
+    CreatePair(MakeSegmentName("WaitForSend"));
+
+    auto pending = boost::asio::co_spawn(
+        io_,
+        client_->ReceiveCoroutine(),
+        boost::asio::use_future);
+
+    // 接收方先挂起，门铃唤醒后完成
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_EQ(Send(*server_, 1, {42}), DAS_S_OK);
+
+    auto received = pending.get();
+    ASSERT_EQ(received.index(), 1u);
+    EXPECT_EQ(std::get<1>(received).second.ToVector(), std::vector<uint8_t>{42});
+}
+
+TEST_F(ShmRingIpcTransportTest, WrapsAroundSmallRing)
+{
+    constexpr size_t kMaxMessage = 64 * 1024;
+    constexpr size_t kRingCapacity = 256 * 1024;
+    CreatePair(MakeSegmentName("WrapAround"), kMaxMessage, kRingCapacity);
+
+    // 大小互质的消息体让帧边界落在环尾各处
+    constexpr int kMessages = 200;
+    auto          consumer = boost::asio::co_spawn(
+        io_,
+        [this]() -> boost::asio::awaitable<int>
+        {
+            int ok = 0;
+            for (int i = 0; i < kMessages; ++i)
+            {
+                auto result = co_await client_->ReceiveCoroutine();
+                if (result.index() != 1)
+                {
+                    co_return ok;
+                }
+                const auto body = std::get<1>(result).second.ToVector();
+                const size_t expected_size = 1 + (i * 7919) % 60000;
+                if (body.size() == expected_size
+                    && body.front() == static_cast<uint8_t>(i)
+                    && body.back() == static_cast<uint8_t>(i))
+                {
+                    ++ok;
+                }
+            }
+            co_return ok;
+        },
+        boost::asio::use_future);
+
+    for (int i = 0; i < kMessages; ++i)
+    {
+        std::vector<uint8_t> body(
+            1 + (i * 7919) % 60000,
+            static_cast<uint8_t>(i));
+        ASSERT_EQ(Send(*server_, static_cast<uint16_t>(i + 1), body), DAS_S_OK);
+    }
+
+    EXPECT_EQ(consumer.get(), kMessages);
+}
+
+TEST_F(ShmRingIpcTransportTest, PeerCleanupReportsConnectionLost)
+{
+    CreatePair(MakeSegmentName("PeerCleanup"));
+
+    auto pending = boost::asio::co_spawn(
+        io_,
+        client_->ReceiveCoroutine(),
+        boost::asio::use_future);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    server_->Cleanup();
+
+    auto received = pending.get();
+    ASSERT_EQ(received.index(), 0u);
+    EXPECT_EQ(std::get<0>(received), DAS_E_IPC_CONNECTION_LOST);
+}
+
+TEST_F(ShmRingIpcTransportTest, PendingMessagesDrainBeforeConnectionLost)
+{
+    CreatePair(MakeSegmentName("DrainBeforeLost"));
+
+    ASSERT_EQ(Send(*server_, 1, {1}), DAS_S_OK);
+    server_->Cleanup();
+
+    auto first = Receive(*client_);
+    ASSERT_EQ(first.index(), 1u);
+    EXPECT_EQ(std::get<1>(first).second.ToVector(), std::vector<uint8_t>{1});
+
+    auto second = Receive(*client_);
+    ASSERT_EQ(second.index(), 0u);
+    EXPECT_EQ(std::get<0>(second), DAS_E_IPC_CONNECTION_LOST);
+}
+
+TEST_F(ShmRingIpcTransportTest, RejectsBodyLargerThanMaxMessageSize)
+{
+    CreatePair(MakeSegmentName("TooLarge"), 1024, 64 * 1024);
+
+    const std::vector<uint8_t> body(2048, 0xAB);
+    EXPECT_NE(Send(*server_, 1, body), DAS_S_OK);
+}
+
+TEST_F(ShmRingIpcTransportTest, RejectsInvalidRingCapacity)
+{
+    auto transport = ShmRingIpcTransport::CreateUninitialized(io_);
+
+    // 非 2 的幂
+    EXPECT_EQ(
+        transport->Initialize(MakeSegmentName("BadCapacity"), true, 1024, 3000),
+        DAS_E_IPC_INVALID_ARGUMENT);
+    // 容纳不下两条最大消息
+    EXPECT_EQ(
+        transport
+            ->Initialize(MakeSegmentName("BadCapacity"), true, 65536, 65536),
+        DAS_E_IPC_INVALID_ARGUMENT);
+    EXPECT_FALSE(transport->IsConnected());
+}
+
+TEST_F(ShmRingIpcTransportTest, ClientFailsWithoutServerSegment)
+{
+    auto transport = ShmRingIpcTransport::CreateUninitialized(io_);
+    EXPECT_EQ(
+        transport->Initialize(MakeSegmentName("NoServer"), false),
+        DAS_E_IPC_SHM_FAILED);
+}
@@ -0,0 +1,348 @@
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <das/Core/IPC/MemorySerializer.h>
+#include <das/Core/IPC/ObjectId.h>
+#include <das/Core/IPC/SpanSerializer.h>
+#include <gtest/gtest.h>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using DAS::Core::IPC::EncodeObjectId;
+using DAS::Core::IPC::MemorySerializerReader;
+using DAS::Core::IPC::MemorySerializerWriter;
+using DAS::Core::IPC::ObjectId;
+using DAS::Core::IPC::SpanSerializerReader;
+using DAS::Core::IPC::SpanSerializerWriter;
+
+namespace
+{
+    constexpr uint32_t kPortMapInterfaceId = 0x1234ABCDu;
+    constexpr uint16_t kSetBaseMethodId = 16;
+
+    /// IDasPortMap::SetBase 的输入参数
+    struct SetBaseArgs
+    {
+        std::string port_id;
+        DasGuid     iid;
+        ObjectId    target;
+        ObjectId    object;
+    };
+
+    SetBaseArgs MakeSetBaseArgs()
+    {
+        SetBaseArgs args{};
+        args.port_id = "pipeline.detector.output";
+        args.iid = DasGuid{
+            0xC3D4E5F6,
+            0x1A2B,
+            0x3C4D,
+            {0x5E, 0x6F, 0x7A, 0x8B, 0x9C, 0x0D, 0x1E, 0x2F}};
+        args.target = ObjectId{1, 2, 42};
+        args.object = ObjectId{1, 3, 77};
+        return args;
+    }
+
+    /// 改造前 Proxy 生成的请求体编码：每个字段一次虚 Write
+    std::vector<uint8_t> EncodeSetBaseLegacy(const SetBaseArgs& args)
+    {
+        const size_t port_id_len = args.port_id.size();
+        size_t       total_body_size = 16;
+        total_body_size += 8 + port_id_len;
+        total_body_size += 16;
+        total_body_size += 8;
+
+        MemorySerializerWriter writer;
+        writer.Reserve(total_body_size);
+        writer.WriteUInt32(kPortMapInterfaceId);
+        writer.WriteUInt16(kSetBaseMethodId);
+        writer.WriteUInt16(0);
+        writer.WriteUInt16(args.target.session_id);
+        writer.WriteUInt16(args.target.generation);
+        writer.WriteUInt32(args.target.local_id);
+        writer.WriteString(args.port_id.c_str(), port_id_len);
+        writer.WriteGuid(args.iid);
+        writer.WriteUInt64(EncodeObjectId(args.object));
+        return std::move(writer.GetBuffer());
+    }
+
+    /// 现在 Proxy 生成的请求体编码：定长段整体 memcpy，缓冲区一次分配
+    std::vector<uint8_t> EncodeSetBaseSpan(const SetBaseArgs& args)
+    {
+#pragma pack(push, 1)
+        struct RequestBlock0
+        {
+            uint32_t interface_id;
+            uint16_t method_id;
+            uint16_t reserved;
+            uint16_t session_id;
+            uint16_t generation;
+            uint32_t local_id;
+        };
+        struct RequestBlock1
+        {
+            DasGuid  iid;
+            uint64_t p_in_object_encoded_id;
+        };
+#pragma pack(pop)
+
+        RequestBlock0 block0{};
+        block0.interface_id = kPortMapInterfaceId;
+        block0.method_id = kSetBaseMethodId;
+        block0.reserved = 0;
+        block0.session_id = args.target.session_id;
+        block0.generation = args.target.generation;
+        block0.local_id = args.target.local_id;
+        const char*   p_port_id_u8 = args.port_id.c_str();
+        const size_t  p_port_id_len = std::strlen(p_port_id_u8);
+        RequestBlock1 block1{};
+        block1.iid = args.iid;
+        block1.p_in_object_encoded_id = EncodeObjectId(args.object);
+
+        std::vector<uint8_t> request_body(
+            sizeof(block0) + sizeof(uint64_t) + p_port_id_len + sizeof(block1));
+        SpanSerializerWriter writer{request_body};
+        writer.WritePod(block0);
+        writer.WriteString(p_port_id_u8, p_port_id_len);
+        writer.WritePod(block1);
+        return request_body;
+    }
+
+    struct DecodedSetBase
+    {
+        const char* port_id = nullptr;
+        size_t      port_id_len = 0;
+        DasGuid     iid{};
+        uint64_t    encoded_object = 0;
+    };
+
+    /// 改造前 Stub 生成的参数解码（跳过 16 字节 V3 Body Header）
+    DasResult DecodeSetBaseLegacy(
+        const std::vector<uint8_t>& body,
+        DecodedSetBase&             out)
+    {
+        MemorySerializerReader reader(body.data() + 16, body.size() - 16);
+        auto result = reader.ReadStringView(&out.port_id, &out.port_id_len);
+        if (DAS::IsFailed(result))
+        {
+            return result;
+        }
+        result = reader.ReadGuid(&out.iid);
+        if (DAS::IsFailed(result))
+        {
+            return result;
+        }
+        return reader.ReadUInt64(&out.encoded_object);
+    }
+
+    /// 现在 Stub 生成的参数解码：相邻定长参数一次 ReadPod
+    DasResult DecodeSetBaseSpan(
+        const std::vector<uint8_t>& body,
+        DecodedSetBase&             out)
+    {
+        SpanSerializerReader reader(body.data() + 16, body.size() - 16);
+        auto result = reader.ReadStringView(&out.port_id, &out.port_id_len);
+        if (DAS::IsFailed(result))
+        {
+            return result;
+        }
+#pragma pack(push, 1)
+        struct SetBase_RequestBlock0
+        {
+            DasGuid  iid;
+            uint64_t p_in_object_encoded_value;
+        };
+#pragma pack(pop)
+        SetBase_RequestBlock0 params_block0;
+        result = reader.ReadPod(&params_block0);
+        if (DAS::IsFailed(result))
+        {
+            return result;
+        }
+        out.iid = params_block0.iid;
+        out.encoded_object = params_block0.p_in_object_encoded_value;
+        return DAS_S_OK;
+    }
+
+    /// 返回每次调用的平均纳秒数
+    template <typename F>
+    double MeasureNsPerCall(size_t iterations, F&& f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            f();
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count()
+               / static_cast<double>(iterations);
+    }
+} // namespace
+
+TEST(SpanSerializerTest, WireFormatMatchesMemorySerializer)
+{
+    const std::string text = "port";
+    const DasGuid     guid{1, 2, 3, {4, 5, 6, 7, 8, 9, 10, 11}};
+
+    MemorySerializerWriter expected;
+    expected.WriteInt8(-1);
+    expected.WriteUInt16(0xBEEF);
+    expected.WriteInt32(-123456);
+    expected.WriteUInt64(0x0102030405060708ull);
+    expected.WriteDouble(2.5);
+    expected.WriteBool(true);
+    expected.WriteString(text);
+    expected.WriteGuid(guid);
+
+    std::vector<uint8_t> buffer(expected.Size());
+    SpanSerializerWriter writer{buffer};
+    EXPECT_EQ(writer.WriteInt8(-1), DAS_S_OK);
+    EXPECT_EQ(writer.WriteUInt16(0xBEEF), DAS_S_OK);
+    EXPECT_EQ(writer.WriteInt32(-123456), DAS_S_OK);
+    EXPECT_EQ(writer.WriteUInt64(0x0102030405060708ull), DAS_S_OK);
+    EXPECT_EQ(writer.WriteDouble(2.5), DAS_S_OK);
+    EXPECT_EQ(writer.WriteBool(true), DAS_S_OK);
+    EXPECT_EQ(writer.WriteString(text), DAS_S_OK);
+    EXPECT_EQ(writer.WriteGuid(guid), DAS_S_OK);
+    EXPECT_EQ(writer.GetRemaining(), 0u);
+    EXPECT_EQ(buffer, expected.GetBuffer());
+
+    SpanSerializerReader reader(buffer);
+    int8_t               i8 = 0;
+    uint16_t             u16 = 0;
+    int32_t              i32 = 0;
+    uint64_t             u64 = 0;
+    double               f64 = 0;
+    bool                 flag = false;
+    std::string          read_text;
+    DasGuid              read_guid{};
+    EXPECT_EQ(reader.ReadInt8(&i8), DAS_S_OK);
+    EXPECT_EQ(reader.ReadUInt16(&u16), DAS_S_OK);
+    EXPECT_EQ(reader.ReadInt32(&i32), DAS_S_OK);
+    EXPECT_EQ(reader.ReadUInt64(&u64), DAS_S_OK);
+    EXPECT_EQ(reader.ReadDouble(&f64), DAS_S_OK);
+    EXPECT_EQ(reader.ReadBool(&flag), DAS_S_OK);
+    EXPECT_EQ(reader.ReadString(read_text), DAS_S_OK);
+    EXPECT_EQ(reader.ReadGuid(&read_guid), DAS_S_OK);
+    EXPECT_EQ(i8, -1);
+    EXPECT_EQ(u16, 0xBEEF);
+    EXPECT_EQ(i32, -123456);
+    EXPECT_EQ(u64, 0x0102030405060708ull);
+    EXPECT_EQ(f64, 2.5);
+    EXPECT_TRUE(flag);
+    EXPECT_EQ(read_text, text);
+    EXPECT_EQ(std::memcmp(&read_guid, &guid, sizeof(guid)), 0);
+    EXPECT_EQ(reader.GetRemaining(), 0u);
+}
+
+TEST(SpanSerializerTest, WriterRejectsOverflow)
+{
+    std::vector<uint8_t> buffer(6);
+    SpanSerializerWriter writer{buffer};
+    EXPECT_EQ(writer.WriteUInt32(1), DAS_S_OK);
+    EXPECT_EQ(writer.WriteUInt32(2), DAS_E_IPC_SERIALIZATION_FAILED);
+    EXPECT_EQ(writer.GetPosition(), 4u);
+    EXPECT_EQ(writer.WriteString("x", 1), DAS_E_IPC_SERIALIZATION_FAILED);
+}
+
+TEST(SpanSerializerTest, ReaderRejectsTruncatedInput)
+{
+    MemorySerializerWriter source;
+    source.WriteString(std::string("abcdef"));
+    auto truncated = source.GetBuffer();
+    truncated.resize(truncated.size() - 1);
+
+    SpanSerializerReader reader(truncated);
+    const char*          data = nullptr;
+    size_t               size = 0;
+    EXPECT_EQ(
+        reader.ReadStringView(&data, &size),
+        DAS_E_IPC_DESERIALIZATION_FAILED);
+
+    SpanSerializerReader empty(nullptr, 0);
+    uint32_t             value = 0;
+    EXPECT_EQ(empty.ReadUInt32(&value), DAS_E_IPC_DESERIALIZATION_FAILED);
+}
+
+TEST(SpanSerializerTest, ReadStringViewPointsIntoBuffer)
+{
+    MemorySerializerWriter source;
+    source.WriteString(std::string("hello"));
+    const auto& buffer = source.GetBuffer();
+
+    SpanSerializerReader reader(buffer);
+    const char*          data = nullptr;
+    size_t               size = 0;
+    ASSERT_EQ(reader.ReadStringView(&data, &size), DAS_S_OK);
+    EXPECT_EQ(std::string(data, size), "hello");
+    EXPECT_EQ(
+        reinterpret_cast<const uint8_t*>(data),
+        buffer.data() + sizeof(uint64_t));
+}
+
+TEST(SpanSerializerTest, PortMapSetBaseEncodingIsUnchanged)
+{
+    const auto args = MakeSetBaseArgs();
+    const auto legacy = EncodeSetBaseLegacy(args);
+    const auto span = EncodeSetBaseSpan(args);
+    EXPECT_EQ(span, legacy);
+
+    DecodedSetBase legacy_decoded;
+    DecodedSetBase span_decoded;
+    ASSERT_EQ(DecodeSetBaseLegacy(span, legacy_decoded), DAS_S_OK);
+    ASSERT_EQ(DecodeSetBaseSpan(legacy, span_decoded), DAS_S_OK);
+    EXPECT_EQ(
+        std::string(span_decoded.port_id, span_decoded.port_id_len),
+        args.port_id);
+    EXPECT_EQ(std::memcmp(&span_decoded.iid, &args.iid, sizeof(DasGuid)), 0);
+    EXPECT_EQ(span_decoded.encoded_object, EncodeObjectId(args.object));
+    EXPECT_EQ(span_decoded.encoded_object, legacy_decoded.encoded_object);
+}
+
+// ====== 微基准：生成的 IDasPortMap::SetBase 编解码，改造前后 ======
+
+TEST(SpanSerializerTest, Benchmark_PortMapSetBaseEncodeDecode)
+{
+    constexpr size_t kIterations = 200000;
+    const auto       args = MakeSetBaseArgs();
+    const auto       body = EncodeSetBaseLegacy(args);
+    size_t           sink = 0;
+
+    const double legacy_encode = MeasureNsPerCall(
+        kIterations,
+        [&] { sink += EncodeSetBaseLegacy(args).size(); });
+    const double span_encode = MeasureNsPerCall(
+        kIterations,
+        [&] { sink += EncodeSetBaseSpan(args).size(); });
+
+    DecodedSetBase decoded;
+    const double   legacy_decode = MeasureNsPerCall(
+        kIterations,
+        [&]
+        {
+            DecodeSetBaseLegacy(body, decoded);
+            sink += decoded.encoded_object;
+        });
+    const double span_decode = MeasureNsPerCall(
+        kIterations,
+        [&]
+        {
+            DecodeSetBaseSpan(body, decoded);
+            sink += decoded.encoded_object;
+        });
+
+    std::cout << "\n";
+    std::cout << "  IDasPortMap::SetBase request body (" << body.size()
+              << " bytes)\n";
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "  Proxy encode:   span " << span_encode << " ns, virtual "
+              << legacy_encode << " ns per call\n";
+    std::cout << "  Stub decode:    span " << span_decode << " ns, virtual "
+              << legacy_decode << " ns per call\n";
+
+    EXPECT_NE(sink, 0u);
+    EXPECT_GT(span_encode, 0.0);
+    EXPECT_GT(span_decode, 0.0);
+}
@@ -17,7 +17,7 @@
 #define DAS_CORE_LOG_ERROR(...)                                                \
     SPDLOG_LOGGER_ERROR(DAS::Core::g_logger, __VA_ARGS__)
 #define DAS_CORE_LOG_CRITICAL(...)                                             \
-    SPDLOG_LOGGER_CRITICAL(DAS::Core::g_logger, x)
+    SPDLOG_LOGGER_CRITICAL(DAS::Core::g_logger, __VA_ARGS__)
 
 #define DAS_CORE_LOG_WARN_USING_EXTRA_FUNCTION_NAME(function_name, ...)        \
     DAS::Core::g_logger->log(                                                  \
@@ -30,6 +30,9 @@
         ::spdlog::level::err,                                                  \
         __VA_ARGS__)
 
+// 与 SPDLOG_LOGGER_TRACE 一样受 SPDLOG_ACTIVE_LEVEL 控制，
+// 见 CMake 选项 DAS_LOG_ACTIVE_LEVEL
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
 #define DAS_CORE_TRACE_SCOPE                                                   \
     DAS::Core::TraceScope DAS_TOKEN_PASTE(                                     \
         _das_reserved_logger_tracer_,                                          \
@@ -38,6 +41,9 @@
         static_cast<const char*>(__FILE__), __LINE__,                          \
             static_cast<const char*>(__FUNCTION__)                             \
     }
+#else
+#define DAS_CORE_TRACE_SCOPE (void)0
+#endif
 
 #define DAS_CORE_LOG_EXCEPTION(ex) DAS_CORE_LOG_ERROR(ex.what())
 
@@ -55,6 +61,12 @@ namespace Core
     extern const std::shared_ptr<spdlog::logger> g_logger;
     extern DAS_API const char* const             g_logger_name;
 
+    /**
+     * @brief 写完异步队列中剩余的日志并停止后台线程。
+     * 必须在进程退出或模块卸载前调用，之后的日志会被丢弃。可重复调用。
+     */
+    void ShutdownLogger() noexcept;
+
     class TraceScope
     {
         const char* const file_;
@@ -0,0 +1,142 @@
+#ifndef DAS_CORE_LOGGER_ASYNCLOGGER_H
+#define DAS_CORE_LOGGER_ASYNCLOGGER_H
+
+#include <chrono>
+#include <cstddef>
+#include <das/Core/Logger/CrossProcessMutex.h>
+#include <das/DasConfig.h>
+#include <exception>
+#include <memory>
+#include <spdlog/async.h>
+#include <spdlog/details/log_msg_buffer.h>
+#include <spdlog/details/null_mutex.h>
+#include <spdlog/sinks/base_sink.h>
+#include <vector>
+
+DAS_NS_BEGIN
+namespace Core
+{
+    namespace Logger
+    {
+        namespace Details
+        {
+            // 以下环境变量只在 g_logger 初始化时读取一次
+            // "0" 表示同步写日志，默认异步
+            inline constexpr const char* kLogAsyncEnv = "DAS_LOG_ASYNC";
+            // 队列满时的策略：block（默认）/ overrun_oldest / discard_new
+            inline constexpr const char* kLogOverflowEnv = "DAS_LOG_OVERFLOW";
+            // 异步队列可容纳的日志条数
+            inline constexpr const char* kLogQueueSizeEnv =
+                "DAS_LOG_QUEUE_SIZE";
+            // 后台线程定期刷新 sink 的间隔
+            inline constexpr const char* kLogFlushIntervalEnv =
+                "DAS_LOG_FLUSH_INTERVAL_MS";
+
+            // 异步模式下控制台一次最多攒多少行再取跨进程锁
+            inline constexpr std::size_t kMaxStdoutBatch = 512;
+
+            struct AsyncLoggerOptions
+            {
+                bool                          enabled{true};
+                spdlog::async_overflow_policy overflow_policy{
+                    spdlog::async_overflow_policy::block};
+                std::size_t               queue_size{8192};
+                std::chrono::milliseconds flush_interval{100};
+            };
+
+            // 无法解析的值保留默认设置
+            AsyncLoggerOptions ReadAsyncLoggerOptions();
+
+            /**
+             * @brief 多个进程共用一个控制台时，用跨进程锁保证每行日志不被
+             * 打断。异步模式下本 sink 只在后台线程中被调用，日志先攒在
+             * pending_ 中，每次 flush（或攒满 kMaxStdoutBatch 行）只取一次
+             * 跨进程锁。
+             */
+            class ProcessSafeStdoutSink final
+                : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
+            {
+                using Base =
+                    spdlog::sinks::base_sink<spdlog::details::null_mutex>;
+
+                spdlog::sink_ptr                             inner_sink_;
+                CrossProcessMutex                            process_mutex_;
+                bool                                         batched_;
+                std::vector<spdlog::details::log_msg_buffer> pending_;
+
+                void WritePending(bool flush)
+                {
+                    auto lock = process_mutex_.Acquire();
+                    for (const auto& msg : pending_)
+                    {
+                        inner_sink_->log(msg);
+                    }
+                    pending_.clear();
+                    if (flush)
+                    {
+                        inner_sink_->flush();
+                    }
+                }
+
+            protected:
+                void sink_it_(const spdlog::details::log_msg& msg) override
+                {
+                    if (!batched_)
+                    {
+                        auto lock = process_mutex_.Acquire();
+                        inner_sink_->log(msg);
+                        return;
+                    }
+
+                    pending_.emplace_back(msg);
+                    if (pending_.size() >= kMaxStdoutBatch)
+                    {
+                        WritePending(false);
+                    }
+                }
+
+                void set_formatter_(
+                    std::unique_ptr<spdlog::formatter> sink_formatter) override
+                {
+                    Base::set_formatter_(std::move(sink_formatter));
+                    inner_sink_->set_formatter(Base::formatter_->clone());
+                }
+
+                void flush_() override { WritePending(true); }
+
+            public:
+                /**
+                 * @param inner_sink 实际写控制台的 sink
+                 * @param batched 为 true 时攒批写入，只应在异步模式下使用
+                 */
+                ProcessSafeStdoutSink(spdlog::sink_ptr inner_sink, bool batched)
+                    : inner_sink_{std::move(inner_sink)}, batched_{batched}
+                {
+                    if (batched_)
+                    {
+                        pending_.reserve(kMaxStdoutBatch);
+                    }
+                }
+
+                ~ProcessSafeStdoutSink() override
+                {
+                    if (pending_.empty())
+                    {
+                        return;
+                    }
+                    try
+                    {
+                        WritePending(true);
+                    }
+                    catch (const std::exception&)
+                    {
+                        // 进程退出阶段无法再报告错误
+                    }
+                }
+            };
+        } // namespace Details
+    } // namespace Logger
+} // namespace Core
+DAS_NS_END
+
+#endif // DAS_CORE_LOGGER_ASYNCLOGGER_H
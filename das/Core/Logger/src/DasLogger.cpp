@@ -5,20 +5,45 @@
 #include <das/DasSwigApi.h>
 #include <das/_autogen/idl/abi/DasLogger.h>
 #include <das/_autogen/idl/wrapper/Das.ExportInterface.DasLogger.hpp>
+#include <mutex>
 #include <optional>
 #include <spdlog/common.h>
+#include <string>
+#include <unordered_set>
 
 namespace DC = DAS::Core;
 
 DAS_NS_ANONYMOUS_DETAILS_BEGIN
 
+/**
+ * @brief spdlog::source_loc 只保存指针。异步日志在调用返回后才格式化，
+ * 因此来自插件的文件名与函数名需要复制到进程生命周期内有效的存储中。
+ * 这类字符串数量有限，故不回收；后台线程在进程退出时仍可能读取它们。
+ */
+const char* InternSourceString(const char* p_string)
+{
+    struct InternTable
+    {
+        std::mutex                      mutex;
+        std::unordered_set<std::string> strings;
+    };
+    static auto* const p_table = new InternTable{};
+
+    if (p_string == nullptr)
+    {
+        return nullptr;
+    }
+    std::lock_guard lock{p_table->mutex};
+    return p_table->strings.emplace(p_string).first->c_str();
+}
+
 std::optional<spdlog::source_loc> ToSpdlogSourceLocation(
     const DAS::ExportInterface::DasSourceLocation& location)
 {
     spdlog::source_loc result;
-    result.filename = location.FileName().GetUtf8();
+    result.filename = InternSourceString(location.FileName().GetUtf8());
     result.line = location.Line();
-    result.funcname = location.FunctionName().GetUtf8();
+    result.funcname = InternSourceString(location.FunctionName().GetUtf8());
 
     return result;
 }
@@ -163,3 +188,5 @@ void DasSetLogLevel(int level)
     }
     spdlog::set_level(static_cast<spdlog::level::level_enum>(level));
 }
+
+void DasShutdownLogger() { DC::ShutdownLogger(); }
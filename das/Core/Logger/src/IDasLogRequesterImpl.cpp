@@ -2,6 +2,7 @@
 #include <das/Core/Logger/Logger.h>
 #include <das/DasApi.h>
 #include <das/Utils/CommonUtils.hpp>
+#include <optional>
 
 IDasLogRequesterImpl::IDasLogRequesterImpl(
     uint32_t           max_buffer_size,
@@ -64,17 +65,30 @@ DasResult IDasLogRequesterImpl::QueryInterface(
 DasResult IDasLogRequesterImpl::RequestOne(
     Das::ExportInterface::IDasLogReader* p_reader)
 {
-    std::lock_guard guard{mutex_};
+    // 记录日志会经 Accept 重入本对象，因此不能在持锁时记录日志或回调读者
+    DAS_UTILS_CHECK_POINTER(p_reader);
 
-    if (buffer_.empty())
+    std::optional<Type> message;
     {
-        return DAS_E_OUT_OF_RANGE;
+        std::lock_guard guard{mutex_};
+
+        // 日志线程中无法记录日志，溢出只能在读取端报告
+        if (dropped_count_ != 0)
+        {
+            dropped_count_ = 0;
+            return DAS_E_MAYBE_OVERFLOW;
+        }
+
+        if (buffer_.empty())
+        {
+            return DAS_E_OUT_OF_RANGE;
+        }
+
+        message.emplace(std::move(buffer_.front()));
+        buffer_.pop_front();
     }
 
-    DAS_UTILS_CHECK_POINTER(p_reader);
-    const auto& message = buffer_.front();
-    buffer_.pop_front();
-    const auto result = p_reader->ReadOne(message.Get());
+    const auto result = p_reader->ReadOne(message->Get());
 
     return result;
 }
@@ -82,6 +96,12 @@ DasResult IDasLogRequesterImpl::RequestOne(
 void IDasLogRequesterImpl::Accept(
     const std::shared_ptr<std::string>& sp_message)
 {
+    // 由日志线程调用，与 RequestOne 并发
+    std::lock_guard guard{mutex_};
+    if (buffer_.full())
+    {
+        ++dropped_count_;
+    }
     buffer_.push_back({sp_message->c_str()});
 }
 
@@ -19,6 +19,8 @@ class IDasLogRequesterImpl final : public Das::ExportInterface::IDasLogRequester
     std::mutex                                         mutex_{};
     boost::circular_buffer<Type, std::allocator<Type>> buffer_;
     SpLogRequesterSink                                 sp_log_requester_sink_;
+    // 上次 RequestOne 之后因缓冲区已满被覆盖的日志条数
+    uint64_t dropped_count_{};
 
 public:
     IDasLogRequesterImpl(uint32_t max_buffer_size, SpLogRequesterSink sp_sink);
@@ -28,6 +30,7 @@ public:
     uint32_t  Release() override;
     DasResult QueryInterface(const DasGuid& iid, void** pp_out_object)
         override; // IDasLogRequester
+    // 有日志被覆盖时先返回一次 DAS_E_MAYBE_OVERFLOW，不读取日志
     DasResult RequestOne(
         Das::ExportInterface::IDasLogReader* p_reader) override;
     // IDasLogRequesterImpl
@@ -2,14 +2,18 @@
 // warning C4996: 'getenv': This function or variable may be unsafe. Consider
 // using _dupenv_s instead.
 #define _CRT_SECURE_NO_WARNINGS
+#include "AsyncLogger.h"
 #include "IDasLogRequesterImpl.h"
 #include <array>
-#include <das/Core/Logger/CrossProcessMutex.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <das/Core/Logger/Logger.h>
-#include <spdlog/details/null_mutex.h>
-#include <spdlog/sinks/base_sink.h>
+#include <optional>
+#include <spdlog/async.h>
 #include <spdlog/sinks/rotating_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
+#include <string_view>
 
 #if defined(_WIN32) || defined(__CYGWIN__)
 #include <windows.h>
@@ -60,40 +64,74 @@ DAS_NS_ANONYMOUS_DETAILS_END
 #endif // DAS_WINDOWS
 
 DAS_NS_ANONYMOUS_DETAILS_BEGIN
-class ProcessSafeStdoutSink final
-    : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
+std::optional<unsigned long> ReadUnsignedEnv(const char* name)
 {
-    spdlog::sinks::stdout_color_sink_mt  inner_sink_;
-    DAS::Core::Logger::CrossProcessMutex cross_process_mutex_;
-
-protected:
-    void sink_it_(const spdlog::details::log_msg& msg) override
+    const char* value = std::getenv(name);
+    if (value == nullptr || *value == '\0')
     {
-        auto lock = cross_process_mutex_.Acquire();
-        inner_sink_.log(msg);
+        return std::nullopt;
     }
-
-    void set_formatter_(
-        std::unique_ptr<spdlog::formatter> sink_formatter) override
+    char*      end = nullptr;
+    const auto result = std::strtoul(value, &end, 10);
+    if (*end != '\0')
     {
-        base_sink<spdlog::details::null_mutex>::set_formatter_(
-            std::move(sink_formatter));
-        inner_sink_.set_formatter(
-            base_sink<spdlog::details::null_mutex>::formatter_->clone());
+        return std::nullopt;
     }
+    return result;
+}
 
-    void flush_() override
-    {
-        auto lock = cross_process_mutex_.Acquire();
-        inner_sink_.flush();
-    }
+std::atomic_flag g_logger_shutdown = ATOMIC_FLAG_INIT;
+DAS_NS_ANONYMOUS_DETAILS_END
 
-public:
-    ProcessSafeStdoutSink() = default;
+DAS_NS_BEGIN
 
-    ~ProcessSafeStdoutSink() override = default;
-};
-DAS_NS_ANONYMOUS_DETAILS_END
+namespace Core
+{
+    namespace Logger
+    {
+        namespace Details
+        {
+            AsyncLoggerOptions ReadAsyncLoggerOptions()
+            {
+                AsyncLoggerOptions result{};
+                if (const auto async = ::Details::ReadUnsignedEnv(kLogAsyncEnv))
+                {
+                    result.enabled = *async != 0;
+                }
+                if (const char* overflow = std::getenv(kLogOverflowEnv))
+                {
+                    const std::string_view policy{overflow};
+                    if (policy == "overrun_oldest")
+                    {
+                        result.overflow_policy =
+                            spdlog::async_overflow_policy::overrun_oldest;
+                    }
+                    else if (policy == "discard_new")
+                    {
+                        result.overflow_policy =
+                            spdlog::async_overflow_policy::discard_new;
+                    }
+                }
+                if (const auto queue_size =
+                        ::Details::ReadUnsignedEnv(kLogQueueSizeEnv);
+                    queue_size && *queue_size != 0)
+                {
+                    result.queue_size = *queue_size;
+                }
+                if (const auto interval =
+                        ::Details::ReadUnsignedEnv(kLogFlushIntervalEnv);
+                    interval && *interval != 0)
+                {
+                    result.flush_interval =
+                        std::chrono::milliseconds{*interval};
+                }
+                return result;
+            }
+        } // namespace Details
+    } // namespace Logger
+} // namespace Core
+
+DAS_NS_END
 
 DAS_NS_BEGIN
 
@@ -101,8 +139,12 @@ namespace Core
 {
     const std::shared_ptr<spdlog::logger> g_logger = []()
     {
+        const auto options = Logger::Details::ReadAsyncLoggerOptions();
+
         const auto std_sink =
-            std::make_shared<::Details::ProcessSafeStdoutSink>();
+            std::make_shared<Logger::Details::ProcessSafeStdoutSink>(
+                std::make_shared<spdlog::sinks::stdout_color_sink_mt>(),
+                options.enabled);
         const auto file_sink =
             std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
                 "logs/" DAS_CORE_NAME ".log",
@@ -116,15 +158,36 @@ namespace Core
             std_sink,
             file_sink,
             log_requester_sink};
-        const auto result = std::make_shared<spdlog::logger>(
-            g_logger_name,
-            std::begin(sinks),
-            std::end(sinks));
+        std::shared_ptr<spdlog::logger> result;
+        if (options.enabled)
+        {
+            // 调用线程只负责把日志放入队列，格式化与写入都在后台线程完成
+            spdlog::init_thread_pool(options.queue_size, 1);
+            result = std::make_shared<spdlog::async_logger>(
+                g_logger_name,
+                std::begin(sinks),
+                std::end(sinks),
+                spdlog::thread_pool(),
+                options.overflow_policy);
+        }
+        else
+        {
+            result = std::make_shared<spdlog::logger>(
+                g_logger_name,
+                std::begin(sinks),
+                std::end(sinks));
+        }
         spdlog::register_logger(result);
         spdlog::set_pattern(
             "[%Y-%m-%d %H:%M:%S.%e][%P][%t][%^%l%$][%!()][%s:%#][%i] %v");
 
         spdlog::set_level(spdlog::level::trace);
+        if (options.enabled)
+        {
+            // 错误日志尽快落盘，其余日志按间隔批量刷新
+            result->flush_on(spdlog::level::err);
+            spdlog::flush_every(options.flush_interval);
+        }
 
         DAS_CONFIG_WIN32_CONSOLE;
 
@@ -135,6 +198,30 @@ namespace Core
 
     const char* const g_logger_name = "das_core_g_logger";
 
+    void ShutdownLogger() noexcept
+    {
+        if (::Details::g_logger_shutdown.test_and_set())
+        {
+            return;
+        }
+        try
+        {
+            g_logger->flush();
+            // 停止 flush_every 线程并销毁线程池，线程池析构时会写完队列中
+            // 剩余的日志并等待工作线程退出
+            spdlog::shutdown();
+            if (std::dynamic_pointer_cast<spdlog::async_logger>(g_logger))
+            {
+                // 线程池已不存在，之后的日志直接丢弃
+                g_logger->set_level(spdlog::level::off);
+            }
+        }
+        catch (const std::exception&)
+        {
+            // 进程退出阶段无法再报告错误
+        }
+    }
+
     TraceScope::TraceScope(
         const char* const file,
         int               line,
@@ -0,0 +1,268 @@
+#include "../src/AsyncLogger.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mutex>
+#include <spdlog/async_logger.h>
+#include <spdlog/logger.h>
+#include <string>
+#include <vector>
+
+#ifdef DAS_WINDOWS
+#include <stdlib.h>
+#endif
+
+namespace Das::Core::Logger::Details::Test
+{
+    namespace
+    {
+        void SetEnv(const char* name, const char* value)
+        {
+#ifdef DAS_WINDOWS
+            _putenv_s(name, value);
+#else
+            setenv(name, value, 1);
+#endif
+        }
+
+        void UnsetEnv(const char* name)
+        {
+#ifdef DAS_WINDOWS
+            _putenv_s(name, "");
+#else
+            unsetenv(name);
+#endif
+        }
+
+        // 记录收到的日志；Open() 之前后台线程会阻塞在第一条日志上
+        class RecordingSink final : public spdlog::sinks::base_sink<std::mutex>
+        {
+        public:
+            explicit RecordingSink(bool open = true) : open_{open} {}
+
+            void Open()
+            {
+                {
+                    std::lock_guard lock{gate_mutex_};
+                    open_ = true;
+                }
+                gate_cv_.notify_all();
+            }
+
+            std::vector<std::string> Lines()
+            {
+                std::lock_guard lock{mutex_};
+                return lines_;
+            }
+
+            std::size_t FlushCount()
+            {
+                std::lock_guard lock{mutex_};
+                return flush_count_;
+            }
+
+        protected:
+            void sink_it_(const spdlog::details::log_msg& msg) override
+            {
+                {
+                    std::unique_lock lock{gate_mutex_};
+                    gate_cv_.wait(lock, [this] { return open_; });
+                }
+                lines_.emplace_back(msg.payload.begin(), msg.payload.end());
+            }
+
+            void flush_() override { ++flush_count_; }
+
+        private:
+            std::mutex               gate_mutex_;
+            std::condition_variable  gate_cv_;
+            bool                     open_;
+            std::vector<std::string> lines_;
+            std::size_t              flush_count_{};
+        };
+
+        class AsyncLoggerOptionsTest : public ::testing::Test
+        {
+        protected:
+            void SetUp() override { UnsetAll(); }
+            void TearDown() override { UnsetAll(); }
+
+        private:
+            static void UnsetAll()
+            {
+                UnsetEnv(kLogAsyncEnv);
+                UnsetEnv(kLogOverflowEnv);
+                UnsetEnv(kLogQueueSizeEnv);
+                UnsetEnv(kLogFlushIntervalEnv);
+            }
+        };
+
+        // 用给定策略把 100 行日志写入容量为 4 的队列，后台线程此时被阻塞
+        std::vector<std::string> LogIntoFullQueue(
+            spdlog::async_overflow_policy policy)
+        {
+            const auto sink = std::make_shared<RecordingSink>(false);
+            auto       pool =
+                std::make_shared<spdlog::details::thread_pool>(4, 1);
+            auto logger = std::make_shared<spdlog::async_logger>(
+                "test",
+                sink,
+                pool,
+                policy);
+            for (int i = 0; i < 100; ++i)
+            {
+                logger->info("{}", i);
+            }
+            sink->Open();
+            // 线程池析构时会处理完队列中剩余的日志
+            logger.reset();
+            pool.reset();
+            return sink->Lines();
+        }
+
+        auto MakeStdoutSink(
+            const std::shared_ptr<RecordingSink>& inner,
+            bool                                  batched)
+        {
+            const auto sink =
+                std::make_shared<ProcessSafeStdoutSink>(inner, batched);
+            sink->set_pattern("%v");
+            return sink;
+        }
+    } // namespace
+
+    TEST_F(AsyncLoggerOptionsTest, DefaultsWhenEnvIsUnset)
+    {
+        const auto options = ReadAsyncLoggerOptions();
+
+        EXPECT_TRUE(options.enabled);
+        EXPECT_EQ(
+            options.overflow_policy,
+            spdlog::async_overflow_policy::block);
+        EXPECT_EQ(options.queue_size, 8192u);
+        EXPECT_EQ(options.flush_interval, std::chrono::milliseconds{100});
+    }
+
+    TEST_F(AsyncLoggerOptionsTest, ReadsOverflowPolicyAndQueueSettings)
+    {
+        SetEnv(kLogAsyncEnv, "0");
+        SetEnv(kLogQueueSizeEnv, "16");
+        SetEnv(kLogFlushIntervalEnv, "5");
+
+        SetEnv(kLogOverflowEnv, "discard_new");
+        auto options = ReadAsyncLoggerOptions();
+        EXPECT_FALSE(options.enabled);
+        EXPECT_EQ(
+            options.overflow_policy,
+            spdlog::async_overflow_policy::discard_new);
+        EXPECT_EQ(options.queue_size, 16u);
+        EXPECT_EQ(options.flush_interval, std::chrono::milliseconds{5});
+
+        SetEnv(kLogOverflowEnv, "overrun_oldest");
+        options = ReadAsyncLoggerOptions();
+        EXPECT_EQ(
+            options.overflow_policy,
+            spdlog::async_overflow_policy::overrun_oldest);
+    }
+
+    TEST_F(AsyncLoggerOptionsTest, InvalidValuesKeepDefaults)
+    {
+        SetEnv(kLogOverflowEnv, "drop");
+        SetEnv(kLogQueueSizeEnv, "0");
+        SetEnv(kLogFlushIntervalEnv, "10ms");
+
+        const auto options = ReadAsyncLoggerOptions();
+
+        EXPECT_EQ(
+            options.overflow_policy,
+            spdlog::async_overflow_policy::block);
+        EXPECT_EQ(options.queue_size, 8192u);
+        EXPECT_EQ(options.flush_interval, std::chrono::milliseconds{100});
+    }
+
+    TEST(AsyncLoggerOverflowTest, DiscardNewKeepsOldestLinesWithoutBlocking)
+    {
+        const auto lines =
+            LogIntoFullQueue(spdlog::async_overflow_policy::discard_new);
+
+        ASSERT_FALSE(lines.empty());
+        EXPECT_LT(lines.size(), 100u);
+        EXPECT_EQ(lines.front(), "0");
+        EXPECT_NE(lines.back(), "99");
+    }
+
+    TEST(AsyncLoggerOverflowTest, OverrunOldestKeepsNewestLinesWithoutBlocking)
+    {
+        const auto lines =
+            LogIntoFullQueue(spdlog::async_overflow_policy::overrun_oldest);
+
+        ASSERT_FALSE(lines.empty());
+        EXPECT_LT(lines.size(), 100u);
+        EXPECT_EQ(lines.back(), "99");
+    }
+
+    TEST(ProcessSafeStdoutSinkTest, UnbatchedSinkForwardsEachLine)
+    {
+        const auto     inner = std::make_shared<RecordingSink>();
+        spdlog::logger logger{"test", MakeStdoutSink(inner, false)};
+
+        logger.info("first");
+        logger.info("second");
+
+        EXPECT_EQ(
+            inner->Lines(),
+            (std::vector<std::string>{"first", "second"}));
+        EXPECT_EQ(inner->FlushCount(), 0u);
+    }
+
+    TEST(ProcessSafeStdoutSinkTest, BatchedSinkWritesOnFlush)
+    {
+        const auto     inner = std::make_shared<RecordingSink>();
+        spdlog::logger logger{"test", MakeStdoutSink(inner, true)};
+
+        logger.info("first");
+        logger.info("second");
+        EXPECT_TRUE(inner->Lines().empty());
+
+        logger.flush();
+        EXPECT_EQ(
+            inner->Lines(),
+            (std::vector<std::string>{"first", "second"}));
+        EXPECT_EQ(inner->FlushCount(), 1u);
+    }
+
+    TEST(ProcessSafeStdoutSinkTest, BatchedSinkWritesWhenBatchIsFull)
+    {
+        const auto     inner = std::make_shared<RecordingSink>();
+        spdlog::logger logger{"test", MakeStdoutSink(inner, true)};
+
+        for (std::size_t i = 0; i + 1 < kMaxStdoutBatch; ++i)
+        {
+            logger.info("{}", i);
+        }
+        EXPECT_TRUE(inner->Lines().empty());
+
+        logger.info("last");
+        const auto lines = inner->Lines();
+        ASSERT_EQ(lines.size(), kMaxStdoutBatch);
+        EXPECT_EQ(lines.front(), "0");
+        EXPECT_EQ(lines.back(), "last");
+        EXPECT_EQ(inner->FlushCount(), 0u);
+    }
+
+    TEST(ProcessSafeStdoutSinkTest, BatchedSinkWritesPendingLinesOnDestruction)
+    {
+        const auto inner = std::make_shared<RecordingSink>();
+        {
+            spdlog::logger logger{"test", MakeStdoutSink(inner, true)};
+            logger.info("pending");
+            EXPECT_TRUE(inner->Lines().empty());
+        }
+
+        EXPECT_EQ(inner->Lines(), (std::vector<std::string>{"pending"}));
+        EXPECT_EQ(inner->FlushCount(), 1u);
+    }
+} // namespace Das::Core::Logger::Details::Test
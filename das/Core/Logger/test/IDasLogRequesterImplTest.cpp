@@ -0,0 +1,98 @@
+#include "../src/IDasLogRequesterImpl.h"
+
+#include <das/_autogen/idl/wrapper/Das.ExportInterface.IDasLogReader.Implements.hpp>
+#include <functional>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+    class CollectingLogReader final
+        : public DAS::ExportInterface::DasLogReaderImplBase<CollectingLogReader>
+    {
+    public:
+        DAS_IMPL ReadOne(IDasReadOnlyString* message) override
+        {
+            const char* p_log = nullptr;
+            const auto  result = message->GetUtf8(&p_log);
+            if (DAS::IsOk(result))
+            {
+                lines.emplace_back(p_log);
+            }
+            if (on_read)
+            {
+                on_read();
+            }
+            return result;
+        }
+
+        std::vector<std::string> lines;
+        // 模拟读者在 ReadOne 中记录日志
+        std::function<void()> on_read;
+    };
+
+    class IDasLogRequesterImplTest : public ::testing::Test
+    {
+    protected:
+        void Accept(const char* line)
+        {
+            requester_.Accept(std::make_shared<std::string>(line));
+        }
+
+        std::shared_ptr<DasLogRequesterSink<std::mutex>> sink_ =
+            std::make_shared<DasLogRequesterSink<std::mutex>>();
+        IDasLogRequesterImpl requester_{2, sink_};
+        DAS::DasPtr<CollectingLogReader> reader_ =
+            DAS::MakeDasPtr<CollectingLogReader>();
+    };
+} // namespace
+
+TEST_F(IDasLogRequesterImplTest, ReadsLinesInOrderWhenRingHasRoom)
+{
+    Accept("first");
+    Accept("second");
+
+    EXPECT_EQ(requester_.RequestOne(reader_.Get()), DAS_S_OK);
+    EXPECT_EQ(requester_.RequestOne(reader_.Get()), DAS_S_OK);
+    EXPECT_EQ(requester_.RequestOne(reader_.Get()), DAS_E_OUT_OF_RANGE);
+    EXPECT_EQ(reader_->lines, (std::vector<std::string>{"first", "second"}));
+}
+
+TEST_F(IDasLogRequesterImplTest, OverflowIsReportedBeforeRemainingLines)
+{
+    Accept("first");
+    Accept("second");
+    Accept("third");
+    Accept("fourth");
+
+    // 溢出只报告一次，且不消耗日志
+    EXPECT_EQ(requester_.RequestOne(reader_.Get()), DAS_E_MAYBE_OVERFLOW);
+    EXPECT_TRUE(reader_->lines.empty());
+
+    EXPECT_EQ(requester_.RequestOne(reader_.Get()), DAS_S_OK);
+    EXPECT_EQ(requester_.RequestOne(reader_.Get()), DAS_S_OK);
+    EXPECT_EQ(requester_.RequestOne(reader_.Get()), DAS_E_OUT_OF_RANGE);
+    EXPECT_EQ(reader_->lines, (std::vector<std::string>{"third", "fourth"}));
+
+    // 读空后重新写满但未覆盖，不再报告溢出
+    Accept("fifth");
+    Accept("sixth");
+    EXPECT_EQ(requester_.RequestOne(reader_.Get()), DAS_S_OK);
+    EXPECT_EQ(reader_->lines.back(), "fifth");
+}
+
+TEST_F(IDasLogRequesterImplTest, ReaderMayLogWhileReading)
+{
+    Accept("first");
+    reader_->on_read = [this] { Accept("logged by reader"); };
+
+    EXPECT_EQ(requester_.RequestOne(reader_.Get()), DAS_S_OK);
+    reader_->on_read = nullptr;
+    EXPECT_EQ(requester_.RequestOne(reader_.Get()), DAS_S_OK);
+    EXPECT_EQ(
+        reader_->lines,
+        (std::vector<std::string>{"first", "logged by reader"}));
+}
@@ -2,9 +2,14 @@
 #include "DescriptorMatcherFactory.h"
 #include "FeatureDetectorFactory.h"
 #include "IDasMatchResultImpl.h"
+#include "IDasPreparedTemplateImpl.h"
+#include "IDasPreparedTemplateSetImpl.h"
 #include "IDasTemplateMatchResultImpl.h"
 #include "IDasTemplateMatchResultsImpl.h"
+#include "IDasTemplateSearchConfigImpl.h"
 #include "IMatchConfigImpl.h"
+#include "MultiTemplateMatch.h"
+#include "TemplateSearch.h"
 #include <das/Core/OcvWrapper/Config.h>
 #include <das/Core/OcvWrapper/CpuImageImpl.hpp>
 #include <das/Core/OcvWrapper/IImageBackend.h>
@@ -114,99 +119,6 @@ auto ValidateTemplateMatchInputs(
     return DAS_S_OK;
 }
 
-/// @brief Internal scan candidate for TemplateMatchAll
-struct ScanCandidate
-{
-    float score{};
-    float raw_score{};
-    int   x{};
-    int   y{};
-};
-
-/// @brief Compute IoU between two scan candidates
-auto ComputeIoU(
-    const ScanCandidate& a,
-    const ScanCandidate& b,
-    int                  tmpl_w,
-    int                  tmpl_h) -> double
-{
-    const int x1 = std::max(a.x, b.x);
-    const int y1 = std::max(a.y, b.y);
-    const int x2 = std::min(a.x + tmpl_w, b.x + tmpl_w);
-    const int y2 = std::min(a.y + tmpl_h, b.y + tmpl_h);
-
-    const int inter_w = std::max(0, x2 - x1);
-    const int inter_h = std::max(0, y2 - y1);
-    const int inter_area = inter_w * inter_h;
-
-    const int area = tmpl_w * tmpl_h;
-    const int union_area = area + area - inter_area;
-
-    if (union_area <= 0)
-    {
-        return 0.0;
-    }
-    return static_cast<double>(inter_area) / static_cast<double>(union_area);
-}
-
-/// @brief Global NMS: sort by score descending, suppress overlapping candidates
-auto ApplyNms(
-    std::vector<ScanCandidate> candidates,
-    int                        tmpl_w,
-    int                        tmpl_h,
-    double                     iou_threshold) -> std::vector<ScanCandidate>
-{
-    if (candidates.empty())
-    {
-        return {};
-    }
-
-    std::sort(
-        candidates.begin(),
-        candidates.end(),
-        [](const ScanCandidate& a, const ScanCandidate& b)
-        { return a.score > b.score; });
-
-    std::vector<ScanCandidate> result;
-    result.reserve(candidates.size());
-    std::vector<bool> suppressed(candidates.size(), false);
-
-    for (size_t i = 0; i < candidates.size(); ++i)
-    {
-        if (suppressed[i])
-        {
-            continue;
-        }
-        result.push_back(candidates[i]);
-        for (size_t j = i + 1; j < candidates.size(); ++j)
-        {
-            if (suppressed[j])
-            {
-                continue;
-            }
-            if (ComputeIoU(candidates[i], candidates[j], tmpl_w, tmpl_h)
-                > iou_threshold)
-            {
-                suppressed[j] = true;
-            }
-        }
-    }
-
-    result.shrink_to_fit();
-    return result;
-}
-
-/// @brief Unify template match scores to 0..1 (higher is better)
-auto UnifyScore(float raw_score, ExportInterface::DasTemplateMatchType type)
-    -> float
-{
-    if (type == ExportInterface::DAS_TEMPLATE_MATCH_TYPE_SQDIFF_NORMED)
-    {
-        return 1.0f - raw_score;
-    }
-    return raw_score;
-}
-
 DAS_NS_ANONYMOUS_DETAILS_END
 
 // ==================== TemplateMatchBest ====================
@@ -369,64 +281,221 @@ DasResult CvCpuImpl::TemplateMatchAll(
 
     // Step 1: Threshold filtering — collect all candidates with score >=
     // threshold
-    std::vector<Details::ScanCandidate> candidates;
-    candidates.reserve(static_cast<size_t>(result_mat.rows * result_mat.cols));
+    std::vector<TemplateMatchCandidate> candidates;
+    CollectThresholdCandidates(result_mat, type, threshold, candidates);
+
+    // Step 2: Record raw_match_count (before NMS)
+    const uint32_t raw_match_count = static_cast<uint32_t>(candidates.size());
 
-    for (int y = 0; y < result_mat.rows; ++y)
+    // Step 3: Global NMS, sorted by score descending
+    auto final_candidates = ApplyTemplateNms(
+        std::move(candidates),
+        tmpl_w,
+        tmpl_h,
+        kTemplateMatchIouThreshold);
+
+    // Step 4: Apply max_count truncation and create result collection
+    *pp_out_results = MakeTemplateMatchResults(
+        std::move(final_candidates),
+        raw_match_count,
+        tmpl_w,
+        tmpl_h,
+        max_count);
+    return DAS_S_OK;
+}
+
+// ==================== TemplateMatchAllWithConfig ====================
+
+DasResult CvCpuImpl::CreateTemplateSearchConfig(
+    ExportInterface::DasTemplateSearchMode      mode,
+    int32_t                                     pyramid_levels,
+    ExportInterface::IDasTemplateSearchConfig** pp_out_config)
+{
+    DAS_UTILS_CHECK_POINTER(pp_out_config)
+
+    if (!IsValidTemplateSearchMode(mode))
     {
-        const auto* row = result_mat.ptr<float>(y);
-        for (int x = 0; x < result_mat.cols; ++x)
-        {
-            const float raw = row[x];
-            const float unified = Details::UnifyScore(raw, type);
+        DAS_CORE_LOG_ERROR(
+            "Unknown template search mode: {}",
+            static_cast<int>(mode));
+        return DAS_E_INVALID_ARGUMENT;
+    }
 
-            if (unified >= threshold)
-            {
-                candidates.push_back({unified, raw, x, y});
-            }
-        }
+    if (pyramid_levels < 0 || pyramid_levels > kMaxTemplatePyramidLevels)
+    {
+        DAS_CORE_LOG_ERROR(
+            "pyramid_levels out of range: {}, expected 0 ~ {}",
+            pyramid_levels,
+            kMaxTemplatePyramidLevels);
+        return DAS_E_INVALID_ARGUMENT;
     }
 
-    // Step 2: Record raw_match_count (before NMS)
-    const uint32_t raw_match_count = static_cast<uint32_t>(candidates.size());
+    *pp_out_config =
+        IDasTemplateSearchConfigImpl::MakeRaw(mode, pyramid_levels);
+    return DAS_S_OK;
+}
+
+DasResult CvCpuImpl::TemplateMatchAllWithConfig(
+    ExportInterface::IDasImage*                 p_image,
+    ExportInterface::IDasImage*                 p_template,
+    ExportInterface::DasTemplateMatchType       type,
+    double                                      threshold,
+    int32_t                                     max_count,
+    ExportInterface::IDasTemplateSearchConfig*  p_config,
+    ExportInterface::IDasTemplateMatchResults** pp_out_results)
+{
+    DAS_UTILS_CHECK_POINTER(pp_out_results)
+
+    TemplateSearchOptions options{};
+    if (const auto read_result = ReadTemplateSearchOptions(p_config, options);
+        DAS::IsFailed(read_result))
+    {
+        return read_result;
+    }
+
+    const auto expected_p_image = Details::GetImageBackend(p_image);
+    if (!expected_p_image)
+    {
+        return expected_p_image.error();
+    }
+
+    const auto expected_p_template = Details::GetImageBackend(p_template);
+    if (!expected_p_template)
+    {
+        return expected_p_template.error();
+    }
+
+    const auto& image_mat = expected_p_image.value()->GetCpuMat();
+    const auto& template_mat = expected_p_template.value()->GetCpuMat();
+
+    if (const auto validate_result = Details::ValidateTemplateMatchInputs(
+            image_mat,
+            template_mat,
+            "CvCpuImpl::TemplateMatchAllWithConfig");
+        DAS::IsFailed(validate_result))
+    {
+        return validate_result;
+    }
+
+    DAS::Utils::Timer timer{};
+    timer.Begin();
+
+    TemplateSearchOutput output{};
+    try
+    {
+        SearchTemplate(
+            image_mat,
+            template_mat,
+            type,
+            threshold,
+            options,
+            output);
+    }
+    catch (const cv::Exception& ex)
+    {
+        DAS_CORE_LOG_ERROR(
+            "CvCpuImpl::TemplateMatchAllWithConfig: OpenCV exception: {}",
+            ex.what());
+        return DAS_E_OPENCV_ERROR;
+    }
+
+    DAS_CORE_LOG_INFO(
+        "Template search cost {} ms, mode = {}, regions = {}, raw = {}.",
+        timer.End(),
+        static_cast<int>(options.mode),
+        options.regions.size(),
+        output.raw_match_count);
+
+    *pp_out_results = MakeTemplateMatchResults(
+        std::move(output.matches),
+        output.raw_match_count,
+        template_mat.cols,
+        template_mat.rows,
+        max_count);
+    return DAS_S_OK;
+}
 
-    // Step 3: Keep internal scan trajectory (for debug purposes)
-    // The candidates vector itself IS the raw scan trajectory.
-    // We keep it alive in this local scope for potential debug access.
+// ==================== TemplateMatchBestMulti ====================
 
-    // Step 4: Global NMS with default IoU threshold of 0.5
-    constexpr double kIouThreshold = 0.5;
-    auto             final_candidates =
-        Details::ApplyNms(std::move(candidates), tmpl_w, tmpl_h, kIouThreshold);
+DasResult CvCpuImpl::PrepareTemplate(
+    ExportInterface::IDasImage*             p_template,
+    ExportInterface::IDasPreparedTemplate** pp_out_template)
+{
+    DAS_UTILS_CHECK_POINTER(pp_out_template)
 
-    // Step 5: Sort by score descending (already done by ApplyNms)
+    const auto expected_p_template = Details::GetImageBackend(p_template);
+    if (!expected_p_template)
+    {
+        return expected_p_template.error();
+    }
 
-    // Step 6: Apply max_count truncation
-    if (max_count > 0
-        && static_cast<int32_t>(final_candidates.size()) > max_count)
+    IDasPreparedTemplateImpl* p_prepared = nullptr;
+    if (const auto result = PrepareTemplateFromMat(
+            expected_p_template.value()->GetCpuMat(),
+            &p_prepared);
+        DAS::IsFailed(result))
     {
-        final_candidates.resize(static_cast<size_t>(max_count));
+        return result;
     }
 
-    // Step 7: Create result collection
-    auto* p_results =
-        DAS::Core::OcvWrapper::IDasTemplateMatchResultsImpl::MakeRaw();
-    p_results->SetRawMatchCount(raw_match_count);
-    p_results->Reserve(final_candidates.size());
+    *pp_out_template = p_prepared;
+    return DAS_S_OK;
+}
 
-    for (const auto& cand : final_candidates)
+DasResult CvCpuImpl::CreatePreparedTemplateSet(
+    ExportInterface::IDasPreparedTemplateSet** pp_out_set)
+{
+    DAS_UTILS_CHECK_POINTER(pp_out_set)
+
+    *pp_out_set = IDasPreparedTemplateSetImpl::MakeRaw();
+    return DAS_S_OK;
+}
+
+DasResult CvCpuImpl::TemplateMatchBestMulti(
+    ExportInterface::IDasImage*                 p_image,
+    ExportInterface::IDasPreparedTemplateSet*   p_templates,
+    ExportInterface::DasTemplateMatchType       type,
+    ExportInterface::IDasTemplateMatchResults** pp_out_results)
+{
+    DAS_UTILS_CHECK_POINTER(p_templates)
+    DAS_UTILS_CHECK_POINTER(pp_out_results)
+
+    const auto expected_p_image = Details::GetImageBackend(p_image);
+    if (!expected_p_image)
     {
-        const float raw_score = cand.raw_score;
+        return expected_p_image.error();
+    }
+
+    std::vector<DasPtr<IDasPreparedTemplateImpl>> templates;
+    if (const auto result = CollectPreparedTemplates(p_templates, templates);
+        DAS::IsFailed(result))
+    {
+        return result;
+    }
+
+    DAS::Utils::Timer timer{};
+    timer.Begin();
+
+    auto& image_backend = *expected_p_image.value();
 
-        auto* p_result = IDasTemplateMatchResultImpl::MakeRaw(
-            cand.score,
-            ExportInterface::DasRect{cand.x, cand.y, tmpl_w, tmpl_h},
-            raw_score);
-        p_results->AddResult(p_result);
-        p_result->Release();
+    std::vector<TemplateMatchCandidate> best;
+    if (const auto result = MatchPreparedTemplates(
+            image_backend.GetCpuMat(),
+            image_backend.GetPixelFormatValue(),
+            templates,
+            type,
+            best);
+        DAS::IsFailed(result))
+    {
+        return result;
     }
 
-    *pp_out_results = p_results;
+    DAS_CORE_LOG_INFO(
+        "TemplateMatchBestMulti matched {} templates in {} ms.",
+        templates.size(),
+        timer.End());
+
+    *pp_out_results = MakeMultiTemplateMatchResults(templates, best);
     return DAS_S_OK;
 }
 
@@ -8,10 +8,15 @@
 #include "DescriptorMatcherFactory.h"
 #include "FeatureDetectorFactory.h"
 #include "IDasMatchResultImpl.h"
+#include "IDasPreparedTemplateImpl.h"
+#include "IDasPreparedTemplateSetImpl.h"
 #include "IDasTemplateMatchResultImpl.h"
 #include "IDasTemplateMatchResultsImpl.h"
+#include "IDasTemplateSearchConfigImpl.h"
 #include "IImageBackend.h"
 #include "IMatchConfigImpl.h"
+#include "MultiTemplateMatch.h"
+#include "TemplateSearch.h"
 
 #include <das/Core/Logger/Logger.h>
 #include <das/DasPtr.hpp>
@@ -120,99 +125,6 @@ auto ValidateTemplateMatchInputs(
     return DAS_S_OK;
 }
 
-/// @brief Internal scan candidate for TemplateMatchAll
-struct ScanCandidate
-{
-    float score{};
-    float raw_score{};
-    int   x{};
-    int   y{};
-};
-
-/// @brief Compute IoU between two scan candidates
-auto ComputeIoU(
-    const ScanCandidate& a,
-    const ScanCandidate& b,
-    int                  tmpl_w,
-    int                  tmpl_h) -> double
-{
-    const int x1 = std::max(a.x, b.x);
-    const int y1 = std::max(a.y, b.y);
-    const int x2 = std::min(a.x + tmpl_w, b.x + tmpl_w);
-    const int y2 = std::min(a.y + tmpl_h, b.y + tmpl_h);
-
-    const int inter_w = std::max(0, x2 - x1);
-    const int inter_h = std::max(0, y2 - y1);
-    const int inter_area = inter_w * inter_h;
-
-    const int area = tmpl_w * tmpl_h;
-    const int union_area = area + area - inter_area;
-
-    if (union_area <= 0)
-    {
-        return 0.0;
-    }
-    return static_cast<double>(inter_area) / static_cast<double>(union_area);
-}
-
-/// @brief Global NMS: sort by score descending, suppress overlapping candidates
-auto ApplyNms(
-    std::vector<ScanCandidate> candidates,
-    int                        tmpl_w,
-    int                        tmpl_h,
-    double                     iou_threshold) -> std::vector<ScanCandidate>
-{
-    if (candidates.empty())
-    {
-        return {};
-    }
-
-    std::sort(
-        candidates.begin(),
-        candidates.end(),
-        [](const ScanCandidate& a, const ScanCandidate& b)
-        { return a.score > b.score; });
-
-    std::vector<ScanCandidate> result;
-    result.reserve(candidates.size());
-    std::vector<bool> suppressed(candidates.size(), false);
-
-    for (size_t i = 0; i < candidates.size(); ++i)
-    {
-        if (suppressed[i])
-        {
-            continue;
-        }
-        result.push_back(candidates[i]);
-        for (size_t j = i + 1; j < candidates.size(); ++j)
-        {
-            if (suppressed[j])
-            {
-                continue;
-            }
-            if (ComputeIoU(candidates[i], candidates[j], tmpl_w, tmpl_h)
-                > iou_threshold)
-            {
-                suppressed[j] = true;
-            }
-        }
-    }
-
-    result.shrink_to_fit();
-    return result;
-}
-
-/// @brief Unify template match scores to 0..1 (higher is better)
-auto UnifyScore(float raw_score, ExportInterface::DasTemplateMatchType type)
-    -> float
-{
-    if (type == ExportInterface::DAS_TEMPLATE_MATCH_TYPE_SQDIFF_NORMED)
-    {
-        return 1.0 - raw_score;
-    }
-    return raw_score;
-}
-
 DAS_NS_ANONYMOUS_DETAILS_END
 
 // ==================== TemplateMatchBest ====================
@@ -387,58 +299,254 @@ DasResult CvCudaImpl::TemplateMatchAll(
 
     // Step 1: Threshold filtering — collect all candidates with score >=
     // threshold
-    std::vector<Details::ScanCandidate> candidates;
-    candidates.reserve(static_cast<size_t>(result_mat.rows * result_mat.cols));
+    std::vector<TemplateMatchCandidate> candidates;
+    CollectThresholdCandidates(result_mat, type, threshold, candidates);
 
-    for (int y = 0; y < result_mat.rows; ++y)
+    // Step 2: Record raw_match_count (before NMS)
+    const uint32_t raw_match_count = static_cast<uint32_t>(candidates.size());
+
+    // Step 3: Global NMS, sorted by score descending
+    auto final_candidates = ApplyTemplateNms(
+        std::move(candidates),
+        tmpl_w,
+        tmpl_h,
+        kTemplateMatchIouThreshold);
+
+    // Step 4: Apply max_count truncation and create result collection
+    *pp_out_results = MakeTemplateMatchResults(
+        std::move(final_candidates),
+        raw_match_count,
+        tmpl_w,
+        tmpl_h,
+        max_count);
+    return DAS_S_OK;
+}
+
+// ==================== TemplateMatchAllWithConfig ====================
+
+DasResult CvCudaImpl::CreateTemplateSearchConfig(
+    ExportInterface::DasTemplateSearchMode      mode,
+    int32_t                                     pyramid_levels,
+    ExportInterface::IDasTemplateSearchConfig** pp_out_config)
+{
+    DAS_UTILS_CHECK_POINTER(pp_out_config)
+
+    if (!IsValidTemplateSearchMode(mode))
     {
-        const float* row = result_mat.ptr<float>(y);
-        for (int x = 0; x < result_mat.cols; ++x)
-        {
-            const float raw = row[x];
-            const float unified = Details::UnifyScore(raw, type);
+        DAS_CORE_LOG_ERROR(
+            "Unknown template search mode: {}",
+            static_cast<int>(mode));
+        return DAS_E_INVALID_ARGUMENT;
+    }
+
+    if (pyramid_levels < 0 || pyramid_levels > kMaxTemplatePyramidLevels)
+    {
+        DAS_CORE_LOG_ERROR(
+            "pyramid_levels out of range: {}, expected 0 ~ {}",
+            pyramid_levels,
+            kMaxTemplatePyramidLevels);
+        return DAS_E_INVALID_ARGUMENT;
+    }
+
+    *pp_out_config =
+        IDasTemplateSearchConfigImpl::MakeRaw(mode, pyramid_levels);
+    return DAS_S_OK;
+}
+
+DasResult CvCudaImpl::TemplateMatchAllWithConfig(
+    ExportInterface::IDasImage*                 p_image,
+    ExportInterface::IDasImage*                 p_template,
+    ExportInterface::DasTemplateMatchType       type,
+    double                                      threshold,
+    int32_t                                     max_count,
+    ExportInterface::IDasTemplateSearchConfig*  p_config,
+    ExportInterface::IDasTemplateMatchResults** pp_out_results)
+{
+    DAS_UTILS_CHECK_POINTER(pp_out_results)
+
+    TemplateSearchOptions options{};
+    if (const auto read_result = ReadTemplateSearchOptions(p_config, options);
+        DAS::IsFailed(read_result))
+    {
+        return read_result;
+    }
+
+    const auto expected_p_image = Details::GetImageBackend(p_image);
+    if (!expected_p_image)
+    {
+        return expected_p_image.error();
+    }
+
+    const auto expected_p_template = Details::GetImageBackend(p_template);
+    if (!expected_p_template)
+    {
+        return expected_p_template.error();
+    }
+
+    auto&             image_backend = *expected_p_image.value();
+    auto&             tmpl_backend = *expected_p_template.value();
+    cv::cuda::GpuMat& gpu_image = image_backend.GetGpuMat();
+    cv::cuda::GpuMat& gpu_tmpl = tmpl_backend.GetGpuMat();
+
+    if (const auto validate_result = Details::ValidateTemplateMatchInputs(
+            gpu_image,
+            gpu_tmpl,
+            "CvCudaImpl::TemplateMatchAllWithConfig");
+        DAS::IsFailed(validate_result))
+    {
+        return validate_result;
+    }
+
+    const int tmpl_w = gpu_tmpl.cols;
+    const int tmpl_h = gpu_tmpl.rows;
 
-            if (unified >= threshold)
+    TemplateSearchOutput output{};
+    try
+    {
+        if (options.mode == ExportInterface::DAS_TEMPLATE_SEARCH_MODE_PYRAMID)
+        {
+            // Refinement runs many tiny matchTemplate calls, which are
+            // cheaper on the CPU than as individual kernel launches.
+            SearchTemplate(
+                image_backend.GetCpuMat(),
+                tmpl_backend.GetCpuMat(),
+                type,
+                threshold,
+                options,
+                output);
+        }
+        else
+        {
+            std::vector<TemplateMatchCandidate> candidates;
+            for (const auto& region : ResolveTemplateSearchRegions(
+                     gpu_image.size(),
+                     gpu_tmpl.size(),
+                     options.regions))
             {
-                candidates.push_back({unified, raw, x, y});
+                cv::cuda::GpuMat gpu_result_mat;
+                cv::Mat          result_mat;
+                cv::cuda::matchTemplate(
+                    gpu_image(region),
+                    gpu_tmpl,
+                    gpu_result_mat,
+                    DAS::Utils::ToUnderlying(type));
+                gpu_result_mat.download(result_mat);
+                CollectLocalMaxima(
+                    result_mat,
+                    type,
+                    threshold,
+                    region.tl(),
+                    candidates);
             }
+
+            output.raw_match_count = static_cast<uint32_t>(candidates.size());
+            output.matches = ApplyTemplateNms(
+                std::move(candidates),
+                tmpl_w,
+                tmpl_h,
+                kTemplateMatchIouThreshold);
         }
     }
+    catch (const cv::Exception& ex)
+    {
+        DAS_CORE_LOG_ERROR(
+            "CvCudaImpl::TemplateMatchAllWithConfig: OpenCV exception: {}",
+            ex.what());
+        return DAS_E_OPENCV_ERROR;
+    }
 
-    // Step 2: Record raw_match_count (before NMS)
-    const uint32_t raw_match_count = static_cast<uint32_t>(candidates.size());
+    *pp_out_results = MakeTemplateMatchResults(
+        std::move(output.matches),
+        output.raw_match_count,
+        tmpl_w,
+        tmpl_h,
+        max_count);
+    return DAS_S_OK;
+}
 
-    // Step 3: Global NMS with default IoU threshold of 0.5
-    constexpr double kIouThreshold = 0.5;
-    auto             final_candidates =
-        Details::ApplyNms(std::move(candidates), tmpl_w, tmpl_h, kIouThreshold);
+// ==================== TemplateMatchBestMulti ====================
 
-    // Step 4: Apply max_count truncation
-    if (max_count > 0
-        && static_cast<int32_t>(final_candidates.size()) > max_count)
+DasResult CvCudaImpl::PrepareTemplate(
+    ExportInterface::IDasImage*             p_template,
+    ExportInterface::IDasPreparedTemplate** pp_out_template)
+{
+    DAS_UTILS_CHECK_POINTER(pp_out_template)
+
+    const auto expected_p_template = Details::GetImageBackend(p_template);
+    if (!expected_p_template)
+    {
+        return expected_p_template.error();
+    }
+
+    IDasPreparedTemplateImpl* p_prepared = nullptr;
+    if (const auto result = PrepareTemplateFromMat(
+            expected_p_template.value()->GetCpuMat(),
+            &p_prepared);
+        DAS::IsFailed(result))
     {
-        final_candidates.resize(static_cast<size_t>(max_count));
+        return result;
     }
 
-    // Step 5: Create result collection
-    auto* p_results =
-        DAS::Core::OcvWrapper::IDasTemplateMatchResultsImpl::MakeRaw();
-    p_results->SetRawMatchCount(raw_match_count);
-    p_results->Reserve(final_candidates.size());
+    *pp_out_template = p_prepared;
+    return DAS_S_OK;
+}
 
-    for (const auto& cand : final_candidates)
+DasResult CvCudaImpl::CreatePreparedTemplateSet(
+    ExportInterface::IDasPreparedTemplateSet** pp_out_set)
+{
+    DAS_UTILS_CHECK_POINTER(pp_out_set)
+
+    *pp_out_set = IDasPreparedTemplateSetImpl::MakeRaw();
+    return DAS_S_OK;
+}
+
+DasResult CvCudaImpl::TemplateMatchBestMulti(
+    ExportInterface::IDasImage*                 p_image,
+    ExportInterface::IDasPreparedTemplateSet*   p_templates,
+    ExportInterface::DasTemplateMatchType       type,
+    ExportInterface::IDasTemplateMatchResults** pp_out_results)
+{
+    DAS_UTILS_CHECK_POINTER(p_templates)
+    DAS_UTILS_CHECK_POINTER(pp_out_results)
+
+    const auto expected_p_image = Details::GetImageBackend(p_image);
+    if (!expected_p_image)
     {
-        const float raw_score = cand.raw_score;
+        return expected_p_image.error();
+    }
+
+    std::vector<DasPtr<IDasPreparedTemplateImpl>> templates;
+    if (const auto result = CollectPreparedTemplates(p_templates, templates);
+        DAS::IsFailed(result))
+    {
+        return result;
+    }
+
+    DAS::Utils::Timer timer{};
+    timer.Begin();
+
+    // The spectra and window statistics are computed on the CPU; the frame
+    // is downloaded once for the whole template set.
+    auto& image_backend = *expected_p_image.value();
 
-        auto* p_result = IDasTemplateMatchResultImpl::MakeRaw(
-            cand.score,
-            ExportInterface::DasRect{cand.x, cand.y, tmpl_w, tmpl_h},
-            raw_score);
-        p_results->AddResult(p_result);
-        p_result->Release();
+    std::vector<TemplateMatchCandidate> best;
+    if (const auto result = MatchPreparedTemplates(
+            image_backend.GetCpuMat(),
+            image_backend.GetPixelFormatValue(),
+            templates,
+            type,
+            best);
+        DAS::IsFailed(result))
+    {
+        return result;
     }
 
-    *pp_out_results = p_results;
+    DAS_CORE_LOG_INFO(
+        "TemplateMatchBestMulti matched {} templates in {} ms.",
+        templates.size(),
+        timer.End());
+
+    *pp_out_results = MakeMultiTemplateMatchResults(templates, best);
     return DAS_S_OK;
 }
 
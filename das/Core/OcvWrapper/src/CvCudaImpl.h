@@ -58,6 +58,33 @@ public:
         int32_t                                     max_count,
         ExportInterface::IDasTemplateMatchResults** pp_out_results) override;
 
+    DAS_IMPL CreateTemplateSearchConfig(
+        ExportInterface::DasTemplateSearchMode      mode,
+        int32_t                                     pyramid_levels,
+        ExportInterface::IDasTemplateSearchConfig** pp_out_config) override;
+
+    DAS_IMPL TemplateMatchAllWithConfig(
+        ExportInterface::IDasImage*                 p_image,
+        ExportInterface::IDasImage*                 p_template,
+        ExportInterface::DasTemplateMatchType       type,
+        double                                      threshold,
+        int32_t                                     max_count,
+        ExportInterface::IDasTemplateSearchConfig*  p_config,
+        ExportInterface::IDasTemplateMatchResults** pp_out_results) override;
+
+    DAS_IMPL PrepareTemplate(
+        ExportInterface::IDasImage*             p_template,
+        ExportInterface::IDasPreparedTemplate** pp_out_template) override;
+
+    DAS_IMPL CreatePreparedTemplateSet(
+        ExportInterface::IDasPreparedTemplateSet** pp_out_set) override;
+
+    DAS_IMPL TemplateMatchBestMulti(
+        ExportInterface::IDasImage*                 p_image,
+        ExportInterface::IDasPreparedTemplateSet*   p_templates,
+        ExportInterface::DasTemplateMatchType       type,
+        ExportInterface::IDasTemplateMatchResults** pp_out_results) override;
+
     // ---- Feature Match ----
     DAS_IMPL CreateMatchConfig(
         ExportInterface::DasDetectorType     detector_type,
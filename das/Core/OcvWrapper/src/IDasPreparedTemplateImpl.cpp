@@ -0,0 +1,101 @@
+#include "IDasPreparedTemplateImpl.h"
+
+DAS_DISABLE_WARNING_BEGIN
+
+DAS_IGNORE_OPENCV_WARNING
+#include <opencv2/core.hpp>
+
+DAS_DISABLE_WARNING_END
+
+DAS_CORE_OCVWRAPPER_NS_BEGIN
+
+IDasPreparedTemplateImpl::IDasPreparedTemplateImpl(const cv::Mat& templ)
+    : size_(templ.size()), depth_(templ.depth())
+{
+    std::vector<cv::Mat> source_planes;
+    cv::split(templ, source_planes);
+
+    planes_.resize(source_planes.size());
+    zero_mean_planes_.resize(source_planes.size());
+    for (size_t c = 0; c < source_planes.size(); ++c)
+    {
+        source_planes[c].convertTo(planes_[c], CV_32F);
+        sum2_ += planes_[c].dot(planes_[c]);
+
+        const auto mean = cv::mean(planes_[c])[0];
+        cv::subtract(planes_[c], cv::Scalar::all(mean), zero_mean_planes_[c]);
+        zero_mean_sum2_ += zero_mean_planes_[c].dot(zero_mean_planes_[c]);
+    }
+}
+
+DasResult IDasPreparedTemplateImpl::QueryInterface(
+    const DasGuid& iid,
+    void**         pp_out_object)
+{
+    const auto base_result = ExportInterface::DasPreparedTemplateImplBase<
+        IDasPreparedTemplateImpl>::QueryInterface(iid, pp_out_object);
+    if (DAS::IsOk(base_result))
+    {
+        return base_result;
+    }
+
+    if (iid == DasIidOf<IDasPreparedTemplateImpl>())
+    {
+        *pp_out_object = static_cast<IDasPreparedTemplateImpl*>(this);
+        AddRef();
+        return DAS_S_OK;
+    }
+
+    return base_result;
+}
+
+DasResult IDasPreparedTemplateImpl::GetSize(
+    ExportInterface::DasSize* p_out_size)
+{
+    if (!p_out_size)
+        return DAS_E_INVALID_POINTER;
+    *p_out_size = {size_.width, size_.height};
+    return DAS_S_OK;
+}
+
+DasResult IDasPreparedTemplateImpl::GetChannelCount(
+    int32_t* p_out_channel_count)
+{
+    if (!p_out_channel_count)
+        return DAS_E_INVALID_POINTER;
+    *p_out_channel_count = GetChannels();
+    return DAS_S_OK;
+}
+
+auto IDasPreparedTemplateImpl::GetSpectra(cv::Size dft_size, bool zero_mean)
+    -> std::shared_ptr<const Spectra>
+{
+    const auto key =
+        std::make_tuple(dft_size.width, dft_size.height, zero_mean);
+    {
+        std::lock_guard lock{spectra_mutex_};
+        if (const auto it = spectra_.find(key); it != spectra_.end())
+        {
+            return it->second;
+        }
+    }
+
+    // Transform outside the lock; a racing thread at worst repeats the work
+    const auto& source = zero_mean ? zero_mean_planes_ : planes_;
+    auto        spectra = std::make_shared<Spectra>(source.size());
+    for (size_t c = 0; c < source.size(); ++c)
+    {
+        cv::Mat padded = cv::Mat::zeros(dft_size, CV_32F);
+        source[c].copyTo(padded(cv::Rect{{0, 0}, size_}));
+        cv::dft(padded, (*spectra)[c], 0, size_.height);
+    }
+
+    std::lock_guard lock{spectra_mutex_};
+    if (spectra_.size() >= kMaxCachedSpectra)
+    {
+        spectra_.clear();
+    }
+    return spectra_.emplace(key, std::move(spectra)).first->second;
+}
+
+DAS_CORE_OCVWRAPPER_NS_END
@@ -0,0 +1,117 @@
+#ifndef DAS_CORE_OCVWRAPPER_IDASPREPAREDTEMPLATEIMPL_H
+#define DAS_CORE_OCVWRAPPER_IDASPREPAREDTEMPLATEIMPL_H
+
+#include <das/Core/OcvWrapper/Config.h>
+
+#include <das/_autogen/idl/abi/DasCV.h>
+#include <das/_autogen/idl/wrapper/Das.ExportInterface.IDasPreparedTemplate.Implements.hpp>
+
+DAS_DISABLE_WARNING_BEGIN
+
+DAS_IGNORE_OPENCV_WARNING
+#include <opencv2/core/mat.hpp>
+
+DAS_DISABLE_WARNING_END
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+// {E0C13A2C-DCFB-40F8-9118-88656CA8F48B}
+DAS_DEFINE_CLASS_IN_NAMESPACE(
+    Das::Core::OcvWrapper,
+    IDasPreparedTemplateImpl,
+    0xe0c13a2c,
+    0xdcfb,
+    0x40f8,
+    0x91,
+    0x18,
+    0x88,
+    0x65,
+    0x6c,
+    0xa8,
+    0xf4,
+    0x8b);
+
+DAS_CORE_OCVWRAPPER_NS_BEGIN
+
+/**
+ * @brief Template preprocessed for IDasCv::TemplateMatchBestMulti.
+ *
+ * Holds the template as float planes together with the sums the normalized
+ * match types need, and caches the planes' spectra per frame DFT size so a
+ * template matched against a stream of same-sized frames is transformed once.
+ * QueryInterface also answers DasIidOf<IDasPreparedTemplateImpl>().
+ */
+class IDasPreparedTemplateImpl final
+    : public ExportInterface::DasPreparedTemplateImplBase<
+          IDasPreparedTemplateImpl>
+{
+public:
+    using Spectra = std::vector<cv::Mat>;
+
+    /// @brief Split and convert templ (CV_8U or CV_32F, 1~4 channels)
+    /// @note Throws cv::Exception
+    explicit IDasPreparedTemplateImpl(const cv::Mat& templ);
+
+    DAS_IMPL QueryInterface(const DasGuid& iid, void** pp_out_object) override;
+    DAS_IMPL GetSize(ExportInterface::DasSize* p_out_size) override;
+    DAS_IMPL GetChannelCount(int32_t* p_out_channel_count) override;
+
+    [[nodiscard]]
+    auto GetCvSize() const noexcept -> cv::Size
+    {
+        return size_;
+    }
+    [[nodiscard]]
+    auto GetChannels() const noexcept -> int
+    {
+        return static_cast<int>(planes_.size());
+    }
+    [[nodiscard]]
+    auto GetDepth() const noexcept -> int
+    {
+        return depth_;
+    }
+    /// @brief Sum of squares over all channels
+    [[nodiscard]]
+    auto GetSum2() const noexcept -> double
+    {
+        return sum2_;
+    }
+    /// @brief Sum of squares of the per-channel mean-subtracted template
+    [[nodiscard]]
+    auto GetZeroMeanSum2() const noexcept -> double
+    {
+        return zero_mean_sum2_;
+    }
+
+    /**
+     * @brief CCS spectra of the template planes zero-padded to dft_size, one
+     * per channel; zero_mean selects the mean-subtracted planes (CCOEFF).
+     * @note Thread-safe. Throws cv::Exception
+     */
+    auto GetSpectra(cv::Size dft_size, bool zero_mean)
+        -> std::shared_ptr<const Spectra>;
+
+private:
+    /// Frames rarely change size; bound the cache in case they do
+    static constexpr size_t kMaxCachedSpectra = 4;
+
+    cv::Size             size_;
+    int                  depth_{};
+    std::vector<cv::Mat> planes_;
+    std::vector<cv::Mat> zero_mean_planes_;
+    double               sum2_{};
+    double               zero_mean_sum2_{};
+
+    std::mutex spectra_mutex_;
+    std::map<std::tuple<int, int, bool>, std::shared_ptr<const Spectra>>
+        spectra_;
+};
+
+DAS_CORE_OCVWRAPPER_NS_END
+
+#endif // DAS_CORE_OCVWRAPPER_IDASPREPAREDTEMPLATEIMPL_H
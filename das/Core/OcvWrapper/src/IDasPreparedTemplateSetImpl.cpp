@@ -0,0 +1,44 @@
+#include "IDasPreparedTemplateSetImpl.h"
+
+DAS_CORE_OCVWRAPPER_NS_BEGIN
+
+DasResult IDasPreparedTemplateSetImpl::Add(
+    ExportInterface::IDasPreparedTemplate* p_template)
+{
+    if (!p_template)
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+    templates_.emplace_back(p_template);
+    return DAS_S_OK;
+}
+
+DasResult IDasPreparedTemplateSetImpl::GetCount(uint32_t* p_out_count)
+{
+    if (!p_out_count)
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+    *p_out_count = static_cast<uint32_t>(templates_.size());
+    return DAS_S_OK;
+}
+
+DasResult IDasPreparedTemplateSetImpl::GetAt(
+    uint32_t                                index,
+    ExportInterface::IDasPreparedTemplate** pp_out_template)
+{
+    if (!pp_out_template)
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+    if (index >= templates_.size())
+    {
+        return DAS_E_OUT_OF_RANGE;
+    }
+
+    *pp_out_template = templates_[index].Get();
+    (*pp_out_template)->AddRef();
+    return DAS_S_OK;
+}
+
+DAS_CORE_OCVWRAPPER_NS_END
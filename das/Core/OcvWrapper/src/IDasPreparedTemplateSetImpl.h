@@ -0,0 +1,46 @@
+#ifndef DAS_CORE_OCVWRAPPER_IDASPREPAREDTEMPLATESETIMPL_H
+#define DAS_CORE_OCVWRAPPER_IDASPREPAREDTEMPLATESETIMPL_H
+
+#include <das/Core/OcvWrapper/Config.h>
+#include <das/DasPtr.hpp>
+#include <das/_autogen/idl/abi/DasCV.h>
+#include <das/_autogen/idl/wrapper/Das.ExportInterface.IDasPreparedTemplateSet.Implements.hpp>
+#include <vector>
+
+// {1251D3EC-C639-48A9-A18D-91016B089BFD}
+DAS_DEFINE_CLASS_IN_NAMESPACE(
+    Das::Core::OcvWrapper,
+    IDasPreparedTemplateSetImpl,
+    0x1251d3ec,
+    0xc639,
+    0x48a9,
+    0xa1,
+    0x8d,
+    0x91,
+    0x01,
+    0x6b,
+    0x08,
+    0x9b,
+    0xfd);
+
+DAS_CORE_OCVWRAPPER_NS_BEGIN
+
+class IDasPreparedTemplateSetImpl final
+    : public ExportInterface::DasPreparedTemplateSetImplBase<
+          IDasPreparedTemplateSetImpl>
+{
+    std::vector<DasPtr<ExportInterface::IDasPreparedTemplate>> templates_;
+
+public:
+    IDasPreparedTemplateSetImpl() = default;
+
+    DAS_IMPL Add(ExportInterface::IDasPreparedTemplate* p_template) override;
+    DAS_IMPL GetCount(uint32_t* p_out_count) override;
+    DAS_IMPL GetAt(
+        uint32_t                                index,
+        ExportInterface::IDasPreparedTemplate** pp_out_template) override;
+};
+
+DAS_CORE_OCVWRAPPER_NS_END
+
+#endif // DAS_CORE_OCVWRAPPER_IDASPREPAREDTEMPLATESETIMPL_H
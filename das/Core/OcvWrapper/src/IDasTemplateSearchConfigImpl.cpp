@@ -0,0 +1,61 @@
+#include "IDasTemplateSearchConfigImpl.h"
+
+DAS_CORE_OCVWRAPPER_NS_BEGIN
+
+IDasTemplateSearchConfigImpl::IDasTemplateSearchConfigImpl(
+    ExportInterface::DasTemplateSearchMode mode,
+    int32_t                                pyramid_levels)
+    : mode_(mode), pyramid_levels_(pyramid_levels)
+{
+}
+
+DasResult IDasTemplateSearchConfigImpl::GetMode(
+    ExportInterface::DasTemplateSearchMode* p_out_mode)
+{
+    if (!p_out_mode)
+        return DAS_E_INVALID_POINTER;
+    *p_out_mode = mode_;
+    return DAS_S_OK;
+}
+
+DasResult IDasTemplateSearchConfigImpl::GetPyramidLevels(int32_t* p_out_levels)
+{
+    if (!p_out_levels)
+        return DAS_E_INVALID_POINTER;
+    *p_out_levels = pyramid_levels_;
+    return DAS_S_OK;
+}
+
+DasResult IDasTemplateSearchConfigImpl::AddSearchRegion(
+    const ExportInterface::DasRect* p_region)
+{
+    if (!p_region)
+        return DAS_E_INVALID_POINTER;
+    if (p_region->width <= 0 || p_region->height <= 0)
+        return DAS_E_INVALID_ARGUMENT;
+    regions_.push_back(*p_region);
+    return DAS_S_OK;
+}
+
+DasResult IDasTemplateSearchConfigImpl::GetSearchRegionCount(
+    uint32_t* p_out_count)
+{
+    if (!p_out_count)
+        return DAS_E_INVALID_POINTER;
+    *p_out_count = static_cast<uint32_t>(regions_.size());
+    return DAS_S_OK;
+}
+
+DasResult IDasTemplateSearchConfigImpl::GetSearchRegion(
+    uint32_t                  index,
+    ExportInterface::DasRect* p_out_region)
+{
+    if (!p_out_region)
+        return DAS_E_INVALID_POINTER;
+    if (index >= regions_.size())
+        return DAS_E_OUT_OF_RANGE;
+    *p_out_region = regions_[index];
+    return DAS_S_OK;
+}
+
+DAS_CORE_OCVWRAPPER_NS_END
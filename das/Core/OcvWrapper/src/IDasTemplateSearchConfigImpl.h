@@ -0,0 +1,56 @@
+#ifndef DAS_CORE_OCVWRAPPER_IDASTEMPLATESEARCHCONFIGIMPL_H
+#define DAS_CORE_OCVWRAPPER_IDASTEMPLATESEARCHCONFIGIMPL_H
+
+#include <das/Core/OcvWrapper/Config.h>
+
+#include <das/_autogen/idl/abi/DasCV.h>
+#include <das/_autogen/idl/wrapper/Das.ExportInterface.IDasTemplateSearchConfig.Implements.hpp>
+#include <vector>
+
+// {264AD38C-6105-4A79-A1EC-A03DBF1C4F29}
+DAS_DEFINE_CLASS_IN_NAMESPACE(
+    Das::Core::OcvWrapper,
+    IDasTemplateSearchConfigImpl,
+    0x264ad38c,
+    0x6105,
+    0x4a79,
+    0xa1,
+    0xec,
+    0xa0,
+    0x3d,
+    0xbf,
+    0x1c,
+    0x4f,
+    0x29);
+
+DAS_CORE_OCVWRAPPER_NS_BEGIN
+
+class IDasTemplateSearchConfigImpl final
+    : public ExportInterface::DasTemplateSearchConfigImplBase<
+          IDasTemplateSearchConfigImpl>
+{
+    ExportInterface::DasTemplateSearchMode mode_{
+        ExportInterface::DAS_TEMPLATE_SEARCH_MODE_FULL};
+    int32_t                               pyramid_levels_{};
+    std::vector<ExportInterface::DasRect> regions_;
+
+public:
+    IDasTemplateSearchConfigImpl() = default;
+
+    IDasTemplateSearchConfigImpl(
+        ExportInterface::DasTemplateSearchMode mode,
+        int32_t                                pyramid_levels);
+
+    DAS_IMPL GetMode(
+        ExportInterface::DasTemplateSearchMode* p_out_mode) override;
+    DAS_IMPL GetPyramidLevels(int32_t* p_out_levels) override;
+    DAS_IMPL AddSearchRegion(const ExportInterface::DasRect* p_region) override;
+    DAS_IMPL GetSearchRegionCount(uint32_t* p_out_count) override;
+    DAS_IMPL GetSearchRegion(
+        uint32_t                  index,
+        ExportInterface::DasRect* p_out_region) override;
+};
+
+DAS_CORE_OCVWRAPPER_NS_END
+
+#endif // DAS_CORE_OCVWRAPPER_IDASTEMPLATESEARCHCONFIGIMPL_H
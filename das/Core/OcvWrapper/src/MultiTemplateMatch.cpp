@@ -0,0 +1,592 @@
+#include "MultiTemplateMatch.h"
+#include "IDasTemplateMatchResultImpl.h"
+#include "IDasTemplateMatchResultsImpl.h"
+
+#include <das/Core/Logger/Logger.h>
+
+DAS_DISABLE_WARNING_BEGIN
+
+DAS_IGNORE_OPENCV_WARNING
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+
+DAS_DISABLE_WARNING_END
+
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <latch>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <tuple>
+
+DAS_CORE_OCVWRAPPER_NS_BEGIN
+
+// ==================== Internal helpers ====================
+
+DAS_NS_ANONYMOUS_DETAILS_BEGIN
+
+auto IsNormedMatchType(ExportInterface::DasTemplateMatchType type) -> bool
+{
+    return type == ExportInterface::DAS_TEMPLATE_MATCH_TYPE_SQDIFF_NORMED
+           || type == ExportInterface::DAS_TEMPLATE_MATCH_TYPE_CCORR_NORMED
+           || type == ExportInterface::DAS_TEMPLATE_MATCH_TYPE_CCOEFF_NORMED;
+}
+
+auto GetGrayConversionCode(
+    ExportInterface::DasImagePixelFormat format,
+    int                                  channels) -> int
+{
+    switch (format)
+    {
+    case ExportInterface::DAS_PIXEL_FORMAT_BGR:
+        return cv::COLOR_BGR2GRAY;
+    case ExportInterface::DAS_PIXEL_FORMAT_RGB:
+        return cv::COLOR_RGB2GRAY;
+    case ExportInterface::DAS_PIXEL_FORMAT_RGBA:
+        return cv::COLOR_RGBA2GRAY;
+    case ExportInterface::DAS_PIXEL_FORMAT_UNKNOWN:
+        // OpenCV channel order
+        if (channels == 3)
+        {
+            return cv::COLOR_BGR2GRAY;
+        }
+        if (channels == 4)
+        {
+            return cv::COLOR_BGRA2GRAY;
+        }
+        return -1;
+    default:
+        return -1;
+    }
+}
+
+/// Sum of every template-sized window, from an integral image
+auto WindowSum(const cv::Mat& integral, cv::Size templ_size, cv::Size result)
+    -> cv::Mat
+{
+    const int w = templ_size.width;
+    const int h = templ_size.height;
+    cv::Mat   sum = integral(cv::Rect{{w, h}, result})
+                  - integral(cv::Rect{{0, h}, result});
+    sum -= integral(cv::Rect{{w, 0}, result});
+    sum += integral(cv::Rect{{0, 0}, result});
+    return sum;
+}
+
+/**
+ * @brief One frame transformed once per channel layout and shared by every
+ * template matched against it.
+ */
+class FrameContext
+{
+public:
+    struct WindowStats
+    {
+        /// Σ window² over all channels (CV_64F, result sized)
+        cv::Mat sum2;
+        /// Σ (Σ window)² / area over all channels, CCOEFF only
+        cv::Mat mean2;
+    };
+
+    /// @note Throws cv::Exception
+    explicit FrameContext(const cv::Mat& frame)
+        : size_(frame.size()),
+          dft_size_(
+              cv::getOptimalDFTSize(frame.cols),
+              cv::getOptimalDFTSize(frame.rows))
+    {
+        std::vector<cv::Mat> planes;
+        cv::split(frame, planes);
+
+        spectra_.resize(planes.size());
+        sums_.resize(planes.size());
+        sqsums_.resize(planes.size());
+        for (size_t c = 0; c < planes.size(); ++c)
+        {
+            cv::integral(planes[c], sums_[c], sqsums_[c], CV_64F, CV_64F);
+
+            // Correlation through the DFT wraps around; a transform at least
+            // as large as the frame keeps every valid position wrap-free.
+            cv::Mat padded = cv::Mat::zeros(dft_size_, CV_32F);
+            cv::Mat frame_area = padded(cv::Rect{{0, 0}, size_});
+            planes[c].convertTo(frame_area, CV_32F);
+            cv::dft(padded, spectra_[c], 0, size_.height);
+        }
+    }
+
+    [[nodiscard]]
+    auto GetSize() const noexcept -> cv::Size
+    {
+        return size_;
+    }
+
+    [[nodiscard]]
+    auto GetDftSize() const noexcept -> cv::Size
+    {
+        return dft_size_;
+    }
+
+    [[nodiscard]]
+    auto GetSpectra() const noexcept -> const std::vector<cv::Mat>&
+    {
+        return spectra_;
+    }
+
+    /// @brief Window statistics for one template size. Thread-safe, cached
+    auto GetWindowStats(cv::Size templ_size, bool with_mean)
+        -> std::shared_ptr<const WindowStats>
+    {
+        const auto key =
+            std::make_tuple(templ_size.width, templ_size.height, with_mean);
+        {
+            std::lock_guard lock{stats_mutex_};
+            if (const auto it = stats_.find(key); it != stats_.end())
+            {
+                return it->second;
+            }
+        }
+
+        const cv::Size result{
+            size_.width - templ_size.width + 1,
+            size_.height - templ_size.height + 1};
+        const double inv_area = 1.0 / templ_size.area();
+
+        auto stats = std::make_shared<WindowStats>();
+        stats->sum2 = cv::Mat::zeros(result, CV_64F);
+        if (with_mean)
+        {
+            stats->mean2 = cv::Mat::zeros(result, CV_64F);
+        }
+        for (size_t c = 0; c < sqsums_.size(); ++c)
+        {
+            stats->sum2 += WindowSum(sqsums_[c], templ_size, result);
+            if (with_mean)
+            {
+                const auto sum = WindowSum(sums_[c], templ_size, result);
+                stats->mean2 += sum.mul(sum) * inv_area;
+            }
+        }
+
+        std::lock_guard lock{stats_mutex_};
+        return stats_.emplace(key, std::move(stats)).first->second;
+    }
+
+private:
+    cv::Size             size_;
+    cv::Size             dft_size_;
+    std::vector<cv::Mat> spectra_;
+    std::vector<cv::Mat> sums_;
+    std::vector<cv::Mat> sqsums_;
+
+    std::mutex stats_mutex_;
+    std::map<std::tuple<int, int, bool>, std::shared_ptr<const WindowStats>>
+        stats_;
+};
+
+/// @brief Same normalization and clamping as cv::matchTemplate
+auto NormalizeScore(
+    double num,
+    double wnd_sum2,
+    double wnd_mean2,
+    double templ_norm,
+    bool   is_sqdiff) -> double
+{
+    const double diff2 = std::max(wnd_sum2 - wnd_mean2, 0.0);
+    const double t = diff2 <= std::min(0.5, 10 * FLT_EPSILON * wnd_sum2)
+                         ? 0.0
+                         : std::sqrt(diff2) * templ_norm;
+    if (std::abs(num) < t)
+    {
+        return num / t;
+    }
+    if (std::abs(num) < t * 1.125)
+    {
+        return num > 0 ? 1.0 : -1.0;
+    }
+    return is_sqdiff ? 1.0 : 0.0;
+}
+
+auto MatchOne(
+    FrameContext&                         frame,
+    IDasPreparedTemplateImpl&             templ,
+    ExportInterface::DasTemplateMatchType type) -> TemplateMatchCandidate
+{
+    const bool is_ccoeff =
+        type == ExportInterface::DAS_TEMPLATE_MATCH_TYPE_CCOEFF_NORMED;
+    const bool is_sqdiff =
+        type == ExportInterface::DAS_TEMPLATE_MATCH_TYPE_SQDIFF_NORMED;
+
+    const auto     templ_size = templ.GetCvSize();
+    const cv::Size result_size{
+        frame.GetSize().width - templ_size.width + 1,
+        frame.GetSize().height - templ_size.height + 1};
+
+    const double templ_sum2 = templ.GetSum2();
+    const double templ_norm =
+        std::sqrt(is_ccoeff ? templ.GetZeroMeanSum2() : templ_sum2);
+    if (is_ccoeff && templ_norm < DBL_EPSILON)
+    {
+        // cv::matchTemplate reports 1 everywhere for a flat template
+        return {1.0f, 1.0f, 0, 0};
+    }
+
+    // Channels add up in the frequency domain, so one inverse DFT suffices.
+    // CCOEFF correlates with the mean-subtracted template, which makes the
+    // window mean drop out of the numerator.
+    const auto& frame_spectra = frame.GetSpectra();
+    const auto  templ_spectra = templ.GetSpectra(frame.GetDftSize(), is_ccoeff);
+    cv::Mat     accumulated;
+    cv::Mat     product;
+    for (size_t c = 0; c < frame_spectra.size(); ++c)
+    {
+        cv::mulSpectrums(
+            frame_spectra[c],
+            (*templ_spectra)[c],
+            product,
+            0,
+            true);
+        if (accumulated.empty())
+        {
+            accumulated = product;
+            product = cv::Mat{};
+        }
+        else
+        {
+            accumulated += product;
+        }
+    }
+    cv::Mat correlation;
+    cv::idft(
+        accumulated,
+        correlation,
+        cv::DFT_REAL_OUTPUT | cv::DFT_SCALE,
+        result_size.height);
+
+    const auto stats = frame.GetWindowStats(templ_size, is_ccoeff);
+
+    TemplateMatchCandidate best{-std::numeric_limits<float>::infinity()};
+    for (int y = 0; y < result_size.height; ++y)
+    {
+        const auto* correlation_row = correlation.ptr<float>(y);
+        const auto* sum2_row = stats->sum2.ptr<double>(y);
+        const auto* mean2_row =
+            is_ccoeff ? stats->mean2.ptr<double>(y) : nullptr;
+        for (int x = 0; x < result_size.width; ++x)
+        {
+            const double wnd_sum2 = sum2_row[x];
+            double       num = correlation_row[x];
+            if (is_sqdiff)
+            {
+                num = wnd_sum2 - 2.0 * num + templ_sum2;
+            }
+
+            const double raw = NormalizeScore(
+                num,
+                wnd_sum2,
+                mean2_row ? mean2_row[x] : 0.0,
+                templ_norm,
+                is_sqdiff);
+            const auto score = static_cast<float>(is_sqdiff ? 1.0 - raw : raw);
+            if (score > best.score)
+            {
+                best = {score, static_cast<float>(raw), x, y};
+            }
+        }
+    }
+    return best;
+}
+
+auto GetMatchPool() -> exec::static_thread_pool&
+{
+    static exec::static_thread_pool pool{static_cast<std::uint32_t>(
+        std::max(1u, std::thread::hardware_concurrency()))};
+    return pool;
+}
+
+DAS_NS_ANONYMOUS_DETAILS_END
+
+// ==================== Prepared templates ====================
+
+auto PrepareTemplateFromMat(
+    const cv::Mat&             templ,
+    IDasPreparedTemplateImpl** pp_out_template) -> DasResult
+{
+    if (templ.empty())
+    {
+        DAS_CORE_LOG_ERROR("PrepareTemplate: template is empty");
+        return DAS_E_INVALID_SIZE;
+    }
+
+    const auto depth = templ.depth();
+    if (depth != CV_8U && depth != CV_32F)
+    {
+        DAS_CORE_LOG_ERROR(
+            "PrepareTemplate: unsupported template depth, depth={}",
+            depth);
+        return DAS_E_INVALID_ARGUMENT;
+    }
+
+    try
+    {
+        *pp_out_template = IDasPreparedTemplateImpl::MakeRaw(templ);
+    }
+    catch (const cv::Exception& ex)
+    {
+        DAS_CORE_LOG_ERROR("PrepareTemplate: OpenCV exception: {}", ex.what());
+        return DAS_E_OPENCV_ERROR;
+    }
+    return DAS_S_OK;
+}
+
+auto CollectPreparedTemplates(
+    ExportInterface::IDasPreparedTemplateSet*      p_templates,
+    std::vector<DasPtr<IDasPreparedTemplateImpl>>& out_templates)
+    -> DasResult
+{
+    uint32_t count{};
+    if (const auto result = p_templates->GetCount(&count);
+        DAS::IsFailed(result))
+    {
+        DAS_CORE_LOG_ERROR("Failed to get prepared template count");
+        return result;
+    }
+
+    out_templates.clear();
+    out_templates.reserve(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        DasPtr<ExportInterface::IDasPreparedTemplate> p_template;
+        if (const auto result = p_templates->GetAt(i, p_template.Put());
+            DAS::IsFailed(result))
+        {
+            DAS_CORE_LOG_ERROR("Failed to get prepared template {}", i);
+            return result;
+        }
+
+        DasPtr<IDasPreparedTemplateImpl> p_impl;
+        if (const auto qi_result = p_template->QueryInterface(
+                DasIidOf<IDasPreparedTemplateImpl>(),
+                p_impl.PutVoid());
+            DAS::IsFailed(qi_result))
+        {
+            DAS_CORE_LOG_ERROR(
+                "Prepared template {} was not created by IDasCv::"
+                "PrepareTemplate",
+                i);
+            return qi_result;
+        }
+        out_templates.push_back(std::move(p_impl));
+    }
+    return DAS_S_OK;
+}
+
+// ==================== MatchPreparedTemplates ====================
+
+auto MatchPreparedTemplates(
+    const cv::Mat&                                       image,
+    ExportInterface::DasImagePixelFormat                 format,
+    const std::vector<DasPtr<IDasPreparedTemplateImpl>>& templates,
+    ExportInterface::DasTemplateMatchType                type,
+    std::vector<TemplateMatchCandidate>&                 out_best)
+    -> DasResult
+{
+    if (!Details::IsNormedMatchType(type))
+    {
+        DAS_CORE_LOG_ERROR(
+            "TemplateMatchBestMulti: unsupported match type {}",
+            static_cast<int>(type));
+        return DAS_E_INVALID_ARGUMENT;
+    }
+
+    if (image.empty())
+    {
+        DAS_CORE_LOG_ERROR("TemplateMatchBestMulti: image is empty");
+        return DAS_E_INVALID_SIZE;
+    }
+
+    bool needs_color = false;
+    bool needs_gray = false;
+    for (size_t i = 0; i < templates.size(); ++i)
+    {
+        const auto& templ = *templates[i];
+        const auto  templ_size = templ.GetCvSize();
+        if (templ_size.width > image.cols || templ_size.height > image.rows)
+        {
+            DAS_CORE_LOG_ERROR(
+                "TemplateMatchBestMulti: template {} larger than image, "
+                "image={}x{}, template={}x{}",
+                i,
+                image.cols,
+                image.rows,
+                templ_size.width,
+                templ_size.height);
+            return DAS_E_INVALID_SIZE;
+        }
+
+        if (templ.GetDepth() != image.depth())
+        {
+            DAS_CORE_LOG_ERROR(
+                "TemplateMatchBestMulti: template {} depth mismatch, "
+                "image_depth={}, template_depth={}",
+                i,
+                image.depth(),
+                templ.GetDepth());
+            return DAS_E_INVALID_ARGUMENT;
+        }
+
+        if (templ.GetChannels() == image.channels())
+        {
+            needs_color = true;
+        }
+        else if (templ.GetChannels() == 1)
+        {
+            needs_gray = true;
+        }
+        else
+        {
+            DAS_CORE_LOG_ERROR(
+                "TemplateMatchBestMulti: template {} channel mismatch, "
+                "image_channels={}, template_channels={}",
+                i,
+                image.channels(),
+                templ.GetChannels());
+            return DAS_E_INVALID_ARGUMENT;
+        }
+    }
+
+    const int gray_code =
+        needs_gray ? Details::GetGrayConversionCode(format, image.channels())
+                   : -1;
+    if (needs_gray && gray_code < 0)
+    {
+        DAS_CORE_LOG_ERROR(
+            "TemplateMatchBestMulti: can not convert pixel format {} to "
+            "grayscale for single-channel templates",
+            static_cast<int>(format));
+        return DAS_E_INVALID_ARGUMENT;
+    }
+
+    // Image-side work happens once here, not once per template
+    std::optional<Details::FrameContext> color_frame;
+    std::optional<Details::FrameContext> gray_frame;
+    try
+    {
+        if (needs_color)
+        {
+            color_frame.emplace(image);
+        }
+        if (needs_gray)
+        {
+            cv::Mat gray;
+            cv::cvtColor(image, gray, gray_code);
+            gray_frame.emplace(gray);
+        }
+    }
+    catch (const cv::Exception& ex)
+    {
+        DAS_CORE_LOG_ERROR(
+            "TemplateMatchBestMulti: OpenCV exception: {}",
+            ex.what());
+        return DAS_E_OPENCV_ERROR;
+    }
+
+    out_best.assign(templates.size(), {});
+    std::vector<DasResult> results(templates.size(), DAS_S_OK);
+
+    // Never throws: failures are reported back through `results`
+    auto match_one = [&](size_t i) noexcept
+    {
+        auto& templ = *templates[i];
+        auto& frame = templ.GetChannels() == image.channels() ? *color_frame
+                                                              : *gray_frame;
+        try
+        {
+            out_best[i] = Details::MatchOne(frame, templ, type);
+        }
+        catch (const cv::Exception& ex)
+        {
+            DAS_CORE_LOG_ERROR(
+                "TemplateMatchBestMulti: template {}: OpenCV exception: {}",
+                i,
+                ex.what());
+            results[i] = DAS_E_OPENCV_ERROR;
+        }
+        catch (const std::bad_alloc&)
+        {
+            results[i] = DAS_E_OUT_OF_MEMORY;
+        }
+    };
+
+    if (templates.size() > 1)
+    {
+        std::latch pooled_done(
+            static_cast<std::ptrdiff_t>(templates.size() - 1));
+        auto scheduler = Details::GetMatchPool().get_scheduler();
+        for (size_t i = 1; i < templates.size(); ++i)
+        {
+            stdexec::start_detached(
+                stdexec::schedule(scheduler)
+                | stdexec::then(
+                    [&match_one, &pooled_done, i]() noexcept
+                    {
+                        match_one(i);
+                        pooled_done.count_down();
+                    }));
+        }
+        // The calling thread takes a share instead of idling
+        match_one(0);
+        pooled_done.wait();
+    }
+    else if (templates.size() == 1)
+    {
+        match_one(0);
+    }
+
+    for (const auto result : results)
+    {
+        if (DAS::IsFailed(result))
+        {
+            return result;
+        }
+    }
+    return DAS_S_OK;
+}
+
+auto MakeMultiTemplateMatchResults(
+    const std::vector<DasPtr<IDasPreparedTemplateImpl>>& templates,
+    const std::vector<TemplateMatchCandidate>&           best)
+    -> ExportInterface::IDasTemplateMatchResults*
+{
+    auto* p_results = IDasTemplateMatchResultsImpl::MakeRaw();
+    p_results->SetRawMatchCount(static_cast<uint32_t>(templates.size()));
+    p_results->Reserve(templates.size());
+
+    for (size_t i = 0; i < templates.size(); ++i)
+    {
+        const auto templ_size = templates[i]->GetCvSize();
+        auto*      p_result = IDasTemplateMatchResultImpl::MakeRaw(
+            best[i].score,
+            ExportInterface::DasRect{
+                best[i].x,
+                best[i].y,
+                templ_size.width,
+                templ_size.height},
+            best[i].raw_score);
+        p_results->AddResult(p_result);
+        p_result->Release();
+    }
+
+    return p_results;
+}
+
+DAS_CORE_OCVWRAPPER_NS_END
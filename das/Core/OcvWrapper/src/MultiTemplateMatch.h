@@ -0,0 +1,61 @@
+#ifndef DAS_CORE_OCVWRAPPER_MULTITEMPLATEMATCH_H
+#define DAS_CORE_OCVWRAPPER_MULTITEMPLATEMATCH_H
+
+#include "IDasPreparedTemplateImpl.h"
+#include "TemplateSearch.h"
+
+#include <das/Core/OcvWrapper/Config.h>
+#include <das/DasPtr.hpp>
+#include <das/_autogen/idl/abi/DasCV.h>
+
+DAS_DISABLE_WARNING_BEGIN
+
+DAS_IGNORE_OPENCV_WARNING
+#include <opencv2/core/mat.hpp>
+
+DAS_DISABLE_WARNING_END
+
+#include <vector>
+
+DAS_CORE_OCVWRAPPER_NS_BEGIN
+
+/// @brief Validate and prepare a template image for TemplateMatchBestMulti
+auto PrepareTemplateFromMat(
+    const cv::Mat&             templ,
+    IDasPreparedTemplateImpl** pp_out_template) -> DasResult;
+
+/// @brief Resolve every entry of a set to the internal implementation
+auto CollectPreparedTemplates(
+    ExportInterface::IDasPreparedTemplateSet*      p_templates,
+    std::vector<DasPtr<IDasPreparedTemplateImpl>>& out_templates)
+    -> DasResult;
+
+/**
+ * @brief Best match of every template against one frame.
+ *
+ * The frame is converted, transformed (DFT) and integrated once per channel
+ * layout; each template then costs one spectrum product and one inverse DFT,
+ * plus window statistics shared by every template of the same size.
+ * Templates are matched in parallel on a shared thread pool. Single-channel
+ * templates are matched against the grayscale frame. Scores follow
+ * cv::matchTemplate for the normalized match types.
+ *
+ * out_best[i] is the best location of templates[i], with unified score.
+ */
+auto MatchPreparedTemplates(
+    const cv::Mat&                                       image,
+    ExportInterface::DasImagePixelFormat                 format,
+    const std::vector<DasPtr<IDasPreparedTemplateImpl>>& templates,
+    ExportInterface::DasTemplateMatchType                type,
+    std::vector<TemplateMatchCandidate>&                 out_best)
+    -> DasResult;
+
+/// @brief Wrap per-template best matches; raw_match_count = template count
+auto MakeMultiTemplateMatchResults(
+    const std::vector<DasPtr<IDasPreparedTemplateImpl>>& templates,
+    const std::vector<TemplateMatchCandidate>&           best)
+    -> ExportInterface::IDasTemplateMatchResults*;
+
+DAS_CORE_OCVWRAPPER_NS_END
+
+#endif // DAS_CORE_OCVWRAPPER_MULTITEMPLATEMATCH_H
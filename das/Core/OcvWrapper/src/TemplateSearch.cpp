@@ -0,0 +1,551 @@
+#include "TemplateSearch.h"
+#include "IDasTemplateMatchResultImpl.h"
+#include "IDasTemplateMatchResultsImpl.h"
+
+#include <das/Core/Logger/Logger.h>
+#include <das/Utils/CommonUtils.hpp>
+
+DAS_DISABLE_WARNING_BEGIN
+
+DAS_IGNORE_OPENCV_WARNING
+#include <opencv2/imgproc.hpp>
+
+DAS_DISABLE_WARNING_END
+
+#include <algorithm>
+#include <unordered_map>
+
+DAS_CORE_OCVWRAPPER_NS_BEGIN
+
+// ==================== Internal helpers ====================
+
+DAS_NS_ANONYMOUS_DETAILS_BEGIN
+
+/// Pyramid levels stop once the template's shorter side would drop below this
+constexpr int kMinPyramidTemplateSide = 8;
+/// Coarse levels accept scores this much lower per level, since downsampling
+/// blurs away the detail that separates a match from its surroundings
+constexpr double kPyramidThresholdSlackPerLevel = 0.1;
+/// Candidates carried from the coarsest level into refinement
+constexpr size_t kMaxPyramidCandidates = 256;
+/// Search radius around a candidate projected onto the next finer level
+constexpr int kPyramidRefineMargin = 2;
+
+auto ComputeIoU(
+    const TemplateMatchCandidate& a,
+    const TemplateMatchCandidate& b,
+    int                           tmpl_w,
+    int                           tmpl_h) -> double
+{
+    const int x1 = std::max(a.x, b.x);
+    const int y1 = std::max(a.y, b.y);
+    const int x2 = std::min(a.x + tmpl_w, b.x + tmpl_w);
+    const int y2 = std::min(a.y + tmpl_h, b.y + tmpl_h);
+
+    const int inter_w = std::max(0, x2 - x1);
+    const int inter_h = std::max(0, y2 - y1);
+    const int inter_area = inter_w * inter_h;
+
+    const int area = tmpl_w * tmpl_h;
+    const int union_area = area + area - inter_area;
+
+    if (union_area <= 0)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(inter_area) / static_cast<double>(union_area);
+}
+
+auto MakeGridKey(int cell_x, int cell_y) -> int64_t
+{
+    return (static_cast<int64_t>(cell_y) << 32)
+           | static_cast<int64_t>(static_cast<uint32_t>(cell_x));
+}
+
+/// @brief Unified score map; NaN (flat template windows) becomes -1
+auto MakeUnifiedScoreMap(
+    const cv::Mat&                        raw_scores,
+    ExportInterface::DasTemplateMatchType type) -> cv::Mat
+{
+    cv::Mat unified;
+    if (type == ExportInterface::DAS_TEMPLATE_MATCH_TYPE_SQDIFF_NORMED)
+    {
+        cv::subtract(cv::Scalar::all(1.0), raw_scores, unified);
+    }
+    else
+    {
+        unified = raw_scores.clone();
+    }
+    cv::patchNaNs(unified, -1.0);
+    return unified;
+}
+
+auto ChoosePyramidLevels(int32_t requested_levels, cv::Size templ_size) -> int
+{
+    const int limit =
+        requested_levels > 0
+            ? std::min(requested_levels, kMaxTemplatePyramidLevels)
+            : kMaxTemplatePyramidLevels;
+    const int min_side = std::min(templ_size.width, templ_size.height);
+
+    int levels = 0;
+    while (levels < limit
+           && (min_side >> (levels + 1)) >= kMinPyramidTemplateSide)
+    {
+        ++levels;
+    }
+    return levels;
+}
+
+auto GetPyramidThreshold(double threshold, int level) -> double
+{
+    return threshold - kPyramidThresholdSlackPerLevel * level;
+}
+
+/// @brief Re-match around a candidate projected from the next coarser level
+auto RefineCandidate(
+    const cv::Mat&                        image,
+    const cv::Mat&                        templ,
+    ExportInterface::DasTemplateMatchType type,
+    const TemplateMatchCandidate&         coarse,
+    TemplateMatchCandidate&               out_refined) -> bool
+{
+    const int x0 = std::max(coarse.x * 2 - kPyramidRefineMargin, 0);
+    const int y0 = std::max(coarse.y * 2 - kPyramidRefineMargin, 0);
+    const int x1 =
+        std::min(coarse.x * 2 + kPyramidRefineMargin + templ.cols, image.cols);
+    const int y1 =
+        std::min(coarse.y * 2 + kPyramidRefineMargin + templ.rows, image.rows);
+    if (x1 - x0 < templ.cols || y1 - y0 < templ.rows)
+    {
+        return false;
+    }
+
+    cv::Mat raw_scores;
+    cv::matchTemplate(
+        image(cv::Rect{x0, y0, x1 - x0, y1 - y0}),
+        templ,
+        raw_scores,
+        DAS::Utils::ToUnderlying(type));
+    const auto unified = MakeUnifiedScoreMap(raw_scores, type);
+
+    double    max_score = 0.0;
+    cv::Point max_location{};
+    cv::minMaxLoc(unified, nullptr, &max_score, nullptr, &max_location);
+
+    out_refined = {
+        static_cast<float>(max_score),
+        raw_scores.at<float>(max_location),
+        x0 + max_location.x,
+        y0 + max_location.y};
+    return true;
+}
+
+/// @brief Coarse-to-fine search of one region; templs[0] is the template
+void SearchPyramid(
+    const cv::Mat&                        image,
+    const std::vector<cv::Mat>&           templs,
+    ExportInterface::DasTemplateMatchType type,
+    double                                threshold,
+    cv::Point                             offset,
+    std::vector<TemplateMatchCandidate>&  out_candidates)
+{
+    const int top = static_cast<int>(templs.size()) - 1;
+
+    std::vector<cv::Mat> images(templs.size());
+    images[0] = image;
+    for (int level = 1; level <= top; ++level)
+    {
+        cv::pyrDown(images[level - 1], images[level]);
+    }
+
+    // Full search only on the coarsest level
+    cv::Mat raw_scores;
+    cv::matchTemplate(
+        images[top],
+        templs[top],
+        raw_scores,
+        DAS::Utils::ToUnderlying(type));
+
+    std::vector<TemplateMatchCandidate> candidates;
+    CollectLocalMaxima(
+        raw_scores,
+        type,
+        GetPyramidThreshold(threshold, top),
+        {0, 0},
+        candidates);
+    candidates = ApplyTemplateNms(
+        std::move(candidates),
+        templs[top].cols,
+        templs[top].rows,
+        kTemplateMatchIouThreshold);
+    if (candidates.size() > kMaxPyramidCandidates)
+    {
+        candidates.resize(kMaxPyramidCandidates);
+    }
+
+    // Refine each survivor level by level in a small window
+    for (int level = top - 1; level >= 0; --level)
+    {
+        const double level_threshold = GetPyramidThreshold(threshold, level);
+
+        std::vector<TemplateMatchCandidate> refined;
+        refined.reserve(candidates.size());
+        for (const auto& coarse : candidates)
+        {
+            TemplateMatchCandidate candidate{};
+            if (RefineCandidate(
+                    images[level],
+                    templs[level],
+                    type,
+                    coarse,
+                    candidate)
+                && candidate.score >= level_threshold)
+            {
+                refined.push_back(candidate);
+            }
+        }
+
+        if (level > 0)
+        {
+            refined = ApplyTemplateNms(
+                std::move(refined),
+                templs[level].cols,
+                templs[level].rows,
+                kTemplateMatchIouThreshold);
+        }
+        candidates = std::move(refined);
+    }
+
+    for (auto& candidate : candidates)
+    {
+        candidate.x += offset.x;
+        candidate.y += offset.y;
+        out_candidates.push_back(candidate);
+    }
+}
+
+DAS_NS_ANONYMOUS_DETAILS_END
+
+// ==================== Scoring / NMS ====================
+
+auto UnifyTemplateScore(
+    float                                 raw_score,
+    ExportInterface::DasTemplateMatchType type) -> float
+{
+    if (type == ExportInterface::DAS_TEMPLATE_MATCH_TYPE_SQDIFF_NORMED)
+    {
+        return 1.0f - raw_score;
+    }
+    return raw_score;
+}
+
+auto ApplyTemplateNms(
+    std::vector<TemplateMatchCandidate> candidates,
+    int                                 tmpl_w,
+    int                                 tmpl_h,
+    double                              iou_threshold)
+    -> std::vector<TemplateMatchCandidate>
+{
+    if (candidates.empty())
+    {
+        return {};
+    }
+
+    std::stable_sort(
+        candidates.begin(),
+        candidates.end(),
+        [](const TemplateMatchCandidate& a, const TemplateMatchCandidate& b)
+        { return a.score > b.score; });
+
+    const int cell_w = std::max(tmpl_w, 1);
+    const int cell_h = std::max(tmpl_h, 1);
+
+    std::vector<TemplateMatchCandidate> result;
+    // Indices into result, bucketed by the grid cell of the box origin
+    std::unordered_map<int64_t, std::vector<size_t>> kept_by_cell;
+
+    for (const auto& candidate : candidates)
+    {
+        const int cell_x = candidate.x / cell_w;
+        const int cell_y = candidate.y / cell_h;
+
+        bool suppressed = false;
+        for (int dy = -1; dy <= 1 && !suppressed; ++dy)
+        {
+            for (int dx = -1; dx <= 1 && !suppressed; ++dx)
+            {
+                const auto it = kept_by_cell.find(
+                    Details::MakeGridKey(cell_x + dx, cell_y + dy));
+                if (it == kept_by_cell.end())
+                {
+                    continue;
+                }
+                for (const auto kept_index : it->second)
+                {
+                    if (Details::ComputeIoU(
+                            result[kept_index],
+                            candidate,
+                            tmpl_w,
+                            tmpl_h)
+                        > iou_threshold)
+                    {
+                        suppressed = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (!suppressed)
+        {
+            kept_by_cell[Details::MakeGridKey(cell_x, cell_y)].push_back(
+                result.size());
+            result.push_back(candidate);
+        }
+    }
+
+    return result;
+}
+
+void CollectThresholdCandidates(
+    const cv::Mat&                        raw_scores,
+    ExportInterface::DasTemplateMatchType type,
+    double                                threshold,
+    std::vector<TemplateMatchCandidate>&  out_candidates)
+{
+    for (int y = 0; y < raw_scores.rows; ++y)
+    {
+        const auto* row = raw_scores.ptr<float>(y);
+        for (int x = 0; x < raw_scores.cols; ++x)
+        {
+            const float raw = row[x];
+            const float unified = UnifyTemplateScore(raw, type);
+
+            if (unified >= threshold)
+            {
+                out_candidates.push_back({unified, raw, x, y});
+            }
+        }
+    }
+}
+
+void CollectLocalMaxima(
+    const cv::Mat&                        raw_scores,
+    ExportInterface::DasTemplateMatchType type,
+    double                                threshold,
+    cv::Point                             offset,
+    std::vector<TemplateMatchCandidate>&  out_candidates)
+{
+    const auto unified = Details::MakeUnifiedScoreMap(raw_scores, type);
+    cv::Mat    dilated;
+    cv::dilate(unified, dilated, cv::Mat{});
+
+    for (int y = 0; y < unified.rows; ++y)
+    {
+        const auto* raw_row = raw_scores.ptr<float>(y);
+        const auto* unified_row = unified.ptr<float>(y);
+        const auto* dilated_row = dilated.ptr<float>(y);
+        for (int x = 0; x < unified.cols; ++x)
+        {
+            const float score = unified_row[x];
+            if (score >= threshold && score >= dilated_row[x])
+            {
+                out_candidates.push_back(
+                    {score, raw_row[x], x + offset.x, y + offset.y});
+            }
+        }
+    }
+}
+
+auto ResolveTemplateSearchRegions(
+    cv::Size                     image_size,
+    cv::Size                     templ_size,
+    const std::vector<cv::Rect>& regions) -> std::vector<cv::Rect>
+{
+    const cv::Rect        image_rect{{0, 0}, image_size};
+    std::vector<cv::Rect> result;
+    if (regions.empty())
+    {
+        result.push_back(image_rect);
+    }
+    for (const auto& region : regions)
+    {
+        const auto clipped = region & image_rect;
+        if (clipped.width < templ_size.width
+            || clipped.height < templ_size.height)
+        {
+            DAS_CORE_LOG_WARN(
+                "Skip search region smaller than template, region=({}, {}, "
+                "{}, {}), template={}x{}",
+                region.x,
+                region.y,
+                region.width,
+                region.height,
+                templ_size.width,
+                templ_size.height);
+            continue;
+        }
+        result.push_back(clipped);
+    }
+
+    return result;
+}
+
+// ==================== SearchTemplate ====================
+
+void SearchTemplate(
+    const cv::Mat&                        image,
+    const cv::Mat&                        templ,
+    ExportInterface::DasTemplateMatchType type,
+    double                                threshold,
+    const TemplateSearchOptions&          options,
+    TemplateSearchOutput&                 out_result)
+{
+    out_result = {};
+
+    const auto regions = ResolveTemplateSearchRegions(
+        image.size(),
+        templ.size(),
+        options.regions);
+
+    const int levels =
+        options.mode == ExportInterface::DAS_TEMPLATE_SEARCH_MODE_PYRAMID
+            ? Details::ChoosePyramidLevels(
+                  options.pyramid_levels,
+                  templ.size())
+            : 0;
+
+    // The template pyramid is shared by every region
+    std::vector<cv::Mat> templs(static_cast<size_t>(levels) + 1);
+    templs[0] = templ;
+    for (int level = 1; level <= levels; ++level)
+    {
+        cv::pyrDown(templs[level - 1], templs[level]);
+    }
+
+    std::vector<TemplateMatchCandidate> candidates;
+    for (const auto& region : regions)
+    {
+        const cv::Mat view = image(region);
+        if (levels > 0)
+        {
+            Details::SearchPyramid(
+                view,
+                templs,
+                type,
+                threshold,
+                region.tl(),
+                candidates);
+            continue;
+        }
+
+        cv::Mat raw_scores;
+        cv::matchTemplate(
+            view,
+            templ,
+            raw_scores,
+            DAS::Utils::ToUnderlying(type));
+        CollectLocalMaxima(
+            raw_scores,
+            type,
+            threshold,
+            region.tl(),
+            candidates);
+    }
+
+    out_result.raw_match_count = static_cast<uint32_t>(candidates.size());
+    out_result.matches = ApplyTemplateNms(
+        std::move(candidates),
+        templ.cols,
+        templ.rows,
+        kTemplateMatchIouThreshold);
+}
+
+auto ReadTemplateSearchOptions(
+    ExportInterface::IDasTemplateSearchConfig* p_config,
+    TemplateSearchOptions&                     out_options) -> DasResult
+{
+    out_options = {};
+    if (p_config == nullptr)
+    {
+        return DAS_S_OK;
+    }
+
+    if (const auto result = p_config->GetMode(&out_options.mode);
+        DAS::IsFailed(result))
+    {
+        DAS_CORE_LOG_ERROR("Failed to get template search mode");
+        return result;
+    }
+    if (!IsValidTemplateSearchMode(out_options.mode))
+    {
+        DAS_CORE_LOG_ERROR(
+            "Unknown template search mode: {}",
+            static_cast<int>(out_options.mode));
+        return DAS_E_INVALID_ARGUMENT;
+    }
+
+    if (const auto result =
+            p_config->GetPyramidLevels(&out_options.pyramid_levels);
+        DAS::IsFailed(result))
+    {
+        DAS_CORE_LOG_ERROR("Failed to get template search pyramid levels");
+        return result;
+    }
+
+    uint32_t region_count{};
+    if (const auto result = p_config->GetSearchRegionCount(&region_count);
+        DAS::IsFailed(result))
+    {
+        DAS_CORE_LOG_ERROR("Failed to get template search region count");
+        return result;
+    }
+
+    out_options.regions.reserve(region_count);
+    for (uint32_t i = 0; i < region_count; ++i)
+    {
+        ExportInterface::DasRect region{};
+        if (const auto result = p_config->GetSearchRegion(i, &region);
+            DAS::IsFailed(result))
+        {
+            DAS_CORE_LOG_ERROR("Failed to get template search region {}", i);
+            return result;
+        }
+        out_options.regions.push_back(ToMat(region));
+    }
+
+    return DAS_S_OK;
+}
+
+auto MakeTemplateMatchResults(
+    std::vector<TemplateMatchCandidate> candidates,
+    uint32_t                            raw_match_count,
+    int                                 tmpl_w,
+    int                                 tmpl_h,
+    int32_t                             max_count)
+    -> ExportInterface::IDasTemplateMatchResults*
+{
+    if (max_count > 0 && static_cast<int32_t>(candidates.size()) > max_count)
+    {
+        candidates.resize(static_cast<size_t>(max_count));
+    }
+
+    auto* p_results = IDasTemplateMatchResultsImpl::MakeRaw();
+    p_results->SetRawMatchCount(raw_match_count);
+    p_results->Reserve(candidates.size());
+
+    for (const auto& cand : candidates)
+    {
+        auto* p_result = IDasTemplateMatchResultImpl::MakeRaw(
+            cand.score,
+            ExportInterface::DasRect{cand.x, cand.y, tmpl_w, tmpl_h},
+            cand.raw_score);
+        p_results->AddResult(p_result);
+        p_result->Release();
+    }
+
+    return p_results;
+}
+
+DAS_CORE_OCVWRAPPER_NS_END
@@ -0,0 +1,150 @@
+#ifndef DAS_CORE_OCVWRAPPER_TEMPLATESEARCH_H
+#define DAS_CORE_OCVWRAPPER_TEMPLATESEARCH_H
+
+#include <das/Core/OcvWrapper/Config.h>
+#include <das/_autogen/idl/abi/DasCV.h>
+
+DAS_DISABLE_WARNING_BEGIN
+
+DAS_IGNORE_OPENCV_WARNING
+#include <opencv2/core/mat.hpp>
+
+DAS_DISABLE_WARNING_END
+
+#include <cstdint>
+#include <vector>
+
+DAS_CORE_OCVWRAPPER_NS_BEGIN
+
+/// @brief Template match candidate in image coordinates
+struct TemplateMatchCandidate
+{
+    float score{};
+    float raw_score{};
+    int   x{};
+    int   y{};
+};
+
+/// @brief IoU threshold used by every multi-result template match
+constexpr double kTemplateMatchIouThreshold = 0.5;
+
+/// @brief Upper bound of IDasTemplateSearchConfig pyramid levels
+constexpr int32_t kMaxTemplatePyramidLevels = 4;
+
+/// @brief Unify template match scores to 0..1 (higher is better)
+auto UnifyTemplateScore(
+    float                                 raw_score,
+    ExportInterface::DasTemplateMatchType type) -> float;
+
+/**
+ * @brief Greedy NMS: sort by score descending, suppress overlapping candidates
+ *
+ * All candidates share the template size, so two boxes can only overlap when
+ * their origins are less than one template apart. Kept boxes are bucketed
+ * into a template-sized grid and each candidate is only compared against the
+ * 3x3 neighbouring cells, which gives the same result as the all-pairs scan
+ * in roughly linear time.
+ */
+auto ApplyTemplateNms(
+    std::vector<TemplateMatchCandidate> candidates,
+    int                                 tmpl_w,
+    int                                 tmpl_h,
+    double                              iou_threshold)
+    -> std::vector<TemplateMatchCandidate>;
+
+/**
+ * @brief Collect every position of a matchTemplate score map whose unified
+ * score is >= threshold.
+ *
+ * This is the candidate set TemplateMatchAll has always reported as
+ * raw_match_count.
+ */
+void CollectThresholdCandidates(
+    const cv::Mat&                        raw_scores,
+    ExportInterface::DasTemplateMatchType type,
+    double                                threshold,
+    std::vector<TemplateMatchCandidate>&  out_candidates);
+
+/**
+ * @brief Collect the 3x3 local maxima of a matchTemplate score map whose
+ * unified score is >= threshold, shifted by offset.
+ */
+void CollectLocalMaxima(
+    const cv::Mat&                        raw_scores,
+    ExportInterface::DasTemplateMatchType type,
+    double                                threshold,
+    cv::Point                             offset,
+    std::vector<TemplateMatchCandidate>&  out_candidates);
+
+/**
+ * @brief Clamp search regions to the image and drop ones smaller than the
+ * template; no regions means the whole image.
+ */
+auto ResolveTemplateSearchRegions(
+    cv::Size                     image_size,
+    cv::Size                     templ_size,
+    const std::vector<cv::Rect>& regions) -> std::vector<cv::Rect>;
+
+inline auto IsValidTemplateSearchMode(
+    ExportInterface::DasTemplateSearchMode mode) -> bool
+{
+    return mode == ExportInterface::DAS_TEMPLATE_SEARCH_MODE_FULL
+           || mode == ExportInterface::DAS_TEMPLATE_SEARCH_MODE_PYRAMID;
+}
+
+/// @brief Search parameters read from IDasTemplateSearchConfig
+struct TemplateSearchOptions
+{
+    ExportInterface::DasTemplateSearchMode mode{
+        ExportInterface::DAS_TEMPLATE_SEARCH_MODE_FULL};
+    /// 0 = choose from the template size
+    int32_t               pyramid_levels{};
+    std::vector<cv::Rect> regions;
+};
+
+struct TemplateSearchOutput
+{
+    /// Sorted by score descending, after NMS, not truncated
+    std::vector<TemplateMatchCandidate> matches;
+    /// Local maxima >= threshold before NMS
+    uint32_t raw_match_count{};
+};
+
+/**
+ * @brief Multi-result template search over search regions, optionally
+ * coarse-to-fine through an image pyramid.
+ *
+ * Candidates are local maxima of the score map instead of every pixel above
+ * threshold. Regions are clamped to the image; ones smaller than the template
+ * are skipped, and an empty region list searches the whole image.
+ * @note Inputs must already have passed ValidateTemplateMatchInputs. OpenCV
+ * errors are reported as cv::Exception.
+ */
+void SearchTemplate(
+    const cv::Mat&                        image,
+    const cv::Mat&                        templ,
+    ExportInterface::DasTemplateMatchType type,
+    double                                threshold,
+    const TemplateSearchOptions&          options,
+    TemplateSearchOutput&                 out_result);
+
+/// @brief Read mode/levels/regions from a config; nullptr means FULL mode
+auto ReadTemplateSearchOptions(
+    ExportInterface::IDasTemplateSearchConfig* p_config,
+    TemplateSearchOptions&                     out_options) -> DasResult;
+
+/**
+ * @brief Truncate to max_count (when > 0) and wrap candidates into an
+ * IDasTemplateMatchResults with one reference held by the caller.
+ */
+auto MakeTemplateMatchResults(
+    std::vector<TemplateMatchCandidate> candidates,
+    uint32_t                            raw_match_count,
+    int                                 tmpl_w,
+    int                                 tmpl_h,
+    int32_t                             max_count)
+    -> ExportInterface::IDasTemplateMatchResults*;
+
+DAS_CORE_OCVWRAPPER_NS_END
+
+#endif // DAS_CORE_OCVWRAPPER_TEMPLATESEARCH_H
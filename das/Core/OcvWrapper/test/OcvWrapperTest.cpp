@@ -7,6 +7,7 @@
 #include "../src/CvCpuImpl.h"
 #include "../src/IDasTemplateMatchResultImpl.h"
 #include "../src/IDasTemplateMatchResultsImpl.h"
+#include "../src/TemplateSearch.h"
 
 #include <das/DasApi.h>
 #include <das/DasPtr.hpp>
@@ -19,12 +20,14 @@
 #include <opencv2/core/cuda.hpp>
 #endif
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <random>
 #include <utility>
 #include <vector>
 
@@ -60,6 +63,20 @@ namespace Das
                     fmt);
             }
 
+            //
+            // Helper: blurred noise — distinctive everywhere, yet smooth
+            // enough to survive pyrDown
+            //
+            auto MakeBlurredNoise(int h, int w) -> cv::Mat
+            {
+                cv::Mat noise(h, w, CV_8UC3);
+                cv::RNG rng{20240611};
+                rng.fill(noise, cv::RNG::UNIFORM, 0, 256);
+                cv::GaussianBlur(noise, noise, cv::Size{0, 0}, 3.0);
+                cv::normalize(noise, noise, 0, 255, cv::NORM_MINMAX);
+                return noise;
+            }
+
         } // unnamed namespace
 
         // ==================== IImageBackend QI ====================
@@ -391,6 +408,417 @@ namespace Das
             tmpl->Release();
         }
 
+        // ==================== TemplateMatchAllWithConfig ====================
+
+        class TemplateSearchTest : public TemplateMatchAllTest
+        {
+        protected:
+            static constexpr int kPatternX = 152;
+            static constexpr int kPatternY = 88;
+
+            void SetUp() override
+            {
+                TemplateMatchAllTest::SetUp();
+
+                const auto noise = MakeBlurredNoise(240, 320);
+
+                image_ = CpuImageImpl<Storage::OwningStorage>::MakeFromCpuMat(
+                    noise.clone(),
+                    DAS::ExportInterface::DAS_PIXEL_FORMAT_BGR);
+                templ_ = CpuImageImpl<Storage::OwningStorage>::MakeFromCpuMat(
+                    noise(cv::Rect{kPatternX, kPatternY, 48, 40}).clone(),
+                    DAS::ExportInterface::DAS_PIXEL_FORMAT_BGR);
+            }
+
+            void TearDown() override
+            {
+                image_->Release();
+                templ_->Release();
+                TemplateMatchAllTest::TearDown();
+            }
+
+            auto MakeConfig(
+                DAS::ExportInterface::DasTemplateSearchMode mode,
+                int32_t pyramid_levels = 0)
+                -> DasPtr<DAS::ExportInterface::IDasTemplateSearchConfig>
+            {
+                DasPtr<DAS::ExportInterface::IDasTemplateSearchConfig> config;
+                EXPECT_EQ(
+                    impl_->CreateTemplateSearchConfig(
+                        mode,
+                        pyramid_levels,
+                        config.Put()),
+                    DAS_S_OK);
+                return config;
+            }
+
+            auto Search(DAS::ExportInterface::IDasTemplateSearchConfig* config)
+                -> DasPtr<DAS::ExportInterface::IDasTemplateMatchResults>
+            {
+                DasPtr<DAS::ExportInterface::IDasTemplateMatchResults> results;
+                EXPECT_EQ(
+                    impl_->TemplateMatchAllWithConfig(
+                        image_,
+                        templ_,
+                        DAS::ExportInterface::
+                            DAS_TEMPLATE_MATCH_TYPE_CCOEFF_NORMED,
+                        0.9,
+                        5,
+                        config,
+                        results.Put()),
+                    DAS_S_OK);
+                return results;
+            }
+
+            static void ExpectBestAtPattern(
+                DAS::ExportInterface::IDasTemplateMatchResults* results)
+            {
+                ASSERT_NE(results, nullptr);
+                uint32_t count = 0;
+                ASSERT_EQ(results->GetCount(&count), DAS_S_OK);
+                ASSERT_GE(count, 1u);
+
+                DasPtr<DAS::ExportInterface::IDasTemplateMatchResult> best;
+                ASSERT_EQ(results->GetAt(0, best.Put()), DAS_S_OK);
+                DAS::ExportInterface::DasRect rect{};
+                double                        score = 0.0;
+                ASSERT_EQ(best->Getmatch_rect(&rect), DAS_S_OK);
+                ASSERT_EQ(best->Getscore(&score), DAS_S_OK);
+                EXPECT_EQ(rect.x, kPatternX);
+                EXPECT_EQ(rect.y, kPatternY);
+                EXPECT_EQ(rect.width, 48);
+                EXPECT_EQ(rect.height, 40);
+                EXPECT_GT(score, 0.99);
+            }
+
+            CpuImageImpl<Storage::OwningStorage>* image_ = nullptr;
+            CpuImageImpl<Storage::OwningStorage>* templ_ = nullptr;
+        };
+
+        TEST_F(TemplateSearchTest, null_config_searches_full_image)
+        {
+            auto results = Search(nullptr);
+            ExpectBestAtPattern(results.Get());
+
+            // Local maxima instead of every thresholded pixel
+            uint32_t raw = 0;
+            ASSERT_EQ(results->GetRawMatchCount(&raw), DAS_S_OK);
+            EXPECT_LT(raw, 10u);
+        }
+
+        TEST_F(TemplateSearchTest, pyramid_finds_planted_pattern)
+        {
+            auto config = MakeConfig(
+                DAS::ExportInterface::DAS_TEMPLATE_SEARCH_MODE_PYRAMID);
+            auto results = Search(config.Get());
+            ExpectBestAtPattern(results.Get());
+        }
+
+        TEST_F(TemplateSearchTest, search_regions_restrict_and_offset)
+        {
+            auto config =
+                MakeConfig(DAS::ExportInterface::DAS_TEMPLATE_SEARCH_MODE_FULL);
+            const DAS::ExportInterface::DasRect miss{0, 0, 120, 120};
+            ASSERT_EQ(config->AddSearchRegion(&miss), DAS_S_OK);
+
+            auto     results = Search(config.Get());
+            uint32_t count = 0;
+            ASSERT_EQ(results->GetCount(&count), DAS_S_OK);
+            EXPECT_EQ(count, 0u);
+
+            // A region hanging off the image is clamped, not rejected
+            const DAS::ExportInterface::DasRect hit{140, 80, 400, 400};
+            ASSERT_EQ(config->AddSearchRegion(&hit), DAS_S_OK);
+            results = Search(config.Get());
+            ExpectBestAtPattern(results.Get());
+        }
+
+        TEST_F(TemplateSearchTest, invalid_config_arguments)
+        {
+            DasPtr<DAS::ExportInterface::IDasTemplateSearchConfig> config;
+            EXPECT_EQ(
+                impl_->CreateTemplateSearchConfig(
+                    DAS::ExportInterface::DAS_TEMPLATE_SEARCH_MODE_PYRAMID,
+                    kMaxTemplatePyramidLevels + 1,
+                    config.Put()),
+                DAS_E_INVALID_ARGUMENT);
+
+            config =
+                MakeConfig(DAS::ExportInterface::DAS_TEMPLATE_SEARCH_MODE_FULL);
+            const DAS::ExportInterface::DasRect empty{10, 10, 0, 5};
+            EXPECT_EQ(config->AddSearchRegion(&empty), DAS_E_INVALID_ARGUMENT);
+            EXPECT_EQ(config->AddSearchRegion(nullptr), DAS_E_INVALID_POINTER);
+        }
+
+        TEST(TemplateNmsTest, grid_nms_matches_all_pairs_nms)
+        {
+            constexpr int tmpl_w = 12;
+            constexpr int tmpl_h = 9;
+
+            std::mt19937                          rng{7};
+            std::uniform_int_distribution<int>    position{0, 200};
+            std::uniform_real_distribution<float> score{0.0f, 1.0f};
+            std::vector<TemplateMatchCandidate>   candidates(2000);
+            for (auto& candidate : candidates)
+            {
+                candidate = {score(rng), 0.0f, position(rng), position(rng)};
+            }
+
+            auto expected = candidates;
+            std::stable_sort(
+                expected.begin(),
+                expected.end(),
+                [](const auto& a, const auto& b) { return a.score > b.score; });
+            std::vector<TemplateMatchCandidate> reference;
+            for (const auto& candidate : expected)
+            {
+                const auto overlaps = [&](const TemplateMatchCandidate& kept)
+                {
+                    const int inter_w = std::max(
+                        0,
+                        std::min(kept.x, candidate.x) + tmpl_w
+                            - std::max(kept.x, candidate.x));
+                    const int inter_h = std::max(
+                        0,
+                        std::min(kept.y, candidate.y) + tmpl_h
+                            - std::max(kept.y, candidate.y));
+                    const int inter = inter_w * inter_h;
+                    return static_cast<double>(inter)
+                               / (2 * tmpl_w * tmpl_h - inter)
+                           > kTemplateMatchIouThreshold;
+                };
+                if (std::none_of(reference.begin(), reference.end(), overlaps))
+                {
+                    reference.push_back(candidate);
+                }
+            }
+
+            const auto actual = ApplyTemplateNms(
+                candidates,
+                tmpl_w,
+                tmpl_h,
+                kTemplateMatchIouThreshold);
+            ASSERT_EQ(actual.size(), reference.size());
+            for (size_t i = 0; i < actual.size(); ++i)
+            {
+                EXPECT_EQ(actual[i].x, reference[i].x);
+                EXPECT_EQ(actual[i].y, reference[i].y);
+            }
+        }
+
+        // ==================== TemplateMatchBestMulti ====================
+
+        class TemplateMatchBestMultiTest : public TemplateMatchAllTest
+        {
+        protected:
+            // Two templates share a size so window statistics are reused
+            static constexpr std::array<cv::Rect, 4> kCrops{
+                cv::Rect{152, 88, 48, 40},
+                cv::Rect{20, 30, 32, 32},
+                cv::Rect{250, 170, 64, 48},
+                cv::Rect{200, 12, 32, 32}};
+
+            void SetUp() override
+            {
+                TemplateMatchAllTest::SetUp();
+
+                noise_ = MakeBlurredNoise(240, 320);
+                image_ = CpuImageImpl<Storage::OwningStorage>::MakeFromCpuMat(
+                    noise_.clone(),
+                    DAS::ExportInterface::DAS_PIXEL_FORMAT_BGR);
+                ASSERT_EQ(
+                    impl_->CreatePreparedTemplateSet(set_.Put()),
+                    DAS_S_OK);
+            }
+
+            void TearDown() override
+            {
+                image_->Release();
+                TemplateMatchAllTest::TearDown();
+            }
+
+            static auto MakeImage(const cv::Mat& mat)
+                -> DasPtr<DAS::ExportInterface::IDasImage>
+            {
+                const auto format =
+                    mat.channels() == 1
+                        ? DAS::ExportInterface::DAS_PIXEL_FORMAT_GRAY
+                        : DAS::ExportInterface::DAS_PIXEL_FORMAT_BGR;
+                return DasPtr<DAS::ExportInterface::IDasImage>::Attach(
+                    CpuImageImpl<Storage::OwningStorage>::MakeFromCpuMat(
+                        mat.clone(),
+                        format));
+            }
+
+            void AddTemplate(const cv::Mat& mat)
+            {
+                auto templ = MakeImage(mat);
+                DasPtr<DAS::ExportInterface::IDasPreparedTemplate> prepared;
+                ASSERT_EQ(
+                    impl_->PrepareTemplate(templ.Get(), prepared.Put()),
+                    DAS_S_OK);
+                ASSERT_EQ(set_->Add(prepared.Get()), DAS_S_OK);
+            }
+
+            auto Match(DAS::ExportInterface::DasTemplateMatchType type)
+                -> DasPtr<DAS::ExportInterface::IDasTemplateMatchResults>
+            {
+                DasPtr<DAS::ExportInterface::IDasTemplateMatchResults> results;
+                EXPECT_EQ(
+                    impl_->TemplateMatchBestMulti(
+                        image_,
+                        set_.Get(),
+                        type,
+                        results.Put()),
+                    DAS_S_OK);
+                return results;
+            }
+
+            static void ExpectMatchAt(
+                DAS::ExportInterface::IDasTemplateMatchResults* results,
+                uint32_t                                        index,
+                const cv::Rect&                                 crop)
+            {
+                ASSERT_NE(results, nullptr);
+                DasPtr<DAS::ExportInterface::IDasTemplateMatchResult> match;
+                ASSERT_EQ(results->GetAt(index, match.Put()), DAS_S_OK);
+                DAS::ExportInterface::DasRect rect{};
+                double                        score = 0.0;
+                ASSERT_EQ(match->Getmatch_rect(&rect), DAS_S_OK);
+                ASSERT_EQ(match->Getscore(&score), DAS_S_OK);
+                EXPECT_EQ(rect.x, crop.x);
+                EXPECT_EQ(rect.y, crop.y);
+                EXPECT_EQ(rect.width, crop.width);
+                EXPECT_EQ(rect.height, crop.height);
+                EXPECT_GT(score, 0.99);
+            }
+
+            cv::Mat                               noise_;
+            CpuImageImpl<Storage::OwningStorage>* image_ = nullptr;
+            DasPtr<DAS::ExportInterface::IDasPreparedTemplateSet> set_;
+        };
+
+        TEST_F(TemplateMatchBestMultiTest, result_order_follows_template_set)
+        {
+            for (const auto& crop : kCrops)
+            {
+                AddTemplate(noise_(crop));
+            }
+
+            auto results = Match(
+                DAS::ExportInterface::DAS_TEMPLATE_MATCH_TYPE_CCOEFF_NORMED);
+            uint32_t count = 0;
+            uint32_t raw = 0;
+            ASSERT_EQ(results->GetCount(&count), DAS_S_OK);
+            ASSERT_EQ(results->GetRawMatchCount(&raw), DAS_S_OK);
+            ASSERT_EQ(count, kCrops.size());
+            EXPECT_EQ(raw, kCrops.size());
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                ExpectMatchAt(results.Get(), i, kCrops[i]);
+            }
+        }
+
+        TEST_F(TemplateMatchBestMultiTest, agrees_with_template_match_best)
+        {
+            const std::array types{
+                DAS::ExportInterface::DAS_TEMPLATE_MATCH_TYPE_SQDIFF_NORMED,
+                DAS::ExportInterface::DAS_TEMPLATE_MATCH_TYPE_CCORR_NORMED,
+                DAS::ExportInterface::DAS_TEMPLATE_MATCH_TYPE_CCOEFF_NORMED};
+
+            for (const auto& crop : kCrops)
+            {
+                AddTemplate(noise_(crop));
+            }
+
+            for (const auto type : types)
+            {
+                auto results = Match(type);
+                ASSERT_NE(results.Get(), nullptr);
+                for (uint32_t i = 0; i < kCrops.size(); ++i)
+                {
+                    auto templ = MakeImage(noise_(kCrops[i]));
+                    DasPtr<DAS::ExportInterface::IDasTemplateMatchResult>
+                        expected;
+                    ASSERT_EQ(
+                        impl_->TemplateMatchBest(
+                            image_,
+                            templ.Get(),
+                            type,
+                            expected.Put()),
+                        DAS_S_OK);
+                    DasPtr<DAS::ExportInterface::IDasTemplateMatchResult>
+                        actual;
+                    ASSERT_EQ(results->GetAt(i, actual.Put()), DAS_S_OK);
+
+                    DAS::ExportInterface::DasRect expected_rect{};
+                    DAS::ExportInterface::DasRect actual_rect{};
+                    double                        expected_score = 0.0;
+                    double                        actual_score = 0.0;
+                    ASSERT_EQ(
+                        expected->Getmatch_rect(&expected_rect),
+                        DAS_S_OK);
+                    ASSERT_EQ(actual->Getmatch_rect(&actual_rect), DAS_S_OK);
+                    ASSERT_EQ(expected->Getscore(&expected_score), DAS_S_OK);
+                    ASSERT_EQ(actual->Getscore(&actual_score), DAS_S_OK);
+                    EXPECT_EQ(actual_rect.x, expected_rect.x);
+                    EXPECT_EQ(actual_rect.y, expected_rect.y);
+                    EXPECT_NEAR(actual_score, expected_score, 1e-3);
+                }
+            }
+        }
+
+        TEST_F(TemplateMatchBestMultiTest, gray_template_matches_color_frame)
+        {
+            cv::Mat gray;
+            cv::cvtColor(noise_(kCrops[0]), gray, cv::COLOR_BGR2GRAY);
+            AddTemplate(gray);
+            AddTemplate(noise_(kCrops[1]));
+
+            auto results = Match(
+                DAS::ExportInterface::DAS_TEMPLATE_MATCH_TYPE_CCOEFF_NORMED);
+            ExpectMatchAt(results.Get(), 0, kCrops[0]);
+            ExpectMatchAt(results.Get(), 1, kCrops[1]);
+        }
+
+        TEST_F(TemplateMatchBestMultiTest, empty_set_returns_no_results)
+        {
+            auto results = Match(
+                DAS::ExportInterface::DAS_TEMPLATE_MATCH_TYPE_CCOEFF_NORMED);
+            ASSERT_NE(results.Get(), nullptr);
+            uint32_t count = 0;
+            ASSERT_EQ(results->GetCount(&count), DAS_S_OK);
+            EXPECT_EQ(count, 0u);
+        }
+
+        TEST_F(TemplateMatchBestMultiTest, invalid_arguments)
+        {
+            DasPtr<DAS::ExportInterface::IDasTemplateMatchResults> results;
+            EXPECT_EQ(
+                impl_->TemplateMatchBestMulti(
+                    image_,
+                    nullptr,
+                    DAS::ExportInterface::DAS_TEMPLATE_MATCH_TYPE_CCOEFF_NORMED,
+                    results.Put()),
+                DAS_E_INVALID_POINTER);
+
+            DasPtr<DAS::ExportInterface::IDasPreparedTemplate> prepared;
+            EXPECT_EQ(
+                impl_->PrepareTemplate(nullptr, prepared.Put()),
+                DAS_E_INVALID_POINTER);
+
+            // A template larger than the frame fails the whole call
+            AddTemplate(noise_(kCrops[0]));
+            AddTemplate(MakeBlurredNoise(300, 400));
+            EXPECT_EQ(
+                impl_->TemplateMatchBestMulti(
+                    image_,
+                    set_.Get(),
+                    DAS::ExportInterface::DAS_TEMPLATE_MATCH_TYPE_CCOEFF_NORMED,
+                    results.Put()),
+                DAS_E_INVALID_SIZE);
+        }
+
         // ==================== IDasTemplateMatchResults ====================
 
         TEST(ResultsImplTest, default_has_zero_count)
@@ -1,6 +1,7 @@
 #include "AiCpuImpl.h"
 #include "IDasSessionImpl.h"
 #include "IDasTensorImpl.h"
+#include "OrtSessionCache.h"
 #include "PaddleOcrImpl.h"
 
 #include <das/Core/Debug/DebugDecorators.h>
@@ -15,30 +16,32 @@
 DAS_CORE_ORTWRAPPER_NS_BEGIN
 
 DasResult AiCpuImpl::CreateSession(
-    IDasReadOnlyString* model_path,
-    ExportInterface::IDasJson* /*options*/,
+    IDasReadOnlyString*            model_path,
+    ExportInterface::IDasJson*     options,
     ExportInterface::IDasSession** pp_session)
 {
     DAS_UTILS_CHECK_POINTER(pp_session);
     DAS_UTILS_CHECK_POINTER(model_path);
 
+    OrtSessionOptions session_options;
+    if (const auto parse_result =
+            ParseOrtSessionOptions(options, session_options);
+        DAS::IsFailed(parse_result))
+    {
+        return parse_result;
+    }
+
     try
     {
-        // DasReadOnlyString by-value parameter holds a DasPtr reference count
-        // that keeps the underlying UTF-16 buffer alive through the borrow
-        // scope
         DasReadOnlyString model_path_string(model_path);
 
-        Ort::SessionOptions session_options;
-        session_options.SetIntraOpNumThreads(1);
-        session_options.SetGraphOptimizationLevel(
-            GraphOptimizationLevel::ORT_ENABLE_ALL);
-
-        // CPU EP is default — no explicit provider registration needed
-        auto session = Ort::Session(
-            GetEnv(),
-            BorrowOrtPath(model_path_string),
-            session_options);
+        // CPU EP is default — no explicit provider registration needed.
+        // Sessions are shared process-wide, so repeated CreateOcr calls for
+        // the same models reuse the already loaded and optimized graphs.
+        auto session = AcquireOrtSession(
+            ToModelPath(model_path_string),
+            session_options,
+            "cpu");
 
         auto* impl = new IDasSessionImpl(std::move(session));
         impl->AddRef();
@@ -54,6 +57,15 @@ DasResult AiCpuImpl::CreateSession(
             e.what());
         return DAS_E_ONNX_RUNTIME_ERROR;
     }
+    catch (const std::filesystem::filesystem_error& e)
+    {
+        DasReadOnlyString path_wrapper(model_path);
+        DAS_CORE_LOG_ERROR(
+            "CreateSession failed: model_path={}, error={}",
+            path_wrapper.GetUtf8(),
+            e.what());
+        return DAS_E_FILE_NOT_FOUND;
+    }
     catch (const std::bad_alloc&)
     {
         return DAS_E_OUT_OF_MEMORY;
@@ -2,6 +2,7 @@
 #include "AiCpuImpl.h"
 #include "IDasSessionImpl.h"
 #include "IDasTensorImpl.h"
+#include "OrtSessionCache.h"
 
 #include <das/Core/Logger/Logger.h>
 #include <das/DasPtr.hpp>
@@ -13,34 +14,36 @@
 DAS_CORE_ORTWRAPPER_NS_BEGIN
 
 DasResult AiCudaImpl::CreateSession(
-    IDasReadOnlyString* model_path,
-    ExportInterface::IDasJson* /*options*/,
+    IDasReadOnlyString*            model_path,
+    ExportInterface::IDasJson*     options,
     ExportInterface::IDasSession** pp_session)
 {
     DAS_UTILS_CHECK_POINTER(pp_session);
     DAS_UTILS_CHECK_POINTER(model_path);
 
+    OrtSessionOptions session_options;
+    if (const auto parse_result =
+            ParseOrtSessionOptions(options, session_options);
+        DAS::IsFailed(parse_result))
+    {
+        return parse_result;
+    }
+
     try
     {
-        // DasReadOnlyString by-value parameter holds a DasPtr reference count
-        // that keeps the underlying UTF-16 buffer alive through the borrow
-        // scope
         DasReadOnlyString model_path_string(model_path);
 
-        Ort::SessionOptions session_options;
-        session_options.SetIntraOpNumThreads(1);
-        session_options.SetGraphOptimizationLevel(
-            GraphOptimizationLevel::ORT_ENABLE_ALL);
-
         // Register CUDA execution provider
-        OrtCUDAProviderOptions cuda_opts;
-        cuda_opts.device_id = 0;
-        session_options.AppendExecutionProvider_CUDA(cuda_opts);
-
-        auto session = Ort::Session(
-            GetEnv(),
-            BorrowOrtPath(model_path_string),
-            session_options);
+        auto session = AcquireOrtSession(
+            ToModelPath(model_path_string),
+            session_options,
+            "cuda:0",
+            [](Ort::SessionOptions& ort_options)
+            {
+                OrtCUDAProviderOptions cuda_opts;
+                cuda_opts.device_id = 0;
+                ort_options.AppendExecutionProvider_CUDA(cuda_opts);
+            });
 
         auto* impl = new IDasSessionImpl(std::move(session));
         impl->AddRef();
@@ -56,6 +59,15 @@ DasResult AiCudaImpl::CreateSession(
             e.what());
         return DAS_E_ONNX_RUNTIME_ERROR;
     }
+    catch (const std::filesystem::filesystem_error& e)
+    {
+        DasReadOnlyString path_wrapper(model_path);
+        DAS_CORE_LOG_ERROR(
+            "CreateSession (CUDA EP) failed: model_path={}, error={}",
+            path_wrapper.GetUtf8(),
+            e.what());
+        return DAS_E_FILE_NOT_FOUND;
+    }
     catch (const std::bad_alloc&)
     {
         return DAS_E_OUT_OF_MEMORY;
@@ -11,7 +11,9 @@
 #include <boost/predef/os.h>
 #include <das/DasString.hpp>
 
+#include <filesystem>
 #include <string>
+#include <string_view>
 
 #if BOOST_OS_WINDOWS
 static_assert(
@@ -43,6 +45,15 @@ inline const char* BorrowOrtPath(DasReadOnlyString string)
 }
 #endif
 
+/// Converts a model path to std::filesystem::path from its UTF-8 form, so
+/// non-ASCII paths never round-trip through the ANSI code page on Windows.
+inline std::filesystem::path ToModelPath(DasReadOnlyString string)
+{
+    const char* utf8 = string.GetUtf8();
+    return std::filesystem::path{
+        std::u8string_view{reinterpret_cast<const char8_t*>(utf8)}};
+}
+
 class DasOrt
 {
 protected:
@@ -8,20 +8,25 @@
 DAS_CORE_ORTWRAPPER_NS_BEGIN
 
 IDasSessionImpl::IDasSessionImpl(Ort::Session session)
+    : IDasSessionImpl(std::make_shared<Ort::Session>(std::move(session)))
+{
+}
+
+IDasSessionImpl::IDasSessionImpl(std::shared_ptr<Ort::Session> session)
     : session_{std::move(session)}
 {
     // Discover input/output names at construction time (Pitfall 2)
-    auto num_inputs = session_.GetInputCount();
+    auto num_inputs = session_->GetInputCount();
     for (size_t i = 0; i < num_inputs; ++i)
     {
-        auto name = session_.GetInputNameAllocated(i, allocator_);
+        auto name = session_->GetInputNameAllocated(i, allocator_);
         input_names_.push_back(name.get());
     }
 
-    auto num_outputs = session_.GetOutputCount();
+    auto num_outputs = session_->GetOutputCount();
     for (size_t i = 0; i < num_outputs; ++i)
     {
-        auto name = session_.GetOutputNameAllocated(i, allocator_);
+        auto name = session_->GetOutputNameAllocated(i, allocator_);
         output_names_.push_back(name.get());
     }
 }
@@ -79,7 +84,7 @@ DasResult IDasSessionImpl::Run(
         }
 
         // Use IoBinding to pass tensor references without copying
-        Ort::IoBinding io_binding{session_};
+        Ort::IoBinding io_binding{*session_};
 
         // Bind inputs
         for (uint32_t i = 0; i < input_count; ++i)
@@ -171,7 +176,7 @@ DasResult IDasSessionImpl::Run(
         }
 
         // Run inference
-        session_.Run(Ort::RunOptions{nullptr}, io_binding);
+        session_->Run(Ort::RunOptions{nullptr}, io_binding);
 
         // Retrieve outputs
         auto outputs = io_binding.GetOutputValues();
@@ -5,6 +5,7 @@
 #include "IDasTensorVectorImpl.h"
 
 #include <das/_autogen/idl/wrapper/Das.ExportInterface.IDasSession.Implements.hpp>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -29,13 +30,17 @@ DAS_CORE_ORTWRAPPER_NS_BEGIN
 class IDasSessionImpl final
     : public Das::ExportInterface::DasSessionImplBase<IDasSessionImpl>
 {
-    Ort::Session                     session_;
+    std::shared_ptr<Ort::Session>    session_;
     Ort::AllocatorWithDefaultOptions allocator_;
     std::vector<std::string>         input_names_;
     std::vector<std::string>         output_names_;
 
 public:
     explicit IDasSessionImpl(Ort::Session session);
+    /// Wraps a session that may be shared with other IDasSession objects
+    /// (see AcquireOrtSession). Ort::Session::Run is safe to call
+    /// concurrently, so no extra locking is needed here.
+    explicit IDasSessionImpl(std::shared_ptr<Ort::Session> session);
 
     DAS_IMPL Run(
         ExportInterface::IDasReadOnlyStringVector* input_names,
@@ -1,4 +1,5 @@
 #include "IDasTensorImpl.h"
+#include "TensorPreprocess.h"
 
 #include <das/Core/Logger/Logger.h>
 #include <das/DasApi.h>
@@ -511,27 +512,24 @@ DasResult CreateFloatTensorBackingBufferFromImage(
     }
     backing.shape = tensor_shape;
 
-    auto* const float_data = backing.data;
-    const auto  height = static_cast<uint64_t>(tensor_shape[2]);
-    const auto  width = static_cast<uint64_t>(tensor_shape[3]);
-    for (uint64_t h = 0; h < height; ++h)
-    {
-        for (uint64_t w = 0; w < width; ++w)
-        {
-            const auto pixel_idx = h * width + w;
-            for (uint32_t c = 0; c < tensor_channel_count; ++c)
-            {
-                const auto src_idx =
-                    pixel_idx * image_channel_count + static_cast<uint64_t>(c);
-                const auto dst_idx =
-                    static_cast<size_t>(c) * static_cast<size_t>(pixel_count)
-                    + static_cast<size_t>(pixel_idx);
-                const auto src_byte = static_cast<double>(raw_data[src_idx]);
-                float_data[dst_idx] = static_cast<float>(
-                    (src_byte / 255.0 - mean_values[c]) / stddev_values[c]);
-            }
-        }
-    }
+    const auto width = static_cast<int32_t>(tensor_shape[3]);
+    const auto height = static_cast<int32_t>(tensor_shape[2]);
+    PackHwcU8ToChwF32(
+        HwcU8View{
+            raw_data,
+            static_cast<size_t>(width) * image_channel_count,
+            image_channel_count,
+            width,
+            height},
+        MakeTensorNormalization(
+            mean_values.data(),
+            stddev_values.data(),
+            tensor_channel_count),
+        ChwF32View{
+            backing.data,
+            static_cast<size_t>(width),
+            static_cast<size_t>(pixel_count),
+            tensor_channel_count});
 
     *p_out_backing = std::move(backing);
     return DAS_S_OK;
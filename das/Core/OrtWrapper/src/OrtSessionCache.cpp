@@ -0,0 +1,443 @@
+#include "OrtSessionCache.h"
+
+#include <das/Core/Logger/Logger.h>
+#include <das/DasPtr.hpp>
+#include <das/DasString.hpp>
+#include <das/Utils/CommonUtils.hpp>
+#include <das/Utils/StringUtils.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+DAS_CORE_ORTWRAPPER_NS_BEGIN
+
+// ===== Helper: IDasJson option lookup =====
+
+static ExportInterface::DasType GetOptionType(
+    ExportInterface::IDasJson* p_options,
+    IDasReadOnlyString*        p_key)
+{
+    ExportInterface::DasType type = ExportInterface::DAS_TYPE_NULL;
+    if (DAS::IsFailed(p_options->GetTypeByName(p_key, &type)))
+    {
+        return ExportInterface::DAS_TYPE_NULL;
+    }
+    return type;
+}
+
+static DasResult ReadIntOption(
+    ExportInterface::IDasJson* p_options,
+    const char*                key,
+    int32_t                    min_value,
+    int32_t&                   in_out_value)
+{
+    DasReadOnlyString das_key{key};
+    const auto        type = GetOptionType(p_options, das_key.Get());
+    if (type == ExportInterface::DAS_TYPE_NULL)
+    {
+        return DAS_S_OK;
+    }
+    int64_t value = 0;
+    if ((type != ExportInterface::DAS_TYPE_INT
+         && type != ExportInterface::DAS_TYPE_UINT)
+        || DAS::IsFailed(p_options->GetIntByName(das_key.Get(), &value))
+        || value < min_value || value > INT32_MAX)
+    {
+        DAS_CORE_LOG_ERROR("Invalid session option: {}", key);
+        return DAS_E_INVALID_ARGUMENT;
+    }
+    in_out_value = static_cast<int32_t>(value);
+    return DAS_S_OK;
+}
+
+static DasResult ReadBoolOption(
+    ExportInterface::IDasJson* p_options,
+    const char*                key,
+    bool&                      in_out_value)
+{
+    DasReadOnlyString das_key{key};
+    const auto        type = GetOptionType(p_options, das_key.Get());
+    if (type == ExportInterface::DAS_TYPE_NULL)
+    {
+        return DAS_S_OK;
+    }
+    if (type != ExportInterface::DAS_TYPE_BOOL
+        || DAS::IsFailed(
+            p_options->GetBoolByName(das_key.Get(), &in_out_value)))
+    {
+        DAS_CORE_LOG_ERROR("Invalid session option: {}", key);
+        return DAS_E_INVALID_ARGUMENT;
+    }
+    return DAS_S_OK;
+}
+
+static DasResult ReadStringOption(
+    ExportInterface::IDasJson* p_options,
+    const char*                key,
+    std::string&               in_out_value)
+{
+    DasReadOnlyString das_key{key};
+    const auto        type = GetOptionType(p_options, das_key.Get());
+    if (type == ExportInterface::DAS_TYPE_NULL)
+    {
+        return DAS_S_OK;
+    }
+    DAS::DasPtr<IDasReadOnlyString> p_value;
+    const char*                     p_utf8 = nullptr;
+    if (type != ExportInterface::DAS_TYPE_STRING
+        || DAS::IsFailed(
+            p_options->GetStringByName(das_key.Get(), p_value.Put()))
+        || !p_value || DAS::IsFailed(p_value->GetUtf8(&p_utf8))
+        || p_utf8 == nullptr)
+    {
+        DAS_CORE_LOG_ERROR("Invalid session option: {}", key);
+        return DAS_E_INVALID_ARGUMENT;
+    }
+    in_out_value = p_utf8;
+    return DAS_S_OK;
+}
+
+// ===== Helper: model file fingerprint =====
+
+// FNV-1a is stable across processes, which matters because the hashes are
+// also baked into optimized model file names that outlive the process.
+static constexpr uint64_t kFnvOffset = 0xcbf29ce484222325ULL;
+
+static uint64_t HashBytes(std::string_view bytes, uint64_t hash)
+{
+    constexpr uint64_t kFnvPrime = 0x100000001b3ULL;
+    for (const auto byte : bytes)
+    {
+        hash ^= static_cast<unsigned char>(byte);
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
+
+static uint64_t HashFileContent(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        throw std::filesystem::filesystem_error(
+            "Failed to open model file",
+            path,
+            std::make_error_code(std::errc::no_such_file_or_directory));
+    }
+
+    uint64_t          hash = kFnvOffset;
+    std::vector<char> chunk(1 << 20);
+    while (file)
+    {
+        file.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        hash = HashBytes(
+            {chunk.data(), static_cast<size_t>(file.gcount())},
+            hash);
+    }
+    return hash;
+}
+
+// Hashing a large model is not free; remember the result until the file's
+// size or modification time changes.
+static uint64_t GetModelFileHash(const std::filesystem::path& path)
+{
+    struct Entry
+    {
+        uintmax_t                       size;
+        std::filesystem::file_time_type mtime;
+        uint64_t                        hash;
+    };
+    static std::mutex                             mutex;
+    static std::unordered_map<std::string, Entry> entries;
+
+    const auto size = std::filesystem::file_size(path);
+    const auto mtime = std::filesystem::last_write_time(path);
+    const std::string key{
+        DAS::Utils::U8AsString(path.generic_u8string())};
+    {
+        std::lock_guard lock{mutex};
+        const auto      it = entries.find(key);
+        if (it != entries.end() && it->second.size == size
+            && it->second.mtime == mtime)
+        {
+            return it->second.hash;
+        }
+    }
+
+    const auto hash = HashFileContent(path);
+    std::lock_guard lock{mutex};
+    entries[key] = Entry{size, mtime, hash};
+    return hash;
+}
+
+static std::string ToHex(uint64_t value)
+{
+    char buffer[17]{};
+    std::snprintf(
+        buffer,
+        sizeof(buffer),
+        "%016llx",
+        static_cast<unsigned long long>(value));
+    return buffer;
+}
+
+// ===== Helper: live session registry =====
+
+struct SessionRegistry
+{
+    std::mutex                                                       mutex;
+    std::unordered_map<std::string, std::weak_ptr<SharedOrtSession>> sessions;
+};
+
+static SessionRegistry& GetSessionRegistry()
+{
+    static SessionRegistry registry;
+    return registry;
+}
+
+static std::shared_ptr<Ort::Session> AliasSession(
+    std::shared_ptr<SharedOrtSession> shared)
+{
+    auto* p_session = &shared->session;
+    return {std::move(shared), p_session};
+}
+
+// ===== OrtSessionOptions =====
+
+std::string OrtSessionOptions::ToKey() const
+{
+    std::string key;
+    key += "intra=" + std::to_string(intra_op_num_threads);
+    key += ";inter=" + std::to_string(inter_op_num_threads);
+    key += parallel_execution ? ";mode=parallel" : ";mode=sequential";
+    key += enable_cpu_mem_arena ? ";arena=1" : ";arena=0";
+    return key;
+}
+
+void OrtSessionOptions::ApplyTo(Ort::SessionOptions& session_options) const
+{
+    session_options.SetIntraOpNumThreads(intra_op_num_threads);
+    session_options.SetInterOpNumThreads(inter_op_num_threads);
+    session_options.SetExecutionMode(
+        parallel_execution ? ExecutionMode::ORT_PARALLEL
+                           : ExecutionMode::ORT_SEQUENTIAL);
+    if (enable_cpu_mem_arena)
+    {
+        session_options.EnableCpuMemArena();
+    }
+    else
+    {
+        session_options.DisableCpuMemArena();
+    }
+    session_options.SetGraphOptimizationLevel(
+        GraphOptimizationLevel::ORT_ENABLE_ALL);
+}
+
+DasResult ParseOrtSessionOptions(
+    ExportInterface::IDasJson* p_options,
+    OrtSessionOptions&         out_options)
+{
+    out_options = OrtSessionOptions{};
+    if (p_options == nullptr)
+    {
+        return DAS_S_OK;
+    }
+
+    std::string execution_mode;
+    DasResult   result = DAS_S_OK;
+    if (DAS::IsFailed(
+            result = ReadIntOption(
+                p_options,
+                "intraOpNumThreads",
+                0,
+                out_options.intra_op_num_threads))
+        || DAS::IsFailed(
+            result = ReadIntOption(
+                p_options,
+                "interOpNumThreads",
+                0,
+                out_options.inter_op_num_threads))
+        || DAS::IsFailed(
+            result =
+                ReadStringOption(p_options, "executionMode", execution_mode))
+        || DAS::IsFailed(
+            result = ReadBoolOption(
+                p_options,
+                "enableCpuMemArena",
+                out_options.enable_cpu_mem_arena))
+        || DAS::IsFailed(
+            result = ReadStringOption(
+                p_options,
+                "optimizedModelCacheDir",
+                out_options.optimized_model_cache_dir))
+        || DAS::IsFailed(
+            result = ReadBoolOption(
+                p_options,
+                "shareSession",
+                out_options.share_session)))
+    {
+        return result;
+    }
+
+    if (execution_mode == "parallel")
+    {
+        out_options.parallel_execution = true;
+    }
+    else if (!execution_mode.empty() && execution_mode != "sequential")
+    {
+        DAS_CORE_LOG_ERROR(
+            "Invalid session option: executionMode={}",
+            execution_mode);
+        return DAS_E_INVALID_ARGUMENT;
+    }
+    return DAS_S_OK;
+}
+
+// ===== Session cache =====
+
+std::shared_ptr<Ort::Env> GetSharedOrtEnv()
+{
+    static auto env = std::make_shared<Ort::Env>(
+        ORT_LOGGING_LEVEL_WARNING,
+        "DasOrtSessionCache");
+    return env;
+}
+
+std::shared_ptr<Ort::Session> AcquireOrtSession(
+    const std::filesystem::path& model_path,
+    const OrtSessionOptions&     options,
+    const char*                  provider_tag,
+    void (*configure_providers)(Ort::SessionOptions&))
+{
+    const auto canonical_path = std::filesystem::weakly_canonical(model_path);
+    const auto file_hash = GetModelFileHash(canonical_path);
+    const auto config_key = options.ToKey() + ";ep=" + provider_tag;
+    const auto cache_key =
+        std::string{DAS::Utils::U8AsString(canonical_path.generic_u8string())}
+        + '|' + ToHex(file_hash) + '|' + config_key;
+
+    auto& registry = GetSessionRegistry();
+    if (options.share_session)
+    {
+        std::lock_guard lock{registry.mutex};
+        const auto      it = registry.sessions.find(cache_key);
+        if (it != registry.sessions.end())
+        {
+            if (auto shared = it->second.lock())
+            {
+                DAS_CORE_LOG_TRACE(
+                    "Reusing ONNX session: {}",
+                    DAS::Utils::U8AsString(canonical_path.u8string()));
+                return AliasSession(std::move(shared));
+            }
+        }
+    }
+
+    Ort::SessionOptions session_options;
+    options.ApplyTo(session_options);
+    if (configure_providers)
+    {
+        configure_providers(session_options);
+    }
+
+    // Load the model outside the registry lock: unrelated models should not
+    // wait on each other, and a duplicate build of the same key is resolved
+    // below by keeping whichever session was registered first.
+    auto shared = std::make_shared<SharedOrtSession>();
+    shared->env = GetSharedOrtEnv();
+
+    if (options.optimized_model_cache_dir.empty())
+    {
+        shared->session = Ort::Session(
+            *shared->env,
+            canonical_path.c_str(),
+            session_options);
+    }
+    else
+    {
+        // The file name covers the model content and every setting that can
+        // change the optimized graph, so stale files are never picked up.
+        const std::filesystem::path cache_dir{std::u8string_view{
+            reinterpret_cast<const char8_t*>(
+                options.optimized_model_cache_dir.data()),
+            options.optimized_model_cache_dir.size()}};
+        const auto optimized_path =
+            cache_dir
+            / (ToHex(file_hash) + "." + ToHex(HashBytes(config_key, kFnvOffset))
+               + ".onnx");
+
+        std::error_code error_code;
+        if (std::filesystem::is_regular_file(optimized_path, error_code))
+        {
+            try
+            {
+                // Already optimized offline; running the optimizers again
+                // would only cost load time.
+                Ort::SessionOptions optimized_options = session_options.Clone();
+                optimized_options.SetGraphOptimizationLevel(
+                    GraphOptimizationLevel::ORT_DISABLE_ALL);
+                shared->session = Ort::Session(
+                    *shared->env,
+                    optimized_path.c_str(),
+                    optimized_options);
+            }
+            catch (const Ort::Exception& e)
+            {
+                DAS_CORE_LOG_WARN(
+                    "Discarding unusable optimized model {}: {}",
+                    DAS::Utils::U8AsString(optimized_path.u8string()),
+                    e.what());
+                std::filesystem::remove(optimized_path, error_code);
+            }
+        }
+
+        if (!shared->session)
+        {
+            std::filesystem::create_directories(cache_dir, error_code);
+            session_options.SetOptimizedModelFilePath(optimized_path.c_str());
+            shared->session = Ort::Session(
+                *shared->env,
+                canonical_path.c_str(),
+                session_options);
+        }
+    }
+
+    if (options.share_session)
+    {
+        std::lock_guard lock{registry.mutex};
+        auto&           slot = registry.sessions[cache_key];
+        if (auto existing = slot.lock())
+        {
+            return AliasSession(std::move(existing));
+        }
+        slot = shared;
+
+        for (auto it = registry.sessions.begin();
+             it != registry.sessions.end();)
+        {
+            it = it->second.expired() ? registry.sessions.erase(it)
+                                      : std::next(it);
+        }
+    }
+    return AliasSession(std::move(shared));
+}
+
+size_t GetLiveOrtSessionCount()
+{
+    auto&           registry = GetSessionRegistry();
+    std::lock_guard lock{registry.mutex};
+    size_t          count = 0;
+    for (const auto& [key, session] : registry.sessions)
+    {
+        count += session.expired() ? 0 : 1;
+    }
+    return count;
+}
+
+DAS_CORE_ORTWRAPPER_NS_END
@@ -0,0 +1,82 @@
+#ifndef DAS_CORE_ORTWRAPPER_ORTSESSIONCACHE_H
+#define DAS_CORE_ORTWRAPPER_ORTSESSIONCACHE_H
+
+#include "DasOrt.h"
+
+#include <das/_autogen/idl/abi/DasJson.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+DAS_CORE_ORTWRAPPER_NS_BEGIN
+
+/// Session options accepted through IDasAI::CreateSession's IDasJson argument.
+/// Every key is optional; missing keys keep the historical defaults
+/// (single intra-op thread, sequential execution, CPU arena enabled).
+///
+///   intraOpNumThreads      int    (default 1, 0 = ORT default)
+///   interOpNumThreads      int    (default 0 = ORT default)
+///   executionMode          string "sequential" | "parallel"
+///   enableCpuMemArena      bool   (default true)
+///   optimizedModelCacheDir string directory for optimized model files
+///   shareSession           bool   (default true)
+struct OrtSessionOptions
+{
+    int32_t     intra_op_num_threads = 1;
+    int32_t     inter_op_num_threads = 0;
+    bool        parallel_execution = false;
+    bool        enable_cpu_mem_arena = true;
+    std::string optimized_model_cache_dir;
+    bool        share_session = true;
+
+    /// Stable textual form of the options that affect the built session;
+    /// part of the session cache key and of optimized model file names.
+    [[nodiscard]]
+    std::string ToKey() const;
+
+    /// Applies the options to fresh Ort::SessionOptions. The optimized model
+    /// path is handled by AcquireOrtSession since it depends on the model.
+    void ApplyTo(Ort::SessionOptions& session_options) const;
+};
+
+/// Parses p_options (may be nullptr) into out_options. Returns
+/// DAS_E_INVALID_ARGUMENT when a known key carries a value of the wrong
+/// type or out of range.
+DasResult ParseOrtSessionOptions(
+    ExportInterface::IDasJson* p_options,
+    OrtSessionOptions&         out_options);
+
+/// Keeps the ORT environment alive for as long as any session built on it.
+/// The aliasing shared_ptr returned by AcquireOrtSession points at `session`.
+struct SharedOrtSession
+{
+    std::shared_ptr<Ort::Env> env;
+    Ort::Session              session{nullptr};
+};
+
+/// Returns the process-wide Ort::Env used by cached sessions.
+std::shared_ptr<Ort::Env> GetSharedOrtEnv();
+
+/// Builds an Ort::Session for model_path, or hands out an existing one.
+/// Sessions are shared when share_session is set and another live session
+/// was built from the same path, file content and ToKey(). The cache only
+/// holds weak references, so a model is unloaded once its last user goes
+/// away. Ort::Session::Run is thread-safe, which makes sharing sound.
+/// configure_providers is invoked on the session options before the session
+/// is built (e.g. to append an execution provider); provider_tag must
+/// describe what it does so differently-configured sessions never alias.
+/// Throws Ort::Exception / std::filesystem::filesystem_error on failure.
+std::shared_ptr<Ort::Session> AcquireOrtSession(
+    const std::filesystem::path& model_path,
+    const OrtSessionOptions&     options,
+    const char*                  provider_tag,
+    void (*configure_providers)(Ort::SessionOptions&) = nullptr);
+
+/// Number of cached sessions that are still alive. For diagnostics and tests.
+size_t GetLiveOrtSessionCount();
+
+DAS_CORE_ORTWRAPPER_NS_END
+
+#endif // DAS_CORE_ORTWRAPPER_ORTSESSIONCACHE_H
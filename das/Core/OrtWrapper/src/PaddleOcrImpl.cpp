@@ -5,6 +5,7 @@
 #include "IDasSessionImpl.h"
 #include "IDasTensorImpl.h"
 #include "IDasTensorVectorImpl.h"
+#include "TensorPreprocess.h"
 
 #include <das/Core/Logger/Logger.h>
 #include <das/DasPtr.hpp>
@@ -41,8 +42,8 @@ static constexpr double kDetMean[] = {0.485, 0.456, 0.406};
 static constexpr double kDetStd[] = {0.229, 0.224, 0.225};
 
 // ===== Recognition normalization: (pixel/255 - 0.5) / 0.5 (Pitfall 3) =====
-static constexpr double kRecMean[] = {127.5, 127.5, 127.5};
-static constexpr double kRecStd[] = {127.5, 127.5, 127.5};
+static constexpr double kRecMean[] = {0.5, 0.5, 0.5};
+static constexpr double kRecStd[] = {0.5, 0.5, 0.5};
 
 static bool TryMultiplyUint64(uint64_t lhs, uint64_t rhs, uint64_t* p_out_value)
 {
@@ -579,16 +580,12 @@ static DasResult RunSession(
     return result;
 }
 
-// ===== Helper: run recognition on a single text crop =====
-static DasResult RecognizeTextCrop(
-    DAS::ExportInterface::IDasAI* /*ai*/,
-    DAS::ExportInterface::IDasSession* rec_session,
-    const std::vector<std::string>&    rec_output_names,
-    int64_t                            rec_input_height,
-    int64_t                            rec_input_width,
-    const cv::Mat&                     crop,
-    const std::vector<std::string>&    dict,
-    CtcResult&                         out_result)
+// ===== Helper: rec preprocess — resize crop to rec height, keep aspect =====
+static DasResult ResizeRecCrop(
+    const cv::Mat& crop,
+    int64_t        rec_input_height,
+    int64_t        rec_input_width,
+    cv::Mat&       out_resized)
 {
     if (crop.empty() || crop.rows <= 0 || crop.cols <= 0
         || rec_input_height <= 0 || rec_input_width <= 0)
@@ -610,73 +607,52 @@ static DasResult RecognizeTextCrop(
         static_cast<int>(rec_input_width));
     target_w = std::max(target_w, 1);
 
-    cv::Mat resized;
     cv::resize(
         crop,
-        resized,
+        out_resized,
         cv::Size(target_w, static_cast<int>(rec_input_height)));
-    if (resized.empty() || resized.channels() != 3)
+    if (out_resized.empty() || out_resized.channels() != 3)
     {
         DAS_CORE_LOG_ERROR(
             "RecognizeTextCrop: resized crop must be 3-channel, got empty={}, "
             "channels={}",
-            resized.empty(),
-            resized.empty() ? 0 : resized.channels());
+            out_resized.empty(),
+            out_resized.empty() ? 0 : out_resized.channels());
         return DAS_E_INVALID_ARGUMENT;
     }
+    return DAS_S_OK;
+}
 
-    // Create IDasImage from the resized cv::Mat — we use CreateTensorFromImage
-    // which takes IDasImage*. We wrap the cv::Mat data as an
-    // IDasImage-compatible buffer. Instead, we can directly compute the float
-    // tensor ourselves. For simplicity and to use ai_->CreateTensorFromImage,
-    // we create a temporary shape and call it. But CreateTensorFromImage
-    // expects IDasImage*, so we need to handle this differently.
-
-    // Actually, CreateTensorFromImage takes raw pixel data from IDasImage.
-    // Since we have a cv::Mat (resized), we need to pass the pixel data.
-    // We already have the raw pixel bytes. We can create a float tensor
-    // directly.
-
-    // Build shape [1, 3, H, W]
-    const std::array<int64_t, 4> shape{
-        1,
-        3,
-        static_cast<int64_t>(resized.rows),
-        static_cast<int64_t>(resized.cols)};
-    int64_t total_elements = shape[0] * shape[1] * shape[2] * shape[3];
-
-    // Preprocess into DAS-owned memory so the ORT tensor never outlives its
-    // backing buffer.
-    FloatTensorBackingBuffer backing{};
-    auto                     backing_result =
-        CreateFloatTensorBackingBuffer(total_elements, &backing);
-    if (DAS::IsFailed(backing_result))
-    {
-        return backing_result;
-    }
-    backing.shape = shape;
-    auto* float_data = backing.data;
-
-    int height = resized.rows;
-    int width = resized.cols;
+// ===== Helper: rec normalization into one CHW slot of an NCHW tensor =====
+// Writes resized (H x w, BGR) into dst planes of width dst_width; columns
+// [w, dst_width) are padding and must already be zero (PaddleOCR pads the
+// normalized image with 0).
+static void NormalizeRecCrop(
+    const cv::Mat& resized,
+    float*         dst,
+    int            dst_width)
+{
+    static const auto normalization =
+        MakeTensorNormalization(kRecMean, kRecStd, 3);
+    PackHwcU8ToChwF32(
+        HwcU8View{resized.data, resized.step[0], 3, resized.cols, resized.rows},
+        normalization,
+        ChwF32View{
+            dst,
+            static_cast<size_t>(dst_width),
+            static_cast<size_t>(resized.rows) * dst_width,
+            3});
+}
 
-    for (int h = 0; h < height; ++h)
-    {
-        for (int w = 0; w < width; ++w)
-        {
-            for (int c = 0; c < 3; ++c)
-            {
-                auto src_byte =
-                    static_cast<double>(resized.at<cv::Vec3b>(h, w)[c]);
-                float val = static_cast<float>(
-                    (src_byte / 255.0 - kRecMean[c] / 255.0)
-                    / (kRecStd[c] / 255.0));
-                auto dst_idx =
-                    static_cast<size_t>(c * height * width + h * width + w);
-                float_data[dst_idx] = val;
-            }
-        }
-    }
+// ===== Helper: run rec inference on an [N, 3, H, W] tensor, CTC-decode =====
+static DasResult RunRecAndDecode(
+    DAS::ExportInterface::IDasSession* rec_session,
+    const std::vector<std::string>&    rec_output_names,
+    FloatTensorBackingBuffer&&         backing,
+    const std::vector<std::string>&    dict,
+    std::vector<CtcResult>&            out_results)
+{
+    const auto batch = backing.shape[0];
 
     DAS::DasPtr<DAS::ExportInterface::IDasTensor> tensor_ptr;
     auto tensor_result = CreateFloatTensorFromBacking(
@@ -741,9 +717,13 @@ static DasResult RecognizeTextCrop(
             out_dims.size());
         return DAS_E_INVALID_SIZE;
     }
-    if (out_dims.size() == 3 && out_dims[0] != 1)
+    const int64_t out_batch = out_dims.size() == 3 ? out_dims[0] : 1;
+    if (out_batch != batch)
     {
-        DAS_CORE_LOG_ERROR("Rec output batch must be 1, got {}", out_dims[0]);
+        DAS_CORE_LOG_ERROR(
+            "Rec output batch must be {}, got {}",
+            batch,
+            out_batch);
         return DAS_E_INVALID_SIZE;
     }
 
@@ -764,7 +744,7 @@ static DasResult RecognizeTextCrop(
 
     auto* logits = reinterpret_cast<float*>(out_data);
 
-    // Output shape: [1, T, num_classes] or [T, num_classes]
+    // Output shape: [N, T, num_classes] or [T, num_classes]
     int64_t time_steps_dim = 0;
     int64_t num_classes_dim = 0;
     if (out_dims.size() == 3)
@@ -788,15 +768,197 @@ static DasResult RecognizeTextCrop(
         return DAS_E_INVALID_SIZE;
     }
 
-    // CTC greedy decode (Pitfall 4: blank = index 0)
-    out_result = CtcGreedyDecode(
-        logits,
-        static_cast<int>(time_steps_dim),
-        static_cast<int>(num_classes_dim),
-        dict);
+    // CTC greedy decode (Pitfall 4: blank = index 0), one sample at a time
+    const auto sample_stride =
+        static_cast<size_t>(time_steps_dim) * static_cast<size_t>(num_classes_dim);
+    out_results.clear();
+    out_results.reserve(static_cast<size_t>(batch));
+    for (int64_t n = 0; n < batch; ++n)
+    {
+        out_results.push_back(CtcGreedyDecode(
+            logits + static_cast<size_t>(n) * sample_stride,
+            static_cast<int>(time_steps_dim),
+            static_cast<int>(num_classes_dim),
+            dict));
+    }
     return DAS_S_OK;
 }
 
+// ===== Helper: run recognition on a single text crop =====
+static DasResult RecognizeTextCrop(
+    DAS::ExportInterface::IDasSession* rec_session,
+    const std::vector<std::string>&    rec_output_names,
+    int64_t                            rec_input_height,
+    int64_t                            rec_input_width,
+    const cv::Mat&                     crop,
+    const std::vector<std::string>&    dict,
+    CtcResult&                         out_result)
+{
+    cv::Mat resized;
+    auto    result =
+        ResizeRecCrop(crop, rec_input_height, rec_input_width, resized);
+    if (DAS::IsFailed(result))
+    {
+        return result;
+    }
+
+    // Build shape [1, 3, H, W]
+    const std::array<int64_t, 4> shape{
+        1,
+        3,
+        static_cast<int64_t>(resized.rows),
+        static_cast<int64_t>(resized.cols)};
+    int64_t total_elements = shape[0] * shape[1] * shape[2] * shape[3];
+
+    // Preprocess into DAS-owned memory so the ORT tensor never outlives its
+    // backing buffer.
+    FloatTensorBackingBuffer backing{};
+    result = CreateFloatTensorBackingBuffer(total_elements, &backing);
+    if (DAS::IsFailed(result))
+    {
+        return result;
+    }
+    backing.shape = shape;
+    NormalizeRecCrop(resized, backing.data, resized.cols);
+
+    std::vector<CtcResult> decoded;
+    result = RunRecAndDecode(
+        rec_session,
+        rec_output_names,
+        std::move(backing),
+        dict,
+        decoded);
+    if (DAS::IsFailed(result))
+    {
+        return result;
+    }
+    out_result = std::move(decoded.front());
+    return DAS_S_OK;
+}
+
+// ===== Helper: batched recognition over many text crops =====
+// Crops are resized to the rec height, grouped into width buckets of
+// kRecWidthBucket px, and each bucket is run in chunks of at most
+// max_batch crops as one zero-padded [N, 3, H, W_max] tensor. Results are
+// written back by crop index so callers see the same order as the
+// one-crop-at-a-time path. A chunk whose batched run fails (e.g. a rec model
+// exported with a fixed batch of 1) falls back to per-crop inference.
+static constexpr int kRecWidthBucket = 64;
+
+static void RecognizeTextCropsBatched(
+    DAS::ExportInterface::IDasSession* rec_session,
+    const std::vector<std::string>&    rec_output_names,
+    int64_t                            rec_input_height,
+    int64_t                            rec_input_width,
+    const std::vector<cv::Mat>&        crops,
+    const std::vector<std::string>&    dict,
+    size_t                             max_batch,
+    std::vector<CtcResult>&            out_results,
+    std::vector<DasResult>&            out_codes)
+{
+    out_results.assign(crops.size(), CtcResult{});
+    out_codes.assign(crops.size(), DAS_E_FAIL);
+
+    std::vector<cv::Mat> resized(crops.size());
+    std::vector<size_t>  order;
+    order.reserve(crops.size());
+    for (size_t i = 0; i < crops.size(); ++i)
+    {
+        out_codes[i] = ResizeRecCrop(
+            crops[i],
+            rec_input_height,
+            rec_input_width,
+            resized[i]);
+        if (DAS::IsOk(out_codes[i]))
+        {
+            order.push_back(i);
+        }
+    }
+
+    // Narrowest first, so each chunk pads to a width close to its members.
+    auto bucket_of = [&resized](size_t i)
+    { return (resized[i].cols + kRecWidthBucket - 1) / kRecWidthBucket; };
+    std::stable_sort(
+        order.begin(),
+        order.end(),
+        [&resized](size_t a, size_t b)
+        { return resized[a].cols < resized[b].cols; });
+
+    size_t begin = 0;
+    while (begin < order.size())
+    {
+        size_t end = begin + 1;
+        while (end < order.size() && end - begin < max_batch
+               && bucket_of(order[end]) == bucket_of(order[begin]))
+        {
+            ++end;
+        }
+
+        const int     batch_w = resized[order[end - 1]].cols;
+        const int64_t batch_n = static_cast<int64_t>(end - begin);
+        const std::array<int64_t, 4> shape{
+            batch_n,
+            3,
+            rec_input_height,
+            static_cast<int64_t>(batch_w)};
+        const int64_t sample_elements = shape[1] * shape[2] * shape[3];
+
+        FloatTensorBackingBuffer backing{};
+        auto                     result =
+            CreateFloatTensorBackingBuffer(batch_n * sample_elements, &backing);
+        std::vector<CtcResult> decoded;
+        if (DAS::IsOk(result))
+        {
+            backing.shape = shape;
+            std::fill_n(backing.data, backing.element_count, 0.0f);
+            for (size_t k = begin; k < end; ++k)
+            {
+                NormalizeRecCrop(
+                    resized[order[k]],
+                    backing.data + (k - begin) * sample_elements,
+                    batch_w);
+            }
+            result = RunRecAndDecode(
+                rec_session,
+                rec_output_names,
+                std::move(backing),
+                dict,
+                decoded);
+        }
+
+        if (DAS::IsOk(result))
+        {
+            for (size_t k = begin; k < end; ++k)
+            {
+                out_results[order[k]] = std::move(decoded[k - begin]);
+                out_codes[order[k]] = DAS_S_OK;
+            }
+        }
+        else
+        {
+            DAS_CORE_LOG_WARN(
+                "Batched rec inference failed for {} crops (width={}): "
+                "result={}, falling back to per-crop inference",
+                batch_n,
+                batch_w,
+                result);
+            for (size_t k = begin; k < end; ++k)
+            {
+                const auto idx = order[k];
+                out_codes[idx] = RecognizeTextCrop(
+                    rec_session,
+                    rec_output_names,
+                    rec_input_height,
+                    rec_input_width,
+                    crops[idx],
+                    dict,
+                    out_results[idx]);
+            }
+        }
+        begin = end;
+    }
+}
+
 // =====================================================================
 // PaddleOcrImpl constructor
 // =====================================================================
@@ -819,6 +981,16 @@ PaddleOcrImpl::PaddleOcrImpl(
     }
 }
 
+void PaddleOcrImpl::SetRecBatchSize(size_t batch_size) noexcept
+{
+    rec_batch_size_ = batch_size;
+}
+
+size_t PaddleOcrImpl::GetRecBatchSize() const noexcept
+{
+    return rec_batch_size_;
+}
+
 // =====================================================================
 // PaddleOcrImpl::Recognize — full det+rec pipeline
 // =====================================================================
@@ -926,7 +1098,6 @@ DasResult PaddleOcrImpl::Recognize(
                 return cr;
             }
             det_backing.shape = shape;
-            auto* float_data = det_backing.data;
 
             // Det normalization: ImageNet (Pitfall 3)
             if (resized.empty() || resized.channels() != 3)
@@ -938,22 +1109,16 @@ DasResult PaddleOcrImpl::Recognize(
                     resized.empty() ? 0 : resized.channels());
                 return DAS_E_INVALID_ARGUMENT;
             }
-            for (int h = 0; h < target_h; ++h)
-            {
-                for (int w = 0; w < target_w; ++w)
-                {
-                    for (int c = 0; c < 3; ++c)
-                    {
-                        auto src_byte =
-                            static_cast<double>(resized.at<cv::Vec3b>(h, w)[c]);
-                        float val = static_cast<float>(
-                            (src_byte / 255.0 - kDetMean[c]) / kDetStd[c]);
-                        auto dst_idx = static_cast<size_t>(
-                            c * target_h * target_w + h * target_w + w);
-                        float_data[dst_idx] = val;
-                    }
-                }
-            }
+            static const auto det_normalization =
+                MakeTensorNormalization(kDetMean, kDetStd, 3);
+            PackHwcU8ToChwF32(
+                HwcU8View{resized.data, resized.step[0], 3, target_w, target_h},
+                det_normalization,
+                ChwF32View{
+                    det_backing.data,
+                    static_cast<size_t>(target_w),
+                    static_cast<size_t>(target_h) * target_w,
+                    3});
 
             DAS::DasPtr<DAS::ExportInterface::IDasTensor> det_tensor_ptr;
             cr = CreateFloatTensorFromBacking(
@@ -1205,13 +1370,17 @@ DasResult PaddleOcrImpl::Recognize(
             detected_boxes.push_back(db);
         }
 
-        // ====== Recognition phase ======
-        auto* result_vector = new IDasOcrResultVectorImpl{};
-        result_vector->AddRef();
-        result_vector->Reserve(detected_boxes.size());
+        // ====== Crop phase ======
+        std::vector<size_t>  crop_boxes; // index into detected_boxes
+        std::vector<cv::Mat> crops;
+        crop_boxes.reserve(detected_boxes.size());
+        crops.reserve(detected_boxes.size());
 
-        for (auto& det_box : detected_boxes)
+        for (size_t box_index = 0; box_index < detected_boxes.size();
+             ++box_index)
         {
+            const auto& det_box = detected_boxes[box_index];
+
             // Crop text region from image
             cv::Rect safe_rect =
                 det_box.rect & cv::Rect(0, 0, image.cols, image.rows);
@@ -1281,23 +1450,57 @@ DasResult PaddleOcrImpl::Recognize(
                 continue;
             }
 
-            // Run recognition
-            CtcResult ctc_result;
-            cr = RecognizeTextCrop(
-                ai_.Get(),
+            crop_boxes.push_back(box_index);
+            crops.push_back(std::move(crop));
+        }
+
+        // ====== Recognition phase ======
+        std::vector<CtcResult> ctc_results;
+        std::vector<DasResult> rec_codes;
+        if (rec_batch_size_ > 1 && crops.size() > 1)
+        {
+            RecognizeTextCropsBatched(
                 rec_session_.Get(),
                 rec_output_names_,
                 rec_input_height_,
                 rec_input_width_,
-                crop,
+                crops,
                 dict_,
-                ctc_result);
+                rec_batch_size_,
+                ctc_results,
+                rec_codes);
+        }
+        else
+        {
+            ctc_results.resize(crops.size());
+            rec_codes.resize(crops.size());
+            for (size_t i = 0; i < crops.size(); ++i)
+            {
+                rec_codes[i] = RecognizeTextCrop(
+                    rec_session_.Get(),
+                    rec_output_names_,
+                    rec_input_height_,
+                    rec_input_width_,
+                    crops[i],
+                    dict_,
+                    ctc_results[i]);
+            }
+        }
 
-            if (DAS::IsFailed(cr))
+        auto* result_vector = new IDasOcrResultVectorImpl{};
+        result_vector->AddRef();
+        result_vector->Reserve(crops.size());
+
+        for (size_t i = 0; i < crops.size(); ++i)
+        {
+            const auto& det_box = detected_boxes[crop_boxes[i]];
+            auto&       ctc_result = ctc_results[i];
+
+            if (DAS::IsFailed(rec_codes[i]))
             {
                 DAS_CORE_LOG_WARN(
                     "Recognition failed for a text region: result={}",
-                    cr);
+                    rec_codes[i]);
                 continue;
             }
 
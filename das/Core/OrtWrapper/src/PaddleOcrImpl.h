@@ -6,6 +6,7 @@
 #include <das/_autogen/idl/wrapper/Das.ExportInterface.IDasAI.Implements.hpp>
 #include <das/_autogen/idl/wrapper/Das.ExportInterface.IDasOcr.Implements.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -47,13 +48,22 @@ class PaddleOcrImpl final
     int64_t rec_input_height_ = 32;
     int64_t rec_input_width_ = 320;
 
+    // Max crops per rec Session::Run; crops are grouped by resized width
+    // and zero-padded within a batch. <= 1 runs one crop per call.
+    size_t rec_batch_size_ = kDefaultRecBatchSize;
+
 public:
+    static constexpr size_t kDefaultRecBatchSize = 16;
+
     PaddleOcrImpl(
         Das::ExportInterface::IDasAI*      ai,
         Das::ExportInterface::IDasSession* det_session,
         Das::ExportInterface::IDasSession* rec_session,
         std::vector<std::string>           dict);
 
+    void   SetRecBatchSize(size_t batch_size) noexcept;
+    size_t GetRecBatchSize() const noexcept;
+
     DAS_IMPL Recognize(
         Das::ExportInterface::IDasImage*            p_image,
         Das::ExportInterface::IDasOcrResultVector** pp_results) override;
@@ -0,0 +1,471 @@
+#include "TensorPreprocess.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__)                \
+    || defined(__i386__)
+#define DAS_ORT_PACK_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define DAS_ORT_PACK_NEON 1
+#include <arm_neon.h>
+#endif
+
+// GCC/Clang only emit SSE4.1/AVX2 instructions inside functions that opt in;
+// MSVC accepts the intrinsics anywhere.
+#if defined(__GNUC__) || defined(__clang__)
+#define DAS_ORT_PACK_TARGET(isa) __attribute__((target(isa)))
+#else
+#define DAS_ORT_PACK_TARGET(isa)
+#endif
+
+DAS_CORE_ORTWRAPPER_NS_BEGIN
+
+namespace
+{
+    // Pixels per SIMD step: one 16-lane byte vector per channel.
+    constexpr int kPackBlock = 16;
+
+    using PackRowFn = void (*)(
+        const uint8_t*             src_row,
+        uint32_t                   src_channels,
+        int32_t                    width,
+        const TensorNormalization& normalization,
+        float* const*              dst_rows,
+        uint32_t                   dst_channels);
+
+    void PackPixelsScalar(
+        const uint8_t*             src_row,
+        uint32_t                   src_channels,
+        int32_t                    begin,
+        int32_t                    end,
+        const TensorNormalization& normalization,
+        float* const*              dst_rows,
+        uint32_t                   dst_channels)
+    {
+        for (uint32_t c = 0; c < dst_channels; ++c)
+        {
+            const float    scale = normalization.scale[c];
+            const float    bias = normalization.bias[c];
+            const uint8_t* src = src_row + c;
+            float*         dst = dst_rows[c];
+            for (int32_t w = begin; w < end; ++w)
+            {
+                dst[w] =
+                    static_cast<float>(src[w * src_channels]) * scale + bias;
+            }
+        }
+    }
+
+    void PackRowScalar(
+        const uint8_t*             src_row,
+        uint32_t                   src_channels,
+        int32_t                    width,
+        const TensorNormalization& normalization,
+        float* const*              dst_rows,
+        uint32_t                   dst_channels)
+    {
+        PackPixelsScalar(
+            src_row,
+            src_channels,
+            0,
+            width,
+            normalization,
+            dst_rows,
+            dst_channels);
+    }
+
+#if defined(DAS_ORT_PACK_X86)
+    // Splits 16 interleaved 3-channel pixels (48 bytes) into one byte vector
+    // per channel.
+    DAS_ORT_PACK_TARGET("sse4.1")
+    inline void Deinterleave16x3(const uint8_t* src, __m128i* out)
+    {
+        const __m128i a =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        const __m128i b =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+        const __m128i c =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+
+        // clang-format off
+        const __m128i a0 = _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+        const __m128i b0 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1);
+        const __m128i c0 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13);
+        const __m128i a1 = _mm_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+        const __m128i b1 = _mm_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1);
+        const __m128i c1 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14);
+        const __m128i a2 = _mm_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+        const __m128i b2 = _mm_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1);
+        const __m128i c2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15);
+        // clang-format on
+
+        out[0] = _mm_or_si128(
+            _mm_or_si128(_mm_shuffle_epi8(a, a0), _mm_shuffle_epi8(b, b0)),
+            _mm_shuffle_epi8(c, c0));
+        out[1] = _mm_or_si128(
+            _mm_or_si128(_mm_shuffle_epi8(a, a1), _mm_shuffle_epi8(b, b1)),
+            _mm_shuffle_epi8(c, c1));
+        out[2] = _mm_or_si128(
+            _mm_or_si128(_mm_shuffle_epi8(a, a2), _mm_shuffle_epi8(b, b2)),
+            _mm_shuffle_epi8(c, c2));
+    }
+
+    // Splits 16 interleaved 4-channel pixels (64 bytes): group each register
+    // by channel, then transpose the resulting 4x4 matrix of 32-bit lanes.
+    DAS_ORT_PACK_TARGET("sse4.1")
+    inline void Deinterleave16x4(const uint8_t* src, __m128i* out)
+    {
+        const __m128i group = _mm_setr_epi8(
+            0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+        __m128i r[4];
+        for (int i = 0; i < 4; ++i)
+        {
+            r[i] = _mm_shuffle_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16 * i)),
+                group);
+        }
+        const __m128i t0 = _mm_unpacklo_epi32(r[0], r[1]);
+        const __m128i t1 = _mm_unpacklo_epi32(r[2], r[3]);
+        const __m128i t2 = _mm_unpackhi_epi32(r[0], r[1]);
+        const __m128i t3 = _mm_unpackhi_epi32(r[2], r[3]);
+        out[0] = _mm_unpacklo_epi64(t0, t1);
+        out[1] = _mm_unpackhi_epi64(t0, t1);
+        out[2] = _mm_unpacklo_epi64(t2, t3);
+        out[3] = _mm_unpackhi_epi64(t2, t3);
+    }
+
+    DAS_ORT_PACK_TARGET("sse4.1")
+    inline void StorePlane16Sse41(
+        __m128i bytes,
+        __m128  scale,
+        __m128  bias,
+        float*  dst)
+    {
+        const __m128i lanes[4] = {
+            _mm_cvtepu8_epi32(bytes),
+            _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 4)),
+            _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 8)),
+            _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 12))};
+        for (int i = 0; i < 4; ++i)
+        {
+            _mm_storeu_ps(
+                dst + 4 * i,
+                _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(lanes[i]), scale), bias));
+        }
+    }
+
+    DAS_ORT_PACK_TARGET("sse4.1")
+    void PackRowSse41(
+        const uint8_t*             src_row,
+        uint32_t                   src_channels,
+        int32_t                    width,
+        const TensorNormalization& normalization,
+        float* const*              dst_rows,
+        uint32_t                   dst_channels)
+    {
+        int32_t w = 0;
+        if (src_channels == 3 || src_channels == 4)
+        {
+            __m128 scale[4];
+            __m128 bias[4];
+            for (uint32_t c = 0; c < dst_channels; ++c)
+            {
+                scale[c] = _mm_set1_ps(normalization.scale[c]);
+                bias[c] = _mm_set1_ps(normalization.bias[c]);
+            }
+
+            __m128i planes[4];
+            for (; w + kPackBlock <= width; w += kPackBlock)
+            {
+                const uint8_t* src = src_row + w * src_channels;
+                if (src_channels == 3)
+                {
+                    Deinterleave16x3(src, planes);
+                }
+                else
+                {
+                    Deinterleave16x4(src, planes);
+                }
+
+                for (uint32_t c = 0; c < dst_channels; ++c)
+                {
+                    StorePlane16Sse41(
+                        planes[c],
+                        scale[c],
+                        bias[c],
+                        dst_rows[c] + w);
+                }
+            }
+        }
+        PackPixelsScalar(
+            src_row,
+            src_channels,
+            w,
+            width,
+            normalization,
+            dst_rows,
+            dst_channels);
+    }
+
+    DAS_ORT_PACK_TARGET("avx2")
+    void PackRowAvx2(
+        const uint8_t*             src_row,
+        uint32_t                   src_channels,
+        int32_t                    width,
+        const TensorNormalization& normalization,
+        float* const*              dst_rows,
+        uint32_t                   dst_channels)
+    {
+        int32_t w = 0;
+        if (src_channels == 3 || src_channels == 4)
+        {
+            __m256 scale[4];
+            __m256 bias[4];
+            for (uint32_t c = 0; c < dst_channels; ++c)
+            {
+                scale[c] = _mm256_set1_ps(normalization.scale[c]);
+                bias[c] = _mm256_set1_ps(normalization.bias[c]);
+            }
+
+            __m128i planes[4];
+            for (; w + kPackBlock <= width; w += kPackBlock)
+            {
+                const uint8_t* src = src_row + w * src_channels;
+                if (src_channels == 3)
+                {
+                    Deinterleave16x3(src, planes);
+                }
+                else
+                {
+                    Deinterleave16x4(src, planes);
+                }
+
+                for (uint32_t c = 0; c < dst_channels; ++c)
+                {
+                    float*       dst = dst_rows[c] + w;
+                    const __m256 lo = _mm256_cvtepi32_ps(
+                        _mm256_cvtepu8_epi32(planes[c]));
+                    const __m256 hi = _mm256_cvtepi32_ps(
+                        _mm256_cvtepu8_epi32(_mm_srli_si128(planes[c], 8)));
+                    _mm256_storeu_ps(
+                        dst,
+                        _mm256_add_ps(_mm256_mul_ps(lo, scale[c]), bias[c]));
+                    _mm256_storeu_ps(
+                        dst + 8,
+                        _mm256_add_ps(_mm256_mul_ps(hi, scale[c]), bias[c]));
+                }
+            }
+        }
+        PackPixelsScalar(
+            src_row,
+            src_channels,
+            w,
+            width,
+            normalization,
+            dst_rows,
+            dst_channels);
+    }
+
+    TensorPackIsa DetectTensorPackIsa()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4]{};
+        __cpuid(info, 0);
+        const int max_leaf = info[0];
+        __cpuid(info, 1);
+        const bool sse41 = (info[2] & (1 << 19)) != 0;
+        const bool os_ymm = (info[2] & (1 << 27)) != 0
+                            && (info[2] & (1 << 28)) != 0
+                            && (_xgetbv(0) & 0x6) == 0x6;
+        bool       avx2 = false;
+        if (max_leaf >= 7)
+        {
+            __cpuidex(info, 7, 0);
+            avx2 = os_ymm && (info[1] & (1 << 5)) != 0;
+        }
+#else
+        __builtin_cpu_init();
+        const bool sse41 = __builtin_cpu_supports("sse4.1");
+        const bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+        if (avx2)
+        {
+            return TensorPackIsa::Avx2;
+        }
+        return sse41 ? TensorPackIsa::Sse41 : TensorPackIsa::Scalar;
+    }
+#elif defined(DAS_ORT_PACK_NEON)
+    void PackRowNeon(
+        const uint8_t*             src_row,
+        uint32_t                   src_channels,
+        int32_t                    width,
+        const TensorNormalization& normalization,
+        float* const*              dst_rows,
+        uint32_t                   dst_channels)
+    {
+        int32_t w = 0;
+        if (src_channels == 3 || src_channels == 4)
+        {
+            float32x4_t scale[4];
+            float32x4_t bias[4];
+            for (uint32_t c = 0; c < dst_channels; ++c)
+            {
+                scale[c] = vdupq_n_f32(normalization.scale[c]);
+                bias[c] = vdupq_n_f32(normalization.bias[c]);
+            }
+
+            uint8x16_t planes[4];
+            for (; w + kPackBlock <= width; w += kPackBlock)
+            {
+                const uint8_t* src = src_row + w * src_channels;
+                if (src_channels == 3)
+                {
+                    const uint8x16x3_t v = vld3q_u8(src);
+                    planes[0] = v.val[0];
+                    planes[1] = v.val[1];
+                    planes[2] = v.val[2];
+                }
+                else
+                {
+                    const uint8x16x4_t v = vld4q_u8(src);
+                    planes[0] = v.val[0];
+                    planes[1] = v.val[1];
+                    planes[2] = v.val[2];
+                    planes[3] = v.val[3];
+                }
+
+                for (uint32_t c = 0; c < dst_channels; ++c)
+                {
+                    float*           dst = dst_rows[c] + w;
+                    const uint16x8_t lo = vmovl_u8(vget_low_u8(planes[c]));
+                    const uint16x8_t hi = vmovl_u8(vget_high_u8(planes[c]));
+                    const uint32x4_t lanes[4] = {
+                        vmovl_u16(vget_low_u16(lo)),
+                        vmovl_u16(vget_high_u16(lo)),
+                        vmovl_u16(vget_low_u16(hi)),
+                        vmovl_u16(vget_high_u16(hi))};
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        vst1q_f32(
+                            dst + 4 * i,
+                            vaddq_f32(
+                                vmulq_f32(vcvtq_f32_u32(lanes[i]), scale[c]),
+                                bias[c]));
+                    }
+                }
+            }
+        }
+        PackPixelsScalar(
+            src_row,
+            src_channels,
+            w,
+            width,
+            normalization,
+            dst_rows,
+            dst_channels);
+    }
+
+    TensorPackIsa DetectTensorPackIsa() { return TensorPackIsa::Neon; }
+#else
+    TensorPackIsa DetectTensorPackIsa() { return TensorPackIsa::Scalar; }
+#endif
+
+    PackRowFn SelectPackRow(TensorPackIsa isa)
+    {
+        switch (isa)
+        {
+#if defined(DAS_ORT_PACK_X86)
+        case TensorPackIsa::Avx2:
+            return &PackRowAvx2;
+        case TensorPackIsa::Sse41:
+            return &PackRowSse41;
+#elif defined(DAS_ORT_PACK_NEON)
+        case TensorPackIsa::Neon:
+            return &PackRowNeon;
+#endif
+        default:
+            return &PackRowScalar;
+        }
+    }
+
+    void PackWith(
+        PackRowFn                  pack_row,
+        const HwcU8View&           src,
+        const TensorNormalization& normalization,
+        const ChwF32View&          dst)
+    {
+        float* dst_rows[4]{};
+        for (int32_t h = 0; h < src.height; ++h)
+        {
+            for (uint32_t c = 0; c < dst.channels; ++c)
+            {
+                dst_rows[c] = dst.data + c * dst.plane_stride
+                              + static_cast<size_t>(h) * dst.row_stride;
+            }
+            pack_row(
+                src.data + static_cast<size_t>(h) * src.row_stride,
+                src.channels,
+                src.width,
+                normalization,
+                dst_rows,
+                dst.channels);
+        }
+    }
+} // namespace
+
+TensorNormalization MakeTensorNormalization(
+    const double* p_mean,
+    const double* p_std,
+    uint32_t      channel_count)
+{
+    TensorNormalization result{};
+    for (uint32_t c = 0; c < channel_count && c < 4; ++c)
+    {
+        // (byte / 255 - mean) / std == byte * (1 / (255 * std)) - mean / std
+        result.scale[c] = static_cast<float>(1.0 / (255.0 * p_std[c]));
+        result.bias[c] = static_cast<float>(-p_mean[c] / p_std[c]);
+    }
+    return result;
+}
+
+TensorPackIsa GetTensorPackIsa()
+{
+    static const TensorPackIsa isa = DetectTensorPackIsa();
+    return isa;
+}
+
+const char* ToString(TensorPackIsa isa)
+{
+    switch (isa)
+    {
+    case TensorPackIsa::Sse41:
+        return "sse4.1";
+    case TensorPackIsa::Avx2:
+        return "avx2";
+    case TensorPackIsa::Neon:
+        return "neon";
+    default:
+        return "scalar";
+    }
+}
+
+void PackHwcU8ToChwF32(
+    const HwcU8View&           src,
+    const TensorNormalization& normalization,
+    const ChwF32View&          dst)
+{
+    static const PackRowFn pack_row = SelectPackRow(GetTensorPackIsa());
+    PackWith(pack_row, src, normalization, dst);
+}
+
+void PackHwcU8ToChwF32Scalar(
+    const HwcU8View&           src,
+    const TensorNormalization& normalization,
+    const ChwF32View&          dst)
+{
+    PackWith(&PackRowScalar, src, normalization, dst);
+}
+
+DAS_CORE_ORTWRAPPER_NS_END
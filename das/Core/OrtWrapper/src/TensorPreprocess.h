@@ -0,0 +1,84 @@
+#ifndef DAS_CORE_ORTWRAPPER_TENSORPREPROCESS_H
+#define DAS_CORE_ORTWRAPPER_TENSORPREPROCESS_H
+
+#include "Config.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+DAS_CORE_ORTWRAPPER_NS_BEGIN
+
+/// Per-channel affine transform applied while packing bytes into floats:
+/// dst = float(byte) * scale[c] + bias[c].
+struct TensorNormalization
+{
+    std::array<float, 4> scale{};
+    std::array<float, 4> bias{};
+};
+
+/// Builds the transform for dst = (byte / 255 - mean[c]) / std[c], with mean
+/// and std on the [0, 1] scale. channel_count must be in [1, 4] and every
+/// std must be non-zero; callers validate that beforehand.
+TensorNormalization MakeTensorNormalization(
+    const double* p_mean,
+    const double* p_std,
+    uint32_t      channel_count);
+
+/// Interleaved uint8 image (HWC). row_stride is in bytes, so cv::Mat::step
+/// can be passed through unchanged.
+struct HwcU8View
+{
+    const uint8_t* data{};
+    size_t         row_stride{};
+    uint32_t       channels{};
+    int32_t        width{};
+    int32_t        height{};
+};
+
+/// Planar float destination (one CHW slot of an NCHW tensor). Channel plane c
+/// starts at data + c * plane_stride and row h of it at + h * row_stride
+/// (both in elements). A row_stride wider than the source leaves the extra
+/// columns untouched, which is how padded rec batches are laid out.
+struct ChwF32View
+{
+    float*   data{};
+    size_t   row_stride{};
+    size_t   plane_stride{};
+    uint32_t channels{};
+};
+
+enum class TensorPackIsa
+{
+    Scalar,
+    Sse41,
+    Avx2,
+    Neon
+};
+
+/// The instruction set PackHwcU8ToChwF32 dispatches to on this CPU. Detected
+/// once on first use.
+TensorPackIsa GetTensorPackIsa();
+
+const char* ToString(TensorPackIsa isa);
+
+/// Normalizes src and transposes it from HWC to CHW in a single pass, using
+/// the first dst.channels channels of every pixel (dst.channels must not
+/// exceed src.channels). Writes straight into dst, which is normally the
+/// memory an Ort::Value borrows, so no intermediate float image is built.
+/// Every ISA path computes byte * scale + bias in float, so results agree
+/// with PackHwcU8ToChwF32Scalar to within one ulp.
+void PackHwcU8ToChwF32(
+    const HwcU8View&           src,
+    const TensorNormalization& normalization,
+    const ChwF32View&          dst);
+
+/// Portable reference implementation of PackHwcU8ToChwF32.
+void PackHwcU8ToChwF32Scalar(
+    const HwcU8View&           src,
+    const TensorNormalization& normalization,
+    const ChwF32View&          dst);
+
+DAS_CORE_ORTWRAPPER_NS_END
+
+#endif // DAS_CORE_ORTWRAPPER_TENSORPREPROCESS_H
@@ -1,11 +1,13 @@
 #include <gtest/gtest.h>
 
 #include "../src/AiCpuImpl.h"
+#include "../src/OrtSessionCache.h"
 
 #include <das/Core/IPC/CurrentIpcContextScope.h>
 #include <das/Core/IPC/MainProcess/IpcContext.h>
 #include <das/Core/Logger/Logger.h>
 #include <das/Core/OrtWrapper/Config.h>
+#include <das/Core/Utils/DasJsonImpl.h>
 #include <das/DasPtr.hpp>
 #include <das/DasString.hpp>
 #include <das/DasSwigApi.h>
@@ -167,6 +169,91 @@ TEST(AiCpuImplTest, CreateSessionInvalidPath_ReturnsError)
     ai->Release();
 }
 
+TEST(AiCpuImplTest, ParseSessionOptions_ReadsKnownKeys)
+{
+    using Das::Core::OrtWrapper::OrtSessionOptions;
+
+    OrtSessionOptions defaults;
+    EXPECT_EQ(
+        Das::Core::OrtWrapper::ParseOrtSessionOptions(nullptr, defaults),
+        DAS_S_OK);
+    EXPECT_EQ(defaults.intra_op_num_threads, 1);
+    EXPECT_TRUE(defaults.share_session);
+
+    DasPtr<Das::ExportInterface::IDasJson> json{
+        new Das::Core::Utils::IDasJsonImpl(
+            R"({"intraOpNumThreads": 4, "interOpNumThreads": 2,
+                "executionMode": "parallel", "enableCpuMemArena": false,
+                "optimizedModelCacheDir": "ort_cache",
+                "shareSession": false})")};
+    OrtSessionOptions options;
+    ASSERT_EQ(
+        Das::Core::OrtWrapper::ParseOrtSessionOptions(json.Get(), options),
+        DAS_S_OK);
+    EXPECT_EQ(options.intra_op_num_threads, 4);
+    EXPECT_EQ(options.inter_op_num_threads, 2);
+    EXPECT_TRUE(options.parallel_execution);
+    EXPECT_FALSE(options.enable_cpu_mem_arena);
+    EXPECT_EQ(options.optimized_model_cache_dir, "ort_cache");
+    EXPECT_FALSE(options.share_session);
+    EXPECT_NE(options.ToKey(), defaults.ToKey());
+}
+
+TEST(AiCpuImplTest, CreateSessionBadOptions_ReturnsInvalidArgument)
+{
+    DasPtr<Das::Core::OrtWrapper::AiCpuImpl> ai{
+        new Das::Core::OrtWrapper::AiCpuImpl{}};
+
+    DasPtr<Das::ExportInterface::IDasJson> json{
+        new Das::Core::Utils::IDasJsonImpl(R"({"executionMode": "turbo"})")};
+    DasPtr<Das::ExportInterface::IDasSession> session;
+    DasReadOnlyString path(
+        reinterpret_cast<const char*>(GetTestModelPath().u8string().c_str()));
+    EXPECT_EQ(
+        ai->CreateSession(path.Get(), json.Get(), session.Put()),
+        DAS_E_INVALID_ARGUMENT);
+    EXPECT_FALSE(session);
+}
+
+TEST(AiCpuImplTest, CreateSessionSharesLoadedModel_SkipIfNoModel)
+{
+    const auto model_path = GetTestModelPath();
+    if (!std::filesystem::exists(model_path))
+    {
+        GTEST_SKIP() << "No test ONNX model at " << model_path.string();
+    }
+
+    DasPtr<Das::Core::OrtWrapper::AiCpuImpl> ai{
+        new Das::Core::OrtWrapper::AiCpuImpl{}};
+    DasReadOnlyString path(
+        reinterpret_cast<const char*>(model_path.u8string().c_str()));
+
+    const auto live_before = Das::Core::OrtWrapper::GetLiveOrtSessionCount();
+    DasPtr<Das::ExportInterface::IDasSession> first;
+    DasPtr<Das::ExportInterface::IDasSession> second;
+    ASSERT_EQ(ai->CreateSession(path.Get(), nullptr, first.Put()), DAS_S_OK);
+    ASSERT_EQ(ai->CreateSession(path.Get(), nullptr, second.Put()), DAS_S_OK);
+    EXPECT_EQ(
+        Das::Core::OrtWrapper::GetLiveOrtSessionCount(),
+        live_before + 1);
+
+    // Different options must not alias the cached session.
+    DasPtr<Das::ExportInterface::IDasJson> json{
+        new Das::Core::Utils::IDasJsonImpl(R"({"intraOpNumThreads": 2})")};
+    DasPtr<Das::ExportInterface::IDasSession> third;
+    ASSERT_EQ(
+        ai->CreateSession(path.Get(), json.Get(), third.Put()),
+        DAS_S_OK);
+    EXPECT_EQ(
+        Das::Core::OrtWrapper::GetLiveOrtSessionCount(),
+        live_before + 2);
+
+    first = nullptr;
+    second = nullptr;
+    third = nullptr;
+    EXPECT_EQ(Das::Core::OrtWrapper::GetLiveOrtSessionCount(), live_before);
+}
+
 TEST(AiCpuImplTest, CreateTensorFromImageNullImage_ReturnsInvalidPointer)
 {
     auto* ai = new Das::Core::OrtWrapper::AiCpuImpl{};
@@ -3,17 +3,26 @@
 #include "../src/AiCpuImpl.h"
 #include "../src/IDasOcrResultImpl.h"
 #include "../src/IDasOcrResultVectorImpl.h"
+#include "../src/PaddleOcrImpl.h"
 
 #include <das/Core/IPC/CurrentIpcContextScope.h>
 #include <das/Core/IPC/MainProcess/IpcContext.h>
 #include <das/Core/Logger/Logger.h>
 #include <das/Core/OrtWrapper/Config.h>
+#include <das/DasApi.h>
 #include <das/DasPtr.hpp>
 #include <das/DasString.hpp>
 #include <das/DasSwigApi.h>
 #include <das/Utils/CommonUtils.hpp>
 
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
 
 using namespace Das::Core::IPC;
 using Das::DasPtr;
@@ -29,6 +38,51 @@ namespace
     {
         return std::filesystem::current_path() / "test_data" / "dict.txt";
     }
+
+    // OCR fixture directory: det.onnx, rec.onnx, dict.txt and images/*.png
+    // (or .jpg). Defaults to test_data/ocr; override with DAS_OCR_FIXTURE_DIR.
+    std::filesystem::path GetOcrFixtureDir()
+    {
+        if (const char* dir = std::getenv("DAS_OCR_FIXTURE_DIR"))
+        {
+            return dir;
+        }
+        return std::filesystem::current_path() / "test_data" / "ocr";
+    }
+
+    struct OcrLine
+    {
+        std::string                   text;
+        Das::ExportInterface::DasRect box;
+    };
+
+    std::vector<OcrLine> CollectOcrLines(
+        Das::ExportInterface::IDasOcrResultVector* results)
+    {
+        std::vector<OcrLine> lines;
+        uint32_t             count = 0;
+        results->GetCount(&count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            DasPtr<Das::ExportInterface::IDasOcrResult> item;
+            if (DAS::IsFailed(results->GetAt(i, item.Put())))
+            {
+                continue;
+            }
+            OcrLine             line{};
+            IDasReadOnlyString* text = nullptr;
+            if (DAS::IsOk(item->GetText(&text)) && text != nullptr)
+            {
+                const char* utf8 = nullptr;
+                text->GetUtf8(&utf8);
+                line.text = utf8 ? utf8 : "";
+                text->Release();
+            }
+            item->GetBox(&line.box);
+            lines.push_back(std::move(line));
+        }
+        return lines;
+    }
 } // namespace
 
 // ====== OCR Result Interface Tests ======
@@ -272,6 +326,144 @@ TEST_F(PaddleOcrTest, CreateOcrWithValidPaths_SkipIfNoModel)
     ai->Release();
 }
 
+// Runs every fixture image through det+rec with batched recognition off
+// (one Session::Run per text line) and on, reporting per-image latency and
+// checking both modes return the same lines.
+TEST_F(PaddleOcrTest, BatchedRecognitionBenchmark_SkipIfNoFixtures)
+{
+    const auto fixture_dir = GetOcrFixtureDir();
+    const auto det_path = fixture_dir / "det.onnx";
+    const auto rec_path = fixture_dir / "rec.onnx";
+    const auto dict_path = fixture_dir / "dict.txt";
+    const auto image_dir = fixture_dir / "images";
+    if (!std::filesystem::exists(det_path) || !std::filesystem::exists(rec_path)
+        || !std::filesystem::exists(dict_path)
+        || !std::filesystem::is_directory(image_dir))
+    {
+        GTEST_SKIP() << "No OCR fixtures in " << fixture_dir.string();
+    }
+
+    DasPtr<Das::Core::OrtWrapper::AiCpuImpl> ai{
+        new Das::Core::OrtWrapper::AiCpuImpl{}};
+
+    DasPtr<Das::ExportInterface::IDasSession> det_session;
+    DasPtr<Das::ExportInterface::IDasSession> rec_session;
+    DasReadOnlyString det_model(
+        reinterpret_cast<const char*>(det_path.u8string().c_str()));
+    DasReadOnlyString rec_model(
+        reinterpret_cast<const char*>(rec_path.u8string().c_str()));
+    ASSERT_EQ(
+        ai->CreateSession(det_model.Get(), nullptr, det_session.Put()),
+        DAS_S_OK);
+    ASSERT_EQ(
+        ai->CreateSession(rec_model.Get(), nullptr, rec_session.Put()),
+        DAS_S_OK);
+
+    std::vector<std::string> dict;
+    {
+        std::ifstream dict_file(dict_path);
+        std::string   line;
+        while (std::getline(dict_file, line))
+        {
+            dict.push_back(line);
+        }
+    }
+    ASSERT_FALSE(dict.empty());
+
+    DasPtr<Das::Core::OrtWrapper::PaddleOcrImpl> ocr{
+        new Das::Core::OrtWrapper::PaddleOcrImpl(
+            ai.Get(),
+            det_session.Get(),
+            rec_session.Get(),
+            std::move(dict))};
+
+    std::vector<DasPtr<Das::ExportInterface::IDasImage>> images;
+    for (const auto& entry : std::filesystem::directory_iterator(image_dir))
+    {
+        const auto ext = entry.path().extension();
+        const bool is_png = ext == ".png";
+        if (!is_png && ext != ".jpg")
+        {
+            continue;
+        }
+        std::ifstream     file(entry.path(), std::ios::binary);
+        std::vector<char> bytes{
+            std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>()};
+
+        DasImageDesc desc{};
+        desc.p_data = bytes.data();
+        desc.data_size = bytes.size();
+        desc.data_format = is_png ? Das::ExportInterface::DAS_IMAGE_FORMAT_PNG
+                                  : Das::ExportInterface::DAS_IMAGE_FORMAT_JPG;
+        DasPtr<Das::ExportInterface::IDasImage> image;
+        ASSERT_EQ(CreateIDasImageFromEncodedData(&desc, image.Put()), DAS_S_OK)
+            << entry.path().string();
+        images.push_back(std::move(image));
+    }
+    if (images.empty())
+    {
+        GTEST_SKIP() << "No fixture images in " << image_dir.string();
+    }
+
+    constexpr int kRounds = 5;
+    auto          run_all =
+        [&](size_t batch_size, std::vector<std::vector<OcrLine>>& out_lines)
+    {
+        ocr->SetRecBatchSize(batch_size);
+        out_lines.assign(images.size(), {});
+        const auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < kRounds; ++round)
+        {
+            for (size_t i = 0; i < images.size(); ++i)
+            {
+                DasPtr<Das::ExportInterface::IDasOcrResultVector> results;
+                EXPECT_EQ(
+                    ocr->Recognize(images[i].Get(), results.Put()),
+                    DAS_S_OK);
+                if (results)
+                {
+                    out_lines[i] = CollectOcrLines(results.Get());
+                }
+            }
+        }
+        const auto elapsed =
+            std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start)
+                .count();
+        return elapsed / (kRounds * static_cast<double>(images.size()));
+    };
+
+    std::vector<std::vector<OcrLine>> unbatched;
+    std::vector<std::vector<OcrLine>> batched;
+    const double unbatched_ms = run_all(1, unbatched);
+    const double batched_ms = run_all(
+        Das::Core::OrtWrapper::PaddleOcrImpl::kDefaultRecBatchSize,
+        batched);
+
+    RecordProperty("images", static_cast<int>(images.size()));
+    RecordProperty("unbatched_ms_per_image", std::to_string(unbatched_ms));
+    RecordProperty("batched_ms_per_image", std::to_string(batched_ms));
+    std::printf(
+        "[ ocr batching ] %zu images: %.2f ms/image unbatched, %.2f ms/image "
+        "batched\n",
+        images.size(),
+        unbatched_ms,
+        batched_ms);
+
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        ASSERT_EQ(batched[i].size(), unbatched[i].size()) << "image " << i;
+        for (size_t j = 0; j < batched[i].size(); ++j)
+        {
+            EXPECT_EQ(batched[i][j].text, unbatched[i][j].text)
+                << "image " << i << " line " << j;
+            EXPECT_EQ(batched[i][j].box.x, unbatched[i][j].box.x);
+            EXPECT_EQ(batched[i][j].box.y, unbatched[i][j].box.y);
+        }
+    }
+}
+
 // ====== CUDA EP Probe Test ======
 
 TEST(CudaEpProbe, GetAvailableProvidersDoesNotCrash)
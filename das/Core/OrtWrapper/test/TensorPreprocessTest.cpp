@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+
+#include "../src/TensorPreprocess.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using Das::Core::OrtWrapper::ChwF32View;
+using Das::Core::OrtWrapper::HwcU8View;
+using Das::Core::OrtWrapper::TensorNormalization;
+
+namespace
+{
+    constexpr double kImageNetMean[] = {0.485, 0.456, 0.406, 0.5};
+    constexpr double kImageNetStd[] = {0.229, 0.224, 0.225, 0.5};
+
+    std::vector<uint8_t> MakeRandomImage(size_t byte_count, uint32_t seed)
+    {
+        std::mt19937         rng{seed};
+        std::vector<uint8_t> bytes(byte_count);
+        for (auto& byte : bytes)
+        {
+            byte = static_cast<uint8_t>(rng() & 0xFF);
+        }
+        return bytes;
+    }
+
+    // Mirrors the old per-element double computation the kernel replaced.
+    float Reference(uint8_t byte, uint32_t c)
+    {
+        return static_cast<float>(
+            (static_cast<double>(byte) / 255.0 - kImageNetMean[c])
+            / kImageNetStd[c]);
+    }
+
+    struct PackCase
+    {
+        uint32_t src_channels;
+        uint32_t dst_channels;
+        int32_t  width;
+        int32_t  height;
+        int32_t  dst_width;
+    };
+
+    void CheckPack(const PackCase& pack_case)
+    {
+        const size_t src_stride =
+            static_cast<size_t>(pack_case.width) * pack_case.src_channels + 5;
+        const auto src_bytes = MakeRandomImage(
+            src_stride * pack_case.height,
+            static_cast<uint32_t>(pack_case.width * 31 + pack_case.height));
+        const HwcU8View src{
+            src_bytes.data(),
+            src_stride,
+            pack_case.src_channels,
+            pack_case.width,
+            pack_case.height};
+
+        const size_t plane =
+            static_cast<size_t>(pack_case.dst_width) * pack_case.height;
+        std::vector<float> dispatched(plane * pack_case.dst_channels, -99.0f);
+        std::vector<float> scalar(dispatched.size(), -99.0f);
+        const ChwF32View   dispatched_view{
+            dispatched.data(),
+            static_cast<size_t>(pack_case.dst_width),
+            plane,
+            pack_case.dst_channels};
+        const ChwF32View scalar_view{
+            scalar.data(),
+            static_cast<size_t>(pack_case.dst_width),
+            plane,
+            pack_case.dst_channels};
+
+        const auto normalization = Das::Core::OrtWrapper::MakeTensorNormalization(
+            kImageNetMean,
+            kImageNetStd,
+            pack_case.dst_channels);
+        Das::Core::OrtWrapper::PackHwcU8ToChwF32(
+            src,
+            normalization,
+            dispatched_view);
+        Das::Core::OrtWrapper::PackHwcU8ToChwF32Scalar(
+            src,
+            normalization,
+            scalar_view);
+
+        for (uint32_t c = 0; c < pack_case.dst_channels; ++c)
+        {
+            for (int32_t h = 0; h < pack_case.height; ++h)
+            {
+                for (int32_t w = 0; w < pack_case.dst_width; ++w)
+                {
+                    const size_t index = c * plane
+                                         + static_cast<size_t>(h)
+                                               * pack_case.dst_width
+                                         + w;
+                    if (w >= pack_case.width)
+                    {
+                        // Padding columns are left alone.
+                        ASSERT_EQ(dispatched[index], -99.0f);
+                        continue;
+                    }
+                    const auto byte =
+                        src_bytes[h * src_stride + w * pack_case.src_channels
+                                  + c];
+                    const float expected = Reference(byte, c);
+                    ASSERT_NEAR(dispatched[index], scalar[index], 1e-5f)
+                        << "c=" << c << " h=" << h << " w=" << w;
+                    ASSERT_NEAR(dispatched[index], expected, 1e-5f)
+                        << "c=" << c << " h=" << h << " w=" << w;
+                }
+            }
+        }
+    }
+
+    template <class Fn>
+    double MeasureMicroseconds(int iterations, Fn&& fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            fn();
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::micro>(elapsed).count()
+               / iterations;
+    }
+
+    void RunPackBenchmark(const char* name, int32_t width, int32_t height)
+    {
+        constexpr int kIterations = 50;
+        const size_t  stride = static_cast<size_t>(width) * 3;
+        const auto    src_bytes = MakeRandomImage(stride * height, 7);
+        const HwcU8View src{src_bytes.data(), stride, 3, width, height};
+        std::vector<float> dst(static_cast<size_t>(width) * height * 3);
+        const ChwF32View   dst_view{
+            dst.data(),
+            static_cast<size_t>(width),
+            static_cast<size_t>(width) * height,
+            3};
+        const auto normalization = Das::Core::OrtWrapper::MakeTensorNormalization(
+            kImageNetMean,
+            kImageNetStd,
+            3);
+
+        const double scalar_us = MeasureMicroseconds(
+            kIterations,
+            [&]
+            {
+                Das::Core::OrtWrapper::PackHwcU8ToChwF32Scalar(
+                    src,
+                    normalization,
+                    dst_view);
+            });
+        const double dispatched_us = MeasureMicroseconds(
+            kIterations,
+            [&]
+            {
+                Das::Core::OrtWrapper::PackHwcU8ToChwF32(
+                    src,
+                    normalization,
+                    dst_view);
+            });
+
+        const char* isa = Das::Core::OrtWrapper::ToString(
+            Das::Core::OrtWrapper::GetTensorPackIsa());
+        std::printf(
+            "[ BENCHMARK ] %s %dx%d: scalar %.1f us, %s %.1f us\n",
+            name,
+            width,
+            height,
+            scalar_us,
+            isa,
+            dispatched_us);
+        ::testing::Test::RecordProperty(
+            std::string{name} + "_scalar_us",
+            std::to_string(scalar_us));
+        ::testing::Test::RecordProperty(
+            std::string{name} + "_" + isa + "_us",
+            std::to_string(dispatched_us));
+    }
+} // namespace
+
+TEST(TensorPreprocessTest, ThreeChannelMatchesReference)
+{
+    CheckPack({3, 3, 37, 5, 37});
+    CheckPack({3, 3, 64, 3, 64});
+    CheckPack({3, 3, 7, 2, 7});
+}
+
+TEST(TensorPreprocessTest, FourChannelSourceKeepsRequestedChannels)
+{
+    CheckPack({4, 4, 45, 4, 45});
+    CheckPack({4, 3, 33, 3, 33});
+    CheckPack({4, 1, 17, 2, 17});
+}
+
+TEST(TensorPreprocessTest, NarrowRowsLeavePaddingUntouched)
+{
+    CheckPack({3, 3, 50, 4, 64});
+}
+
+TEST(TensorPreprocessTest, SingleChannelUsesScalarPath)
+{
+    CheckPack({1, 1, 29, 3, 29});
+}
+
+TEST(TensorPreprocessBenchmark, DetInput640x640)
+{
+    RunPackBenchmark("det", 640, 640);
+}
+
+TEST(TensorPreprocessBenchmark, RecCrop48x320)
+{
+    RunPackBenchmark("rec", 320, 48);
+}
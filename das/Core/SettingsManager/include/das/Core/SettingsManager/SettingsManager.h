@@ -2,6 +2,8 @@
 #define DAS_CORE_SETTINGS_MANAGER_SETTINGS_MANAGER_H
 
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
 #include <cpp_yyjson.hpp>
 #include <das/Core/SettingsManager/Config.h>
 #include <das/DasExport.h>
@@ -9,8 +11,11 @@
 #include <das/IDasSettingsService.h>
 #include <das/Utils/DasJsonCore.h>
 #include <filesystem>
+#include <fstream>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -54,11 +59,36 @@ struct SettingsKeyCell
     SettingsKeyCell& operator=(const SettingsKeyCell&) = delete;
 };
 
+/// Write-behind persistence for plugin settings
+/// (settings/${pid}/${pluginGuid}.json).
+///
+/// When enabled, plugin settings updates change cell->snapshot and append
+/// one line to settings/settings.journal, then return. A background flusher
+/// rewrites every dirty file once no update has arrived for `debounce`, or
+/// at the latest `max_delay` after the first pending update, and truncates
+/// the journal after a clean pass. On construction any journal left by a
+/// crash is replayed onto the files first.
+struct SettingsWriteBehindOptions
+{
+    bool                      enabled{false};
+    std::chrono::milliseconds debounce{500};
+    std::chrono::milliseconds max_delay{5000};
+};
+
 class SettingsManager
 {
 public:
-    explicit SettingsManager(const std::filesystem::path& base_dir);
-    ~SettingsManager() = default;
+    explicit SettingsManager(
+        const std::filesystem::path& base_dir,
+        SettingsWriteBehindOptions   write_behind = {});
+    ~SettingsManager();
+
+    SettingsManager(const SettingsManager&) = delete;
+    SettingsManager& operator=(const SettingsManager&) = delete;
+
+    /// Persist all pending write-behind updates now. No-op when write-behind
+    /// is disabled.
+    DasResult FlushPendingWrites();
 
     // Global Settings (settings/ui.json)
     yyjson::value GetGlobalSettingsJson();
@@ -200,6 +230,24 @@ private:
     /// by this call.
     SettingsKeyCell* GetOrCreateCell(const std::string& key);
 
+    // Write-behind helpers. The caller of PersistPluginSettings and
+    // HasPendingWriteLocked holds the cell's lock; lock order is always
+    // cell mutex -> write_behind_mutex_.
+    DasResult PersistPluginSettings(
+        const std::string&           key,
+        const std::filesystem::path& path,
+        const yyjson::value&         document,
+        const std::string&           field_name,
+        const yyjson::value&         value);
+    bool HasPendingWriteLocked(const std::string& key);
+    DasResult AppendJournalLocked(
+        const std::filesystem::path& path,
+        const std::string&           field_name,
+        const yyjson::value&         value);
+    void      ReplayJournal();
+    void      FlusherLoop();
+    std::filesystem::path GetJournalPath() const;
+
     std::filesystem::path base_dir_;
 
     /// Per-key state cells: one shared_mutex + snapshot per settings file key.
@@ -222,6 +270,22 @@ private:
         void     operator()(const char* json) const { func(json, user_data); }
         explicit operator bool() const { return func != nullptr; }
     } settings_notify_;
+
+    struct DirtyEntry
+    {
+        std::filesystem::path                 path;
+        std::chrono::steady_clock::time_point first_update;
+        std::chrono::steady_clock::time_point last_update;
+    };
+
+    SettingsWriteBehindOptions write_behind_;
+    /// Guards dirty_cells_, journal_ and flusher_stopping_.
+    std::mutex                                  write_behind_mutex_;
+    std::condition_variable                     write_behind_cv_;
+    std::unordered_map<std::string, DirtyEntry> dirty_cells_;
+    std::ofstream                               journal_;
+    bool                                        flusher_stopping_{false};
+    std::thread                                 flusher_;
 };
 
 DAS_CORE_SETTINGS_MANAGER_NS_END
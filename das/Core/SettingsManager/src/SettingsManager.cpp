@@ -6,12 +6,14 @@
 
 #include <algorithm>
 #include <charconv>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <optional>
 #include <sstream>
 #include <string_view>
 #include <system_error>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -173,8 +175,10 @@ SettingsKeyCell* SettingsManager::GetOrCreateCell(const std::string& key)
     }
 }
 
-SettingsManager::SettingsManager(const std::filesystem::path& base_dir)
-    : base_dir_{base_dir}
+SettingsManager::SettingsManager(
+    const std::filesystem::path& base_dir,
+    SettingsWriteBehindOptions   write_behind)
+    : base_dir_{base_dir}, write_behind_{write_behind}
 {
     try
     {
@@ -197,6 +201,27 @@ SettingsManager::SettingsManager(const std::filesystem::path& base_dir)
             cell->snapshot = std::move(*parsed);
         }
     }
+
+    if (write_behind_.enabled)
+    {
+        ReplayJournal();
+        flusher_ = std::thread([this]() { FlusherLoop(); });
+    }
+}
+
+SettingsManager::~SettingsManager()
+{
+    if (!flusher_.joinable())
+    {
+        return;
+    }
+    {
+        std::lock_guard lock(write_behind_mutex_);
+        flusher_stopping_ = true;
+    }
+    write_behind_cv_.notify_all();
+    // The flusher persists everything still dirty before it exits.
+    flusher_.join();
 }
 
 std::string SettingsManager::ReadJsonFile(const std::filesystem::path& path)
@@ -322,6 +347,338 @@ DasResult SettingsManager::WriteJsonFile(
     }
 }
 
+// --- Write-behind persistence for plugin settings ---
+
+std::filesystem::path SettingsManager::GetJournalPath() const
+{
+    return base_dir_ / "settings.journal";
+}
+
+DasResult SettingsManager::AppendJournalLocked(
+    const std::filesystem::path& path,
+    const std::string&           field_name,
+    const yyjson::value&         value)
+{
+    try
+    {
+        if (!journal_.is_open())
+        {
+            journal_.open(
+                GetJournalPath(),
+                std::ios::binary | std::ios::app);
+            if (!journal_.is_open())
+            {
+                return DAS_E_INVALID_FILE;
+            }
+        }
+
+        const std::string relative_path{DAS::Utils::U8AsString(
+            path.lexically_relative(base_dir_).generic_u8string())};
+        auto record = Das::Utils::MakeYyjsonObject();
+        auto obj = *record.as_object();
+        obj[std::string_view("path")] = std::string_view(relative_path);
+        obj[std::string_view("field")] = std::string_view(field_name);
+        obj[std::string_view("value")] = value;
+
+        auto serialized = Das::Utils::SerializeYyjsonValue(record, false);
+        if (!serialized)
+        {
+            return DAS_E_INVALID_JSON;
+        }
+        journal_ << *serialized << '\n';
+        journal_.flush();
+        if (!journal_)
+        {
+            journal_.close();
+            return DAS_E_INVALID_FILE;
+        }
+        return DAS_S_OK;
+    }
+    catch (const std::bad_alloc& ex)
+    {
+        DAS_CORE_LOG_EXCEPTION(ex);
+        return DAS_E_OUT_OF_MEMORY;
+    }
+}
+
+DasResult SettingsManager::PersistPluginSettings(
+    const std::string&           key,
+    const std::filesystem::path& path,
+    const yyjson::value&         document,
+    const std::string&           field_name,
+    const yyjson::value&         value)
+{
+    if (!write_behind_.enabled)
+    {
+        return WriteJsonFile(path, document);
+    }
+
+    // Create the directory now: the flusher and journal replay treat a
+    // missing directory as a deleted profile.
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+
+    if (!ec)
+    {
+        std::lock_guard lock(write_behind_mutex_);
+        if (DAS::IsOk(AppendJournalLocked(path, field_name, value)))
+        {
+            const auto now = std::chrono::steady_clock::now();
+            auto [it, inserted] =
+                dirty_cells_.try_emplace(key, DirtyEntry{path, now, now});
+            if (!inserted)
+            {
+                it->second.last_update = now;
+            }
+            write_behind_cv_.notify_one();
+            return DAS_S_OK;
+        }
+        // Without a journal the update would not survive a crash, so fall
+        // back to writing the file directly.
+        DAS_CORE_LOG_WARN(
+            "Settings journal unavailable, writing {} directly",
+            DAS::Utils::U8AsString(path.u8string()));
+        dirty_cells_.erase(key);
+    }
+    return WriteJsonFile(path, document);
+}
+
+bool SettingsManager::HasPendingWriteLocked(const std::string& key)
+{
+    if (!write_behind_.enabled)
+    {
+        return false;
+    }
+    std::lock_guard lock(write_behind_mutex_);
+    return dirty_cells_.contains(key);
+}
+
+DasResult SettingsManager::FlushPendingWrites()
+{
+    if (!write_behind_.enabled)
+    {
+        return DAS_S_OK;
+    }
+
+    std::vector<std::string> keys;
+    {
+        std::lock_guard lock(write_behind_mutex_);
+        keys.reserve(dirty_cells_.size());
+        for (const auto& [key, entry] : dirty_cells_)
+        {
+            keys.push_back(key);
+        }
+    }
+
+    DasResult result = DAS_S_OK;
+    for (const auto& key : keys)
+    {
+        auto* cell = GetOrCreateCell(key);
+        // Writers hold the unique lock while they update the snapshot and
+        // mark the key dirty, so the snapshot seen here is the latest one.
+        std::shared_lock cell_lock(cell->mutex);
+
+        std::filesystem::path path;
+        {
+            std::lock_guard lock(write_behind_mutex_);
+            const auto      it = dirty_cells_.find(key);
+            if (it == dirty_cells_.end())
+            {
+                continue;
+            }
+            path = it->second.path;
+        }
+
+        // A deleted profile must not be recreated by a late flush.
+        DasResult write_result = DAS_S_OK;
+        if (std::filesystem::exists(path.parent_path()))
+        {
+            write_result = WriteJsonFile(path, cell->snapshot);
+        }
+
+        std::lock_guard lock(write_behind_mutex_);
+        if (DAS::IsOk(write_result))
+        {
+            dirty_cells_.erase(key);
+        }
+        else
+        {
+            result = write_result;
+        }
+    }
+
+    // Every journaled update is on disk once nothing is dirty.
+    std::lock_guard lock(write_behind_mutex_);
+    if (dirty_cells_.empty())
+    {
+        journal_.close();
+        std::error_code ec;
+        std::filesystem::remove(GetJournalPath(), ec);
+    }
+    return result;
+}
+
+void SettingsManager::FlusherLoop()
+{
+    std::unique_lock lock(write_behind_mutex_);
+    while (true)
+    {
+        if (dirty_cells_.empty())
+        {
+            if (flusher_stopping_)
+            {
+                return;
+            }
+            write_behind_cv_.wait(
+                lock,
+                [this]()
+                { return flusher_stopping_ || !dirty_cells_.empty(); });
+            continue;
+        }
+
+        if (!flusher_stopping_)
+        {
+            // Debounce: wait until the batch has been quiet for `debounce`,
+            // but never hold the oldest update longer than `max_delay`.
+            auto due = std::chrono::steady_clock::time_point::max();
+            for (const auto& [key, entry] : dirty_cells_)
+            {
+                due = std::min(
+                    due,
+                    std::min(
+                        entry.last_update + write_behind_.debounce,
+                        entry.first_update + write_behind_.max_delay));
+            }
+            if (std::chrono::steady_clock::now() < due)
+            {
+                write_behind_cv_.wait_until(lock, due);
+                continue;
+            }
+        }
+
+        lock.unlock();
+        const auto result = FlushPendingWrites();
+        lock.lock();
+
+        if (DAS::IsFailed(result))
+        {
+            // The journal is kept and replayed on the next start.
+            DAS_CORE_LOG_ERROR(
+                "Failed to persist settings. Error code = {}",
+                result);
+            if (flusher_stopping_)
+            {
+                return;
+            }
+            write_behind_cv_.wait_for(lock, write_behind_.max_delay);
+        }
+    }
+}
+
+void SettingsManager::ReplayJournal()
+{
+    const auto journal_path = GetJournalPath();
+    if (!std::filesystem::exists(journal_path))
+    {
+        return;
+    }
+
+    using JournalDocument = std::pair<std::filesystem::path, yyjson::value>;
+    std::unordered_map<std::string, JournalDocument> documents;
+    try
+    {
+        std::ifstream ifs{journal_path, std::ios::binary};
+        std::string   line;
+        while (std::getline(ifs, line))
+        {
+            auto record = Das::Utils::ParseYyjsonFromString(line);
+            auto path_ref = record ? ResolveDotPath(*record, "path")
+                                   : std::nullopt;
+            auto field_ref = record ? ResolveDotPath(*record, "field")
+                                    : std::nullopt;
+            auto value_ref = record ? ResolveDotPath(*record, "value")
+                                    : std::nullopt;
+            if (!path_ref || !field_ref || !value_ref)
+            {
+                // A crash while appending leaves a partial last line.
+                DAS_CORE_LOG_WARN(
+                    "Settings journal ends with a partial record");
+                break;
+            }
+            const auto relative_path = path_ref->as_string();
+            const auto field_name = field_ref->as_string();
+            if (!relative_path || !field_name)
+            {
+                break;
+            }
+            const auto serialized_value =
+                value_ref->write(yyjson::WriteFlag::NoFlag);
+            auto value = Das::Utils::ParseYyjsonFromString(std::string_view(
+                serialized_value.data(),
+                serialized_value.size()));
+            if (!value)
+            {
+                break;
+            }
+
+            const std::string relative{*relative_path};
+            auto [it, inserted] = documents.try_emplace(relative);
+            auto& [path, document] = it->second;
+            if (inserted)
+            {
+                path = base_dir_
+                       / std::filesystem::path{
+                           std::u8string{relative.begin(), relative.end()}};
+                auto parsed =
+                    Das::Utils::ParseYyjsonFromString(ReadJsonFile(path));
+                document = parsed && parsed->is_object()
+                               ? std::move(*parsed)
+                               : Das::Utils::MakeYyjsonObject();
+            }
+
+            if (field_name->empty())
+            {
+                document = std::move(*value);
+            }
+            else
+            {
+                if (!document.is_object())
+                {
+                    document = Das::Utils::MakeYyjsonObject();
+                }
+                auto target =
+                    EnsureDotPath(document, std::string{*field_name});
+                target = *value;
+            }
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        DAS_CORE_LOG_EXCEPTION(ex);
+    }
+
+    bool all_written = true;
+    for (const auto& [relative, entry] : documents)
+    {
+        const auto& [path, document] = entry;
+        // Skip files whose profile was deleted after the update.
+        if (!std::filesystem::exists(path.parent_path()))
+        {
+            continue;
+        }
+        all_written = DAS::IsOk(WriteJsonFile(path, document)) && all_written;
+    }
+
+    if (all_written)
+    {
+        std::error_code ec;
+        std::filesystem::remove(journal_path, ec);
+    }
+    DAS_CORE_LOG_INFO(
+        "Replayed settings journal into {} file(s)",
+        documents.size());
+}
+
 DasResult SettingsManager::CreateProfile(
     const std::string& profile_id,
     const std::string& name)
@@ -371,6 +728,16 @@ DasResult SettingsManager::DeleteProfile(const std::string& profile_id)
         }
 
         std::filesystem::remove_all(profile_dir);
+
+        if (write_behind_.enabled)
+        {
+            const auto      prefix = "profile/" + profile_id + "/";
+            std::lock_guard lock(write_behind_mutex_);
+            std::erase_if(
+                dirty_cells_,
+                [&prefix](const auto& item)
+                { return item.first.starts_with(prefix); });
+        }
         return DAS_S_OK;
     }
     catch (const std::filesystem::filesystem_error& ex)
@@ -407,7 +774,12 @@ DasResult SettingsManager::UpdatePluginSettings(
 
     std::unique_lock<std::shared_mutex> cell_lock(cell->mutex);
     cell->snapshot = *parsed;
-    return WriteJsonFile(GetPluginSettingsPath(profile_id, guid), *parsed);
+    return PersistPluginSettings(
+        key,
+        GetPluginSettingsPath(profile_id, guid),
+        cell->snapshot,
+        {},
+        cell->snapshot);
 }
 
 yyjson::value SettingsManager::GetPluginSettingsJson(
@@ -457,6 +829,12 @@ SettingsManager::GetPluginSettingsWithStatus(
 
     // Per-key mutex covers the entire check-read-write cycle
     std::unique_lock<std::shared_mutex> cell_lock(cell->mutex);
+    // A pending write-behind update is newer than the file and is already
+    // journaled, so the snapshot is authoritative.
+    if (HasPendingWriteLocked(key))
+    {
+        return {cell->snapshot, DAS_S_OK};
+    }
 
     // Check if file exists
     if (!std::filesystem::exists(path))
@@ -516,7 +894,12 @@ DasResult SettingsManager::UpdatePluginSettingsJson(
 
     std::unique_lock<std::shared_mutex> cell_lock(cell->mutex);
     cell->snapshot = data;
-    auto result = WriteJsonFile(GetPluginSettingsPath(profile_id, guid), data);
+    auto result = PersistPluginSettings(
+        key,
+        GetPluginSettingsPath(profile_id, guid),
+        data,
+        {},
+        data);
 
     if (DAS::IsOk(result))
     {
@@ -634,7 +1017,7 @@ DasResult SettingsManager::UpdatePluginSettingsFieldJson(
     auto* cell = GetOrCreateCell(key);
 
     // Per-key mutex protects the entire RMW cycle:
-    // read current -> modify -> WriteJsonFile -> update snapshot
+    // read current -> modify -> persist (file or journal) -> update snapshot
     std::unique_lock<std::shared_mutex> cell_lock(cell->mutex);
 
     auto path = GetPluginSettingsPath(profile_id, guid);
@@ -658,7 +1041,8 @@ DasResult SettingsManager::UpdatePluginSettingsFieldJson(
     {
         auto target = EnsureDotPath(current, field_name);
         target = value;
-        auto result = WriteJsonFile(path, current);
+        auto result =
+            PersistPluginSettings(key, path, current, field_name, value);
         if (DAS::IsOk(result))
         {
             cell->snapshot = std::move(current);
@@ -714,6 +1098,12 @@ DasResult SettingsManager::RebuildPluginSettingsFromDefaults(
 
     auto path = GetPluginSettingsPath(profile_id, guid);
 
+    // A pending write-behind update holds valid settings; nothing to rebuild.
+    if (HasPendingWriteLocked(key))
+    {
+        return DAS_S_OK;
+    }
+
     // Try to read existing file
     bool needs_rebuild = false;
     if (!std::filesystem::exists(path))
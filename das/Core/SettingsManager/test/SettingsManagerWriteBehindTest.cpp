@@ -0,0 +1,202 @@
+#include <das/Core/SettingsManager/SettingsManager.h>
+#include <das/IDasBase.h>
+#include <das/Utils/DasJsonCore.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace Das::Core::SettingsManager;
+
+namespace
+{
+    std::filesystem::path GetTestBaseDir()
+    {
+        const char* env = std::getenv("DAS_TEST_TMPDIR");
+        if (env && env[0] != '\0')
+        {
+            return std::filesystem::path(env);
+        }
+        return std::filesystem::current_path();
+    }
+
+    std::string ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream     ifs{path};
+        std::stringstream ss;
+        ss << ifs.rdbuf();
+        return ss.str();
+    }
+
+    int64_t ReadIntField(const std::filesystem::path& path, const char* name)
+    {
+        auto parsed = Das::Utils::ParseYyjsonFromString(ReadFile(path));
+        if (!parsed || !parsed->is_object())
+        {
+            return -1;
+        }
+        auto field = (*parsed->as_object())[std::string_view(name)];
+        return field.as_sint().value_or(-1);
+    }
+
+    SettingsWriteBehindOptions SlowFlushOptions()
+    {
+        // Long enough that nothing is flushed by the timer during a test.
+        return SettingsWriteBehindOptions{
+            .enabled = true,
+            .debounce = std::chrono::minutes{1},
+            .max_delay = std::chrono::minutes{1}};
+    }
+} // namespace
+
+class SettingsManagerWriteBehindTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        test_dir_ = GetTestBaseDir()
+                    / ("das_test_settings_write_behind_"
+                       + std::to_string(
+                           std::chrono::steady_clock::now()
+                               .time_since_epoch()
+                               .count()));
+        std::filesystem::create_directories(test_dir_);
+    }
+
+    void TearDown() override
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(test_dir_, ec);
+    }
+
+    std::filesystem::path PluginPath() const
+    {
+        return test_dir_ / "0" / (std::string{kGuid} + ".json");
+    }
+
+    std::filesystem::path JournalPath() const
+    {
+        return test_dir_ / "settings.journal";
+    }
+
+    static constexpr const char* kGuid = "write-behind-plugin";
+
+    std::filesystem::path test_dir_;
+};
+
+TEST_F(SettingsManagerWriteBehindTest, FieldUpdatesAreCoalesced)
+{
+    SettingsManager sm{test_dir_, SlowFlushOptions()};
+
+    for (int i = 0; i < 200; ++i)
+    {
+        ASSERT_EQ(
+            sm.UpdatePluginSettingsField(
+                "0",
+                kGuid,
+                "counter",
+                std::to_string(i)),
+            DAS_S_OK);
+    }
+
+    // Reads see the latest value immediately; the file is not written yet.
+    EXPECT_EQ(sm.GetPluginSettingsField("0", kGuid, "counter"), "199");
+    auto [json, status] = sm.GetPluginSettingsWithStatus("0", kGuid);
+    EXPECT_EQ(status, DAS_S_OK);
+    EXPECT_EQ(
+        (*json.as_object())[std::string_view("counter")].as_sint().value(),
+        199);
+    EXPECT_FALSE(std::filesystem::exists(PluginPath()));
+    EXPECT_TRUE(std::filesystem::exists(JournalPath()));
+
+    ASSERT_EQ(sm.FlushPendingWrites(), DAS_S_OK);
+    EXPECT_EQ(ReadIntField(PluginPath(), "counter"), 199);
+    EXPECT_FALSE(std::filesystem::exists(JournalPath()));
+}
+
+TEST_F(SettingsManagerWriteBehindTest, DebounceFlushesInBackground)
+{
+    SettingsManager sm{
+        test_dir_,
+        SettingsWriteBehindOptions{
+            .enabled = true,
+            .debounce = std::chrono::milliseconds{20},
+            .max_delay = std::chrono::milliseconds{200}}};
+
+    ASSERT_EQ(
+        sm.UpdatePluginSettingsField("0", kGuid, "counter", "7"),
+        DAS_S_OK);
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (ReadIntField(PluginPath(), "counter") != 7
+           && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+    EXPECT_EQ(ReadIntField(PluginPath(), "counter"), 7);
+}
+
+TEST_F(SettingsManagerWriteBehindTest, DestructorPersistsPendingUpdates)
+{
+    {
+        SettingsManager sm{test_dir_, SlowFlushOptions()};
+        ASSERT_EQ(
+            sm.UpdatePluginSettingsField("0", kGuid, "nested.value", "42"),
+            DAS_S_OK);
+    }
+
+    SettingsManager reopened{test_dir_};
+    EXPECT_EQ(
+        reopened.GetPluginSettingsField("0", kGuid, "nested.value"),
+        "42");
+    EXPECT_FALSE(std::filesystem::exists(JournalPath()));
+}
+
+TEST_F(SettingsManagerWriteBehindTest, JournalIsReplayedAfterCrash)
+{
+    std::filesystem::create_directories(test_dir_ / "0");
+    {
+        std::ofstream plugin{PluginPath()};
+        plugin << R"({"kept":1,"counter":0})";
+    }
+    {
+        // What a process killed before its flush leaves behind, including a
+        // partial last line.
+        std::ofstream journal{JournalPath(), std::ios::binary};
+        const std::string plugin_path =
+            R"("path":"0/write-behind-plugin.json")";
+        journal << "{" << plugin_path << R"(,"field":"counter","value":5})"
+                << '\n'
+                << "{" << plugin_path << R"(,"field":"a.b","value":"x"})"
+                << '\n'
+                << R"({"path":"deleted/other.json","field":"x","value":1})"
+                << '\n'
+                << "{" << plugin_path << R"(,"fie)";
+    }
+
+    SettingsManager sm{test_dir_, SlowFlushOptions()};
+
+    EXPECT_EQ(ReadIntField(PluginPath(), "kept"), 1);
+    EXPECT_EQ(ReadIntField(PluginPath(), "counter"), 5);
+    EXPECT_EQ(sm.GetPluginSettingsField("0", kGuid, "a.b"), "\"x\"");
+    EXPECT_FALSE(std::filesystem::exists(test_dir_ / "deleted"));
+    EXPECT_FALSE(std::filesystem::exists(JournalPath()));
+}
+
+TEST_F(SettingsManagerWriteBehindTest, DeletedProfileIsNotRecreated)
+{
+    SettingsManager sm{test_dir_, SlowFlushOptions()};
+    ASSERT_EQ(sm.CreateProfile("doomed", "Doomed"), DAS_S_OK);
+    ASSERT_EQ(
+        sm.UpdatePluginSettingsField("doomed", kGuid, "counter", "1"),
+        DAS_S_OK);
+    ASSERT_EQ(sm.DeleteProfile("doomed"), DAS_S_OK);
+
+    ASSERT_EQ(sm.FlushPendingWrites(), DAS_S_OK);
+    EXPECT_FALSE(std::filesystem::exists(test_dir_ / "doomed"));
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <das/Core/ForeignInterfaceHost/DasGuid.h>
+#include <das/IDasBase.h>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace Das::Core::TaskScheduler
+{
+    /// One plugin package to be loaded by RunPluginLoads.
+    struct PluginLoadItem
+    {
+        DasGuid              guid{};
+        /// Plugins that must have loaded successfully before this one starts.
+        std::vector<DasGuid> dependencies;
+        /// Never run concurrently with another exclusive item. Used for
+        /// in-process runtimes whose loaders are not known to be reentrant.
+        bool exclusive = false;
+    };
+
+    enum class PluginLoadStatus
+    {
+        Loaded,
+        Failed,
+        DependencyFailed,
+        DependencyMissing,
+        DependencyCycle
+    };
+
+    struct PluginLoadOutcome
+    {
+        PluginLoadStatus status = PluginLoadStatus::Failed;
+        DasResult        result = DAS_E_FAIL;
+        /// Offset of the load start from the RunPluginLoads call.
+        double start_ms = 0;
+        /// Duration of the load callback; 0 when it never ran.
+        double elapsed_ms = 0;
+    };
+
+    /// Calls load(index) for every item, running at most max_concurrency
+    /// loads at a time. An item starts only after all of its dependencies
+    /// loaded; it is skipped when one of them fails, is not among items,
+    /// or is part of a dependency cycle. Outcomes are in the order of items.
+    std::vector<PluginLoadOutcome> RunPluginLoads(
+        std::span<const PluginLoadItem>          items,
+        size_t                                   max_concurrency,
+        const std::function<DasResult(size_t)>& load);
+} // namespace Das::Core::TaskScheduler
@@ -9,6 +9,7 @@
 #include <das/Core/ForeignInterfaceHost/PluginManager.h>
 #include <das/Core/IPC/MainProcess/IIpcContext.h>
 #include <das/Core/SettingsManager/SettingsManager.h>
+#include <das/Core/TaskScheduler/PluginLoadScheduler.h>
 #include <das/Core/TaskScheduler/RepositoryInvokeCompiler.h>
 #include <das/Core/TaskScheduler/TaskCapabilityRegistry.h>
 #include <das/Core/TaskScheduler/TaskRepositoryStore.h>
@@ -313,6 +314,21 @@ namespace Das::Core::TaskScheduler
         Das::PluginInterface::IDasTask*    current_task_ = nullptr;
         std::vector<std::filesystem::path> loaded_plugin_paths_;
 
+        // Per-plugin load timings of the last Initialize, in scan order
+        struct PluginLoadRecord
+        {
+            DasGuid     plugin_guid;
+            std::string name;
+            std::string status;
+            DasResult   result;
+            double      start_ms;
+            double      elapsed_ms;
+        };
+        std::vector<PluginLoadRecord> plugin_load_records_;
+        double                        plugin_load_total_ms_ = 0;
+        // Max concurrent LoadPlugin calls, DAS_PLUGIN_LOAD_CONCURRENCY
+        size_t plugin_load_concurrency_ = 4;
+
         // Cooperative cancellation token for the currently executing task
         DasPtr<Das::PluginInterface::IDasStopToken> stop_token_;
 
@@ -0,0 +1,217 @@
+#include <das/Core/Logger/Logger.h>
+#include <das/Core/TaskScheduler/PluginLoadScheduler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+
+namespace Das::Core::TaskScheduler
+{
+    std::vector<PluginLoadOutcome> RunPluginLoads(
+        std::span<const PluginLoadItem>          items,
+        size_t                                   max_concurrency,
+        const std::function<DasResult(size_t)>& load)
+    {
+        using Clock = std::chrono::steady_clock;
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        const auto                     count = items.size();
+        const auto                     begin = Clock::now();
+        std::vector<PluginLoadOutcome> outcomes(count);
+
+        std::unordered_map<DasGuid, size_t> index_of;
+        for (size_t i = 0; i < count; ++i)
+        {
+            index_of.emplace(items[i].guid, i);
+        }
+
+        std::mutex                       mutex;
+        std::condition_variable          cv;
+        std::vector<size_t>              pending_dependencies(count, 0);
+        std::vector<std::vector<size_t>> dependents(count);
+        std::vector<bool>                settled(count, false);
+        std::deque<size_t>               ready;
+        size_t                           running = 0;
+        bool                             exclusive_running = false;
+
+        // Marks index and everything that transitively depends on it as
+        // settled with the given status. Caller holds mutex.
+        const auto fail = [&](size_t index, PluginLoadStatus status)
+        {
+            std::vector<size_t> stack{index};
+            outcomes[index].status = status;
+            while (!stack.empty())
+            {
+                const auto current = stack.back();
+                stack.pop_back();
+                if (settled[current])
+                {
+                    continue;
+                }
+                settled[current] = true;
+                if (current != index)
+                {
+                    outcomes[current].status =
+                        PluginLoadStatus::DependencyFailed;
+                }
+                for (const auto dependent : dependents[current])
+                {
+                    if (!settled[dependent])
+                    {
+                        stack.push_back(dependent);
+                    }
+                }
+            }
+        };
+
+        std::vector<size_t> missing;
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (const auto& dependency : items[i].dependencies)
+            {
+                const auto it = index_of.find(dependency);
+                if (it == index_of.end())
+                {
+                    missing.push_back(i);
+                    continue;
+                }
+                ++pending_dependencies[i];
+                dependents[it->second].push_back(i);
+            }
+        }
+        for (const auto index : missing)
+        {
+            if (!settled[index])
+            {
+                fail(index, PluginLoadStatus::DependencyMissing);
+            }
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!settled[i] && pending_dependencies[i] == 0)
+            {
+                ready.push_back(i);
+            }
+        }
+
+        // Picks the first ready item that may start now. Caller holds mutex.
+        const auto take_ready = [&]() -> std::optional<size_t>
+        {
+            const auto it = std::find_if(
+                ready.begin(),
+                ready.end(),
+                [&](size_t index)
+                { return !exclusive_running || !items[index].exclusive; });
+            if (it == ready.end())
+            {
+                return std::nullopt;
+            }
+            const auto index = *it;
+            ready.erase(it);
+            return index;
+        };
+
+        const auto worker = [&]()
+        {
+            std::unique_lock lock(mutex);
+            while (true)
+            {
+                std::optional<size_t> index;
+                cv.wait(
+                    lock,
+                    [&]()
+                    {
+                        index = take_ready();
+                        return index.has_value() || running == 0;
+                    });
+                if (!index)
+                {
+                    // Nothing is running and nothing can start: every item
+                    // is settled or waits on a dependency cycle.
+                    cv.notify_all();
+                    return;
+                }
+
+                const bool exclusive = items[*index].exclusive;
+                ++running;
+                exclusive_running = exclusive_running || exclusive;
+                lock.unlock();
+
+                const auto start = Clock::now();
+                DasResult  result = DAS_E_FAIL;
+                try
+                {
+                    result = load(*index);
+                }
+                catch (const std::exception& ex)
+                {
+                    DAS_CORE_LOG_ERROR(
+                        "Plugin load threw an exception: {}",
+                        ex.what());
+                }
+                const auto end = Clock::now();
+
+                lock.lock();
+                --running;
+                if (exclusive)
+                {
+                    exclusive_running = false;
+                }
+
+                auto& outcome = outcomes[*index];
+                outcome.result = result;
+                outcome.start_ms = Milliseconds{start - begin}.count();
+                outcome.elapsed_ms = Milliseconds{end - start}.count();
+                if (DAS::IsOk(result))
+                {
+                    outcome.status = PluginLoadStatus::Loaded;
+                    settled[*index] = true;
+                    for (const auto dependent : dependents[*index])
+                    {
+                        if (!settled[dependent]
+                            && --pending_dependencies[dependent] == 0)
+                        {
+                            ready.push_back(dependent);
+                        }
+                    }
+                }
+                else
+                {
+                    fail(*index, PluginLoadStatus::Failed);
+                }
+                cv.notify_all();
+            }
+        };
+
+        const auto worker_count =
+            std::min(std::max<size_t>(max_concurrency, 1), count);
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < worker_count; ++i)
+        {
+            threads.emplace_back(worker);
+        }
+        if (worker_count != 0)
+        {
+            worker();
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!settled[i])
+            {
+                outcomes[i].status = PluginLoadStatus::DependencyCycle;
+            }
+        }
+        return outcomes;
+    }
+} // namespace Das::Core::TaskScheduler
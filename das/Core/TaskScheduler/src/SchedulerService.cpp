@@ -19,6 +19,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdio>
+#include <cstdlib>
 #include <ctime>
 #include <fstream>
 #include <sstream>
@@ -29,6 +30,7 @@ namespace Das::Core::TaskScheduler
 {
 
     using Das::Core::ForeignInterfaceHost::FindManifest;
+    using Das::Core::ForeignInterfaceHost::LoadMode;
     using Das::Core::ForeignInterfaceHost::PluginPackageDesc;
     using Das::Core::ForeignInterfaceHost::PluginSettingDesc;
     using Das::Core::ForeignInterfaceHost::TaskDescriptor;
@@ -878,6 +880,15 @@ namespace Das::Core::TaskScheduler
         Das::DasSharedRef<DAS::Core::IPC::MainProcess::IIpcContext> ipc_context)
         : plugin_manager_(plugin_manager), ipc_context_{std::move(ipc_context)}
     {
+        if (const char* env = std::getenv("DAS_PLUGIN_LOAD_CONCURRENCY");
+            env != nullptr)
+        {
+            const auto value = std::strtoul(env, nullptr, 10);
+            if (value > 0)
+            {
+                plugin_load_concurrency_ = value;
+            }
+        }
         config_persist_thread_ =
             std::thread(&SchedulerService::ConfigPersistThreadLoop, this);
     }
@@ -952,6 +963,8 @@ namespace Das::Core::TaskScheduler
                 task_repository_store_.reset();
                 capability_registry_.Clear();
                 repository_plugin_availability_.clear();
+                plugin_load_records_.clear();
+                plugin_load_total_ms_ = 0;
                 for (auto it = loaded_plugin_paths_.rbegin();
                      it != loaded_plugin_paths_.rend();
                      ++it)
@@ -987,7 +1000,15 @@ namespace Das::Core::TaskScheduler
         std::unordered_map<DasGuid, RepositoryPluginAvailabilityState>
             temp_repository_plugin_availability;
 
-        // Load allowed plugin packages
+        struct PluginCandidate
+        {
+            std::filesystem::path manifest_path;
+            std::string           name;
+            PluginLoadItem        item;
+        };
+        std::vector<PluginCandidate> plugin_candidates;
+
+        // Collect allowed plugin packages
         for (const auto& entry : dir_iter)
         {
             std::filesystem::path manifest_path;
@@ -1064,49 +1085,148 @@ namespace Das::Core::TaskScheduler
                     continue;
                 }
 
-                auto load_result = plugin_manager_.LoadPlugin(manifest_path);
-                if (DAS::IsFailed(load_result))
-                {
-                    temp_repository_plugin_availability[desc.guid] = {
-                        "pluginLoadFailed",
-                        "Plugin package failed to load during scheduler "
-                        "initialize"};
-                    DAS_CORE_LOG_WARN(
-                        "SchedulerService::Initialize: failed to "
-                        "load plugin {}, result={}",
-                        desc.name,
-                        load_result);
-                    continue;
-                }
+                plugin_candidates.push_back(
+                    {.manifest_path = manifest_path,
+                     .name = desc.name,
+                     .item = {
+                         .guid = desc.guid,
+                         .dependencies = std::move(desc.dependencies),
+                         .exclusive = desc.load_mode != LoadMode::Ipc}});
+            }
+            catch (const std::exception& e)
+            {
+                DAS_CORE_LOG_WARN(
+                    "SchedulerService::Initialize: failed to parse "
+                    "manifest: {}",
+                    e.what());
+            }
+        }
+
+        // Load plugin packages concurrently; a plugin starts only after the
+        // plugins it depends on have loaded. In-process runtimes are kept
+        // serial, IPC hosts are spawned in parallel.
+        std::vector<PluginLoadItem> load_items;
+        load_items.reserve(plugin_candidates.size());
+        for (const auto& candidate : plugin_candidates)
+        {
+            load_items.push_back(candidate.item);
+        }
+        const auto load_begin = std::chrono::steady_clock::now();
+        const auto load_outcomes = RunPluginLoads(
+            load_items,
+            plugin_load_concurrency_,
+            [this, &plugin_candidates](size_t index)
+            {
+                return plugin_manager_.LoadPlugin(
+                    plugin_candidates[index].manifest_path);
+            });
+        const auto load_total_ms =
+            std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - load_begin)
+                .count();
+
+        // Register in scan order so feature indices stay deterministic
+        std::vector<PluginLoadRecord> temp_load_records;
+        temp_load_records.reserve(plugin_candidates.size());
+        for (size_t i = 0; i < plugin_candidates.size(); ++i)
+        {
+            const auto& candidate = plugin_candidates[i];
+            const auto& outcome = load_outcomes[i];
+            const auto& guid = candidate.item.guid;
+
+            PluginLoadRecord record{
+                .plugin_guid = guid,
+                .name = candidate.name,
+                .status = "loaded",
+                .result = outcome.result,
+                .start_ms = outcome.start_ms,
+                .elapsed_ms = outcome.elapsed_ms};
+
+            switch (outcome.status)
+            {
+            case PluginLoadStatus::Loaded:
+                break;
+            case PluginLoadStatus::Failed:
+                record.status = "loadFailed";
+                temp_repository_plugin_availability[guid] = {
+                    "pluginLoadFailed",
+                    "Plugin package failed to load during scheduler "
+                    "initialize"};
+                DAS_CORE_LOG_WARN(
+                    "SchedulerService::Initialize: failed to "
+                    "load plugin {}, result={}",
+                    candidate.name,
+                    outcome.result);
+                break;
+            case PluginLoadStatus::DependencyFailed:
+                record.status = "dependencyFailed";
+                temp_repository_plugin_availability[guid] = {
+                    "pluginLoadFailed",
+                    "Plugin package dependency failed to load"};
+                DAS_CORE_LOG_WARN(
+                    "SchedulerService::Initialize: skipping plugin {}, "
+                    "a dependency failed to load",
+                    candidate.name);
+                break;
+            case PluginLoadStatus::DependencyMissing:
+                record.status = "dependencyMissing";
+                temp_repository_plugin_availability[guid] = {
+                    "pluginLoadFailed",
+                    "Plugin package dependency is not installed or "
+                    "disabled"};
+                DAS_CORE_LOG_WARN(
+                    "SchedulerService::Initialize: skipping plugin {}, "
+                    "a dependency is not available",
+                    candidate.name);
+                break;
+            case PluginLoadStatus::DependencyCycle:
+                record.status = "dependencyCycle";
+                temp_repository_plugin_availability[guid] = {
+                    "pluginLoadFailed",
+                    "Plugin package dependencies form a cycle"};
+                DAS_CORE_LOG_WARN(
+                    "SchedulerService::Initialize: skipping plugin {}, "
+                    "its dependencies form a cycle",
+                    candidate.name);
+                break;
+            }
 
-                auto register_result =
-                    plugin_manager_.RegisterPluginObjects(manifest_path);
+            if (outcome.status == PluginLoadStatus::Loaded)
+            {
+                auto register_result = plugin_manager_.RegisterPluginObjects(
+                    candidate.manifest_path);
                 if (DAS::IsFailed(register_result))
                 {
-                    temp_repository_plugin_availability[desc.guid] = {
+                    record.status = "registerFailed";
+                    record.result = register_result;
+                    temp_repository_plugin_availability[guid] = {
                         "pluginLoadFailed",
                         "Plugin package failed to register during scheduler "
                         "initialize"};
                     DAS_CORE_LOG_WARN(
                         "SchedulerService::Initialize: failed to register "
                         "plugin objects for {}, result={}",
-                        desc.name,
+                        candidate.name,
                         register_result);
-                    plugin_manager_.UnloadPlugin(manifest_path);
-                    continue;
+                    plugin_manager_.UnloadPlugin(candidate.manifest_path);
+                }
+                else
+                {
+                    temp_paths.push_back(candidate.manifest_path);
                 }
-
-                temp_paths.push_back(manifest_path);
-            }
-            catch (const std::exception& e)
-            {
-                DAS_CORE_LOG_WARN(
-                    "SchedulerService::Initialize: failed to parse "
-                    "manifest: {}",
-                    e.what());
             }
+
+            temp_load_records.push_back(std::move(record));
         }
 
+        DAS_CORE_LOG_INFO(
+            "SchedulerService::Initialize: loaded {} of {} plugins in "
+            "{:.1f} ms (concurrency={})",
+            temp_paths.size(),
+            plugin_candidates.size(),
+            load_total_ms,
+            plugin_load_concurrency_);
+
         // Collect IDasTask features and build available task types
         auto task_features = plugin_manager_.GetFeaturesByType(
             Das::PluginInterface::DAS_PLUGIN_FEATURE_TASK);
@@ -1363,6 +1483,8 @@ namespace Das::Core::TaskScheduler
             loaded_plugin_paths_ = std::move(temp_paths);
             repository_plugin_availability_ =
                 std::move(temp_repository_plugin_availability);
+            plugin_load_records_ = std::move(temp_load_records);
+            plugin_load_total_ms_ = load_total_ms;
             initialized_ = true;
         }
 
@@ -1670,6 +1792,28 @@ namespace Das::Core::TaskScheduler
         }
 
         result_obj[std::string_view("tasks")] = std::move(tasks_arr);
+
+        // Per-plugin load timings of the last Initialize
+        auto loads_arr = Das::Utils::MakeYyjsonArray();
+        auto loads_arr_ref = *loads_arr.as_array();
+        for (const auto& record : plugin_load_records_)
+        {
+            auto load_obj = Das::Utils::MakeYyjsonObject();
+            auto load_ref = *load_obj.as_object();
+            load_ref[std::string_view("pluginGuid")] =
+                yyjson::value(GuidToString(record.plugin_guid));
+            load_ref[std::string_view("name")] = yyjson::value(record.name);
+            load_ref[std::string_view("status")] =
+                yyjson::value(record.status);
+            load_ref[std::string_view("result")] =
+                static_cast<int64_t>(record.result);
+            load_ref[std::string_view("startMs")] = record.start_ms;
+            load_ref[std::string_view("elapsedMs")] = record.elapsed_ms;
+            loads_arr_ref.emplace_back(std::move(load_obj));
+        }
+        result_obj[std::string_view("pluginLoads")] = std::move(loads_arr);
+        result_obj[std::string_view("pluginLoadTotalMs")] =
+            plugin_load_total_ms_;
         return result;
     }
 
@@ -0,0 +1,234 @@
+#include <das/Core/TaskScheduler/PluginLoadScheduler.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Das::Core::TaskScheduler::PluginLoadItem;
+    using Das::Core::TaskScheduler::PluginLoadStatus;
+    using Das::Core::TaskScheduler::RunPluginLoads;
+
+    DasGuid MakeGuid(uint32_t n)
+    {
+        DasGuid guid{};
+        guid.data1 = n;
+        return guid;
+    }
+
+    PluginLoadItem Item(
+        uint32_t              n,
+        std::vector<uint32_t> dependencies = {},
+        bool                  exclusive = false)
+    {
+        PluginLoadItem item{.guid = MakeGuid(n), .exclusive = exclusive};
+        for (const auto dependency : dependencies)
+        {
+            item.dependencies.push_back(MakeGuid(dependency));
+        }
+        return item;
+    }
+
+    /// Records how many loads overlap and the order they finish in.
+    struct LoadProbe
+    {
+        std::atomic<int>    running{0};
+        std::atomic<int>    peak{0};
+        std::mutex          mutex;
+        std::vector<size_t> finished;
+
+        DasResult Load(size_t index, std::chrono::milliseconds duration)
+        {
+            const auto now = ++running;
+            auto       seen = peak.load();
+            while (now > seen && !peak.compare_exchange_weak(seen, now))
+            {
+            }
+            std::this_thread::sleep_for(duration);
+            --running;
+            std::lock_guard lock{mutex};
+            finished.push_back(index);
+            return DAS_S_OK;
+        }
+
+        size_t FinishPosition(size_t index)
+        {
+            std::lock_guard lock{mutex};
+            return static_cast<size_t>(
+                std::find(finished.begin(), finished.end(), index)
+                - finished.begin());
+        }
+    };
+} // namespace
+
+TEST(PluginLoadSchedulerTest, EmptyInputReturnsNoOutcomes)
+{
+    const auto outcomes =
+        RunPluginLoads({}, 4, [](size_t) { return DAS_S_OK; });
+    EXPECT_TRUE(outcomes.empty());
+}
+
+TEST(PluginLoadSchedulerTest, IndependentPluginsLoadConcurrently)
+{
+    const std::vector items{Item(1), Item(2), Item(3), Item(4)};
+    LoadProbe         probe;
+
+    const auto outcomes = RunPluginLoads(
+        items,
+        4,
+        [&](size_t index)
+        { return probe.Load(index, std::chrono::milliseconds{50}); });
+
+    ASSERT_EQ(outcomes.size(), items.size());
+    for (const auto& outcome : outcomes)
+    {
+        EXPECT_EQ(outcome.status, PluginLoadStatus::Loaded);
+        EXPECT_EQ(outcome.result, DAS_S_OK);
+        EXPECT_GT(outcome.elapsed_ms, 0);
+    }
+    EXPECT_GT(probe.peak.load(), 1);
+}
+
+TEST(PluginLoadSchedulerTest, ConcurrencyIsBounded)
+{
+    std::vector<PluginLoadItem> items;
+    for (uint32_t i = 1; i <= 8; ++i)
+    {
+        items.push_back(Item(i));
+    }
+    LoadProbe probe;
+
+    RunPluginLoads(
+        items,
+        2,
+        [&](size_t index)
+        { return probe.Load(index, std::chrono::milliseconds{10}); });
+
+    EXPECT_LE(probe.peak.load(), 2);
+    EXPECT_EQ(probe.finished.size(), items.size());
+}
+
+TEST(PluginLoadSchedulerTest, DependenciesLoadFirst)
+{
+    // 3 -> 2 -> 1, 4 independent; listed in reverse dependency order.
+    const std::vector items{Item(3, {2}), Item(2, {1}), Item(1), Item(4)};
+    LoadProbe         probe;
+
+    const auto outcomes = RunPluginLoads(
+        items,
+        4,
+        [&](size_t index)
+        { return probe.Load(index, std::chrono::milliseconds{5}); });
+
+    for (const auto& outcome : outcomes)
+    {
+        EXPECT_EQ(outcome.status, PluginLoadStatus::Loaded);
+    }
+    EXPECT_LT(probe.FinishPosition(2), probe.FinishPosition(1));
+    EXPECT_LT(probe.FinishPosition(1), probe.FinishPosition(0));
+    EXPECT_GE(outcomes[0].start_ms, outcomes[1].start_ms);
+}
+
+TEST(PluginLoadSchedulerTest, FailedDependencySkipsDependents)
+{
+    const std::vector items{Item(1), Item(2, {1}), Item(3, {2}), Item(4)};
+    std::atomic<int>  calls{0};
+
+    const auto outcomes = RunPluginLoads(
+        items,
+        4,
+        [&](size_t index)
+        {
+            ++calls;
+            return index == 0 ? DAS_E_FAIL : DAS_S_OK;
+        });
+
+    EXPECT_EQ(outcomes[0].status, PluginLoadStatus::Failed);
+    EXPECT_EQ(outcomes[0].result, DAS_E_FAIL);
+    EXPECT_EQ(outcomes[1].status, PluginLoadStatus::DependencyFailed);
+    EXPECT_EQ(outcomes[2].status, PluginLoadStatus::DependencyFailed);
+    EXPECT_EQ(outcomes[3].status, PluginLoadStatus::Loaded);
+    EXPECT_EQ(calls.load(), 2);
+}
+
+TEST(PluginLoadSchedulerTest, ThrowingLoadIsReportedAsFailure)
+{
+    const std::vector items{Item(1), Item(2, {1})};
+
+    const auto outcomes = RunPluginLoads(
+        items,
+        2,
+        [](size_t) -> DasResult { throw std::runtime_error("boom"); });
+
+    EXPECT_EQ(outcomes[0].status, PluginLoadStatus::Failed);
+    EXPECT_EQ(outcomes[1].status, PluginLoadStatus::DependencyFailed);
+}
+
+TEST(PluginLoadSchedulerTest, MissingDependencyAndCycleAreSkipped)
+{
+    const std::vector items{
+        Item(1, {99}),
+        Item(2, {1}),
+        Item(3, {4}),
+        Item(4, {3}),
+        Item(5)};
+    std::atomic<int> calls{0};
+
+    const auto outcomes = RunPluginLoads(
+        items,
+        4,
+        [&](size_t)
+        {
+            ++calls;
+            return DAS_S_OK;
+        });
+
+    EXPECT_EQ(outcomes[0].status, PluginLoadStatus::DependencyMissing);
+    EXPECT_EQ(outcomes[1].status, PluginLoadStatus::DependencyFailed);
+    EXPECT_EQ(outcomes[2].status, PluginLoadStatus::DependencyCycle);
+    EXPECT_EQ(outcomes[3].status, PluginLoadStatus::DependencyCycle);
+    EXPECT_EQ(outcomes[4].status, PluginLoadStatus::Loaded);
+    EXPECT_EQ(calls.load(), 1);
+}
+
+TEST(PluginLoadSchedulerTest, ExclusiveItemsNeverOverlap)
+{
+    const std::vector items{
+        Item(1, {}, true),
+        Item(2, {}, true),
+        Item(3, {}, true),
+        Item(4),
+        Item(5)};
+    std::atomic<int> exclusive_running{0};
+    std::atomic<int> exclusive_peak{0};
+
+    RunPluginLoads(
+        items,
+        4,
+        [&](size_t index)
+        {
+            if (!items[index].exclusive)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds{10});
+                return DAS_S_OK;
+            }
+            const auto now = ++exclusive_running;
+            auto       seen = exclusive_peak.load();
+            while (now > seen
+                   && !exclusive_peak.compare_exchange_weak(seen, now))
+            {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            --exclusive_running;
+            return DAS_S_OK;
+        });
+
+    EXPECT_EQ(exclusive_peak.load(), 1);
+}
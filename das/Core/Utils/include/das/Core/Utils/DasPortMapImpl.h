@@ -1,6 +1,7 @@
 #ifndef DAS_CORE_UTILS_DASPORTMAPIMPL_H
 #define DAS_CORE_UTILS_DASPORTMAPIMPL_H
 
+#include <das/Core/ForeignInterfaceHost/DasStringAtom.h>
 #include <das/Core/Utils/Config.h>
 #include <das/DasBase.hpp>
 #include <das/DasString.hpp>
@@ -8,7 +9,7 @@
 #include <das/_autogen/idl/wrapper/Das.ExportInterface.IDasImage.hpp>
 #include <das/_autogen/idl/wrapper/Das.ExportInterface.IDasPortMap.Implements.hpp>
 #include <das/_autogen/idl/wrapper/Das.PluginInterface.IDasComponent.hpp>
-#include <map>
+#include <unordered_map>
 #include <variant>
 
 DAS_CORE_UTILS_NS_BEGIN
@@ -26,6 +27,10 @@ public:
         DasBase,
         Das::PluginInterface::DasComponent,
         std::monostate>;
+    /// 端口名以驻留原子为键，查找只需比较原子 ID
+    using EntryMap = std::unordered_map<
+        Das::Core::ForeignInterfaceHost::DasStringAtom,
+        Variant>;
 
     DasPortMapImpl() = default;
 
@@ -88,7 +93,9 @@ public:
     DAS_IMPL Remove(IDasReadOnlyString* p_port_id) override;
 
 private:
-    std::map<std::string, Variant> entries_{};
+    EntryMap entries_{};
+
+    EntryMap::iterator FindEntry(IDasReadOnlyString* p_port_id);
 };
 
 DAS_CORE_UTILS_NS_END
@@ -5,9 +5,15 @@
 #include <das/DasApi.h>
 #include <das/DasSwigApi.h>
 #include <das/Utils/CommonUtils.hpp>
+#include <algorithm>
+#include <vector>
 
 using DasVariantType = Das::ExportInterface::DasVariantType;
 
+using Das::Core::ForeignInterfaceHost::DasStringAtom;
+using Das::Core::ForeignInterfaceHost::FindStringAtom;
+using Das::Core::ForeignInterfaceHost::ToStringAtom;
+
 using Das::ExportInterface::DAS_VARIANT_TYPE_BASE;
 using Das::ExportInterface::DAS_VARIANT_TYPE_BOOL;
 using Das::ExportInterface::DAS_VARIANT_TYPE_COMPONENT;
@@ -21,6 +27,7 @@ DAS_CORE_UTILS_NS_BEGIN
 
 DAS_NS_ANONYMOUS_DETAILS_BEGIN
 
+// 仅用于错误日志
 std::string PortIdToString(IDasReadOnlyString* p_port_id)
 {
     if (p_port_id == nullptr)
@@ -64,6 +71,18 @@ DasVariantType VariantToType(const DasPortMapImpl::Variant& v)
 
 DAS_NS_ANONYMOUS_DETAILS_END
 
+// 只查询驻留表：从未驻留的端口名不可能是已有的键，无需插入
+DasPortMapImpl::EntryMap::iterator DasPortMapImpl::FindEntry(
+    IDasReadOnlyString* p_port_id)
+{
+    const auto atom = FindStringAtom(p_port_id);
+    if (!atom || !atom.value())
+    {
+        return entries_.end();
+    }
+    return entries_.find(*atom.value());
+}
+
 // ── Read-only methods ───────────────────────────────────────────────────
 
 DasResult DasPortMapImpl::Has(IDasReadOnlyString* p_port_id, bool* out_has)
@@ -71,8 +90,7 @@ DasResult DasPortMapImpl::Has(IDasReadOnlyString* p_port_id, bool* out_has)
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(out_has);
 
-    const auto key = Details::PortIdToString(p_port_id);
-    *out_has = entries_.contains(key);
+    *out_has = FindEntry(p_port_id) != entries_.end();
     return DAS_S_OK;
 }
 
@@ -83,11 +101,12 @@ DasResult DasPortMapImpl::GetType(
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(out_kind);
 
-    const auto key = Details::PortIdToString(p_port_id);
-    const auto it = entries_.find(key);
+    const auto it = FindEntry(p_port_id);
     if (it == entries_.end())
     {
-        DAS_CORE_LOG_ERROR("Port not found: key = {}.", key);
+        DAS_CORE_LOG_ERROR(
+            "Port not found: key = {}.",
+            Details::PortIdToString(p_port_id));
         return DAS_E_OUT_OF_RANGE;
     }
 
@@ -102,8 +121,7 @@ DasResult DasPortMapImpl::GetBool(
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(out_value);
 
-    const auto key = Details::PortIdToString(p_port_id);
-    const auto it = entries_.find(key);
+    const auto it = FindEntry(p_port_id);
     if (it == entries_.end())
     {
         return DAS_E_OUT_OF_RANGE;
@@ -128,8 +146,7 @@ DasResult DasPortMapImpl::GetInt(
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(out_value);
 
-    const auto key = Details::PortIdToString(p_port_id);
-    const auto it = entries_.find(key);
+    const auto it = FindEntry(p_port_id);
     if (it == entries_.end())
     {
         return DAS_E_OUT_OF_RANGE;
@@ -154,8 +171,7 @@ DasResult DasPortMapImpl::GetFloat(
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(out_value);
 
-    const auto key = Details::PortIdToString(p_port_id);
-    const auto it = entries_.find(key);
+    const auto it = FindEntry(p_port_id);
     if (it == entries_.end())
     {
         return DAS_E_OUT_OF_RANGE;
@@ -180,8 +196,7 @@ DasResult DasPortMapImpl::GetString(
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(pp_out_string);
 
-    const auto key = Details::PortIdToString(p_port_id);
-    const auto it = entries_.find(key);
+    const auto it = FindEntry(p_port_id);
     if (it == entries_.end())
     {
         return DAS_E_OUT_OF_RANGE;
@@ -214,8 +229,7 @@ DasResult DasPortMapImpl::GetImage(
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(pp_out_image);
 
-    const auto key = Details::PortIdToString(p_port_id);
-    const auto it = entries_.find(key);
+    const auto it = FindEntry(p_port_id);
     if (it == entries_.end())
     {
         return DAS_E_OUT_OF_RANGE;
@@ -248,8 +262,7 @@ DasResult DasPortMapImpl::GetBase(
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(pp_out_object);
 
-    const auto key = Details::PortIdToString(p_port_id);
-    const auto it = entries_.find(key);
+    const auto it = FindEntry(p_port_id);
     if (it == entries_.end())
     {
         return DAS_E_OUT_OF_RANGE;
@@ -286,8 +299,7 @@ DasResult DasPortMapImpl::GetComponent(
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(pp_out_component);
 
-    const auto key = Details::PortIdToString(p_port_id);
-    const auto it = entries_.find(key);
+    const auto it = FindEntry(p_port_id);
     if (it == entries_.end())
     {
         return DAS_E_OUT_OF_RANGE;
@@ -330,10 +342,28 @@ DasResult DasPortMapImpl::GetKeys(
         return result;
     }
 
-    for (const auto& [key, _] : entries_)
+    // 保持与原先 std::map 一致的字典序
+    std::vector<DasStringAtom> keys;
+    try
+    {
+        keys.reserve(entries_.size());
+        for (const auto& [key, _] : entries_)
+        {
+            keys.push_back(key);
+        }
+    }
+    catch (const std::bad_alloc&)
+    {
+        return DAS_E_OUT_OF_MEMORY;
+    }
+    std::ranges::sort(
+        keys,
+        {},
+        [](const DasStringAtom& key) { return key.View(); });
+
+    for (const auto& key : keys)
     {
-        DasReadOnlyString dos{key.c_str()};
-        result = p_keys->PushBack(dos.Get());
+        result = p_keys->PushBack(key.GetString());
         if (DAS::IsFailed(result))
         {
             return result;
@@ -353,10 +383,14 @@ DasResult DasPortMapImpl::SetInt(
 {
     DAS_UTILS_CHECK_POINTER(p_port_id);
 
-    const auto key = Details::PortIdToString(p_port_id);
+    const auto key = ToStringAtom(p_port_id);
+    if (!key)
+    {
+        return key.error();
+    }
     try
     {
-        entries_[key] = in_value;
+        entries_[*key] = in_value;
         return DAS_S_OK;
     }
     catch (const std::bad_alloc&)
@@ -371,10 +405,14 @@ DasResult DasPortMapImpl::SetFloat(
 {
     DAS_UTILS_CHECK_POINTER(p_port_id);
 
-    const auto key = Details::PortIdToString(p_port_id);
+    const auto key = ToStringAtom(p_port_id);
+    if (!key)
+    {
+        return key.error();
+    }
     try
     {
-        entries_[key] = in_value;
+        entries_[*key] = in_value;
         return DAS_S_OK;
     }
     catch (const std::bad_alloc&)
@@ -390,10 +428,14 @@ DasResult DasPortMapImpl::SetString(
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(in_value);
 
-    const auto key = Details::PortIdToString(p_port_id);
+    const auto key = ToStringAtom(p_port_id);
+    if (!key)
+    {
+        return key.error();
+    }
     try
     {
-        entries_[key] = DasReadOnlyString{in_value};
+        entries_[*key] = DasReadOnlyString{in_value};
         return DAS_S_OK;
     }
     catch (const std::bad_alloc&)
@@ -406,10 +448,14 @@ DasResult DasPortMapImpl::SetBool(IDasReadOnlyString* p_port_id, bool in_value)
 {
     DAS_UTILS_CHECK_POINTER(p_port_id);
 
-    const auto key = Details::PortIdToString(p_port_id);
+    const auto key = ToStringAtom(p_port_id);
+    if (!key)
+    {
+        return key.error();
+    }
     try
     {
-        entries_[key] = in_value;
+        entries_[*key] = in_value;
         return DAS_S_OK;
     }
     catch (const std::bad_alloc&)
@@ -425,10 +471,14 @@ DasResult DasPortMapImpl::SetImage(
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(p_image);
 
-    const auto key = Details::PortIdToString(p_port_id);
+    const auto key = ToStringAtom(p_port_id);
+    if (!key)
+    {
+        return key.error();
+    }
     try
     {
-        entries_[key] = Das::ExportInterface::DasImage{p_image};
+        entries_[*key] = Das::ExportInterface::DasImage{p_image};
         return DAS_S_OK;
     }
     catch (const std::bad_alloc&)
@@ -445,10 +495,14 @@ DasResult DasPortMapImpl::SetBase(
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(p_in_object);
 
-    const auto key = Details::PortIdToString(p_port_id);
+    const auto key = ToStringAtom(p_port_id);
+    if (!key)
+    {
+        return key.error();
+    }
     try
     {
-        entries_[key] = DasBase{p_in_object};
+        entries_[*key] = DasBase{p_in_object};
         return DAS_S_OK;
     }
     catch (const std::bad_alloc&)
@@ -465,7 +519,11 @@ DasResult DasPortMapImpl::SetComponent(
     DAS_UTILS_CHECK_POINTER(p_port_id);
     DAS_UTILS_CHECK_POINTER(p_in_component);
 
-    const auto key = Details::PortIdToString(p_port_id);
+    const auto key = ToStringAtom(p_port_id);
+    if (!key)
+    {
+        return key.error();
+    }
     try
     {
         // Use QueryInterface to safely verify the object supports
@@ -481,7 +539,7 @@ DasResult DasPortMapImpl::SetComponent(
                 static_cast<int>(hr));
             return DAS_E_NO_INTERFACE;
         }
-        entries_[key] = Das::PluginInterface::DasComponent{comp.Get()};
+        entries_[*key] = Das::PluginInterface::DasComponent{comp.Get()};
         return DAS_S_OK;
     }
     catch (const std::bad_alloc&)
@@ -500,13 +558,15 @@ DasResult DasPortMapImpl::Remove(IDasReadOnlyString* p_port_id)
 {
     DAS_UTILS_CHECK_POINTER(p_port_id);
 
-    const auto key = Details::PortIdToString(p_port_id);
-    const auto erased = entries_.erase(key);
-    if (erased == 0)
+    const auto it = FindEntry(p_port_id);
+    if (it == entries_.end())
     {
-        DAS_CORE_LOG_ERROR("Port not found for removal: key = {}.", key);
+        DAS_CORE_LOG_ERROR(
+            "Port not found for removal: key = {}.",
+            Details::PortIdToString(p_port_id));
         return DAS_E_OUT_OF_RANGE;
     }
+    entries_.erase(it);
     return DAS_S_OK;
 }
 
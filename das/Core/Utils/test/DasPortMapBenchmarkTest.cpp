@@ -0,0 +1,120 @@
+#include <das/DasPtr.hpp>
+#include <das/DasString.hpp>
+#include <das/_autogen/idl/abi/IDasPortMap.h>
+#include <das/_autogen/idl/header/IDasPortMap.generated.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// IDasPortMap get/set throughput
+//
+// Compares interned port-id keys (what DoAdapter and DasGraphTask now pass)
+// with keys built as ordinary DasReadOnlyString objects. Prints ops/s and
+// only asserts correctness, so it never fails on a slow machine.
+// ============================================================================
+
+namespace
+{
+    using IDasPortMap = Das::ExportInterface::IDasPortMap;
+
+    constexpr std::size_t kPortCount = 16;
+    constexpr std::size_t kRounds = 20000;
+
+    std::vector<DasReadOnlyString> MakeKeys(bool interned)
+    {
+        std::vector<DasReadOnlyString> keys;
+        keys.reserve(kPortCount);
+        for (std::size_t i = 0; i < kPortCount; ++i)
+        {
+            const auto name = "benchmark_port_" + std::to_string(i);
+            if (interned)
+            {
+                keys.push_back(
+                    DasReadOnlyString::FromUtf8Interned(name, nullptr));
+            }
+            else
+            {
+                keys.emplace_back(name.c_str());
+            }
+        }
+        return keys;
+    }
+
+    /// 每轮对所有端口各 Set 一次、Get 一次，返回每秒操作数
+    double RunSetGet(const std::vector<DasReadOnlyString>& keys)
+    {
+        DAS::DasPtr<IDasPortMap> map;
+        EXPECT_EQ(CreateIDasPortMap(map.Put()), DAS_S_OK);
+
+        int64_t    checksum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t round = 0; round < kRounds; ++round)
+        {
+            for (std::size_t i = 0; i < keys.size(); ++i)
+            {
+                const auto value = static_cast<int64_t>(round + i);
+                EXPECT_EQ(map->SetInt(keys[i].Get(), value), DAS_S_OK);
+
+                int64_t out = 0;
+                EXPECT_EQ(map->GetInt(keys[i].Get(), &out), DAS_S_OK);
+                checksum += out - value;
+            }
+        }
+        const auto elapsed = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+
+        EXPECT_EQ(checksum, 0);
+        const auto ops = static_cast<double>(kRounds * keys.size() * 2);
+        return elapsed > 0 ? ops / elapsed : 0;
+    }
+
+    void PrintThroughput(const char* name, double ops_per_second)
+    {
+        std::cout << "  " << std::left << std::setw(24) << name << std::fixed
+                  << std::setprecision(0) << ops_per_second << " ops/s\n";
+    }
+} // namespace
+
+TEST(DasPortMapBenchmarkTest, SetGetThroughput)
+{
+    const auto plain_keys = MakeKeys(false);
+    const auto interned_keys = MakeKeys(true);
+
+    const auto plain = RunSetGet(plain_keys);
+    const auto interned = RunSetGet(interned_keys);
+
+    std::cout << "\nIDasPortMap SetInt+GetInt, " << kPortCount << " ports x "
+              << kRounds << " rounds\n";
+    PrintThroughput("DasReadOnlyString keys:", plain);
+    PrintThroughput("Interned keys:", interned);
+}
+
+TEST(DasPortMapBenchmarkTest, PlainAndInternedKeysAddressSameEntry)
+{
+    DAS::DasPtr<IDasPortMap> map;
+    ASSERT_EQ(CreateIDasPortMap(map.Put()), DAS_S_OK);
+
+    DasReadOnlyString plain_key{"benchmark_shared"};
+    const auto        interned_key =
+        DasReadOnlyString::FromUtf8Interned("benchmark_shared", nullptr);
+
+    ASSERT_EQ(map->SetInt(plain_key.Get(), 7), DAS_S_OK);
+
+    int64_t out = 0;
+    ASSERT_EQ(map->GetInt(interned_key.Get(), &out), DAS_S_OK);
+    EXPECT_EQ(out, 7);
+
+    // 从未驻留的端口名查找失败且不会进入驻留表
+    DasReadOnlyString missing_key{"benchmark_missing"};
+    bool              has = true;
+    ASSERT_EQ(map->Has(missing_key.Get(), &has), DAS_S_OK);
+    EXPECT_FALSE(has);
+}
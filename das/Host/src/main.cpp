@@ -49,6 +49,12 @@ namespace
 {
     // 序列化辅助函数来自 HandshakeSerialization.h
 
+    // main 的每条返回路径（包括异常）都要先写完异步日志队列
+    struct LoggerShutdownGuard
+    {
+        ~LoggerShutdownGuard() { DasShutdownLogger(); }
+    };
+
     static DAS::DasPtr<DAS::Core::ForeignInterfaceHost::IForeignLanguageRuntime>
         g_runtime;
 
@@ -177,6 +183,7 @@ namespace
 
 int main(int argc, char* argv[])
 {
+    const LoggerShutdownGuard logger_shutdown_guard{};
     try
     {
         boost::program_options::options_description desc(
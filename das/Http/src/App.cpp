@@ -8,6 +8,7 @@
 #include "das/Utils/fmt.h"
 
 #include "./AppComponent.hpp"
+#include "./LogStreamHub.hpp"
 #include "./NotificationHub.hpp"
 #include "./beast/Server.hpp"
 #include "./controller/DasLogController.hpp"
@@ -450,6 +451,22 @@ namespace Das::Http
         server.SetHub(hub);
         components.notification_hub = hub;
 
+        // Push core logs to WebSocket subscribers (api/v1/logs/subscribe)
+        auto log_stream = std::make_shared<Das::Http::LogStreamHub>(hub);
+        if (DAS::IsOk(log_stream->Start()))
+        {
+            hub->SetMessageHandler(
+                [weak_log_stream = std::weak_ptr{log_stream}](
+                    const std::shared_ptr<Das::Http::WsSession>& session,
+                    std::string_view                             message)
+                {
+                    if (auto log_stream = weak_log_stream.lock())
+                    {
+                        log_stream->HandleMessage(session, message);
+                    }
+                });
+        }
+
         // Wire notify callbacks through COM interfaces → WebSocket broadcast
         // Core layer sends {"code","msg","data"}; we inject "api" here.
         components.settings_service->SetSettingsNotifyCallback(
@@ -511,6 +528,7 @@ namespace Das::Http
                   << listen_port << std::endl;
 
         server.Run();
+        log_stream->Stop();
 
         const auto shutdown_result = components.core_services->Shutdown();
         if (DAS::IsFailed(shutdown_result))
@@ -647,6 +665,8 @@ int main(int argc, const char* argv[])
         ws_config,
         listen_address,
         listen_port);
+    // run 返回时所有服务已经停止，写完剩余日志后再退出
+    DasShutdownLogger();
     if (DAS::IsFailed(run_result))
     {
         return run_result;
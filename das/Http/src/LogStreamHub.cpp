@@ -0,0 +1,580 @@
+#include "LogStreamHub.hpp"
+#include "beast/JsonUtils.hpp"
+#include "beast/Server.hpp" // for WsSession full definition
+#include "dto/Log.hpp"
+
+#include <algorithm>
+#include <array>
+#include <das/DasApi.h>
+#include <das/Utils/DasJsonCore.h>
+#include <das/Utils/fmt.h>
+#include <fstream>
+#include <iterator>
+
+namespace Das::Http
+{
+
+    namespace
+    {
+        constexpr std::array<std::string_view, 6> LEVEL_NAMES{
+            "trace",
+            "debug",
+            "info",
+            "warning",
+            "error",
+            "critical"};
+
+        LogStreamLevel ParseLevel(std::string_view name)
+        {
+            if (name == "warn")
+            {
+                return LogStreamLevel::Warning;
+            }
+            for (size_t i = 0; i < LEVEL_NAMES.size(); ++i)
+            {
+                if (LEVEL_NAMES[i] == name)
+                {
+                    return static_cast<LogStreamLevel>(i);
+                }
+            }
+            return LogStreamLevel::Unknown;
+        }
+
+        std::string LevelName(LogStreamLevel level)
+        {
+            const auto index = static_cast<size_t>(level);
+            return std::string{
+                index < LEVEL_NAMES.size() ? LEVEL_NAMES[index] : "unknown"};
+        }
+
+        struct ParsedLine
+        {
+            LogStreamLevel level{LogStreamLevel::Unknown};
+            size_t         source_pos{};
+            size_t         source_size{};
+        };
+
+        // 解析 Core 日志格式
+        // "[time][pid][tid][level][func()][file:line][id] msg"
+        // 中的等级与来源，无法解析的字段保持默认值
+        ParsedLine ParseLine(std::string_view line)
+        {
+            constexpr auto LEVEL_FIELD = 3;
+            constexpr auto SOURCE_FIELD = 5;
+
+            ParsedLine result{};
+            size_t     pos = 0;
+            for (int field = 0; field <= SOURCE_FIELD; ++field)
+            {
+                if (pos >= line.size() || line[pos] != '[')
+                {
+                    break;
+                }
+                const auto end = line.find(']', pos + 1);
+                if (end == std::string_view::npos)
+                {
+                    break;
+                }
+                if (field == LEVEL_FIELD)
+                {
+                    result.level =
+                        ParseLevel(line.substr(pos + 1, end - pos - 1));
+                }
+                else if (field == SOURCE_FIELD)
+                {
+                    result.source_pos = pos + 1;
+                    result.source_size = end - pos - 1;
+                }
+                pos = end + 1;
+            }
+            return result;
+        }
+
+        bool IsAccepted(
+            LogStreamLevel   level,
+            std::string_view source,
+            LogStreamLevel   min_level,
+            std::string_view source_filter)
+        {
+            // 无法解析等级的日志不按等级过滤
+            if (level != LogStreamLevel::Unknown && level < min_level)
+            {
+                return false;
+            }
+            return source_filter.empty()
+                   || source.find(source_filter) != std::string_view::npos;
+        }
+
+        void TrimLineEnd(std::string& line)
+        {
+            while (!line.empty()
+                   && (line.back() == '\n' || line.back() == '\r'))
+            {
+                line.pop_back();
+            }
+        }
+
+        // 与 spdlog rotating_file_sink 的命名一致：name.log -> name.1.log
+        std::filesystem::path RotatedLogPath(
+            const std::filesystem::path& base,
+            int                          index)
+        {
+            if (index == 0)
+            {
+                return base;
+            }
+            auto result = base.parent_path() / base.stem();
+            result += "." + std::to_string(index);
+            result += base.extension();
+            return result;
+        }
+
+        // 读取文件末尾至多 max_bytes 字节，按行追加到 out（旧 → 新）
+        uintmax_t ReadFileTail(
+            const std::filesystem::path& path,
+            uintmax_t                    max_bytes,
+            std::vector<std::string>&    out)
+        {
+            std::error_code ec;
+            const auto      size = std::filesystem::file_size(path, ec);
+            if (ec || size == 0 || max_bytes == 0)
+            {
+                return 0;
+            }
+
+            std::ifstream input{path, std::ios::binary};
+            if (!input)
+            {
+                return 0;
+            }
+            const auto offset = size > max_bytes ? size - max_bytes : 0;
+            input.seekg(static_cast<std::streamoff>(offset));
+
+            std::string line;
+            if (offset != 0)
+            {
+                // 丢弃被截断的第一行
+                std::getline(input, line);
+            }
+            while (std::getline(input, line))
+            {
+                TrimLineEnd(line);
+                if (!line.empty())
+                {
+                    out.push_back(std::move(line));
+                }
+            }
+            return size - offset;
+        }
+
+        std::string MakeNotification(const char* api, const yyjson::value& data)
+        {
+            auto notification =
+                Beast::JsonUtils::CreateWsNotification(DAS_S_OK, "", data);
+            auto obj_opt = notification.as_object();
+            if (obj_opt)
+            {
+                obj_opt.value()[std::string_view("api")] = std::string{api};
+            }
+            return Das::Utils::SerializeYyjsonValue(notification, false)
+                .value_or(std::string{});
+        }
+    } // namespace
+
+    LogStreamHub::LogStreamHub(
+        std::shared_ptr<NotificationHub> hub,
+        LogStreamOptions                 options)
+        : hub_(std::move(hub)), options_(std::move(options)),
+          timer_(hub_->IoCtx()), p_reader_(DAS::MakeDasPtr<DasHttpLogReader>())
+    {
+    }
+
+    LogStreamHub::~LogStreamHub() { Stop(); }
+
+    DasResult LogStreamHub::Start()
+    {
+        const auto result = ::CreateIDasLogRequester(
+            options_.requester_capacity,
+            p_requester_.Put());
+        if (DAS::IsFailed(result))
+        {
+            DAS_LOG_ERROR(
+                DAS_FMT_NS::format(
+                    "Failed to create log requester for log stream. result = {}",
+                    result)
+                    .c_str());
+            return result;
+        }
+
+        ScheduleTick();
+        return DAS_S_OK;
+    }
+
+    void LogStreamHub::Stop()
+    {
+        std::lock_guard lock(mutex_);
+        stopped_ = true;
+        timer_.cancel();
+    }
+
+    bool LogStreamHub::HandleMessage(
+        const std::shared_ptr<WsSession>& session,
+        std::string_view                  message)
+    {
+        auto parsed = Das::Utils::ParseYyjsonFromString(message);
+        if (!parsed || !parsed->is_object())
+        {
+            return false;
+        }
+
+        const auto api = Beast::JsonUtils::GetString(*parsed, "api");
+        if (api == DAS_HTTP_LOG_UNSUBSCRIBE_API)
+        {
+            std::lock_guard lock(mutex_);
+            subscribers_.erase(session.get());
+            return true;
+        }
+        if (api != DAS_HTTP_LOG_SUBSCRIBE_API)
+        {
+            return false;
+        }
+
+        auto data = Das::Utils::MakeYyjsonObject();
+        if (auto obj_opt = parsed->as_object())
+        {
+            const auto& obj = obj_opt.value();
+            data = Das::Utils::CloneYyjsonValue(obj["data"]);
+        }
+
+        const auto since_seq = Beast::JsonUtils::GetInt(data, "sinceSeq", -1);
+        auto       min_level =
+            ParseLevel(Beast::JsonUtils::GetString(data, "level", "trace"));
+        if (min_level == LogStreamLevel::Unknown)
+        {
+            min_level = LogStreamLevel::Trace;
+        }
+
+        Subscribe(
+            session,
+            since_seq,
+            min_level,
+            Beast::JsonUtils::GetString(data, "source"),
+            Beast::JsonUtils::GetBool(data, "history", false));
+        return true;
+    }
+
+    void LogStreamHub::Subscribe(
+        const std::shared_ptr<WsSession>& session,
+        int64_t                           since_seq,
+        LogStreamLevel                    min_level,
+        std::string                       source_filter,
+        bool                              with_history)
+    {
+        std::vector<std::string> history;
+        bool                     read_history = false;
+        {
+            std::lock_guard lock(mutex_);
+            // 超出当前序号的续传点来自上一次运行，按从头订阅处理
+            if (since_seq >= 0 && static_cast<uint64_t>(since_seq) >= next_seq_)
+            {
+                since_seq = 0;
+            }
+            const auto first_seq =
+                entries_.empty() ? next_seq_ : entries_.front().seq;
+            // 续传点之后的日志已不全在内存中时才需要读文件
+            read_history =
+                with_history && since_seq >= 0
+                && (since_seq == 0
+                    || static_cast<uint64_t>(since_seq) + 1 < first_seq);
+        }
+        if (read_history)
+        {
+            // 文件读取不持锁，避免阻塞推送
+            history = ReadHistory();
+        }
+
+        std::vector<std::string> frames;
+        {
+            std::lock_guard lock(mutex_);
+            DrainRequesterLocked();
+
+            Subscriber subscriber{
+                .session = session,
+                .min_level = min_level,
+                .source_filter = std::move(source_filter),
+                .next_seq = since_seq < 0
+                                ? next_seq_
+                                : static_cast<uint64_t>(since_seq) + 1};
+
+            if (read_history)
+            {
+                // 文件中也包含内存里最早的那些日志，从该处截断以免重复
+                if (!entries_.empty())
+                {
+                    const auto& oldest = entries_.front().text;
+                    const auto  it =
+                        std::find(history.rbegin(), history.rend(), oldest);
+                    if (it != history.rend())
+                    {
+                        history.erase(std::prev(it.base()), history.end());
+                    }
+                    subscriber.next_seq = entries_.front().seq;
+                }
+                else
+                {
+                    subscriber.next_seq = next_seq_;
+                }
+
+                Dto::LogStreamFrame frame{
+                    .first_seq = 0,
+                    .last_seq = 0,
+                    .missed = 0,
+                    .history = true,
+                    .logs = {}};
+                for (auto& line : history)
+                {
+                    const auto parsed = ParseLine(line);
+                    const auto source = std::string_view{line}.substr(
+                        parsed.source_pos,
+                        parsed.source_size);
+                    if (!IsAccepted(
+                            parsed.level,
+                            source,
+                            subscriber.min_level,
+                            subscriber.source_filter))
+                    {
+                        continue;
+                    }
+                    frame.logs.push_back(
+                        {.seq = 0,
+                         .level = LevelName(parsed.level),
+                         .text = std::move(line)});
+                    if (frame.logs.size() == options_.max_lines_per_frame)
+                    {
+                        frames.push_back(MakeNotification(
+                            DAS_HTTP_LOG_STREAM_API,
+                            yyjson::value(frame)));
+                        frame.logs.clear();
+                    }
+                }
+                if (!frame.logs.empty())
+                {
+                    frames.push_back(MakeNotification(
+                        DAS_HTTP_LOG_STREAM_API,
+                        yyjson::value(frame)));
+                }
+            }
+
+            frames.insert(
+                frames.begin(),
+                MakeNotification(
+                    DAS_HTTP_LOG_SUBSCRIBE_API,
+                    yyjson::value(
+                        Dto::LogStreamSubscribed{subscriber.next_seq})));
+
+            // 在持锁期间入队，保证历史帧先于后续的实时帧
+            for (auto& frame : frames)
+            {
+                session->WriteMessage(
+                    std::make_shared<std::string>(std::move(frame)));
+            }
+            subscribers_.insert_or_assign(session.get(), std::move(subscriber));
+        }
+    }
+
+    void LogStreamHub::ScheduleTick()
+    {
+        timer_.expires_after(options_.batch_interval);
+        timer_.async_wait(
+            [weak_self = weak_from_this()](boost::system::error_code ec)
+            {
+                if (ec)
+                {
+                    return;
+                }
+                if (auto self = weak_self.lock())
+                {
+                    self->OnTick();
+                }
+            });
+    }
+
+    void LogStreamHub::OnTick()
+    {
+        std::vector<std::pair<std::shared_ptr<WsSession>, std::string>> sends;
+        {
+            std::lock_guard lock(mutex_);
+            if (stopped_)
+            {
+                return;
+            }
+            DrainRequesterLocked();
+
+            for (auto it = subscribers_.begin(); it != subscribers_.end();)
+            {
+                auto session = it->second.session.lock();
+                if (!session)
+                {
+                    it = subscribers_.erase(it);
+                    continue;
+                }
+
+                // 客户端读得慢时暂停推送，next_seq 不动，跟上后再补发
+                const auto pending = session->PendingWriteCount();
+                if (pending < options_.max_pending_frames)
+                {
+                    for (auto& frame : ComposeFramesLocked(
+                             it->second,
+                             options_.max_pending_frames - pending))
+                    {
+                        sends.emplace_back(session, std::move(frame));
+                    }
+                }
+                ++it;
+            }
+            ScheduleTick();
+        }
+
+        for (auto& [session, frame] : sends)
+        {
+            hub_->Send(session, std::move(frame));
+        }
+    }
+
+    void LogStreamHub::DrainRequesterLocked()
+    {
+        if (!p_requester_)
+        {
+            return;
+        }
+
+        while (true)
+        {
+            const auto result = p_requester_->RequestOne(p_reader_.Get());
+            if (result == DAS_E_OUT_OF_RANGE)
+            {
+                break;
+            }
+            if (result == DAS_E_MAYBE_OVERFLOW)
+            {
+                // 读取跟不上写入，环形缓冲区中最旧的日志已被覆盖
+                DAS_LOG_WARNING(
+                    "Log requester ring overflowed. Some lines were lost.");
+                continue;
+            }
+            if (DAS::IsFailed(result))
+            {
+                DAS_LOG_ERROR(
+                    DAS_FMT_NS::format(
+                        "Failed to read log for log stream. result = {}",
+                        result)
+                        .c_str());
+                break;
+            }
+
+            auto text = p_reader_->TakeLog();
+            TrimLineEnd(text);
+            const auto parsed = ParseLine(text);
+            entries_.push_back(
+                {.seq = next_seq_++,
+                 .level = parsed.level,
+                 .source_pos = parsed.source_pos,
+                 .source_size = parsed.source_size,
+                 .text = std::move(text)});
+        }
+
+        while (entries_.size() > options_.retained_lines)
+        {
+            entries_.pop_front();
+        }
+    }
+
+    auto LogStreamHub::ComposeFramesLocked(
+        Subscriber& subscriber,
+        size_t      max_frames) -> std::vector<std::string>
+    {
+        std::vector<std::string> frames;
+        if (subscriber.next_seq >= next_seq_)
+        {
+            return frames;
+        }
+
+        const auto first_seq =
+            entries_.empty() ? next_seq_ : entries_.front().seq;
+        uint64_t missed = 0;
+        if (subscriber.next_seq < first_seq)
+        {
+            missed = first_seq - subscriber.next_seq;
+            subscriber.next_seq = first_seq;
+        }
+
+        auto index = static_cast<size_t>(subscriber.next_seq - first_seq);
+        while (frames.size() < max_frames
+               && (index < entries_.size() || missed != 0))
+        {
+            Dto::LogStreamFrame frame{
+                .first_seq = subscriber.next_seq,
+                .last_seq = subscriber.next_seq - 1,
+                .missed = missed,
+                .history = false,
+                .logs = {}};
+            for (; index < entries_.size()
+                   && frame.logs.size() < options_.max_lines_per_frame;
+                 ++index)
+            {
+                const auto& entry = entries_[index];
+                frame.last_seq = entry.seq;
+                const auto source = std::string_view{entry.text}.substr(
+                    entry.source_pos,
+                    entry.source_size);
+                if (IsAccepted(
+                        entry.level,
+                        source,
+                        subscriber.min_level,
+                        subscriber.source_filter))
+                {
+                    frame.logs.push_back(
+                        {.seq = entry.seq,
+                         .level = LevelName(entry.level),
+                         .text = entry.text});
+                }
+            }
+            subscriber.next_seq = frame.last_seq + 1;
+
+            // 全被过滤掉的批次不必推送，序号照常前进
+            if (!frame.logs.empty() || missed != 0)
+            {
+                frames.push_back(MakeNotification(
+                    DAS_HTTP_LOG_STREAM_API,
+                    yyjson::value(frame)));
+            }
+            missed = 0;
+        }
+        return frames;
+    }
+
+    auto LogStreamHub::ReadHistory() const -> std::vector<std::string>
+    {
+        // 从最新的文件往旧的文件读，直到用完字节预算
+        std::vector<std::vector<std::string>> files;
+        uintmax_t                             remaining =
+            options_.max_history_bytes;
+        for (int index = 0; index <= options_.rotated_files && remaining != 0;
+             ++index)
+        {
+            auto& lines = files.emplace_back();
+            remaining -= ReadFileTail(
+                RotatedLogPath(options_.log_file, index),
+                remaining,
+                lines);
+        }
+
+        std::vector<std::string> history;
+        for (auto it = files.rbegin(); it != files.rend(); ++it)
+        {
+            std::move(it->begin(), it->end(), std::back_inserter(history));
+        }
+        return history;
+    }
+
+} // namespace Das::Http
@@ -0,0 +1,167 @@
+#ifndef DAS_HTTP_LOG_STREAM_HUB_HPP
+#define DAS_HTTP_LOG_STREAM_HUB_HPP
+
+#include "NotificationHub.hpp"
+#include "component/DasHttpLogReader.h"
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <cstdint>
+#include <das/DasPtr.hpp>
+#include <das/_autogen/idl/abi/DasLogger.h>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#ifndef DAS_CORE_NAME
+#define DAS_CORE_NAME "DasCore"
+#endif
+
+namespace Das::Http
+{
+
+    constexpr static auto DAS_HTTP_LOG_STREAM_API = "api/v1/logs/stream";
+    constexpr static auto DAS_HTTP_LOG_SUBSCRIBE_API = "api/v1/logs/subscribe";
+    constexpr static auto DAS_HTTP_LOG_UNSUBSCRIBE_API =
+        "api/v1/logs/unsubscribe";
+
+    /**
+     * @brief 与 spdlog 的日志等级一一对应，Unknown 表示无法解析。
+     */
+    enum class LogStreamLevel : uint8_t
+    {
+        Trace,
+        Debug,
+        Info,
+        Warning,
+        Error,
+        Critical,
+        Unknown
+    };
+
+    struct LogStreamOptions
+    {
+        /// 批量推送的间隔，同一间隔内的日志合并为一帧
+        std::chrono::milliseconds batch_interval{100};
+        /// Core 侧 IDasLogRequester 环形缓冲区大小，需容纳一个间隔内的日志
+        uint32_t requester_capacity{8192};
+        /// 内存中保留的、可按序号续传的日志条数
+        size_t retained_lines{20000};
+        /// 单帧最多包含的日志条数
+        size_t max_lines_per_frame{500};
+        /// 单个会话未写完的帧数上限，超过后暂停推送直到客户端跟上
+        size_t max_pending_frames{8};
+        /// 订阅时从滚动日志文件读取历史的字节上限
+        uintmax_t max_history_bytes{4 * 1024 * 1024};
+        /// Core 滚动文件日志的路径与备份数，与 Core/Logger 保持一致
+        std::filesystem::path log_file{"logs/" DAS_CORE_NAME ".log"};
+        int                   rotated_files{2};
+    };
+
+    /**
+     * @brief 通过 WebSocket 推送 Core 日志。
+     *
+     * 定时从 IDasLogRequester 取出日志并分配递增序号，按订阅者的
+     * 等级/来源过滤后批量推送。客户端通过以下消息订阅：
+     *
+     * {"api":"api/v1/logs/subscribe",
+     *  "data":{"sinceSeq":0,"level":"info","source":"","history":true}}
+     *
+     * - sinceSeq: 已收到的最后一条序号，从其后续传；0 表示从头开始，
+     *   省略或为负数表示只要新日志
+     * - level: 最低等级（trace/debug/info/warning/error/critical）
+     * - source: 只推送源文件（file:line）包含该子串的日志
+     * - history: 续传点之后的日志已不全在内存中时，先从滚动日志文件
+     *   补发历史（history 帧，seq 为 0）
+     *
+     * 推送帧为 {"code","msg","api":"api/v1/logs/stream","data":{...}}，
+     * data 中 lastSeq 为本帧已处理到的序号，missed 为因缓冲区溢出
+     * 而丢失的条数。
+     *
+     * @thread_safety 所有公开方法均为线程安全。
+     */
+    class LogStreamHub : public std::enable_shared_from_this<LogStreamHub>
+    {
+    public:
+        LogStreamHub(
+            std::shared_ptr<NotificationHub> hub,
+            LogStreamOptions                 options = {});
+
+        ~LogStreamHub();
+
+        LogStreamHub(const LogStreamHub&) = delete;
+        LogStreamHub& operator=(const LogStreamHub&) = delete;
+
+        /**
+         * @brief 创建日志请求器并启动批量推送定时器。
+         */
+        DasResult Start();
+
+        /**
+         * @brief 停止推送定时器。
+         */
+        void Stop();
+
+        /**
+         * @brief 处理订阅/取消订阅消息。
+         *
+         * 在该会话的 executor 上调用（见 NotificationHub::HandleMessage）。
+         *
+         * @return 消息属于日志流时返回 true。
+         */
+        bool HandleMessage(
+            const std::shared_ptr<WsSession>& session,
+            std::string_view                  message);
+
+    private:
+        struct Entry
+        {
+            uint64_t       seq;
+            LogStreamLevel level;
+            /// text 中 [file:line] 字段的位置
+            size_t         source_pos;
+            size_t         source_size;
+            std::string    text;
+        };
+
+        struct Subscriber
+        {
+            std::weak_ptr<WsSession> session;
+            LogStreamLevel           min_level{LogStreamLevel::Trace};
+            std::string              source_filter;
+            /// 下一条待推送的序号
+            uint64_t                 next_seq{};
+        };
+
+        void ScheduleTick();
+        void OnTick();
+        void DrainRequesterLocked();
+        auto ComposeFramesLocked(Subscriber& subscriber, size_t max_frames)
+            -> std::vector<std::string>;
+        auto ReadHistory() const -> std::vector<std::string>;
+        void Subscribe(
+            const std::shared_ptr<WsSession>& session,
+            int64_t                           since_seq,
+            LogStreamLevel                    min_level,
+            std::string                       source_filter,
+            bool                              with_history);
+
+        std::shared_ptr<NotificationHub>               hub_;
+        LogStreamOptions                               options_;
+        boost::asio::steady_timer                      timer_;
+        DAS::DasPtr<DasHttpLogReader>                  p_reader_;
+        DAS::DasPtr<ExportInterface::IDasLogRequester> p_requester_;
+        std::mutex                                     mutex_;
+        std::deque<Entry>                              entries_;
+        uint64_t                                       next_seq_{1};
+        std::unordered_map<WsSession*, Subscriber>     subscribers_;
+        bool                                           stopped_{false};
+    };
+
+} // namespace Das::Http
+
+#endif // DAS_HTTP_LOG_STREAM_HUB_HPP
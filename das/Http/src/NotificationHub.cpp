@@ -54,6 +54,37 @@ namespace Das::Http
         }
     }
 
+    void NotificationHub::Send(
+        const std::shared_ptr<WsSession>& session,
+        std::string                       message)
+    {
+        auto shared_msg = std::make_shared<std::string>(std::move(message));
+        boost::asio::dispatch(
+            session->GetExecutor(),
+            [session, shared_msg]() { session->WriteMessage(shared_msg); });
+    }
+
+    void NotificationHub::SetMessageHandler(MessageHandler handler)
+    {
+        std::unique_lock lock(mutex_);
+        message_handler_ = std::move(handler);
+    }
+
+    void NotificationHub::HandleMessage(
+        const std::shared_ptr<WsSession>& session,
+        std::string_view                  message)
+    {
+        MessageHandler handler;
+        {
+            std::shared_lock lock(mutex_);
+            handler = message_handler_;
+        }
+        if (handler)
+        {
+            handler(session, message);
+        }
+    }
+
     size_t NotificationHub::ActiveConnectionCount() const
     {
         std::shared_lock lock(mutex_);
@@ -2,9 +2,11 @@
 #define DAS_HTTP_NOTIFICATION_HUB_HPP
 
 #include <boost/asio/io_context.hpp>
+#include <functional>
 #include <memory>
 #include <shared_mutex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Das::Http
@@ -29,6 +31,13 @@ namespace Das::Http
     class NotificationHub
     {
     public:
+        /**
+         * @brief 客户端消息处理函数，在该会话的 executor 上调用。
+         */
+        using MessageHandler = std::function<void(
+            const std::shared_ptr<WsSession>& session,
+            std::string_view                  message)>;
+
         /**
          * @brief 构造 Hub 并关联 io_context（用于 dispatch 写操作）。
          */
@@ -66,6 +75,30 @@ namespace Das::Http
          */
         void Broadcast(std::string message);
 
+        /**
+         * @brief 向单个 WebSocket 客户端发送消息。
+         *
+         * 与 Broadcast 相同，写操作 dispatch 到该会话的 executor。
+         *
+         * @param session 目标会话。
+         * @param message JSON 字符串，所有权转移给此函数。
+         */
+        void Send(
+            const std::shared_ptr<WsSession>& session,
+            std::string                       message);
+
+        /**
+         * @brief 设置客户端消息处理函数（如日志订阅）。
+         */
+        void SetMessageHandler(MessageHandler handler);
+
+        /**
+         * @brief 分发客户端发来的文本消息，由 WsSession 读循环调用。
+         */
+        void HandleMessage(
+            const std::shared_ptr<WsSession>& session,
+            std::string_view                  message);
+
         /**
          * @brief 获取活跃连接数（用于诊断）。
          */
@@ -79,6 +112,7 @@ namespace Das::Http
         boost::asio::io_context&              ioc_;
         mutable std::shared_mutex             mutex_;
         std::vector<std::weak_ptr<WsSession>> sessions_;
+        MessageHandler                        message_handler_;
     };
 
 } // namespace Das::Http
@@ -12,6 +12,7 @@
 #include <boost/config.hpp>
 #include <das/DasApi.h>
 #include <das/Utils/fmt.h>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -128,9 +129,10 @@ namespace Das::Http::Beast
 
     class WsSession : public std::enable_shared_from_this<WsSession>
     {
-        boost::beast::websocket::stream<tcp::socket> ws_;
-        std::shared_ptr<NotificationHub>             hub_;
-        std::mutex                                   write_mutex_;
+        boost::beast::websocket::stream<tcp::socket>   ws_;
+        std::shared_ptr<NotificationHub>               hub_;
+        std::mutex                                     write_mutex_;
+        std::deque<std::shared_ptr<const std::string>> write_queue_;
 
     public:
         WsSession(tcp::socket socket, std::shared_ptr<NotificationHub> hub)
@@ -188,18 +190,53 @@ namespace Das::Http::Beast
          */
         void WriteMessage(std::shared_ptr<const std::string> message)
         {
-            // Beast websocket::stream 不允许并发写
+            // Beast websocket::stream 不允许并发写，未完成的写入先排队
             std::lock_guard<std::mutex> lock(write_mutex_);
 
+            write_queue_.push_back(std::move(message));
+            if (write_queue_.size() == 1)
+            {
+                DoWriteLocked();
+            }
+        }
+
+        /**
+         * @brief 获取尚未写完的消息数（含正在写的一条），用于发送端背压。
+         */
+        size_t PendingWriteCount()
+        {
+            std::lock_guard<std::mutex> lock(write_mutex_);
+            return write_queue_.size();
+        }
+
+    private:
+        void DoWriteLocked()
+        {
             auto self = shared_from_this();
+            ws_.text(true);
             ws_.async_write(
-                boost::asio::buffer(*message),
-                [self,
-                 message](boost::beast::error_code ec, std::size_t /*bytes*/)
-                { boost::ignore_unused(ec); });
+                boost::asio::buffer(*write_queue_.front()),
+                [self](boost::beast::error_code ec, std::size_t /*bytes*/)
+                { self->OnWrite(ec); });
+        }
+
+        void OnWrite(boost::beast::error_code ec)
+        {
+            std::lock_guard<std::mutex> lock(write_mutex_);
+
+            // 队首消息写完后才出队，保证写入期间缓冲区有效
+            write_queue_.pop_front();
+            if (ec)
+            {
+                write_queue_.clear();
+                return;
+            }
+            if (!write_queue_.empty())
+            {
+                DoWriteLocked();
+            }
         }
 
-    private:
         void DoReadLoop()
         {
             auto self = shared_from_this();
@@ -222,7 +259,16 @@ namespace Das::Http::Beast
                         return;
                     }
 
-                    // 继续读取（客户端可发送 ping/subscribe 等消息）
+                    // 客户端可发送 ping/subscribe 等消息，交给 Hub 分发
+                    if (self->ws_.got_text())
+                    {
+                        self->hub_->HandleMessage(
+                            self,
+                            boost::beast::buffers_to_string(
+                                self->read_buffer_.data()));
+                    }
+                    self->read_buffer_.consume(self->read_buffer_.size());
+
                     self->DoReadLoop();
                 });
         }
@@ -12,3 +12,5 @@ DasResult DasHttpLogReader::ReadOne(IDasReadOnlyString* message)
 }
 
 std::string_view DasHttpLogReader::GetLog() const noexcept { return message_; }
+
+std::string DasHttpLogReader::TakeLog() noexcept { return std::move(message_); }
@@ -18,6 +18,10 @@ class DasHttpLogReader final
 public:
     [[nodiscard]]
     auto GetLog() const noexcept -> std::string_view;
+
+    /// 取走最近读到的日志，避免再拷贝一次
+    [[nodiscard]]
+    auto TakeLog() noexcept -> std::string;
 };
 
 #endif // DAS_HTTP_COMPONENT_DASHTTPLOGREADER_H
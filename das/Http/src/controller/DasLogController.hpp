@@ -58,6 +58,12 @@ namespace Das::Http
                     response.code = DAS_S_OK;
                     break;
                 }
+                else if (error_code == DAS_E_MAYBE_OVERFLOW)
+                {
+                    // 两次轮询之间日志超出缓冲区，最旧的部分已丢失
+                    DAS_LOG_WARNING(
+                        "Log requester ring overflowed. Some lines were lost.");
+                }
                 else
                 {
                     DAS_LOG_ERROR(std::to_string(error_code).c_str());
@@ -18,6 +18,30 @@ namespace Das::Http::Dto
 
     using Logs = ApiResponse<LogsData>;
 
+    // WebSocket 日志流中的一条日志，history 帧中 seq 为 0
+    struct LogStreamLine
+    {
+        uint64_t    seq;
+        std::string level;
+        std::string text;
+    };
+
+    // WebSocket 日志流推送帧
+    struct LogStreamFrame
+    {
+        uint64_t                   first_seq;
+        uint64_t                   last_seq;
+        uint64_t                   missed;
+        bool                       history;
+        std::vector<LogStreamLine> logs;
+    };
+
+    // 订阅成功后的应答，next_seq 为下一条推送日志的序号
+    struct LogStreamSubscribed
+    {
+        uint64_t next_seq;
+    };
+
 } // namespace Das::Http::Dto
 
 #endif // DAS_HTTP_DTO_LOG_HPP
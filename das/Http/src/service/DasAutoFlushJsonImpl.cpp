@@ -57,6 +57,11 @@ namespace Das::Http
           plugin_guid_{std::move(plugin_guid)},
           whitelist_{std::move(whitelist)}, path_prefix_{std::move(path_prefix)}
     {
+        init_result_ = CreateReadOnlyString(profile_id_.c_str(), p_profile_id_);
+        if (DAS::IsOk(init_result_))
+        {
+            init_result_ = DasMakeDasGuid(plugin_guid_.c_str(), &guid_);
+        }
     }
 
     // ── Private helpers ──
@@ -114,14 +119,7 @@ namespace Das::Http
     std::optional<yyjson::value> DasAutoFlushJsonImpl::GetField(
         const std::string& full_path)
     {
-        DasPtr<IDasReadOnlyString> p_profile_id;
-        if (DAS::IsFailed(
-                CreateReadOnlyString(profile_id_.c_str(), p_profile_id)))
-        {
-            return std::nullopt;
-        }
-        DasGuid guid;
-        if (DAS::IsFailed(DasMakeDasGuid(plugin_guid_.c_str(), &guid)))
+        if (DAS::IsFailed(init_result_))
         {
             return std::nullopt;
         }
@@ -133,8 +131,8 @@ namespace Das::Http
 
         DasPtr<IDasJson> json_result;
         auto             result = settings_service_.GetPluginSettingsField(
-            p_profile_id.Get(),
-            &guid,
+            p_profile_id_.Get(),
+            &guid_,
             p_field.Get(),
             json_result.Put());
         if (DAS::IsFailed(result))
@@ -148,53 +146,33 @@ namespace Das::Http
         const std::string&   full_path,
         const yyjson::value& value)
     {
-        DasPtr<IDasReadOnlyString> p_profile_id;
-        auto cr = CreateReadOnlyString(profile_id_.c_str(), p_profile_id);
-        if (DAS::IsFailed(cr))
-        {
-            return cr;
-        }
-        DasGuid guid;
-        cr = DasMakeDasGuid(plugin_guid_.c_str(), &guid);
-        if (DAS::IsFailed(cr))
+        if (DAS::IsFailed(init_result_))
         {
-            return cr;
+            return init_result_;
         }
         DasPtr<IDasReadOnlyString> p_field;
-        cr = CreateReadOnlyString(full_path.c_str(), p_field);
+        auto cr = CreateReadOnlyString(full_path.c_str(), p_field);
         if (DAS::IsFailed(cr))
         {
             return cr;
         }
 
-        // Serialize yyjson value to create IDasJson
-        auto serialized = Das::Utils::SerializeYyjsonValue(value);
-        if (!serialized)
-        {
-            return DAS_E_INVALID_JSON;
-        }
-
-        auto* p_json_value = new DasHttpJson(serialized->c_str());
+        // Wrap a copy of the value directly instead of serializing it to a
+        // string and parsing it back.
+        auto* p_json_value = new DasHttpJson(value);
         p_json_value->AddRef();
         DasPtr<IDasJson> json_value = DasPtr<IDasJson>::Attach(p_json_value);
 
         return settings_service_.UpdatePluginSettingsField(
-            p_profile_id.Get(),
-            &guid,
+            p_profile_id_.Get(),
+            &guid_,
             p_field.Get(),
             json_value.Get());
     }
 
     std::optional<yyjson::value> DasAutoFlushJsonImpl::GetCurrentJson()
     {
-        DasPtr<IDasReadOnlyString> p_profile_id;
-        if (DAS::IsFailed(
-                CreateReadOnlyString(profile_id_.c_str(), p_profile_id)))
-        {
-            return std::nullopt;
-        }
-        DasGuid guid;
-        if (DAS::IsFailed(DasMakeDasGuid(plugin_guid_.c_str(), &guid)))
+        if (DAS::IsFailed(init_result_))
         {
             return std::nullopt;
         }
@@ -203,8 +181,8 @@ namespace Das::Http
         {
             DasPtr<IDasJson> json_result;
             auto             result = settings_service_.GetPluginSettings(
-                p_profile_id.Get(),
-                &guid,
+                p_profile_id_.Get(),
+                &guid_,
                 json_result.Put());
             if (DAS::IsFailed(result))
             {
@@ -221,8 +199,8 @@ namespace Das::Http
 
         DasPtr<IDasJson> json_result;
         auto             result = settings_service_.GetPluginSettingsField(
-            p_profile_id.Get(),
-            &guid,
+            p_profile_id_.Get(),
+            &guid_,
             p_field.Get(),
             json_result.Put());
         if (DAS::IsFailed(result))
@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <cpp_yyjson.hpp>
+#include <das/DasPtr.hpp>
 #include <das/IDasSettingsService.h>
 #include <das/Utils/DasJsonCore.h>
 #include <das/_autogen/idl/abi/DasJson.h>
@@ -14,7 +15,8 @@ namespace Das::Http
 {
 
     /**
-     * @brief IDasJson 实现：通过 IDasSettingsService 读写，每次 Set 自动落盘。
+     * @brief IDasJson 实现：通过 IDasSettingsService 读写，每次 Set 立即提交，
+     * 由 SettingsManager 负责落盘（可能是延迟批量写入）。
      * 持有 IDasSettingsService& 引用，调用方需保证接口实现存活。
      * 白名单外的字段访问返回 DAS_E_ACCESS_DENIED。
      * 支持 path_prefix_ 实现嵌套 JSON 子对象访问。
@@ -87,6 +89,10 @@ namespace Das::Http
         std::string                     plugin_guid_;
         std::unordered_set<std::string> whitelist_;
         std::string                     path_prefix_;
+        // 构造时创建一次，避免每次读写都重新创建字符串、解析 GUID
+        DasPtr<IDasReadOnlyString> p_profile_id_;
+        DasGuid                    guid_{};
+        DasResult                  init_result_{DAS_S_OK};
 
         DasResult CheckWhitelist(IDasReadOnlyString* key, std::string& out_key);
 
@@ -26,12 +26,16 @@
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <das/Core/IPC/AsyncOperationImpl.h>
 #include <das/Core/IPC/DasAsyncSender.h>
 #include <das/Core/IPC/HostLauncher.h>
 #include <das/Core/IPC/HttpIpcServer.h>
+#include <das/Core/IPC/IPCProxyBase.h>
+#include <das/Core/IPC/IpcCallBatch.h>
 #include <das/Core/IPC/MainProcess/IIpcContext.h>
 #include <das/Core/IPC/MainProcess/IpcContext.h>
+#include <das/Core/IPC/ProxyFactory.h>
 #include <das/Core/Utils/StdExecution.h>
 #include <das/DasPtr.hpp>
 #include <das/DasString.hpp>
@@ -977,6 +981,133 @@ TEST_F(IpcPerformanceTest, RoundTripLatency_Compute)
         throughput);
 }
 
+// ====== RoundTripLatency_Compute_Batched ======
+//
+// 与 RoundTripLatency_Compute 相同的调用，但每 kBatchSize 个调用通过
+// IpcCallBatch 录制后合并为一个 BATCH 帧发送。统计的是每次调用的
+// 平摊延迟（批次往返时间 / kBatchSize），可直接与非批量版本对比。
+
+TEST_F(IpcPerformanceTest, RoundTripLatency_Compute_Batched)
+{
+    if (!std::filesystem::exists(host_exe_path_))
+    {
+        GTEST_SKIP() << "DasHostX.exe not found";
+    }
+
+    auto launcher = StartSingleHost();
+    if (!launcher)
+    {
+        GTEST_SKIP() << "Failed to start Host process";
+    }
+
+    auto component = LoadTestPlugin2(launcher.Get());
+    if (!component)
+    {
+        GTEST_SKIP() << "Failed to load IpcTestPlugin2";
+    }
+
+    constexpr size_t kBatchSize = 32;
+    constexpr size_t kWarmupBatches = 4;
+    constexpr size_t kIterations = 10000;
+    constexpr size_t kBatches = kIterations / kBatchSize;
+
+    auto params = CreateComputeParams("add", 42, 58);
+
+    // 录制并发送一个批次，返回失败的调用数
+    auto run_batch = [&component, &params]() -> size_t
+    {
+        DasReadOnlyString method_name{"compute"};
+        std::vector<DAS::ExportInterface::DasVariantVector> results(kBatchSize);
+
+        DAS::Core::IPC::IpcCallBatch batch;
+        {
+            DAS::Core::IPC::IpcCallBatch::RecordScope scope{batch};
+            for (auto& result : results)
+            {
+                const DasResult record_result = component->Dispatch(
+                    method_name.Get(),
+                    params.Get(),
+                    result.Put());
+                if (record_result != DAS_E_IPC_CALL_BATCHED)
+                {
+                    return kBatchSize;
+                }
+            }
+        }
+
+        auto responses = stdexec::sync_wait(
+            DAS::Core::IPC::when_all_calls(std::move(batch)));
+        if (!responses)
+        {
+            return kBatchSize;
+        }
+
+        size_t failures = 0;
+        for (const auto& [ipc_result, body, flags] : std::get<0>(*responses))
+        {
+            (void)flags;
+            int32_t remote_result = DAS_E_UNDEFINED_RETURN_VALUE;
+            if (DAS::IsOk(ipc_result) && body.size() >= sizeof(remote_result))
+            {
+                std::memcpy(&remote_result, body.data(), sizeof(remote_result));
+            }
+            if (DAS::IsFailed(ipc_result) || DAS::IsFailed(remote_result))
+            {
+                ++failures;
+            }
+        }
+        return failures;
+    };
+
+    // Warmup: discard first N batches
+    for (size_t i = 0; i < kWarmupBatches; ++i)
+    {
+        ASSERT_EQ(run_batch(), 0u);
+    }
+
+    // Suppress logs during measurement
+    SuppressLogDuringBenchmark log_guard;
+
+    std::vector<double> latencies;
+    latencies.reserve(kBatches);
+
+    size_t failures = 0;
+    for (size_t i = 0; i < kBatches; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        failures += run_batch();
+        auto end = std::chrono::steady_clock::now();
+
+        double latency_us =
+            std::chrono::duration<double, std::micro>(end - start).count();
+        latencies.push_back(latency_us / static_cast<double>(kBatchSize));
+    }
+    EXPECT_EQ(failures, 0u);
+
+    double mean = das::benchmark::CalculateMean(latencies);
+    double p50 = das::benchmark::CalculatePercentile(latencies, 50);
+    double p95 = das::benchmark::CalculatePercentile(latencies, 95);
+    double p99 = das::benchmark::CalculatePercentile(latencies, 99);
+    auto [min_it, max_it] =
+        std::minmax_element(latencies.begin(), latencies.end());
+    double min_val = *min_it;
+    double max_val = *max_it;
+    double total_s = mean * static_cast<double>(kBatches * kBatchSize) / 1e6;
+    double throughput = static_cast<double>(kBatches * kBatchSize) / total_s;
+
+    PrintBenchmarkResult(
+        "RoundTripLatency_Compute_Batched",
+        kBatches * kBatchSize,
+        "compute(\"add\", 42, 58) x32 per BATCH frame (per-call latency)",
+        mean,
+        p50,
+        p95,
+        p99,
+        min_val,
+        max_val,
+        throughput);
+}
+
 // ====== Task 4: RoundTripLatency_Echo_SmallString ======
 
 TEST_F(IpcPerformanceTest, RoundTripLatency_Echo_SmallString)
@@ -1979,6 +2110,17 @@ TEST_F(IpcPerformanceTest, RemoteProxy_IsSupported_FirstCall)
         }
     }
 
+    // 统计远程 QueryInterface 与本地缓存命中的次数
+    DAS::Core::IPC::IPCProxyBase* runtime_tag = nullptr;
+    if (DAS::IsFailed(raw_proxy->QueryInterface(
+            DasIidOf<DAS::Core::IPC::IPCProxyBase>(),
+            reinterpret_cast<void**>(&runtime_tag))))
+    {
+        GTEST_SKIP() << "QueryInterface(IPCProxyBase) failed";
+    }
+    auto&      proxy_factory = runtime_tag->GetProxyFactory();
+    const auto qi_before = proxy_factory.GetQueryInterfaceStats();
+
     SuppressLogDuringBenchmark log_guard;
 
     constexpr size_t    kIterations = 1000;
@@ -2026,6 +2168,13 @@ TEST_F(IpcPerformanceTest, RemoteProxy_IsSupported_FirstCall)
         min_val,
         max_val,
         throughput);
+
+    const auto qi_after = proxy_factory.GetQueryInterfaceStats();
+    static_cast<void>(runtime_tag->ReleaseRuntimeTagRef());
+    std::cout << "  QueryInterface: "
+              << qi_after.remote_calls - qi_before.remote_calls
+              << " remote, " << qi_after.local_hits - qi_before.local_hits
+              << " answered from cache\n";
 }
 
 // ====== Task 8: Stress_HighFrequency_Dispatch ======
@@ -10,12 +10,9 @@
 #include <Windows.h>
 #endif // WIN32
 
-#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <cstring>
 #include <memory>
-#include <zlib.h>
 
 #include "AdbCaptureImpl.h"
 #include "ErrorLensImpl.h"
@@ -25,6 +22,7 @@ DAS_DISABLE_WARNING_BEGIN
 DAS_IGNORE_BOOST_PROCESS_WARNING
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <boost/asio.hpp>
 #include <boost/pfr.hpp>
@@ -42,50 +40,13 @@ DAS_IGNORE_BOOST_PROCESS_WARNING
 #include <limits>
 #include <sstream>
 #include <system_error>
+#include <utility>
 #include <vector>
 
 DAS_DISABLE_WARNING_END
 
 DAS_NS_BEGIN
 
-/**
- * @brief reference from
- *  <a
- * href="https://developer.android.com/reference/android/graphics/PixelFormat">PixelFormat</a>
- *  <a
- * href="https://android.googlesource.com/platform/frameworks/base/+/android-4.3_r2.3/cmds/screencap/screencap.cpp">screencap.cpp
- * in Android 4.23</a> <a
- * href="https://android.googlesource.com/platform/frameworks/base/+/refs/heads/android-s-beta-4/cmds/screencap/screencap.cpp">screencap.cpp
- * in Android S Beta 4</a> \n NOTE: kN32_SkColorType selects native 32-bit
- * ARGB format.\n On little endian processors, pixels containing 8-bit ARGB
- * components pack into 32-bit kBGRA_8888_SkColorType.\n On big endian
- * processors, pixels pack into 32-bit kRGBA_8888_SkColorType.\n In this plugin,
- * we assume kN32_SkColorType is RGBA_8888.
- */
-enum class AdbCaptureFormat : uint32_t
-{
-    RGBA_8888 = 1,
-    RGBX_8888 = 2,
-    RGB_888 = 3,
-    RGB_565 = 4
-};
-
-constexpr std::size_t ADB_CAPTURE_HEADER_SIZE = 16;
-
-struct AdbCaptureHeader
-{
-    uint32_t width;
-    uint32_t height;
-    uint32_t format;
-    uint32_t dataspace;
-};
-
-static_assert(sizeof(AdbCaptureHeader) == ADB_CAPTURE_HEADER_SIZE);
-static_assert(offsetof(AdbCaptureHeader, width) == 0);
-static_assert(offsetof(AdbCaptureHeader, height) == 4);
-static_assert(offsetof(AdbCaptureHeader, format) == 8);
-static_assert(offsetof(AdbCaptureHeader, dataspace) == 12);
-
 AdbCapture::AdbCapture(
     const std::filesystem::path& adb_path,
     std::string_view             adb_device_serial)
@@ -100,7 +61,10 @@ AdbCapture::AdbCapture(
       get_screen_size_command_{DAS::fmt::format(
           R"({} -s {} shell dumpsys window displays | grep -o -E cur=+[^\\ ]+ | grep -o -E [0-9]+)",
           DAS::Utils::U8AsString(adb_path.u8string()),
-          adb_device_serial)}
+          adb_device_serial)},
+      screencap_session_{std::make_unique<AdbScreencapSession>(
+          std::string{adb_device_serial},
+          AdbServerEndpoint::FromEnvironment())}
 {
 }
 
@@ -110,46 +74,6 @@ DAS_NS_ANONYMOUS_DETAILS_BEGIN
 
 constexpr uint32_t PROCESS_TIMEOUT_IN_S = 10;
 
-enum class InflateMode
-{
-    StopWhenOutputFull,
-    RequireExactOutputSize
-};
-
-class InflateStream final : public DAS::Utils::NonCopyableAndNonMovable
-{
-public:
-    InflateStream() = default;
-
-    DasResult Init()
-    {
-        if (const auto result = inflateInit2(&stream_, 15 + 32); result != Z_OK)
-            [[unlikely]]
-        {
-            const auto error_message =
-                DAS::fmt::format("inflateInit2 failed, result={}.", result);
-            DAS_LOG_ERROR(error_message.c_str());
-            return DAS_E_INTERNAL_FATAL_ERROR;
-        }
-        initialized_ = true;
-        return DAS_S_OK;
-    }
-
-    ~InflateStream()
-    {
-        if (initialized_)
-        {
-            inflateEnd(&stream_);
-        }
-    }
-
-    z_stream& Get() noexcept { return stream_; }
-
-private:
-    z_stream stream_{};
-    bool     initialized_{false};
-};
-
 class PayloadMemoryView final : public ExportInterface::IDasMemory
 {
 public:
@@ -271,189 +195,6 @@ private:
     DasPtr<ExportInterface::IDasBinaryBuffer> payload_buffer_;
 };
 
-bool TryMultiplyUint64(
-    const uint64_t lhs,
-    const uint64_t rhs,
-    uint64_t*      p_out_value) noexcept
-{
-    if (lhs != 0 && rhs > std::numeric_limits<uint64_t>::max() / lhs)
-    {
-        return false;
-    }
-    *p_out_value = lhs * rhs;
-    return true;
-}
-
-DasResult InflateGzipToBuffer(
-    const char*    p_compressed_data,
-    std::size_t    compressed_size,
-    unsigned char* p_output_data,
-    std::size_t    output_size,
-    InflateMode    mode,
-    std::size_t*   p_out_bytes_written)
-{
-    if (p_out_bytes_written == nullptr) [[unlikely]]
-    {
-        return DAS_E_INVALID_POINTER;
-    }
-    *p_out_bytes_written = 0;
-    if (p_compressed_data == nullptr || compressed_size == 0) [[unlikely]]
-    {
-        DAS_LOG_ERROR("InflateGzipToBuffer received empty gzip input.");
-        return CAPTURE_DATA_TOO_LESS;
-    }
-    if (p_output_data == nullptr && output_size != 0) [[unlikely]]
-    {
-        return DAS_E_INVALID_POINTER;
-    }
-
-    InflateStream inflate_stream;
-    if (const auto init_result = inflate_stream.Init(); IsFailed(init_result))
-        [[unlikely]]
-    {
-        return init_result;
-    }
-
-    auto&         stream = inflate_stream.Get();
-    std::size_t   input_offset = 0;
-    std::size_t   output_base = 0;
-    std::size_t   output_chunk_size = 0;
-    bool          writing_overflow_probe = false;
-    unsigned char overflow_probe = 0;
-
-    const auto refresh_input = [&]()
-    {
-        if (stream.avail_in != 0 || input_offset >= compressed_size)
-        {
-            return;
-        }
-        const auto chunk_size =
-            (std::min)(compressed_size - input_offset,
-                       static_cast<std::size_t>(
-                           std::numeric_limits<uInt>::max()));
-        stream.next_in = reinterpret_cast<Bytef*>(
-            const_cast<char*>(p_compressed_data + input_offset));
-        stream.avail_in = static_cast<uInt>(chunk_size);
-        input_offset += chunk_size;
-    };
-
-    const auto bytes_written = [&]() -> std::size_t
-    {
-        if (writing_overflow_probe)
-        {
-            return output_size + (1U - stream.avail_out);
-        }
-        return output_base + output_chunk_size - stream.avail_out;
-    };
-
-    const auto refresh_output = [&]() -> bool
-    {
-        if (stream.avail_out != 0)
-        {
-            return true;
-        }
-
-        if (!writing_overflow_probe)
-        {
-            output_base += output_chunk_size;
-            output_chunk_size = 0;
-        }
-
-        if (output_base < output_size)
-        {
-            const auto chunk_size =
-                (std::min)(output_size - output_base,
-                           static_cast<std::size_t>(
-                               std::numeric_limits<uInt>::max()));
-            stream.next_out = p_output_data + output_base;
-            stream.avail_out = static_cast<uInt>(chunk_size);
-            output_chunk_size = chunk_size;
-            return true;
-        }
-
-        if (mode == InflateMode::StopWhenOutputFull)
-        {
-            *p_out_bytes_written = output_size;
-            return false;
-        }
-
-        writing_overflow_probe = true;
-        stream.next_out = &overflow_probe;
-        stream.avail_out = 1;
-        output_chunk_size = 1;
-        return true;
-    };
-
-    for (;;)
-    {
-        refresh_input();
-        if (!refresh_output())
-        {
-            return DAS_S_OK;
-        }
-
-        const auto before_avail_in = stream.avail_in;
-        const auto before_avail_out = stream.avail_out;
-        const auto inflate_result = inflate(&stream, Z_NO_FLUSH);
-        const auto written = bytes_written();
-        *p_out_bytes_written = written > output_size ? output_size : written;
-
-        if (inflate_result == Z_STREAM_END)
-        {
-            if (mode == InflateMode::RequireExactOutputSize
-                && written != output_size) [[unlikely]]
-            {
-                const auto error_message = DAS::fmt::format(
-                    "ADB gzip decompressed size mismatch: expected={}, actual={}.",
-                    output_size,
-                    written);
-                DAS_LOG_ERROR(error_message.c_str());
-                return CAPTURE_DATA_TOO_LESS;
-            }
-            if (mode == InflateMode::RequireExactOutputSize
-                && (stream.avail_in != 0 || input_offset < compressed_size))
-                [[unlikely]]
-            {
-                const auto remaining_input =
-                    static_cast<std::size_t>(stream.avail_in)
-                    + (compressed_size - input_offset);
-                const auto error_message = DAS::fmt::format(
-                    "ADB gzip stream ended with trailing input: remaining={}.",
-                    remaining_input);
-                DAS_LOG_ERROR(error_message.c_str());
-                return CAPTURE_DATA_TOO_LESS;
-            }
-            return DAS_S_OK;
-        }
-
-        if (inflate_result != Z_OK) [[unlikely]]
-        {
-            const auto error_message = DAS::fmt::format(
-                "ADB gzip inflate failed: result={}, message={}.",
-                inflate_result,
-                stream.msg != nullptr ? stream.msg : "");
-            DAS_LOG_ERROR(error_message.c_str());
-            return CAPTURE_DATA_TOO_LESS;
-        }
-
-        if (writing_overflow_probe && stream.avail_out == 0) [[unlikely]]
-        {
-            const auto error_message = DAS::fmt::format(
-                "ADB gzip decompressed output is longer than expected: expected={}.",
-                output_size);
-            DAS_LOG_ERROR(error_message.c_str());
-            return CAPTURE_DATA_TOO_LESS;
-        }
-
-        if (stream.avail_in == before_avail_in
-            && stream.avail_out == before_avail_out) [[unlikely]]
-        {
-            DAS_LOG_ERROR("ADB gzip inflate made no progress.");
-            return CAPTURE_DATA_TOO_LESS;
-        }
-    }
-}
-
 template <class Buffer>
 struct CommandExecutorContext : public DAS::Utils::NonCopyableAndNonMovable
 {
@@ -577,85 +318,125 @@ public:
     ~CommandExecutorContext() = default;
 };
 
-AdbCaptureHeader ResolveHeader(const char* p_header)
+DAS::Utils::Expected<ExportInterface::DasImageFormat> Convert(
+    const AdbCaptureFormat format)
 {
-    AdbCaptureHeader header;
-    std::memcpy(&header, p_header, sizeof(AdbCaptureHeader));
-    return header;
+    switch (format)
+    {
+        using enum AdbCaptureFormat;
+    case RGBA_8888:
+        [[likely]] return ExportInterface::DAS_IMAGE_FORMAT_RGBA_8888;
+    case RGBX_8888:
+        return ExportInterface::DAS_IMAGE_FORMAT_RGBX_8888;
+    case RGB_888:
+        return ExportInterface::DAS_IMAGE_FORMAT_RGB_888;
+    default:
+        return tl::make_unexpected(UNSUPPORTED_COLOR_FORMAT);
+    }
 }
 
-auto ComputeDataSizeFromHeader(const AdbCaptureHeader header)
-    -> DAS::Utils::Expected<std::size_t>
+DasResult CreateImageFromFrame(
+    const AdbCaptureFrame&       frame,
+    ExportInterface::IDasImage** pp_out_image)
 {
-    if (header.width == 0 || header.height == 0)
+    DasPtr<ExportInterface::IDasBinaryBuffer> payload_buffer;
+    const auto get_buffer_result = frame.memory->GetBinaryBuffer(
+        ADB_CAPTURE_HEADER_SIZE,
+        payload_buffer.Put());
+    if (!IsOk(get_buffer_result)) [[unlikely]]
     {
-        const auto error_message = DAS::fmt::format(
-            "Invalid framebuffer dimensions: {}x{}",
-            header.width,
-            header.height);
-        DAS_LOG_ERROR(error_message.c_str());
-        return tl::make_unexpected(CAPTURE_DATA_TOO_LESS);
+        return get_buffer_result;
     }
-
-    uint64_t bytes_per_pixel = 0;
-    switch (static_cast<AdbCaptureFormat>(header.format))
+    if (!payload_buffer) [[unlikely]]
     {
-    case AdbCaptureFormat::RGBA_8888:
-    case AdbCaptureFormat::RGBX_8888:
-        bytes_per_pixel = 4;
-        break;
-    case AdbCaptureFormat::RGB_888:
-        bytes_per_pixel = 3;
-        break;
-    // RGB_565 and so on.
-    default:
-        const auto error_message =
-            DAS::fmt::format("Unsupported color format: {}", header.format);
-        DAS_LOG_ERROR(error_message.c_str());
-        return tl::make_unexpected(UNSUPPORTED_COLOR_FORMAT);
+        return DAS_E_INVALID_POINTER;
     }
 
-    uint64_t pixels = 0;
-    if (!TryMultiplyUint64(header.width, header.height, &pixels))
+    uint64_t payload_view_size = 0;
+    const auto get_size_result = payload_buffer->GetSize(&payload_view_size);
+    if (!IsOk(get_size_result)) [[unlikely]]
     {
-        const auto error_message = DAS::fmt::format(
-            "Framebuffer pixel count overflow: {}x{}",
-            header.width,
-            header.height);
-        DAS_LOG_ERROR(error_message.c_str());
-        return tl::make_unexpected(CAPTURE_DATA_TOO_LESS);
+        return get_size_result;
     }
-
-    uint64_t byte_count = 0;
-    if (!TryMultiplyUint64(pixels, bytes_per_pixel, &byte_count)
-        || byte_count > std::numeric_limits<std::size_t>::max())
+    if (payload_view_size < frame.payload_size) [[unlikely]]
     {
         const auto error_message = DAS::fmt::format(
-            "Framebuffer byte count overflow: pixels={}, bytes_per_pixel={}",
-            pixels,
-            bytes_per_pixel);
+            "ADB payload view too small: expected={}, actual={}.",
+            frame.payload_size,
+            payload_view_size);
         DAS_LOG_ERROR(error_message.c_str());
-        return tl::make_unexpected(CAPTURE_DATA_TOO_LESS);
+        return CAPTURE_DATA_TOO_LESS;
     }
 
-    return static_cast<std::size_t>(byte_count);
-}
+    unsigned char* p_payload_data = nullptr;
+    const auto get_data_result = payload_buffer->GetData(&p_payload_data);
+    if (!IsOk(get_data_result)) [[unlikely]]
+    {
+        return get_data_result;
+    }
+    if (p_payload_data == nullptr) [[unlikely]]
+    {
+        return DAS_E_INVALID_POINTER;
+    }
 
-DAS::Utils::Expected<ExportInterface::DasImageFormat> Convert(
-    const AdbCaptureFormat format)
-{
-    switch (format)
+    const auto&              header = frame.header;
+    ExportInterface::DasSize size{
+        static_cast<int32_t>(header.width),
+        static_cast<int32_t>(header.height)};
+    *pp_out_image = nullptr;
+    switch (static_cast<AdbCaptureFormat>(header.format))
     {
-        using enum AdbCaptureFormat;
-    case RGBA_8888:
-        [[likely]] return ExportInterface::DAS_IMAGE_FORMAT_RGBA_8888;
-    case RGBX_8888:
-        return ExportInterface::DAS_IMAGE_FORMAT_RGBX_8888;
-    case RGB_888:
-        return ExportInterface::DAS_IMAGE_FORMAT_RGB_888;
+    case AdbCaptureFormat::RGBA_8888:
+    case AdbCaptureFormat::RGBX_8888:
+    {
+        try
+        {
+            DasPtr<ExportInterface::IDasMemory> payload_memory{
+                new PayloadMemoryView(payload_buffer.Get())};
+            const auto create_image_result = ::CreateIDasImageFromRgb888(
+                payload_memory.Get(),
+                &size,
+                pp_out_image);
+            if (!IsOk(create_image_result)) [[unlikely]]
+            {
+                return create_image_result;
+            }
+            break;
+        }
+        catch (const std::bad_alloc&)
+        {
+            return DAS_E_OUT_OF_MEMORY;
+        }
+    }
+    case AdbCaptureFormat::RGB_888:
+    {
+        const auto color_format =
+            Convert(static_cast<AdbCaptureFormat>(header.format));
+        if (!color_format) [[unlikely]]
+        {
+            return color_format.error();
+        }
+        DasImageDesc desc{
+            .p_data = reinterpret_cast<char*>(p_payload_data),
+            .data_size = frame.payload_size,
+            .data_format = color_format.value()};
+        const auto create_image_result =
+            ::CreateIDasImageFromDecodedData(&desc, &size, pp_out_image);
+        if (!IsOk(create_image_result)) [[unlikely]]
+        {
+            return create_image_result;
+        }
+        break;
+    }
     default:
-        return tl::make_unexpected(UNSUPPORTED_COLOR_FORMAT);
+        return UNSUPPORTED_COLOR_FORMAT;
+    }
+
+    if (*pp_out_image == nullptr) [[unlikely]]
+    {
+        return DAS_E_INVALID_POINTER;
     }
+    return DAS_S_OK;
 }
 
 DAS_NS_ANONYMOUS_DETAILS_END
@@ -710,7 +491,20 @@ DAS::Utils::Expected<AdbCapture::Size> AdbCapture::GetDeviceSize() const
     return result;
 }
 
-DasResult AdbCapture::CaptureRawWithGZip()
+DasResult AdbCapture::CaptureByServerStream(
+    ExportInterface::IDasImage** pp_out_image)
+{
+    AdbCaptureFrame frame{};
+    if (const auto result = screencap_session_->CaptureFrame(frame);
+        !IsOk(result))
+    {
+        return result;
+    }
+    return Details::CreateImageFromFrame(frame, pp_out_image);
+}
+
+DasResult AdbCapture::CaptureRawWithGZip(
+    ExportInterface::IDasImage** pp_out_image)
 {
     // Run adb and receive screen capture.
     Details::CommandExecutorContext<std::vector<char>> context{
@@ -723,259 +517,90 @@ DasResult AdbCapture::CaptureRawWithGZip()
     {
         return exec_result;
     }
-    if (context.GetBuffer().empty()) [[unlikely]]
+    const auto& compressed = context.GetBuffer();
+    if (compressed.empty()) [[unlikely]]
     {
         DAS_LOG_ERROR("ADB gzip capture returned empty stdout.");
         return CAPTURE_DATA_TOO_LESS;
     }
 
-    std::array<unsigned char, ADB_CAPTURE_HEADER_SIZE> header_buffer{};
-    std::size_t                                        header_bytes = 0;
-    auto inflate_result = Details::InflateGzipToBuffer(
-        context.GetBuffer().data(),
-        context.GetBuffer().size(),
-        header_buffer.data(),
-        header_buffer.size(),
-        Details::InflateMode::StopWhenOutputFull,
-        &header_bytes);
-    if (!IsOk(inflate_result)) [[unlikely]]
+    // Header and payload are inflated in one pass, straight into the frame
+    // memory.
+    AdbGzipFrameDecoder decoder{gzip_frame_memory_pool_};
+    if (const auto result = decoder.Reset(); !IsOk(result)) [[unlikely]]
     {
-        return inflate_result;
+        return result;
     }
-    if (header_bytes < ADB_CAPTURE_HEADER_SIZE) [[unlikely]]
+    std::size_t consumed = 0;
+    bool        finished = false;
+    if (const auto result = decoder.Feed(
+            reinterpret_cast<const unsigned char*>(compressed.data()),
+            compressed.size(),
+            &consumed,
+            &finished);
+        !IsOk(result)) [[unlikely]]
     {
-        const auto error_message = DAS::fmt::format(
-            "Received truncated framebuffer header. Expected at least {} "
-            "bytes, got {}.",
-            ADB_CAPTURE_HEADER_SIZE,
-            header_bytes);
-        DAS_LOG_ERROR(error_message.c_str());
-        return CAPTURE_DATA_TOO_LESS;
+        return result;
     }
-
-    const auto header = Details::ResolveHeader(
-        reinterpret_cast<const char*>(header_buffer.data()));
-    const auto expected_payload = Details::ComputeDataSizeFromHeader(header);
-    if (!expected_payload) [[unlikely]]
+    if (!finished) [[unlikely]]
     {
-        return expected_payload.error();
-    }
-
-    if (expected_payload.value() > std::numeric_limits<std::size_t>::max()
-                                       - ADB_CAPTURE_HEADER_SIZE) [[unlikely]]
-    {
-        const auto error_message = DAS::fmt::format(
-            "ADB framebuffer total byte count overflow: header={}, payload={}.",
-            ADB_CAPTURE_HEADER_SIZE,
-            expected_payload.value());
-        DAS_LOG_ERROR(error_message.c_str());
+        DAS_LOG_ERROR("ADB gzip stream is truncated.");
         return CAPTURE_DATA_TOO_LESS;
     }
-
-    if (header.width
-            > static_cast<uint32_t>(std::numeric_limits<int32_t>::max())
-        || header.height > static_cast<uint32_t>(
-               std::numeric_limits<int32_t>::max())) [[unlikely]]
-    {
-        const auto error_message = DAS::fmt::format(
-            "ADB framebuffer dimensions exceed DasSize range: {}x{}.",
-            header.width,
-            header.height);
-        DAS_LOG_ERROR(error_message.c_str());
-        return DAS_E_OUT_OF_RANGE;
-    }
-
-    const auto total_decompressed_size =
-        ADB_CAPTURE_HEADER_SIZE + expected_payload.value();
-    DasPtr<ExportInterface::IDasMemory> exact_memory;
-    const auto                          create_memory_result =
-        ::CreateIDasMemory(total_decompressed_size, exact_memory.Put());
-    if (!IsOk(create_memory_result)) [[unlikely]]
-    {
-        return create_memory_result;
-    }
-    if (!exact_memory) [[unlikely]]
-    {
-        return DAS_E_INVALID_POINTER;
-    }
-
-    DasPtr<ExportInterface::IDasBinaryBuffer> memory_buffer;
-    auto                                      get_buffer_result =
-        exact_memory->GetMutableView(0, memory_buffer.Put());
-    if (!IsOk(get_buffer_result)) [[unlikely]]
-    {
-        return get_buffer_result;
-    }
-    if (!memory_buffer) [[unlikely]]
-    {
-        return DAS_E_INVALID_POINTER;
-    }
-
-    uint64_t memory_buffer_size = 0;
-    auto     get_size_result = memory_buffer->GetSize(&memory_buffer_size);
-    if (!IsOk(get_size_result)) [[unlikely]]
-    {
-        return get_size_result;
-    }
-    if (memory_buffer_size < total_decompressed_size) [[unlikely]]
-    {
-        const auto error_message = DAS::fmt::format(
-            "ADB memory view too small: expected={}, actual={}.",
-            total_decompressed_size,
-            memory_buffer_size);
-        DAS_LOG_ERROR(error_message.c_str());
-        return DAS_E_OUT_OF_RANGE;
-    }
-
-    unsigned char* p_exact_data = nullptr;
-    auto           get_data_result = memory_buffer->GetData(&p_exact_data);
-    if (!IsOk(get_data_result)) [[unlikely]]
-    {
-        return get_data_result;
-    }
-    if (p_exact_data == nullptr) [[unlikely]]
-    {
-        return DAS_E_INVALID_POINTER;
-    }
-
-    std::size_t decompressed_bytes = 0;
-    inflate_result = Details::InflateGzipToBuffer(
-        context.GetBuffer().data(),
-        context.GetBuffer().size(),
-        p_exact_data,
-        total_decompressed_size,
-        Details::InflateMode::RequireExactOutputSize,
-        &decompressed_bytes);
-    if (!IsOk(inflate_result)) [[unlikely]]
-    {
-        return inflate_result;
-    }
-    if (decompressed_bytes != total_decompressed_size) [[unlikely]]
-    {
-        const auto error_message = DAS::fmt::format(
-            "ADB gzip decompressed size mismatch: expected={}, actual={}.",
-            total_decompressed_size,
-            decompressed_bytes);
-        DAS_LOG_ERROR(error_message.c_str());
-        return CAPTURE_DATA_TOO_LESS;
-    }
-
-    DasPtr<ExportInterface::IDasBinaryBuffer> payload_buffer;
-    get_buffer_result = exact_memory->GetBinaryBuffer(
-        ADB_CAPTURE_HEADER_SIZE,
-        payload_buffer.Put());
-    if (!IsOk(get_buffer_result)) [[unlikely]]
-    {
-        return get_buffer_result;
-    }
-    if (!payload_buffer) [[unlikely]]
-    {
-        return DAS_E_INVALID_POINTER;
-    }
-
-    uint64_t payload_view_size = 0;
-    get_size_result = payload_buffer->GetSize(&payload_view_size);
-    if (!IsOk(get_size_result)) [[unlikely]]
-    {
-        return get_size_result;
-    }
-    if (payload_view_size < expected_payload.value()) [[unlikely]]
+    if (consumed != compressed.size()) [[unlikely]]
     {
         const auto error_message = DAS::fmt::format(
-            "ADB payload view too small: expected={}, actual={}.",
-            expected_payload.value(),
-            payload_view_size);
+            "ADB gzip stream ended with trailing input: remaining={}.",
+            compressed.size() - consumed);
         DAS_LOG_ERROR(error_message.c_str());
         return CAPTURE_DATA_TOO_LESS;
     }
 
-    unsigned char* p_payload_data = nullptr;
-    get_data_result = payload_buffer->GetData(&p_payload_data);
-    if (!IsOk(get_data_result)) [[unlikely]]
-    {
-        return get_data_result;
-    }
-    if (p_payload_data == nullptr) [[unlikely]]
-    {
-        return DAS_E_INVALID_POINTER;
-    }
-
-    ExportInterface::DasSize size{
-        static_cast<int32_t>(header.width),
-        static_cast<int32_t>(header.height)};
-    DasPtr<ExportInterface::IDasImage> p_image{};
-    switch (static_cast<AdbCaptureFormat>(header.format))
-    {
-    case AdbCaptureFormat::RGBA_8888:
-    case AdbCaptureFormat::RGBX_8888:
-    {
-        try
-        {
-            DasPtr<ExportInterface::IDasMemory> payload_memory{
-                new Details::PayloadMemoryView(payload_buffer.Get())};
-            const auto create_image_result = ::CreateIDasImageFromRgb888(
-                payload_memory.Get(),
-                &size,
-                p_image.Put());
-            if (IsOk(create_image_result) && !p_image) [[unlikely]]
-            {
-                return DAS_E_INVALID_POINTER;
-            }
-            return create_image_result;
-        }
-        catch (const std::bad_alloc&)
-        {
-            return DAS_E_OUT_OF_MEMORY;
-        }
-    }
-    case AdbCaptureFormat::RGB_888:
+    AdbCaptureFrame frame{};
+    if (const auto result = decoder.TakeFrame(frame); !IsOk(result))
+        [[unlikely]]
     {
-        const auto color_format =
-            Details::Convert(static_cast<AdbCaptureFormat>(header.format));
-        if (!color_format) [[unlikely]]
-        {
-            return color_format.error();
-        }
-        DasImageDesc desc{
-            .p_data = reinterpret_cast<char*>(p_payload_data),
-            .data_size = expected_payload.value(),
-            .data_format = color_format.value()};
-        const auto create_image_result =
-            ::CreateIDasImageFromDecodedData(&desc, &size, p_image.Put());
-        if (IsOk(create_image_result) && !p_image) [[unlikely]]
-        {
-            return DAS_E_INVALID_POINTER;
-        }
-        return create_image_result;
-    }
-    default:
-        return UNSUPPORTED_COLOR_FORMAT;
+        return result;
     }
+    return Details::CreateImageFromFrame(frame, pp_out_image);
 }
 
-DasResult AdbCapture::CaptureRaw() { return DAS_E_NO_IMPLEMENTATION; }
+DasResult AdbCapture::CaptureRaw(ExportInterface::IDasImage** pp_out_image)
+{
+    (void)pp_out_image;
+    return DAS_E_NO_IMPLEMENTATION;
+}
 
-DasResult AdbCapture::CapturePng() { return DAS_E_NO_IMPLEMENTATION; }
+DasResult AdbCapture::CapturePng(ExportInterface::IDasImage** pp_out_image)
+{
+    (void)pp_out_image;
+    return DAS_E_NO_IMPLEMENTATION;
+}
 
-DasResult AdbCapture::CaptureRawByNc() { return DAS_E_NO_IMPLEMENTATION; }
+DasResult AdbCapture::CaptureRawByNc(ExportInterface::IDasImage** pp_out_image)
+{
+    (void)pp_out_image;
+    return DAS_E_NO_IMPLEMENTATION;
+}
 
-auto AdbCapture::AutoDetectType()
-    -> DAS::Utils::Expected<DasResult (AdbCapture::*)()>
+auto AdbCapture::AutoDetectType(ExportInterface::IDasImage** pp_out_image)
+    -> DAS::Utils::Expected<CaptureMethod>
 {
-    if (current_capture_method != nullptr)
-    {
-        return {};
-    }
     DAS_LOG_INFO("Detecting fastest adb capture way.");
-    DasResult result{DAS_S_OK};
+    // Fastest first. The detecting capture also serves the current call.
     // TODO: Check more capture methods.
-    if (result = CaptureRawWithGZip(); IsOk(result)) [[likely]]
-    {
-        current_capture_method = &AdbCapture::CaptureRawWithGZip;
-    }
-    if (IsOk(result))
+    constexpr std::array<std::pair<Type, CaptureMethod>, 2> candidates{
+        std::pair{Type::ServerStream, &AdbCapture::CaptureByServerStream},
+        std::pair{Type::RawWithGZip, &AdbCapture::CaptureRawWithGZip}};
+
+    DasResult result{DAS_E_NO_IMPLEMENTATION};
+    for (const auto& [type, method] : candidates)
     {
-        return &AdbCapture::CaptureRawWithGZip;
+        if (result = (this->*method)(pp_out_image); IsOk(result)) [[likely]]
+        {
+            type_ = type;
+            return method;
+        }
     }
 
     return tl::make_unexpected(result);
@@ -983,7 +608,8 @@ auto AdbCapture::AutoDetectType()
 
 DasResult AdbCapture::Capture(ExportInterface::IDasImage** pp_out_image)
 {
-    (void)pp_out_image;
+    DAS_UTILS_CHECK_POINTER_FOR_PLUGIN(pp_out_image)
+
     DasResult result{DAS_S_OK};
     if (boost::pfr::eq(adb_device_screen_size_, Size{0, 0})) [[unlikely]]
     {
@@ -998,13 +624,14 @@ DasResult AdbCapture::Capture(ExportInterface::IDasImage** pp_out_image)
     }
     if (current_capture_method == nullptr) [[unlikely]]
     {
-        AutoDetectType()
+        AutoDetectType(pp_out_image)
             .or_else([&result](const auto error_code) { result = error_code; })
             .map([&this_current_capture_method =
                       this->current_capture_method](const auto pointer)
                  { this_current_capture_method = pointer; });
+        return result;
     }
-    return DAS_E_NO_IMPLEMENTATION;
+    return (this->*current_capture_method)(pp_out_image);
 }
 
 DAS_NS_END
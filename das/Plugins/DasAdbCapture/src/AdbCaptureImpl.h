@@ -1,6 +1,8 @@
 #ifndef DAS_PLUGINS_DASADBCAPTURE_ADBCAPTUREIMPL_H
 #define DAS_PLUGINS_DASADBCAPTURE_ADBCAPTUREIMPL_H
 
+#include "AdbScreencapSession.h"
+
 #include <cstdint>
 #include <das/DasConfig.h>
 #include <das/IDasBase.h>
@@ -9,6 +11,7 @@
 #include <das/_autogen/idl/abi/IDasCapture.h>
 #include <das/_autogen/idl/wrapper/Das.PluginInterface.IDasCapture.Implements.hpp>
 #include <filesystem>
+#include <memory>
 
 // {C2300184-A311-4880-8966-53F57519F32A}
 DAS_DEFINE_CLASS_IN_NAMESPACE(
@@ -41,13 +44,22 @@ private:
         Png,
         RawByNc,
         RawWithGZip,
-        Raw
+        Raw,
+        ServerStream
     };
 
-    DasResult (AdbCapture::*current_capture_method)() = {nullptr};
+    using CaptureMethod =
+        DasResult (AdbCapture::*)(ExportInterface::IDasImage**);
+
+    CaptureMethod current_capture_method = {nullptr};
     [[maybe_unused]]
     Type type_{Type::RawWithGZip};
 
+    /// One adb server connection reused by every ServerStream capture
+    std::unique_ptr<AdbScreencapSession> screencap_session_;
+    /// Frame memory recycled by the RawWithGZip path
+    AdbFrameMemoryPool gzip_frame_memory_pool_;
+
 public:
     struct Size
     {
@@ -60,11 +72,13 @@ private:
 
     DAS::Utils::Expected<Size> GetDeviceSize() const;
 
-    DasResult CaptureRawWithGZip();
-    DasResult CaptureRaw();
-    DasResult CapturePng();
-    DasResult CaptureRawByNc();
-    auto AutoDetectType() -> DAS::Utils::Expected<DasResult (AdbCapture::*)()>;
+    DasResult CaptureByServerStream(ExportInterface::IDasImage** pp_out_image);
+    DasResult CaptureRawWithGZip(ExportInterface::IDasImage** pp_out_image);
+    DasResult CaptureRaw(ExportInterface::IDasImage** pp_out_image);
+    DasResult CapturePng(ExportInterface::IDasImage** pp_out_image);
+    DasResult CaptureRawByNc(ExportInterface::IDasImage** pp_out_image);
+    auto      AutoDetectType(ExportInterface::IDasImage** pp_out_image)
+        -> DAS::Utils::Expected<CaptureMethod>;
 
 public:
     AdbCapture(
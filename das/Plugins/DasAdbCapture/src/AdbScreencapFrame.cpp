@@ -0,0 +1,446 @@
+#include "AdbScreencapFrame.h"
+#include "ErrorLensImpl.h"
+
+#include <das/DasApi.h>
+#include <das/Utils/fmt.h>
+#include <das/_autogen/idl/abi/DasLogger.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+DAS_NS_BEGIN
+
+DAS_NS_ANONYMOUS_DETAILS_BEGIN
+
+bool TryMultiplyUint64(
+    const uint64_t lhs,
+    const uint64_t rhs,
+    uint64_t*      p_out_value) noexcept
+{
+    if (lhs != 0 && rhs > std::numeric_limits<uint64_t>::max() / lhs)
+    {
+        return false;
+    }
+    *p_out_value = lhs * rhs;
+    return true;
+}
+
+DAS_NS_ANONYMOUS_DETAILS_END
+
+auto ComputeDataSizeFromHeader(const AdbCaptureHeader header)
+    -> DAS::Utils::Expected<std::size_t>
+{
+    if (header.width == 0 || header.height == 0)
+    {
+        const auto error_message = DAS::fmt::format(
+            "Invalid framebuffer dimensions: {}x{}",
+            header.width,
+            header.height);
+        DAS_LOG_ERROR(error_message.c_str());
+        return tl::make_unexpected(CAPTURE_DATA_TOO_LESS);
+    }
+
+    uint64_t bytes_per_pixel = 0;
+    switch (static_cast<AdbCaptureFormat>(header.format))
+    {
+    case AdbCaptureFormat::RGBA_8888:
+    case AdbCaptureFormat::RGBX_8888:
+        bytes_per_pixel = 4;
+        break;
+    case AdbCaptureFormat::RGB_888:
+        bytes_per_pixel = 3;
+        break;
+    // RGB_565 and so on.
+    default:
+        const auto error_message =
+            DAS::fmt::format("Unsupported color format: {}", header.format);
+        DAS_LOG_ERROR(error_message.c_str());
+        return tl::make_unexpected(UNSUPPORTED_COLOR_FORMAT);
+    }
+
+    uint64_t pixels = 0;
+    if (!Details::TryMultiplyUint64(header.width, header.height, &pixels))
+    {
+        const auto error_message = DAS::fmt::format(
+            "Framebuffer pixel count overflow: {}x{}",
+            header.width,
+            header.height);
+        DAS_LOG_ERROR(error_message.c_str());
+        return tl::make_unexpected(CAPTURE_DATA_TOO_LESS);
+    }
+
+    uint64_t byte_count = 0;
+    if (!Details::TryMultiplyUint64(pixels, bytes_per_pixel, &byte_count)
+        || byte_count > std::numeric_limits<std::size_t>::max())
+    {
+        const auto error_message = DAS::fmt::format(
+            "Framebuffer byte count overflow: pixels={}, bytes_per_pixel={}",
+            pixels,
+            bytes_per_pixel);
+        DAS_LOG_ERROR(error_message.c_str());
+        return tl::make_unexpected(CAPTURE_DATA_TOO_LESS);
+    }
+
+    return static_cast<std::size_t>(byte_count);
+}
+
+// ==================== AdbFrameMemoryPool ====================
+
+DasResult AdbFrameMemoryPool::Acquire(
+    std::size_t                          size,
+    DasPtr<ExportInterface::IDasMemory>& out_memory)
+{
+    std::erase_if(
+        memories_,
+        [size](const DasPtr<ExportInterface::IDasMemory>& memory)
+        {
+            uint64_t memory_size = 0;
+            return IsFailed(memory->GetSize(&memory_size))
+                   || memory_size != size;
+        });
+
+    for (const auto& memory : memories_)
+    {
+        // Release reports the remaining count; 1 means only the pool holds it
+        memory->AddRef();
+        if (memory->Release() == 1)
+        {
+            out_memory = memory;
+            return DAS_S_OK;
+        }
+    }
+
+    DasPtr<ExportInterface::IDasMemory> memory;
+    if (const auto result = ::CreateIDasMemory(size, memory.Put());
+        IsFailed(result)) [[unlikely]]
+    {
+        return result;
+    }
+    if (!memory) [[unlikely]]
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+
+    if (memories_.size() < MAX_POOLED_MEMORY)
+    {
+        memories_.push_back(memory);
+    }
+    out_memory = std::move(memory);
+    return DAS_S_OK;
+}
+
+// ==================== AdbGzipFrameDecoder ====================
+
+AdbGzipFrameDecoder::AdbGzipFrameDecoder(AdbFrameMemoryPool& pool)
+    : pool_{pool}
+{
+}
+
+AdbGzipFrameDecoder::~AdbGzipFrameDecoder()
+{
+    if (initialized_)
+    {
+        inflateEnd(&stream_);
+    }
+}
+
+DasResult AdbGzipFrameDecoder::Reset()
+{
+    if (!initialized_)
+    {
+        // 15 + 32: maximum window, detect gzip or zlib header automatically
+        if (const auto result = inflateInit2(&stream_, 15 + 32);
+            result != Z_OK) [[unlikely]]
+        {
+            const auto error_message =
+                DAS::fmt::format("inflateInit2 failed, result={}.", result);
+            DAS_LOG_ERROR(error_message.c_str());
+            return DAS_E_INTERNAL_FATAL_ERROR;
+        }
+        initialized_ = true;
+    }
+    else if (const auto result = inflateReset(&stream_); result != Z_OK)
+        [[unlikely]]
+    {
+        const auto error_message =
+            DAS::fmt::format("inflateReset failed, result={}.", result);
+        DAS_LOG_ERROR(error_message.c_str());
+        return DAS_E_INTERNAL_FATAL_ERROR;
+    }
+
+    stream_.next_in = nullptr;
+    stream_.avail_in = 0;
+    stream_.next_out = nullptr;
+    stream_.avail_out = 0;
+    finished_ = false;
+    written_ = 0;
+    total_size_ = 0;
+    p_frame_data_ = nullptr;
+    frame_ = {};
+    return DAS_S_OK;
+}
+
+DasResult AdbGzipFrameDecoder::OnHeaderComplete()
+{
+    std::memcpy(&frame_.header, header_buffer_.data(), ADB_CAPTURE_HEADER_SIZE);
+
+    const auto& header = frame_.header;
+    const auto  expected_payload = ComputeDataSizeFromHeader(header);
+    if (!expected_payload) [[unlikely]]
+    {
+        return expected_payload.error();
+    }
+
+    if (expected_payload.value() > std::numeric_limits<std::size_t>::max()
+                                       - ADB_CAPTURE_HEADER_SIZE) [[unlikely]]
+    {
+        const auto error_message = DAS::fmt::format(
+            "ADB framebuffer total byte count overflow: header={}, payload={}.",
+            ADB_CAPTURE_HEADER_SIZE,
+            expected_payload.value());
+        DAS_LOG_ERROR(error_message.c_str());
+        return CAPTURE_DATA_TOO_LESS;
+    }
+
+    if (header.width
+            > static_cast<uint32_t>(std::numeric_limits<int32_t>::max())
+        || header.height > static_cast<uint32_t>(
+               std::numeric_limits<int32_t>::max())) [[unlikely]]
+    {
+        const auto error_message = DAS::fmt::format(
+            "ADB framebuffer dimensions exceed DasSize range: {}x{}.",
+            header.width,
+            header.height);
+        DAS_LOG_ERROR(error_message.c_str());
+        return DAS_E_OUT_OF_RANGE;
+    }
+
+    const auto total_size = ADB_CAPTURE_HEADER_SIZE + expected_payload.value();
+    if (const auto result = pool_.Acquire(total_size, frame_.memory);
+        IsFailed(result)) [[unlikely]]
+    {
+        return result;
+    }
+
+    DasPtr<ExportInterface::IDasBinaryBuffer> memory_buffer;
+    if (const auto result =
+            frame_.memory->GetMutableView(0, memory_buffer.Put());
+        IsFailed(result)) [[unlikely]]
+    {
+        return result;
+    }
+    if (!memory_buffer) [[unlikely]]
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+
+    uint64_t memory_buffer_size = 0;
+    if (const auto result = memory_buffer->GetSize(&memory_buffer_size);
+        IsFailed(result)) [[unlikely]]
+    {
+        return result;
+    }
+    if (memory_buffer_size < total_size) [[unlikely]]
+    {
+        const auto error_message = DAS::fmt::format(
+            "ADB memory view too small: expected={}, actual={}.",
+            total_size,
+            memory_buffer_size);
+        DAS_LOG_ERROR(error_message.c_str());
+        return DAS_E_OUT_OF_RANGE;
+    }
+
+    if (const auto result = memory_buffer->GetData(&p_frame_data_);
+        IsFailed(result)) [[unlikely]]
+    {
+        return result;
+    }
+    if (p_frame_data_ == nullptr) [[unlikely]]
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+
+    std::memcpy(p_frame_data_, header_buffer_.data(), ADB_CAPTURE_HEADER_SIZE);
+    frame_.payload_size = expected_payload.value();
+    total_size_ = total_size;
+    return DAS_S_OK;
+}
+
+void AdbGzipFrameDecoder::PrepareOutput()
+{
+    if (stream_.avail_out != 0)
+    {
+        return;
+    }
+
+    if (written_ < ADB_CAPTURE_HEADER_SIZE)
+    {
+        stream_.next_out = header_buffer_.data() + written_;
+        stream_.avail_out =
+            static_cast<uInt>(ADB_CAPTURE_HEADER_SIZE - written_);
+        return;
+    }
+
+    if (written_ < total_size_)
+    {
+        const auto chunk_size =
+            (std::min)(total_size_ - written_,
+                       static_cast<std::size_t>(
+                           std::numeric_limits<uInt>::max()));
+        stream_.next_out = p_frame_data_ + written_;
+        stream_.avail_out = static_cast<uInt>(chunk_size);
+        return;
+    }
+
+    // The frame is complete; any further output proves the stream is longer
+    // than the header announced.
+    stream_.next_out = &overflow_probe_;
+    stream_.avail_out = 1;
+}
+
+DasResult AdbGzipFrameDecoder::Feed(
+    const unsigned char* p_data,
+    std::size_t          size,
+    std::size_t*         p_out_consumed,
+    bool*                p_out_finished)
+{
+    if (p_out_consumed == nullptr || p_out_finished == nullptr) [[unlikely]]
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+    *p_out_consumed = 0;
+    *p_out_finished = finished_;
+    if (p_data == nullptr && size != 0) [[unlikely]]
+    {
+        return DAS_E_INVALID_POINTER;
+    }
+    if (!initialized_) [[unlikely]]
+    {
+        DAS_LOG_ERROR("AdbGzipFrameDecoder::Feed called before Reset.");
+        return DAS_E_OBJECT_NOT_INIT;
+    }
+    if (finished_)
+    {
+        return DAS_S_OK;
+    }
+
+    std::size_t input_offset = 0;
+    for (;;)
+    {
+        if (stream_.avail_in == 0 && input_offset < size)
+        {
+            const auto chunk_size =
+                (std::min)(size - input_offset,
+                           static_cast<std::size_t>(
+                               std::numeric_limits<uInt>::max()));
+            stream_.next_in = const_cast<Bytef*>(p_data + input_offset);
+            stream_.avail_in = static_cast<uInt>(chunk_size);
+            input_offset += chunk_size;
+        }
+        PrepareOutput();
+
+        const bool writing_overflow_probe =
+            stream_.next_out == &overflow_probe_;
+        const auto before_avail_in = stream_.avail_in;
+        const auto before_avail_out = stream_.avail_out;
+        const auto inflate_result = inflate(&stream_, Z_NO_FLUSH);
+        const std::size_t produced = before_avail_out - stream_.avail_out;
+        *p_out_consumed = input_offset - stream_.avail_in;
+
+        if (produced != 0)
+        {
+            if (writing_overflow_probe) [[unlikely]]
+            {
+                const auto error_message = DAS::fmt::format(
+                    "ADB gzip decompressed output is longer than expected: expected={}.",
+                    total_size_);
+                DAS_LOG_ERROR(error_message.c_str());
+                return CAPTURE_DATA_TOO_LESS;
+            }
+            written_ += produced;
+            if (written_ == ADB_CAPTURE_HEADER_SIZE
+                && p_frame_data_ == nullptr)
+            {
+                if (const auto result = OnHeaderComplete(); IsFailed(result))
+                    [[unlikely]]
+                {
+                    return result;
+                }
+            }
+        }
+
+        if (inflate_result == Z_STREAM_END)
+        {
+            if (written_ < ADB_CAPTURE_HEADER_SIZE) [[unlikely]]
+            {
+                const auto error_message = DAS::fmt::format(
+                    "Received truncated framebuffer header. Expected at least {} "
+                    "bytes, got {}.",
+                    ADB_CAPTURE_HEADER_SIZE,
+                    written_);
+                DAS_LOG_ERROR(error_message.c_str());
+                return CAPTURE_DATA_TOO_LESS;
+            }
+            if (written_ != total_size_) [[unlikely]]
+            {
+                const auto error_message = DAS::fmt::format(
+                    "ADB gzip decompressed size mismatch: expected={}, actual={}.",
+                    total_size_,
+                    written_);
+                DAS_LOG_ERROR(error_message.c_str());
+                return CAPTURE_DATA_TOO_LESS;
+            }
+            // Bytes after the gzip trailer do not belong to this frame
+            stream_.next_in = nullptr;
+            stream_.avail_in = 0;
+            finished_ = true;
+            *p_out_finished = true;
+            return DAS_S_OK;
+        }
+
+        if (inflate_result != Z_OK && inflate_result != Z_BUF_ERROR)
+            [[unlikely]]
+        {
+            const auto error_message = DAS::fmt::format(
+                "ADB gzip inflate failed: result={}, message={}.",
+                inflate_result,
+                stream_.msg != nullptr ? stream_.msg : "");
+            DAS_LOG_ERROR(error_message.c_str());
+            return CAPTURE_DATA_TOO_LESS;
+        }
+
+        // Wait for more input once zlib stopped for lack of it. A full output
+        // buffer may still hide pending output, so keep going in that case.
+        const bool input_drained =
+            stream_.avail_in == 0 && input_offset == size;
+        if (input_drained && (stream_.avail_out != 0 || produced == 0))
+        {
+            return DAS_S_OK;
+        }
+
+        if (!input_drained && produced == 0
+            && stream_.avail_in == before_avail_in) [[unlikely]]
+        {
+            DAS_LOG_ERROR("ADB gzip inflate made no progress.");
+            return CAPTURE_DATA_TOO_LESS;
+        }
+    }
+}
+
+DasResult AdbGzipFrameDecoder::TakeFrame(AdbCaptureFrame& out_frame)
+{
+    if (!finished_) [[unlikely]]
+    {
+        DAS_LOG_ERROR("AdbGzipFrameDecoder::TakeFrame called before the gzip "
+                      "stream ended.");
+        return DAS_E_OBJECT_NOT_INIT;
+    }
+
+    out_frame = std::move(frame_);
+    frame_ = {};
+    p_frame_data_ = nullptr;
+    return DAS_S_OK;
+}
+
+DAS_NS_END
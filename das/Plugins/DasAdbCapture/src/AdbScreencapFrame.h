@@ -0,0 +1,141 @@
+#ifndef DAS_PLUGINS_DASADBCAPTURE_ADBSCREENCAPFRAME_H
+#define DAS_PLUGINS_DASADBCAPTURE_ADBSCREENCAPFRAME_H
+
+#include <das/DasConfig.h>
+#include <das/DasPtr.hpp>
+#include <das/Utils/CommonUtils.hpp>
+#include <das/Utils/Expected.h>
+#include <das/_autogen/idl/abi/IDasMemory.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <zlib.h>
+
+DAS_NS_BEGIN
+
+/**
+ * @brief reference from
+ *  <a
+ * href="https://developer.android.com/reference/android/graphics/PixelFormat">PixelFormat</a>
+ *  <a
+ * href="https://android.googlesource.com/platform/frameworks/base/+/android-4.3_r2.3/cmds/screencap/screencap.cpp">screencap.cpp
+ * in Android 4.23</a> <a
+ * href="https://android.googlesource.com/platform/frameworks/base/+/refs/heads/android-s-beta-4/cmds/screencap/screencap.cpp">screencap.cpp
+ * in Android S Beta 4</a> \n NOTE: kN32_SkColorType selects native 32-bit
+ * ARGB format.\n On little endian processors, pixels containing 8-bit ARGB
+ * components pack into 32-bit kBGRA_8888_SkColorType.\n On big endian
+ * processors, pixels pack into 32-bit kRGBA_8888_SkColorType.\n In this plugin,
+ * we assume kN32_SkColorType is RGBA_8888.
+ */
+enum class AdbCaptureFormat : uint32_t
+{
+    RGBA_8888 = 1,
+    RGBX_8888 = 2,
+    RGB_888 = 3,
+    RGB_565 = 4
+};
+
+constexpr std::size_t ADB_CAPTURE_HEADER_SIZE = 16;
+
+struct AdbCaptureHeader
+{
+    uint32_t width;
+    uint32_t height;
+    uint32_t format;
+    uint32_t dataspace;
+};
+
+static_assert(sizeof(AdbCaptureHeader) == ADB_CAPTURE_HEADER_SIZE);
+static_assert(offsetof(AdbCaptureHeader, width) == 0);
+static_assert(offsetof(AdbCaptureHeader, height) == 4);
+static_assert(offsetof(AdbCaptureHeader, format) == 8);
+static_assert(offsetof(AdbCaptureHeader, dataspace) == 12);
+
+auto ComputeDataSizeFromHeader(const AdbCaptureHeader header)
+    -> DAS::Utils::Expected<std::size_t>;
+
+/**
+ * @brief One decoded `screencap` frame. The memory holds the raw header
+ * followed by the pixel payload, i.e. the payload starts at
+ * ADB_CAPTURE_HEADER_SIZE.
+ */
+struct AdbCaptureFrame
+{
+    AdbCaptureHeader                    header{};
+    std::size_t                         payload_size{0};
+    DasPtr<ExportInterface::IDasMemory> memory;
+};
+
+/**
+ * @brief Recycles frame memory between captures.
+ *
+ * A pooled IDasMemory is handed out again only when the pool holds its last
+ * reference, so images still alive downstream are never overwritten. Entries
+ * of another size (the resolution changed) are dropped.
+ */
+class AdbFrameMemoryPool final : public DAS::Utils::NonCopyableAndNonMovable
+{
+public:
+    static constexpr std::size_t MAX_POOLED_MEMORY = 3;
+
+    DasResult Acquire(
+        std::size_t                          size,
+        DasPtr<ExportInterface::IDasMemory>& out_memory);
+
+private:
+    std::vector<DasPtr<ExportInterface::IDasMemory>> memories_;
+};
+
+/**
+ * @brief Incremental, single pass decoder for `screencap | gzip` output.
+ *
+ * Compressed bytes may arrive in chunks of any size. The header is inflated
+ * into a small buffer first; once the frame size is known, the rest of the
+ * stream is inflated straight into pooled frame memory. The gzip stream is
+ * self-delimiting, so Feed reports how many bytes belonged to this frame.
+ */
+class AdbGzipFrameDecoder final : public DAS::Utils::NonCopyableAndNonMovable
+{
+public:
+    explicit AdbGzipFrameDecoder(AdbFrameMemoryPool& pool);
+    ~AdbGzipFrameDecoder();
+
+    /// @brief Prepare for a new frame, keeping the zlib state allocated
+    DasResult Reset();
+
+    /**
+     * @brief Inflate the next chunk of compressed data.
+     * @param p_out_consumed bytes of the chunk consumed by this frame
+     * @param p_out_finished true once the gzip stream of the frame ended
+     */
+    DasResult Feed(
+        const unsigned char* p_data,
+        std::size_t          size,
+        std::size_t*         p_out_consumed,
+        bool*                p_out_finished);
+
+    /// @brief Move the finished frame out. Only valid after Feed finished
+    DasResult TakeFrame(AdbCaptureFrame& out_frame);
+
+private:
+    DasResult OnHeaderComplete();
+    void      PrepareOutput();
+
+    AdbFrameMemoryPool& pool_;
+    z_stream            stream_{};
+    bool                initialized_{false};
+    bool                finished_{false};
+
+    std::array<unsigned char, ADB_CAPTURE_HEADER_SIZE> header_buffer_{};
+    std::size_t                                        written_{0};
+    std::size_t                                        total_size_{0};
+    unsigned char*                                     p_frame_data_{nullptr};
+    unsigned char                                      overflow_probe_{0};
+    AdbCaptureFrame                                    frame_;
+};
+
+DAS_NS_END
+
+#endif // DAS_PLUGINS_DASADBCAPTURE_ADBSCREENCAPFRAME_H
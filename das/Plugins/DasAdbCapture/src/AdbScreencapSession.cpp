@@ -0,0 +1,424 @@
+// getenv is only used to read ANDROID_ADB_SERVER_PORT once per session.
+// warning C4996: 'getenv': This function or variable may be unsafe. Consider
+// using _dupenv_s instead.
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "AdbScreencapSession.h"
+#include "ErrorLensImpl.h"
+
+#include <das/DasApi.h>
+#include <das/Utils/fmt.h>
+#include <das/_autogen/idl/abi/DasLogger.h>
+
+DAS_DISABLE_WARNING_BEGIN
+DAS_IGNORE_BOOST_PROCESS_WARNING
+
+#include <boost/asio.hpp>
+
+DAS_DISABLE_WARNING_END
+
+#include <array>
+#include <charconv>
+#include <cstdlib>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+DAS_NS_BEGIN
+
+DAS_NS_ANONYMOUS_DETAILS_BEGIN
+
+/// One command per frame; stderr is dropped so only gzip output is streamed
+constexpr std::string_view SCREENCAP_COMMAND =
+    "screencap 2>/dev/null | gzip -1\n";
+
+/// Raw (no pty) shell service, so binary output is not mangled
+constexpr std::string_view SHELL_SERVICE = "exec:sh";
+
+constexpr std::size_t READ_CHUNK_SIZE = 64 * 1024;
+
+constexpr std::size_t ADB_LENGTH_PREFIX_SIZE = 4;
+
+DAS_NS_ANONYMOUS_DETAILS_END
+
+auto AdbServerEndpoint::FromEnvironment() -> AdbServerEndpoint
+{
+    AdbServerEndpoint result{};
+    const char*       p_port = std::getenv("ANDROID_ADB_SERVER_PORT");
+    if (p_port == nullptr || *p_port == '\0')
+    {
+        return result;
+    }
+
+    const std::string_view port_string{p_port};
+    uint16_t               port = 0;
+    const auto [_, error] = std::from_chars(
+        port_string.data(),
+        port_string.data() + port_string.size(),
+        port);
+    if (error != std::errc{} || port == 0) [[unlikely]]
+    {
+        const auto error_message = DAS::fmt::format(
+            "Ignoring invalid ANDROID_ADB_SERVER_PORT: {}.",
+            port_string);
+        DAS_LOG_WARNING(error_message.c_str());
+        return result;
+    }
+
+    result.port = port;
+    return result;
+}
+
+struct AdbScreencapSession::Impl
+{
+    Impl(
+        std::string               adb_device_serial,
+        AdbServerEndpoint         adb_server_endpoint,
+        std::chrono::milliseconds operation_timeout)
+        : serial{std::move(adb_device_serial)},
+          endpoint{std::move(adb_server_endpoint)},
+          timeout{operation_timeout}, socket{ioc}, decoder{pool},
+          read_buffer(Details::READ_CHUNK_SIZE)
+    {
+    }
+
+    std::string                  serial;
+    AdbServerEndpoint            endpoint;
+    std::chrono::milliseconds    timeout;
+    boost::asio::io_context      ioc;
+    boost::asio::ip::tcp::socket socket;
+    AdbFrameMemoryPool           pool;
+    AdbGzipFrameDecoder          decoder;
+    std::vector<unsigned char>   read_buffer;
+
+    /**
+     * @brief Start one asynchronous operation and run it to completion, or
+     * close the socket once timeout elapses.
+     */
+    template <class Initiation>
+    auto Wait(Initiation&& initiation)
+        -> std::pair<boost::system::error_code, std::size_t>
+    {
+        boost::system::error_code ec{};
+        std::size_t               bytes_transferred = 0;
+        bool                      completed = false;
+        std::forward<Initiation>(initiation)(
+            [&](boost::system::error_code handler_ec, std::size_t bytes)
+            {
+                ec = handler_ec;
+                bytes_transferred = bytes;
+                completed = true;
+            });
+
+        ioc.restart();
+        ioc.run_for(timeout);
+        if (!completed)
+        {
+            // Closing aborts the pending operation; run its handler so that
+            // nothing refers to this frame afterwards.
+            boost::system::error_code ignored;
+            socket.close(ignored);
+            ioc.restart();
+            ioc.run();
+            ec = boost::asio::error::timed_out;
+        }
+        return {ec, bytes_transferred};
+    }
+
+    DasResult ReportIoError(
+        std::string_view                 operation,
+        const boost::system::error_code& ec) const
+    {
+        const auto error_message = DAS::fmt::format(
+            "ADB server {}:{} {} failed: {}.",
+            endpoint.host,
+            endpoint.port,
+            operation,
+            ec.message());
+        DAS_LOG_ERROR(error_message.c_str());
+        return ec == boost::asio::error::timed_out ? DAS_E_TIMEOUT
+                                                   : DAS_E_CAPTURE_FAILED;
+    }
+
+    DasResult WriteAll(std::string_view data)
+    {
+        const auto [ec, _] = Wait(
+            [&](auto&& handler)
+            {
+                boost::asio::async_write(
+                    socket,
+                    boost::asio::buffer(data.data(), data.size()),
+                    std::forward<decltype(handler)>(handler));
+            });
+        if (ec) [[unlikely]]
+        {
+            return ReportIoError("write", ec);
+        }
+        return DAS_S_OK;
+    }
+
+    DasResult ReadExact(char* p_data, std::size_t size)
+    {
+        const auto [ec, _] = Wait(
+            [&](auto&& handler)
+            {
+                boost::asio::async_read(
+                    socket,
+                    boost::asio::buffer(p_data, size),
+                    std::forward<decltype(handler)>(handler));
+            });
+        if (ec) [[unlikely]]
+        {
+            return ReportIoError("read", ec);
+        }
+        return DAS_S_OK;
+    }
+
+    /// @brief Send one smart-socket request and wait for OKAY or FAIL
+    DasResult Request(std::string_view request)
+    {
+        const auto message =
+            DAS::fmt::format("{:04x}{}", request.size(), request);
+        if (const auto result = WriteAll(message); IsFailed(result))
+        {
+            return result;
+        }
+
+        std::array<char, 4> status{};
+        if (const auto result = ReadExact(status.data(), status.size());
+            IsFailed(result))
+        {
+            return result;
+        }
+        const std::string_view status_string{status.data(), status.size()};
+        if (status_string == "OKAY") [[likely]]
+        {
+            return DAS_S_OK;
+        }
+
+        if (status_string != "FAIL") [[unlikely]]
+        {
+            const auto error_message = DAS::fmt::format(
+                "ADB server answered {} with unexpected status {}.",
+                request,
+                status_string);
+            DAS_LOG_ERROR(error_message.c_str());
+            return DAS_E_CAPTURE_FAILED;
+        }
+
+        std::array<char, Details::ADB_LENGTH_PREFIX_SIZE> length{};
+        if (const auto result = ReadExact(length.data(), length.size());
+            IsFailed(result))
+        {
+            return result;
+        }
+        std::size_t reason_size = 0;
+        if (const auto [_, error] = std::from_chars(
+                length.data(),
+                length.data() + length.size(),
+                reason_size,
+                16);
+            error != std::errc{}) [[unlikely]]
+        {
+            DAS_LOG_ERROR("ADB server sent a malformed FAIL length.");
+            return DAS_E_CAPTURE_FAILED;
+        }
+        std::string reason(reason_size, '\0');
+        if (const auto result = ReadExact(reason.data(), reason.size());
+            IsFailed(result))
+        {
+            return result;
+        }
+
+        const auto error_message = DAS::fmt::format(
+            "ADB server refused {}: {}.",
+            request,
+            reason);
+        DAS_LOG_ERROR(error_message.c_str());
+        return DAS_E_CAPTURE_FAILED;
+    }
+
+    DasResult Connect()
+    {
+        boost::system::error_code      resolve_ec;
+        boost::asio::ip::tcp::resolver resolver{ioc};
+        const auto                     endpoints = resolver.resolve(
+            endpoint.host,
+            std::to_string(endpoint.port),
+            resolve_ec);
+        if (resolve_ec) [[unlikely]]
+        {
+            return ReportIoError("resolve", resolve_ec);
+        }
+
+        const auto [connect_ec, _] = Wait(
+            [&](auto&& handler)
+            {
+                boost::asio::async_connect(
+                    socket,
+                    endpoints,
+                    [handler = std::forward<decltype(handler)>(handler)](
+                        boost::system::error_code ec,
+                        const boost::asio::ip::tcp::endpoint&) mutable
+                    { handler(ec, 0); });
+            });
+        if (connect_ec) [[unlikely]]
+        {
+            return ReportIoError("connect", connect_ec);
+        }
+
+        boost::system::error_code ignored;
+        socket.set_option(boost::asio::ip::tcp::no_delay{true}, ignored);
+
+        const auto transport = serial.empty()
+                                   ? std::string{"host:transport-any"}
+                                   : "host:transport:" + serial;
+        if (const auto result = Request(transport); IsFailed(result))
+        {
+            return result;
+        }
+        if (const auto result = Request(Details::SHELL_SERVICE);
+            IsFailed(result))
+        {
+            return result;
+        }
+
+        const auto info = DAS::fmt::format(
+            "Opened adb screencap stream to {} via {}:{}.",
+            serial.empty() ? std::string_view{"<any>"} : serial,
+            endpoint.host,
+            endpoint.port);
+        DAS_LOG_INFO(info.c_str());
+        return DAS_S_OK;
+    }
+
+    DasResult CaptureFrameOnce(
+        AdbCaptureFrame& out_frame,
+        bool*            p_out_received_data)
+    {
+        *p_out_received_data = false;
+        if (const auto result = decoder.Reset(); IsFailed(result))
+        {
+            return result;
+        }
+        if (const auto result = WriteAll(Details::SCREENCAP_COMMAND);
+            IsFailed(result))
+        {
+            return result;
+        }
+
+        for (;;)
+        {
+            const auto [ec, bytes_read] = Wait(
+                [&](auto&& handler)
+                {
+                    socket.async_read_some(
+                        boost::asio::buffer(read_buffer),
+                        std::forward<decltype(handler)>(handler));
+                });
+            if (ec) [[unlikely]]
+            {
+                return ReportIoError("screencap stream read", ec);
+            }
+            *p_out_received_data = true;
+
+            std::size_t consumed = 0;
+            bool        finished = false;
+            if (const auto result = decoder.Feed(
+                    read_buffer.data(),
+                    bytes_read,
+                    &consumed,
+                    &finished);
+                IsFailed(result))
+            {
+                return result;
+            }
+            if (!finished)
+            {
+                continue;
+            }
+
+            if (consumed != bytes_read) [[unlikely]]
+            {
+                // The frame is intact, but the stream is out of step with
+                // our commands; start over on a fresh connection.
+                const auto error_message = DAS::fmt::format(
+                    "Discarding {} unexpected bytes after adb screencap frame.",
+                    bytes_read - consumed);
+                DAS_LOG_WARNING(error_message.c_str());
+                boost::system::error_code ignored;
+                socket.close(ignored);
+            }
+            return decoder.TakeFrame(out_frame);
+        }
+    }
+};
+
+AdbScreencapSession::AdbScreencapSession(
+    std::string               adb_device_serial,
+    AdbServerEndpoint         endpoint,
+    std::chrono::milliseconds timeout)
+    : impl_{std::make_unique<Impl>(
+          std::move(adb_device_serial),
+          std::move(endpoint),
+          timeout)}
+{
+}
+
+AdbScreencapSession::~AdbScreencapSession() = default;
+
+bool AdbScreencapSession::IsConnected() const noexcept
+{
+    return impl_->socket.is_open();
+}
+
+void AdbScreencapSession::Close() noexcept
+{
+    boost::system::error_code ignored;
+    impl_->socket.shutdown(
+        boost::asio::ip::tcp::socket::shutdown_both,
+        ignored);
+    impl_->socket.close(ignored);
+}
+
+DasResult AdbScreencapSession::CaptureFrame(AdbCaptureFrame& out_frame)
+{
+    const bool reused = IsConnected();
+    if (!reused)
+    {
+        if (const auto result = impl_->Connect(); IsFailed(result))
+        {
+            Close();
+            return result;
+        }
+    }
+
+    bool received_data = false;
+    auto result = impl_->CaptureFrameOnce(out_frame, &received_data);
+    if (IsOk(result))
+    {
+        return result;
+    }
+    Close();
+
+    // The server or adbd may have dropped an idle connection since the last
+    // frame. Retry once on a fresh connection, but never after a frame
+    // started arriving: that failure is real.
+    if (!reused || received_data)
+    {
+        return result;
+    }
+    DAS_LOG_INFO("ADB screencap stream was closed, reconnecting.");
+    if (result = impl_->Connect(); IsOk(result))
+    {
+        result = impl_->CaptureFrameOnce(out_frame, &received_data);
+    }
+    if (IsFailed(result))
+    {
+        Close();
+    }
+    return result;
+}
+
+DAS_NS_END
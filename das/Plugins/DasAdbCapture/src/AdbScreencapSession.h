@@ -0,0 +1,67 @@
+#ifndef DAS_PLUGINS_DASADBCAPTURE_ADBSCREENCAPSESSION_H
+#define DAS_PLUGINS_DASADBCAPTURE_ADBSCREENCAPSESSION_H
+
+#include "AdbScreencapFrame.h"
+
+#include <das/DasConfig.h>
+#include <das/Utils/CommonUtils.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+DAS_NS_BEGIN
+
+/// @brief Address of the local adb server (the one `adb` talks to)
+struct AdbServerEndpoint
+{
+    static constexpr uint16_t DEFAULT_PORT = 5037;
+
+    std::string host{"127.0.0.1"};
+    uint16_t    port{DEFAULT_PORT};
+
+    /// @brief Default endpoint, honoring ANDROID_ADB_SERVER_PORT like adb
+    static auto FromEnvironment() -> AdbServerEndpoint;
+};
+
+/**
+ * @brief Streams screencap frames over one long-lived adb connection.
+ *
+ * Instead of spawning `adb exec-out` per frame, the session talks the adb
+ * smart-socket protocol to the adb server directly: it switches the
+ * connection to the device transport, opens a raw (`exec:`) shell once, and
+ * then writes one `screencap | gzip` command per frame. The gzip stream is
+ * self-delimiting, so frames are cut from the byte stream by the decoder and
+ * inflated in a single pass into pooled memory.
+ *
+ * Any protocol or I/O error closes the connection; the next capture
+ * reconnects. Not thread-safe.
+ */
+class AdbScreencapSession final : public DAS::Utils::NonCopyableAndNonMovable
+{
+public:
+    static constexpr std::chrono::milliseconds DEFAULT_TIMEOUT{10000};
+
+    /// @param adb_device_serial empty selects the only connected device
+    AdbScreencapSession(
+        std::string               adb_device_serial,
+        AdbServerEndpoint         endpoint,
+        std::chrono::milliseconds timeout = DEFAULT_TIMEOUT);
+    ~AdbScreencapSession();
+
+    DasResult CaptureFrame(AdbCaptureFrame& out_frame);
+
+    [[nodiscard]]
+    bool IsConnected() const noexcept;
+
+    void Close() noexcept;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+DAS_NS_END
+
+#endif // DAS_PLUGINS_DASADBCAPTURE_ADBSCREENCAPSESSION_H
@@ -0,0 +1,439 @@
+#include <gtest/gtest.h>
+
+#include "../src/AdbScreencapFrame.h"
+#include "../src/AdbScreencapSession.h"
+#include "../src/ErrorLensImpl.h"
+
+#include <das/DasApi.h>
+#include <das/DasPtr.hpp>
+#include <das/Utils/fmt.h>
+
+DAS_DISABLE_WARNING_BEGIN
+DAS_IGNORE_BOOST_PROCESS_WARNING
+
+#include <boost/asio.hpp>
+
+DAS_DISABLE_WARNING_END
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <zlib.h>
+
+namespace Das
+{
+    namespace Test
+    {
+        namespace
+        {
+            using namespace std::literals;
+
+            struct TestFrame
+            {
+                std::vector<unsigned char> raw;
+                std::vector<unsigned char> gzip;
+            };
+
+            //
+            // Helper: gzip-compress bytes the way `gzip -1` would
+            //
+            auto Gzip(const std::vector<unsigned char>& raw)
+                -> std::vector<unsigned char>
+            {
+                z_stream stream{};
+                // 15 + 16: maximum window, gzip wrapper
+                EXPECT_EQ(
+                    deflateInit2(
+                        &stream,
+                        1,
+                        Z_DEFLATED,
+                        15 + 16,
+                        8,
+                        Z_DEFAULT_STRATEGY),
+                    Z_OK);
+                std::vector<unsigned char> result(
+                    deflateBound(&stream, static_cast<uLong>(raw.size())));
+                stream.next_in = const_cast<Bytef*>(raw.data());
+                stream.avail_in = static_cast<uInt>(raw.size());
+                stream.next_out = result.data();
+                stream.avail_out = static_cast<uInt>(result.size());
+                EXPECT_EQ(deflate(&stream, Z_FINISH), Z_STREAM_END);
+                result.resize(stream.total_out);
+                deflateEnd(&stream);
+                return result;
+            }
+
+            //
+            // Helper: screencap output (header + pixels) and its gzip form
+            //
+            auto MakeTestFrame(
+                uint32_t width,
+                uint32_t height,
+                uint8_t  seed,
+                int64_t  payload_size_delta = 0) -> TestFrame
+            {
+                const AdbCaptureHeader header{
+                    width,
+                    height,
+                    static_cast<uint32_t>(AdbCaptureFormat::RGBA_8888),
+                    0};
+                const auto payload_size = static_cast<std::size_t>(
+                    static_cast<int64_t>(width) * height * 4
+                    + payload_size_delta);
+
+                TestFrame frame;
+                frame.raw.resize(ADB_CAPTURE_HEADER_SIZE + payload_size);
+                std::memcpy(frame.raw.data(), &header, sizeof(header));
+                for (std::size_t i = 0; i < payload_size; ++i)
+                {
+                    frame.raw[ADB_CAPTURE_HEADER_SIZE + i] =
+                        static_cast<unsigned char>(i * 31 + seed);
+                }
+                frame.gzip = Gzip(frame.raw);
+                return frame;
+            }
+
+            auto GetMemoryBytes(ExportInterface::IDasMemory* p_memory)
+                -> std::vector<unsigned char>
+            {
+                DasPtr<ExportInterface::IDasBinaryBuffer> buffer;
+                EXPECT_EQ(p_memory->GetBinaryBuffer(0, buffer.Put()), DAS_S_OK);
+                uint64_t       size = 0;
+                unsigned char* p_data = nullptr;
+                EXPECT_EQ(buffer->GetSize(&size), DAS_S_OK);
+                EXPECT_EQ(buffer->GetData(&p_data), DAS_S_OK);
+                return {p_data, p_data + size};
+            }
+
+            /**
+             * @brief Minimal adb server: accepts the transport and exec:sh
+             * requests, then answers every shell line with the next frame.
+             */
+            class FakeAdbServer
+            {
+            public:
+                explicit FakeAdbServer(std::vector<TestFrame> frames)
+                    : frames_{std::move(frames)},
+                      acceptor_{
+                          ioc_,
+                          {boost::asio::ip::make_address("127.0.0.1"), 0}}
+                {
+                }
+
+                ~FakeAdbServer()
+                {
+                    stopping_ = true;
+                    if (thread_.joinable())
+                    {
+                        // Wake the blocking accept
+                        boost::asio::io_context      ioc;
+                        boost::asio::ip::tcp::socket waker{ioc};
+                        boost::system::error_code    ignored;
+                        waker.connect(acceptor_.local_endpoint(), ignored);
+                        thread_.join();
+                    }
+                }
+
+                void Start()
+                {
+                    thread_ = std::thread{[this] { Serve(); }};
+                }
+
+                [[nodiscard]]
+                auto GetEndpoint() const -> AdbServerEndpoint
+                {
+                    return {"127.0.0.1", acceptor_.local_endpoint().port()};
+                }
+
+                [[nodiscard]]
+                auto GetRequests() -> std::vector<std::string>
+                {
+                    std::lock_guard lock{mutex_};
+                    return requests_;
+                }
+
+                std::string      transport_failure;
+                int              frames_per_connection{0};
+                std::atomic<int> connection_count{0};
+                std::atomic<int> frame_count{0};
+
+            private:
+                void Serve()
+                {
+                    for (;;)
+                    {
+                        boost::asio::ip::tcp::socket socket{ioc_};
+                        boost::system::error_code    ec;
+                        acceptor_.accept(socket, ec);
+                        if (ec || stopping_)
+                        {
+                            return;
+                        }
+                        ++connection_count;
+                        ServeConnection(socket);
+                    }
+                }
+
+                auto ReadRequest(boost::asio::ip::tcp::socket& socket)
+                    -> std::string
+                {
+                    std::string length(4, '\0');
+                    boost::asio::read(
+                        socket,
+                        boost::asio::buffer(length.data(), length.size()));
+                    std::string request(std::stoul(length, nullptr, 16), '\0');
+                    boost::asio::read(
+                        socket,
+                        boost::asio::buffer(request.data(), request.size()));
+                    std::lock_guard lock{mutex_};
+                    requests_.push_back(request);
+                    return request;
+                }
+
+                void ServeConnection(boost::asio::ip::tcp::socket& socket)
+                {
+                    try
+                    {
+                        ReadRequest(socket);
+                        if (!transport_failure.empty())
+                        {
+                            const auto reply = DAS::fmt::format(
+                                "FAIL{:04x}{}",
+                                transport_failure.size(),
+                                transport_failure);
+                            boost::asio::write(
+                                socket,
+                                boost::asio::buffer(reply));
+                            return;
+                        }
+                        boost::asio::write(
+                            socket,
+                            boost::asio::buffer("OKAY"sv));
+                        ReadRequest(socket);
+                        boost::asio::write(
+                            socket,
+                            boost::asio::buffer("OKAY"sv));
+
+                        boost::asio::streambuf input;
+                        for (int served = 0; frames_per_connection == 0
+                                             || served < frames_per_connection;
+                             ++served)
+                        {
+                            const auto line_size =
+                                boost::asio::read_until(socket, input, '\n');
+                            std::string line(
+                                boost::asio::buffers_begin(input.data()),
+                                boost::asio::buffers_begin(input.data())
+                                    + static_cast<std::ptrdiff_t>(line_size));
+                            input.consume(line_size);
+                            {
+                                std::lock_guard lock{mutex_};
+                                requests_.push_back(line);
+                            }
+
+                            const auto& frame =
+                                frames_[frame_count++ % frames_.size()];
+                            boost::asio::write(
+                                socket,
+                                boost::asio::buffer(frame.gzip));
+                        }
+                    }
+                    catch (const boost::system::system_error&)
+                    {
+                        // The client went away
+                    }
+                }
+
+                std::vector<TestFrame>         frames_;
+                boost::asio::io_context        ioc_;
+                boost::asio::ip::tcp::acceptor acceptor_;
+                std::thread                    thread_;
+                std::atomic<bool>              stopping_{false};
+                std::mutex                     mutex_;
+                std::vector<std::string>       requests_;
+            };
+        } // unnamed namespace
+
+        // ==================== AdbGzipFrameDecoder ====================
+
+        TEST(AdbGzipFrameDecoderTest, decodes_in_one_pass_from_any_chunking)
+        {
+            const auto         frame = MakeTestFrame(7, 5, 3);
+            AdbFrameMemoryPool pool;
+            AdbGzipFrameDecoder decoder{pool};
+
+            for (const std::size_t chunk_size :
+                 {std::size_t{1}, std::size_t{13}})
+            {
+                ASSERT_EQ(decoder.Reset(), DAS_S_OK);
+                bool finished = false;
+                for (std::size_t offset = 0;
+                     offset < frame.gzip.size() && !finished;
+                     offset += chunk_size)
+                {
+                    const auto size =
+                        std::min(chunk_size, frame.gzip.size() - offset);
+                    std::size_t consumed = 0;
+                    ASSERT_EQ(
+                        decoder.Feed(
+                            frame.gzip.data() + offset,
+                            size,
+                            &consumed,
+                            &finished),
+                        DAS_S_OK);
+                    EXPECT_EQ(consumed, size);
+                }
+                ASSERT_TRUE(finished);
+
+                AdbCaptureFrame decoded;
+                ASSERT_EQ(decoder.TakeFrame(decoded), DAS_S_OK);
+                EXPECT_EQ(decoded.header.width, 7u);
+                EXPECT_EQ(decoded.header.height, 5u);
+                EXPECT_EQ(decoded.payload_size, 7u * 5u * 4u);
+                EXPECT_EQ(GetMemoryBytes(decoded.memory.Get()), frame.raw);
+            }
+        }
+
+        TEST(AdbGzipFrameDecoderTest, reports_bytes_after_the_gzip_trailer)
+        {
+            const auto frame = MakeTestFrame(4, 4, 9);
+            auto       stream = frame.gzip;
+            stream.insert(stream.end(), {'n', 'e', 'x', 't'});
+
+            AdbFrameMemoryPool  pool;
+            AdbGzipFrameDecoder decoder{pool};
+            ASSERT_EQ(decoder.Reset(), DAS_S_OK);
+            std::size_t consumed = 0;
+            bool        finished = false;
+            ASSERT_EQ(
+                decoder.Feed(
+                    stream.data(),
+                    stream.size(),
+                    &consumed,
+                    &finished),
+                DAS_S_OK);
+            EXPECT_TRUE(finished);
+            EXPECT_EQ(consumed, frame.gzip.size());
+        }
+
+        TEST(AdbGzipFrameDecoderTest, rejects_payload_size_mismatch)
+        {
+            for (const int64_t delta : {int64_t{-4}, int64_t{4}})
+            {
+                const auto frame = MakeTestFrame(4, 4, 1, delta);
+
+                AdbFrameMemoryPool  pool;
+                AdbGzipFrameDecoder decoder{pool};
+                ASSERT_EQ(decoder.Reset(), DAS_S_OK);
+                std::size_t consumed = 0;
+                bool        finished = false;
+                EXPECT_EQ(
+                    decoder.Feed(
+                        frame.gzip.data(),
+                        frame.gzip.size(),
+                        &consumed,
+                        &finished),
+                    CAPTURE_DATA_TOO_LESS);
+                EXPECT_FALSE(finished);
+            }
+        }
+
+        // ==================== AdbFrameMemoryPool ====================
+
+        TEST(AdbFrameMemoryPoolTest, reuses_memory_only_after_release)
+        {
+            AdbFrameMemoryPool                  pool;
+            DasPtr<ExportInterface::IDasMemory> first;
+            DasPtr<ExportInterface::IDasMemory> second;
+            ASSERT_EQ(pool.Acquire(64, first), DAS_S_OK);
+            ASSERT_EQ(pool.Acquire(64, second), DAS_S_OK);
+            // first is still referenced, so it must not be handed out again
+            EXPECT_NE(first.Get(), second.Get());
+
+            auto* const p_first = first.Get();
+            first.Reset();
+            DasPtr<ExportInterface::IDasMemory> third;
+            ASSERT_EQ(pool.Acquire(64, third), DAS_S_OK);
+            EXPECT_EQ(third.Get(), p_first);
+
+            // A new resolution drops pooled memory of the old size
+            DasPtr<ExportInterface::IDasMemory> resized;
+            ASSERT_EQ(pool.Acquire(128, resized), DAS_S_OK);
+            uint64_t size = 0;
+            ASSERT_EQ(resized->GetSize(&size), DAS_S_OK);
+            EXPECT_EQ(size, 128u);
+        }
+
+        // ==================== AdbScreencapSession ====================
+
+        TEST(AdbScreencapSessionTest, streams_frames_over_one_connection)
+        {
+            const std::vector frames{
+                MakeTestFrame(32, 16, 1),
+                MakeTestFrame(32, 16, 2),
+                MakeTestFrame(32, 16, 3)};
+            FakeAdbServer server{frames};
+            server.Start();
+
+            AdbScreencapSession session{
+                "emulator-5554",
+                server.GetEndpoint(),
+                5000ms};
+            for (const auto& expected : frames)
+            {
+                AdbCaptureFrame frame;
+                ASSERT_EQ(session.CaptureFrame(frame), DAS_S_OK);
+                EXPECT_EQ(frame.header.width, 32u);
+                EXPECT_EQ(frame.header.height, 16u);
+                EXPECT_EQ(GetMemoryBytes(frame.memory.Get()), expected.raw);
+            }
+            EXPECT_TRUE(session.IsConnected());
+            EXPECT_EQ(server.connection_count.load(), 1);
+            EXPECT_EQ(server.frame_count.load(), 3);
+
+            const auto requests = server.GetRequests();
+            ASSERT_EQ(requests.size(), 5u);
+            EXPECT_EQ(requests[0], "host:transport:emulator-5554");
+            EXPECT_EQ(requests[1], "exec:sh");
+            EXPECT_EQ(requests[2].rfind("screencap", 0), 0u);
+        }
+
+        TEST(AdbScreencapSessionTest, reconnects_after_connection_is_dropped)
+        {
+            FakeAdbServer server{{MakeTestFrame(8, 8, 5)}};
+            server.frames_per_connection = 1;
+            server.Start();
+
+            AdbScreencapSession session{"", server.GetEndpoint(), 5000ms};
+            for (int i = 0; i < 2; ++i)
+            {
+                AdbCaptureFrame frame;
+                ASSERT_EQ(session.CaptureFrame(frame), DAS_S_OK);
+            }
+            EXPECT_EQ(server.connection_count.load(), 2);
+            EXPECT_EQ(server.GetRequests().front(), "host:transport-any");
+        }
+
+        TEST(AdbScreencapSessionTest, transport_failure_is_reported)
+        {
+            FakeAdbServer server{{MakeTestFrame(8, 8, 5)}};
+            server.transport_failure = "device 'missing' not found";
+            server.Start();
+
+            AdbScreencapSession session{
+                "missing",
+                server.GetEndpoint(),
+                5000ms};
+            AdbCaptureFrame     frame;
+            EXPECT_EQ(session.CaptureFrame(frame), DAS_E_CAPTURE_FAILED);
+            EXPECT_FALSE(session.IsConnected());
+            EXPECT_EQ(server.frame_count.load(), 0);
+        }
+    } // namespace Test
+} // namespace Das
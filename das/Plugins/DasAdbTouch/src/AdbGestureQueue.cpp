@@ -0,0 +1,330 @@
+#include "AdbGestureQueue.h"
+
+#include <das/DasApi.h>
+#include <das/DasPtr.hpp>
+#include <das/Utils/fmt.h>
+#include <das/_autogen/idl/abi/DasLogger.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <utility>
+
+DAS_NS_BEGIN
+
+DAS_NS_ANONYMOUS_DETAILS_BEGIN
+
+/**
+ * @brief IDasAsyncOperation of one gesture batch.
+ *
+ * A batch can only be canceled before the worker picked it up; a running
+ * shell command is never interrupted halfway through a gesture.
+ */
+class AdbGestureOperation final : public IDasAsyncOperation
+{
+    enum class Phase : int32_t
+    {
+        Pending,
+        Running,
+        Done
+    };
+
+public:
+    DAS_UTILS_IDASBASE_AUTO_IMPL(AdbGestureOperation);
+
+    DAS_IMPL QueryInterface(const DasGuid& iid, void** pp_out_object) override
+    {
+        DAS_UTILS_CHECK_POINTER_FOR_PLUGIN(pp_out_object)
+
+        if (iid == DasIidOf<IDasAsyncOperation>()
+            || iid == DasIidOf<IDasBase>())
+        {
+            *pp_out_object = static_cast<IDasAsyncOperation*>(this);
+            this->AddRef();
+            return DAS_S_OK;
+        }
+
+        *pp_out_object = nullptr;
+        return DAS_E_NO_INTERFACE;
+    }
+
+    // IDasAsyncOperation
+    int32_t GetStatus() override
+    {
+        return status_.load(std::memory_order_acquire);
+    }
+
+    DasResult SetCompleted(IDasAsyncCompletedHandler* p_handler) override
+    {
+        int32_t status = DAS_ASYNC_STARTED;
+        {
+            std::lock_guard lock{mutex_};
+            handler_ = p_handler;
+            status = status_.load(std::memory_order_acquire);
+        }
+        // 如果已完成，立即回调
+        if (status != DAS_ASYNC_STARTED && p_handler != nullptr)
+        {
+            p_handler->OnCompleted(this, status);
+        }
+        return DAS_S_OK;
+    }
+
+    DasResult Cancel() override
+    {
+        auto expected = Phase::Pending;
+        if (phase_.compare_exchange_strong(
+                expected,
+                Phase::Done,
+                std::memory_order_acq_rel))
+        {
+            Complete(DAS_ASYNC_CANCELED);
+            return DAS_S_OK;
+        }
+        return expected == Phase::Running ? DAS_E_TASK_WORKING : DAS_S_FALSE;
+    }
+
+    /// @brief Claim the batch for execution. False if it was canceled
+    bool TryStart()
+    {
+        auto expected = Phase::Pending;
+        return phase_.compare_exchange_strong(
+            expected,
+            Phase::Running,
+            std::memory_order_acq_rel);
+    }
+
+    void Finish(DasResult result)
+    {
+        phase_.store(Phase::Done, std::memory_order_release);
+        Complete(IsOk(result) ? DAS_ASYNC_COMPLETED : DAS_ASYNC_FAILED);
+    }
+
+private:
+    void Complete(int32_t status)
+    {
+        DasPtr<IDasAsyncCompletedHandler> handler;
+        {
+            std::lock_guard lock{mutex_};
+            status_.store(status, std::memory_order_release);
+            handler = handler_;
+        }
+        if (handler)
+        {
+            handler->OnCompleted(this, status);
+        }
+    }
+
+    std::atomic<Phase>                phase_{Phase::Pending};
+    std::atomic<int32_t>              status_{DAS_ASYNC_STARTED};
+    std::mutex                        mutex_;
+    DasPtr<IDasAsyncCompletedHandler> handler_;
+};
+
+void AppendGesture(std::string& text, const DasTouchGesture& gesture)
+{
+    if (!text.empty())
+    {
+        text += " && ";
+    }
+    auto out = std::back_inserter(text);
+    switch (gesture.type)
+    {
+    case DAS_TOUCH_GESTURE_TAP:
+        DAS::fmt::format_to(out, "input tap {} {}", gesture.x, gesture.y);
+        break;
+    case DAS_TOUCH_GESTURE_SWIPE:
+        DAS::fmt::format_to(
+            out,
+            "input swipe {} {} {} {} {}",
+            gesture.x,
+            gesture.y,
+            gesture.end_x,
+            gesture.end_y,
+            gesture.duration_ms);
+        break;
+    case DAS_TOUCH_GESTURE_WAIT:
+        DAS::fmt::format_to(
+            out,
+            "sleep {}.{:03}",
+            gesture.duration_ms / 1000,
+            gesture.duration_ms % 1000);
+        break;
+    default:
+        break;
+    }
+}
+
+DAS_NS_ANONYMOUS_DETAILS_END
+
+auto BuildGestureCommand(std::span<const DasTouchGesture> gestures)
+    -> DAS::Utils::Expected<AdbShellCommand>
+{
+    if (gestures.empty()) [[unlikely]]
+    {
+        return tl::make_unexpected(DAS_E_INVALID_ARGUMENT);
+    }
+
+    AdbShellCommand result{};
+    for (const auto& gesture : gestures)
+    {
+        switch (gesture.type)
+        {
+        case DAS_TOUCH_GESTURE_TAP:
+            break;
+        case DAS_TOUCH_GESTURE_SWIPE:
+            [[fallthrough]];
+        case DAS_TOUCH_GESTURE_WAIT:
+            if (gesture.duration_ms < 0) [[unlikely]]
+            {
+                const auto error_message = DAS::fmt::format(
+                    "Negative gesture duration: {}.",
+                    gesture.duration_ms);
+                DAS_LOG_ERROR(error_message.c_str());
+                return tl::make_unexpected(DAS_E_INVALID_ARGUMENT);
+            }
+            result.expected_duration +=
+                std::chrono::milliseconds{gesture.duration_ms};
+            if (gesture.type == DAS_TOUCH_GESTURE_WAIT
+                && gesture.duration_ms == 0)
+            {
+                continue;
+            }
+            break;
+        default:
+        {
+            const auto error_message =
+                DAS::fmt::format("Unknown gesture type: {}.", gesture.type);
+            DAS_LOG_ERROR(error_message.c_str());
+            return tl::make_unexpected(DAS_E_INVALID_ENUM);
+        }
+        }
+        Details::AppendGesture(result.text, gesture);
+    }
+
+    // Only zero-length waits: still a valid (empty) batch.
+    if (result.text.empty())
+    {
+        result.text = "true";
+    }
+    return result;
+}
+
+struct AdbGestureQueue::State
+{
+    struct Item
+    {
+        DasPtr<Details::AdbGestureOperation> operation;
+        AdbShellCommand                      command;
+    };
+
+    explicit State(std::shared_ptr<AdbShellChannel> shell_channel)
+        : channel{std::move(shell_channel)}
+    {
+    }
+
+    std::shared_ptr<AdbShellChannel> channel;
+    std::mutex                       mutex;
+    std::condition_variable          cv;
+    std::deque<Item>                 items;
+    bool                             stopping{false};
+};
+
+AdbGestureQueue::AdbGestureQueue(std::shared_ptr<AdbShellChannel> channel)
+    : state_{std::make_shared<State>(std::move(channel))}
+{
+}
+
+AdbGestureQueue::~AdbGestureQueue()
+{
+    {
+        std::lock_guard lock{state_->mutex};
+        state_->stopping = true;
+    }
+    state_->cv.notify_all();
+
+    if (!worker_.joinable())
+    {
+        return;
+    }
+    // The last reference may be released by a completion handler, which runs
+    // on the worker itself. The worker owns the state, so it can finish alone.
+    if (worker_.get_id() == std::this_thread::get_id())
+    {
+        worker_.detach();
+        return;
+    }
+    worker_.join();
+}
+
+DasResult AdbGestureQueue::Enqueue(
+    AdbShellCommand      command,
+    IDasAsyncOperation** pp_out_operation)
+{
+    DAS_UTILS_CHECK_POINTER_FOR_PLUGIN(pp_out_operation)
+
+    try
+    {
+        const auto operation = MakeDasPtr<Details::AdbGestureOperation>();
+        {
+            std::lock_guard lock{state_->mutex};
+            if (!worker_.joinable())
+            {
+                worker_ = std::thread{&AdbGestureQueue::Run, state_};
+            }
+            state_->items.push_back({operation, std::move(command)});
+        }
+        state_->cv.notify_one();
+
+        *pp_out_operation = operation.Get();
+        operation->AddRef();
+        return DAS_S_OK;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return DAS_E_OUT_OF_MEMORY;
+    }
+    catch (const std::system_error& ex)
+    {
+        DAS_LOG_ERROR(ex.what());
+        return DAS_E_INTERNAL_FATAL_ERROR;
+    }
+}
+
+void AdbGestureQueue::Run(std::shared_ptr<State> state)
+{
+    for (;;)
+    {
+        std::unique_lock lock{state->mutex};
+        state->cv.wait(
+            lock,
+            [&state] { return state->stopping || !state->items.empty(); });
+        if (state->stopping)
+        {
+            auto canceled = std::move(state->items);
+            lock.unlock();
+            for (auto& item : canceled)
+            {
+                item.operation->Cancel();
+            }
+            return;
+        }
+
+        auto item = std::move(state->items.front());
+        state->items.pop_front();
+        lock.unlock();
+
+        if (!item.operation->TryStart())
+        {
+            continue;
+        }
+        const auto result = state->channel->Execute(
+            item.command.text,
+            item.command.expected_duration);
+        item.operation->Finish(result);
+    }
+}
+
+DAS_NS_END
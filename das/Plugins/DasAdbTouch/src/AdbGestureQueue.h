@@ -0,0 +1,65 @@
+#ifndef DAS_PLUGINS_DASADBTOUCH_ADBGESTUREQUEUE_H
+#define DAS_PLUGINS_DASADBTOUCH_ADBGESTUREQUEUE_H
+
+#include "AdbShellChannel.h"
+
+#include <das/DasConfig.h>
+#include <das/IDasAsyncOperation.h>
+#include <das/Utils/CommonUtils.hpp>
+#include <das/Utils/Expected.h>
+#include <das/_autogen/idl/abi/IDasInput.h>
+
+#include <chrono>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+
+DAS_NS_BEGIN
+
+using namespace Das::PluginInterface;
+
+struct AdbShellCommand
+{
+    std::string               text;
+    std::chrono::milliseconds expected_duration{0};
+};
+
+/**
+ * @brief Translate gestures into one shell command line.
+ *
+ * Gestures are chained with `&&`, so the whole batch costs a single round
+ * trip, delays are timed on the device by `sleep`, and the first failing
+ * gesture stops the rest.
+ */
+auto BuildGestureCommand(std::span<const DasTouchGesture> gestures)
+    -> DAS::Utils::Expected<AdbShellCommand>;
+
+/**
+ * @brief Runs queued gesture batches on a worker thread, in submission order,
+ * through a shared AdbShellChannel.
+ *
+ * Batches still queued when the queue is destroyed are reported as canceled.
+ */
+class AdbGestureQueue final : public DAS::Utils::NonCopyableAndNonMovable
+{
+public:
+    explicit AdbGestureQueue(std::shared_ptr<AdbShellChannel> channel);
+    ~AdbGestureQueue();
+
+    DasResult Enqueue(
+        AdbShellCommand      command,
+        IDasAsyncOperation** pp_out_operation);
+
+private:
+    struct State;
+
+    static void Run(std::shared_ptr<State> state);
+
+    std::shared_ptr<State> state_;
+    std::thread            worker_;
+};
+
+DAS_NS_END
+
+#endif // DAS_PLUGINS_DASADBTOUCH_ADBGESTUREQUEUE_H
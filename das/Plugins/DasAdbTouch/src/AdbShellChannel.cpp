@@ -0,0 +1,349 @@
+#include "AdbShellChannel.h"
+
+#include <das/DasApi.h>
+#include <das/Utils/fmt.h>
+#include <das/_autogen/idl/abi/DasLogger.h>
+
+DAS_DISABLE_WARNING_BEGIN
+DAS_IGNORE_BOOST_PROCESS_WARNING
+
+#include <boost/asio.hpp>
+#include <boost/process/v2/environment.hpp>
+#include <boost/process/v2/process.hpp>
+#include <boost/process/v2/stdio.hpp>
+#include <boost/system/error_code.hpp>
+#include <boost/system/system_error.hpp>
+
+DAS_DISABLE_WARNING_END
+
+#include <array>
+#include <charconv>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+DAS_NS_BEGIN
+
+DAS_NS_ANONYMOUS_DETAILS_BEGIN
+
+constexpr auto ADB_EXECUTABLE_NAME = "adb";
+
+constexpr std::string_view DONE_MARKER_PREFIX = "__DAS_ADB_SHELL_DONE_";
+
+constexpr std::size_t READ_CHUNK_SIZE = 4096;
+
+DAS_NS_ANONYMOUS_DETAILS_END
+
+struct AdbShellChannel::Impl
+{
+    Impl(
+        std::string               adb_path,
+        std::string               adb_serial,
+        std::chrono::milliseconds command_timeout)
+        : path{std::move(adb_path)}, serial{std::move(adb_serial)},
+          timeout{command_timeout}, stdin_pipe{ioc}, stdout_pipe{ioc}
+    {
+    }
+
+    ~Impl() { Stop(); }
+
+    std::string                                  path;
+    std::string                                  serial;
+    std::chrono::milliseconds                    timeout;
+    std::mutex                                   mutex;
+    boost::asio::io_context                      ioc;
+    boost::asio::writable_pipe                   stdin_pipe;
+    boost::asio::readable_pipe                   stdout_pipe;
+    std::unique_ptr<boost::process::v2::process> process;
+    /// stdout read from the shell but not consumed by a command yet
+    std::string                                  output;
+    std::array<char, Details::READ_CHUNK_SIZE>   read_buffer{};
+    uint64_t                                     sequence{0};
+
+    /**
+     * @brief Start one asynchronous operation and run it to completion, or
+     * stop the shell once operation_timeout elapses.
+     */
+    template <class Initiation>
+    auto Wait(
+        Initiation&&              initiation,
+        std::chrono::milliseconds operation_timeout)
+        -> std::pair<boost::system::error_code, std::size_t>
+    {
+        boost::system::error_code ec{};
+        std::size_t               bytes_transferred = 0;
+        bool                      completed = false;
+        std::forward<Initiation>(initiation)(
+            [&](boost::system::error_code handler_ec, std::size_t bytes)
+            {
+                ec = handler_ec;
+                bytes_transferred = bytes;
+                completed = true;
+            });
+
+        ioc.restart();
+        ioc.run_for(operation_timeout);
+        if (!completed)
+        {
+            // Closing the pipes aborts the pending operation; run its handler
+            // so that nothing refers to this frame afterwards.
+            boost::system::error_code ignored;
+            stdin_pipe.close(ignored);
+            stdout_pipe.close(ignored);
+            ioc.restart();
+            ioc.run();
+            ec = boost::asio::error::timed_out;
+        }
+        return {ec, bytes_transferred};
+    }
+
+    [[nodiscard]]
+    bool IsRunning() const
+    {
+        boost::system::error_code ec;
+        return process && process->running(ec);
+    }
+
+    DasResult Start()
+    {
+        Stop();
+
+        std::vector<std::string> args;
+        if (!serial.empty())
+        {
+            args.emplace_back("-s");
+            args.push_back(serial);
+        }
+        args.emplace_back("shell");
+
+        try
+        {
+            const auto executable =
+                path.empty() ? boost::process::v2::environment::find_executable(
+                                   Details::ADB_EXECUTABLE_NAME)
+                             : boost::process::v2::filesystem::path{path};
+            if (executable.empty()) [[unlikely]]
+            {
+                DAS_LOG_ERROR("Can not find adb in PATH.");
+                return DAS_E_FILE_NOT_FOUND;
+            }
+
+            process = std::make_unique<boost::process::v2::process>(
+                ioc,
+                executable,
+                args,
+                boost::process::v2::process_stdio{
+                    stdin_pipe,
+                    stdout_pipe,
+                    nullptr});
+        }
+        catch (const boost::system::system_error& ex)
+        {
+            const auto error_message = DAS::fmt::format(
+                "Failed to start adb shell. Path = {}. Message = {}.",
+                path,
+                ex.what());
+            DAS_LOG_ERROR(error_message.c_str());
+            Stop();
+            return DAS_E_INTERNAL_FATAL_ERROR;
+        }
+
+        const auto info = DAS::fmt::format(
+            "Started adb shell channel for device {}.",
+            serial.empty() ? std::string_view{"<any>"} : serial);
+        DAS_LOG_INFO(info.c_str());
+        return DAS_S_OK;
+    }
+
+    void Stop()
+    {
+        boost::system::error_code ignored;
+        stdin_pipe.close(ignored);
+        stdout_pipe.close(ignored);
+        if (process)
+        {
+            if (process->running(ignored))
+            {
+                process->terminate(ignored);
+            }
+            process->wait(ignored);
+            process.reset();
+        }
+        output.clear();
+    }
+
+    DasResult ReportIoError(
+        std::string_view                 operation,
+        const boost::system::error_code& ec) const
+    {
+        const auto error_message = DAS::fmt::format(
+            "Adb shell {} failed: {}.",
+            operation,
+            ec.message());
+        DAS_LOG_ERROR(error_message.c_str());
+        return ec == boost::asio::error::timed_out ? DAS_E_TIMEOUT
+                                                   : DAS_E_INTERNAL_FATAL_ERROR;
+    }
+
+    /**
+     * @brief Consume complete lines from output until the marker line.
+     * @return true with p_out_status set once the marker line was found
+     */
+    bool TakeStatusLine(std::string_view marker, int* p_out_status)
+    {
+        std::size_t newline = 0;
+        while ((newline = output.find('\n')) != std::string::npos)
+        {
+            std::string_view line{output.data(), newline};
+            if (line.ends_with('\r'))
+            {
+                line.remove_suffix(1);
+            }
+
+            if (line.starts_with(marker))
+            {
+                line.remove_prefix(marker.size());
+                while (line.starts_with(' '))
+                {
+                    line.remove_prefix(1);
+                }
+                int status = -1;
+                std::from_chars(line.data(), line.data() + line.size(), status);
+                output.erase(0, newline + 1);
+                *p_out_status = status;
+                return true;
+            }
+
+            // `input` prints nothing on success; anything else is only useful
+            // for diagnostics.
+            const auto info =
+                DAS::fmt::format("Adb shell output ignored: {}", line);
+            DAS_LOG_INFO(info.c_str());
+            output.erase(0, newline + 1);
+        }
+        return false;
+    }
+
+    DasResult RunCommand(
+        std::string_view          command,
+        std::chrono::milliseconds expected_duration)
+    {
+        const auto deadline =
+            std::chrono::steady_clock::now() + timeout + expected_duration;
+        const auto remaining = [deadline]
+        {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+        };
+
+        const auto marker = DAS::fmt::format(
+            "{}{}__",
+            Details::DONE_MARKER_PREFIX,
+            ++sequence);
+        const auto line = DAS::fmt::format("{}; echo {} $?\n", command, marker);
+
+        const auto [write_ec, _] = Wait(
+            [&](auto&& handler)
+            {
+                boost::asio::async_write(
+                    stdin_pipe,
+                    boost::asio::buffer(line),
+                    std::forward<decltype(handler)>(handler));
+            },
+            remaining());
+        if (write_ec) [[unlikely]]
+        {
+            return ReportIoError("write", write_ec);
+        }
+
+        int status = -1;
+        while (!TakeStatusLine(marker, &status))
+        {
+            const auto time_left = remaining();
+            if (time_left <= std::chrono::milliseconds::zero()) [[unlikely]]
+            {
+                return ReportIoError("read", boost::asio::error::timed_out);
+            }
+
+            const auto [read_ec, bytes_read] = Wait(
+                [&](auto&& handler)
+                {
+                    stdout_pipe.async_read_some(
+                        boost::asio::buffer(read_buffer),
+                        std::forward<decltype(handler)>(handler));
+                },
+                time_left);
+            if (read_ec) [[unlikely]]
+            {
+                return ReportIoError("read", read_ec);
+            }
+            output.append(read_buffer.data(), bytes_read);
+        }
+
+        if (status != 0) [[unlikely]]
+        {
+            const auto error_message = DAS::fmt::format(
+                "Adb shell command failed with status {}. Command = {}.",
+                status,
+                command);
+            DAS_LOG_ERROR(error_message.c_str());
+            return DAS_E_FAIL;
+        }
+        return DAS_S_OK;
+    }
+};
+
+AdbShellChannel::AdbShellChannel(
+    std::string               adb_path,
+    std::string               adb_serial,
+    std::chrono::milliseconds timeout)
+    : impl_{std::make_unique<Impl>(
+          std::move(adb_path),
+          std::move(adb_serial),
+          timeout)}
+{
+}
+
+AdbShellChannel::~AdbShellChannel() = default;
+
+DasResult AdbShellChannel::Execute(
+    std::string_view          command,
+    std::chrono::milliseconds expected_duration)
+{
+    std::lock_guard lock{impl_->mutex};
+
+    // A shell that exited since the last command (e.g. the device was
+    // unplugged) is detected here, before anything is written to it. Commands
+    // are never retried: a gesture must not run twice.
+    if (!impl_->IsRunning())
+    {
+        if (const auto result = impl_->Start(); IsFailed(result))
+        {
+            return result;
+        }
+    }
+
+    const auto result = impl_->RunCommand(command, expected_duration);
+    // A failed command leaves the shell usable, but after an I/O error or a
+    // timeout the stream is out of step with our markers.
+    if (IsFailed(result) && result != DAS_E_FAIL)
+    {
+        impl_->Stop();
+    }
+    return result;
+}
+
+bool AdbShellChannel::IsRunning() const
+{
+    std::lock_guard lock{impl_->mutex};
+    return impl_->IsRunning();
+}
+
+void AdbShellChannel::Stop()
+{
+    std::lock_guard lock{impl_->mutex};
+    impl_->Stop();
+}
+
+DAS_NS_END
@@ -0,0 +1,60 @@
+#ifndef DAS_PLUGINS_DASADBTOUCH_ADBSHELLCHANNEL_H
+#define DAS_PLUGINS_DASADBTOUCH_ADBSHELLCHANNEL_H
+
+#include <das/DasConfig.h>
+#include <das/IDasBase.h>
+#include <das/Utils/CommonUtils.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+
+DAS_NS_BEGIN
+
+/**
+ * @brief One long-lived `adb shell` process that commands are piped into.
+ *
+ * Spawning adb per gesture costs 100-200 ms. The channel starts
+ * `adb -s <serial> shell` once and writes each command to its stdin, followed
+ * by `echo <marker> $?`; the command is finished when the marker line shows
+ * up on stdout, and its exit status is read from that line.
+ *
+ * Any I/O error or timeout stops the process; the next command starts a new
+ * one. Thread-safe: commands from different threads are serialized.
+ */
+class AdbShellChannel final : public DAS::Utils::NonCopyableAndNonMovable
+{
+public:
+    static constexpr std::chrono::milliseconds DEFAULT_TIMEOUT{5000};
+
+    /// @param adb_path empty searches adb in PATH
+    /// @param adb_serial empty selects the only connected device
+    AdbShellChannel(
+        std::string               adb_path,
+        std::string               adb_serial,
+        std::chrono::milliseconds timeout = DEFAULT_TIMEOUT);
+    ~AdbShellChannel();
+
+    /**
+     * @brief Run one shell command and wait for it to exit.
+     * @param expected_duration how long the command itself is expected to
+     * take, added to the timeout
+     */
+    DasResult Execute(
+        std::string_view          command,
+        std::chrono::milliseconds expected_duration = {});
+
+    [[nodiscard]]
+    bool IsRunning() const;
+
+    void Stop();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+DAS_NS_END
+
+#endif // DAS_PLUGINS_DASADBTOUCH_ADBSHELLCHANNEL_H
@@ -5,30 +5,9 @@
 #include <das/Utils/fmt.h>
 #include <das/_autogen/idl/abi/DasLogger.h>
 
-#if defined(_WIN32) || defined(__CYGWIN__)
-
-#ifndef WIN32_LEAN_AND_MEAN
-#define WIN32_LEAN_AND_MEAN
-#endif // WIN32_LEAN_AND_MEAN
-
-#include <Windows.h>
-#endif // WIN32
-
-DAS_DISABLE_WARNING_BEGIN
-DAS_IGNORE_UNUSED_PARAMETER
-
-#ifdef _MSC_VER
-DAS_PRAGMA(warning(disable : 4189 4245))
-#endif // _MSC_VER
-
-#include <boost/asio.hpp>
-#include <boost/process/v2/execute.hpp>
-#include <boost/process/v2/process.hpp>
-
-DAS_DISABLE_WARNING_END
-#include <chrono>
-
-using namespace std::literals;
+#include <span>
+#include <utility>
+#include <vector>
 
 DAS_NS_BEGIN
 
@@ -41,91 +20,13 @@ const DasGuid DAS_IID_ADB_TOUCH = {
     0x4e61,
     {0xad, 0x29, 0x53, 0xd4, 0x57, 0x98, 0x12, 0xd3}};
 
-class ProcessExecutor
-{
-    boost::asio::io_context          ctx_;
-    boost::asio::steady_timer        timeout_timer_;
-    boost::asio::cancellation_signal sig_;
-    std::chrono::milliseconds        timeout_in_ms_;
-    std::string                      command_;
-    DasResult                        result_;
-
-public:
-    ProcessExecutor(
-        std::string_view          cmd,
-        std::chrono::milliseconds timeout_in_ms)
-        : ctx_{}, timeout_timer_{ctx_, timeout_in_ms}, sig_{},
-          timeout_in_ms_{timeout_in_ms}, command_{cmd},
-          result_{DAS_E_UNDEFINED_RETURN_VALUE}
-    {
-        boost::process::v2::async_execute(
-            boost::process::v2::process{ctx_, cmd, {}},
-            boost::asio::bind_cancellation_slot(
-                sig_.slot(),
-                [this](boost::system::error_code ec, int exit_code)
-                {
-                    const auto info =
-                        fmt::format("{} return {}.", command_, exit_code);
-                    if (ec)
-                    {
-                        DAS_LOG_ERROR(info.c_str());
-                        const auto error_message = fmt::format(
-                            "Error happened when executing command {}. Message = {}.",
-                            command_,
-                            ToString(ec.message()));
-                        DAS_LOG_ERROR(error_message.c_str());
-                        if (result_ != DAS_E_TIMEOUT)
-                        {
-                            result_ = DAS_E_INTERNAL_FATAL_ERROR;
-                        }
-                        return;
-                    }
-                    else [[likely]]
-                    {
-                        DAS_LOG_INFO(info.c_str());
-                        result_ = DAS_S_OK;
-                    }
-
-                    timeout_timer_.cancel(); // we're done earlier
-                }));
-        timeout_timer_.async_wait(
-            [this](boost::system::error_code ec)
-            {
-                if (ec) // we were cancelled, do nothing
-                {
-                    return;
-                }
-                result_ = DAS_E_TIMEOUT;
-                const auto error_message = fmt::format(
-                    "Timeout detected when executing command {}.",
-                    command_);
-                DAS_LOG_ERROR(error_message.c_str());
-                sig_.emit(boost::asio::cancellation_type::partial);
-                // request exit first, but terminate after another
-                // timeout_in_ms_
-                timeout_timer_.expires_after(this->timeout_in_ms_);
-                timeout_timer_.async_wait(
-                    [this](boost::system::error_code timer_ec)
-                    {
-                        if (!timer_ec)
-                        {
-                            sig_.emit(boost::asio::cancellation_type::terminal);
-                        }
-                    });
-            });
-    }
-
-    DasResult Run()
-    {
-        ctx_.run();
-        return result_;
-    }
-};
-
 DAS_NS_ANONYMOUS_DETAILS_END
 
 AdbTouch::AdbTouch(std::string_view adb_path, std::string_view adb_serial)
-    : adb_cmd_{fmt::format("{} -s {} ", adb_path, adb_serial)}
+    : shell_channel_{std::make_shared<AdbShellChannel>(
+          std::string{adb_path},
+          std::string{adb_serial})},
+      gesture_queue_{shell_channel_}
 {
 }
 
@@ -144,6 +45,14 @@ DasResult AdbTouch::QueryInterface(const DasGuid& iid, void** pp_out_object)
         return DAS_S_OK;
     }
 
+    // 检查IID_IDasTouchGestureBatch
+    if (iid == DasIidOf<IDasTouchGestureBatch>())
+    {
+        *pp_out_object = static_cast<IDasTouchGestureBatch*>(this);
+        this->AddRef();
+        return DAS_S_OK;
+    }
+
     // 检查IID_IDasTypeInfo
     if (iid == DAS_IID_TYPE_INFO)
     {
@@ -155,7 +64,7 @@ DasResult AdbTouch::QueryInterface(const DasGuid& iid, void** pp_out_object)
     // 检查IID_IDasBase
     if (iid == DAS_IID_BASE)
     {
-        *pp_out_object = static_cast<IDasBase*>(this);
+        *pp_out_object = static_cast<IDasBase*>(static_cast<IDasTouch*>(this));
         this->AddRef();
         return DAS_S_OK;
     }
@@ -180,24 +89,70 @@ DAS_IMPL AdbTouch::GetRuntimeClassName(IDasReadOnlyString** pp_out_name)
 
 DAS_IMPL AdbTouch::Click(int32_t x, int32_t y)
 {
-    const auto cmd = fmt::format("{} shell input tap {} {}", adb_cmd_, x, y);
-    Details::ProcessExecutor executor{cmd, 5000ms};
-    return executor.Run();
+    const DasTouchGesture tap{
+        .type = DAS_TOUCH_GESTURE_TAP,
+        .x = x,
+        .y = y,
+        .end_x = x,
+        .end_y = y,
+        .duration_ms = 0};
+    const auto command = BuildGestureCommand({&tap, 1});
+    if (!command) [[unlikely]]
+    {
+        return command.error();
+    }
+    return shell_channel_->Execute(
+        command->text,
+        command->expected_duration);
 }
 
 DAS_IMPL AdbTouch::Swipe(DasPoint from, DasPoint to, int32_t duration_ms)
 {
-    const auto cmd = fmt::format(
-        "{} shell input swipe {} {} {} {}",
-        adb_cmd_,
-        from.x,
-        from.y,
-        to.x,
-        to.y);
-    Details::ProcessExecutor executor{
-        cmd,
-        std::chrono::milliseconds{duration_ms}};
-    return executor.Run();
+    const DasTouchGesture swipe{
+        .type = DAS_TOUCH_GESTURE_SWIPE,
+        .x = from.x,
+        .y = from.y,
+        .end_x = to.x,
+        .end_y = to.y,
+        .duration_ms = duration_ms};
+    const auto command = BuildGestureCommand({&swipe, 1});
+    if (!command) [[unlikely]]
+    {
+        return command.error();
+    }
+    return shell_channel_->Execute(
+        command->text,
+        command->expected_duration);
+}
+
+DAS_IMPL AdbTouch::AddGesture(DasTouchGesture gesture)
+{
+    std::lock_guard lock{pending_mutex_};
+    pending_gestures_.push_back(gesture);
+    return DAS_S_OK;
+}
+
+DAS_IMPL AdbTouch::Submit(IDasBase** pp_out_operation)
+{
+    DAS_UTILS_CHECK_POINTER_FOR_PLUGIN(pp_out_operation)
+    *pp_out_operation = nullptr;
+
+    std::vector<DasTouchGesture> gestures;
+    {
+        std::lock_guard lock{pending_mutex_};
+        gestures.swap(pending_gestures_);
+    }
+
+    auto command = BuildGestureCommand(gestures);
+    if (!command) [[unlikely]]
+    {
+        return command.error();
+    }
+    IDasAsyncOperation* p_operation = nullptr;
+    const auto result =
+        gesture_queue_.Enqueue(std::move(*command), &p_operation);
+    *pp_out_operation = p_operation;
+    return result;
 }
 
 DAS_NS_END
@@ -1,19 +1,34 @@
 #ifndef DAS_PLUGINS_DASADBTOUCH_ADBTOUCH_H
 #define DAS_PLUGINS_DASADBTOUCH_ADBTOUCH_H
 
+#include "AdbGestureQueue.h"
+#include "AdbShellChannel.h"
+
 #include <das/Utils/CommonUtils.hpp>
 #include <das/_autogen/idl/abi/IDasInput.h>
-#include <string>
+#include <memory>
+#include <mutex>
 #include <string_view>
+#include <vector>
 
 DAS_NS_BEGIN
 
 using namespace Das::PluginInterface;
 
-class AdbTouch final : public IDasTouch
+/**
+ * @brief IDasTouch over one persistent `adb shell`.
+ *
+ * Click and Swipe run synchronously. IDasTouchGestureBatch collects gestures
+ * with AddGesture and queues them as one batch on Submit; batches run in
+ * order on a worker thread, and synchronous gestures may run between two
+ * queued batches.
+ */
+class AdbTouch final : public IDasTouch, public IDasTouchGestureBatch
 {
-    // should be f"{adb_path} -s {adb_serial} "
-    std::string adb_cmd_;
+    std::shared_ptr<AdbShellChannel> shell_channel_;
+    AdbGestureQueue                  gesture_queue_;
+    std::mutex                       pending_mutex_;
+    std::vector<DasTouchGesture>     pending_gestures_;
 
 public:
     AdbTouch(std::string_view adb_path, std::string_view adb_serial);
@@ -27,6 +42,9 @@ public:
     DAS_IMPL Click(int32_t x, int32_t y) override;
     // IDasTouch
     DAS_IMPL Swipe(DasPoint from, DasPoint to, int32_t duration_ms) override;
+    // IDasTouchGestureBatch
+    DAS_IMPL AddGesture(DasTouchGesture gesture) override;
+    DAS_IMPL Submit(IDasBase** pp_out_operation) override;
 };
 
 DAS_NS_END
@@ -0,0 +1,322 @@
+#include <gtest/gtest.h>
+
+#include "../src/AdbGestureQueue.h"
+#include "../src/AdbShellChannel.h"
+#include "../src/AdbTouch.h"
+
+#include <das/DasApi.h>
+#include <das/DasPtr.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Das
+{
+    namespace Test
+    {
+        namespace
+        {
+            using namespace std::literals;
+
+            constexpr auto FAKE_ADB_PATH = DAS_ADB_TOUCH_FAKE_ADB_PATH;
+
+            /// Reports the status passed to OnCompleted through a future
+            class CompletionWaiter final : public IDasAsyncCompletedHandler
+            {
+            public:
+                DAS_UTILS_IDASBASE_AUTO_IMPL(CompletionWaiter);
+
+                DasResult QueryInterface(const DasGuid& iid, void** pp)
+                    override
+                {
+                    if (iid == DasIidOf<IDasAsyncCompletedHandler>()
+                        || iid == DasIidOf<IDasBase>())
+                    {
+                        AddRef();
+                        *pp = static_cast<IDasAsyncCompletedHandler*>(this);
+                        return DAS_S_OK;
+                    }
+                    return DAS_E_NO_INTERFACE;
+                }
+
+                DasResult OnCompleted(IDasBase*, int32_t status) override
+                {
+                    promise_.set_value(status);
+                    return DAS_S_OK;
+                }
+
+                auto Wait() -> int32_t
+                {
+                    auto future = promise_.get_future();
+                    if (future.wait_for(10s) != std::future_status::ready)
+                    {
+                        ADD_FAILURE() << "gesture batch did not complete";
+                        return -1;
+                    }
+                    return future.get();
+                }
+
+            private:
+                std::promise<int32_t> promise_;
+            };
+
+            auto Tap(int32_t x, int32_t y) -> DasTouchGesture
+            {
+                return {DAS_TOUCH_GESTURE_TAP, x, y, x, y, 0};
+            }
+
+            auto Wait(int32_t duration_ms) -> DasTouchGesture
+            {
+                return {DAS_TOUCH_GESTURE_WAIT, 0, 0, 0, 0, duration_ms};
+            }
+
+            auto SubmitGestures(
+                IDasTouchGestureBatch*           p_batch,
+                std::span<const DasTouchGesture> gestures,
+                DasPtr<IDasAsyncOperation>&      operation) -> DasResult
+            {
+                for (const auto& gesture : gestures)
+                {
+                    const auto result = p_batch->AddGesture(gesture);
+                    if (IsFailed(result))
+                    {
+                        return result;
+                    }
+                }
+                DasPtr<IDasBase> submitted;
+                const auto result = p_batch->Submit(submitted.Put());
+                if (IsFailed(result))
+                {
+                    return result;
+                }
+                return submitted.As(operation);
+            }
+        } // namespace
+
+        TEST(AdbGestureCommandTest, chains_gestures_in_order)
+        {
+            const std::vector<DasTouchGesture> gestures{
+                Tap(1, 2),
+                Wait(1050),
+                {DAS_TOUCH_GESTURE_SWIPE, 10, 20, 30, 40, 300},
+                Wait(0)};
+
+            const auto command = BuildGestureCommand(gestures);
+            ASSERT_TRUE(command);
+            EXPECT_EQ(
+                command->text,
+                "input tap 1 2 && sleep 1.050 && "
+                "input swipe 10 20 30 40 300");
+            EXPECT_EQ(command->expected_duration, 1350ms);
+        }
+
+        TEST(AdbGestureCommandTest, rejects_invalid_gestures)
+        {
+            EXPECT_EQ(
+                BuildGestureCommand({}).error(),
+                DAS_E_INVALID_ARGUMENT);
+
+            const DasTouchGesture unknown{42, 0, 0, 0, 0, 0};
+            EXPECT_EQ(
+                BuildGestureCommand({&unknown, 1}).error(),
+                DAS_E_INVALID_ENUM);
+
+            const auto negative = Wait(-1);
+            EXPECT_EQ(
+                BuildGestureCommand({&negative, 1}).error(),
+                DAS_E_INVALID_ARGUMENT);
+        }
+
+        class AdbTouchTest : public ::testing::Test
+        {
+        protected:
+            void SetUp() override
+            {
+                const auto* test_info =
+                    ::testing::UnitTest::GetInstance()->current_test_info();
+                log_path_ = std::filesystem::temp_directory_path()
+                            / (std::string{"DasAdbTouchTest_"}
+                               + test_info->name() + ".log");
+                std::filesystem::remove(log_path_);
+            }
+
+            void TearDown() override
+            {
+                std::error_code ec;
+                std::filesystem::remove(log_path_, ec);
+            }
+
+            auto MakeChannel() -> std::shared_ptr<AdbShellChannel>
+            {
+                return std::make_shared<AdbShellChannel>(
+                    FAKE_ADB_PATH,
+                    log_path_.string());
+            }
+
+            auto MakeTouch() -> DasPtr<AdbTouch>
+            {
+                return MakeDasPtr<AdbTouch>(
+                    FAKE_ADB_PATH,
+                    log_path_.string());
+            }
+
+            /// Commands seen by the fake shell, one per line
+            auto ReadLog() const -> std::vector<std::string>
+            {
+                std::vector<std::string> result;
+                std::ifstream            log{log_path_};
+                for (std::string line; std::getline(log, line);)
+                {
+                    result.push_back(line);
+                }
+                return result;
+            }
+
+            auto CountShellStarts() const -> std::ptrdiff_t
+            {
+                const auto log = ReadLog();
+                return std::count(log.begin(), log.end(), "# start");
+            }
+
+            std::filesystem::path log_path_;
+        };
+
+        TEST_F(AdbTouchTest, click_and_swipe_share_one_shell)
+        {
+            const auto touch = MakeTouch();
+
+            EXPECT_EQ(touch->Click(1, 2), DAS_S_OK);
+            EXPECT_EQ(touch->Swipe({3, 4}, {5, 6}, 100), DAS_S_OK);
+            EXPECT_EQ(touch->Click(7, 8), DAS_S_OK);
+
+            const std::vector<std::string> expected{
+                "# start",
+                "input tap 1 2",
+                "input swipe 3 4 5 6 100",
+                "input tap 7 8"};
+            EXPECT_EQ(ReadLog(), expected);
+        }
+
+        TEST_F(AdbTouchTest, failed_command_keeps_the_shell)
+        {
+            const auto channel = MakeChannel();
+
+            EXPECT_EQ(channel->Execute("false"), DAS_E_FAIL);
+            EXPECT_TRUE(channel->IsRunning());
+            EXPECT_EQ(channel->Execute("input tap 0 0"), DAS_S_OK);
+            EXPECT_EQ(CountShellStarts(), 1);
+        }
+
+        TEST_F(AdbTouchTest, restarts_shell_after_it_exited)
+        {
+            const auto channel = MakeChannel();
+
+            EXPECT_TRUE(IsFailed(channel->Execute("exit")));
+            EXPECT_FALSE(channel->IsRunning());
+            EXPECT_EQ(channel->Execute("input tap 0 0"), DAS_S_OK);
+            EXPECT_EQ(CountShellStarts(), 2);
+        }
+
+        TEST_F(AdbTouchTest, gesture_batch_completes_asynchronously)
+        {
+            const auto touch = MakeTouch();
+            DasPtr<IDasTouchGestureBatch> batch;
+            ASSERT_EQ(touch.As(batch), DAS_S_OK);
+
+            const std::vector<DasTouchGesture> gestures{
+                Tap(1, 1),
+                Wait(20),
+                {DAS_TOUCH_GESTURE_SWIPE, 1, 1, 9, 9, 50}};
+            DasPtr<IDasAsyncOperation> operation;
+            ASSERT_EQ(
+                SubmitGestures(batch.Get(), gestures, operation),
+                DAS_S_OK);
+
+            const auto waiter = MakeDasPtr<CompletionWaiter>();
+            ASSERT_EQ(operation->SetCompleted(waiter.Get()), DAS_S_OK);
+            EXPECT_EQ(waiter->Wait(), DAS_ASYNC_COMPLETED);
+            EXPECT_EQ(operation->GetStatus(), DAS_ASYNC_COMPLETED);
+
+            const std::vector<std::string> expected{
+                "# start",
+                "input tap 1 1",
+                "sleep 0.020",
+                "input swipe 1 1 9 9 50"};
+            EXPECT_EQ(ReadLog(), expected);
+        }
+
+        TEST_F(AdbTouchTest, queued_batch_can_be_canceled)
+        {
+            const auto touch = MakeTouch();
+            DasPtr<IDasTouchGestureBatch> batch;
+            ASSERT_EQ(touch.As(batch), DAS_S_OK);
+
+            const std::vector<DasTouchGesture> slow{Wait(300), Tap(1, 1)};
+            const auto                         fast = Tap(2, 2);
+            DasPtr<IDasAsyncOperation>         first;
+            DasPtr<IDasAsyncOperation>         second;
+            ASSERT_EQ(SubmitGestures(batch.Get(), slow, first), DAS_S_OK);
+            ASSERT_EQ(
+                SubmitGestures(batch.Get(), {&fast, 1}, second),
+                DAS_S_OK);
+
+            EXPECT_EQ(second->Cancel(), DAS_S_OK);
+            EXPECT_EQ(second->GetStatus(), DAS_ASYNC_CANCELED);
+
+            const auto waiter = MakeDasPtr<CompletionWaiter>();
+            ASSERT_EQ(first->SetCompleted(waiter.Get()), DAS_S_OK);
+            EXPECT_EQ(waiter->Wait(), DAS_ASYNC_COMPLETED);
+            EXPECT_EQ(first->Cancel(), DAS_S_FALSE);
+
+            // Batches run in order, so the canceled one would have run by now
+            EXPECT_EQ(touch->Click(3, 3), DAS_S_OK);
+            const std::vector<std::string> expected{
+                "# start",
+                "sleep 0.300",
+                "input tap 1 1",
+                "input tap 3 3"};
+            EXPECT_EQ(ReadLog(), expected);
+        }
+
+        TEST_F(AdbTouchTest, invalid_batch_is_rejected_before_queueing)
+        {
+            const auto touch = MakeTouch();
+            DasPtr<IDasTouchGestureBatch> batch;
+            ASSERT_EQ(touch.As(batch), DAS_S_OK);
+
+            // A swipe with a negative duration never reaches the shell
+            const DasTouchGesture invalid{
+                DAS_TOUCH_GESTURE_SWIPE,
+                0,
+                0,
+                1,
+                1,
+                -5};
+            DasPtr<IDasAsyncOperation> operation;
+            EXPECT_EQ(
+                SubmitGestures(batch.Get(), {&invalid, 1}, operation),
+                DAS_E_INVALID_ARGUMENT);
+            EXPECT_EQ(operation.Get(), nullptr);
+            EXPECT_FALSE(std::filesystem::exists(log_path_));
+
+            // The rejected gestures are dropped with the batch
+            ASSERT_EQ(
+                SubmitGestures(batch.Get(), std::array{Tap(4, 4)}, operation),
+                DAS_S_OK);
+            const auto waiter = MakeDasPtr<CompletionWaiter>();
+            ASSERT_EQ(operation->SetCompleted(waiter.Get()), DAS_S_OK);
+            EXPECT_EQ(waiter->Wait(), DAS_ASYNC_COMPLETED);
+            const std::vector<std::string> expected{
+                "# start",
+                "input tap 4 4"};
+            EXPECT_EQ(ReadLog(), expected);
+        }
+    } // namespace Test
+} // namespace Das
@@ -0,0 +1,110 @@
+// Stand-in for `adb -s <serial> shell` used by DasAdbTouchTest.
+//
+// Reads `<command>; echo <marker> $?` lines from stdin like a device shell
+// would, and appends every `&&`-separated part of <command> to a log file.
+// The device serial is used as the log file path.
+//
+// `input ...` succeeds, `sleep <seconds>` really sleeps, `exit` ends the
+// shell without an answer, and anything else fails with status 127. Every
+// answer is preceded by an unrelated line, as device output may be.
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+    constexpr std::string_view ECHO_SEPARATOR = "; echo ";
+    constexpr std::string_view STATUS_SUFFIX = " $?";
+    constexpr std::string_view AND_SEPARATOR = " && ";
+
+    enum class Outcome
+    {
+        Succeeded,
+        Failed,
+        Exit
+    };
+
+    Outcome Run(std::string_view command)
+    {
+        if (command == "exit")
+        {
+            return Outcome::Exit;
+        }
+        if (command.starts_with("input "))
+        {
+            return Outcome::Succeeded;
+        }
+        if (command.starts_with("sleep "))
+        {
+            const auto seconds = std::stod(std::string{command.substr(6)});
+            std::this_thread::sleep_for(
+                std::chrono::duration<double>{seconds});
+            return Outcome::Succeeded;
+        }
+        return Outcome::Failed;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 4 || std::string_view{argv[1]} != "-s"
+        || std::string_view{argv[3]} != "shell")
+    {
+        std::cerr << "usage: FakeAdb -s <log path> shell\n";
+        return 2;
+    }
+
+    std::ofstream log{argv[2], std::ios::app};
+    log << "# start" << std::endl;
+
+    std::string line;
+    while (std::getline(std::cin, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        const auto echo = line.rfind(ECHO_SEPARATOR);
+        if (echo == std::string::npos || !line.ends_with(STATUS_SUFFIX))
+        {
+            std::cerr << "unexpected line: " << line << '\n';
+            return 2;
+        }
+        std::string_view chain{line.data(), echo};
+        std::string_view marker{line};
+        marker = marker.substr(echo + ECHO_SEPARATOR.size());
+        marker.remove_suffix(STATUS_SUFFIX.size());
+
+        int status = 0;
+        for (;;)
+        {
+            const auto next = chain.find(AND_SEPARATOR);
+            const auto command = chain.substr(0, next);
+            log << command << std::endl;
+
+            const auto outcome = Run(command);
+            if (outcome == Outcome::Exit)
+            {
+                return 0;
+            }
+            if (outcome == Outcome::Failed)
+            {
+                status = 127;
+                break;
+            }
+            if (next == std::string_view::npos)
+            {
+                break;
+            }
+            chain.remove_prefix(next + AND_SEPARATOR.size());
+        }
+
+        std::cout << "noise from the device\n"
+                  << marker << ' ' << status << std::endl;
+    }
+    return 0;
+}
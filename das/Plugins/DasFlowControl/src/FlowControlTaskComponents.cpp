@@ -753,8 +753,9 @@ DasResult DasFlowControlTaskComponent::DoFor(
         step = 1; // 0 步长无意义且会死循环，兜底为 1。
     }
 
-    // 首次进入初始化计数器；循环状态是组件成员，跨多次 Do() 保持。组件实例
-    // 每次 GraphRuntime::Configure 重建，自然按图执行重置（不进 PortFrame）。
+    // 首次进入初始化计数器；循环状态是组件成员，跨多次 Do() 保持（不进
+    // PortFrame）。break 时复位，因此组件实例被 GraphRuntime 跨多次图执行复用
+    // 时，下一次执行仍从 start 开始。
     if (!loop_started_)
     {
         loop_index_ = start;
@@ -781,8 +782,9 @@ DasResult DasFlowControlTaskComponent::DoFor(
     }
     else
     {
-        // 范围耗尽，emit break 退出循环（不再激活循环体）。
+        // 范围耗尽，emit break 退出循环（不再激活循环体），并复位计数器。
         EmitSignal(output_map.Get(), "break");
+        loop_started_ = false;
     }
 
     *pp_out_port_map = output_map.Get();
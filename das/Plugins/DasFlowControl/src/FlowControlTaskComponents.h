@@ -115,9 +115,9 @@ private:
     yyjson::value                                  settings_;
     DasPtr<PluginInterface::IDasTaskComponentHost> host_;
 
-    // for-loop counter state. A fresh component instance is created per graph
-    // execution (GraphRuntime::Configure), so this naturally resets per run;
-    // it persists across the Do() calls of a single loop.
+    // for-loop counter state. Persists across the Do() calls of a single loop
+    // and resets when the loop emits `break`, so an instance kept configured
+    // across graph runs (GraphRuntime reuses components) starts over each run.
     int64_t loop_index_ = 0;
     bool    loop_started_ = false;
 };
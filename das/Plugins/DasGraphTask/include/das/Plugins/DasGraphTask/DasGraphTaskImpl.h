@@ -4,8 +4,12 @@
 #include <das/DasApi.h>
 #include <das/DasGuidHolder.h>
 #include <das/DasPtr.hpp>
+#include <das/_autogen/idl/abi/IDasGraphRuntime.h>
 #include <das/_autogen/idl/wrapper/Das.PluginInterface.IDasTaskComponent.Implements.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
 #include <string>
 
 namespace Das::Plugins::DasGraphTask
@@ -35,12 +39,29 @@ namespace Das::Plugins::DasGraphTask
 
     // Thin adapter: IDasTaskComponent -> GraphRuntime execution.
     // Delegates to IDasGraphRuntime::Execute() via the public DasCore API.
+    // The runtime is created on first Do() and kept for later runs so the
+    // parsed plan and configured node components stay warm.
+    //
+    // Settings (component config): "parallelExecution" (bool) and
+    // "maxWorkers" (int, 0 = hardware concurrency) select wave-parallel
+    // dispatch for the runtimes this task creates.
     class DasGraphTaskImpl final
         : public Das::PluginInterface::DasTaskComponentImplBase<
               DasGraphTaskImpl>
     {
         std::string                                         last_error_;
         DasPtr<Das::PluginInterface::IDasTaskComponentHost> host_;
+        DasPtr<Das::ExportInterface::IDasGraphRuntime>      runtime_;
+        // Guards the members below; never held while a graph runs.
+        mutable std::mutex runtime_mutex_;
+        // Set while a Do() runs on runtime_; overlapping Do() calls fall back
+        // to a transient runtime.
+        bool runtime_in_use_ = false;
+        // Bumped by every settings change so a runtime built from older
+        // options is not cached.
+        uint64_t settings_generation_ = 0;
+        bool     parallel_execution_ = false;
+        size_t   max_workers_ = 0;
 
     public:
         explicit DasGraphTaskImpl(
@@ -59,6 +80,15 @@ namespace Das::Plugins::DasGraphTask
             Das::PluginInterface::IDasStopToken*       stop_token,
             Das::ExportInterface::IDasReadOnlyPortMap* p_input_port_map,
             Das::ExportInterface::IDasPortMap** pp_out_port_map) override;
+
+        // Runtime kept for reuse; null before the first Do() and after a
+        // settings change.
+        Das::ExportInterface::IDasGraphRuntime*
+        GetCachedRuntime() const
+        {
+            std::lock_guard lock{runtime_mutex_};
+            return runtime_.Get();
+        }
     };
 
 } // namespace Das::Plugins::DasGraphTask
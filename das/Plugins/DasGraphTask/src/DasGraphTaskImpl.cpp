@@ -8,6 +8,8 @@
 #include <das/_autogen/idl/abi/IDasPortMap.h>
 #include <das/_autogen/idl/header/IDasPortMap.generated.h>
 
+#include <algorithm>
+
 namespace Das::Plugins::DasGraphTask
 {
 
@@ -43,12 +45,44 @@ namespace Das::Plugins::DasGraphTask
         Das::ExportInterface::IDasJson*  p_request_json,
         Das::ExportInterface::IDasJson** pp_out_result_json)
     {
-        std::ignore = p_request_json;
         if (pp_out_result_json == nullptr)
         {
             return DAS_E_INVALID_POINTER;
         }
         *pp_out_result_json = nullptr;
+        if (p_request_json == nullptr)
+        {
+            return DAS_S_OK;
+        }
+
+        // GraphRuntime::ApplyNodeSettings wraps the compiled settings as
+        // {"settings": <value>, "payload": <value>}; a bare object is accepted
+        // as well.
+        DAS::DasPtr<Das::ExportInterface::IDasJson> p_settings;
+        const DasReadOnlyString settings_key{"settings"};
+        if (DAS::IsFailed(p_request_json->GetObjectRefByName(
+                settings_key.Get(),
+                p_settings.Put()))
+            || !p_settings)
+        {
+            p_settings = p_request_json;
+        }
+
+        bool    parallel_execution = false;
+        int64_t max_workers = 0;
+        const DasReadOnlyString parallel_key{"parallelExecution"};
+        const DasReadOnlyString workers_key{"maxWorkers"};
+        std::ignore =
+            p_settings->GetBoolByName(parallel_key.Get(), &parallel_execution);
+        std::ignore = p_settings->GetIntByName(workers_key.Get(), &max_workers);
+
+        std::lock_guard lock{runtime_mutex_};
+        parallel_execution_ = parallel_execution;
+        max_workers_ = static_cast<size_t>(std::max<int64_t>(max_workers, 0));
+        ++settings_generation_;
+        // The next Do() creates a runtime with the new options; a run in
+        // progress keeps its own reference to the old one.
+        runtime_ = nullptr;
         return DAS_S_OK;
     }
 
@@ -75,21 +109,67 @@ namespace Das::Plugins::DasGraphTask
         DasResult                       hr = DAS_S_OK;
         if (p_input_port_map != nullptr)
         {
-            DasReadOnlyString compiled_plan_key{"compiledPlan"};
+            // Interned once: the port map resolves it by atom without
+            // transcoding, and the object is immutable so sharing is safe.
+            static const DasReadOnlyString compiled_plan_key =
+                DasReadOnlyString::FromUtf8Interned("compiledPlan", nullptr);
             hr = p_input_port_map->GetString(
                 compiled_plan_key.Get(),
                 p_artifact.Put());
             // It's OK if the port doesn't exist — we pass null artifact.
         }
 
-        // Create GraphRuntime with host bound at construction.
+        // Reuse the cached GraphRuntime (host bound at construction). A run
+        // overlapping one already in progress gets its own runtime instead.
+        // The lock only covers the bookkeeping, never Execute().
         DAS::DasPtr<Das::ExportInterface::IDasGraphRuntime> runtime;
-        hr = CreateGraphRuntimeWithHost(host_.Get(), runtime.Put());
-        if (DAS::IsFailed(hr))
+        bool                                                owns_cache = false;
+        bool                                                parallel_execution;
+        size_t                                              max_workers;
+        uint64_t                                            generation;
         {
-            last_error_ = "Failed to create GraphRuntime";
-            DAS_LOG_ERROR(last_error_.c_str());
-            return hr;
+            std::lock_guard lock{runtime_mutex_};
+            parallel_execution = parallel_execution_;
+            max_workers = max_workers_;
+            generation = settings_generation_;
+            if (!runtime_in_use_)
+            {
+                runtime_in_use_ = true;
+                owns_cache = true;
+                runtime = runtime_;
+            }
+        }
+        const auto release_cache = DAS::Utils::OnExit{
+            [this, owns_cache]
+            {
+                if (owns_cache)
+                {
+                    std::lock_guard lock{runtime_mutex_};
+                    runtime_in_use_ = false;
+                }
+            }};
+
+        if (!runtime)
+        {
+            hr = CreateGraphRuntimeWithOptions(
+                host_.Get(),
+                parallel_execution,
+                max_workers,
+                runtime.Put());
+            if (DAS::IsFailed(hr))
+            {
+                last_error_ = "Failed to create GraphRuntime";
+                DAS_LOG_ERROR(last_error_.c_str());
+                return hr;
+            }
+            if (owns_cache)
+            {
+                std::lock_guard lock{runtime_mutex_};
+                if (generation == settings_generation_)
+                {
+                    runtime_ = runtime;
+                }
+            }
         }
 
         // Execute compiled artifact via GraphRuntime
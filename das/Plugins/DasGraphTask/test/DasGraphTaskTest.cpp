@@ -8,6 +8,10 @@
 #include <das/_autogen/idl/wrapper/Das.PluginInterface.IDasStopToken.Implements.hpp>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <future>
+#include <mutex>
+
 using namespace Das::Plugins::DasGraphTask;
 using DAS::DasPtr;
 
@@ -91,6 +95,36 @@ public:
     }
 };
 
+// Blocks StopRequested() until released, keeping the caller's run open.
+class BlockingStopToken final
+    : public Das::PluginInterface::DasStopTokenImplBase<BlockingStopToken>
+{
+public:
+    std::promise<void> entered;
+    std::promise<void> release;
+
+private:
+    std::once_flag           entered_once_;
+    std::shared_future<void> released_{release.get_future().share()};
+
+public:
+    DAS_IMPL StopRequested(bool* canStop) override
+    {
+        if (!canStop)
+            return DAS_E_INVALID_POINTER;
+        std::call_once(entered_once_, [this] { entered.set_value(); });
+        released_.wait();
+        *canStop = false;
+        return DAS_S_OK;
+    }
+};
+
+Das::ExportInterface::IDasGraphRuntime* CachedRuntimeOf(
+    const DasPtr<Das::PluginInterface::IDasTaskComponent>& task)
+{
+    return static_cast<DasGraphTaskImpl*>(task.Get())->GetCachedRuntime();
+}
+
 // ---- Tests ----
 
 TEST(DasGraphTaskTest, ConstructWithNullHost)
@@ -146,6 +180,172 @@ TEST(DasGraphTaskTest, DoStopTokenCancel)
     EXPECT_TRUE(DAS::IsFailed(hr));
 }
 
+// The GraphRuntime kept by the task survives a cancelled run and serves the
+// following runs.
+TEST(DasGraphTaskTest, DoReusesRuntimeAcrossRuns)
+{
+    auto host = DasPtr<Das::PluginInterface::IDasTaskComponentHost>(
+        new MockTaskComponentHost());
+    auto task = DasGraphTaskImpl::Make(host.Get());
+    ASSERT_NE(task.Get(), nullptr);
+    EXPECT_EQ(CachedRuntimeOf(task), nullptr);
+
+    auto cancelled_token = MockStopTokenForTask::Make(true);
+    DasPtr<Das::ExportInterface::IDasPortMap> result;
+    EXPECT_TRUE(
+        DAS::IsFailed(task->Do(cancelled_token.Get(), nullptr, result.Put())));
+    auto* const p_runtime = CachedRuntimeOf(task);
+    ASSERT_NE(p_runtime, nullptr);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        DasPtr<Das::ExportInterface::IDasPortMap> next;
+        EXPECT_TRUE(DAS::IsOk(task->Do(nullptr, nullptr, next.Put())));
+        EXPECT_NE(next.Get(), nullptr);
+        EXPECT_EQ(CachedRuntimeOf(task), p_runtime);
+    }
+}
+
+// A Do() overlapping a run in progress does not wait for the cached runtime:
+// it runs on a transient one and leaves the cache untouched.
+TEST(DasGraphTaskTest, OverlappingDoUsesTransientRuntime)
+{
+    auto host = DasPtr<Das::PluginInterface::IDasTaskComponentHost>(
+        new MockTaskComponentHost());
+    auto task = DasGraphTaskImpl::Make(host.Get());
+    ASSERT_NE(task.Get(), nullptr);
+
+    DasPtr<Das::ExportInterface::IDasPortMap> warm;
+    ASSERT_TRUE(DAS::IsOk(task->Do(nullptr, nullptr, warm.Put())));
+    auto* const p_runtime = CachedRuntimeOf(task);
+    ASSERT_NE(p_runtime, nullptr);
+
+    // Parks the first run inside the cached runtime's Execute().
+    auto  blocking_token = BlockingStopToken::Make();
+    auto* p_blocking = static_cast<BlockingStopToken*>(blocking_token.Get());
+    auto  entered = p_blocking->entered.get_future();
+    auto  first = std::async(
+        std::launch::async,
+        [&]
+        {
+            DasPtr<Das::ExportInterface::IDasPortMap> out;
+            return task->Do(blocking_token.Get(), nullptr, out.Put());
+        });
+    ASSERT_EQ(
+        entered.wait_for(std::chrono::seconds{5}),
+        std::future_status::ready);
+
+    auto second = std::async(
+        std::launch::async,
+        [&]
+        {
+            DasPtr<Das::ExportInterface::IDasPortMap> out;
+            return task->Do(nullptr, nullptr, out.Put());
+        });
+    const auto second_status = second.wait_for(std::chrono::seconds{5});
+    p_blocking->release.set_value();
+
+    ASSERT_EQ(second_status, std::future_status::ready);
+    EXPECT_TRUE(DAS::IsOk(second.get()));
+    EXPECT_TRUE(DAS::IsOk(first.get()));
+    EXPECT_EQ(CachedRuntimeOf(task), p_runtime);
+}
+
+// A settings change does not wait for a run in progress; the run finishes on
+// its runtime and the next Do() builds one from the new options.
+TEST(DasGraphTaskTest, SettingsChangeDoesNotWaitForRun)
+{
+    auto host = DasPtr<Das::PluginInterface::IDasTaskComponentHost>(
+        new MockTaskComponentHost());
+    auto task = DasGraphTaskImpl::Make(host.Get());
+    ASSERT_NE(task.Get(), nullptr);
+
+    DasPtr<Das::ExportInterface::IDasPortMap> warm;
+    ASSERT_TRUE(DAS::IsOk(task->Do(nullptr, nullptr, warm.Put())));
+    ASSERT_NE(CachedRuntimeOf(task), nullptr);
+
+    auto  blocking_token = BlockingStopToken::Make();
+    auto* p_blocking = static_cast<BlockingStopToken*>(blocking_token.Get());
+    auto  entered = p_blocking->entered.get_future();
+    auto  first = std::async(
+        std::launch::async,
+        [&]
+        {
+            DasPtr<Das::ExportInterface::IDasPortMap> out;
+            return task->Do(blocking_token.Get(), nullptr, out.Put());
+        });
+    ASSERT_EQ(
+        entered.wait_for(std::chrono::seconds{5}),
+        std::future_status::ready);
+
+    DasPtr<Das::ExportInterface::IDasJson> settings;
+    ASSERT_EQ(
+        ParseDasJsonFromString(
+            R"({"settings":{"parallelExecution":true,"maxWorkers":2}})",
+            settings.Put()),
+        DAS_S_OK);
+    auto apply = std::async(
+        std::launch::async,
+        [&]
+        {
+            DasPtr<Das::ExportInterface::IDasJson> accepted;
+            return task->ApplySettingsChange(settings.Get(), accepted.Put());
+        });
+    const auto apply_status = apply.wait_for(std::chrono::seconds{5});
+    p_blocking->release.set_value();
+
+    ASSERT_EQ(apply_status, std::future_status::ready);
+    EXPECT_TRUE(DAS::IsOk(apply.get()));
+    EXPECT_TRUE(DAS::IsOk(first.get()));
+    EXPECT_EQ(CachedRuntimeOf(task), nullptr);
+
+    DasPtr<Das::ExportInterface::IDasPortMap> next;
+    ASSERT_TRUE(DAS::IsOk(task->Do(nullptr, nullptr, next.Put())));
+    auto* p_parallel = static_cast<Das::Core::GraphRuntime::GraphRuntimeImpl*>(
+        CachedRuntimeOf(task));
+    ASSERT_NE(p_parallel, nullptr);
+    EXPECT_TRUE(p_parallel->GetEngine().GetParallelExecution().enabled);
+}
+
+// "parallelExecution"/"maxWorkers" component settings reach the runtime
+// created by the next Do().
+TEST(DasGraphTaskTest, ParallelSettingsConfigureRuntime)
+{
+    auto host = DasPtr<Das::PluginInterface::IDasTaskComponentHost>(
+        new MockTaskComponentHost());
+    auto task = DasGraphTaskImpl::Make(host.Get());
+    ASSERT_NE(task.Get(), nullptr);
+
+    DasPtr<Das::ExportInterface::IDasPortMap> result;
+    ASSERT_TRUE(DAS::IsOk(task->Do(nullptr, nullptr, result.Put())));
+    auto* p_impl = static_cast<DasGraphTaskImpl*>(task.Get());
+    auto* p_sequential =
+        static_cast<Das::Core::GraphRuntime::GraphRuntimeImpl*>(
+            p_impl->GetCachedRuntime());
+    ASSERT_NE(p_sequential, nullptr);
+    EXPECT_FALSE(p_sequential->GetEngine().GetParallelExecution().enabled);
+
+    DasPtr<Das::ExportInterface::IDasJson> settings;
+    ASSERT_EQ(
+        ParseDasJsonFromString(
+            R"({"settings":{"parallelExecution":true,"maxWorkers":2}})",
+            settings.Put()),
+        DAS_S_OK);
+    DasPtr<Das::ExportInterface::IDasJson> accepted;
+    ASSERT_TRUE(
+        DAS::IsOk(task->ApplySettingsChange(settings.Get(), accepted.Put())));
+    EXPECT_EQ(p_impl->GetCachedRuntime(), nullptr);
+
+    DasPtr<Das::ExportInterface::IDasPortMap> next;
+    ASSERT_TRUE(DAS::IsOk(task->Do(nullptr, nullptr, next.Put())));
+    auto* p_parallel = static_cast<Das::Core::GraphRuntime::GraphRuntimeImpl*>(
+        p_impl->GetCachedRuntime());
+    ASSERT_NE(p_parallel, nullptr);
+    const auto& parallel = p_parallel->GetEngine().GetParallelExecution();
+    EXPECT_TRUE(parallel.enabled);
+    EXPECT_EQ(parallel.max_workers, 2u);
+}
+
 // Smoke: a plan produced by the authoring Compile path can be fed into
 // DasGraphTaskImpl::Do (compiledPlan port) and execute without error on an
 // empty graph. Validates the authoring→compile→Do handoff (DAS-77 Wave3 A1).
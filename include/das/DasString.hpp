@@ -2,6 +2,7 @@
 #define DAS_STRING_HPP
 
 #include <cstdint>
+#include <cstring>
 #include <das/DasConfig.h>
 #include <das/DasException.hpp>
 #include <das/DasPtr.hpp>
@@ -117,6 +118,17 @@ DAS_C_API DasResult CreateIDasReadOnlyStringFromUtf8WithLength(
     size_t               length,
     IDasReadOnlyString** pp_out_readonly_string);
 
+/**
+ * @brief Get the interned IDasReadOnlyString for the given UTF-8 content.
+ * The same content always yields the same object, which stays alive until
+ * process exit; GetUtf8 on it returns the stored bytes without transcoding.
+ * Intended for a small, fixed set of keys such as port ids.
+ */
+DAS_C_API DasResult CreateInternedIDasReadOnlyString(
+    const char*          p_utf8_string,
+    size_t               length,
+    IDasReadOnlyString** pp_out_readonly_string);
+
 DAS_C_API DasResult CreateIDasStringFromUtf16WithLength(
     const DasUtf16CodeUnit* p_utf16_string,
     size_t                  length,
@@ -249,6 +261,44 @@ public:
     {
         return FromUtf8(u8_string.c_str(), p_out_result);
     }
+
+    static DasReadOnlyString FromUtf8Interned(
+        const char* p_u8_string,
+        DasResult*  p_out_result)
+    {
+        DasReadOnlyString               result{};
+        DAS::DasPtr<IDasReadOnlyString> p_result{};
+        const auto                      create_result =
+            ::CreateInternedIDasReadOnlyString(
+                p_u8_string,
+                p_u8_string == nullptr ? 0 : std::strlen(p_u8_string),
+                p_result.Put());
+        if (p_out_result)
+        {
+            *p_out_result = create_result;
+        }
+        result.p_impl_ = std::move(p_result);
+        return result;
+    }
+
+    static DasReadOnlyString FromUtf8Interned(
+        const std::string& u8_string,
+        DasResult*         p_out_result)
+    {
+        DasReadOnlyString               result{};
+        DAS::DasPtr<IDasReadOnlyString> p_result{};
+        const auto                      create_result =
+            ::CreateInternedIDasReadOnlyString(
+                u8_string.data(),
+                u8_string.size(),
+                p_result.Put());
+        if (p_out_result)
+        {
+            *p_out_result = create_result;
+        }
+        result.p_impl_ = std::move(p_result);
+        return result;
+    }
 #endif // SWIG
 
 /**
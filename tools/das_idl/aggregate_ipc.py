@@ -347,6 +347,7 @@ def _generate_stub_factory(ipc_output_dir: Path, interfaces: List[Dict[str, Any]
         "#include <das/Core/IPC/IStubBase.h>",
         "#include <das/Core/IPC/IpcRunLoop.h>",
         "#include <das/Core/IPC/IpcMessageHeader.h>",
+        "#include <das/Core/IPC/QueryInterfaceSet.h>",
         "",
     ]
 
@@ -386,6 +387,13 @@ def _generate_stub_factory(ipc_output_dir: Path, interfaces: List[Dict[str, Any]
 
         lines.append(f"        run_loop.RegisterHandler(Das::Core::IPC::HeaderFlags::NONE, {interface_id}, &{stub_name}_);")
 
+    # 登记可导出接口的 IID，QUERY_INTERFACE 据此发布对象的接口集合
+    for iface in interfaces:
+        interface_name = iface.get('interface_name', '')
+        ns = iface.get('namespace', '')
+        interface_type = f"{ns}::{interface_name}" if ns else f"::{interface_name}"
+        lines.append(f"        Das::Core::IPC::RegisterExportedInterfaceIid(DasIidOf<{interface_type}>());")
+
     lines.extend([
         "    }",
         "",
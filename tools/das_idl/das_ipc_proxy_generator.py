@@ -150,10 +150,12 @@ class IpcProxyGenerator:
 #include <das/Core/IPC/MemorySerializer.h>
 #include <das/Core/IPC/ProxyFactory.h>
 #include <das/Core/IPC/Serializer.h>
+#include <das/Core/IPC/SpanSerializer.h>
 #include <das/Core/Logger/Logger.h>
 #include <atomic>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "{abi_header_name}"
 
@@ -200,9 +202,8 @@ class IpcProxyGenerator:
         if needs_cstring:
             result += "#include <cstring>\n"
 
-        # 条件添加 <vector> (for [binary_buffer] methods)
+        # 条件添加 [binary_buffer] 方法所需的头文件
         if has_binary_buffer:
-            result += "#include <vector>\n"
             result += "#include <das/Core/IPC/AsyncIpcTransport.h>\n"
             result += "#include <das/Core/IPC/ConnectionManager.h>\n"
             result += "#include <das/Core/IPC/IpcCommandHandler.h>\n"
@@ -605,6 +606,10 @@ class IpcProxyGenerator:
         'DasBool': 1,
     }
 
+    # 不放入 packed 参数块的类型：DasBool 是 int32_t 却按 1 字节写入，
+    # size_t 在 32 位平台上与 8 字节线格式宽度不同
+    BLOCK_EXCLUDED_TYPES = {'DasBool', 'size_t'}
+
     def _is_fixed_size_method(self, method: MethodDef) -> bool:
         """检查方法所有 [in] 参数是否都是固定大小（无字符串、无变长数据）"""
         FIXED_SIZE_SPECIAL = {'DasGuid', 'DasResult', 'DasBool'}
@@ -774,7 +779,121 @@ class IpcProxyGenerator:
 
         return lines
 
+    def _is_block_scalar_type(self, bt: str) -> bool:
+        """标量类型能否放进 packed 参数块（块内布局须与逐字段 Write* 完全一致）"""
+        return bt in self.FIXED_SIZES and bt not in self.BLOCK_EXCLUDED_TYPES
+
+    def _is_block_param(self, param: ParameterDef) -> bool:
+        """[in] 参数能否与相邻的定长参数合并为一个 packed 块，以一次 memcpy 写入"""
+        bt = param.type_info.base_type
+        if bt == 'IDasReadOnlyString' or bt == 'string':
+            return False
+        if self._is_param_interface(param):
+            return True
+        if bt in self.type_mapper.enum_types:
+            return True
+        if bt in self.type_mapper.struct_defs:
+            struct_def = self.type_mapper.struct_defs[bt]
+            return all(self._is_block_scalar_type(field.type_name)
+                       for field in struct_def.fields)
+        return self._is_block_scalar_type(bt)
+
     def _generate_variable_size_request_body(self, interface: InterfaceDef, method: MethodDef, method_index: int, in_params: List[ParameterDef], indent: str) -> List[str]:
+        """生成变长请求体：定长参数按 packed 块整体写入，字符串写入预先算好大小的缓冲区
+
+        相邻的定长参数（第一个块还包含 V3 Body Header）合并为 #pragma pack(1)
+        结构体，字符串之间的每段只需一次 memcpy；总大小在分配前精确算出，
+        SpanSerializerWriter 没有虚函数调用，也不会触发 vector 扩容。
+        含有无法放进块的参数时退回 MemorySerializerWriter 逐字段写入。
+        """
+        if not all(p.type_info.base_type == "IDasReadOnlyString" or self._is_block_param(p)
+                   for p in in_params):
+            return self._generate_serializer_request_body(
+                interface, method, method_index, in_params, indent)
+
+        # 按字符串参数切分：blocks[i] 是第 i 段定长参数，strings[i] 紧随其后
+        blocks: List[List[ParameterDef]] = [[]]
+        strings: List[ParameterDef] = []
+        for param in in_params:
+            if param.type_info.base_type == "IDasReadOnlyString":
+                strings.append(param)
+                blocks.append([])
+            else:
+                blocks[-1].append(param)
+
+        block_prefix = f"{interface.name}_{method.name}_RequestBlock"
+        lines = []
+        lines.append(f"{indent}#pragma pack(push, 1)")
+        for i, block in enumerate(blocks):
+            if i != 0 and not block:
+                continue
+            lines.append(f"{indent}struct {block_prefix}{i} {{")
+            if i == 0:
+                lines.append(f"{indent}    // V3 Body Header (16 bytes)")
+                lines.append(f"{indent}    uint32_t interface_id;")
+                lines.append(f"{indent}    uint16_t method_id;")
+                lines.append(f"{indent}    uint16_t reserved;")
+                lines.append(f"{indent}    uint16_t session_id;")
+                lines.append(f"{indent}    uint16_t generation;")
+                lines.append(f"{indent}    uint32_t local_id;")
+            for param in block:
+                lines.extend(self._generate_struct_fields(param, indent + "    "))
+            lines.append(f"{indent}}};")
+        lines.append(f"{indent}#pragma pack(pop)")
+        lines.append("")
+        lines.append(f"{indent}DasResult ipc_result = DAS_S_OK;")
+        lines.append(f"{indent}(void)ipc_result;")
+        lines.append("")
+
+        # 填充各段定长参数并取出字符串，同时累加总大小
+        size_terms = []
+        for i, block in enumerate(blocks):
+            if i == 0 or block:
+                lines.append(f"{indent}{block_prefix}{i} block{i}{{}};")
+                if i == 0:
+                    lines.append(f"{indent}block0.interface_id = InterfaceId;")
+                    lines.append(f"{indent}block0.method_id = {method_index};")
+                    lines.append(f"{indent}block0.reserved = 0;")
+                    lines.append(f"{indent}block0.session_id = GetObjectId().session_id;")
+                    lines.append(f"{indent}block0.generation = GetObjectId().generation;")
+                    lines.append(f"{indent}block0.local_id = GetObjectId().local_id;")
+                for param in block:
+                    lines.extend(self._generate_struct_fill(param, f"block{i}.", indent))
+                size_terms.append(f"sizeof(block{i})")
+            if i < len(strings):
+                pn = strings[i].name
+                lines.append(f"{indent}const char* {pn}_u8 = nullptr;")
+                lines.append(f"{indent}ipc_result = {pn}->GetUtf8(&{pn}_u8);")
+                lines.append(f"{indent}if (DAS::IsFailed(ipc_result))")
+                lines.append(f"{indent}{{")
+                lines.append(f"{indent}    return ipc_result;")
+                lines.append(f"{indent}}}")
+                lines.append(f"{indent}const size_t {pn}_len = std::strlen({pn}_u8);")
+                size_terms.append(f"sizeof(uint64_t) + {pn}_len")
+        lines.append("")
+
+        # 一次分配精确大小的缓冲区，之后只有 memcpy
+        lines.append(f"{indent}std::vector<uint8_t> request_body(")
+        lines.append(f"{indent}    " + f"\n{indent}    + ".join(size_terms) + ");")
+        lines.append(f"{indent}SpanSerializerWriter writer{{request_body}};")
+        for i, block in enumerate(blocks):
+            if i == 0 or block:
+                lines.append(f"{indent}ipc_result = writer.WritePod(block{i});")
+                lines.append(f"{indent}if (DAS::IsFailed(ipc_result))")
+                lines.append(f"{indent}{{")
+                lines.append(f"{indent}    return ipc_result;")
+                lines.append(f"{indent}}}")
+            if i < len(strings):
+                pn = strings[i].name
+                lines.append(f"{indent}ipc_result = writer.WriteString({pn}_u8, {pn}_len);")
+                lines.append(f"{indent}if (DAS::IsFailed(ipc_result))")
+                lines.append(f"{indent}{{")
+                lines.append(f"{indent}    return ipc_result;")
+                lines.append(f"{indent}}}")
+
+        return lines
+
+    def _generate_serializer_request_body(self, interface: InterfaceDef, method: MethodDef, method_index: int, in_params: List[ParameterDef], indent: str) -> List[str]:
         """生成使用 writer.Reserve(total_size) 的变长请求体（单次分配）"""
         lines = []
         lines.append(f"{indent}DasResult ipc_result = DAS_S_OK;")
@@ -857,6 +976,7 @@ class IpcProxyGenerator:
                 # 使用现有的序列化方法
                 serialize_code = self._generate_serialize_param(param, indent)
                 lines.extend(serialize_code)
+        lines.append(f"{indent}const std::vector<uint8_t>& request_body = writer.GetBuffer();")
 
         return lines
 
@@ -924,7 +1044,7 @@ class IpcProxyGenerator:
                 interface, method, method_index, in_params, indent)
             lines.extend(struct_lines)
         else:
-            # 变长路径: MemorySerializerWriter with Reserve
+            # 变长路径: packed 块 + SpanSerializerWriter（精确预分配）
             var_lines = self._generate_variable_size_request_body(
                 interface, method, method_index, in_params, indent)
             lines.extend(var_lines)
@@ -942,7 +1062,6 @@ class IpcProxyGenerator:
                 lines.append(f"{indent}ipc_result = SendRequest({method_index},")
                 lines.append(f"{indent}    reinterpret_cast<const uint8_t*>(&req), sizeof(req), response_body);")
         else:
-            lines.append(f"{indent}const std::vector<uint8_t>& request_body = writer.GetBuffer();")
             if is_binary_buffer:
                 lines.append(f"{indent}ipc_result = SendRequest({method_index},")
                 lines.append(f"{indent}    request_body.data(), request_body.size(), response_body, &response_flags);")
@@ -967,7 +1086,7 @@ class IpcProxyGenerator:
         lines.append("")
         
         if need_response_body:
-            lines.append(f"{indent}MemorySerializerReader reader(response_body);")
+            lines.append(f"{indent}SpanSerializerReader reader(response_body);")
             lines.append("")
             lines.append(f"{indent}DasResult remote_result;")
             lines.append(f"{indent}ipc_result = reader.ReadInt32(&remote_result);")
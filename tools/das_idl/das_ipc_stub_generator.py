@@ -124,6 +124,7 @@ class IpcStubGenerator:
         includes.append("#include <das/Core/IPC/InterfaceParamSerialization.h>")
         includes.append("#include <das/Core/IPC/ProxyFactory.h>")
         includes.append("#include <das/Core/IPC/Serializer.h>")
+        includes.append("#include <das/Core/IPC/SpanSerializer.h>")
         includes.append("#include <das/DasString.hpp>")
         includes.append("#include <algorithm>")
         includes.append("#include <cstdint>")
@@ -533,15 +534,12 @@ class IpcStubGenerator:
 
         # ===== 反序列化阶段 =====
         if has_request_body:
-            lines.append(f"{inner_indent}Das::Core::IPC::MemorySerializerReader reader(params, params_size);")
+            lines.append(f"{inner_indent}Das::Core::IPC::SpanSerializerReader reader(params, params_size);")
             lines.append("")
 
             # 反序列化参数（V3 Body Header 已在 IStubBase::HandleMessage 中解析）
             lines.append(f"{inner_indent}// Parameters (V3 Body after 16-byte header)")
-            for param in in_params:
-                deserialize_code = self._generate_deserialize_param_for_stub(param, inner_indent)
-                for line in deserialize_code:
-                    lines.append(f"{line}")
+            lines.extend(self._generate_deserialize_params_for_stub(method, in_params, inner_indent))
             lines.append("")
 
         call_params = []
@@ -615,7 +613,6 @@ class IpcStubGenerator:
                 resp_lines = self._generate_variable_size_response_body(
                     interface, method, out_params, has_return, inner_indent)
                 lines.extend(resp_lines)
-                lines.append(f"{inner_indent}out_response = writer.GetBuffer();")
         # else: void method without out_params - no response body
 
         lines.append(f"{inner_indent}return DAS_S_OK;")
@@ -623,6 +620,10 @@ class IpcStubGenerator:
 
         return "\n".join(lines)
 
+    # 不放入 packed 参数块的类型：DasBool 是 int32_t 却按 1 字节传输，
+    # size_t 在 32 位平台上与 8 字节线格式宽度不同
+    BLOCK_EXCLUDED_TYPES = {'DasBool', 'size_t'}
+
     def _is_fixed_size_response(self, method: MethodDef) -> bool:
         """Check if all [out] params + return value are fixed-size (no strings)
 
@@ -678,6 +679,123 @@ class IpcStubGenerator:
             return 12
         return 0
 
+    def _get_out_param_exact_size(self, param: ParameterDef) -> Optional[int]:
+        """[out] 参数在变长响应中的精确字节数；字符串返回 0（长度运行时累加），
+        无法精确计算时返回 None"""
+        bt = param.type_info.base_type
+        if bt == 'IDasReadOnlyString' and param.type_info.is_pointer:
+            return 0
+        if param.type_info.type_kind == TypeKind.INTERFACE and param.type_info.is_pointer:
+            return 12
+        if bt in self.type_mapper.enum_types:
+            return 4
+        if bt in self.type_mapper.struct_defs:
+            struct_def = self.type_mapper.struct_defs[bt]
+            if not struct_def or not struct_def.fields:
+                return None
+            if not all(field.type_name in self.FIXED_SIZES for field in struct_def.fields):
+                return None
+            return self._get_out_param_fixed_size(param)
+        if bt in self.FIXED_SIZES:
+            return self.FIXED_SIZES[bt]
+        return None
+
+    def _get_return_exact_size(self, return_type: TypeInfo) -> Optional[int]:
+        """非 DasResult 返回值在响应中的精确字节数，无法精确计算时返回 None"""
+        bt = return_type.base_type
+        if bt in self.type_mapper.enum_types:
+            return 4
+        if bt in self.FIXED_SIZES:
+            return self.FIXED_SIZES[bt]
+        return None
+
+    def _is_block_scalar_type(self, bt: str) -> bool:
+        """标量类型能否放进 packed 参数块（块内布局须与逐字段 Read* 完全一致）"""
+        return bt in self.FIXED_SIZES and bt not in self.BLOCK_EXCLUDED_TYPES
+
+    def _is_block_param(self, param: ParameterDef) -> bool:
+        """[in] 参数能否与相邻的定长参数合并为一个 packed 块，以一次 memcpy 读出"""
+        bt = param.type_info.base_type
+        if bt == 'IDasReadOnlyString' or bt == 'string':
+            return False
+        if param.type_info.type_kind == TypeKind.INTERFACE and param.type_info.is_pointer:
+            return True
+        if bt in self.type_mapper.enum_types:
+            return True
+        if bt in self.type_mapper.struct_defs:
+            struct_def = self.type_mapper.struct_defs[bt]
+            return bool(struct_def and struct_def.fields) and all(
+                self._is_block_scalar_type(field.type_name) for field in struct_def.fields)
+        if param.type_info.is_pointer or self.type_mapper.get_type_info(bt) is None:
+            return False
+        return self._is_block_scalar_type(bt)
+
+    def _get_block_field_cpp_type(self, bt: str) -> str:
+        """packed 块中标量字段的 C++ 类型；bool 以 uint8_t 读出，避免非 0/1 字节成为 bool"""
+        if bt == 'bool':
+            return 'uint8_t'
+        type_info = self.type_mapper.get_type_info(bt)
+        return type_info[0] if type_info else bt
+
+    def _generate_request_block_fields(self, param: ParameterDef, indent: str, local_name: str) -> List[str]:
+        """生成 [in] 参数在 packed 请求块中的字段声明"""
+        bt = param.type_info.base_type
+        if param.type_info.type_kind == TypeKind.INTERFACE and param.type_info.is_pointer:
+            return [f"{indent}uint64_t {local_name}_encoded_value;"]
+        if bt in self.type_mapper.enum_types:
+            return [f"{indent}int32_t {local_name};"]
+        if bt in self.type_mapper.struct_defs:
+            return [f"{indent}{self._get_block_field_cpp_type(field.type_name)} {local_name}_{field.name};"
+                    for field in self.type_mapper.struct_defs[bt].fields]
+        return [f"{indent}{self._get_block_field_cpp_type(bt)} {local_name};"]
+
+    def _generate_deserialize_params_for_stub(self, method: MethodDef, in_params, indent: str) -> List[str]:
+        """生成全部 [in] 参数的反序列化代码
+
+        两个及以上相邻的定长参数合并为一个 #pragma pack(1) 块，用一次 ReadPod
+        读出后再赋给局部变量；字符串等变长参数逐个读取。
+        """
+        lines = []
+        handle_param_names = {'impl', 'params', 'params_size', 'out_response', 'ctx'}
+
+        runs = []
+        for param in in_params:
+            if self._is_block_param(param):
+                if runs and isinstance(runs[-1], list):
+                    runs[-1].append(param)
+                else:
+                    runs.append([param])
+            else:
+                runs.append(param)
+
+        block_index = 0
+        for run in runs:
+            # 单个定长参数本身就是一次 memcpy，无需额外的块
+            if not isinstance(run, list) or len(run) == 1:
+                param = run[0] if isinstance(run, list) else run
+                lines.extend(self._generate_deserialize_param_for_stub(param, indent))
+                continue
+
+            struct_name = f"{method.name}_RequestBlock{block_index}"
+            block_name = f"params_block{block_index}"
+            block_index += 1
+            lines.append(f"{indent}#pragma pack(push, 1)")
+            lines.append(f"{indent}struct {struct_name} {{")
+            for param in run:
+                local_name = f"arg_{param.name}" if param.name in handle_param_names else param.name
+                lines.extend(self._generate_request_block_fields(param, indent + "    ", local_name))
+            lines.append(f"{indent}}};")
+            lines.append(f"{indent}#pragma pack(pop)")
+            lines.append(f"{indent}{struct_name} {block_name};")
+            lines.append(f"{indent}serial_result = reader.ReadPod(&{block_name});")
+            lines.append(f"{indent}if (DAS::IsFailed(serial_result))")
+            lines.append(f"{indent}{{")
+            lines.append(f"{indent}    return serial_result;")
+            lines.append(f"{indent}}}")
+            for param in run:
+                lines.extend(self._generate_deserialize_param_for_stub(param, indent, block_name))
+        return lines
+
     def _generate_response_struct_fields(self, param: ParameterDef, indent: str, local_name: str) -> List[str]:
         """Generate packed struct field declarations for an [out] parameter."""
         lines = []
@@ -866,23 +984,27 @@ class IpcStubGenerator:
             lines.append(f"{indent}// If impl call failed, skip output param serialization (params may be NULL)")
             lines.append(f"{indent}if (DAS::IsFailed(call_result))")
             lines.append(f"{indent}{{")
-            lines.append(f"{indent}    Das::Core::IPC::MemorySerializerWriter writer;")
-            lines.append(f"{indent}    serial_result = writer.WriteInt32(call_result);")
-            lines.append(f"{indent}    if (DAS::IsFailed(serial_result))")
-            lines.append(f"{indent}    {{")
-            lines.append(f"{indent}        return serial_result;")
-            lines.append(f"{indent}    }}")
-            lines.append(f"{indent}    out_response = writer.GetBuffer();")
+            lines.append(f"{indent}    const int32_t remote_result = static_cast<int32_t>(call_result);")
+            lines.append(f"{indent}    out_response.assign(")
+            lines.append(f"{indent}        reinterpret_cast<const uint8_t*>(&remote_result),")
+            lines.append(f"{indent}        reinterpret_cast<const uint8_t*>(&remote_result) + sizeof(remote_result));")
             lines.append(f"{indent}    return DAS_S_OK;")
             lines.append(f"{indent}}}")
             lines.append("")
 
+        # 所有字段大小都能精确算出时直接写入 out_response，否则经 MemorySerializerWriter
+        return_size = 0
+        if has_return and not is_das_result_return:
+            return_size = self._get_return_exact_size(method.return_type)
+        exact_size = return_size is not None and all(
+            self._get_out_param_exact_size(p) is not None for p in out_params)
+
         # Phase 1: Pre-calculate total response size
         lines.append(f"{indent}// Pre-calculate total response size for single allocation")
         lines.append(f"{indent}size_t total_response_size = 4;  // remote_result (int32)")
 
         if has_return and not is_das_result_return:
-            lines.append(f"{indent}total_response_size += 4;  // return_value (int32)")
+            lines.append(f"{indent}total_response_size += {return_size or 4};  // return_value")
 
         string_params = []  # Track IDasReadOnlyString [out] params for GetUtf8
         for param in out_params:
@@ -906,8 +1028,12 @@ class IpcStubGenerator:
         lines.append("")
 
         # Phase 2: Create writer with pre-allocation
-        lines.append(f"{indent}Das::Core::IPC::MemorySerializerWriter writer;")
-        lines.append(f"{indent}writer.Reserve(total_response_size);")
+        if exact_size:
+            lines.append(f"{indent}out_response.resize(total_response_size);")
+            lines.append(f"{indent}Das::Core::IPC::SpanSerializerWriter writer{{out_response}};")
+        else:
+            lines.append(f"{indent}Das::Core::IPC::MemorySerializerWriter writer;")
+            lines.append(f"{indent}writer.Reserve(total_response_size);")
         lines.append("")
 
         # Phase 3: Write response body
@@ -944,6 +1070,15 @@ class IpcStubGenerator:
             for line in serialize_return_code:
                 lines.append(f"{line}")
 
+        if exact_size:
+            # 预计算大小与写入量不符说明生成器有误，不能发出带尾部垃圾的响应
+            lines.append(f"{indent}if (writer.GetRemaining() != 0)")
+            lines.append(f"{indent}{{")
+            lines.append(f"{indent}    return DAS_E_IPC_SERIALIZATION_FAILED;")
+            lines.append(f"{indent}}}")
+        else:
+            lines.append(f"{indent}out_response = writer.GetBuffer();")
+
         return lines
 
     def _generate_binary_buffer_response(self, interface: InterfaceDef, method: MethodDef, out_params, has_return: bool, indent: str) -> List[str]:
@@ -1054,8 +1189,11 @@ class IpcStubGenerator:
 
         return lines
 
-    def _generate_deserialize_param_for_stub(self, param: ParameterDef, indent: str) -> List[str]:
-        """生成参数反序列化代码（用于 Stub 从请求体读取参数）"""
+    def _generate_deserialize_param_for_stub(self, param: ParameterDef, indent: str, block_name: Optional[str] = None) -> List[str]:
+        """生成参数反序列化代码（用于 Stub 从请求体读取参数）
+
+        block_name 非空时参数已随 packed 块读出，从块字段取值而不再读 reader。
+        """
         lines = []
 
         # Handle 方法参数名列表（用于检测变量名冲突）
@@ -1108,12 +1246,15 @@ class IpcStubGenerator:
 
             # 反序列化接口指针：先读 ObjectId，再判断本地/远程
             lines.append(f"{indent}// 反序列化接口指针: {interface_name}*")
-            lines.append(f"{indent}uint64_t {param_name}_encoded_value;")
-            lines.append(f"{indent}serial_result = reader.ReadUInt64(&{param_name}_encoded_value);")
-            lines.append(f"{indent}if (DAS::IsFailed(serial_result))")
-            lines.append(f"{indent}{{")
-            lines.append(f"{indent}    return serial_result;")
-            lines.append(f"{indent}}}")
+            if block_name:
+                lines.append(f"{indent}const uint64_t {param_name}_encoded_value = {block_name}.{param_name}_encoded_value;")
+            else:
+                lines.append(f"{indent}uint64_t {param_name}_encoded_value;")
+                lines.append(f"{indent}serial_result = reader.ReadUInt64(&{param_name}_encoded_value);")
+                lines.append(f"{indent}if (DAS::IsFailed(serial_result))")
+                lines.append(f"{indent}{{")
+                lines.append(f"{indent}    return serial_result;")
+                lines.append(f"{indent}}}")
 
             # Compute interface_id hash at generation time
             interface_uuid = None
@@ -1164,6 +1305,20 @@ class IpcStubGenerator:
 
         cpp_type, _, read_method, is_struct = type_info
 
+        if block_name:
+            bt = param.type_info.base_type
+            if is_struct:
+                lines.append(f"{indent}{bt} {local_name};")
+                for field in self.type_mapper.struct_defs[bt].fields:
+                    suffix = " != 0" if field.type_name == 'bool' else ""
+                    lines.append(f"{indent}{local_name}.{field.name} = {block_name}.{local_name}_{field.name}{suffix};")
+            elif bt in self.type_mapper.enum_types:
+                lines.append(f"{indent}{bt} {local_name} = static_cast<{bt}>({block_name}.{local_name});")
+            else:
+                suffix = " != 0" if bt == 'bool' else ""
+                lines.append(f"{indent}{cpp_type} {local_name} = {block_name}.{local_name}{suffix};")
+            return lines
+
         if is_struct:
             # 使用内联字段展开进行反序列化
             struct_def = self.type_mapper.struct_defs.get(param.type_info.base_type)